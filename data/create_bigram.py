@@ -0,0 +1,119 @@
+#!/usr/bin/env python
+# vim:set et ts=4 sts=4:
+#
+# ibus-pinyin - The Chinese PinYin engine for IBus
+#
+# Compile a segmented corpus into the phrase bigram model loaded by
+# src/PYBigram.cc.
+#
+# usage: create_bigram.py [-c min_count] corpus.txt main.bigram
+#
+# The corpus is utf-8 text, one sentence per line, with phrases separated
+# by white space.  Only pairs seen at least min_count times are kept.
+#
+# File layout (all integers are little endian):
+#   header:  "PYBG", version (32), n_slots (32), n_bigrams (32),
+#            slots offset (32), unseen cost (32)
+#   slots:   n_slots 64-bit entries, a power of two
+#
+# An entry is (hash >> 8) << 8 | cost, 0 is an empty slot.  hash is the
+# 64-bit FNV-1a of prev, a 0xff byte and next, and the entry is stored at
+# the first free slot from hash % n_slots.  cost is -log2 P(next | prev)
+# in 1/8 bits, at most 254.
+
+import math
+import struct
+import sys
+
+MAGIC = b"PYBG"
+VERSION = 1
+HEADER_FORMAT = "<4s5I"
+MAX_COST = 254
+COST_SCALE = 8.0
+MAX_LOAD = 0.7
+
+FNV_OFFSET = 0xcbf29ce484222325
+FNV_PRIME = 0x100000001b3
+MASK64 = 0xffffffffffffffff
+
+
+def fnv1a(data, h=FNV_OFFSET):
+    for c in bytearray(data):
+        h = ((h ^ c) * FNV_PRIME) & MASK64
+    return h
+
+
+def bigram_hash(prev, next):
+    return fnv1a(next, fnv1a(b"\xff", fnv1a(prev)))
+
+
+def count(filename):
+    unigrams = {}
+    bigrams = {}
+    for line in open(filename, "rb"):
+        words = line.split()
+        for i in range(len(words)):
+            unigrams[words[i]] = unigrams.get(words[i], 0) + 1
+            if i > 0:
+                key = (words[i - 1], words[i])
+                bigrams[key] = bigrams.get(key, 0) + 1
+    return unigrams, bigrams
+
+
+def cost(p):
+    return min(MAX_COST, int(round(-math.log(p, 2) * COST_SCALE)))
+
+
+def build(unigrams, bigrams, min_count):
+    entries = []
+    for (prev, next), n in bigrams.items():
+        if n < min_count:
+            continue
+        entry = bigram_hash(prev, next) >> 8 << 8
+        if entry == 0:
+            entry = 1 << 8
+        entries.append(entry | cost(float(n) / unigrams[prev]))
+
+    n_slots = 1
+    while n_slots * MAX_LOAD < len(entries) + 1:
+        n_slots *= 2
+
+    slots = [0] * n_slots
+    for entry in entries:
+        i = (entry >> 8) & (n_slots - 1)
+        while slots[i] != 0:
+            if slots[i] >> 8 == entry >> 8:
+                # two pairs with one hash, keep the likely one
+                entry = min(entry, slots[i])
+                break
+            i = (i + 1) & (n_slots - 1)
+        slots[i] = entry
+
+    # the cost of a pair which was never seen, as if it was seen once
+    # after the most frequent phrase
+    unseen = cost(1.0 / max(unigrams.values())) if unigrams else MAX_COST
+
+    slots_offset = struct.calcsize(HEADER_FORMAT)
+    header = struct.pack(HEADER_FORMAT, MAGIC, VERSION, n_slots,
+                         len(entries), slots_offset, unseen)
+    return header + struct.pack("<%dQ" % n_slots, *slots)
+
+
+def main():
+    args = sys.argv[1:]
+    min_count = 1
+    if len(args) == 4 and args[0] == "-c":
+        min_count = int(args[1])
+        args = args[2:]
+    if len(args) != 2:
+        sys.stderr.write("usage: %s [-c min_count] corpus.txt main.bigram\n" % sys.argv[0])
+        sys.exit(1)
+    unigrams, bigrams = count(args[0])
+    data = build(unigrams, bigrams, min_count)
+    f = open(args[1], "wb")
+    f.write(data)
+    f.close()
+
+
+if __name__ == "__main__":
+    main()
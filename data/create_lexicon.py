@@ -0,0 +1,180 @@
+#!/usr/bin/env python
+# vim:set et ts=4 sts=4:
+#
+# ibus-pinyin - The Chinese PinYin engine for IBus
+#
+# Compile the py_phrase_N tables of a main database into the read-only
+# lexicon file loaded by src/PYLexicon.cc.
+#
+# usage: create_lexicon.py [-t PYSimpTradConverterTable.h] main.db main.lexicon
+#
+# With -t, the traditional form of each phrase is converted with the table
+# of src/PYSimpTradConverter.cc, by the same longest match, so the engine
+# does not convert dictionary phrases.
+#
+# File layout (all integers are 32-bit little endian):
+#   header:  "PYLX", version, n_nodes, n_records, nodes offset,
+#            records offset, strings offset, strings size
+#   nodes:   sheng (8), yun (8), n_children (16), first child,
+#            first record, n_records
+#   records: text offset, traditional text offset, freq
+#   strings: NUL terminated utf-8 phrases
+#
+# Node 0 is the root.  Children of a node are contiguous and sorted by
+# (sheng, yun), records of a node are sorted by freq in descending order.
+# A phrase which is the same in traditional chinese has its text offset as
+# the traditional one.
+
+import re
+import sqlite3
+import struct
+import sys
+
+MAGIC = b"PYLX"
+VERSION = 2
+MAX_PHRASE_LEN = 16
+
+HEADER_FORMAT = "<4s7I"
+NODE_FORMAT = "<BBHIII"
+RECORD_FORMAT = "<III"
+
+
+class Node(object):
+    __slots__ = ("sheng", "yun", "children", "records", "index")
+
+    def __init__(self, sheng=0, yun=0):
+        self.sheng = sheng
+        self.yun = yun
+        self.children = {}
+        self.records = []
+        self.index = 0
+
+
+def load(filename):
+    root = Node()
+    con = sqlite3.connect(filename)
+    con.text_factory = bytes
+    for i in range(MAX_PHRASE_LEN):
+        try:
+            rows = con.execute("SELECT * FROM py_phrase_%d" % i)
+        except sqlite3.OperationalError:
+            continue
+        for row in rows:
+            phrase, freq = row[0], int(row[1])
+            node = root
+            for j in range(i + 1):
+                key = (int(row[2 + j * 2]), int(row[3 + j * 2]))
+                child = node.children.get(key)
+                if child is None:
+                    child = node.children[key] = Node(*key)
+                node = child
+            node.records.append((freq, phrase))
+    con.close()
+    return root
+
+
+class Strings(object):
+    # NUL terminated strings, each stored once
+
+    def __init__(self):
+        self.strings = [b"\0"]
+        self.offsets = {}
+        self.size = 1
+
+    def add(self, text):
+        offset = self.offsets.get(text)
+        if offset is None:
+            offset = self.offsets[text] = self.size
+            self.strings.append(text + b"\0")
+            self.size += len(text) + 1
+        return offset
+
+
+def load_simp_trad(filename):
+    # the lines of simp_to_trad_strings are "trad\0"  /* simp */
+    table = {}
+    pattern = re.compile(r'^    "(.*)\\0"  /\* (.*) \*/$')
+    for line in open(filename, "rb"):
+        m = pattern.match(line.decode("utf8").rstrip("\n"))
+        if m:
+            table[m.group(2)] = m.group(1)
+    return table
+
+
+def simp_to_trad(table, max_len, phrase):
+    text = phrase.decode("utf8")
+    out = []
+    i = 0
+    while i < len(text):
+        for n in range(min(max_len, len(text) - i), 0, -1):
+            trad = table.get(text[i:i + n])
+            if trad is not None:
+                break
+        else:
+            n = 1
+            trad = text[i]
+        out.append(trad)
+        i += n
+    return "".join(out).encode("utf8")
+
+
+def build(root, table):
+    # Breadth first, so all children of a node get consecutive indexes.
+    nodes = [root]
+    i = 0
+    while i < len(nodes):
+        node = nodes[i]
+        for key in sorted(node.children):
+            child = node.children[key]
+            child.index = len(nodes)
+            nodes.append(child)
+        i += 1
+
+    strings = Strings()
+    max_len = max([len(k) for k in table] or [0])
+    records = []
+    packed_nodes = []
+    for node in nodes:
+        first_record = len(records)
+        # stable sort keeps the database order for equal freq
+        for freq, phrase in sorted(node.records, key=lambda r: -r[0]):
+            offset = strings.add(phrase)
+            trad = simp_to_trad(table, max_len, phrase)
+            trad_offset = strings.add(trad) if trad != phrase else offset
+            records.append(struct.pack(RECORD_FORMAT, offset, trad_offset, freq))
+        if node.children:
+            first_child = min(c.index for c in node.children.values())
+        else:
+            first_child = 0
+        packed_nodes.append(struct.pack(NODE_FORMAT,
+                                        node.sheng, node.yun,
+                                        len(node.children), first_child,
+                                        first_record, len(node.records)))
+
+    nodes_offset = struct.calcsize(HEADER_FORMAT)
+    records_offset = nodes_offset + len(packed_nodes) * struct.calcsize(NODE_FORMAT)
+    strings_offset = records_offset + len(records) * struct.calcsize(RECORD_FORMAT)
+    header = struct.pack(HEADER_FORMAT, MAGIC, VERSION,
+                         len(packed_nodes), len(records),
+                         nodes_offset, records_offset,
+                         strings_offset, strings.size)
+    return b"".join([header] + packed_nodes + records + strings.strings)
+
+
+def main():
+    args = sys.argv[1:]
+    table = {}
+    if len(args) == 4 and args[0] == "-t":
+        table = load_simp_trad(args[1])
+        args = args[2:]
+    if len(args) != 2:
+        sys.stderr.write("usage: %s [-t PYSimpTradConverterTable.h] main.db main.lexicon\n" % sys.argv[0])
+        sys.exit(1)
+    data = build(load(args[0]), table)
+    f = open(args[1], "wb")
+    f.write(data)
+    f.close()
+
+
+if __name__ == "__main__":
+    main()
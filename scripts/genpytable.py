@@ -325,13 +325,83 @@ def gen_table():
 
     return pinyins
 
-def gen_bopomofo_table(pinyins):
-    bopomofo_table = [ (i, p) for i, p in enumerate(pinyins)]
-    bopomofo_table.sort(lambda a, b: cmp(a[1][1], b[1][1]))
-    print 'static const Pinyin *bopomofo_table[] = {'
-    for i, p in bopomofo_table:
+def gen_pinyin_trie(pinyins):
+    # A trie of the texts in pinyin_table, as a DFA the parser runs left to
+    # right. Nodes are in breadth first order, so the children of a node
+    # are contiguous and sorted, the child of char c is at first_child +
+    # number of children before c in the children mask.
+    index = {}
+    for i, p in enumerate(pinyins):
+        index[p[0]] = i
+
+    prefixes = set([""])
+    for text in index:
+        for i in range(1, len(text) + 1):
+            prefixes.add(text[:i])
+
+    nodes = [""]
+    node_ids = {"": 0}
+    i = 0
+    while i < len(nodes):
+        prefix = nodes[i]
+        for c in "abcdefghijklmnopqrstuvwxyz":
+            if prefix + c in prefixes:
+                node_ids[prefix + c] = len(nodes)
+                nodes.append(prefix + c)
+        i += 1
+
+    print 'static const PinyinTrieNode pinyin_trie[] = {'
+    for i, prefix in enumerate(nodes):
+        mask = 0
+        first_child = 0
+        for j, c in enumerate("abcdefghijklmnopqrstuvwxyz"):
+            if prefix + c in node_ids:
+                if mask == 0:
+                    first_child = node_ids[prefix + c]
+                mask |= 1 << j
+        print '    { 0x%07x, %4d, %4d },  /* %d "%s" */' % \
+            (mask, first_child, index.get(prefix, -1), i, prefix)
+    print '};'
+    print
+
+def gen_bopomofo_trie(pinyins):
+    # A trie of the bopomofo of pinyin_table for PinyinParser::parseBopomofo,
+    # laid out as pinyin_trie. Child i is of U+3105 + i, a tone after a
+    # syllable is taken by the parser.
+    symbols = [unichr(0x3105 + i) for i in range(37)]
+
+    index = {}
+    for i, p in enumerate(pinyins):
         if p[1]:
-            print '    %-20s %s' % ('&pinyin_table[%d],' % i, '// "%s" => "%s"' % (p[1], p[0]))
+            index[p[1].decode("utf8")] = i
+
+    prefixes = set([u""])
+    for bopomofo in index:
+        for i in range(1, len(bopomofo) + 1):
+            prefixes.add(bopomofo[:i])
+
+    nodes = [u""]
+    node_ids = {u"": 0}
+    i = 0
+    while i < len(nodes):
+        prefix = nodes[i]
+        for c in symbols:
+            if prefix + c in prefixes:
+                node_ids[prefix + c] = len(nodes)
+                nodes.append(prefix + c)
+        i += 1
+
+    print 'static const BopomofoTrieNode bopomofo_trie[] = {'
+    for i, prefix in enumerate(nodes):
+        mask = 0
+        first_child = 0
+        for j, c in enumerate(symbols):
+            if prefix + c in node_ids:
+                if mask == 0:
+                    first_child = node_ids[prefix + c]
+                mask |= 1 << j
+        print '    { G_GUINT64_CONSTANT (0x%010x), %4d, %4d },  /* %d "%s" */' % \
+            (mask, first_child, index.get(prefix, -1), i, prefix.encode("utf8"))
     print '};'
     print
 
@@ -414,9 +484,11 @@ def gen_special_table(pinyins):
 
     l = list(compaired_special(_dict.keys()))
     l.sort()
-    print 'static const Pinyin *special_table[][4] = {'
+    # indexes in pinyin_table, not pointers, so the table needs no
+    # relocation
+    print 'static const guint16 special_table[][4] = {'
     for r in l:
-        ids =  [("&pinyin_table[%d]," % _dict[py]).ljust(20) for py in r]
+        ids =  [("%d," % _dict[py]).ljust(5) for py in r]
 
         print '    { %s %s %s %s },' % tuple(ids), "/* %s %s => %s %s */" % r
     print '};'
@@ -427,8 +499,9 @@ def main():
     # gen_header()
     # gen_macros()
     pinyins = gen_table()
+    gen_pinyin_trie(pinyins)
     # gen_full_pinyin_table (pinyins)
-    gen_bopomofo_table(pinyins)
+    gen_bopomofo_trie(pinyins)
     gen_special_table(pinyins)
     # gen_option_check("pinyin_option_check_sheng", fuzzy_shengmu)
     # gen_option_check("pinyin_option_check_yun", fuzzy_yunmu)
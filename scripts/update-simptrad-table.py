@@ -57,13 +57,73 @@ def get_records():
     records.sort()
     return maxlen, records
 
-def main():
-    print "static const gchar *simp_to_trad[][2] = {"
-    maxlen, records = get_records()
+def build_trie(records):
+    # A double-array trie of the simplified texts in utf8. The child of
+    # state s by byte c is t = base[s] + c + 1 if check[t] is s, and
+    # t = base[s] is the end of a text if check[t] is s, with base[t] =
+    # -1 - offset of the traditional text. Cell 0 is unused, 1 is the root.
+    root = {}
+    offset = 0
     for s, ts in records:
-        print '    { "%s", "%s" },' % (s, ts)
+        node = root
+        for c in s:
+            node = node.setdefault(ord(c) + 1, {})
+        node[0] = offset
+        offset += len(ts) + 1
+
+    base = [0, 0]
+    check = [0, 0]
+    used = [True, True]
+    first_free = 2
+    queue = [(root, 1)]
+    while queue:
+        node, state = queue.pop(0)
+        codes = sorted(node.keys())
+        # the first base from which all the children are free cells
+        pos = max(first_free, codes[0] + 1)
+        while True:
+            b = pos - codes[0]
+            if all(b + c >= len(used) or not used[b + c] for c in codes):
+                break
+            pos += 1
+            while pos < len(used) and used[pos]:
+                pos += 1
+        size = b + codes[-1] + 1
+        if size > len(used):
+            base.extend([0] * (size - len(used)))
+            check.extend([0] * (size - len(used)))
+            used.extend([False] * (size - len(used)))
+        base[state] = b
+        for c in codes:
+            used[b + c] = True
+            check[b + c] = state
+            if c == 0:
+                base[b] = -1 - node[0]
+            else:
+                queue.append((node[c], b + c))
+        while first_free < len(used) and used[first_free]:
+            first_free += 1
+    return base, check
+
+def gen_table(records):
+    # All tables are arrays of integers and chars, so none of them needs
+    # relocation. data/create_lexicon.py reads the lines of
+    # simp_to_trad_strings to convert the lexicons, keep their format.
+    print "static const gchar simp_to_trad_strings[] ="
+    for s, ts in records:
+        print '    "%s\\0"  /* %s */' % (ts, s)
+    print "    ;"
+    print
+    base, check = build_trie(records)
+    print "static const SimpTradTrieNode simp_to_trad_trie[] = {"
+    for i in range(0, len(base), 4):
+        print "   " + "".join([" { %d, %d }," % (base[j], check[j]) \
+                            for j in range(i, min(i + 4, len(base)))])
     print "};"
-    print '#define SIMP_TO_TRAD_MAX_LEN (%d)' % maxlen
+
+def main():
+    maxlen, records = get_records()
+    gen_table(records)
 
 if __name__ == "__main__":
     main()
@@ -0,0 +1,138 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+#include "PYBigram.h"
+#include <cstring>
+
+namespace PY {
+
+#define BIGRAM_MAGIC        "PYBG"
+#define BIGRAM_VERSION      (1)
+
+/* The layout must match data/create_bigram.py */
+struct BigramHeader {
+    gchar magic[4];
+    guint32 version;
+    guint32 n_slots;
+    guint32 n_bigrams;
+    guint32 slots;
+    guint32 unseen;
+};
+
+Bigram::Bigram (void)
+    : m_file (NULL),
+      m_slots (NULL),
+      m_mask (0),
+      m_unseen (0)
+{
+}
+
+Bigram::~Bigram (void)
+{
+    unload ();
+}
+
+gboolean
+Bigram::load (const gchar *filename)
+{
+    unload ();
+
+    GError *error = NULL;
+    GMappedFile *file = g_mapped_file_new (filename, FALSE, &error);
+    if (file == NULL) {
+        g_error_free (error);
+        return FALSE;
+    }
+
+    const gchar *data = g_mapped_file_get_contents (file);
+    gsize size = g_mapped_file_get_length (file);
+    const BigramHeader *header = (const BigramHeader *) data;
+
+    /* the slots are probed until an empty one, so there must be one */
+    if (size < sizeof (BigramHeader) ||
+        std::memcmp (header->magic, BIGRAM_MAGIC, 4) != 0 ||
+        header->version != BIGRAM_VERSION ||
+        header->n_slots == 0 ||
+        (header->n_slots & (header->n_slots - 1)) != 0 ||
+        header->n_bigrams >= header->n_slots ||
+        header->slots % 8 != 0 ||
+        header->slots + (gsize) header->n_slots * sizeof (guint64) > size) {
+        g_warning ("invalid bigram file %s", filename);
+        g_mapped_file_unref (file);
+        return FALSE;
+    }
+
+    m_file = file;
+    m_slots = (const guint64 *) (data + header->slots);
+    m_mask = header->n_slots - 1;
+    m_unseen = header->unseen;
+
+    return TRUE;
+}
+
+void
+Bigram::unload (void)
+{
+    if (m_file == NULL)
+        return;
+    g_mapped_file_unref (m_file);
+    m_file = NULL;
+    m_slots = NULL;
+    m_mask = 0;
+    m_unseen = 0;
+}
+
+static inline guint64
+fnv1a (const gchar *str, guint64 hash)
+{
+    for (const guchar *p = (const guchar *) str; *p != 0; p++) {
+        hash ^= *p;
+        hash *= G_GUINT64_CONSTANT (0x100000001b3);
+    }
+    return hash;
+}
+
+guint64
+Bigram::hash (const gchar *prev, const gchar *next)
+{
+    /* 0xff never shows up in utf-8, so it separates the phrases */
+    guint64 value = fnv1a (prev, G_GUINT64_CONSTANT (0xcbf29ce484222325));
+    value = (value ^ 0xff) * G_GUINT64_CONSTANT (0x100000001b3);
+    return fnv1a (next, value);
+}
+
+guint
+Bigram::cost (const gchar *prev, const gchar *next) const
+{
+    if (G_UNLIKELY (m_file == NULL))
+        return 0;
+
+    guint64 key = hash (prev, next) >> 8;
+    if (key == 0)
+        key = 1;
+
+    for (guint64 i = key & m_mask; m_slots[i] != 0; i = (i + 1) & m_mask) {
+        if ((m_slots[i] >> 8) == key)
+            return m_slots[i] & 0xff;
+    }
+    return m_unseen;
+}
+
+};
@@ -0,0 +1,55 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+#ifndef __PY_BIGRAM_H_
+#define __PY_BIGRAM_H_
+
+#include <glib.h>
+
+namespace PY {
+
+/* Read-only phrase bigram model compiled from a segmented corpus by
+ * data/create_bigram.py, and mapped into memory */
+class Bigram {
+public:
+    Bigram (void);
+    ~Bigram (void);
+
+    gboolean load (const gchar *filename);
+    void unload (void);
+    gboolean loaded (void) const { return m_file != NULL; }
+
+    /* returns -log2 P(next | prev) in 1/8 bits, or the cost of an unseen
+     * pair. Pairs sharing a hash may get the cost of each other. */
+    guint cost (const gchar *prev, const gchar *next) const;
+
+    /* 64-bit FNV-1a of prev, a 0xff byte and next */
+    static guint64 hash (const gchar *prev, const gchar *next);
+
+private:
+    GMappedFile *m_file;
+    const guint64 *m_slots;
+    guint64 m_mask;             /* number of slots - 1 */
+    guint m_unseen;
+};
+
+};
+
+#endif
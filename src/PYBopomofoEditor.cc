@@ -327,6 +327,36 @@ BopomofoEditor::processBopomofo (guint keyval, guint keycode, guint modifiers)
     return insert (keyval);
 }
 
+/* keys selecting, paging or committing candidates, which must then be
+ * the ones of the bopomofo typed before them */
+gboolean
+BopomofoEditor::keyReadsCandidates (guint keyval, guint modifiers)
+{
+    switch (keyval) {
+    case IBUS_space:
+    case IBUS_Return:
+    case IBUS_KP_Enter:
+    case IBUS_Up:
+    case IBUS_KP_Up:
+    case IBUS_Down:
+    case IBUS_KP_Down:
+    case IBUS_Page_Up:
+    case IBUS_KP_Page_Up:
+    case IBUS_Page_Down:
+    case IBUS_KP_Page_Down:
+    case IBUS_Tab:
+    case IBUS_KP_0 ... IBUS_KP_9:
+    case IBUS_F1 ... IBUS_F10:
+        return TRUE;
+    default:
+        /* as processSelectKey */
+        if (!m_select_mode && (modifiers & IBUS_MOD1_MASK) == 0)
+            return FALSE;
+        return keyval <= IBUS_asciitilde &&
+               strchr (bopomofo_select_keys[m_config.selectKeys ()], keyval) != NULL;
+    }
+}
+
 gboolean
 BopomofoEditor::processKeyEvent (guint keyval, guint keycode, guint modifiers)
 {
@@ -338,7 +368,6 @@ BopomofoEditor::processKeyEvent (guint keyval, guint keycode, guint modifiers)
                   IBUS_META_MASK |
                   IBUS_LOCK_MASK);
 
-
     if (G_UNLIKELY (processGuideKey (keyval, keycode, modifiers)))
         return TRUE;
     if (G_UNLIKELY (processSelectKey (keyval, keycode, modifiers) == TRUE))
@@ -413,10 +442,12 @@ void
 BopomofoEditor::updateAuxiliaryText (void)
 {
     if (G_UNLIKELY (m_text.empty () ||
-        m_lookup_table.size () == 0)) {
+        (m_lookup_table.size () == 0 && !candidatesPending ()))) {
         hideAuxiliaryText ();
         return;
     }
+    if (G_UNLIKELY (panelKept ()))
+        return;
 
     m_buffer.clear ();
 
@@ -495,6 +526,8 @@ BopomofoEditor::updatePreeditText (void)
         hidePreeditText ();
         return;
     }
+    if (G_UNLIKELY (panelKept ()))
+        return;
 
     guint edit_begin = 0;
     guint edit_end = 0;
@@ -514,7 +547,15 @@ BopomofoEditor::updatePreeditText (void)
     }
     else {
         edit_begin = m_buffer.utf8Length ();
-        if (m_lookup_table.size () > 0) {
+        if (G_UNLIKELY (candidatesPending ())) {
+            /* candidates are not back yet, the text is shown as typed */
+            const gchar *text = textAfterPinyin (m_phrase_editor.cursor ());
+            for (const gchar *p = text; *p; ++p) {
+                m_buffer.appendUnichar (bopomofo_char[keyvalToBopomofo (*p)]);
+            }
+            edit_begin += m_cursor - (text - m_text.c_str ());
+        }
+        else if (m_lookup_table.size () > 0) {
             guint cursor = m_lookup_table.cursorPos ();
 
             if (cursor < m_special_phrases.size ()) {
@@ -44,6 +44,7 @@ protected:
     gboolean processAuxiliarySelectKey (guint keyval, guint keycode, guint modifiers);
     gboolean processSelectKey (guint keyval, guint keycode, guint modifiers);
     gboolean processBopomofo (guint keyval, guint keycode, guint modifiers);
+    gboolean keyReadsCandidates (guint keyval, guint modifiers);
     gboolean processKeyEvent (guint keyval, guint keycode, guint modifiers);
 
     void updateAuxiliaryText ();
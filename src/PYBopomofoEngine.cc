@@ -254,6 +254,9 @@ BopomofoEngine::connectEditorSignals (EditorPtr editor)
         std::bind (&BopomofoEngine::showLookupTable, this));
     editor->signalHideLookupTable ().connect (
         std::bind (&BopomofoEngine::hideLookupTable, this));
+
+    editor->signalCandidatesReady ().connect (
+        std::bind (&BopomofoEngine::processDeferred, this));
 }
 
 };
@@ -52,6 +52,7 @@ private:
 private:
     void showSetupDialog (void);
     void connectEditorSignals (EditorPtr editor);
+    Editor & editor (void) { return *m_editors[m_input_mode]; }
 
 private:
     void commitText (Text & text);
@@ -22,59 +22,52 @@
 #include <glib.h>
 #include <glib/gstdio.h>
 #include <sqlite3.h>
+#include <algorithm>
+#include <cstring>
+#include <set>
 #include "PYUtil.h"
 #include "PYPinyinArray.h"
 
 namespace PY {
 
 #define DB_CACHE_SIZE       "5000"
-#define DB_INDEX_SIZE       (3)
 /* define columns */
 #define DB_COLUMN_USER_FREQ (0)
 #define DB_COLUMN_PHRASE    (1)
 #define DB_COLUMN_FREQ      (2)
 #define DB_COLUMN_S0        (3)
 
-#define DB_PREFETCH_LEN     (6)
-#define DB_BACKUP_TIMEOUT   (60)
-
-std::unique_ptr<Database> Database::m_instance;
+/* define sql parameters, up to 3 shengs and 2 yuns for each syllable */
+#define DB_PARAM_SHENG(i,j) ((i) * 5 + (j) + 1)
+#define DB_PARAM_YUN(i,j)   ((i) * 5 + (j) + 4)
+#define DB_PARAM_LIMIT      (MAX_PHRASE_LEN * 5 + 1)
 
-class Conditions : public std::vector<std::string> {
-public:
-    Conditions (void) : std::vector<std::string> (1) {}
-
-    void double_ (void) {
-        gint i = size ();
-        do {
-            push_back (at (--i));
-        } while (i > 0);
-    }
+/* number of phrases cached for each query, and the cache size */
+#define DB_CACHE_PREFIX_LEN (64)
+#define DB_CACHE_PHRASES    (8192)
 
-    void triple (void) {
-        gint i = size ();
-        do {
-            const std::string & value = std::vector<std::string>::at (--i);
-            push_back (value);
-            push_back (value);
-        } while (i > 0);
-    }
+#define DB_PREFETCH_LEN     (6)
 
-    void appendVPrintf (gint begin, gint end, const gchar *fmt, va_list args) {
-        gchar str[64];
-        g_vsnprintf (str, sizeof(str), fmt, args);
-        for (gint i = begin; i < end; i++) {
-            at (i) += str;
-        }
-    }
+/* phrases of other segmentations given for each length of a query */
+#define DB_ALTERNATIVES     (8)
+
+/* user database is saved as a snapshot and a log of the changes after it,
+ * the snapshot is taken again when the log has too many changes */
+#define DB_USER_FILE        "user-1.3.db"
+#define DB_LOG_FILE         "user-1.3.log"
+#define DB_LOG_MAX_CHANGES  (4096)
+#define DB_BACKUP_PAGES     (64)
+/* bump it when the schema of user database is changed */
+#define DB_USER_VERSION     (2)
+/* phrase pairs kept in memory and in user database */
+#define DB_USER_BIGRAMS     (8192)
+
+/* kinds of cached statements */
+#define DB_STMT_UNION       (0)     /* main and user phrases */
+#define DB_STMT_USER        (1)     /* user phrases */
+#define DB_STMT_MAIN        (2)     /* main phrases, while userdb is loading */
 
-    void appendPrintf (gint begin, gint end, const gchar *fmt, ...) {
-        va_list args;
-        va_start (args, fmt);
-        appendVPrintf (begin, end, fmt, args);
-        va_end (args);
-    }
-};
+std::unique_ptr<Database> Database::m_instance;
 
 class SQLStmt {
 public:
@@ -92,7 +85,7 @@ public:
     }
 
     gboolean prepare (const String &sql) {
-        if (sqlite3_prepare (m_db,
+        if (sqlite3_prepare_v2 (m_db,
                              sql.c_str (),
                              sql.size (),
                              &m_stmt,
@@ -124,6 +117,15 @@ public:
         return sqlite3_column_int (m_stmt, col);
     }
 
+    void bindInt (gint index, gint value) {
+        sqlite3_bind_int (m_stmt, index, value);
+    }
+
+    void reset (void) {
+        sqlite3_reset (m_stmt);
+        sqlite3_clear_bindings (m_stmt);
+    }
+
 private:
     sqlite3 *m_db;
     sqlite3_stmt *m_stmt;
@@ -132,74 +134,309 @@ private:
 Query::Query (const PinyinArray    & pinyin,
               guint                  pinyin_begin,
               guint                  pinyin_len,
-              guint                  option)
+              guint                  option,
+              const PinyinLattice  * lattice)
     : m_pinyin (pinyin),
       m_pinyin_begin (pinyin_begin),
       m_pinyin_len (pinyin_len),
-      m_option (option)
+      m_option (option),
+      m_pos (0),
+      m_limit (0),
+      m_alternative_pos (0),
+      m_spans (NULL)
 {
     g_assert (m_pinyin.size () >= pinyin_begin + pinyin_len);
+    if (lattice != NULL)
+        m_lattice = *lattice;
 }
 
 Query::~Query (void)
 {
 }
 
+inline static void
+phrase_from_stmt (SQLStmt &stmt, guint len, Phrase &phrase)
+{
+    g_strlcpy (phrase.phrase,
+               stmt.columnText (DB_COLUMN_PHRASE),
+               sizeof (phrase.phrase));
+    phrase.freq = stmt.columnInt (DB_COLUMN_FREQ);
+    phrase.user_freq = stmt.columnInt (DB_COLUMN_USER_FREQ);
+    phrase.len = len;
+    phrase.trad = NULL;
+
+    for (guint i = 0, column = DB_COLUMN_S0; i < len; i++) {
+        phrase.pinyin_id[i].sheng = stmt.columnInt (column++);
+        phrase.pinyin_id[i].yun = stmt.columnInt (column++);
+    }
+}
+
+inline void
+Query::give (PhraseArray &phrases, const Phrase &phrase, gint &row)
+{
+    phrases.push_back (phrase);
+    if (m_spans != NULL)
+        m_spans->push_back (m_pinyin_len);
+    row ++;
+}
+
+/* Gives the alternatives ranked before phrase, and then phrase, or all
+ * alternatives left if phrase is NULL. It returns FALSE if count is
+ * reached before that. */
+inline gboolean
+Query::take (PhraseArray &phrases, const Phrase *phrase, gint &row, gint count)
+{
+    if (G_LIKELY (m_alternatives.empty () || m_alternatives[m_pinyin_len - 1].empty ())) {
+        if (phrase != NULL) {
+            if (G_UNLIKELY (row == count))
+                return FALSE;
+            give (phrases, *phrase, row);
+            m_pos ++;
+        }
+        return TRUE;
+    }
+
+    /* the first phrase of the length stays the first, the phrases of
+     * user are not passed, as they are not in the alternatives */
+    const PhraseArray & alternatives = m_alternatives[m_pinyin_len - 1];
+    while (m_alternative_pos < alternatives.size () &&
+           (phrase == NULL ||
+            (m_pos > 0 && phrase->user_freq == 0 &&
+             alternatives[m_alternative_pos].freq > phrase->freq))) {
+        if (row == count)
+            return FALSE;
+        const Phrase & alternative = alternatives[m_alternative_pos++];
+        if (m_taken.insert (alternative.phrase).second)
+            give (phrases, alternative, row);
+    }
+
+    if (phrase == NULL)
+        return TRUE;
+    if (row == count)
+        return FALSE;
+    m_pos ++;
+    if (m_taken.insert (phrase->phrase).second)
+        give (phrases, *phrase, row);
+    return TRUE;
+}
+
 gint
-Query::fill (PhraseArray &phrases, gint count)
+Query::fill (PhraseArray &phrases, gint count, std::vector<guint> *spans)
 {
     gint row = 0;
+    Database & database = Database::instance ();
 
-    while (m_pinyin_len > 0) {
-        if (G_LIKELY (m_stmt.get () == NULL)) {
-            m_stmt = Database::instance ().query (m_pinyin, m_pinyin_begin, m_pinyin_len, -1, m_option);
-            g_assert (m_stmt.get () != NULL);
-        }
+    m_spans = spans;
 
-        while (m_stmt->step ()) {
-            Phrase phrase;
+    if (G_UNLIKELY (!m_lattice.empty () && m_pinyin_len > 0)) {
+        database.queryAlternatives (m_lattice, m_pinyin, m_pinyin_begin, m_pinyin_len,
+                                    m_option, DB_ALTERNATIVES, m_alternatives);
+        m_lattice.clear ();
+    }
 
-            g_strlcpy (phrase.phrase,
-                       m_stmt->columnText (DB_COLUMN_PHRASE),
-                       sizeof (phrase.phrase));
-            phrase.freq = m_stmt->columnInt (DB_COLUMN_FREQ);
-            phrase.user_freq = m_stmt->columnInt (DB_COLUMN_USER_FREQ);
-            phrase.len = m_pinyin_len;
+    while (m_pinyin_len > 0) {
+        if (G_UNLIKELY (row == count))
+            return row;
+
+        if (G_LIKELY (m_phrases.empty ())) {
+            /* most requests are served from the cached prefix */
+            PhraseArray cached;
+            gboolean complete;
+            gint asked = count < 0 ? G_MAXINT : count - row;
+            gint n = database.query (m_pinyin, m_pinyin_begin, m_pinyin_len, m_option,
+                                     m_pos, asked, cached, complete);
+            for (gint i = 0; i < n; i++) {
+                if (!take (phrases, &cached[i], row, count))
+                    return row;
+            }
+            if (G_UNLIKELY (row == count)) {
+                return row;
+            }
+            /* some of them were given as alternatives already */
+            if (G_UNLIKELY (n == asked))
+                continue;
 
-            for (guint i = 0, column = DB_COLUMN_S0; i < m_pinyin_len; i++) {
-                phrase.pinyin_id[i].sheng = m_stmt->columnInt (column++);
-                phrase.pinyin_id[i].yun = m_stmt->columnInt (column++);
+            if (G_UNLIKELY (!complete)) {
+                /* the rest is fetched in pages of growing size */
+                m_limit = MAX (m_pos, DB_CACHE_PREFIX_LEN) * 2;
+                database.queryTop (m_pinyin, m_pinyin_begin, m_pinyin_len, m_option,
+                                   m_limit, m_phrases);
             }
+        }
 
-            phrases.push_back (phrase);
-            row ++;
+        while (m_pos < m_phrases.size ()) {
+            if (!take (phrases, &m_phrases[m_pos], row, count))
+                return row;
             if (G_UNLIKELY (row == count)) {
                 return row;
             }
         }
 
-        m_stmt.reset ();
+        if (G_UNLIKELY (m_limit > 0 && m_phrases.size () == m_limit)) {
+            m_limit *= 2;
+            m_phrases.clear ();
+            database.queryTop (m_pinyin, m_pinyin_begin, m_pinyin_len, m_option,
+                               m_limit, m_phrases);
+            continue;
+        }
+
+        if (!take (phrases, NULL, row, count))
+            return row;
+
+        m_phrases.clear ();
+        m_pos = 0;
+        m_limit = 0;
+        m_alternative_pos = 0;
+        m_taken.clear ();
         m_pinyin_len --;
     }
 
     return row;
 }
 
+/* learns the phrases in the query thread, so they are seen by the
+ * requests posted after them */
+class Database::LearnRequest : public Database::Request {
+public:
+    LearnRequest (Database & database, const PhraseArray & phrases,
+                  const String & context, gboolean remove)
+        : m_database (database),
+          m_phrases (phrases),
+          m_context (context),
+          m_remove (remove) { }
+
+    virtual void run (void)
+    {
+        if (m_remove)
+            m_database.learn (m_phrases[0], TRUE);
+        else
+            m_database.learnPhrases (m_phrases, m_context);
+    }
+
+    virtual void done (void) { }
+
+private:
+    Database & m_database;
+    PhraseArray m_phrases;
+    String m_context;
+    gboolean m_remove;
+};
+
+/* Installs the snapshot of userdb saved by the writer into m_db in the
+ * query thread. It copies a few pages at a time, and posts itself again
+ * in between, so the requests queued meanwhile are not kept waiting. The
+ * writer does not save the snapshot again before it is installed */
+class Database::InstallRequest : public Database::Request {
+public:
+    InstallRequest (Database & database, const String & path)
+        : m_database (database),
+          m_path (path),
+          m_userdb (NULL),
+          m_backup (NULL) { }
+
+    virtual ~InstallRequest (void)
+    {
+        if (m_backup != NULL)
+            sqlite3_backup_finish (m_backup);
+        if (m_userdb != NULL)
+            sqlite3_close (m_userdb);
+    }
+
+    virtual void run (void)
+    {
+        if (m_userdb == NULL) {
+            if (sqlite3_open_v2 (m_path, &m_userdb, SQLITE_OPEN_READONLY, NULL) == SQLITE_OK)
+                m_backup = sqlite3_backup_init (m_database.m_db, "userdb", m_userdb, "main");
+            if (m_backup == NULL) {
+                g_warning ("can not install user database");
+                return;
+            }
+        }
+
+        gint rc = sqlite3_backup_step (m_backup, DB_BACKUP_PAGES);
+        if (rc == SQLITE_OK || rc == SQLITE_BUSY || rc == SQLITE_LOCKED) {
+            /* the next one goes on with the copy */
+            InstallRequest *request = new InstallRequest (m_database, m_path);
+            request->m_userdb = m_userdb;
+            request->m_backup = m_backup;
+            m_userdb = NULL;
+            m_backup = NULL;
+            m_database.post (request);
+            return;
+        }
+        if (rc != SQLITE_DONE) {
+            g_warning ("can not install user database");
+            return;
+        }
+
+        /* readers use userdb from now on */
+        m_database.userdbInstalled ();
+    }
+
+    virtual void done (void) { }
+
+private:
+    Database & m_database;
+    String m_path;
+    sqlite3 *m_userdb;
+    sqlite3_backup *m_backup;
+};
+
 Database::Database (void)
     : m_db (NULL)
-    , m_timeout_id (0)
+    , m_cache (DB_CACHE_PHRASES)
+    , m_user_bigram (DB_USER_BIGRAMS)
+    , m_fuzzy_option (0)
+    , m_walk_len (0)
+    , m_stmt_hits (0)
+    , m_stmt_misses (0)
+    , m_requests (g_async_queue_new ())
+    , m_writer (NULL)
+    , m_changes (g_async_queue_new ())
+    , m_userdb_ready (0)
     , m_timer (g_timer_new ())
+    , m_writer_db (NULL)
+    , m_log (NULL)
+    , m_log_changes (0)
 {
-    open ();
+    updateFuzzy (m_fuzzy_option);
+    /* the database is opened in the query thread */
+    m_reader = g_thread_new ("pinyin-query", Database::queryThread, this);
 }
 
 Database::~Database (void)
 {
-    g_timer_destroy (m_timer);
-    if (m_timeout_id != 0) {
-        saveUserDB ();
-        g_source_remove (m_timeout_id);
+    /* the requests queued are run, but they are not done any more */
+    g_async_queue_push (m_requests, this);
+    g_thread_join (m_reader);
+
+    /* the writer quits after all queued changes are written */
+    if (m_writer != NULL) {
+        g_async_queue_push (m_changes, this);
+        g_thread_join (m_writer);
+    }
+    g_async_queue_unref (m_changes);
+
+    /* the rest of userdb may still be queued by the writer */
+    gpointer request;
+    while ((request = g_async_queue_try_pop (m_requests)) != NULL)
+        delete static_cast<Request *> (request);
+    g_async_queue_unref (m_requests);
+
+    g_debug ("prepared statements: %u reused, %u prepared",
+             m_stmt_hits, m_stmt_misses);
+    g_debug ("candidate cache: %u hits, %u misses",
+             m_cache.hits (), m_cache.misses ());
+
+    if (m_timer != NULL)
+        g_timer_destroy (m_timer);
+    if (m_log != NULL)
+        std::fclose (m_log);
+    for (StmtCache::iterator it = m_stmts.begin (); it != m_stmts.end (); ++it) {
+        for (guint i = 0; i < it->second.size (); i++)
+            delete it->second[i];
     }
+    m_stmts.clear ();
     if (m_db) {
         if (sqlite3_close (m_db) != SQLITE_OK) {
             g_warning ("close sqlite database failed!");
@@ -252,6 +489,20 @@ Database::open (void)
             break;
         }
 
+        /* Use the lexicon compiled from main database if it is installed */
+        m_buffer = maindb[i];
+        if (g_str_has_suffix (m_buffer, ".db"))
+            m_buffer.truncate (m_buffer.size () - 3);
+        m_buffer << ".lexicon";
+        if (m_lexicon.load (m_buffer))
+            g_message ("Use lexicon %s", m_buffer.c_str ());
+
+        /* and the bigram model for ranking sentences, if there is one */
+        m_buffer.truncate (m_buffer.size () - 8);
+        m_buffer << ".bigram";
+        if (m_bigram.load (m_buffer))
+            g_message ("Use bigram model %s", m_buffer.c_str ());
+
         m_sql.clear ();
 
         /* Set synchronous=OFF, write user database will become much faster.
@@ -275,7 +526,10 @@ Database::open (void)
         if (!executeSQL (m_sql))
             break;
 
-        loadUserDB ();
+        /* user database is loaded by the writer thread */
+        m_sql.printf ("ATTACH DATABASE \":memory:\" AS userdb;");
+        if (!executeSQL (m_sql))
+            break;
 #if 0
     /* Attach user database */
     m_buffer = g_get_user_cache_dir ();
@@ -304,160 +558,296 @@ Database::open (void)
     return FALSE;
 }
 
+static void
+user_cache_file (String & path, const gchar *name)
+{
+    path = g_get_user_cache_dir ();
+    path << G_DIR_SEPARATOR_S << "ibus"
+         << G_DIR_SEPARATOR_S << "pinyin";
+    g_mkdir_with_parents (path, 0750);
+    path << G_DIR_SEPARATOR_S << name;
+}
+
+/* runs in the writer thread. The log of the last session is written
+ * into the snapshot of userdb, which the query thread installs then. The
+ * writer keeps the snapshot attached, it has no copy in memory. */
 gboolean
 Database::loadUserDB (void)
 {
+    GTimer *timer = g_timer_new ();
+    String path;
+    String sql;
     sqlite3 *userdb = NULL;
-    do {
-        /* Attach user database */
-        m_sql.printf ("ATTACH DATABASE \":memory:\" AS userdb;");
-        if (!executeSQL (m_sql))
-            break;
+    gboolean retval = FALSE;
 
-        m_buffer = g_get_user_cache_dir ();
-        m_buffer << G_DIR_SEPARATOR_S << "ibus"
-                 << G_DIR_SEPARATOR_S << "pinyin";
-        g_mkdir_with_parents (m_buffer, 0750);
-        m_buffer << G_DIR_SEPARATOR_S << "user-1.3.db";
+    do {
+        user_cache_file (path, DB_USER_FILE);
 
         gint flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
-        if (sqlite3_open_v2 (m_buffer, &userdb, flags, NULL) != SQLITE_OK &&
-            sqlite3_open_v2 (":memory:", &userdb, flags, NULL) != SQLITE_OK)
+        if (sqlite3_open_v2 (path, &userdb, flags, NULL) != SQLITE_OK)
             break;
 
-        m_sql = "BEGIN TRANSACTION;\n";
-        /* create desc table*/
-        m_sql << "CREATE TABLE IF NOT EXISTS desc (name PRIMARY KEY, value TEXT);\n";
-        m_sql << "INSERT OR IGNORE INTO desc VALUES " << "('version', '1.2.0');\n"
-              << "INSERT OR IGNORE INTO desc VALUES " << "('uuid', '" << UUID () << "');\n"
-              << "INSERT OR IGNORE INTO desc VALUES " << "('hostname', '" << Hostname () << "');\n"
-              << "INSERT OR IGNORE INTO desc VALUES " << "('username', '" << Env ("USERNAME") << "');\n"
-              << "INSERT OR IGNORE INTO desc VALUES " << "('create-time', datetime());\n"
-              << "INSERT OR IGNORE INTO desc VALUES " << "('attach-time', datetime());\n";
-
-        /* create phrase tables */
-        for (guint i = 0; i < MAX_PHRASE_LEN; i++) {
-            m_sql.appendPrintf ("CREATE TABLE IF NOT EXISTS py_phrase_%d (user_freq, phrase TEXT, freq INTEGER ", i);
-            for (guint j = 0; j <= i; j++)
-                m_sql.appendPrintf (",s%d INTEGER, y%d INTEGER", j, j);
-            m_sql << ");\n";
-        }
-
-        /* create index */
-        m_sql << "CREATE UNIQUE INDEX IF NOT EXISTS " << "index_0_0 ON py_phrase_0(s0,y0,phrase);\n";
-        m_sql << "CREATE UNIQUE INDEX IF NOT EXISTS " << "index_1_0 ON py_phrase_1(s0,y0,s1,y1,phrase);\n";
-        m_sql << "CREATE INDEX IF NOT EXISTS " << "index_1_1 ON py_phrase_1(s0,s1,y1);\n";
-        for (guint i = 2; i < MAX_PHRASE_LEN; i++) {
-            m_sql << "CREATE UNIQUE INDEX IF NOT EXISTS " << "index_" << i << "_0 ON py_phrase_" << i
-                  << "(s0,y0";
-            for (guint j = 1; j <= i; j++)
-                m_sql << ",s" << j << ",y" << j;
-            m_sql << ",phrase);\n";
-            m_sql << "CREATE INDEX IF NOT EXISTS " << "index_" << i << "_1 ON py_phrase_" << i << "(s0,s1,s2,y2);\n";
-        }
-        m_sql << "COMMIT;";
-
-        if (!executeSQL (m_sql, userdb))
-            break;
+        gint version = 0;
+        {
+            SQLStmt stmt (userdb);
+            if (stmt.prepare ("PRAGMA user_version") && stmt.step ())
+                version = stmt.columnInt (0);
+        }
 
-        sqlite3_backup *backup = sqlite3_backup_init (m_db, "userdb", userdb, "main");
+        /* the tables only need to be created once */
+        if (version != DB_USER_VERSION) {
+            sql = "BEGIN TRANSACTION;\n";
+            /* create desc table*/
+            sql << "CREATE TABLE IF NOT EXISTS desc (name PRIMARY KEY, value TEXT);\n";
+            sql << "INSERT OR IGNORE INTO desc VALUES " << "('version', '1.2.0');\n"
+                << "INSERT OR IGNORE INTO desc VALUES " << "('uuid', '" << UUID () << "');\n"
+                << "INSERT OR IGNORE INTO desc VALUES " << "('hostname', '" << Hostname () << "');\n"
+                << "INSERT OR IGNORE INTO desc VALUES " << "('username', '" << Env ("USERNAME") << "');\n"
+                << "INSERT OR IGNORE INTO desc VALUES " << "('create-time', datetime());\n"
+                << "INSERT OR IGNORE INTO desc VALUES " << "('attach-time', datetime());\n"
+                << "INSERT OR IGNORE INTO desc VALUES " << "('log-id', '" << UUID () << "');\n";
+
+            /* create phrase tables */
+            for (guint i = 0; i < MAX_PHRASE_LEN; i++) {
+                sql.appendPrintf ("CREATE TABLE IF NOT EXISTS py_phrase_%d (user_freq, phrase TEXT, freq INTEGER ", i);
+                for (guint j = 0; j <= i; j++)
+                    sql.appendPrintf (",s%d INTEGER, y%d INTEGER", j, j);
+                sql << ");\n";
+            }
+
+            /* create index */
+            sql << "CREATE UNIQUE INDEX IF NOT EXISTS " << "index_0_0 ON py_phrase_0(s0,y0,phrase);\n";
+            sql << "CREATE UNIQUE INDEX IF NOT EXISTS " << "index_1_0 ON py_phrase_1(s0,y0,s1,y1,phrase);\n";
+            sql << "CREATE INDEX IF NOT EXISTS " << "index_1_1 ON py_phrase_1(s0,s1,y1);\n";
+            for (guint i = 2; i < MAX_PHRASE_LEN; i++) {
+                sql << "CREATE UNIQUE INDEX IF NOT EXISTS " << "index_" << i << "_0 ON py_phrase_" << i
+                    << "(s0,y0";
+                for (guint j = 1; j <= i; j++)
+                    sql << ",s" << j << ",y" << j;
+                sql << ",phrase);\n";
+                sql << "CREATE INDEX IF NOT EXISTS " << "index_" << i << "_1 ON py_phrase_" << i << "(s0,s1,s2,y2);\n";
+            }
 
-        if (backup) {
-            sqlite3_backup_step (backup, -1);
-            sqlite3_backup_finish (backup);
+            /* create bigram table */
+            sql << "CREATE TABLE IF NOT EXISTS py_bigram (prev TEXT, next TEXT, freq INTEGER, "
+                << "PRIMARY KEY (prev, next));\n";
+            sql << "PRAGMA user_version=" << DB_USER_VERSION << ";\n";
+            sql << "COMMIT;";
+
+            if (!executeSQL (sql, userdb))
+                break;
         }
 
-        sqlite3_close (userdb);
-        return TRUE;
+        /* the log is only valid for the snapshot it was started with */
+        {
+            SQLStmt stmt (userdb);
+            if (stmt.prepare ("SELECT value FROM desc WHERE name='log-id'") &&
+                stmt.step ())
+                m_log_id = stmt.columnText (0);
+        }
+
+        if (sqlite3_open_v2 (":memory:", &m_writer_db, flags, NULL) != SQLITE_OK)
+            break;
+        gchar *attach = sqlite3_mprintf ("ATTACH DATABASE %Q AS userdb;", path.c_str ());
+        gboolean attached = executeSQL (attach, m_writer_db);
+        sqlite3_free (attach);
+        if (!attached)
+            break;
+
+        retval = saveUserDB ();
     } while (0);
 
-    if (userdb)
+    if (userdb != NULL)
         sqlite3_close (userdb);
-    return FALSE;
+
+    if (retval) {
+        g_message ("Load user database in %.3f seconds", g_timer_elapsed (timer, NULL));
+        post (new InstallRequest (*this, path));
+    }
+    else {
+        g_warning ("can not load user database");
+        /* the changes are kept in the log for the next session */
+        user_cache_file (path, DB_LOG_FILE);
+        if (m_log == NULL)
+            m_log = g_fopen (path, "a");
+    }
+    g_timer_destroy (timer);
+
+    return retval;
 }
 
+/* runs in the writer thread. The changes in the log are written into the
+ * snapshot, with the id of a new log, in one transaction, so a log is
+ * never applied twice. */
 gboolean
 Database::saveUserDB (void)
 {
-    m_buffer = g_get_user_cache_dir ();
-    m_buffer << G_DIR_SEPARATOR_S << "ibus"
-             << G_DIR_SEPARATOR_S << "pinyin";
-    g_mkdir_with_parents (m_buffer, 0750);
-    m_buffer << G_DIR_SEPARATOR_S << "user-1.3.db";
-
-    String tmpfile = m_buffer + "-tmp";
-    sqlite3 *userdb = NULL;
-    do {
+    if (m_writer_db == NULL)
+        return FALSE;
 
-        /* remove tmpfile if it exist */
-        g_unlink (tmpfile);
+    String log_id ((const gchar *) UUID ());
+    String sql (1024);
+    sql = "BEGIN TRANSACTION;\n";
+    logSql (sql);
+    sql << "INSERT OR REPLACE INTO userdb.desc VALUES ('log-id', '" << log_id << "');\n";
+    /* only the pairs which could be kept in memory are saved */
+    sql << "DELETE FROM userdb.py_bigram WHERE rowid NOT IN "
+        << "(SELECT rowid FROM userdb.py_bigram ORDER BY freq DESC LIMIT " << DB_USER_BIGRAMS << ");\n";
+    sql << "COMMIT;\n";
+
+    if (!executeSQL (sql, m_writer_db)) {
+        executeSQL ("ROLLBACK;", m_writer_db);
+        return FALSE;
+    }
 
-        gint flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
-        if (sqlite3_open_v2 (tmpfile, &userdb, flags, NULL) != SQLITE_OK)
-            break;
+    /* the changes in the old log are in the snapshot now */
+    m_log_id = log_id;
+    startLog ();
+    return TRUE;
+}
 
-        sqlite3_backup *backup = sqlite3_backup_init (userdb, "main", m_db, "userdb");
+/* one line for each change: "+|- len freq s0 y0 ... phrase", or
+ * "> prev next" for a pair */
+void
+Database::changeLog (const UserChange & change, String & log)
+{
+    const Phrase & p = change.phrase;
 
-        if (backup == NULL)
-            break;
+    if (!change.next.empty ()) {
+        log << "> " << p.phrase << ' ' << change.next << '\n';
+        return;
+    }
 
-        sqlite3_backup_step (backup, -1);
-        sqlite3_backup_finish (backup);
-        sqlite3_close (userdb);
+    log << (change.remove ? '-' : '+') << ' ' << p.len << ' ' << p.freq;
+    for (guint i = 0; i < p.len; i++) {
+        log << ' ' << (guint) p.pinyin_id[i].sheng
+            << ' ' << (guint) p.pinyin_id[i].yun;
+    }
+    log << ' ' << p.phrase << '\n';
+}
 
-        g_rename (tmpfile, m_buffer);
+gboolean
+Database::parseChange (const gchar *line, UserChange & change)
+{
+    Phrase & p = change.phrase;
+    gchar *end;
 
+    change.next.clear ();
+    if (line[0] == '>') {
+        const gchar *next = std::strchr (line + 2, ' ');
+        if (line[1] != ' ' || next == NULL || next == line + 2 || next[1] == '\0')
+            return FALSE;
+        p.reset ();
+        g_strlcpy (p.phrase, line + 2, MIN (sizeof (p.phrase), (gsize) (next - line - 1)));
+        change.remove = FALSE;
+        change.next = next + 1;
         return TRUE;
-    } while (0);
+    }
 
-    if (userdb != NULL)
-        sqlite3_close (userdb);
-    g_unlink (tmpfile);
+    if (line[0] != '+' && line[0] != '-')
+        return FALSE;
+    change.remove = line[0] == '-';
 
-    return FALSE;
+    p.len = std::strtoul (line + 1, &end, 10);
+    if (p.len == 0 || p.len > MAX_PHRASE_LEN)
+        return FALSE;
+    p.freq = std::strtoul (end, &end, 10);
+    p.user_freq = 0;
+    p.trad = NULL;
+    for (guint i = 0; i < p.len; i++) {
+        p.pinyin_id[i].sheng = std::strtoul (end, &end, 10);
+        p.pinyin_id[i].yun = std::strtoul (end, &end, 10);
+    }
+    if (*end != ' ' || end[1] == '\0')
+        return FALSE;
+    g_strlcpy (p.phrase, end + 1, sizeof (p.phrase));
+
+    return TRUE;
 }
 
 void
-Database::prefetch (void)
+Database::changeSql (const UserChange & change, String & sql)
 {
-    m_sql.clear ();
-    for (guint i = 0; i < DB_PREFETCH_LEN; i++)
-        m_sql << "SELECT * FROM py_phrase_" << i << ";\n";
+    const Phrase & p = change.phrase;
 
-    // g_debug ("prefetching ...");
-    executeSQL (m_sql);
-    // g_debug ("done");
+    if (!change.next.empty ()) {
+        sql << "INSERT OR IGNORE INTO userdb.py_bigram VALUES (\"" << p.phrase
+            << "\",\"" << change.next << "\",0);\n";
+        sql << "UPDATE userdb.py_bigram SET freq=freq+1 WHERE prev=\"" << p.phrase
+            << "\" AND next=\"" << change.next << "\";\n";
+    }
+    else if (change.remove) {
+        sql << "DELETE FROM userdb.py_phrase_" << p.len - 1;
+        phraseWhereSql (p, sql);
+        sql << ";\n";
+    }
+    else {
+        phraseSql (p, sql);
+    }
 }
 
-gboolean
-Database::timeoutCallback (gpointer data)
+/* appends the changes in the log written after the snapshot to sql, an
+ * incomplete last line was not written out */
+void
+Database::logSql (String & sql)
 {
-    Database *self = static_cast<Database*> (data);
+    String path;
+    user_cache_file (path, DB_LOG_FILE);
 
-    /* Get elapsed time since last modification of database. */
-    guint elapsed = (guint)g_timer_elapsed (self->m_timer, NULL);
+    gchar *contents = NULL;
+    gsize length = 0;
 
-    if (elapsed >= DB_BACKUP_TIMEOUT &&
-        self->saveUserDB ()) {
-        self->m_timeout_id = 0;
-        return FALSE;
-    }
+    if (m_log != NULL)
+        std::fflush (m_log);
+    if (!g_file_get_contents (path, &contents, &length, NULL))
+        return;
 
-    return TRUE;
+    gchar **lines = g_strsplit (contents, "\n", -1);
+    guint n = g_strv_length (lines);
+
+    if (n > 1 && m_log_id == lines[0]) {
+        UserChange change;
+        for (guint i = 1; i < n - 1; i++) {
+            if (!parseChange (lines[i], change)) {
+                g_warning ("invalid change in %s: %s", path.c_str (), lines[i]);
+                continue;
+            }
+            changeSql (change, sql);
+        }
+    }
+    g_strfreev (lines);
+    g_free (contents);
 }
 
 void
-Database::modified (void)
+Database::startLog (void)
 {
-    /* Restart the timer */
-    g_timer_start (m_timer);
+    String path;
+    user_cache_file (path, DB_LOG_FILE);
 
-    if (m_timeout_id != 0)
+    if (m_log != NULL)
+        std::fclose (m_log);
+    m_log_changes = 0;
+
+    m_log = g_fopen (path, "w");
+    if (m_log == NULL) {
+        g_warning ("can not open %s", path.c_str ());
         return;
+    }
+    std::fprintf (m_log, "%s\n", m_log_id.c_str ());
+    std::fflush (m_log);
+}
+
+void
+Database::prefetch (void)
+{
+    m_sql.clear ();
+    for (guint i = 0; i < DB_PREFETCH_LEN; i++)
+        m_sql << "SELECT * FROM py_phrase_" << i << ";\n";
 
-    m_timeout_id = g_timeout_add_seconds (DB_BACKUP_TIMEOUT,
-                                          Database::timeoutCallback,
-                                          static_cast<gpointer> (this));
+    // g_debug ("prefetching ...");
+    executeSQL (m_sql);
+    // g_debug ("done");
 }
 
 inline static gboolean
@@ -524,129 +914,503 @@ pinyin_option_check_yun (guint option, gint id, gint fid)
     }
 }
 
-SQLStmtPtr
-Database::query (const PinyinArray &pinyin,
-                 guint              pinyin_begin,
-                 guint              pinyin_len,
-                 gint               m,
-                 guint              option)
+/* The fuzzy options only change the set of ids accepted for each sheng
+ * and yun, so the sets are computed once for the options in use */
+void
+Database::updateFuzzy (guint option)
 {
-    g_assert (pinyin_begin < pinyin.size ());
-    g_assert (pinyin_len <= pinyin.size () - pinyin_begin);
-    g_assert (pinyin_len <= MAX_PHRASE_LEN);
+    m_fuzzy_option = option;
 
-    /* prepare sql */
-    Conditions conditions;
+    for (gint id = 0; id <= PINYIN_ID_ZH; id++) {
+        m_fuzzy_sheng[id] = 1 << id;
+        for (gint fid = PINYIN_ID_B; fid <= PINYIN_ID_ZH; fid++) {
+            if (pinyin_option_check_sheng (option, id, fid))
+                m_fuzzy_sheng[id] |= 1 << fid;
+        }
+    }
 
-    for (guint i = 0; i < pinyin_len; i++) {
-        const Pinyin *p;
-        gboolean fs1, fs2;
-        p = pinyin[i + pinyin_begin];
+    m_fuzzy_yun[PINYIN_ID_ZERO] = 0;
+    for (gint id = PINYIN_ID_A; id <= PINYIN_ID_V; id++) {
+        m_fuzzy_yun[id] = G_GUINT64_CONSTANT (1) << id;
+        for (gint fid = PINYIN_ID_A; fid <= PINYIN_ID_V; fid++) {
+            if (pinyin_option_check_yun (option, id, fid))
+                m_fuzzy_yun[id] |= G_GUINT64_CONSTANT (1) << fid;
+        }
+    }
+}
 
-        fs1 = pinyin_option_check_sheng (option, p->pinyin_id[0].sheng, p->pinyin_id[1].sheng);
-        fs2 = pinyin_option_check_sheng (option, p->pinyin_id[0].sheng, p->pinyin_id[2].sheng);
+void
+Database::fillSyllables (const PinyinArray &pinyin,
+                         guint              pinyin_begin,
+                         guint              pinyin_len,
+                         guint              option,
+                         LexiconSyllable   *syllables)
+{
+    if (G_UNLIKELY (option != m_fuzzy_option))
+        updateFuzzy (option);
+
+    for (guint i = 0; i < pinyin_len; i++)
+        fillSyllable (pinyin[i + pinyin_begin], syllables[i]);
+}
+
+void
+Database::fillSyllable (const Pinyin *p, LexiconSyllable & syllable)
+{
+    guint sheng = p->pinyin_id[0].sheng;
+    guint yun = p->pinyin_id[0].yun;
+
+    syllable.sheng_mask = m_fuzzy_sheng[sheng];
+    syllable.sheng[0] = sheng;
+    syllable.n_sheng = 1;
+    for (gint id = -1; (id = g_bit_nth_lsf (syllable.sheng_mask, id)) >= 0; ) {
+        if ((guint) id != sheng)
+            syllable.sheng[syllable.n_sheng++] = id;
+    }
+
+    syllable.yun_mask = m_fuzzy_yun[yun];
+    syllable.n_yun = 0;
+    if (yun != PINYIN_ID_ZERO) {
+        syllable.yun[syllable.n_yun++] = yun;
+        for (guint id = PINYIN_ID_A; id <= PINYIN_ID_V; id++) {
+            if (id != yun && ((syllable.yun_mask >> id) & 1))
+                syllable.yun[syllable.n_yun++] = id;
+        }
+    }
+}
+
+/* The sql text only depends on the number of accepted ids of each
+ * syllable, so it is the key of the statement cache with the length */
+static guint64
+syllables_shape (const LexiconSyllable *syllables, guint len)
+{
+    guint64 shape = 0;
+    for (guint i = 0; i < len; i++) {
+        shape = (shape << 4) | (syllables[i].n_yun << 2) | syllables[i].n_sheng;
+    }
+    return shape;
+}
+
+static void
+bind_syllables (SQLStmt &stmt, const LexiconSyllable *syllables, guint len)
+{
+    for (guint i = 0; i < len; i++) {
+        for (guint j = 0; j < syllables[i].n_sheng; j++)
+            stmt.bindInt (DB_PARAM_SHENG (i, j), syllables[i].sheng[j]);
+        for (guint j = 0; j < syllables[i].n_yun; j++)
+            stmt.bindInt (DB_PARAM_YUN (i, j), syllables[i].yun[j]);
+    }
+}
+
+/* Fuzzy ids are matched with IN lists, sqlite looks up all of them in
+ * the (s0,y0,s1,y1,...) index with one statement */
+void
+Database::conditionsSql (const LexiconSyllable *syllables, guint len)
+{
+    m_buffer = "  ";
+    for (guint i = 0; i < len; i++) {
+        const LexiconSyllable & syllable = syllables[i];
 
         if (G_LIKELY (i > 0))
-            conditions.appendPrintf (0, conditions.size (),
-                                       " AND ");
-
-        if (G_UNLIKELY (fs1 || fs2)) {
-            if (G_LIKELY (i < DB_INDEX_SIZE)) {
-                if (fs1 && fs2 == 0) {
-                    conditions.double_ ();
-                    conditions.appendPrintf (0, conditions.size ()  >> 1,
-                                               "s%d=%d", i, p->pinyin_id[0].sheng);
-                    conditions.appendPrintf (conditions.size () >> 1, conditions.size (),
-                                               "s%d=%d", i, p->pinyin_id[1].sheng);
-                }
-                else if (fs1 == 0 && fs2) {
-                    conditions.double_ ();
-                    conditions.appendPrintf (0, conditions.size ()  >> 1,
-                                               "s%d=%d", i, p->pinyin_id[0].sheng);
-                    conditions.appendPrintf (conditions.size () >> 1, conditions.size (),
-                                               "s%d=%d", i, p->pinyin_id[2].sheng);
-                }
-                else {
-                    gint len = conditions.size ();
-                    conditions.triple ();
-                    conditions.appendPrintf (0, len,
-                                               "s%d=%d", i, p->pinyin_id[0].sheng);
-                    conditions.appendPrintf (len, len << 1,
-                                               "s%d=%d", i, p->pinyin_id[1].sheng);
-                    conditions.appendPrintf (len << 1, conditions.size (),
-                                               "s%d=%d", i, p->pinyin_id[2].sheng);
-                }
-            }
-            else {
-                if (fs1 && fs2 == 0) {
-                    conditions.appendPrintf (0, conditions.size (),
-                                               "s%d IN (%d,%d)", i, p->pinyin_id[0].sheng, p->pinyin_id[1].sheng);
-                }
-                else if (fs1 == 0 && fs2) {
-                    conditions.appendPrintf (0, conditions.size (),
-                                               "s%d IN (%d,%d)", i, p->pinyin_id[0].sheng, p->pinyin_id[2].sheng);
-                }
-                else {
-                    conditions.appendPrintf (0, conditions.size (),
-                                               "s%d IN (%d,%d,%d)", i, p->pinyin_id[0].sheng, p->pinyin_id[1].sheng, p->pinyin_id[2].sheng);
-                }
-            }
+            m_buffer << " AND ";
+
+        if (G_LIKELY (syllable.n_sheng == 1)) {
+            m_buffer.appendPrintf ("s%d=?%d", i, DB_PARAM_SHENG (i, 0));
         }
         else {
-            conditions.appendPrintf (0, conditions.size (),
-                                       "s%d=%d", i, p->pinyin_id[0].sheng);
-        }
-
-        if (p->pinyin_id[0].yun != PINYIN_ID_ZERO) {
-            if (pinyin_option_check_yun (option, p->pinyin_id[0].yun, p->pinyin_id[1].yun)) {
-                if (G_LIKELY (i < DB_INDEX_SIZE)) {
-                    conditions.double_ ();
-                    conditions.appendPrintf (0, conditions.size ()  >> 1,
-                                               " AND y%d=%d", i, p->pinyin_id[0].yun);
-                    conditions.appendPrintf (conditions.size () >> 1, conditions.size (),
-                                               " and y%d=%d", i, p->pinyin_id[1].yun);
-                }
-                else {
-                    conditions.appendPrintf (0, conditions.size (),
-                                               " AND y%d IN (%d,%d)", i, p->pinyin_id[0].yun, p->pinyin_id[1].yun);
-                }
-            }
-            else {
-                conditions.appendPrintf (0, conditions.size (),
-                                           " AND y%d=%d", i, p->pinyin_id[0].yun);
-            }
+            m_buffer.appendPrintf ("s%d IN (?%d", i, DB_PARAM_SHENG (i, 0));
+            for (guint j = 1; j < syllable.n_sheng; j++)
+                m_buffer.appendPrintf (",?%d", DB_PARAM_SHENG (i, j));
+            m_buffer << ")";
+        }
+
+        if (syllable.n_yun == 1) {
+            m_buffer.appendPrintf (" AND y%d=?%d", i, DB_PARAM_YUN (i, 0));
+        }
+        else if (syllable.n_yun == 2) {
+            m_buffer.appendPrintf (" AND y%d IN (?%d,?%d)", i,
+                                   DB_PARAM_YUN (i, 0), DB_PARAM_YUN (i, 1));
         }
     }
+    m_buffer << "\n";
+}
 
+/* Returns the statement to the cache when the last reference is dropped */
+class SQLStmtRecycler {
+public:
+    SQLStmtRecycler (const Database::StmtKey & key) : m_key (key) {}
 
-    m_buffer.clear ();
-    for (guint i = 0; i < conditions.size (); i++) {
-        if (G_UNLIKELY (i == 0))
-            m_buffer << "  (" << conditions[i] << ")\n";
+    void operator () (SQLStmt *stmt) const {
+        Database *database = Database::m_instance.get ();
+        if (database != NULL)
+            database->m_stmts[m_key].push_back (stmt);
         else
-            m_buffer << "  OR (" << conditions[i] << ")\n";
+            delete stmt;
+    }
+
+private:
+    Database::StmtKey m_key;
+};
+
+SQLStmtPtr
+Database::cachedStmt (guint                  kind,
+                      const LexiconSyllable *syllables,
+                      guint                  len)
+{
+    /* userdb is small, it is only searched by the first syllable, and the
+     * rows are filtered by fetch. sqlite would probe every combination of
+     * fuzzy ids otherwise */
+    guint n = kind == DB_STMT_USER ? 1 : len;
+    StmtKey key ((len << 2) | kind, syllables_shape (syllables, n));
+    std::vector<SQLStmt *> & stmts = m_stmts[key];
+
+    if (G_LIKELY (!stmts.empty ())) {
+        SQLStmt *stmt = stmts.back ();
+        stmts.pop_back ();
+        stmt->reset ();
+        m_stmt_hits ++;
+        return SQLStmtPtr (stmt, SQLStmtRecycler (key));
     }
 
+    /* prepare sql */
+    conditionsSql (syllables, n);
+
     m_sql.clear ();
-    gint id = pinyin_len - 1;
-    m_sql << "SELECT * FROM ("
-                "SELECT 0 AS user_freq, * FROM main.py_phrase_" << id << " WHERE " << m_buffer << " UNION ALL "
-                "SELECT * FROM userdb.py_phrase_" << id << " WHERE " << m_buffer << ") "
-                    "GROUP BY phrase ORDER BY user_freq DESC, freq DESC";
-    if (m > 0)
-        m_sql << " LIMIT " << m;
+    gint id = len - 1;
+    switch (kind) {
+    case DB_STMT_USER:
+        m_sql << "SELECT * FROM userdb.py_phrase_" << id << " WHERE " << m_buffer
+              << "ORDER BY user_freq DESC, freq DESC";
+        break;
+    /* a phrase may be matched by fuzzy ids more than once, keep the row
+     * ranked first as the bare columns of MAX () */
+    case DB_STMT_MAIN:
+        m_sql << "SELECT *, MAX (freq) FROM ("
+                    "SELECT 0 AS user_freq, * FROM main.py_phrase_" << id << " WHERE " << m_buffer << ") "
+                        "GROUP BY phrase ORDER BY freq DESC "
+                        "LIMIT ?" << DB_PARAM_LIMIT;
+        break;
+    default:
+        m_sql << "SELECT *, MAX ((user_freq << 32) | freq) FROM ("
+                    "SELECT 0 AS user_freq, * FROM main.py_phrase_" << id << " WHERE " << m_buffer << " UNION ALL "
+                    "SELECT * FROM userdb.py_phrase_" << id << " WHERE " << m_buffer << ") "
+                        "GROUP BY phrase ORDER BY user_freq DESC, freq DESC "
+                        "LIMIT ?" << DB_PARAM_LIMIT;
+        break;
+    }
 #if 0
     g_debug ("sql =\n%s", m_sql.c_str ());
 #endif
 
-    /* query database */
-    SQLStmtPtr stmt (new SQLStmt (m_db));
-
+    SQLStmt *stmt = new SQLStmt (m_db);
     if (!stmt->prepare (m_sql)) {
-        stmt.reset ();
+        delete stmt;
+        return SQLStmtPtr ();
+    }
+
+    m_stmt_misses ++;
+    return SQLStmtPtr (stmt, SQLStmtRecycler (key));
+}
+
+static gboolean
+phrase_user_freq_greater (const Phrase & a, const Phrase & b)
+{
+    if (a.user_freq != b.user_freq)
+        return a.user_freq > b.user_freq;
+    return a.freq > b.freq;
+}
+
+/* Applies the changes learned before userdb was installed to the rows
+ * read from database, so they are seen at once. user_rows is TRUE if
+ * phrases[begin..] are rows of userdb, otherwise they are grouped by
+ * phrase as the union statement does. */
+void
+Database::mergePending (const LexiconSyllable   *syllables,
+                        guint                    len,
+                        gboolean                 user_rows,
+                        PhraseArray            & phrases,
+                        guint                    begin)
+{
+    if (G_LIKELY (m_pending.empty ()))
+        return;
+
+    gboolean changed = FALSE;
+    std::deque<UserChange>::const_iterator it;
+    for (it = m_pending.begin (); it != m_pending.end (); ++it) {
+        const Phrase & p = it->phrase;
+        if (p.len != len)
+            continue;
+
+        guint i;
+        for (i = 0; i < len; i++) {
+            if (!syllables[i].accepts (p.pinyin_id[i].sheng, p.pinyin_id[i].yun))
+                break;
+        }
+        if (i < len)
+            continue;
+
+        for (i = begin; i < phrases.size (); i++) {
+            if (std::strcmp (phrases[i].phrase, p.phrase) != 0)
+                continue;
+            if (!user_rows ||
+                std::memcmp (phrases[i].pinyin_id, p.pinyin_id, len << 1) == 0)
+                break;
+        }
+
+        if (it->remove) {
+            if (i == phrases.size ())
+                continue;
+            /* a phrase of main database is still there */
+            if (user_rows || phrases[i].freq == 0)
+                phrases.erase (phrases.begin () + i);
+            else
+                phrases[i].user_freq = 0;
+        }
+        else if (i < phrases.size ()) {
+            phrases[i].user_freq ++;
+        }
+        else {
+            phrases.push_back (p);
+            phrases.back ().user_freq = 1;
+        }
+        changed = TRUE;
+    }
+
+    if (changed)
+        std::stable_sort (phrases.begin () + begin, phrases.end (),
+                          phrase_user_freq_greater);
+}
+
+void
+Database::fetch (const LexiconSyllable *syllables,
+                 guint                  len,
+                 gint                   m,
+                 PhraseArray           &phrases,
+                 Lexicon::Cursor       *cursor)
+{
+    Phrase phrase;
+
+    if (!m_lexicon.loaded ()) {
+        SQLStmtPtr stmt = cachedStmt (m_userdb_ready ? DB_STMT_UNION : DB_STMT_MAIN,
+                                      syllables, len);
+        if (stmt.get () != NULL) {
+            bind_syllables (*stmt, syllables, len);
+            stmt->bindInt (DB_PARAM_LIMIT, m > 0 ? m : -1);
+            while (stmt->step ()) {
+                phrase_from_stmt (*stmt, len, phrase);
+                phrases.push_back (phrase);
+            }
+        }
+        mergePending (syllables, len, FALSE, phrases, 0);
+
+        if (m > 0 && phrases.size () > (guint) m)
+            phrases.resize (m);
+        return;
+    }
+
+    /* user phrases come first, they have user_freq > 0 */
+    if (m_userdb_ready) {
+        SQLStmtPtr stmt = cachedStmt (DB_STMT_USER, syllables, len);
+        if (stmt.get () != NULL) {
+            bind_syllables (*stmt, syllables, 1);
+            while (stmt->step ()) {
+                phrase_from_stmt (*stmt, len, phrase);
+                guint i;
+                for (i = 1; i < len; i++) {
+                    if (!syllables[i].accepts (phrase.pinyin_id[i].sheng,
+                                               phrase.pinyin_id[i].yun))
+                        break;
+                }
+                if (i == len)
+                    phrases.push_back (phrase);
+            }
+        }
+    }
+    mergePending (syllables, len, TRUE, phrases, 0);
+
+    /* drop duplicated phrases, as GROUP BY phrase does */
+    std::set<std::string> seen;
+    for (guint i = 0; i < phrases.size (); i++)
+        seen.insert (phrases[i].phrase);
+
+    /* only the phrases taken are read from the lexicon */
+    Lexicon::Cursor own_cursor;
+    if (cursor == NULL) {
+        cursor = &own_cursor;
+        m_lexicon.query (syllables, len, *cursor);
+    }
+    while ((m < 0 || phrases.size () < (guint) m) && cursor->next (phrase)) {
+        if (seen.insert (phrase.phrase).second)
+            phrases.push_back (phrase);
+    }
+}
+
+/* caches the first phrases matching syllables[0..len) */
+const PhraseArray *
+Database::fetchPrefix (const LexiconSyllable *syllables,
+                       guint                  len,
+                       Lexicon::Cursor       *cursor,
+                       gboolean             & complete)
+{
+    PhraseArray result;
+    fetch (syllables, len, DB_CACHE_PREFIX_LEN + 1, result, cursor);
+    complete = result.size () <= DB_CACHE_PREFIX_LEN;
+    if (!complete)
+        result.resize (DB_CACHE_PREFIX_LEN);
+    return m_cache.insert (syllables, len, result, complete);
+}
+
+static gboolean
+syllables_equal (const LexiconSyllable *a, const LexiconSyllable *b, guint len)
+{
+    for (guint i = 0; i < len; i++) {
+        if (a[i].sheng_mask != b[i].sheng_mask || a[i].yun_mask != b[i].yun_mask ||
+            a[i].sheng[0] != b[i].sheng[0] ||
+            a[i].n_yun != b[i].n_yun || (a[i].n_yun > 0 && a[i].yun[0] != b[i].yun[0]))
+            return FALSE;
     }
+    return TRUE;
+}
 
-    return stmt;
+/* Query::fill asks for every length from len down to 1, so the lexicon
+ * is walked once for all of them, and the cursor of each length is kept
+ * until the length is asked */
+Lexicon::Cursor *
+Database::prefixCursor (const LexiconSyllable *syllables, guint len)
+{
+    if (len > m_walk_len || !syllables_equal (syllables, m_walk_syllables, len) ||
+        m_walk[len - 1] == NULL) {
+        std::copy (syllables, syllables + len, m_walk_syllables);
+        m_walk_len = len;
+        for (guint i = 0; i < len; i++)
+            m_walk[i] = &m_walk_cursors[i];
+        m_lexicon.query (syllables, len, m_walk);
+    }
+
+    Lexicon::Cursor *cursor = m_walk[len - 1];
+    m_walk[len - 1] = NULL;
+    return cursor;
+}
+
+gint
+Database::query (const PinyinArray &pinyin,
+                 guint              pinyin_begin,
+                 guint              pinyin_len,
+                 guint              option,
+                 guint              offset,
+                 gint               count,
+                 PhraseArray       &phrases,
+                 gboolean          &complete)
+{
+    g_assert (pinyin_begin < pinyin.size ());
+    g_assert (pinyin_len <= pinyin.size () - pinyin_begin);
+    g_assert (pinyin_len <= MAX_PHRASE_LEN);
+
+    LexiconSyllable syllables[MAX_PHRASE_LEN];
+    fillSyllables (pinyin, pinyin_begin, pinyin_len, option, syllables);
+
+    const PhraseArray *cached = m_cache.lookup (syllables, pinyin_len, complete);
+    if (cached == NULL) {
+        Lexicon::Cursor *cursor = NULL;
+        if (m_lexicon.loaded ())
+            cursor = prefixCursor (syllables, pinyin_len);
+        cached = fetchPrefix (syllables, pinyin_len, cursor, complete);
+    }
+
+    gint n = 0;
+    for (guint i = offset; i < cached->size () && n < count; i++, n++)
+        phrases.push_back ((*cached)[i]);
+
+    if (G_UNLIKELY (m_timer != NULL) && n > 0) {
+        g_message ("First candidates in %.3f seconds", g_timer_elapsed (m_timer, NULL));
+        g_timer_destroy (m_timer);
+        m_timer = NULL;
+    }
+
+    return n;
+}
+
+void
+Database::queryTop (const PinyinArray &pinyin,
+                    guint              pinyin_begin,
+                    guint              pinyin_len,
+                    guint              option,
+                    gint               count,
+                    PhraseArray       &phrases)
+{
+    g_assert (pinyin_begin < pinyin.size ());
+    g_assert (pinyin_len <= pinyin.size () - pinyin_begin);
+    g_assert (pinyin_len <= MAX_PHRASE_LEN);
+
+    LexiconSyllable syllables[MAX_PHRASE_LEN];
+    fillSyllables (pinyin, pinyin_begin, pinyin_len, option, syllables);
+    fetch (syllables, pinyin_len, count, phrases);
+}
+
+/* The nodes of the lexicon walk are the positions in the text from the
+ * begin of pinyin[pinyin_begin], and the phrases of length len are the
+ * ones reaching the end of pinyin[pinyin_begin + len - 1] */
+void
+Database::queryAlternatives (const PinyinLattice    & lattice,
+                             const PinyinArray      & pinyin,
+                             guint                    pinyin_begin,
+                             guint                    pinyin_len,
+                             guint                    option,
+                             gint                     count,
+                             std::vector<PhraseArray> & alternatives)
+{
+    g_assert (pinyin_begin < pinyin.size ());
+    g_assert (pinyin_len <= pinyin.size () - pinyin_begin);
+
+    alternatives.assign (pinyin_len, PhraseArray ());
+
+    const PinyinSegment & last = pinyin[pinyin_begin + pinyin_len - 1];
+    if (lattice.empty () || lattice.length () < last.begin + last.len ||
+        !m_lexicon.loaded ())
+        return;
+
+    if (G_UNLIKELY (option != m_fuzzy_option))
+        updateFuzzy (option);
+
+    guint base = pinyin[pinyin_begin].begin;
+    guint end = lattice.next (last);
+    guint n_nodes = end - base + 1;
+
+    std::vector<Lexicon::Cursor> cursors (pinyin_len);
+    std::vector<Lexicon::Cursor *> targets (n_nodes, (Lexicon::Cursor *) NULL);
+    for (guint i = 0; i < pinyin_len; i++)
+        targets[lattice.next (pinyin[pinyin_begin + i]) - base] = &cursors[i];
+
+    std::vector<LexiconArc> arcs;
+    std::vector<guint> first (n_nodes + 1);
+    guint k = pinyin_begin;
+    for (guint pos = base; pos < end; pos++) {
+        first[pos - base] = arcs.size ();
+        while (k < pinyin.size () && pinyin[k].begin < pos)
+            k ++;
+        for (const PinyinSegment *segment = lattice.begin (pos);
+             segment < lattice.end (pos); segment++) {
+            LexiconArc arc;
+            guint next = lattice.next (*segment);
+            if (next > end)
+                continue;
+            fillSyllable (segment->pinyin, arc.syllable);
+            arc.next = next - base;
+            arc.alternative = k == pinyin.size () || !(*segment == pinyin[k]);
+            arcs.push_back (arc);
+        }
+    }
+    first[n_nodes - 1] = first[n_nodes] = arcs.size ();
+
+    m_lexicon.query (arcs.data (), first.data (), n_nodes, targets.data ());
+
+    Phrase phrase;
+    for (guint i = 0; i < pinyin_len; i++) {
+        std::set<std::string> seen;
+        while ((gint) alternatives[i].size () < count && cursors[i].next (phrase)) {
+            if (seen.insert (phrase.phrase).second)
+                alternatives[i].push_back (phrase);
+        }
+    }
 }
 
 inline void
@@ -684,35 +1448,208 @@ Database::phraseSql (const Phrase & p, String & sql)
     sql << ";\n";
 }
 
+/* runs in the query thread, userdb in memory takes the change at once
+ * and the writer saves it */
 void
-Database::commit (const PhraseArray  &phrases)
+Database::learn (const Phrase & phrase, gboolean remove)
+{
+    if (G_UNLIKELY (m_writer == NULL))
+        return;
+
+    UserChange *change = new UserChange;
+    change->phrase = phrase;
+    change->remove = remove;
+
+    if (m_userdb_ready) {
+        String sql (256);
+        changeSql (*change, sql);
+        executeSQL (sql);
+    }
+    else {
+        m_pending.push_back (*change);
+    }
+
+    m_cache.invalidate (phrase);
+    g_async_queue_push (m_changes, change);
+}
+
+/* the pair is counted in memory at once, userdb gets it in the writer */
+void
+Database::learnPair (const gchar *prev, const gchar *next)
+{
+    if (G_UNLIKELY (m_writer == NULL))
+        return;
+
+    m_user_bigram.learn (prev, next);
+
+    UserChange *change = new UserChange;
+    change->phrase.reset ();
+    g_strlcpy (change->phrase.phrase, prev, sizeof (change->phrase.phrase));
+    change->remove = FALSE;
+    change->next = next;
+    g_async_queue_push (m_changes, change);
+}
+
+/* userdb is in memory, so it only takes a copy of the pairs */
+void
+Database::loadUserBigram (void)
+{
+    SQLStmt stmt (m_db);
+    m_sql.printf ("SELECT prev, next, freq FROM userdb.py_bigram "
+                  "ORDER BY freq DESC LIMIT %d", DB_USER_BIGRAMS);
+    if (stmt.prepare (m_sql)) {
+        while (stmt.step ())
+            m_user_bigram.restore (stmt.columnText (0), stmt.columnText (1),
+                                   stmt.columnInt (2));
+    }
+}
+
+/* runs in the query thread, the changes learned before userdb was
+ * installed are applied to it */
+void
+Database::userdbInstalled (void)
+{
+    if (!m_pending.empty ()) {
+        String sql (1024);
+        sql = "BEGIN TRANSACTION;\n";
+        std::deque<UserChange>::const_iterator it;
+        for (it = m_pending.begin (); it != m_pending.end (); ++it)
+            changeSql (*it, sql);
+        sql << "COMMIT;\n";
+        executeSQL (sql);
+        m_pending.clear ();
+    }
+
+    /* results fetched before miss the user phrases */
+    g_atomic_int_set (&m_userdb_ready, TRUE);
+    m_cache.clear ();
+    loadUserBigram ();
+}
+
+void
+Database::learnPhrases (const PhraseArray  &phrases, const String & context)
 {
     Phrase phrase = {""};
 
-    m_sql = "BEGIN TRANSACTION;\n";
+    /* phrases of other segmentations may have more syllables in all */
+    guint len = 0;
     for (guint i = 0; i < phrases.size (); i++) {
-        phrase += phrases[i];
-        phraseSql (phrases[i], m_sql);
+        len += phrases[i].len;
+        if (len <= MAX_PHRASE_LEN)
+            phrase += phrases[i];
+        learn (phrases[i], FALSE);
+        if (i > 0)
+            learnPair (phrases[i - 1].phrase, phrases[i].phrase);
+        else if (!context.empty ())
+            learnPair (context, phrases[i].phrase);
     }
-    if (phrases.size () > 1)
-        phraseSql (phrase, m_sql);
-    m_sql << "COMMIT;\n";
+    if (phrases.size () > 1 && len <= MAX_PHRASE_LEN)
+        learn (phrase, FALSE);
+}
 
-    executeSQL (m_sql);
-    modified ();
+void
+Database::commit (const PhraseArray  &phrases, const String & context)
+{
+    post (new LearnRequest (*this, phrases, context, FALSE));
 }
 
 void
 Database::remove (const Phrase & phrase)
 {
-    m_sql = "BEGIN TRANSACTION;\n";
-    m_sql << "DELETE FROM userdb.py_phrase_" << phrase.len - 1;
-    phraseWhereSql (phrase, m_sql);
-    m_sql << ";\n";
-    m_sql << "COMMIT;\n";
+    PhraseArray phrases;
+    phrases.push_back (phrase);
+    post (new LearnRequest (*this, phrases, String (), TRUE));
+}
 
-    executeSQL (m_sql);
-    modified ();
+void
+Database::post (Request *request)
+{
+    g_async_queue_push (m_requests, request);
+}
+
+/* the database itself is pushed to quit */
+gpointer
+Database::queryThread (gpointer data)
+{
+    Database *database = static_cast<Database *> (data);
+    gpointer data_request;
+
+    if (database->open ())
+        database->m_writer = g_thread_new ("pinyin-userdb", Database::writerThread, database);
+
+    while ((data_request = g_async_queue_pop (database->m_requests)) != database) {
+        Request *request = static_cast<Request *> (data_request);
+        request->run ();
+        /* idle sources are taken after the events waiting, so a burst of
+         * keys is taken before the results */
+        g_idle_add (Database::requestDone, request);
+    }
+    return NULL;
+}
+
+gboolean
+Database::requestDone (gpointer data)
+{
+    Request *request = static_cast<Request *> (data);
+    request->done ();
+    delete request;
+    return FALSE;
+}
+
+gpointer
+Database::writerThread (gpointer data)
+{
+    static_cast<Database *> (data)->writeChanges ();
+    return NULL;
+}
+
+/* runs in the writer thread, the database itself is pushed to quit */
+void
+Database::writeChanges (void)
+{
+    String log (256);
+    gboolean quit = FALSE;
+
+    loadUserDB ();
+
+    while (!quit) {
+        /* logs all queued changes at once */
+        gpointer data = g_async_queue_pop (m_changes);
+        guint n = 0;
+
+        log.clear ();
+        do {
+            if (data == this) {
+                quit = TRUE;
+                break;
+            }
+            UserChange *change = static_cast<UserChange *> (data);
+            changeLog (*change, log);
+            delete change;
+            n ++;
+        } while ((data = g_async_queue_try_pop (m_changes)) != NULL);
+
+        if (n == 0)
+            continue;
+
+        /* only the changes are written out, the snapshot takes them when
+         * it is saved */
+        if (m_log != NULL) {
+            std::fputs (log.c_str (), m_log);
+            std::fflush (m_log);
+        }
+        m_log_changes += n;
+
+        /* the query thread may still be copying the snapshot */
+        if (m_log_changes >= DB_LOG_MAX_CHANGES &&
+            g_atomic_int_get (&m_userdb_ready))
+            saveUserDB ();
+    }
+
+    if (m_writer_db != NULL) {
+        sqlite3_close (m_writer_db);
+        m_writer_db = NULL;
+    }
 }
 
 void
@@ -21,38 +21,66 @@
 #ifndef __PY_DATABASE_H_
 #define __PY_DATABASE_H_
 
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
 #include "PYUtil.h"
 #include "PYString.h"
 #include "PYTypes.h"
 #include "PYPhraseArray.h"
+#include "PYPinyinArray.h"
+#include "PYBigram.h"
+#include "PYLexicon.h"
+#include "PYQueryCache.h"
+#include "PYUserBigram.h"
 
 typedef struct sqlite3 sqlite3;
 
 namespace PY {
 
-class PinyinArray;
 struct Phrase;
 
 class SQLStmt;
+class SQLStmtRecycler;
 typedef std::shared_ptr<SQLStmt> SQLStmtPtr;
 
 class Database;
 
 class Query {
 public:
+    /* phrases of other segmentations in lattice are merged into the
+     * phrases of the same text, if lattice is not NULL */
     Query (const PinyinArray    & pinyin,
            guint                  pinyin_begin,
            guint                  pinyin_len,
-           guint                  option);
+           guint                  option,
+           const PinyinLattice  * lattice = NULL);
     ~Query (void);
-    gint fill (PhraseArray &phrases, gint count);
+    /* spans gets the number of pinyin each phrase is for, if it is not
+     * NULL */
+    gint fill (PhraseArray &phrases, gint count, std::vector<guint> *spans = NULL);
 
 private:
-    const PinyinArray & m_pinyin;
+    void give (PhraseArray &phrases, const Phrase &phrase, gint &row);
+    gboolean take (PhraseArray &phrases, const Phrase *phrase, gint &row, gint count);
+
+private:
+    PinyinArray m_pinyin;       /* a copy, the query may outlive the editor */
     guint m_pinyin_begin;
     guint m_pinyin_len;
     guint m_option;
-    SQLStmtPtr m_stmt;
+    PhraseArray m_phrases;      /* phrases beyond the cached prefix */
+    guint m_pos;
+    guint m_limit;              /* phrases asked for m_phrases */
+
+    PinyinLattice m_lattice;    /* a copy, it is cleared once it is queried */
+    std::vector<PhraseArray> m_alternatives;    /* of each length */
+    guint m_alternative_pos;
+    std::set<std::string> m_taken;  /* phrases given for the length */
+    std::vector<guint> *m_spans;    /* of the running fill */
 };
 
 class Database {
@@ -62,42 +90,174 @@ protected:
     Database ();
 
 public:
-    SQLStmtPtr query (const PinyinArray   & pinyin,
-                      guint                 pinyin_begin,
-                      guint                 pinyin_len,
-                      gint                  m,
-                      guint                 option);
-    void commit (const PhraseArray  & phrases);
+    /* work for the query thread, see post () */
+    class Request {
+    public:
+        virtual ~Request (void) { }
+        /* runs in the query thread */
+        virtual void run (void) = 0;
+        /* runs in the main context after run (), the request is deleted
+         * then */
+        virtual void done (void) = 0;
+    };
+
+    /* queues request for the query thread, which takes it in the order
+     * posted. The database, its caches and userdb in memory are only
+     * used by that thread, the methods below are called in requests. */
+    void post (Request *request);
+
+    /* copies at most count phrases of the cached results from offset,
+     * complete is FALSE if the cache only has a prefix of the results */
+    gint query (const PinyinArray   & pinyin,
+                guint                 pinyin_begin,
+                guint                 pinyin_len,
+                guint                 option,
+                guint                 offset,
+                gint                  count,
+                PhraseArray         & phrases,
+                gboolean            & complete);
+    /* appends the first count phrases, or all of them if count < 0 */
+    void queryTop (const PinyinArray   & pinyin,
+                   guint                 pinyin_begin,
+                   guint                 pinyin_len,
+                   guint                 option,
+                   gint                  count,
+                   PhraseArray         & phrases);
+    /* alternatives[len - 1] gets the first count phrases of the other
+     * segmentations in lattice of the text of pinyin[pinyin_begin..
+     * pinyin_begin + len), for each len up to pinyin_len. They are only
+     * looked up in the compiled lexicon, with one walk for all of them. */
+    void queryAlternatives (const PinyinLattice    & lattice,
+                            const PinyinArray      & pinyin,
+                            guint                    pinyin_begin,
+                            guint                    pinyin_len,
+                            guint                    option,
+                            gint                     count,
+                            std::vector<PhraseArray> & alternatives);
+    /* learns the phrases, and each of them after the one before it,
+     * the first one after context if it is not empty. It is posted to
+     * the query thread, as remove () is */
+    void commit (const PhraseArray  & phrases, const String & context);
     void remove (const Phrase & phrase);
 
     void conditionsDouble (void);
     void conditionsTriple (void);
 
+    /* costs of adjacent phrases, nothing is loaded if it is not installed */
+    const Bigram & bigram (void) const { return m_bigram; }
+    /* phrase pairs committed by the user */
+    const UserBigram & userBigram (void) const { return m_user_bigram; }
+
     static void init (void);
     static void finalize (void);
     static Database & instance (void) { return *m_instance; }
 
 private:
+    class LearnRequest;
+    class InstallRequest;
+
     gboolean open (void);
     gboolean loadUserDB (void);
+    void userdbInstalled (void);
     gboolean saveUserDB (void);
+    void logSql (String & sql);
+    void startLog (void);
     void prefetch (void);
+    void updateFuzzy (guint option);
+    void fillSyllable (const Pinyin *p, LexiconSyllable & syllable);
+    void fillSyllables (const PinyinArray      & pinyin,
+                        guint                    pinyin_begin,
+                        guint                    pinyin_len,
+                        guint                    option,
+                        LexiconSyllable         *syllables);
+    void conditionsSql (const LexiconSyllable *syllables, guint len);
+    void fetch (const LexiconSyllable *syllables,
+                guint                  len,
+                gint                   m,
+                PhraseArray          & phrases,
+                Lexicon::Cursor       *cursor = NULL);
+    const PhraseArray *fetchPrefix (const LexiconSyllable *syllables,
+                                    guint                  len,
+                                    Lexicon::Cursor       *cursor,
+                                    gboolean             & complete);
+    Lexicon::Cursor *prefixCursor (const LexiconSyllable *syllables, guint len);
+    SQLStmtPtr cachedStmt (guint                    kind,
+                           const LexiconSyllable   *syllables,
+                           guint                    len);
+    void mergePending (const LexiconSyllable   *syllables,
+                       guint                    len,
+                       gboolean                 user_rows,
+                       PhraseArray            & phrases,
+                       guint                    begin);
+    void learnPhrases (const PhraseArray & phrases, const String & context);
+    void learn (const Phrase & phrase, gboolean remove);
+    void learnPair (const gchar *prev, const gchar *next);
+    void loadUserBigram (void);
+    void writeChanges (void);
+    static gpointer writerThread (gpointer data);
+    static gpointer queryThread (gpointer data);
+    static gboolean requestDone (gpointer data);
     void phraseSql (const Phrase & p, String & sql);
     void phraseWhereSql (const Phrase & p, String & sql);
     gboolean executeSQL (const gchar *sql, sqlite3 *db = NULL);
-    void modified (void);
-    static gboolean timeoutCallback (gpointer data);
 
 private:
-    sqlite3 *m_db;              /* sqlite3 database */
+    sqlite3 *m_db;              /* main database and userdb in memory */
+    Lexicon m_lexicon;          /* compiled main database */
+    Bigram m_bigram;            /* phrase bigram model */
+    QueryCache m_cache;         /* ranked results of recent queries */
+    UserBigram m_user_bigram;   /* filled from userdb once it is loaded */
+
+    /* ids accepted for each sheng and yun with m_fuzzy_option */
+    guint m_fuzzy_option;
+    guint32 m_fuzzy_sheng[PINYIN_ID_ZH + 1];
+    guint64 m_fuzzy_yun[PINYIN_ID_V + 1];
+
+    /* cursors of the last lexicon walk, NULL once used */
+    LexiconSyllable m_walk_syllables[MAX_PHRASE_LEN];
+    guint m_walk_len;
+    Lexicon::Cursor m_walk_cursors[MAX_PHRASE_LEN];
+    Lexicon::Cursor *m_walk[MAX_PHRASE_LEN];
+
+    /* idle prepared statements, keyed by (length, kind) and shape */
+    typedef std::pair<guint, guint64> StmtKey;
+    typedef std::map<StmtKey, std::vector<SQLStmt *> > StmtCache;
+    StmtCache m_stmts;
+    guint m_stmt_hits;
+    guint m_stmt_misses;
 
     String m_sql;        /* sql stmt */
     String m_buffer;     /* temp buffer */
-    guint m_timeout_id;
-    GTimer *m_timer;
+
+    /* a change of user database, applied by the writer thread */
+    struct UserChange {
+        Phrase phrase;
+        gboolean remove;
+        String next;    /* if not empty, next is committed after phrase */
+    };
+
+    void changeSql (const UserChange & change, String & sql);
+    void changeLog (const UserChange & change, String & log);
+    static gboolean parseChange (const gchar *line, UserChange & change);
+
+    GThread *m_reader;          /* runs posted requests */
+    GAsyncQueue *m_requests;
+    GThread *m_writer;
+    GAsyncQueue *m_changes;     /* queued UserChange for the writer */
+    std::deque<UserChange> m_pending;   /* changes learned before userdb */
+    volatile gint m_userdb_ready;   /* userdb is installed in m_db */
+    GTimer *m_timer;            /* time to the first candidates */
+
+    /* used by the writer thread after open */
+    sqlite3 *m_writer_db;       /* the snapshot of userdb, attached */
+    FILE *m_log;                /* changes after the snapshot */
+    guint m_log_changes;
+    String m_log_id;            /* matches log-id of the snapshot */
 
 private:
     static std::unique_ptr<Database> m_instance;
+
+    friend class SQLStmtRecycler;
 };
 
 
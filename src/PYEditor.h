@@ -61,6 +61,12 @@ public:
         m_cursor = cursor;
     }
 
+    /* The candidates are queried, the keys reading them wait until
+     * signalCandidatesReady */
+    virtual gboolean candidatesPending (void) const { return FALSE; }
+    /* the key selects, pages or commits the candidates */
+    virtual gboolean keyReadsCandidates (guint keyval, guint modifiers) { return FALSE; }
+
     /* signals */
     signal <void (Text &)> & signalCommitText (void)    { return m_signal_commit_text; }
 
@@ -81,6 +87,8 @@ public:
     signal <void ()> & signalShowLookupTable (void)     { return m_signal_show_lookup_table; }
     signal <void ()> & signalHideLookupTable (void)     { return m_signal_hide_lookup_table; }
 
+    signal <void ()> & signalCandidatesReady (void)     { return m_signal_candidates_ready; }
+
 protected:
     /* methods */
     void commitText (Text & text) const
@@ -138,6 +146,11 @@ protected:
         m_signal_hide_lookup_table ();
     }
 
+    void candidatesReady (void) const
+    {
+        m_signal_candidates_ready ();
+    }
+
 protected:
     /* signals */
     signal <void (Text &)> m_signal_commit_text;
@@ -151,6 +164,7 @@ protected:
     signal <void (LookupTable &, gboolean)> m_signal_update_lookup_table_fast;
     signal <void ()> m_signal_show_lookup_table;
     signal <void ()> m_signal_hide_lookup_table;
+    signal <void ()> m_signal_candidates_ready;
 
 protected:
     String m_text;
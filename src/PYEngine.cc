@@ -179,7 +179,12 @@ ibus_pinyin_engine_process_key_event (IBusEngine     *engine,
                                       guint           modifiers)
 {
     IBusPinyinEngine *pinyin = (IBusPinyinEngine *) engine;
-    return pinyin->engine->processKeyEvent (keyval, keycode, modifiers);
+    if (pinyin->engine->deferInput (Engine::INPUT_KEY_EVENT, keyval, keycode, modifiers))
+        return TRUE;
+    pinyin->engine->beginFrame ();
+    gboolean retval = pinyin->engine->processKeyEvent (keyval, keycode, modifiers);
+    pinyin->engine->endFrame ();
+    return retval;
 }
 
 static void
@@ -188,7 +193,9 @@ ibus_pinyin_engine_property_activate (IBusEngine    *engine,
                                       guint          prop_state)
 {
     IBusPinyinEngine *pinyin = (IBusPinyinEngine *) engine;
+    pinyin->engine->beginFrame ();
     pinyin->engine->propertyActivate (prop_name, prop_state);
+    pinyin->engine->endFrame ();
 }
 static void
 ibus_pinyin_engine_candidate_clicked (IBusEngine *engine,
@@ -197,31 +204,222 @@ ibus_pinyin_engine_candidate_clicked (IBusEngine *engine,
                                       guint       state)
 {
     IBusPinyinEngine *pinyin = (IBusPinyinEngine *) engine;
+    if (pinyin->engine->deferInput (Engine::INPUT_CANDIDATE_CLICKED, index, button, state))
+        return;
+    pinyin->engine->beginFrame ();
     pinyin->engine->candidateClicked (index, button, state);
+    pinyin->engine->endFrame ();
 }
 
-#define FUNCTION(name, Name)                                        \
+/* the inputs waiting are dropped with what was sent, and the actions
+ * of the panel wait with them */
+#define FUNCTION(name, Name, forget, input)                         \
     static void                                                     \
     ibus_pinyin_engine_##name (IBusEngine *engine)                  \
     {                                                               \
         IBusPinyinEngine *pinyin = (IBusPinyinEngine *) engine;     \
-        pinyin->engine->Name ();                                    \
+        if (forget)                                                 \
+            pinyin->engine->dropDeferred ();                        \
+        if (input < 0 || !pinyin->engine->deferInput (input)) {     \
+            pinyin->engine->beginFrame ();                          \
+            pinyin->engine->Name ();                                \
+            pinyin->engine->endFrame ();                            \
+        }                                                           \
+        if (forget)                                                 \
+            pinyin->engine->forgetSent ();                          \
         ((IBusEngineClass *) ibus_pinyin_engine_parent_class)       \
             ->name (engine);                                        \
     }
-FUNCTION(focus_in,    focusIn)
-FUNCTION(focus_out,   focusOut)
-FUNCTION(reset,       reset)
-FUNCTION(enable,      enable)
-FUNCTION(disable,     disable)
-FUNCTION(page_up,     pageUp)
-FUNCTION(page_down,   pageDown)
-FUNCTION(cursor_up,   cursorUp)
-FUNCTION(cursor_down, cursorDown)
+FUNCTION(focus_in,    focusIn,    FALSE, -1)
+FUNCTION(focus_out,   focusOut,   TRUE,  -1)
+FUNCTION(reset,       reset,      TRUE,  -1)
+FUNCTION(enable,      enable,     FALSE, -1)
+FUNCTION(disable,     disable,    TRUE,  -1)
+FUNCTION(page_up,     pageUp,     FALSE, Engine::INPUT_PAGE_UP)
+FUNCTION(page_down,   pageDown,   FALSE, Engine::INPUT_PAGE_DOWN)
+FUNCTION(cursor_up,   cursorUp,   FALSE, Engine::INPUT_CURSOR_UP)
+FUNCTION(cursor_down, cursorDown, FALSE, Engine::INPUT_CURSOR_DOWN)
 #undef FUNCTION
 
 Engine::~Engine (void)
 {
+    g_debug ("lookup table: %u updates skipped", m_lookup_skipped);
+}
+
+static gboolean
+text_equal (IBusText *a, IBusText *b)
+{
+    if (a == b)
+        return TRUE;
+    if (a == NULL || b == NULL || std::strcmp (a->text, b->text) != 0)
+        return FALSE;
+
+    for (guint i = 0; ; i++) {
+        IBusAttribute *x = a->attrs ? ibus_attr_list_get (a->attrs, i) : NULL;
+        IBusAttribute *y = b->attrs ? ibus_attr_list_get (b->attrs, i) : NULL;
+        if (x == NULL || y == NULL)
+            return x == y;
+        if (x->type != y->type || x->value != y->value ||
+            x->start_index != y->start_index || x->end_index != y->end_index)
+            return FALSE;
+    }
+}
+
+void
+Engine::endFrame (void)
+{
+    g_assert (m_frame > 0);
+    if (--m_frame == 0)
+        flushFrame ();
+}
+
+void
+Engine::forgetSent (void)
+{
+    m_preedit_sent = TextState ();
+    m_aux_sent = TextState ();
+    m_lookup_sent = LookupState ();
+}
+
+inline gboolean
+Engine::inputWaits (const Input & input)
+{
+    if (!editor ().candidatesPending ())
+        return FALSE;
+    if (input.type != INPUT_KEY_EVENT)
+        return TRUE;
+    /* release events never reach the editors */
+    return (input.arg3 & IBUS_RELEASE_MASK) == 0 &&
+           editor ().keyReadsCandidates (input.arg1, input.arg3);
+}
+
+gboolean
+Engine::deferInput (guint type, guint arg1, guint arg2, guint arg3)
+{
+    Input input = { type, arg1, arg2, arg3 };
+
+    /* the editor may have been reset since */
+    if (G_UNLIKELY (!m_deferred.empty ()))
+        processDeferred ();
+
+    if (G_LIKELY (m_deferred.empty () && !inputWaits (input)))
+        return FALSE;
+
+    m_deferred.push_back (input);
+    return TRUE;
+}
+
+void
+Engine::processDeferred (void)
+{
+    /* an input processed below may let the editor have the candidates */
+    if (m_replaying)
+        return;
+
+    m_replaying = TRUE;
+    beginFrame ();
+    while (!m_deferred.empty () && !inputWaits (m_deferred.front ())) {
+        Input input = m_deferred.front ();
+        m_deferred.pop_front ();
+        switch (input.type) {
+        case INPUT_KEY_EVENT:
+            if (!processKeyEvent (input.arg1, input.arg2, input.arg3))
+                ibus_engine_forward_key_event (m_engine, input.arg1, input.arg2, input.arg3);
+            break;
+        case INPUT_PAGE_UP:
+            pageUp ();
+            break;
+        case INPUT_PAGE_DOWN:
+            pageDown ();
+            break;
+        case INPUT_CURSOR_UP:
+            cursorUp ();
+            break;
+        case INPUT_CURSOR_DOWN:
+            cursorDown ();
+            break;
+        case INPUT_CANDIDATE_CLICKED:
+            candidateClicked (input.arg1, input.arg2, input.arg3);
+            break;
+        }
+    }
+    endFrame ();
+    m_replaying = FALSE;
+}
+
+void
+Engine::flushFrame (void)
+{
+    /* A part is updated if it changed, or only shown or hidden if its
+     * visibility changed. Lookup table is compared by the fingerprint of
+     * its current page, which is all a panel shows */
+    if (m_preedit.update == UPDATE_FULL &&
+        (m_preedit_sent.update != UPDATE_FULL ||
+         m_preedit.cursor != m_preedit_sent.cursor ||
+         !text_equal (m_preedit.text, m_preedit_sent.text))) {
+        ibus_engine_update_preedit_text (m_engine, m_preedit.text,
+                                         m_preedit.cursor, m_preedit.visible);
+        m_preedit_sent = m_preedit;
+    }
+    else if (m_preedit.update != UPDATE_NONE &&
+             (m_preedit_sent.update == UPDATE_NONE ||
+              m_preedit.visible != m_preedit_sent.visible)) {
+        if (m_preedit.visible)
+            ibus_engine_show_preedit_text (m_engine);
+        else
+            ibus_engine_hide_preedit_text (m_engine);
+        m_preedit_sent.visible = m_preedit.visible;
+        m_preedit_sent.update = MAX (m_preedit_sent.update, (guint) UPDATE_VISIBLE);
+    }
+    m_preedit.update = UPDATE_NONE;
+
+    if (m_aux.update == UPDATE_FULL &&
+        (m_aux_sent.update != UPDATE_FULL ||
+         !text_equal (m_aux.text, m_aux_sent.text))) {
+        ibus_engine_update_auxiliary_text (m_engine, m_aux.text, m_aux.visible);
+        m_aux_sent = m_aux;
+    }
+    else if (m_aux.update != UPDATE_NONE &&
+             (m_aux_sent.update == UPDATE_NONE ||
+              m_aux.visible != m_aux_sent.visible)) {
+        if (m_aux.visible)
+            ibus_engine_show_auxiliary_text (m_engine);
+        else
+            ibus_engine_hide_auxiliary_text (m_engine);
+        m_aux_sent.visible = m_aux.visible;
+        m_aux_sent.update = MAX (m_aux_sent.update, (guint) UPDATE_VISIBLE);
+    }
+    m_aux.update = UPDATE_NONE;
+
+    if (m_lookup.update >= UPDATE_FAST) {
+        guint64 fingerprint = LookupTable::pageFingerprint (m_lookup.table);
+        if (m_lookup_sent.update == UPDATE_FULL &&
+            m_lookup_sent.fingerprint == fingerprint) {
+            /* the panel has the page, only the visibility may change */
+            m_lookup_skipped ++;
+            m_lookup.update = UPDATE_VISIBLE;
+        }
+        else {
+            if (m_lookup.update == UPDATE_FULL)
+                ibus_engine_update_lookup_table (m_engine, m_lookup.table, m_lookup.visible);
+            else
+                ibus_engine_update_lookup_table_fast (m_engine, m_lookup.table, m_lookup.visible);
+            m_lookup_sent.visible = m_lookup.visible;
+            m_lookup_sent.update = UPDATE_FULL;
+            m_lookup_sent.fingerprint = fingerprint;
+        }
+    }
+    if (m_lookup.update == UPDATE_VISIBLE &&
+        (m_lookup_sent.update == UPDATE_NONE ||
+         m_lookup.visible != m_lookup_sent.visible)) {
+        if (m_lookup.visible)
+            ibus_engine_show_lookup_table (m_engine);
+        else
+            ibus_engine_hide_lookup_table (m_engine);
+        m_lookup_sent.visible = m_lookup.visible;
+        m_lookup_sent.update = MAX (m_lookup_sent.update, (guint) UPDATE_VISIBLE);
+    }
+    m_lookup.update = UPDATE_NONE;
 }
 
 };
@@ -21,6 +21,7 @@
 #ifndef __PY_ENGINE_H_
 #define __PY_ENGINE_H_
 
+#include <deque>
 #include <ibus.h>
 
 #include "PYPointer.h"
@@ -37,7 +38,8 @@ GType   ibus_pinyin_engine_get_type    (void);
 
 class Engine {
 public:
-    Engine (IBusEngine *engine) : m_engine (engine) { }
+    Engine (IBusEngine *engine)
+        : m_engine (engine), m_frame (0), m_lookup_skipped (0), m_replaying (FALSE) { }
     virtual ~Engine (void);
 
     // virtual functions
@@ -54,60 +56,115 @@ public:
     virtual gboolean propertyActivate (const gchar *prop_name, guint prop_state) = 0;
     virtual void candidateClicked (guint index, guint button, guint state) = 0;
 
+    /* Updates of preedit, auxiliary text and lookup table between
+     * beginFrame and endFrame are merged, and sent to ibus once at the
+     * end. Parts which end as they were sent last time are skipped */
+    void beginFrame (void) { m_frame ++; }
+    void endFrame (void);
+    /* forgets what was sent, the panel may have been reset by ibus */
+    void forgetSent (void);
+
+    /* keys, and actions of the panel on the candidates */
+    enum {
+        INPUT_KEY_EVENT,            // keyval, keycode, modifiers
+        INPUT_PAGE_UP,
+        INPUT_PAGE_DOWN,
+        INPUT_CURSOR_UP,
+        INPUT_CURSOR_DOWN,
+        INPUT_CANDIDATE_CLICKED,    // index, button, state
+    };
+
+    /* An input reading the candidates the editor still queries waits,
+     * with the inputs after it, until they are back. Returns TRUE if the
+     * input is kept, and FALSE if it is to be processed now */
+    gboolean deferInput (guint type, guint arg1 = 0, guint arg2 = 0, guint arg3 = 0);
+    /* drops the inputs waiting, as the editors are reset */
+    void dropDeferred (void) { m_deferred.clear (); }
+
 protected:
-    void commitText (Text & text) const
+    /* the updates so far in the frame are sent first, to keep them in
+     * order with the commit */
+    void commitText (Text & text)
     {
+        flushFrame ();
         ibus_engine_commit_text (m_engine, text);
     }
 
-    void updatePreeditText (Text & text, guint cursor, gboolean visible) const
+    /* the text is copied, as it may be sent after the editor reused its
+     * buffer */
+    void updatePreeditText (Text & text, guint cursor, gboolean visible)
     {
-        ibus_engine_update_preedit_text (m_engine, text, cursor, visible);
+        m_preedit.text = text.copy ();
+        m_preedit.cursor = cursor;
+        m_preedit.visible = visible;
+        m_preedit.update = UPDATE_FULL;
+        flush ();
     }
 
-    void showPreeditText (void) const
+    void showPreeditText (void)
     {
-        ibus_engine_show_preedit_text (m_engine);
+        m_preedit.visible = TRUE;
+        m_preedit.update = MAX (m_preedit.update, (guint) UPDATE_VISIBLE);
+        flush ();
     }
 
-    void hidePreeditText (void) const
+    void hidePreeditText (void)
     {
-        ibus_engine_hide_preedit_text (m_engine);
+        m_preedit.visible = FALSE;
+        m_preedit.update = MAX (m_preedit.update, (guint) UPDATE_VISIBLE);
+        flush ();
     }
 
-    void updateAuxiliaryText (Text & text, gboolean visible) const
+    void updateAuxiliaryText (Text & text, gboolean visible)
     {
-        ibus_engine_update_auxiliary_text (m_engine, text, visible);
+        m_aux.text = text.copy ();
+        m_aux.visible = visible;
+        m_aux.update = UPDATE_FULL;
+        flush ();
     }
 
-    void showAuxiliaryText (void) const
+    void showAuxiliaryText (void)
     {
-        ibus_engine_show_auxiliary_text (m_engine);
+        m_aux.visible = TRUE;
+        m_aux.update = MAX (m_aux.update, (guint) UPDATE_VISIBLE);
+        flush ();
     }
 
-    void hideAuxiliaryText (void) const
+    void hideAuxiliaryText (void)
     {
-        ibus_engine_hide_auxiliary_text (m_engine);
+        m_aux.visible = FALSE;
+        m_aux.update = MAX (m_aux.update, (guint) UPDATE_VISIBLE);
+        flush ();
     }
 
-    void updateLookupTable (LookupTable &table, gboolean visible) const
+    void updateLookupTable (LookupTable &table, gboolean visible)
     {
-        ibus_engine_update_lookup_table (m_engine, table, visible);
+        m_lookup.table = table;
+        m_lookup.visible = visible;
+        m_lookup.update = UPDATE_FULL;
+        flush ();
     }
 
-    void updateLookupTableFast (LookupTable &table, gboolean visible) const
+    void updateLookupTableFast (LookupTable &table, gboolean visible)
     {
-        ibus_engine_update_lookup_table_fast (m_engine, table, visible);
+        m_lookup.table = table;
+        m_lookup.visible = visible;
+        m_lookup.update = MAX (m_lookup.update, (guint) UPDATE_FAST);
+        flush ();
     }
 
-    void showLookupTable (void) const
+    void showLookupTable (void)
     {
-        ibus_engine_show_lookup_table (m_engine);
+        m_lookup.visible = TRUE;
+        m_lookup.update = MAX (m_lookup.update, (guint) UPDATE_VISIBLE);
+        flush ();
     }
 
-    void hideLookupTable (void) const
+    void hideLookupTable (void)
     {
-        ibus_engine_hide_lookup_table (m_engine);
+        m_lookup.visible = FALSE;
+        m_lookup.update = MAX (m_lookup.update, (guint) UPDATE_VISIBLE);
+        flush ();
     }
 
     void registerProperties (PropList & props) const
@@ -120,8 +177,71 @@ protected:
         ibus_engine_update_property (m_engine, prop);
     }
 
+    /* the editor taking the inputs now */
+    virtual Editor & editor (void) = 0;
+    /* processes the inputs waiting, up to one which still has to wait.
+     * Keys not taken by the editors are forwarded to the application */
+    void processDeferred (void);
+
+private:
+    enum {
+        UPDATE_NONE,
+        UPDATE_VISIBLE, /* shown or hidden */
+        UPDATE_FAST,    /* only the current page of lookup table */
+        UPDATE_FULL,
+    };
+
+    /* A part of the panel as editors want it, or as it was sent. update
+     * is what was changed in the frame for the former, and what ibus is
+     * known to have for the latter */
+    struct TextState {
+        Pointer<IBusText> text;
+        guint cursor;
+        gboolean visible;
+        guint update;
+
+        TextState (void) : cursor (0), visible (FALSE), update (UPDATE_NONE) { }
+    };
+
+    struct LookupState {
+        Pointer<IBusLookupTable> table;
+        gboolean visible;
+        guint update;
+        guint64 fingerprint;    /* of the page, if it was sent */
+
+        LookupState (void) : visible (FALSE), update (UPDATE_NONE), fingerprint (0) { }
+    };
+
+    struct Input {
+        guint type;
+        guint arg1;
+        guint arg2;
+        guint arg3;
+    };
+
+    gboolean inputWaits (const Input & input);
+
+    void flush (void)
+    {
+        if (m_frame == 0)
+            flushFrame ();
+    }
+    void flushFrame (void);
+
 protected:
     Pointer<IBusEngine>  m_engine;      // engine pointer
+
+private:
+    guint       m_frame;                // depth of nested frames
+    TextState   m_preedit;              // wanted by editors
+    TextState   m_preedit_sent;
+    TextState   m_aux;
+    TextState   m_aux_sent;
+    LookupState m_lookup;
+    LookupState m_lookup_sent;
+    guint       m_lookup_skipped;       // updates not sent, the page was not changed
+    std::deque<Input> m_deferred;       // inputs waiting for the candidates
+    gboolean    m_replaying;            // in processDeferred
 };
 
 };
@@ -23,8 +23,12 @@
 
 namespace PY {
 
+/* other syllables taken at each position of the lattice */
+#define LATTICE_BRANCH  (2)
+
 FullPinyinEditor::FullPinyinEditor (PinyinProperties & props, Config & config)
-    : PinyinEditor (props, config)
+    : PinyinEditor (props, config),
+      m_option (0)
 {
 }
 
@@ -49,11 +53,11 @@ FullPinyinEditor::insert (gint ch)
 
     if (G_UNLIKELY (!(m_config.option () & PINYIN_INCOMPLETE_PINYIN))) {
         updateSpecialPhrases ();
-        updatePinyin ();
+        updatePinyin (m_cursor - 1);
     }
     else if (G_LIKELY (m_cursor <= m_pinyin_len + 2)) {
         updateSpecialPhrases ();
-        updatePinyin ();
+        updatePinyin (m_cursor - 1);
     }
     else {
         if (updateSpecialPhrases ()) {
@@ -77,7 +81,7 @@ FullPinyinEditor::removeCharBefore (void)
     m_text.erase (m_cursor, 1);
 
     updateSpecialPhrases ();
-    updatePinyin ();
+    updatePinyin (m_cursor);
 
     return TRUE;
 }
@@ -116,6 +120,7 @@ FullPinyinEditor::removeWordBefore (void)
     m_text.erase (cursor, m_cursor - cursor);
     m_cursor = cursor;
     updateSpecialPhrases ();
+    updateLattice ();
     updatePhraseEditor ();
     update ();
     return TRUE;
@@ -141,7 +146,7 @@ FullPinyinEditor::moveCursorLeft (void)
 
     m_cursor --;
     updateSpecialPhrases ();
-    updatePinyin ();
+    updatePinyin (m_cursor);
 
     return TRUE;
 }
@@ -155,7 +160,7 @@ FullPinyinEditor::moveCursorRight (void)
     m_cursor ++;
 
     updateSpecialPhrases ();
-    updatePinyin ();
+    updatePinyin (m_cursor - 1);
 
     return TRUE;
 }
@@ -177,6 +182,7 @@ FullPinyinEditor::moveCursorLeftByWord (void)
     m_pinyin.pop_back ();
 
     updateSpecialPhrases ();
+    updateLattice ();
     updatePhraseEditor ();
     update ();
 
@@ -197,6 +203,7 @@ FullPinyinEditor::moveCursorToBegin (void)
 
     m_cursor = 0;
     m_pinyin.clear ();
+    m_lattice.clear ();
     m_pinyin_len = 0;
 
     updateSpecialPhrases ();
@@ -212,30 +219,54 @@ FullPinyinEditor::moveCursorToEnd (void)
     if (G_UNLIKELY (m_cursor == m_text.length ()))
         return FALSE;
 
+    guint edit_pos = m_cursor;
     m_cursor = m_text.length ();
     updateSpecialPhrases ();
-    updatePinyin ();
+    updatePinyin (edit_pos);
 
     return TRUE;
 }
 
 void
 FullPinyinEditor::updatePinyin (void)
+{
+    updatePinyin (0);
+}
+
+/* The text before edit_pos is not changed since m_pinyin was parsed, so
+ * only the segments after it need to be parsed again. Moving the cursor
+ * counts as an edit at the smaller of the old and new cursor. */
+void
+FullPinyinEditor::updatePinyin (guint edit_pos)
 {
     if (G_UNLIKELY (m_text.empty ())) {
         m_pinyin.clear ();
         m_pinyin_len = 0;
     }
     else {
-        m_pinyin_len = PinyinParser::parse (m_text,              // text
-                                            m_cursor,            // text length
-                                            m_config.option (),   // option
-                                            m_pinyin,            // result
-                                            MAX_PHRASE_LEN);     // max result length
+        /* segments are parsed at most to m_pinyin_len */
+        edit_pos = MIN (edit_pos, m_pinyin_len);
+        if (G_UNLIKELY (m_option != m_config.option ())) {
+            m_option = m_config.option ();
+            edit_pos = 0;
+        }
+        m_pinyin_len = PinyinParser::reparse (m_text,           // text
+                                              m_cursor,         // text length
+                                              m_option,         // option
+                                              m_pinyin,         // result
+                                              MAX_PHRASE_LEN,   // max result length
+                                              edit_pos);        // begin of the change
     }
 
+    updateLattice ();
     updatePhraseEditor ();
     update ();
 }
 
+void
+FullPinyinEditor::updateLattice (void)
+{
+    PinyinParser::parseLattice (m_text, m_pinyin, m_option, m_lattice, LATTICE_BRANCH);
+}
+
 };
@@ -56,7 +56,12 @@ protected:
     gboolean moveCursorToEnd (void);
 
     void updatePinyin (void);
+    void updatePinyin (guint edit_pos);
+    /* finds the other segmentations of the text of m_pinyin */
+    void updateLattice (void);
 
+private:
+    guint m_option;     /* option of the last parsing */
 };
 
 };
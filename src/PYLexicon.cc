@@ -0,0 +1,387 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+#include "PYLexicon.h"
+#include <algorithm>
+#include <cstring>
+
+namespace PY {
+
+#define LEXICON_MAGIC       "PYLX"
+#define LEXICON_VERSION     (2)
+
+/* The layout must match data/create_lexicon.py. The file is written in
+ * little endian, so a big endian host fails the version check and falls
+ * back to sqlite. */
+struct LexiconHeader {
+    gchar magic[4];
+    guint32 version;
+    guint32 n_nodes;
+    guint32 n_records;
+    guint32 nodes;
+    guint32 records;
+    guint32 strings;
+    guint32 strings_size;
+};
+
+struct Lexicon::Node {
+    guint8 sheng;
+    guint8 yun;
+    guint16 n_children;
+    guint32 children;
+    guint32 records;
+    guint32 n_records;
+};
+
+struct Lexicon::Record {
+    guint32 text;
+    guint32 trad;       /* the same as text if it is not changed */
+    guint32 freq;
+};
+
+Lexicon::Lexicon (void)
+    : m_file (NULL),
+      m_nodes (NULL),
+      m_n_nodes (0),
+      m_records (NULL),
+      m_n_records (0),
+      m_strings (NULL),
+      m_strings_size (0)
+{
+}
+
+Lexicon::~Lexicon (void)
+{
+    unload ();
+}
+
+gboolean
+Lexicon::load (const gchar *filename)
+{
+    unload ();
+
+    GError *error = NULL;
+    GMappedFile *file = g_mapped_file_new (filename, FALSE, &error);
+    if (file == NULL) {
+        g_error_free (error);
+        return FALSE;
+    }
+
+    const gchar *data = g_mapped_file_get_contents (file);
+    gsize size = g_mapped_file_get_length (file);
+    const LexiconHeader *header = (const LexiconHeader *) data;
+
+    if (size < sizeof (LexiconHeader) ||
+        std::memcmp (header->magic, LEXICON_MAGIC, 4) != 0 ||
+        header->version != LEXICON_VERSION ||
+        header->n_nodes == 0 ||
+        header->nodes % 4 != 0 || header->records % 4 != 0 ||
+        header->nodes + (gsize) header->n_nodes * sizeof (Node) > size ||
+        header->records + (gsize) header->n_records * sizeof (Record) > size ||
+        header->strings_size == 0 ||
+        header->strings + (gsize) header->strings_size > size ||
+        data[header->strings + header->strings_size - 1] != '\0') {
+        g_warning ("invalid lexicon file %s", filename);
+        g_mapped_file_unref (file);
+        return FALSE;
+    }
+
+    m_file = file;
+    m_nodes = (const Node *) (data + header->nodes);
+    m_n_nodes = header->n_nodes;
+    m_records = (const Record *) (data + header->records);
+    m_n_records = header->n_records;
+    m_strings = data + header->strings;
+    m_strings_size = header->strings_size;
+
+    return TRUE;
+}
+
+void
+Lexicon::unload (void)
+{
+    if (m_file == NULL)
+        return;
+    g_mapped_file_unref (m_file);
+    m_file = NULL;
+    m_nodes = NULL;
+    m_n_nodes = 0;
+    m_records = NULL;
+    m_n_records = 0;
+    m_strings = NULL;
+    m_strings_size = 0;
+}
+
+/* first child of node not less than (sheng, yun) */
+inline const Lexicon::Node *
+Lexicon::findChild (const Node *node, guint sheng, guint yun) const
+{
+    const Node *first = m_nodes + node->children;
+    guint count = node->n_children;
+
+    while (count > 0) {
+        guint half = count >> 1;
+        const Node *middle = first + half;
+        if (middle->sheng < sheng ||
+            (middle->sheng == sheng && middle->yun < yun)) {
+            first = middle + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return first;
+}
+
+/* child itself or the first child after it accepted by syllable, the
+ * first one of node if child is NULL */
+inline const Lexicon::Node *
+Lexicon::nextChild (const Node               *node,
+                    const Node               *child,
+                    const LexiconSyllable    &syllable) const
+{
+    const Node *end = m_nodes + node->children + node->n_children;
+
+    /* Children are sorted by (sheng, yun), and fuzzy ids are next to each
+     * other mostly, so one search finds a run of accepted children */
+    if (child == NULL)
+        child = findChild (node, g_bit_nth_lsf (syllable.sheng_mask, -1), 0);
+    while (child < end) {
+        if (!syllable.acceptsSheng (child->sheng)) {
+            gint sheng = child->sheng < 32 ? g_bit_nth_lsf (syllable.sheng_mask, child->sheng) : -1;
+            if (sheng < 0)
+                break;
+            child = findChild (node, sheng, 0);
+            continue;
+        }
+        if (syllable.acceptsYun (child->yun))
+            return child;
+        child++;
+    }
+    return end;
+}
+
+void
+Lexicon::walk (const Node              *node,
+               const LexiconSyllable   *syllables,
+               guint                    depth,
+               guint                    len,
+               Cursor::Run            & run,
+               Cursor                 **cursors) const
+{
+    /* node is matched by syllables[0..depth) */
+    if (depth > 0 && cursors[depth - 1] != NULL &&
+        node->n_records > 0 &&
+        G_LIKELY (node->records + (gsize) node->n_records <= m_n_records)) {
+        run.record = node->records;
+        run.end = node->records + node->n_records;
+        run.len = depth;
+        cursors[depth - 1]->m_runs.push_back (run);
+    }
+
+    if (depth == len)
+        return;
+
+    const LexiconSyllable & syllable = syllables[depth];
+    const Node *end = m_nodes + node->children + node->n_children;
+
+    if (G_UNLIKELY (end > m_nodes + m_n_nodes))
+        return;
+
+    for (const Node *child = nextChild (node, NULL, syllable);
+         child < end;
+         child = nextChild (node, child + 1, syllable)) {
+        run.pinyin_id[depth].sheng = child->sheng;
+        run.pinyin_id[depth].yun = child->yun;
+        walk (child, syllables, depth + 1, len, run, cursors);
+    }
+}
+
+void
+Lexicon::walk (const Node              *node,
+               const LexiconArc        *arcs,
+               const guint             *first,
+               guint                    pos,
+               guint                    depth,
+               gboolean                 alternative,
+               Cursor::Run            & run,
+               Cursor                 **cursors) const
+{
+    /* node is matched by a path of depth arcs to pos */
+    if (alternative && cursors[pos] != NULL &&
+        node->n_records > 0 &&
+        G_LIKELY (node->records + (gsize) node->n_records <= m_n_records)) {
+        run.record = node->records;
+        run.end = node->records + node->n_records;
+        run.len = depth;
+        cursors[pos]->m_runs.push_back (run);
+    }
+
+    if (depth == MAX_PHRASE_LEN)
+        return;
+
+    const Node *end = m_nodes + node->children + node->n_children;
+
+    if (G_UNLIKELY (end > m_nodes + m_n_nodes))
+        return;
+
+    for (guint i = first[pos]; i < first[pos + 1]; i++) {
+        const LexiconArc & arc = arcs[i];
+        for (const Node *child = nextChild (node, NULL, arc.syllable);
+             child < end;
+             child = nextChild (node, child + 1, arc.syllable)) {
+            run.pinyin_id[depth].sheng = child->sheng;
+            run.pinyin_id[depth].yun = child->yun;
+            walk (child, arcs, first, arc.next, depth + 1,
+                  alternative || arc.alternative, run, cursors);
+        }
+    }
+}
+
+inline void
+Lexicon::start (Cursor **cursors, guint n) const
+{
+    for (guint i = 0; i < n; i++) {
+        if (cursors[i] == NULL)
+            continue;
+        cursors[i]->m_lexicon = this;
+        cursors[i]->m_runs.clear ();
+        cursors[i]->m_heap.clear ();
+    }
+}
+
+inline void
+Lexicon::finish (Cursor **cursors, guint n) const
+{
+    for (guint i = 0; i < n; i++) {
+        if (cursors[i] == NULL)
+            continue;
+        for (guint j = 0; j < cursors[i]->m_runs.size (); j++)
+            cursors[i]->push (j);
+    }
+}
+
+void
+Lexicon::query (const LexiconSyllable *syllables,
+                guint                  len,
+                Cursor               & cursor) const
+{
+    g_assert (len > 0 && len <= MAX_PHRASE_LEN);
+
+    Cursor *cursors[MAX_PHRASE_LEN] = { NULL };
+    cursors[len - 1] = &cursor;
+    query (syllables, len, cursors);
+}
+
+void
+Lexicon::query (const LexiconSyllable *syllables,
+                guint                  len,
+                Cursor               **cursors) const
+{
+    g_assert (len > 0 && len <= MAX_PHRASE_LEN);
+
+    start (cursors, len);
+    if (G_UNLIKELY (m_file == NULL))
+        return;
+
+    Cursor::Run run;
+    walk (m_nodes, syllables, 0, len, run, cursors);
+    finish (cursors, len);
+}
+
+void
+Lexicon::query (const LexiconArc   *arcs,
+                const guint        *first,
+                guint               n_nodes,
+                Cursor            **cursors) const
+{
+    start (cursors, n_nodes);
+    if (G_UNLIKELY (m_file == NULL))
+        return;
+
+    Cursor::Run run;
+    walk (m_nodes, arcs, first, 0, 0, FALSE, run, cursors);
+    finish (cursors, n_nodes);
+}
+
+/* Ties are taken in the order of the walk, as a stable sort of all
+ * matched records would do */
+inline gboolean
+Lexicon::Cursor::less (guint a, guint b) const
+{
+    guint32 freq_a = m_lexicon->m_records[m_runs[a].record].freq;
+    guint32 freq_b = m_lexicon->m_records[m_runs[b].record].freq;
+    if (freq_a != freq_b)
+        return freq_a < freq_b;
+    return a > b;
+}
+
+/* compares runs for the heap functions */
+struct Lexicon::Cursor::Less {
+    const Cursor *cursor;
+    bool operator () (guint a, guint b) const { return cursor->less (a, b); }
+};
+
+inline void
+Lexicon::Cursor::push (guint run)
+{
+    Less less = { this };
+    m_heap.push_back (run);
+    std::push_heap (m_heap.begin (), m_heap.end (), less);
+}
+
+inline guint
+Lexicon::Cursor::pop (void)
+{
+    Less less = { this };
+    std::pop_heap (m_heap.begin (), m_heap.end (), less);
+    guint run = m_heap.back ();
+    m_heap.pop_back ();
+    return run;
+}
+
+gboolean
+Lexicon::Cursor::next (Phrase & phrase)
+{
+    while (!m_heap.empty ()) {
+        guint i = pop ();
+        Run & run = m_runs[i];
+        const Record & record = m_lexicon->m_records[run.record++];
+        if (run.record < run.end)
+            push (i);
+
+        if (G_UNLIKELY (record.text >= m_lexicon->m_strings_size ||
+                        record.trad >= m_lexicon->m_strings_size))
+            continue;
+
+        g_strlcpy (phrase.phrase, m_lexicon->m_strings + record.text,
+                   sizeof (phrase.phrase));
+        phrase.trad = m_lexicon->m_strings + record.trad;
+        phrase.freq = record.freq;
+        phrase.user_freq = 0;
+        phrase.len = run.len;
+        std::copy (run.pinyin_id, run.pinyin_id + run.len, phrase.pinyin_id);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+};
@@ -0,0 +1,160 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+#ifndef __PY_LEXICON_H_
+#define __PY_LEXICON_H_
+
+#include <glib.h>
+#include <vector>
+#include "PYPhraseArray.h"
+
+namespace PY {
+
+/* ids accepted for one syllable of a query, the typed ids come first */
+struct LexiconSyllable {
+    guint8 sheng[3];
+    guint8 n_sheng;
+    guint8 yun[2];
+    guint8 n_yun;       /* 0 matches any yun */
+    guint32 sheng_mask; /* bit i is set if sheng i is accepted */
+    guint64 yun_mask;   /* bit i is set if yun i is accepted, 0 for any yun */
+
+    gboolean acceptsSheng (guint id) const
+    {
+        return id < 32 && ((sheng_mask >> id) & 1);
+    }
+
+    gboolean acceptsYun (guint id) const
+    {
+        return yun_mask == 0 || (id < 64 && ((yun_mask >> id) & 1));
+    }
+
+    gboolean accepts (guint id_sheng, guint id_yun) const
+    {
+        return acceptsSheng (id_sheng) && acceptsYun (id_yun);
+    }
+};
+
+/* an arc of a lattice of syllables, from the node it is listed for */
+struct LexiconArc {
+    LexiconSyllable syllable;
+    guint next;             /* the node at the end of the arc */
+    gboolean alternative;   /* it is not on the parsed path */
+};
+
+/* Read-only phrase trie compiled from main database by
+ * data/create_lexicon.py, and mapped into memory */
+class Lexicon {
+private:
+    struct Node;
+    struct Record;
+
+public:
+    /* Merges the sorted records of all matched nodes, so only the phrases
+     * taken are copied */
+    class Cursor {
+    public:
+        Cursor (void) : m_lexicon (NULL) {}
+
+        /* returns FALSE if there is no more phrase */
+        gboolean next (Phrase & phrase);
+
+    private:
+        struct Run {
+            guint32 record;
+            guint32 end;
+            guint len;
+            Phrase::PinyinId pinyin_id[MAX_PHRASE_LEN];
+        };
+
+        struct Less;
+
+        gboolean less (guint a, guint b) const;
+        void push (guint run);
+        guint pop (void);
+
+    private:
+        const Lexicon *m_lexicon;
+        std::vector<Run> m_runs;
+        std::vector<guint> m_heap;  /* runs ordered by freq of the heads */
+
+        friend class Lexicon;
+    };
+
+    Lexicon (void);
+    ~Lexicon (void);
+
+    gboolean load (const gchar *filename);
+    void unload (void);
+    gboolean loaded (void) const { return m_file != NULL; }
+
+    /* starts cursor on phrases matching syllables[0..len), it returns
+     * them in descending order of freq */
+    void query (const LexiconSyllable *syllables,
+                guint                  len,
+                Cursor               & cursor) const;
+    /* starts cursors[i] on phrases matching syllables[0..i] with one
+     * walk of the trie, NULL cursors are skipped */
+    void query (const LexiconSyllable *syllables,
+                guint                  len,
+                Cursor               **cursors) const;
+    /* starts cursors[i] on phrases along the paths from node 0 to node i
+     * which take an alternative arc, the arcs of node i are
+     * arcs[first[i]..first[i + 1]). NULL cursors are skipped */
+    void query (const LexiconArc   *arcs,
+                const guint        *first,
+                guint               n_nodes,
+                Cursor            **cursors) const;
+
+private:
+    const Node *findChild (const Node *node, guint sheng, guint yun) const;
+    const Node *nextChild (const Node               *node,
+                           const Node               *child,
+                           const LexiconSyllable    &syllable) const;
+    void start (Cursor **cursors, guint n) const;
+    void finish (Cursor **cursors, guint n) const;
+    void walk (const Node              *node,
+               const LexiconSyllable   *syllables,
+               guint                    depth,
+               guint                    len,
+               Cursor::Run            & run,
+               Cursor                 **cursors) const;
+    void walk (const Node              *node,
+               const LexiconArc        *arcs,
+               const guint             *first,
+               guint                    pos,
+               guint                    depth,
+               gboolean                 alternative,
+               Cursor::Run            & run,
+               Cursor                 **cursors) const;
+
+private:
+    GMappedFile *m_file;
+    const Node *m_nodes;
+    guint m_n_nodes;
+    const Record *m_records;
+    guint m_n_records;
+    const gchar *m_strings;
+    guint m_strings_size;
+};
+
+};
+
+#endif
@@ -27,6 +27,56 @@
 
 namespace PY {
 
+/* 64-bit FNV-1a of what makes a page of candidates, so a page can be
+ * compared with an earlier one without keeping it */
+class Fingerprint {
+public:
+    Fingerprint (void) : m_value (G_GUINT64_CONSTANT (0xcbf29ce484222325)) { }
+
+    void add (guint value)
+    {
+        for (guint i = 0; i < sizeof (value); i++)
+            addByte (value >> (i * 8));
+    }
+
+    void add (const gchar *str)
+    {
+        for (const guchar *p = (const guchar *) str; *p != 0; p++)
+            addByte (*p);
+        /* 0xff never shows up in utf-8, so it separates the strings */
+        addByte (0xff);
+    }
+
+    void add (IBusText *text)
+    {
+        if (text == NULL) {
+            addByte (0xff);
+            return;
+        }
+        add (text->text);
+        for (guint i = 0; text->attrs != NULL; i++) {
+            IBusAttribute *attr = ibus_attr_list_get (text->attrs, i);
+            if (attr == NULL)
+                break;
+            add (attr->type);
+            add (attr->value);
+            add (attr->start_index);
+            add (attr->end_index);
+        }
+        addByte (0xff);
+    }
+
+    guint64 value (void) const { return m_value; }
+
+private:
+    void addByte (guint8 byte)
+    {
+        m_value = (m_value ^ byte) * G_GUINT64_CONSTANT (0x100000001b3);
+    }
+
+    guint64 m_value;
+};
+
 class LookupTable : Object {
 public:
     LookupTable (guint page_size = 10,
@@ -39,6 +89,7 @@ public:
     guint orientation (void)    { return ibus_lookup_table_get_orientation (*this); }
     guint cursorPos (void)      { return ibus_lookup_table_get_cursor_pos (*this); }
     guint size (void)           { return ibus_lookup_table_get_number_of_candidates (*this); }
+    gboolean cursorVisible (void) { return ibus_lookup_table_is_cursor_visible (*this); }
 
     gboolean pageUp (void)      { return ibus_lookup_table_page_up (*this); }
     gboolean pageDown (void)    { return ibus_lookup_table_page_down (*this); }
@@ -55,6 +106,29 @@ public:
     void appendLabel (IBusText *text)       { ibus_lookup_table_append_label (*this, text); }
     IBusText * getCandidate(guint index)    { return ibus_lookup_table_get_candidate(*this, index); }
 
+    /* of the current page as a panel shows it */
+    static guint64 pageFingerprint (IBusLookupTable *table)
+    {
+        Fingerprint fingerprint;
+        guint n = ibus_lookup_table_get_number_of_candidates (table);
+        guint page_size = ibus_lookup_table_get_page_size (table);
+        guint cursor = ibus_lookup_table_get_cursor_pos (table);
+        guint begin = cursor / page_size * page_size;
+        guint end = MIN (begin + page_size, n);
+
+        fingerprint.add (page_size);
+        fingerprint.add (cursor);
+        fingerprint.add ((guint) ibus_lookup_table_get_orientation (table));
+        fingerprint.add ((guint) ibus_lookup_table_is_cursor_visible (table));
+        fingerprint.add ((guint) (begin > 0));
+        fingerprint.add ((guint) (end < n));
+        for (guint i = begin; i < end; i++) {
+            fingerprint.add (ibus_lookup_table_get_candidate (table, i));
+            fingerprint.add (ibus_lookup_table_get_label (table, i - begin));
+        }
+        return fingerprint.value ();
+    }
+
     operator IBusLookupTable * (void) const
     {
         return get<IBusLookupTable> ();
@@ -20,11 +20,15 @@
  */
 #include "PYPhoneticEditor.h"
 #include "PYConfig.h"
+#include "PYDatabase.h"
 #include "PYPinyinProperties.h"
 #include "PYSimpTradConverter.h"
 
 namespace PY {
 
+/* ms the panel is kept for, the candidates are often back by then */
+#define UPDATE_TIMEOUT  (100)
+
 /* init static members */
 PhoneticEditor::PhoneticEditor (PinyinProperties & props, Config & config)
     : Editor (props, config),
@@ -32,8 +36,21 @@ PhoneticEditor::PhoneticEditor (PinyinProperties & props, Config & config)
       m_pinyin_len (0),
       m_buffer (64),
       m_lookup_table (m_config.pageSize ()),
-      m_phrase_editor (props, config)
+      m_page_fingerprint (0),
+      m_pages_reused (0),
+      m_phrase_editor (props, config),
+      m_update (NULL),
+      m_update_version (0),
+      m_update_timer (0),
+      m_update_late (FALSE)
+{
+}
+
+PhoneticEditor::~PhoneticEditor (void)
 {
+    cancelUpdate ();
+
+    g_debug ("lookup table: %u first pages reused", m_pages_reused);
 }
 
 gboolean
@@ -74,6 +91,7 @@ PhoneticEditor::processFunctionKey (guint keyval, guint keycode, guint modifiers
 
         case IBUS_BackSpace:
             if (m_phrase_editor.unselectCandidates ()) {
+                updateCandidates ();
                 update ();
             }
             else {
@@ -89,6 +107,7 @@ PhoneticEditor::processFunctionKey (guint keyval, guint keycode, guint modifiers
         case IBUS_Left:
         case IBUS_KP_Left:
             if (m_phrase_editor.unselectCandidates ()) {
+                updateCandidates ();
                 update ();
             }
             else {
@@ -99,6 +118,7 @@ PhoneticEditor::processFunctionKey (guint keyval, guint keycode, guint modifiers
         case IBUS_Right:
         case IBUS_KP_Right:
             if (m_phrase_editor.unselectCandidates ()) {
+                updateCandidates ();
                 update ();
             }
             else {
@@ -109,6 +129,7 @@ PhoneticEditor::processFunctionKey (guint keyval, guint keycode, guint modifiers
         case IBUS_Home:
         case IBUS_KP_Home:
             if (m_phrase_editor.unselectCandidates ()) {
+                updateCandidates ();
                 update ();
             }
             else {
@@ -119,6 +140,7 @@ PhoneticEditor::processFunctionKey (guint keyval, guint keycode, guint modifiers
         case IBUS_End:
         case IBUS_KP_End:
             if (m_phrase_editor.unselectCandidates ()) {
+                updateCandidates ();
                 update ();
             }
             else {
@@ -158,6 +180,7 @@ PhoneticEditor::processFunctionKey (guint keyval, guint keycode, guint modifiers
         switch (keyval) {
         case IBUS_BackSpace:
             if (m_phrase_editor.unselectCandidates ()) {
+                updateCandidates ();
                 update ();
             }
             else {
@@ -173,6 +196,7 @@ PhoneticEditor::processFunctionKey (guint keyval, guint keycode, guint modifiers
         case IBUS_Left:
         case IBUS_KP_Left:
             if (m_phrase_editor.unselectCandidates ()) {
+                updateCandidates ();
                 update ();
             }
             else {
@@ -183,6 +207,7 @@ PhoneticEditor::processFunctionKey (guint keyval, guint keycode, guint modifiers
         case IBUS_Right:
         case IBUS_KP_Right:
             if (m_phrase_editor.unselectCandidates ()) {
+                updateCandidates ();
                 update ();
             }
             else {
@@ -233,12 +258,65 @@ PhoneticEditor::updateLookupTableFast (void)
     Editor::updateLookupTableFast (m_lookup_table, TRUE);
 }
 
+/* of the phrases fillLookupTableByPage would put on the first page, or
+ * 0 if fewer than a page of them are fetched */
+guint64
+PhoneticEditor::firstPageFingerprint (void)
+{
+    Fingerprint fingerprint;
+    guint page_size = m_lookup_table.pageSize ();
+
+    fingerprint.add (page_size);
+    fingerprint.add ((guint) m_props.modeSimp ());
+    if (!m_selected_special_phrase.empty ())
+        return fingerprint.value ();
+
+    if (m_special_phrases.size () + m_phrase_editor.candidates ().size () < page_size)
+        return 0;
+
+    for (guint i = 0; i < page_size; i++) {
+        if (i < m_special_phrases.size ()) {
+            fingerprint.add (m_special_phrases[i].c_str ());
+            fingerprint.add (0U);
+        }
+        else {
+            const Phrase & phrase = m_phrase_editor.candidate (i - m_special_phrases.size ());
+            fingerprint.add (phrase.phrase);
+            if (!m_props.modeSimp () && phrase.trad != NULL)
+                fingerprint.add (phrase.trad);
+            fingerprint.add (m_phrase_editor.candidateIsUserPhease (i - m_special_phrases.size ()) ? 2U : 1U);
+        }
+    }
+    return fingerprint.value ();
+}
+
 void
 PhoneticEditor::updateLookupTable (void)
 {
-    m_lookup_table.clear ();
+    /* it is hidden until the candidates are back, and may be taken again
+     * then */
+    if (G_UNLIKELY (candidatesPending ())) {
+        if (!panelKept () || m_text.empty ())
+            hideLookupTable ();
+        return;
+    }
+
+    /* Moving the cursor or typing after the pinyin often leaves the
+     * candidates as they are, then the filled page is taken again */
+    guint64 fingerprint = firstPageFingerprint ();
+    if (fingerprint == 0 ||
+        m_lookup_table.size () == 0 ||
+        m_lookup_table.size () > m_lookup_table.pageSize () ||
+        fingerprint != m_page_fingerprint) {
+        m_lookup_table.clear ();
+        fillLookupTableByPage ();
+        m_page_fingerprint = fingerprint;
+    }
+    else {
+        m_lookup_table.setCursorPos (0);
+        m_pages_reused ++;
+    }
 
-    fillLookupTableByPage ();
     if (m_lookup_table.size ()) {
         Editor::updateLookupTable (m_lookup_table, TRUE);
     }
@@ -257,8 +335,10 @@ PhoneticEditor::fillLookupTableByPage (void)
     guint filled_nr = m_lookup_table.size ();
     guint page_size = m_lookup_table.pageSize ();
 
-    if (m_special_phrases.size () + m_phrase_editor.candidates ().size () < filled_nr + page_size)
-        m_phrase_editor.fillCandidates ();
+    /* the rest are fetched in the query thread, see postFill () */
+    if (m_special_phrases.size () + m_phrase_editor.candidates ().size () < filled_nr + page_size &&
+        m_phrase_editor.query ().get () != NULL)
+        return FALSE;
 
     guint need_nr = MIN (page_size, m_special_phrases.size () + m_phrase_editor.candidates ().size () - filled_nr);
     g_assert (need_nr >= 0);
@@ -266,6 +346,16 @@ PhoneticEditor::fillLookupTableByPage (void)
         return FALSE;
     }
 
+    /* the phrases of the page are converted in one go */
+    guint special_nr = m_special_phrases.size ();
+    guint begin = MAX (filled_nr, special_nr) - special_nr;
+    guint end = MAX (filled_nr + need_nr, special_nr) - special_nr;
+    if (!m_props.modeSimp () && begin < end) {
+        m_buffer.truncate (0);
+        SimpTradConverter::simpToTrad (m_phrase_editor.candidates (), begin, end,
+                                       m_buffer, m_trad_offsets);
+    }
+
     for (guint i = filled_nr; i < filled_nr + need_nr; i++) {
         if (i < m_special_phrases.size ()) {
             Text text (m_special_phrases[i].c_str ());
@@ -280,9 +370,7 @@ PhoneticEditor::fillLookupTableByPage (void)
                 m_lookup_table.appendCandidate (text);
             }
             else {
-                m_buffer.truncate (0);
-                SimpTradConverter::simpToTrad (m_phrase_editor.candidate (i - m_special_phrases.size ()), m_buffer);
-                Text text (m_buffer);
+                Text text (m_buffer.c_str () + m_trad_offsets[i - special_nr - begin]);
                 if (m_phrase_editor.candidateIsUserPhease (i - m_special_phrases.size ()))
                     text.appendAttribute (IBUS_ATTR_TYPE_FOREGROUND, 0x000000ef, 0, -1);
                 m_lookup_table.appendCandidate (text);
@@ -314,6 +402,9 @@ PhoneticEditor::pageDown (void)
         updatePreeditText ();
         updateAuxiliaryText ();
     }
+    else {
+        postFill (&PhoneticEditor::pageDown);
+    }
 }
 
 void
@@ -332,6 +423,7 @@ PhoneticEditor::cursorDown (void)
     if (G_LIKELY (
             (m_lookup_table.cursorPos () == m_lookup_table.size () - 1) &&
             (fillLookupTableByPage () == FALSE))) {
+        postFill (&PhoneticEditor::cursorDown);
         return;
     }
 
@@ -345,13 +437,15 @@ PhoneticEditor::cursorDown (void)
 void
 PhoneticEditor::candidateClicked (guint index, guint button, guint state)
 {
-   selectCandidateInPage (index);
+    selectCandidateInPage (index);
 }
 
 void
 PhoneticEditor::reset (void)
 {
+    cancelUpdate ();
     m_pinyin.clear ();
+    m_lattice.clear ();
     m_pinyin_len = 0;
     m_lookup_table.clear ();
     m_phrase_editor.reset ();
@@ -369,6 +463,182 @@ PhoneticEditor::update (void)
     updateAuxiliaryText ();
 }
 
+/* work of the editor in the query thread */
+class PhoneticEditor::Request : public Database::Request {
+public:
+    Request (PhoneticEditor *editor)
+        : m_editor (editor),
+          m_version (editor->m_update_version) { }
+
+    guint version (void) const { return m_version; }
+
+    /* the editor does not want it any more */
+    void cancel (void) { m_editor = NULL; }
+
+    /* takes the results, in the main context */
+    virtual void finish (PhoneticEditor & editor) = 0;
+
+    virtual void done (void)
+    {
+        if (m_editor != NULL)
+            m_editor->requestDone (*this);
+    }
+
+private:
+    PhoneticEditor *m_editor;
+    guint m_version;
+};
+
+/* queries the candidates on a copy of the phrase editor */
+class PhoneticEditor::UpdateRequest : public PhoneticEditor::Request {
+public:
+    UpdateRequest (PhoneticEditor *editor)
+        : Request (editor),
+          m_phrase_editor (editor->m_phrase_editor) { }
+
+    virtual void run (void)
+    {
+        m_phrase_editor.queryCandidates ();
+    }
+
+    virtual void finish (PhoneticEditor & editor)
+    {
+        editor.m_phrase_editor.takeCandidates (m_phrase_editor);
+        editor.update ();
+    }
+
+private:
+    PhraseEditor m_phrase_editor;
+};
+
+/* fetches count candidates more from the query of the phrase editor */
+class PhoneticEditor::FillRequest : public PhoneticEditor::Request {
+public:
+    FillRequest (PhoneticEditor *editor, guint count,
+                 void (PhoneticEditor::*action) (void))
+        : Request (editor),
+          m_query (editor->m_phrase_editor.query ()),
+          m_count (count),
+          m_last (FALSE),
+          m_action (action) { }
+
+    virtual void run (void)
+    {
+        gint n = FILL_GRAN;
+        while (n == FILL_GRAN && m_phrases.size () < m_count)
+            n = m_query->fill (m_phrases, FILL_GRAN, &m_spans);
+        m_last = n < FILL_GRAN;
+    }
+
+    virtual void finish (PhoneticEditor & editor)
+    {
+        editor.m_phrase_editor.appendCandidates (m_phrases, m_spans, m_last);
+        (editor.*m_action) ();
+    }
+
+private:
+    std::shared_ptr<Query> m_query;
+    guint m_count;
+    PhraseArray m_phrases;
+    std::vector<guint> m_spans;
+    gboolean m_last;
+    void (PhoneticEditor::*m_action) (void);
+};
+
+void
+PhoneticEditor::updateCandidates (void)
+{
+    m_update_version ++;
+    /* one request is in flight at most, the candidates asked for
+     * meanwhile are queried when it is done */
+    if (m_update == NULL)
+        postUpdate ();
+
+    if (m_update != NULL && m_update_timer == 0 && !m_update_late)
+        m_update_timer = g_timeout_add (UPDATE_TIMEOUT, updateTimeout, this);
+}
+
+void
+PhoneticEditor::postUpdate (void)
+{
+    /* no candidate is left after the selected phrases */
+    if (!m_phrase_editor.pinyinExistsAfterCursor ())
+        return;
+
+    m_update = new UpdateRequest (this);
+    Database::instance ().post (m_update);
+}
+
+void
+PhoneticEditor::postFill (void (PhoneticEditor::*action) (void))
+{
+    if (m_update != NULL || m_phrase_editor.query ().get () == NULL ||
+        !m_selected_special_phrase.empty ())
+        return;
+
+    guint fetched = m_special_phrases.size () + m_phrase_editor.candidates ().size ();
+    guint count = m_lookup_table.size () + m_lookup_table.pageSize () - fetched;
+
+    m_update = new FillRequest (this, count, action);
+    Database::instance ().post (m_update);
+}
+
+void
+PhoneticEditor::cancelUpdate (void)
+{
+    if (m_update != NULL) {
+        m_update->cancel ();
+        m_update = NULL;
+    }
+    stopUpdateTimer ();
+}
+
+void
+PhoneticEditor::requestDone (Request & request)
+{
+    m_update = NULL;
+
+    /* the results for older candidates are dropped */
+    if (request.version () != m_update_version) {
+        postUpdate ();
+        if (m_update != NULL)
+            return;
+        /* no candidate is left to query */
+        stopUpdateTimer ();
+        update ();
+    }
+    else {
+        stopUpdateTimer ();
+        request.finish (*this);
+    }
+
+    /* the inputs kept by the engine are taken now */
+    if (m_update == NULL)
+        candidatesReady ();
+}
+
+void
+PhoneticEditor::stopUpdateTimer (void)
+{
+    if (m_update_timer != 0) {
+        g_source_remove (m_update_timer);
+        m_update_timer = 0;
+    }
+    m_update_late = FALSE;
+}
+
+/* the candidates are late, the typed text is shown */
+gboolean
+PhoneticEditor::updateTimeout (gpointer data)
+{
+    PhoneticEditor *editor = static_cast<PhoneticEditor *> (data);
+
+    editor->m_update_timer = 0;
+    editor->m_update_late = TRUE;
+    editor->update ();
+    return FALSE;
+}
+
 void
 PhoneticEditor::commit (const gchar *str)
 {
@@ -400,6 +670,7 @@ PhoneticEditor::selectCandidate (guint i)
     if (m_phrase_editor.selectCandidate (i)) {
         if (m_phrase_editor.pinyinExistsAfterCursor () ||
             *textAfterPinyin () != '\0') {
+            updateCandidates ();
             updateSpecialPhrases ();
             update ();
         }
@@ -429,6 +700,7 @@ PhoneticEditor::resetCandidate (guint i)
 {
     i -= m_special_phrases.size ();
     if (m_phrase_editor.resetCandidate (i)) {
+        updateCandidates ();
         update ();
     }
     return TRUE;
@@ -34,6 +34,7 @@ class SpecialPhraseTable;
 class PhoneticEditor : public Editor {
 public:
     PhoneticEditor (PinyinProperties & props, Config & config);
+    virtual ~PhoneticEditor ();
 
 public:
     /* virtual functions */
@@ -50,10 +51,12 @@ public:
     virtual void updateLookupTable ();
     virtual void updateLookupTableFast ();
     virtual gboolean fillLookupTableByPage ();
+    virtual gboolean candidatesPending () const { return m_update != NULL; }
 
 protected:
 
     gboolean updateSpecialPhrases ();
+    guint64 firstPageFingerprint ();
     gboolean selectCandidate (guint i);
     gboolean selectCandidateInPage (guint i);
     gboolean resetCandidate (guint i);
@@ -61,10 +64,22 @@ protected:
 
     void commit (const gchar *str);
 
+    /* The candidates of the phrase editor are queried in the query
+     * thread, and the panel is updated when they are back. Meanwhile the
+     * panel is kept as it is for a while, and then the typed text is
+     * shown, and the lookup table is hidden */
+    void updateCandidates ();
+
+    gboolean panelKept () const
+    {
+        return m_update_timer != 0;
+    }
+
     /* inline functions */
     void updatePhraseEditor ()
     {
-        m_phrase_editor.update (m_pinyin);
+        m_phrase_editor.setPinyin (m_pinyin, m_lattice);
+        updateCandidates ();
     }
 
     const gchar * textAfterPinyin () const
@@ -102,14 +117,39 @@ protected:
     virtual void updateAuxiliaryText (void) = 0;
     virtual void updatePreeditText (void) = 0;
 
+private:
+    class Request;
+    class UpdateRequest;
+    class FillRequest;
+
+    void postUpdate ();
+    /* fetches the candidates of the page after the table, then does
+     * action again */
+    void postFill (void (PhoneticEditor::*action) (void));
+    void cancelUpdate ();
+    void requestDone (Request & request);
+    void stopUpdateTimer ();
+    static gboolean updateTimeout (gpointer data);
+
+protected:
     /* varibles */
     PinyinArray                 m_pinyin;
+    PinyinLattice               m_lattice;  /* other segmentations of m_pinyin */
     guint                       m_pinyin_len;
     String                      m_buffer;
+    std::vector<guint>          m_trad_offsets;     /* of the converted page in m_buffer */
     LookupTable                 m_lookup_table;
+    guint64                     m_page_fingerprint; /* of the phrases filled on the first page */
+    guint                       m_pages_reused;     /* first pages found as they were filled */
     PhraseEditor                m_phrase_editor;
     std::vector<std::string>    m_special_phrases;
     std::string                 m_selected_special_phrase;
+
+private:
+    Request                    *m_update;           /* in the query thread */
+    guint                       m_update_version;   /* of the candidates asked for */
+    guint                       m_update_timer;     /* the panel is kept while it runs */
+    gboolean                    m_update_late;      /* the timer fired for m_update */
 };
 };
 
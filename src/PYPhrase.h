@@ -32,11 +32,12 @@ struct Phrase {
     gchar phrase[PHRASE_LEN_IN_BYTE];
     guint freq;
     guint user_freq;
-    struct {
+    struct PinyinId {
         guint8 sheng;
         guint8 yun;
     } pinyin_id[MAX_PHRASE_LEN];
     guint len;
+    const gchar *trad;  /* the traditional form in the lexicon, or NULL */
 
     void reset (void)
     {
@@ -44,6 +45,7 @@ struct Phrase {
         freq = 0;
         user_freq = 0;
         len = 0;
+        trad = NULL;
     }
 
     gboolean empty (void) const
@@ -57,6 +59,7 @@ struct Phrase {
         g_strlcat (phrase, a.phrase, sizeof (phrase));
         std::memcpy (pinyin_id + len, a.pinyin_id, a.len << 1);
         len += a.len;
+        trad = NULL;
         return *this;
     }
 
@@ -19,6 +19,7 @@
  * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  */
 #include "PYPhraseEditor.h"
+#include <algorithm>
 #include "PYConfig.h"
 #include "PYDatabase.h"
 #include "PYPinyinProperties.h"
@@ -34,7 +35,9 @@ PhraseEditor::PhraseEditor (PinyinProperties & props, Config & config)
       m_pinyin (16),
       m_cursor (0),
       m_props (props),
-      m_config (config)
+      m_config (config),
+      m_lattice_option (0),
+      m_option (0)
 {
 }
 
@@ -42,35 +45,54 @@ PhraseEditor::~PhraseEditor (void)
 {
 }
 
-gboolean
-PhraseEditor::update (const PinyinArray &pinyin)
+void
+PhraseEditor::setPinyin (const PinyinArray &pinyin, const PinyinLattice &lattice)
 {
     /* the size of pinyin must not bigger than MAX_PHRASE_LEN */
     g_assert (pinyin.size () <= MAX_PHRASE_LEN);
 
+    /* keep the spans within the unchanged pinyin */
+    guint stable = 0;
+    while (stable < m_pinyin.size () && stable < pinyin.size () &&
+           m_pinyin[stable].pinyin == pinyin[stable].pinyin)
+        stable ++;
+
+    if (m_lattice.size () > stable)
+        m_lattice.resize (stable);
+    for (guint i = 0; i < m_lattice.size (); i++) {
+        if (m_lattice[i].size () > stable - i)
+            m_lattice[i].resize (stable - i);
+    }
+
     m_pinyin = pinyin;
+    m_pinyin_lattice = lattice;
     m_cursor = 0;
 
     /* FIXME, should not remove all phrases1 */
     m_selected_phrases.clear ();
     m_selected_string.truncate (0);
-    updateCandidates ();
-    return TRUE;
+
+    clearCandidates ();
 }
 
 gboolean
 PhraseEditor::resetCandidate (guint i)
 {
     Database::instance ().remove (m_candidates[i]);
+    m_lattice.clear ();
 
-    updateCandidates ();
+    clearCandidates ();
     return TRUE;
 }
 
 void
 PhraseEditor::commit (void)
 {
-    Database::instance ().commit (m_selected_phrases);
+    Database::instance ().commit (m_selected_phrases, m_context);
+    if (m_selected_phrases.empty ())
+        m_context.clear ();
+    else
+        m_context = m_selected_phrases.back ().phrase;
     reset ();
 }
 
@@ -87,7 +109,7 @@ PhraseEditor::selectCandidate (guint i)
         if (G_LIKELY (m_props.modeSimp ()))
             m_selected_string << m_candidates[0].phrase;
         else
-            SimpTradConverter::simpToTrad (m_candidates[0].phrase, m_selected_string);
+            SimpTradConverter::simpToTrad (m_candidates[0], m_selected_string);
         m_cursor = m_pinyin.size ();
     }
     else {
@@ -95,18 +117,60 @@ PhraseEditor::selectCandidate (guint i)
         if (G_LIKELY (m_props.modeSimp ()))
             m_selected_string << m_candidates[i].phrase;
         else
-            SimpTradConverter::simpToTrad (m_candidates[i].phrase, m_selected_string);
-        m_cursor += m_candidates[i].len;
+            SimpTradConverter::simpToTrad (m_candidates[i], m_selected_string);
+        m_cursor += m_candidate_spans[i];
     }
 
-    updateCandidates ();
+    clearCandidates ();
     return TRUE;
 }
 
 void
-PhraseEditor::updateCandidates (void)
+PhraseEditor::takeCandidates (PhraseEditor & editor)
+{
+    /* the first candidate may point to its traditional form */
+    gboolean trad_0 = !editor.m_candidates.empty () &&
+                      editor.m_candidates[0].trad != NULL &&
+                      editor.m_candidates[0].trad == editor.m_candidate_0_trad.c_str ();
+
+    m_candidates.swap (editor.m_candidates);
+    m_candidate_spans.swap (editor.m_candidate_spans);
+    m_candidate_0_phrases.swap (editor.m_candidate_0_phrases);
+    m_candidate_0_trad = editor.m_candidate_0_trad;
+    if (trad_0)
+        m_candidates[0].trad = m_candidate_0_trad;
+    m_lattice.swap (editor.m_lattice);
+    m_lattice_option = editor.m_lattice_option;
+    /* the lattice of pinyin was queried by the first fill already */
+    m_query.swap (editor.m_query);
+}
+
+void
+PhraseEditor::appendCandidates (const PhraseArray & phrases,
+                                const std::vector<guint> & spans,
+                                gboolean last)
+{
+    m_candidates.insert (m_candidates.end (), phrases.begin (), phrases.end ());
+    m_candidate_spans.insert (m_candidate_spans.end (), spans.begin (), spans.end ());
+    if (last)
+        m_query.reset ();
+}
+
+void
+PhraseEditor::clearCandidates (void)
 {
+    m_option = m_config.option ();
     m_candidates.clear ();
+    m_candidate_spans.clear ();
+    m_candidate_0_phrases.clear ();
+    m_query.reset ();
+}
+
+void
+PhraseEditor::queryCandidates (void)
+{
+    m_candidates.clear ();
+    m_candidate_spans.clear ();
     m_query.reset ();
     updateTheFirstCandidate ();
 
@@ -116,41 +180,218 @@ PhraseEditor::updateCandidates (void)
     if (G_LIKELY (m_candidate_0_phrases.size () > 1)) {
         Phrase phrase;
         phrase.reset ();
-        for (guint i = 0; i < m_candidate_0_phrases.size (); i++)
+        m_candidate_0_trad.truncate (0);
+        guint n_trad = 0;
+        for (guint i = 0; i < m_candidate_0_phrases.size (); i++) {
             phrase += m_candidate_0_phrases[i];
+            if (m_candidate_0_phrases[i].trad != NULL) {
+                m_candidate_0_trad << m_candidate_0_phrases[i].trad;
+                n_trad ++;
+            }
+        }
+        /* it is converted phrase by phrase, if all of them are known */
+        if (n_trad == m_candidate_0_phrases.size ())
+            phrase.trad = m_candidate_0_trad;
         m_candidates.push_back (phrase);
+        m_candidate_spans.push_back (m_pinyin.size () - m_cursor);
     }
 
     m_query.reset (new Query (m_pinyin,
                               m_cursor,
                               m_pinyin.size () - m_cursor,
-                              m_config.option ()));
+                              m_option,
+                              m_pinyin_lattice.empty () ? NULL : &m_pinyin_lattice));
     fillCandidates ();
+    /* the first candidate is the one in preedit, it stays there */
+    rankByContext (1);
 }
 
+static bool
+pair_freq_greater (const std::pair<guint, guint> & a,
+                   const std::pair<guint, guint> & b)
+{
+    return a.first > b.first;
+}
+
+/* moves the candidates of the first fill, which the user committed after
+ * the context before, to the front */
+void
+PhraseEditor::rankByContext (guint begin)
+{
+    const gchar *prev = context ();
+    const UserBigram & user_bigram = Database::instance ().userBigram ();
+    if (prev == NULL || user_bigram.size () == 0)
+        return;
+
+    std::vector<std::pair<guint, guint> > order;
+    gboolean found = FALSE;
+    for (guint i = begin; i < m_candidates.size (); i++) {
+        guint freq = user_bigram.freq (prev, m_candidates[i].phrase);
+        order.push_back (std::make_pair (freq, i));
+        found = found || freq > 0;
+    }
+    if (!found)
+        return;
+
+    std::stable_sort (order.begin (), order.end (), pair_freq_greater);
+    PhraseArray candidates (m_candidates.begin (), m_candidates.begin () + begin);
+    std::vector<guint> spans (m_candidate_spans.begin (), m_candidate_spans.begin () + begin);
+    for (guint i = 0; i < order.size (); i++) {
+        candidates.push_back (m_candidates[order[i].second]);
+        spans.push_back (m_candidate_spans[order[i].second]);
+    }
+    m_candidates.swap (candidates);
+    m_candidate_spans.swap (spans);
+}
+
+/* a path through the lattice of spans, which ends with a known phrase */
+struct LatticePath {
+    guint phrases;
+    guint user_phrases;
+    guint user_pairs;   /* adjacent phrases committed by the user before */
+    guint cost;     /* sum of bigram costs of adjacent phrases */
+    guint64 freq;
+    guint prev;     /* begin of the phrase before the last */
+};
+
+static inline gboolean
+path_better (const LatticePath & a, const LatticePath & b)
+{
+    if (a.phrases != b.phrases)
+        return a.phrases < b.phrases;
+    if (a.user_phrases != b.user_phrases)
+        return a.user_phrases > b.user_phrases;
+    if (a.user_pairs != b.user_pairs)
+        return a.user_pairs > b.user_pairs;
+    if (a.cost != b.cost)
+        return a.cost < b.cost;
+    return a.freq > b.freq;
+}
+
+/* The first candidate is the best path through the lattice of spans:
+ * the fewest phrases, then the most user phrases, then the most pairs
+ * committed by the user, then the lowest bigram cost, then the greatest
+ * sum of freq. The cost depends on the last
+ * phrase, so a path is kept for each of them. */
 void
 PhraseEditor::updateTheFirstCandidate (void)
 {
-    guint begin;
-    guint end;
+    /* paths[i][j] ends at i with the phrase of [j, i), paths[begin][begin]
+     * is the empty path after the selected phrases */
+    LatticePath paths[MAX_PHRASE_LEN + 1][MAX_PHRASE_LEN + 1];
 
     m_candidate_0_phrases.clear ();
 
     if (G_UNLIKELY (m_pinyin.size () == 0))
         return;
 
-    begin = m_cursor;
-    end = m_pinyin.size ();
-
-    while (begin != end) {
-        gint ret;
-        Query query (m_pinyin,
-                     begin,
-                     end - begin,
-                     m_config.option ());
-        ret = query.fill (m_candidate_0_phrases, 1);
-        g_assert (ret == 1);
-        begin += m_candidate_0_phrases.back ().len;
+    guint begin = m_cursor;
+    guint end = m_pinyin.size ();
+
+    /* all pinyin is selected */
+    if (begin == end)
+        return;
+
+    updateLattice (begin);
+
+    const Bigram & bigram = Database::instance ().bigram ();
+    const UserBigram & user_bigram = Database::instance ().userBigram ();
+
+    for (guint i = begin; i <= end; i++)
+        for (guint j = begin; j <= i; j++)
+            paths[i][j].phrases = G_MAXUINT;
+    paths[begin][begin].phrases = 0;
+    paths[begin][begin].user_phrases = 0;
+    paths[begin][begin].user_pairs = 0;
+    paths[begin][begin].cost = 0;
+    paths[begin][begin].freq = 0;
+    paths[begin][begin].prev = begin;
+
+    for (guint i = begin; i < end; i++) {
+        const PhraseArray & spans = m_lattice[i];
+        for (guint j = begin; j <= i; j++) {
+            const LatticePath & from = paths[i][j];
+            if (from.phrases == G_MAXUINT)
+                continue;
+
+            const gchar *prev = j < i ? m_lattice[j][i - j - 1].phrase : context ();
+
+            for (guint len = 1; i + len <= end; len++) {
+                const Phrase & phrase = spans[len - 1];
+                if (phrase.len == 0)
+                    continue;
+
+                LatticePath path;
+                path.phrases = from.phrases + 1;
+                path.user_phrases = from.user_phrases + (phrase.user_freq > 0 ? 1 : 0);
+                path.user_pairs = from.user_pairs;
+                path.cost = from.cost;
+                if (prev != NULL) {
+                    if (user_bigram.size () > 0 && user_bigram.freq (prev, phrase.phrase) > 0)
+                        path.user_pairs ++;
+                    if (bigram.loaded ())
+                        path.cost += bigram.cost (prev, phrase.phrase);
+                }
+                path.freq = from.freq + phrase.freq;
+                path.prev = j;
+
+                LatticePath & best = paths[i + len][i];
+                if (best.phrases == G_MAXUINT || path_better (path, best))
+                    best = path;
+            }
+        }
+    }
+
+    guint last = G_MAXUINT;
+    for (guint j = begin; j < end; j++) {
+        if (paths[end][j].phrases != G_MAXUINT &&
+            (last == G_MAXUINT || path_better (paths[end][j], paths[end][last])))
+            last = j;
+    }
+
+    g_assert (last != G_MAXUINT);
+
+    m_candidate_0_phrases.resize (paths[end][last].phrases);
+    for (guint i = end, j = last, n = m_candidate_0_phrases.size (); i != begin; ) {
+        m_candidate_0_phrases[--n] = m_lattice[j][i - j - 1];
+        guint prev = paths[i][j].prev;
+        i = j;
+        j = prev;
+    }
+}
+
+/* finds the best phrase of the spans from begin, which are not known */
+void
+PhraseEditor::updateLattice (guint begin)
+{
+    if (G_UNLIKELY (m_lattice_option != m_option)) {
+        m_lattice_option = m_option;
+        m_lattice.clear ();
+    }
+
+    guint end = m_pinyin.size ();
+    if (m_lattice.size () < end)
+        m_lattice.resize (end);
+
+    Database & database = Database::instance ();
+    Phrase none;
+    none.reset ();
+
+    for (guint i = begin; i < end; i++) {
+        PhraseArray & spans = m_lattice[i];
+        guint known = spans.size ();
+        if (known == end - i)
+            continue;
+
+        /* longest first, so the lexicon is walked once for all of them */
+        spans.resize (end - i, none);
+        for (guint len = end - i; len > known; len--) {
+            PhraseArray phrases;
+            gboolean complete;
+            if (database.query (m_pinyin, i, len, m_option,
+                                0, 1, phrases, complete) > 0)
+                spans[len - 1] = phrases.front ();
+        }
     }
 }
 
@@ -161,7 +402,7 @@ PhraseEditor::fillCandidates (void)
         return FALSE;
     }
 
-    gint ret = m_query->fill (m_candidates, FILL_GRAN);
+    gint ret = m_query->fill (m_candidates, FILL_GRAN, &m_candidate_spans);
 
     if (G_UNLIKELY (ret < FILL_GRAN)) {
         /* got all candidates from query */
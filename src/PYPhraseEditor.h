@@ -60,7 +60,12 @@ public:
         return m_candidates[i];
     }
 
-    gboolean fillCandidates (void);
+    /* the number of pinyin the candidate is for, it differs from the
+     * length of the phrase if it is of another segmentation */
+    guint candidateSpan (guint i) const
+    {
+        return m_candidate_spans[i];
+    }
 
     const PhraseArray & candidate0 (void) const
     {
@@ -82,7 +87,7 @@ public:
             m_selected_phrases.clear ();
             m_selected_string.truncate (0);
             m_cursor = 0;
-            updateCandidates ();
+            clearCandidates ();
             return TRUE;
         }
     }
@@ -90,15 +95,35 @@ public:
     void reset (void)
     {
         m_candidates.clear ();
+        m_candidate_spans.clear ();
         m_selected_phrases.clear ();
         m_selected_string.truncate (0);
         m_candidate_0_phrases.clear ();
         m_pinyin.clear ();
+        m_pinyin_lattice.clear ();
         m_cursor = 0;
         m_query.reset ();
+        m_lattice.clear ();
     }
 
-    gboolean update (const PinyinArray &pinyin);
+    /* lattice has the other segmentations of the text of pinyin, it may
+     * be empty. No candidate is left, see queryCandidates () */
+    void setPinyin (const PinyinArray &pinyin, const PinyinLattice &lattice);
+    /* queries the candidates of the pinyin and the selection. It reads
+     * the database, so it runs in the query thread on a copy of the
+     * editor */
+    void queryCandidates (void);
+    /* takes the candidates of a copy, which queried them for the same
+     * pinyin */
+    void takeCandidates (PhraseEditor & editor);
+    /* the query of the candidates not fetched yet, or NULL. It is filled
+     * in the query thread, and the results are appended, last is TRUE if
+     * it has no more */
+    std::shared_ptr<Query> query (void) const  { return m_query; }
+    void appendCandidates (const PhraseArray & phrases,
+                           const std::vector<guint> & spans,
+                           gboolean last);
+    /* select, unselect and reset leave no candidate as setPinyin does */
     gboolean selectCandidate (guint i);
     gboolean resetCandidate (guint i);
     void commit (void);
@@ -114,19 +139,43 @@ public:
     }
 
 private:
-    void updateCandidates (void);
+    void clearCandidates (void);
+    gboolean fillCandidates (void);
     void updateTheFirstCandidate (void);
+    void updateLattice (guint begin);
+    void rankByContext (guint begin);
+
+    /* the phrase before the cursor, or NULL */
+    const gchar *context (void) const
+    {
+        if (!m_selected_phrases.empty ())
+            return m_selected_phrases.back ().phrase;
+        return m_context.empty () ? NULL : m_context.c_str ();
+    }
 
 private:
     PhraseArray m_candidates;           // candidates phrase array
+    std::vector<guint> m_candidate_spans;   // pinyin taken by each candidate
     PhraseArray m_selected_phrases;     // selected phrases, before cursor
     String      m_selected_string;      // selected phrases, in string format
     PhraseArray m_candidate_0_phrases;  // the first candidate in phrase array format
+    String      m_candidate_0_trad;     // the traditional form of the first candidate
     PinyinArray m_pinyin;
+    PinyinLattice m_pinyin_lattice;
     guint m_cursor;
     PinyinProperties & m_props;
     std::shared_ptr<Query> m_query;
     Config    & m_config;
+
+    /* The best phrase of each span of pinyin, m_lattice[i][len - 1] is
+     * the one of [i, i + len), or an empty phrase if there is none. The
+     * spans are kept while their pinyin is unchanged. */
+    std::vector<PhraseArray> m_lattice;
+    guint m_lattice_option;
+    guint m_option;     /* of the config, when the candidates were asked */
+
+    /* the last phrase of the last commit, it is kept by reset () */
+    String m_context;
 };
 
 };
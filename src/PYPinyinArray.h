@@ -68,6 +68,51 @@ public:
     }
 };
 
+/* Syllables of all segmentations of a text, which PinyinParser found,
+ * as segments grouped by their begin. Separators are skipped, so a
+ * segment is followed by the segments of next (segment). */
+class PinyinLattice {
+public:
+    void clear (void)
+    {
+        m_segments.clear ();
+        m_first.clear ();
+        m_next.clear ();
+    }
+
+    gboolean empty (void) const { return m_segments.empty (); }
+
+    /* the length of text covered, every path ends there */
+    guint length (void) const { return m_next.empty () ? 0 : m_next.size () - 1; }
+
+    /* segments beginning at pos, the one of the parsed path first */
+    const PinyinSegment *begin (guint pos) const
+    {
+        return m_segments.data () + m_first[pos];
+    }
+
+    const PinyinSegment *end (guint pos) const
+    {
+        return m_segments.data () + m_first[pos + 1];
+    }
+
+    /* the begin of the segments after pos, pos itself if it is not a
+     * separator */
+    guint next (guint pos) const { return m_next[pos]; }
+
+    guint next (const PinyinSegment & segment) const
+    {
+        return m_next[segment.begin + segment.len];
+    }
+
+private:
+    std::vector<PinyinSegment> m_segments;
+    std::vector<guint> m_first;     /* segments of pos are [m_first[pos], m_first[pos + 1]) */
+    std::vector<guint> m_next;
+
+    friend class PinyinParser;
+};
+
 };
 
 #endif
@@ -157,6 +157,60 @@ PinyinEditor::processFunctionKey (guint keyval, guint keycode, guint modifiers)
     return PhoneticEditor::processFunctionKey (keyval, keycode, modifiers);
 }
 
+/* keys selecting, paging or committing candidates, which must then be
+ * the ones of the pinyin typed before them */
+gboolean
+PinyinEditor::keyReadsCandidates (guint keyval, guint modifiers)
+{
+    switch (keyval) {
+    case IBUS_0 ... IBUS_9:
+    case IBUS_KP_0 ... IBUS_KP_9:
+    case IBUS_space:
+    case IBUS_Return:
+    case IBUS_KP_Enter:
+    case IBUS_Left:
+    case IBUS_KP_Left:
+    case IBUS_Right:
+    case IBUS_KP_Right:
+    case IBUS_Home:
+    case IBUS_KP_Home:
+    case IBUS_End:
+    case IBUS_KP_End:
+    case IBUS_Up:
+    case IBUS_KP_Up:
+    case IBUS_Down:
+    case IBUS_KP_Down:
+    case IBUS_Page_Up:
+    case IBUS_KP_Page_Up:
+    case IBUS_Page_Down:
+    case IBUS_KP_Page_Down:
+    case IBUS_Tab:
+        return TRUE;
+    case IBUS_Shift_L:
+    case IBUS_Shift_R:
+        return m_config.shiftSelectCandidate ();
+    case IBUS_exclam ... IBUS_slash:
+    case IBUS_colon ... IBUS_at:
+    case IBUS_bracketleft ... IBUS_quoteleft:
+    case IBUS_braceleft ... IBUS_asciitilde:
+        /* as processPunct */
+        switch (keyval) {
+        case IBUS_apostrophe:
+            return FALSE;
+        case IBUS_comma:
+        case IBUS_period:
+            return m_config.commaPeriodPage () || m_config.autoCommit ();
+        case IBUS_minus:
+        case IBUS_equal:
+            return m_config.minusEqualPage () || m_config.autoCommit ();
+        default:
+            return m_config.autoCommit ();
+        }
+    default:
+        return FALSE;
+    }
+}
+
 gboolean
 PinyinEditor::processKeyEvent (guint keyval, guint keycode, guint modifiers)
 {
@@ -200,7 +254,7 @@ PinyinEditor::commit ()
     const gchar *p;
 
     if (m_selected_special_phrase.empty ()) {
-        p = textAfterPinyin (m_buffer.utf8Length ());
+        p = textAfterPinyin (m_phrase_editor.cursor ());
     }
     else {
         m_buffer << m_selected_special_phrase;
@@ -228,6 +282,8 @@ PinyinEditor::updatePreeditText ()
         hidePreeditText ();
         return;
     }
+    if (G_UNLIKELY (panelKept ()))
+        return;
 
     guint edit_begin = 0;
     guint edit_end = 0;
@@ -247,7 +303,13 @@ PinyinEditor::updatePreeditText ()
     }
     else {
         edit_begin = m_buffer.utf8Length ();
-        if (m_lookup_table.size () > 0) {
+        if (G_UNLIKELY (candidatesPending ())) {
+            /* candidates are not back yet, the text is shown as typed */
+            const gchar *text = textAfterPinyin (m_phrase_editor.cursor ());
+            m_buffer << text;
+            edit_begin += m_cursor - (text - (const gchar *) m_text);
+        }
+        else if (m_lookup_table.size () > 0) {
             guint cursor = m_lookup_table.cursorPos ();
 
             if (cursor < m_special_phrases.size ()) {
@@ -257,7 +319,12 @@ PinyinEditor::updatePreeditText ()
                 m_buffer << textAfterCursor ();
             }
             else {
-                const Phrase & candidate = m_phrase_editor.candidate (cursor - m_special_phrases.size ());
+                guint index = cursor - m_special_phrases.size ();
+                const Phrase & candidate = m_phrase_editor.candidate (index);
+                /* a phrase of another segmentation has more or less
+                 * chars than the pinyin it is for */
+                guint candidate_begin = m_phrase_editor.cursor ();
+                guint candidate_end = candidate_begin + m_phrase_editor.candidateSpan (index);
                 if (m_text.size () == m_cursor) {
                     /* cursor at end */
                     if (m_props.modeSimp ())
@@ -267,13 +334,12 @@ PinyinEditor::updatePreeditText ()
                     edit_end = m_buffer.utf8Length ();
 
                     /* append rest text */
-                    m_buffer << textAfterPinyin (edit_end);
+                    m_buffer << textAfterPinyin (candidate_end);
                 }
                 else {
-                    guint candidate_end = edit_begin + candidate.len;
-                    m_buffer << m_pinyin[edit_begin]->sheng << m_pinyin[edit_begin]->yun;
+                    m_buffer << m_pinyin[candidate_begin]->sheng << m_pinyin[candidate_begin]->yun;
 
-                    for (guint i = edit_begin + 1; i < candidate_end; i++) {
+                    for (guint i = candidate_begin + 1; i < candidate_end; i++) {
                         m_buffer << ' ' << m_pinyin[i]->sheng << m_pinyin[i]->yun;
                     }
                     m_buffer << '|' << textAfterPinyin (candidate_end);
@@ -305,17 +371,20 @@ PinyinEditor::updateAuxiliaryText ()
 {
     /* clear pinyin array */
     if (G_UNLIKELY (m_text.empty () ||
-        m_lookup_table.size () == 0)) {
+        (m_lookup_table.size () == 0 && !candidatesPending ()))) {
         hideAuxiliaryText ();
         return;
     }
+    if (G_UNLIKELY (panelKept ()))
+        return;
 
     m_buffer.clear ();
 
     updateAuxiliaryTextBefore (m_buffer);
 
     if (m_selected_special_phrase.empty ()) {
-        if (m_lookup_table.cursorPos () < m_special_phrases.size ()) {
+        if (!candidatesPending () &&
+            m_lookup_table.cursorPos () < m_special_phrases.size ()) {
             guint begin = m_phrase_editor.cursorInChar ();
             m_buffer << m_text.substr (begin, m_cursor - begin)
                      << '|' << textAfterCursor ();
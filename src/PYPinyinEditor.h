@@ -48,6 +48,7 @@ protected:
     void updatePreeditText (void);
 
     virtual gboolean processKeyEvent (guint keyval, guint keycode, guint modifiers);
+    virtual gboolean keyReadsCandidates (guint keyval, guint modifiers);
     virtual void updateAuxiliaryTextBefore (String &buffer) { };
     virtual void updateAuxiliaryTextAfter  (String &buffer) { };
 };
@@ -314,6 +314,9 @@ PinyinEngine::connectEditorSignals (EditorPtr editor)
         std::bind (&PinyinEngine::showLookupTable, this));
     editor->signalHideLookupTable ().connect (
         std::bind (&PinyinEngine::hideLookupTable, this));
+
+    editor->signalCandidatesReady ().connect (
+        std::bind (&PinyinEngine::processDeferred, this));
 }
 
 };
@@ -21,6 +21,7 @@
 
 #include <cstring>
 #include <cstdlib>
+#include <vector>
 #include "PYPinyinParser.h"
 
 namespace PY {
@@ -45,62 +46,46 @@ check_flags (const Pinyin *pinyin, guint option)
     return TRUE;
 }
 
-static int
-py_cmp (const void *p1, const void *p2)
-{
-    const gchar *str = (const gchar *) p1;
-    const Pinyin *py = (const Pinyin *) p2;
-
-    return std::strcmp (str, py->text);
-}
-
+/* Runs the syllable DFA from p. If len > 0, it returns the syllable of
+ * exact len chars, otherwise the longest one, which are accepted by
+ * option. */
 static const Pinyin *
 is_pinyin (const gchar *p,
            const gchar *end,
            gint         len,
            guint        option)
 {
-    gchar buf[8];
-    const Pinyin *result;
-
-    if (G_UNLIKELY (len > 6))
-        return NULL;
+    const PinyinTrieNode *node = pinyin_trie;
+    const Pinyin *result = NULL;
 
     if (G_UNLIKELY (len > end - p))
         return NULL;
-
-    if (G_LIKELY (len > 0)) {
-        std::strncpy (buf, p, len);
-        buf[len] = 0;
-        result = (const Pinyin *) std::bsearch (buf, pinyin_table, G_N_ELEMENTS (pinyin_table),
-                                            sizeof (Pinyin), py_cmp);
-        if (check_flags (result, option))
-            return result;
-        return NULL;
+    if (len > 0)
+        end = p + len;
+
+    for (; p < end; p++) {
+        guint c = (guchar) *p - 'a';
+        if (c >= 26 || ((node->children >> c) & 1) == 0)
+            return len > 0 ? NULL : result;
+        node = pinyin_trie + node->first_child +
+               __builtin_popcount (node->children & ((1U << c) - 1));
+        if (len <= 0 && node->pinyin >= 0 &&
+            check_flags (&pinyin_table[node->pinyin], option))
+            result = &pinyin_table[node->pinyin];
     }
 
-    /* len < 0 */
-    len = MIN (6, end - p);
-    std::strncpy (buf, p, len);
-
-    for (; len > 0; len --) {
-        buf[len] = 0;
-        result = (const Pinyin *) std::bsearch (buf, pinyin_table, G_N_ELEMENTS (pinyin_table),
-                                            sizeof (Pinyin), py_cmp);
-        if (G_UNLIKELY (check_flags (result, option))) {
-            return result;
-        }
-    }
-
-    return NULL;
+    if (len > 0 && node->pinyin >= 0 &&
+        check_flags (&pinyin_table[node->pinyin], option))
+        return &pinyin_table[node->pinyin];
+    return result;
 }
 
 static int
 sp_cmp (const void *p1,
         const void *p2)
 {
-    const Pinyin **pys = (const Pinyin **) p1;
-    const Pinyin **e = (const Pinyin **) p2;
+    const guint16 *pys = (const guint16 *) p1;
+    const guint16 *e = (const guint16 *) p2;
 
     int retval = pys[0] - e[0];
 
@@ -109,41 +94,41 @@ sp_cmp (const void *p1,
     return pys[1] - e[1];
 }
 
-static const Pinyin **
+static const guint16 *
 need_resplit(const Pinyin *p1,
              const Pinyin *p2)
 {
-    const Pinyin * pys[] = {p1, p2};
+    const guint16 pys[] = {
+        (guint16) (p1 - pinyin_table),
+        (guint16) (p2 - pinyin_table)
+    };
 
-    return (const Pinyin **) std::bsearch (pys, special_table, G_N_ELEMENTS (special_table),
-                                        sizeof (special_table[0]), sp_cmp);
+    return (const guint16 *) std::bsearch (pys, special_table, G_N_ELEMENTS (special_table),
+                                           sizeof (special_table[0]), sp_cmp);
 }
 
-guint
-PinyinParser::parse (const String   &pinyin,
-                     gint            len,
-                     guint           option,
-                     PinyinArray    &result,
-                     guint           max)
+/* parses from p, result holds the segments before p */
+static guint
+parse_from (const String   &pinyin,
+            const gchar    *p,
+            const gchar    *end,
+            guint           option,
+            PinyinArray    &result,
+            guint           max)
 {
-
-    const gchar *p;
-    const gchar *end;
     const Pinyin *py;
     const Pinyin *prev_py;
     gchar prev_c;
 
-    result.clear ();
-
-    if (G_UNLIKELY (len < 0))
-        len = pinyin.size ();
-
-    p = pinyin;
-    end = p + len;
-
-    prev_py = NULL;
+    if (result.empty ()) {
+        prev_py = NULL;
+        prev_c = 0;
+    }
+    else {
+        prev_py = result.back ().pinyin;
+        prev_c = prev_py->text[prev_py->len - 1];
+    }
 
-    prev_c = 0;
     for (; p < end && result.size () < max; ) {
         if (G_UNLIKELY (*p == '\'')) {
             prev_c = '\'';
@@ -164,7 +149,7 @@ PinyinParser::parse (const String   &pinyin,
             case 'o':
             case 'r':
                 {
-                    const Pinyin **pp;
+                    const guint16 *pp;
                     const Pinyin *new_py1;
                     const Pinyin *new_py2;
 
@@ -193,9 +178,9 @@ PinyinParser::parse (const String   &pinyin,
                     pp = need_resplit (prev_py, py);
                     if (pp != NULL) {
                         PinyinSegment & segment = result[result.size () - 1];
-                        segment.pinyin = pp[2];
-                        segment.len = pp[2]->len;
-                        py = pp[3];
+                        segment.pinyin = &pinyin_table[pp[2]];
+                        segment.len = segment.pinyin->len;
+                        py = &pinyin_table[pp[3]];
                         p --;
                         break;
                     }
@@ -228,6 +213,157 @@ PinyinParser::parse (const String   &pinyin,
     return p - (const gchar *)pinyin;
 }
 
+guint
+PinyinParser::parse (const String   &pinyin,
+                     gint            len,
+                     guint           option,
+                     PinyinArray    &result,
+                     guint           max)
+{
+    result.clear ();
+
+    if (G_UNLIKELY (len < 0))
+        len = pinyin.size ();
+
+    const gchar *p = pinyin;
+    return parse_from (pinyin, p, p + len, option, result, max);
+}
+
+guint
+PinyinParser::reparse (const String   &pinyin,
+                       gint            len,
+                       guint           option,
+                       PinyinArray    &result,
+                       guint           max,
+                       guint           edit_pos)
+{
+    if (G_UNLIKELY (len < 0))
+        len = pinyin.size ();
+
+    const gchar *p = pinyin;
+    edit_pos = MIN (edit_pos, (guint) len);
+
+    /* A segment is decided by at most 7 chars from its begin, including
+     * the look ahead of a resplit. It may still be changed by a resplit
+     * of the next segment, which only happens if it is followed by one of
+     * 'r', 'n', 'g', 'e', or if it ends with one of them and is followed
+     * by a vowel. */
+    guint n = 0;
+    for (guint i = 0; i < result.size () && result[i].begin + 7 <= edit_pos; i++) {
+        const PinyinSegment & segment = result[i];
+        const gchar *end = p + segment.begin + segment.len;
+        if (std::strncmp (segment.pinyin->text, p + segment.begin, segment.len) != 0 ||
+            segment.pinyin->text[segment.len] != '\0')
+            continue;
+        switch (*end) {
+        case 'r': case 'n': case 'g': case 'e':
+            continue;
+        case 'i': case 'u': case 'v': case 'a': case 'o':
+            switch (end[-1]) {
+            case 'r': case 'n': case 'g': case 'e':
+                continue;
+            }
+        }
+        n = i + 1;
+    }
+
+    if (n == 0 || n > max)
+        return parse (pinyin, len, option, result, max);
+
+    result.resize (n);
+    const PinyinSegment & last = result.back ();
+    return parse_from (pinyin, p + last.begin + last.len, p + len, option, result, max);
+}
+
+/* The segments are found from the end, so only the syllables which can
+ * be followed up to the end are taken. Then the ones which can not be
+ * reached within MAX_PHRASE_LEN syllables from the begin are dropped. */
+void
+PinyinParser::parseLattice (const String       &pinyin,
+                            const PinyinArray  &path,
+                            guint               option,
+                            PinyinLattice      &lattice,
+                            guint               max_branch)
+{
+    lattice.clear ();
+    if (path.empty ())
+        return;
+
+    const gchar *text = pinyin;
+    guint len = path.back ().begin + path.back ().len;
+
+    std::vector<guint> & next = lattice.m_next;
+    next.resize (len + 1);
+    next[len] = len;
+    for (guint pos = len; pos > 0; pos--)
+        next[pos - 1] = text[pos - 1] == '\'' ? next[pos] : pos - 1;
+
+    /* the fewest syllables from pos to the end */
+    std::vector<guint> to_end (len + 1, G_MAXUINT);
+    to_end[len] = 0;
+
+    /* segments of each pos in reverse order of pos */
+    std::vector<PinyinSegment> segments;
+    std::vector<guint> first (len + 1);
+    guint k = path.size ();
+
+    for (guint pos = len; pos > 0; ) {
+        pos --;
+        first[pos] = segments.size ();
+        if (next[pos] != pos)
+            continue;
+
+        /* the segment of path is always taken */
+        const Pinyin *taken = NULL;
+        while (k > 0 && path[k - 1].begin > pos)
+            k --;
+        if (k > 0 && path[k - 1].begin == pos) {
+            taken = path[k - 1].pinyin;
+            segments.push_back (path[k - 1]);
+        }
+
+        /* only complete syllables, which are not corrected */
+        guint n = 0;
+        for (guint l = MIN (6, len - pos); l > 0 && n < max_branch; l--) {
+            const Pinyin *py = is_pinyin (text + pos, text + len, l, option);
+            if (py == NULL || py == taken || py->flags != 0 ||
+                to_end[next[pos + l]] == G_MAXUINT)
+                continue;
+            segments.push_back (PinyinSegment (py, pos, l));
+            n ++;
+        }
+
+        for (guint i = first[pos]; i < segments.size (); i++) {
+            const PinyinSegment & segment = segments[i];
+            to_end[pos] = MIN (to_end[pos], to_end[next[pos + segment.len]] + 1);
+        }
+    }
+
+    /* the fewest syllables from the begin to pos */
+    std::vector<guint> from_begin (len + 1, G_MAXUINT);
+    from_begin[next[0]] = 0;
+
+    lattice.m_first.resize (len + 2);
+    for (guint pos = 0; pos < len; pos++) {
+        lattice.m_first[pos] = lattice.m_segments.size ();
+        if (from_begin[pos] == G_MAXUINT)
+            continue;
+
+        guint end = pos > 0 ? first[pos - 1] : segments.size ();
+        for (guint i = first[pos]; i < end; i++) {
+            const PinyinSegment & segment = segments[i];
+            guint after = next[pos + segment.len];
+            if (to_end[after] == G_MAXUINT ||
+                from_begin[pos] + 1 + to_end[after] > MAX_PHRASE_LEN)
+                continue;
+            lattice.m_segments.push_back (segment);
+            from_begin[after] = MIN (from_begin[after], from_begin[pos] + 1);
+        }
+    }
+    lattice.m_first[len] = lattice.m_segments.size ();
+    lattice.m_first[len + 1] = lattice.m_segments.size ();
+}
+
 static const gchar * const
 id_map[] = {
     "", "b", "c", "ch",
@@ -249,7 +385,6 @@ id_map[] = {
 const Pinyin *
 PinyinParser::isPinyin (gint sheng, gint yun, guint option)
 {
-    const Pinyin *result;
     gchar buf[16];
 
     std::strcpy (buf, id_map[sheng]);
@@ -272,20 +407,8 @@ PinyinParser::isPinyin (gint sheng, gint yun, guint option)
         std::strcat (buf, id_map[yun]);
     }
 
-    result = (const Pinyin *) bsearch (buf, pinyin_table, G_N_ELEMENTS (pinyin_table),
-                                            sizeof (Pinyin), py_cmp);
-    if (check_flags (result, option))
-        return result;
-    return NULL;
-}
-
-static int
-bopomofo_cmp (const void *p1, const void *p2)
-{
-    const wchar_t *s1 = (wchar_t *) p1;
-    const Pinyin *s2 = *(const Pinyin **) p2;
-
-    return std::wcscmp (s1, s2->bopomofo);
+    gint len = std::strlen (buf);
+    return is_pinyin (buf, buf + len, len, option);
 }
 
 gboolean
@@ -304,49 +427,43 @@ PinyinParser::parseBopomofo (const std::wstring &bopomofo,
                              PinyinArray        &result,
                              guint               max)
 {
-    std::wstring::const_iterator bpmf = bopomofo.begin();
-    const std::wstring::const_iterator end = bpmf + len;
-    const Pinyin **bs_res;
-    wchar_t buf[MAX_BOPOMOFO_LEN + 1];
-    guint i, j;
-
     result.clear ();
 
     if (G_UNLIKELY (len < 0))
         len = bopomofo.length ();
 
-    for (; bpmf < end && result.size () < max;) {
-        for (i = MAX_BOPOMOFO_LEN; i > 0; i--){
-            if (bpmf + i > end)
-                continue;
-
-            for (j = 0; j < i; j++){
-                wchar_t key = *(bpmf + j);
+    const wchar_t *begin = bopomofo.c_str ();
+    const wchar_t *end = begin + len;
+    const wchar_t *p = begin;
 
-                if (j == i - 1 && isBopomofoToneChar (key)) {
-                    break; /* ignore tone */
-                }
+    while (p < end && result.size () < max) {
+        /* the longest syllable from p, and a tone after it */
+        const BopomofoTrieNode *node = bopomofo_trie;
+        const Pinyin *py = NULL;
+        guint i, n = 0;
 
-                buf[j] = key;
-            }
-
-            buf[j] = '\0';
-            bs_res = (const Pinyin **) std::bsearch (buf,
-                                                     bopomofo_table,
-                                                     G_N_ELEMENTS (bopomofo_table),
-                                                     sizeof (bopomofo_table[0]),
-                                                     bopomofo_cmp);
-            if (bs_res != NULL && check_flags (*bs_res, option))
+        for (i = 0; p + i < end; i++) {
+            guint c = p[i] - bopomofo_char[BOPOMOFO_B];
+            if (c >= 64 || ((node->children >> c) & 1) == 0)
                 break;
+            node = bopomofo_trie + node->first_child +
+                   __builtin_popcountll (node->children & ((G_GUINT64_CONSTANT (1) << c) - 1));
+            if (node->pinyin >= 0 &&
+                check_flags (&pinyin_table[node->pinyin], option)) {
+                py = &pinyin_table[node->pinyin];
+                n = i + 1;
+            }
         }
-        if (!(bs_res != NULL && check_flags (*bs_res, option)))
+        if (py == NULL)
             break;
+        if (p + n < end && isBopomofoToneChar (p[n]))
+            n++;
 
-        result.append(*bs_res, bpmf - bopomofo.begin (), i);
-        bpmf += i;
+        result.append (py, p - begin, n);
+        p += n;
     }
 
-    return bpmf - bopomofo.begin ();
-};
+    return p - begin;
+}
 
 };
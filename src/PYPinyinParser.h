@@ -34,6 +34,22 @@ public:
                         guint         option,      // option
                         PinyinArray  &result,      // store pinyin in result
                         guint         max);        // max length of the result
+    /* result is the parse of a text which was the same before edit_pos,
+     * only the segments the change may affect are parsed again */
+    static guint reparse (const String &pinyin,
+                          gint          len,
+                          guint         option,
+                          PinyinArray  &result,
+                          guint         max,
+                          guint         edit_pos);
+    /* fills lattice with the segmentations of the text parsed into path,
+     * with the segments of path and at most max_branch other complete
+     * syllables at each position */
+    static void parseLattice (const String       &pinyin,
+                              const PinyinArray  &path,
+                              guint               option,
+                              PinyinLattice      &lattice,
+                              guint               max_branch);
     static const Pinyin * isPinyin (gint sheng, gint yun, guint option);
     static guint parseBopomofo (const std::wstring  &bopomofo,
                                 gint                 len,
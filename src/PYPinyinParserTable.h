@@ -6598,1472 +6598,2422 @@ static const Pinyin pinyin_table[] = {
     },
 };
 
-static const Pinyin *bopomofo_table[] = {
-    &pinyin_table[7],    // "ㄅ" => "b"
-    &pinyin_table[8],    // "ㄅㄚ" => "ba"
-    &pinyin_table[29],   // "ㄅㄛ" => "bo"
-    &pinyin_table[10],   // "ㄅㄞ" => "bai"
-    &pinyin_table[16],   // "ㄅㄟ" => "bei"
-    &pinyin_table[14],   // "ㄅㄠ" => "bao"
-    &pinyin_table[12],   // "ㄅㄢ" => "ban"
-    &pinyin_table[18],   // "ㄅㄣ" => "ben"
-    &pinyin_table[13],   // "ㄅㄤ" => "bang"
-    &pinyin_table[19],   // "ㄅㄥ" => "beng"
-    &pinyin_table[20],   // "ㄅㄧ" => "bi"
-    &pinyin_table[24],   // "ㄅㄧㄝ" => "bie"
-    &pinyin_table[23],   // "ㄅㄧㄠ" => "biao"
-    &pinyin_table[21],   // "ㄅㄧㄢ" => "bian"
-    &pinyin_table[27],   // "ㄅㄧㄣ" => "bin"
-    &pinyin_table[22],   // "ㄅㄧㄤ" => "biang"
-    &pinyin_table[28],   // "ㄅㄧㄥ" => "bing"
-    &pinyin_table[30],   // "ㄅㄨ" => "bu"
-    &pinyin_table[403],  // "ㄆ" => "p"
-    &pinyin_table[404],  // "ㄆㄚ" => "pa"
-    &pinyin_table[425],  // "ㄆㄛ" => "po"
-    &pinyin_table[406],  // "ㄆㄞ" => "pai"
-    &pinyin_table[412],  // "ㄆㄟ" => "pei"
-    &pinyin_table[410],  // "ㄆㄠ" => "pao"
-    &pinyin_table[426],  // "ㄆㄡ" => "pou"
-    &pinyin_table[408],  // "ㄆㄢ" => "pan"
-    &pinyin_table[414],  // "ㄆㄣ" => "pen"
-    &pinyin_table[409],  // "ㄆㄤ" => "pang"
-    &pinyin_table[415],  // "ㄆㄥ" => "peng"
-    &pinyin_table[416],  // "ㄆㄧ" => "pi"
-    &pinyin_table[420],  // "ㄆㄧㄝ" => "pie"
-    &pinyin_table[419],  // "ㄆㄧㄠ" => "piao"
-    &pinyin_table[417],  // "ㄆㄧㄢ" => "pian"
-    &pinyin_table[423],  // "ㄆㄧㄣ" => "pin"
-    &pinyin_table[418],  // "ㄆㄧㄤ" => "piang"
-    &pinyin_table[424],  // "ㄆㄧㄥ" => "ping"
-    &pinyin_table[427],  // "ㄆㄨ" => "pu"
-    &pinyin_table[330],  // "ㄇ" => "m"
-    &pinyin_table[331],  // "ㄇㄚ" => "ma"
-    &pinyin_table[355],  // "ㄇㄛ" => "mo"
-    &pinyin_table[338],  // "ㄇㄜ" => "me"
-    &pinyin_table[333],  // "ㄇㄞ" => "mai"
-    &pinyin_table[340],  // "ㄇㄟ" => "mei"
-    &pinyin_table[337],  // "ㄇㄠ" => "mao"
-    &pinyin_table[356],  // "ㄇㄡ" => "mou"
-    &pinyin_table[335],  // "ㄇㄢ" => "man"
-    &pinyin_table[342],  // "ㄇㄣ" => "men"
-    &pinyin_table[336],  // "ㄇㄤ" => "mang"
-    &pinyin_table[343],  // "ㄇㄥ" => "meng"
-    &pinyin_table[344],  // "ㄇㄧ" => "mi"
-    &pinyin_table[348],  // "ㄇㄧㄝ" => "mie"
-    &pinyin_table[347],  // "ㄇㄧㄠ" => "miao"
-    &pinyin_table[354],  // "ㄇㄧㄡ" => "miu"
-    &pinyin_table[345],  // "ㄇㄧㄢ" => "mian"
-    &pinyin_table[351],  // "ㄇㄧㄣ" => "min"
-    &pinyin_table[346],  // "ㄇㄧㄤ" => "miang"
-    &pinyin_table[352],  // "ㄇㄧㄥ" => "ming"
-    &pinyin_table[357],  // "ㄇㄨ" => "mu"
-    &pinyin_table[132],  // "ㄈ" => "f"
-    &pinyin_table[133],  // "ㄈㄚ" => "fa"
-    &pinyin_table[146],  // "ㄈㄛ" => "fo"
-    &pinyin_table[140],  // "ㄈㄜ" => "fe"
-    &pinyin_table[135],  // "ㄈㄞ" => "fai"
-    &pinyin_table[142],  // "ㄈㄟ" => "fei"
-    &pinyin_table[139],  // "ㄈㄠ" => "fao"
-    &pinyin_table[149],  // "ㄈㄡ" => "fou"
-    &pinyin_table[137],  // "ㄈㄢ" => "fan"
-    &pinyin_table[144],  // "ㄈㄣ" => "fen"
-    &pinyin_table[138],  // "ㄈㄤ" => "fang"
-    &pinyin_table[145],  // "ㄈㄥ" => "feng"
-    &pinyin_table[150],  // "ㄈㄨ" => "fu"
-    &pinyin_table[151],  // "ㄈㄨㄚ" => "fua"
-    &pinyin_table[159],  // "ㄈㄨㄛ" => "fuo"
-    &pinyin_table[152],  // "ㄈㄨㄞ" => "fuai"
-    &pinyin_table[157],  // "ㄈㄨㄟ" => "fui"
-    &pinyin_table[153],  // "ㄈㄨㄢ" => "fuan"
-    &pinyin_table[158],  // "ㄈㄨㄣ" => "fun"
-    &pinyin_table[154],  // "ㄈㄨㄤ" => "fuang"
-    &pinyin_table[148],  // "ㄈㄨㄥ" => "fong"
-    &pinyin_table[89],   // "ㄉ" => "d"
-    &pinyin_table[90],   // "ㄉㄚ" => "da"
-    &pinyin_table[97],   // "ㄉㄜ" => "de"
-    &pinyin_table[92],   // "ㄉㄞ" => "dai"
-    &pinyin_table[99],   // "ㄉㄟ" => "dei"
-    &pinyin_table[96],   // "ㄉㄠ" => "dao"
-    &pinyin_table[119],  // "ㄉㄡ" => "dou"
-    &pinyin_table[94],   // "ㄉㄢ" => "dan"
-    &pinyin_table[101],  // "ㄉㄣ" => "den"
-    &pinyin_table[95],   // "ㄉㄤ" => "dang"
-    &pinyin_table[102],  // "ㄉㄥ" => "deng"
-    &pinyin_table[103],  // "ㄉㄧ" => "di"
-    &pinyin_table[104],  // "ㄉㄧㄚ" => "dia"
-    &pinyin_table[108],  // "ㄉㄧㄝ" => "die"
-    &pinyin_table[107],  // "ㄉㄧㄠ" => "diao"
-    &pinyin_table[114],  // "ㄉㄧㄡ" => "diu"
-    &pinyin_table[105],  // "ㄉㄧㄢ" => "dian"
-    &pinyin_table[111],  // "ㄉㄧㄣ" => "din"
-    &pinyin_table[106],  // "ㄉㄧㄤ" => "diang"
-    &pinyin_table[112],  // "ㄉㄧㄥ" => "ding"
-    &pinyin_table[120],  // "ㄉㄨ" => "du"
-    &pinyin_table[127],  // "ㄉㄨㄛ" => "duo"
-    &pinyin_table[125],  // "ㄉㄨㄟ" => "dui"
-    &pinyin_table[121],  // "ㄉㄨㄢ" => "duan"
-    &pinyin_table[126],  // "ㄉㄨㄣ" => "dun"
-    &pinyin_table[122],  // "ㄉㄨㄤ" => "duang"
-    &pinyin_table[118],  // "ㄉㄨㄥ" => "dong"
-    &pinyin_table[560],  // "ㄊ" => "t"
-    &pinyin_table[561],  // "ㄊㄚ" => "ta"
-    &pinyin_table[568],  // "ㄊㄜ" => "te"
-    &pinyin_table[563],  // "ㄊㄞ" => "tai"
-    &pinyin_table[567],  // "ㄊㄠ" => "tao"
-    &pinyin_table[586],  // "ㄊㄡ" => "tou"
-    &pinyin_table[565],  // "ㄊㄢ" => "tan"
-    &pinyin_table[571],  // "ㄊㄣ" => "ten"
-    &pinyin_table[566],  // "ㄊㄤ" => "tang"
-    &pinyin_table[572],  // "ㄊㄥ" => "teng"
-    &pinyin_table[573],  // "ㄊㄧ" => "ti"
-    &pinyin_table[577],  // "ㄊㄧㄝ" => "tie"
-    &pinyin_table[576],  // "ㄊㄧㄠ" => "tiao"
-    &pinyin_table[574],  // "ㄊㄧㄢ" => "tian"
-    &pinyin_table[580],  // "ㄊㄧㄣ" => "tin"
-    &pinyin_table[575],  // "ㄊㄧㄤ" => "tiang"
-    &pinyin_table[581],  // "ㄊㄧㄥ" => "ting"
-    &pinyin_table[587],  // "ㄊㄨ" => "tu"
-    &pinyin_table[594],  // "ㄊㄨㄛ" => "tuo"
-    &pinyin_table[592],  // "ㄊㄨㄟ" => "tui"
-    &pinyin_table[588],  // "ㄊㄨㄢ" => "tuan"
-    &pinyin_table[593],  // "ㄊㄨㄣ" => "tun"
-    &pinyin_table[589],  // "ㄊㄨㄤ" => "tuang"
-    &pinyin_table[585],  // "ㄊㄨㄥ" => "tong"
-    &pinyin_table[358],  // "ㄋ" => "n"
-    &pinyin_table[359],  // "ㄋㄚ" => "na"
-    &pinyin_table[386],  // "ㄋㄛ" => "no"
-    &pinyin_table[366],  // "ㄋㄜ" => "ne"
-    &pinyin_table[361],  // "ㄋㄞ" => "nai"
-    &pinyin_table[368],  // "ㄋㄟ" => "nei"
-    &pinyin_table[365],  // "ㄋㄠ" => "nao"
-    &pinyin_table[391],  // "ㄋㄡ" => "nou"
-    &pinyin_table[363],  // "ㄋㄢ" => "nan"
-    &pinyin_table[370],  // "ㄋㄣ" => "nen"
-    &pinyin_table[364],  // "ㄋㄤ" => "nang"
-    &pinyin_table[371],  // "ㄋㄥ" => "neng"
-    &pinyin_table[372],  // "ㄋㄧ" => "ni"
-    &pinyin_table[373],  // "ㄋㄧㄚ" => "nia"
-    &pinyin_table[379],  // "ㄋㄧㄝ" => "nie"
-    &pinyin_table[378],  // "ㄋㄧㄠ" => "niao"
-    &pinyin_table[385],  // "ㄋㄧㄡ" => "niu"
-    &pinyin_table[376],  // "ㄋㄧㄢ" => "nian"
-    &pinyin_table[382],  // "ㄋㄧㄣ" => "nin"
-    &pinyin_table[377],  // "ㄋㄧㄤ" => "niang"
-    &pinyin_table[383],  // "ㄋㄧㄥ" => "ning"
-    &pinyin_table[392],  // "ㄋㄨ" => "nu"
-    &pinyin_table[398],  // "ㄋㄨㄛ" => "nuo"
-    &pinyin_table[393],  // "ㄋㄨㄢ" => "nuan"
-    &pinyin_table[397],  // "ㄋㄨㄣ" => "nun"
-    &pinyin_table[394],  // "ㄋㄨㄤ" => "nuang"
-    &pinyin_table[390],  // "ㄋㄨㄥ" => "nong"
-    &pinyin_table[399],  // "ㄋㄩ" => "nv"
-    &pinyin_table[400],  // "ㄋㄩㄝ" => "nve"
-    &pinyin_table[285],  // "ㄌ" => "l"
-    &pinyin_table[286],  // "ㄌㄚ" => "la"
-    &pinyin_table[313],  // "ㄌㄛ" => "lo"
-    &pinyin_table[293],  // "ㄌㄜ" => "le"
-    &pinyin_table[288],  // "ㄌㄞ" => "lai"
-    &pinyin_table[295],  // "ㄌㄟ" => "lei"
-    &pinyin_table[292],  // "ㄌㄠ" => "lao"
-    &pinyin_table[318],  // "ㄌㄡ" => "lou"
-    &pinyin_table[290],  // "ㄌㄢ" => "lan"
-    &pinyin_table[297],  // "ㄌㄣ" => "len"
-    &pinyin_table[291],  // "ㄌㄤ" => "lang"
-    &pinyin_table[298],  // "ㄌㄥ" => "leng"
-    &pinyin_table[299],  // "ㄌㄧ" => "li"
-    &pinyin_table[300],  // "ㄌㄧㄚ" => "lia"
-    &pinyin_table[306],  // "ㄌㄧㄝ" => "lie"
-    &pinyin_table[305],  // "ㄌㄧㄠ" => "liao"
-    &pinyin_table[312],  // "ㄌㄧㄡ" => "liu"
-    &pinyin_table[303],  // "ㄌㄧㄢ" => "lian"
-    &pinyin_table[309],  // "ㄌㄧㄣ" => "lin"
-    &pinyin_table[304],  // "ㄌㄧㄤ" => "liang"
-    &pinyin_table[310],  // "ㄌㄧㄥ" => "ling"
-    &pinyin_table[319],  // "ㄌㄨ" => "lu"
-    &pinyin_table[327],  // "ㄌㄨㄛ" => "luo"
-    &pinyin_table[325],  // "ㄌㄨㄟ" => "lui"
-    &pinyin_table[320],  // "ㄌㄨㄢ" => "luan"
-    &pinyin_table[326],  // "ㄌㄨㄣ" => "lun"
-    &pinyin_table[321],  // "ㄌㄨㄤ" => "luang"
-    &pinyin_table[317],  // "ㄌㄨㄥ" => "long"
-    &pinyin_table[328],  // "ㄌㄩ" => "lv"
-    &pinyin_table[329],  // "ㄌㄩㄝ" => "lve"
-    &pinyin_table[160],  // "ㄍ" => "g"
-    &pinyin_table[161],  // "ㄍㄚ" => "ga"
-    &pinyin_table[168],  // "ㄍㄜ" => "ge"
-    &pinyin_table[163],  // "ㄍㄞ" => "gai"
-    &pinyin_table[170],  // "ㄍㄟ" => "gei"
-    &pinyin_table[167],  // "ㄍㄠ" => "gao"
-    &pinyin_table[178],  // "ㄍㄡ" => "gou"
-    &pinyin_table[165],  // "ㄍㄢ" => "gan"
-    &pinyin_table[172],  // "ㄍㄣ" => "gen"
-    &pinyin_table[166],  // "ㄍㄤ" => "gang"
-    &pinyin_table[173],  // "ㄍㄥ" => "geng"
-    &pinyin_table[179],  // "ㄍㄨ" => "gu"
-    &pinyin_table[180],  // "ㄍㄨㄚ" => "gua"
-    &pinyin_table[190],  // "ㄍㄨㄛ" => "guo"
-    &pinyin_table[182],  // "ㄍㄨㄞ" => "guai"
-    &pinyin_table[188],  // "ㄍㄨㄟ" => "gui"
-    &pinyin_table[184],  // "ㄍㄨㄢ" => "guan"
-    &pinyin_table[189],  // "ㄍㄨㄣ" => "gun"
-    &pinyin_table[185],  // "ㄍㄨㄤ" => "guang"
-    &pinyin_table[177],  // "ㄍㄨㄥ" => "gong"
-    &pinyin_table[254],  // "ㄎ" => "k"
-    &pinyin_table[255],  // "ㄎㄚ" => "ka"
-    &pinyin_table[262],  // "ㄎㄜ" => "ke"
-    &pinyin_table[257],  // "ㄎㄞ" => "kai"
-    &pinyin_table[264],  // "ㄎㄟ" => "kei"
-    &pinyin_table[261],  // "ㄎㄠ" => "kao"
-    &pinyin_table[272],  // "ㄎㄡ" => "kou"
-    &pinyin_table[259],  // "ㄎㄢ" => "kan"
-    &pinyin_table[266],  // "ㄎㄣ" => "ken"
-    &pinyin_table[260],  // "ㄎㄤ" => "kang"
-    &pinyin_table[267],  // "ㄎㄥ" => "keng"
-    &pinyin_table[273],  // "ㄎㄨ" => "ku"
-    &pinyin_table[274],  // "ㄎㄨㄚ" => "kua"
-    &pinyin_table[284],  // "ㄎㄨㄛ" => "kuo"
-    &pinyin_table[276],  // "ㄎㄨㄞ" => "kuai"
-    &pinyin_table[282],  // "ㄎㄨㄟ" => "kui"
-    &pinyin_table[278],  // "ㄎㄨㄢ" => "kuan"
-    &pinyin_table[283],  // "ㄎㄨㄣ" => "kun"
-    &pinyin_table[279],  // "ㄎㄨㄤ" => "kuang"
-    &pinyin_table[271],  // "ㄎㄨㄥ" => "kong"
-    &pinyin_table[191],  // "ㄏ" => "h"
-    &pinyin_table[192],  // "ㄏㄚ" => "ha"
-    &pinyin_table[205],  // "ㄏㄛ" => "ho"
-    &pinyin_table[199],  // "ㄏㄜ" => "he"
-    &pinyin_table[194],  // "ㄏㄞ" => "hai"
-    &pinyin_table[201],  // "ㄏㄟ" => "hei"
-    &pinyin_table[198],  // "ㄏㄠ" => "hao"
-    &pinyin_table[210],  // "ㄏㄡ" => "hou"
-    &pinyin_table[196],  // "ㄏㄢ" => "han"
-    &pinyin_table[203],  // "ㄏㄣ" => "hen"
-    &pinyin_table[197],  // "ㄏㄤ" => "hang"
-    &pinyin_table[204],  // "ㄏㄥ" => "heng"
-    &pinyin_table[211],  // "ㄏㄨ" => "hu"
-    &pinyin_table[212],  // "ㄏㄨㄚ" => "hua"
-    &pinyin_table[222],  // "ㄏㄨㄛ" => "huo"
-    &pinyin_table[214],  // "ㄏㄨㄞ" => "huai"
-    &pinyin_table[220],  // "ㄏㄨㄟ" => "hui"
-    &pinyin_table[216],  // "ㄏㄨㄢ" => "huan"
-    &pinyin_table[221],  // "ㄏㄨㄣ" => "hun"
-    &pinyin_table[217],  // "ㄏㄨㄤ" => "huang"
-    &pinyin_table[209],  // "ㄏㄨㄥ" => "hong"
-    &pinyin_table[223],  // "ㄐ" => "j"
-    &pinyin_table[224],  // "ㄐㄧ" => "ji"
-    &pinyin_table[225],  // "ㄐㄧㄚ" => "jia"
-    &pinyin_table[231],  // "ㄐㄧㄝ" => "jie"
-    &pinyin_table[230],  // "ㄐㄧㄠ" => "jiao"
-    &pinyin_table[241],  // "ㄐㄧㄡ" => "jiu"
-    &pinyin_table[228],  // "ㄐㄧㄢ" => "jian"
-    &pinyin_table[234],  // "ㄐㄧㄣ" => "jin"
-    &pinyin_table[229],  // "ㄐㄧㄤ" => "jiang"
-    &pinyin_table[235],  // "ㄐㄧㄥ" => "jing"
-    &pinyin_table[242],  // "ㄐㄩ" => "ju"
-    &pinyin_table[245],  // "ㄐㄩㄝ" => "jue"
-    &pinyin_table[243],  // "ㄐㄩㄢ" => "juan"
-    &pinyin_table[247],  // "ㄐㄩㄣ" => "jun"
-    &pinyin_table[244],  // "ㄐㄩㄤ" => "juang"
-    &pinyin_table[239],  // "ㄐㄩㄥ" => "jiong"
-    &pinyin_table[428],  // "ㄑ" => "q"
-    &pinyin_table[429],  // "ㄑㄧ" => "qi"
-    &pinyin_table[430],  // "ㄑㄧㄚ" => "qia"
-    &pinyin_table[436],  // "ㄑㄧㄝ" => "qie"
-    &pinyin_table[435],  // "ㄑㄧㄠ" => "qiao"
-    &pinyin_table[446],  // "ㄑㄧㄡ" => "qiu"
-    &pinyin_table[433],  // "ㄑㄧㄢ" => "qian"
-    &pinyin_table[439],  // "ㄑㄧㄣ" => "qin"
-    &pinyin_table[434],  // "ㄑㄧㄤ" => "qiang"
-    &pinyin_table[440],  // "ㄑㄧㄥ" => "qing"
-    &pinyin_table[447],  // "ㄑㄩ" => "qu"
-    &pinyin_table[450],  // "ㄑㄩㄝ" => "que"
-    &pinyin_table[448],  // "ㄑㄩㄢ" => "quan"
-    &pinyin_table[452],  // "ㄑㄩㄣ" => "qun"
-    &pinyin_table[449],  // "ㄑㄩㄤ" => "quang"
-    &pinyin_table[444],  // "ㄑㄩㄥ" => "qiong"
-    &pinyin_table[609],  // "ㄒ" => "x"
-    &pinyin_table[610],  // "ㄒㄧ" => "xi"
-    &pinyin_table[611],  // "ㄒㄧㄚ" => "xia"
-    &pinyin_table[617],  // "ㄒㄧㄝ" => "xie"
-    &pinyin_table[616],  // "ㄒㄧㄠ" => "xiao"
-    &pinyin_table[627],  // "ㄒㄧㄡ" => "xiu"
-    &pinyin_table[614],  // "ㄒㄧㄢ" => "xian"
-    &pinyin_table[620],  // "ㄒㄧㄣ" => "xin"
-    &pinyin_table[615],  // "ㄒㄧㄤ" => "xiang"
-    &pinyin_table[621],  // "ㄒㄧㄥ" => "xing"
-    &pinyin_table[628],  // "ㄒㄩ" => "xu"
-    &pinyin_table[631],  // "ㄒㄩㄝ" => "xue"
-    &pinyin_table[629],  // "ㄒㄩㄢ" => "xuan"
-    &pinyin_table[633],  // "ㄒㄩㄣ" => "xun"
-    &pinyin_table[630],  // "ㄒㄩㄤ" => "xuang"
-    &pinyin_table[625],  // "ㄒㄩㄥ" => "xiong"
-    &pinyin_table[699],  // "ㄓ" => "zhi"
-    &pinyin_table[686],  // "ㄓㄚ" => "zha"
-    &pinyin_table[693],  // "ㄓㄜ" => "zhe"
-    &pinyin_table[688],  // "ㄓㄞ" => "zhai"
-    &pinyin_table[695],  // "ㄓㄟ" => "zhei"
-    &pinyin_table[692],  // "ㄓㄠ" => "zhao"
-    &pinyin_table[704],  // "ㄓㄡ" => "zhou"
-    &pinyin_table[690],  // "ㄓㄢ" => "zhan"
-    &pinyin_table[697],  // "ㄓㄣ" => "zhen"
-    &pinyin_table[691],  // "ㄓㄤ" => "zhang"
-    &pinyin_table[698],  // "ㄓㄥ" => "zheng"
-    &pinyin_table[705],  // "ㄓㄨ" => "zhu"
-    &pinyin_table[706],  // "ㄓㄨㄚ" => "zhua"
-    &pinyin_table[716],  // "ㄓㄨㄛ" => "zhuo"
-    &pinyin_table[708],  // "ㄓㄨㄞ" => "zhuai"
-    &pinyin_table[714],  // "ㄓㄨㄟ" => "zhui"
-    &pinyin_table[710],  // "ㄓㄨㄢ" => "zhuan"
-    &pinyin_table[715],  // "ㄓㄨㄣ" => "zhun"
-    &pinyin_table[711],  // "ㄓㄨㄤ" => "zhuang"
-    &pinyin_table[703],  // "ㄓㄨㄥ" => "zhong"
-    &pinyin_table[57],   // "ㄔ" => "chi"
-    &pinyin_table[45],   // "ㄔㄚ" => "cha"
-    &pinyin_table[52],   // "ㄔㄜ" => "che"
-    &pinyin_table[47],   // "ㄔㄞ" => "chai"
-    &pinyin_table[51],   // "ㄔㄠ" => "chao"
-    &pinyin_table[62],   // "ㄔㄡ" => "chou"
-    &pinyin_table[49],   // "ㄔㄢ" => "chan"
-    &pinyin_table[55],   // "ㄔㄣ" => "chen"
-    &pinyin_table[50],   // "ㄔㄤ" => "chang"
-    &pinyin_table[56],   // "ㄔㄥ" => "cheng"
-    &pinyin_table[63],   // "ㄔㄨ" => "chu"
-    &pinyin_table[73],   // "ㄔㄨㄛ" => "chuo"
-    &pinyin_table[65],   // "ㄔㄨㄞ" => "chuai"
-    &pinyin_table[71],   // "ㄔㄨㄟ" => "chui"
-    &pinyin_table[67],   // "ㄔㄨㄢ" => "chuan"
-    &pinyin_table[72],   // "ㄔㄨㄣ" => "chun"
-    &pinyin_table[68],   // "ㄔㄨㄤ" => "chuang"
-    &pinyin_table[61],   // "ㄔㄨㄥ" => "chong"
-    &pinyin_table[528],  // "ㄕ" => "shi"
-    &pinyin_table[515],  // "ㄕㄚ" => "sha"
-    &pinyin_table[522],  // "ㄕㄜ" => "she"
-    &pinyin_table[517],  // "ㄕㄞ" => "shai"
-    &pinyin_table[524],  // "ㄕㄟ" => "shei"
-    &pinyin_table[521],  // "ㄕㄠ" => "shao"
-    &pinyin_table[531],  // "ㄕㄡ" => "shou"
-    &pinyin_table[519],  // "ㄕㄢ" => "shan"
-    &pinyin_table[526],  // "ㄕㄣ" => "shen"
-    &pinyin_table[520],  // "ㄕㄤ" => "shang"
-    &pinyin_table[527],  // "ㄕㄥ" => "sheng"
-    &pinyin_table[532],  // "ㄕㄨ" => "shu"
-    &pinyin_table[533],  // "ㄕㄨㄚ" => "shua"
-    &pinyin_table[543],  // "ㄕㄨㄛ" => "shuo"
-    &pinyin_table[535],  // "ㄕㄨㄞ" => "shuai"
-    &pinyin_table[541],  // "ㄕㄨㄟ" => "shui"
-    &pinyin_table[537],  // "ㄕㄨㄢ" => "shuan"
-    &pinyin_table[542],  // "ㄕㄨㄣ" => "shun"
-    &pinyin_table[538],  // "ㄕㄨㄤ" => "shuang"
-    &pinyin_table[530],  // "ㄕㄨㄥ" => "shong"
-    &pinyin_table[473],  // "ㄖ" => "ri"
-    &pinyin_table[460],  // "ㄖㄚ" => "ra"
-    &pinyin_table[483],  // "ㄖㄛ" => "ro"
-    &pinyin_table[467],  // "ㄖㄜ" => "re"
-    &pinyin_table[462],  // "ㄖㄞ" => "rai"
-    &pinyin_table[469],  // "ㄖㄟ" => "rei"
-    &pinyin_table[466],  // "ㄖㄠ" => "rao"
-    &pinyin_table[488],  // "ㄖㄡ" => "rou"
-    &pinyin_table[464],  // "ㄖㄢ" => "ran"
-    &pinyin_table[471],  // "ㄖㄣ" => "ren"
-    &pinyin_table[465],  // "ㄖㄤ" => "rang"
-    &pinyin_table[472],  // "ㄖㄥ" => "reng"
-    &pinyin_table[474],  // "ㄖㄧㄚ" => "ria"
-    &pinyin_table[478],  // "ㄖㄧㄝ" => "rie"
-    &pinyin_table[477],  // "ㄖㄧㄠ" => "riao"
-    &pinyin_table[482],  // "ㄖㄧㄡ" => "riu"
-    &pinyin_table[475],  // "ㄖㄧㄢ" => "rian"
-    &pinyin_table[479],  // "ㄖㄧㄣ" => "rin"
-    &pinyin_table[476],  // "ㄖㄧㄤ" => "riang"
-    &pinyin_table[480],  // "ㄖㄧㄥ" => "ring"
-    &pinyin_table[489],  // "ㄖㄨ" => "ru"
-    &pinyin_table[497],  // "ㄖㄨㄛ" => "ruo"
-    &pinyin_table[495],  // "ㄖㄨㄟ" => "rui"
-    &pinyin_table[490],  // "ㄖㄨㄢ" => "ruan"
-    &pinyin_table[496],  // "ㄖㄨㄣ" => "run"
-    &pinyin_table[491],  // "ㄖㄨㄤ" => "ruang"
-    &pinyin_table[487],  // "ㄖㄨㄥ" => "rong"
-    &pinyin_table[498],  // "ㄖㄩ" => "rv"
-    &pinyin_table[499],  // "ㄖㄩㄝ" => "rve"
-    &pinyin_table[717],  // "ㄗ" => "zi"
-    &pinyin_table[672],  // "ㄗㄚ" => "za"
-    &pinyin_table[679],  // "ㄗㄜ" => "ze"
-    &pinyin_table[674],  // "ㄗㄞ" => "zai"
-    &pinyin_table[681],  // "ㄗㄟ" => "zei"
-    &pinyin_table[678],  // "ㄗㄠ" => "zao"
-    &pinyin_table[722],  // "ㄗㄡ" => "zou"
-    &pinyin_table[676],  // "ㄗㄢ" => "zan"
-    &pinyin_table[683],  // "ㄗㄣ" => "zen"
-    &pinyin_table[677],  // "ㄗㄤ" => "zang"
-    &pinyin_table[684],  // "ㄗㄥ" => "zeng"
-    &pinyin_table[723],  // "ㄗㄨ" => "zu"
-    &pinyin_table[724],  // "ㄗㄨㄚ" => "zua"
-    &pinyin_table[732],  // "ㄗㄨㄛ" => "zuo"
-    &pinyin_table[725],  // "ㄗㄨㄞ" => "zuai"
-    &pinyin_table[730],  // "ㄗㄨㄟ" => "zui"
-    &pinyin_table[726],  // "ㄗㄨㄢ" => "zuan"
-    &pinyin_table[731],  // "ㄗㄨㄣ" => "zun"
-    &pinyin_table[727],  // "ㄗㄨㄤ" => "zuang"
-    &pinyin_table[721],  // "ㄗㄨㄥ" => "zong"
-    &pinyin_table[74],   // "ㄘ" => "ci"
-    &pinyin_table[32],   // "ㄘㄚ" => "ca"
-    &pinyin_table[39],   // "ㄘㄜ" => "ce"
-    &pinyin_table[34],   // "ㄘㄞ" => "cai"
-    &pinyin_table[38],   // "ㄘㄠ" => "cao"
-    &pinyin_table[79],   // "ㄘㄡ" => "cou"
-    &pinyin_table[36],   // "ㄘㄢ" => "can"
-    &pinyin_table[42],   // "ㄘㄣ" => "cen"
-    &pinyin_table[37],   // "ㄘㄤ" => "cang"
-    &pinyin_table[43],   // "ㄘㄥ" => "ceng"
-    &pinyin_table[80],   // "ㄘㄨ" => "cu"
-    &pinyin_table[88],   // "ㄘㄨㄛ" => "cuo"
-    &pinyin_table[81],   // "ㄘㄨㄞ" => "cuai"
-    &pinyin_table[86],   // "ㄘㄨㄟ" => "cui"
-    &pinyin_table[82],   // "ㄘㄨㄢ" => "cuan"
-    &pinyin_table[87],   // "ㄘㄨㄣ" => "cun"
-    &pinyin_table[83],   // "ㄘㄨㄤ" => "cuang"
-    &pinyin_table[78],   // "ㄘㄨㄥ" => "cong"
-    &pinyin_table[544],  // "ㄙ" => "si"
-    &pinyin_table[501],  // "ㄙㄚ" => "sa"
-    &pinyin_table[508],  // "ㄙㄜ" => "se"
-    &pinyin_table[503],  // "ㄙㄞ" => "sai"
-    &pinyin_table[510],  // "ㄙㄟ" => "sei"
-    &pinyin_table[507],  // "ㄙㄠ" => "sao"
-    &pinyin_table[549],  // "ㄙㄡ" => "sou"
-    &pinyin_table[505],  // "ㄙㄢ" => "san"
-    &pinyin_table[512],  // "ㄙㄣ" => "sen"
-    &pinyin_table[506],  // "ㄙㄤ" => "sang"
-    &pinyin_table[513],  // "ㄙㄥ" => "seng"
-    &pinyin_table[550],  // "ㄙㄨ" => "su"
-    &pinyin_table[551],  // "ㄙㄨㄚ" => "sua"
-    &pinyin_table[559],  // "ㄙㄨㄛ" => "suo"
-    &pinyin_table[552],  // "ㄙㄨㄞ" => "suai"
-    &pinyin_table[557],  // "ㄙㄨㄟ" => "sui"
-    &pinyin_table[553],  // "ㄙㄨㄢ" => "suan"
-    &pinyin_table[558],  // "ㄙㄨㄣ" => "sun"
-    &pinyin_table[554],  // "ㄙㄨㄤ" => "suang"
-    &pinyin_table[548],  // "ㄙㄨㄥ" => "song"
-    &pinyin_table[0],    // "ㄚ" => "a"
-    &pinyin_table[401],  // "ㄛ" => "o"
-    &pinyin_table[128],  // "ㄜ" => "e"
-    &pinyin_table[2],    // "ㄞ" => "ai"
-    &pinyin_table[129],  // "ㄟ" => "ei"
-    &pinyin_table[6],    // "ㄠ" => "ao"
-    &pinyin_table[402],  // "ㄡ" => "ou"
-    &pinyin_table[4],    // "ㄢ" => "an"
-    &pinyin_table[130],  // "ㄣ" => "en"
-    &pinyin_table[5],    // "ㄤ" => "ang"
-    &pinyin_table[131],  // "ㄦ" => "er"
-    &pinyin_table[648],  // "ㄧ" => "yi"
-    &pinyin_table[641],  // "ㄧㄚ" => "ya"
-    &pinyin_table[653],  // "ㄧㄛ" => "yo"
-    &pinyin_table[647],  // "ㄧㄝ" => "ye"
-    &pinyin_table[646],  // "ㄧㄠ" => "yao"
-    &pinyin_table[658],  // "ㄧㄡ" => "you"
-    &pinyin_table[644],  // "ㄧㄢ" => "yan"
-    &pinyin_table[651],  // "ㄧㄣ" => "yin"
-    &pinyin_table[645],  // "ㄧㄤ" => "yang"
-    &pinyin_table[652],  // "ㄧㄥ" => "ying"
-    &pinyin_table[661],  // "ㄧㄩㄤ" => "yuang"
-    &pinyin_table[608],  // "ㄨ" => "wu"
-    &pinyin_table[596],  // "ㄨㄚ" => "wa"
-    &pinyin_table[607],  // "ㄨㄛ" => "wo"
-    &pinyin_table[598],  // "ㄨㄞ" => "wai"
-    &pinyin_table[603],  // "ㄨㄟ" => "wei"
-    &pinyin_table[600],  // "ㄨㄢ" => "wan"
-    &pinyin_table[605],  // "ㄨㄣ" => "wen"
-    &pinyin_table[601],  // "ㄨㄤ" => "wang"
-    &pinyin_table[606],  // "ㄨㄥ" => "weng"
-    &pinyin_table[659],  // "ㄩ" => "yu"
-    &pinyin_table[662],  // "ㄩㄝ" => "yue"
-    &pinyin_table[660],  // "ㄩㄢ" => "yuan"
-    &pinyin_table[664],  // "ㄩㄣ" => "yun"
-    &pinyin_table[657],  // "ㄩㄥ" => "yong"
+static const PinyinTrieNode pinyin_trie[] = {
+    { 0x3cffeff,    1,   -1 },  /* 0 "" */
+    { 0x0007140,   24,    0 },  /* 1 "a" */
+    { 0x0104111,   29,    7 },  /* 2 "b" */
+    { 0x0104191,   34,   31 },  /* 3 "c" */
+    { 0x0104111,   40,   89 },  /* 4 "d" */
+    { 0x0022100,   45,  128 },  /* 5 "e" */
+    { 0x0104011,   48,  132 },  /* 6 "f" */
+    { 0x0104011,   52,  160 },  /* 7 "g" */
+    { 0x0104011,   56,  191 },  /* 8 "h" */
+    { 0x0300100,   60,  223 },  /* 9 "j" */
+    { 0x0104011,   63,  254 },  /* 10 "k" */
+    { 0x0304111,   67,  285 },  /* 11 "l" */
+    { 0x0104111,   73,  330 },  /* 12 "m" */
+    { 0x0304111,   78,  358 },  /* 13 "n" */
+    { 0x0100000,   84,  401 },  /* 14 "o" */
+    { 0x0104111,   85,  403 },  /* 15 "p" */
+    { 0x0300100,   90,  428 },  /* 16 "q" */
+    { 0x0304111,   93,  459 },  /* 17 "r" */
+    { 0x0104191,   99,  500 },  /* 18 "s" */
+    { 0x0104111,  105,  560 },  /* 19 "t" */
+    { 0x0104011,  110,  595 },  /* 20 "w" */
+    { 0x0300100,  114,  609 },  /* 21 "x" */
+    { 0x0304111,  117,  640 },  /* 22 "y" */
+    { 0x0104191,  123,  671 },  /* 23 "z" */
+    { 0x0002000,  129,   -1 },  /* 24 "ag" */
+    { 0x0000000,    0,    2 },  /* 25 "ai" */
+    { 0x0000040,  130,   -1 },  /* 26 "am" */
+    { 0x0000040,  131,    4 },  /* 27 "an" */
+    { 0x0000000,    0,    6 },  /* 28 "ao" */
+    { 0x0007140,  132,    8 },  /* 29 "ba" */
+    { 0x0003140,  137,   -1 },  /* 30 "be" */
+    { 0x0003051,  141,   20 },  /* 31 "bi" */
+    { 0x0000000,    0,   29 },  /* 32 "bo" */
+    { 0x0000000,    0,   30 },  /* 33 "bu" */
+    { 0x0007140,  146,   32 },  /* 34 "ca" */
+    { 0x0003040,  151,   39 },  /* 35 "ce" */
+    { 0x0104111,  154,   44 },  /* 36 "ch" */
+    { 0x0000000,    0,   74 },  /* 37 "ci" */
+    { 0x0103040,  159,   -1 },  /* 38 "co" */
+    { 0x0006111,  163,   80 },  /* 39 "cu" */
+    { 0x0007140,  168,   90 },  /* 40 "da" */
+    { 0x0003140,  173,   97 },  /* 41 "de" */
+    { 0x0107051,  177,  103 },  /* 42 "di" */
+    { 0x0103040,  184,   -1 },  /* 43 "do" */
+    { 0x0006111,  188,  120 },  /* 44 "du" */
+    { 0x0000000,    0,  129 },  /* 45 "ei" */
+    { 0x0000000,    0,  130 },  /* 46 "en" */
+    { 0x0000000,    0,  131 },  /* 47 "er" */
+    { 0x0007140,  193,  133 },  /* 48 "fa" */
+    { 0x0003140,  198,  140 },  /* 49 "fe" */
+    { 0x0102000,  202,  146 },  /* 50 "fo" */
+    { 0x0006111,  204,  150 },  /* 51 "fu" */
+    { 0x0007140,  209,  161 },  /* 52 "ga" */
+    { 0x0003140,  214,  168 },  /* 53 "ge" */
+    { 0x0103040,  218,   -1 },  /* 54 "go" */
+    { 0x0006111,  222,  179 },  /* 55 "gu" */
+    { 0x0007140,  227,  192 },  /* 56 "ha" */
+    { 0x0003140,  232,  199 },  /* 57 "he" */
+    { 0x0103040,  236,  205 },  /* 58 "ho" */
+    { 0x0006111,  240,  211 },  /* 59 "hu" */
+    { 0x0107051,  245,  224 },  /* 60 "ji" */
+    { 0x0002011,  252,  242 },  /* 61 "ju" */
+    { 0x0002011,  255,  248 },  /* 62 "jv" */
+    { 0x0007140,  258,  255 },  /* 63 "ka" */
+    { 0x0003140,  263,  262 },  /* 64 "ke" */
+    { 0x0103040,  267,   -1 },  /* 65 "ko" */
+    { 0x0006111,  271,  273 },  /* 66 "ku" */
+    { 0x0007140,  276,  286 },  /* 67 "la" */
+    { 0x0003140,  281,  293 },  /* 68 "le" */
+    { 0x0107051,  285,  299 },  /* 69 "li" */
+    { 0x0103040,  292,  313 },  /* 70 "lo" */
+    { 0x0006111,  296,  319 },  /* 71 "lu" */
+    { 0x0000010,  301,  328 },  /* 72 "lv" */
+    { 0x0007140,  302,  331 },  /* 73 "ma" */
+    { 0x0003140,  307,  338 },  /* 74 "me" */
+    { 0x0107051,  311,  344 },  /* 75 "mi" */
+    { 0x0100000,  318,  355 },  /* 76 "mo" */
+    { 0x0000000,    0,  357 },  /* 77 "mu" */
+    { 0x0007140,  319,  359 },  /* 78 "na" */
+    { 0x0003140,  324,  366 },  /* 79 "ne" */
+    { 0x0107051,  328,  372 },  /* 80 "ni" */
+    { 0x0103040,  335,  386 },  /* 81 "no" */
+    { 0x0006011,  339,  392 },  /* 82 "nu" */
+    { 0x0000010,  343,  399 },  /* 83 "nv" */
+    { 0x0000000,    0,  402 },  /* 84 "ou" */
+    { 0x0007140,  344,  404 },  /* 85 "pa" */
+    { 0x0003140,  349,   -1 },  /* 86 "pe" */
+    { 0x0003051,  353,  416 },  /* 87 "pi" */
+    { 0x0100000,  358,  425 },  /* 88 "po" */
+    { 0x0000000,    0,  427 },  /* 89 "pu" */
+    { 0x0107051,  359,  429 },  /* 90 "qi" */
+    { 0x0002011,  366,  447 },  /* 91 "qu" */
+    { 0x0002011,  369,  453 },  /* 92 "qv" */
+    { 0x0007140,  372,  460 },  /* 93 "ra" */
+    { 0x0003140,  377,  467 },  /* 94 "re" */
+    { 0x0106011,  381,  473 },  /* 95 "ri" */
+    { 0x0103040,  386,  483 },  /* 96 "ro" */
+    { 0x0006111,  390,  489 },  /* 97 "ru" */
+    { 0x0000010,  395,  498 },  /* 98 "rv" */
+    { 0x0007140,  396,  501 },  /* 99 "sa" */
+    { 0x0003140,  401,  508 },  /* 100 "se" */
+    { 0x0104111,  405,  514 },  /* 101 "sh" */
+    { 0x0000000,    0,  544 },  /* 102 "si" */
+    { 0x0103040,  410,   -1 },  /* 103 "so" */
+    { 0x0006111,  414,  550 },  /* 104 "su" */
+    { 0x0007140,  419,  561 },  /* 105 "ta" */
+    { 0x0003040,  424,  568 },  /* 106 "te" */
+    { 0x0003051,  427,  573 },  /* 107 "ti" */
+    { 0x0103040,  432,   -1 },  /* 108 "to" */
+    { 0x0006111,  436,  587 },  /* 109 "tu" */
+    { 0x0003140,  441,  596 },  /* 110 "wa" */
+    { 0x0003140,  445,   -1 },  /* 111 "we" */
+    { 0x0000000,    0,  607 },  /* 112 "wo" */
+    { 0x0000000,    0,  608 },  /* 113 "wu" */
+    { 0x0107051,  449,  610 },  /* 114 "xi" */
+    { 0x0002011,  456,  628 },  /* 115 "xu" */
+    { 0x0002011,  459,  634 },  /* 116 "xv" */
+    { 0x0007040,  462,  641 },  /* 117 "ya" */
+    { 0x0000000,    0,  647 },  /* 118 "ye" */
+    { 0x0003040,  466,  648 },  /* 119 "yi" */
+    { 0x0103040,  469,  653 },  /* 120 "yo" */
+    { 0x0002011,  473,  659 },  /* 121 "yu" */
+    { 0x0002011,  476,  665 },  /* 122 "yv" */
+    { 0x0007140,  479,  672 },  /* 123 "za" */
+    { 0x0003140,  484,  679 },  /* 124 "ze" */
+    { 0x0104111,  488,  685 },  /* 125 "zh" */
+    { 0x0000000,    0,  717 },  /* 126 "zi" */
+    { 0x0103040,  493,   -1 },  /* 127 "zo" */
+    { 0x0006111,  497,  723 },  /* 128 "zu" */
+    { 0x0000000,    0,    1 },  /* 129 "agn" */
+    { 0x0000000,    0,    3 },  /* 130 "amg" */
+    { 0x0000000,    0,    5 },  /* 131 "ang" */
+    { 0x0002000,  502,   -1 },  /* 132 "bag" */
+    { 0x0000000,    0,   10 },  /* 133 "bai" */
+    { 0x0000040,  503,   -1 },  /* 134 "bam" */
+    { 0x0000040,  504,   12 },  /* 135 "ban" */
+    { 0x0000000,    0,   14 },  /* 136 "bao" */
+    { 0x0002000,  505,   -1 },  /* 137 "beg" */
+    { 0x0000000,    0,   16 },  /* 138 "bei" */
+    { 0x0000040,  506,   -1 },  /* 139 "bem" */
+    { 0x0000040,  507,   18 },  /* 140 "ben" */
+    { 0x0006000,  508,   -1 },  /* 141 "bia" */
+    { 0x0000000,    0,   24 },  /* 142 "bie" */
+    { 0x0002000,  510,   -1 },  /* 143 "big" */
+    { 0x0000040,  511,   -1 },  /* 144 "bim" */
+    { 0x0000040,  512,   27 },  /* 145 "bin" */
+    { 0x0002000,  513,   -1 },  /* 146 "cag" */
+    { 0x0000000,    0,   34 },  /* 147 "cai" */
+    { 0x0000040,  514,   -1 },  /* 148 "cam" */
+    { 0x0000040,  515,   36 },  /* 149 "can" */
+    { 0x0000000,    0,   38 },  /* 150 "cao" */
+    { 0x0002000,  516,   -1 },  /* 151 "ceg" */
+    { 0x0000040,  517,   -1 },  /* 152 "cem" */
+    { 0x0000040,  518,   42 },  /* 153 "cen" */
+    { 0x0007140,  519,   45 },  /* 154 "cha" */
+    { 0x0003040,  524,   52 },  /* 155 "che" */
+    { 0x0000000,    0,   57 },  /* 156 "chi" */
+    { 0x0103040,  527,   -1 },  /* 157 "cho" */
+    { 0x0006111,  531,   63 },  /* 158 "chu" */
+    { 0x0002000,  536,   -1 },  /* 159 "cog" */
+    { 0x0000040,  537,   -1 },  /* 160 "com" */
+    { 0x0000040,  538,   77 },  /* 161 "con" */
+    { 0x0000000,    0,   79 },  /* 162 "cou" */
+    { 0x0002100,  539,   -1 },  /* 163 "cua" */
+    { 0x0002100,  541,   -1 },  /* 164 "cue" */
+    { 0x0000000,    0,   86 },  /* 165 "cui" */
+    { 0x0000000,    0,   87 },  /* 166 "cun" */
+    { 0x0000000,    0,   88 },  /* 167 "cuo" */
+    { 0x0002000,  543,   -1 },  /* 168 "dag" */
+    { 0x0000000,    0,   92 },  /* 169 "dai" */
+    { 0x0000040,  544,   -1 },  /* 170 "dam" */
+    { 0x0000040,  545,   94 },  /* 171 "dan" */
+    { 0x0000000,    0,   96 },  /* 172 "dao" */
+    { 0x0002000,  546,   -1 },  /* 173 "deg" */
+    { 0x0000000,    0,   99 },  /* 174 "dei" */
+    { 0x0000040,  547,   -1 },  /* 175 "dem" */
+    { 0x0000040,  548,  101 },  /* 176 "den" */
+    { 0x0006000,  549,  104 },  /* 177 "dia" */
+    { 0x0000000,    0,  108 },  /* 178 "die" */
+    { 0x0002000,  551,   -1 },  /* 179 "dig" */
+    { 0x0000040,  552,   -1 },  /* 180 "dim" */
+    { 0x0000040,  553,  111 },  /* 181 "din" */
+    { 0x0100000,  554,   -1 },  /* 182 "dio" */
+    { 0x0000000,    0,  114 },  /* 183 "diu" */
+    { 0x0002000,  555,   -1 },  /* 184 "dog" */
+    { 0x0000040,  556,   -1 },  /* 185 "dom" */
+    { 0x0000040,  557,  117 },  /* 186 "don" */
+    { 0x0000000,    0,  119 },  /* 187 "dou" */
+    { 0x0002000,  558,   -1 },  /* 188 "dua" */
+    { 0x0002100,  559,   -1 },  /* 189 "due" */
+    { 0x0000000,    0,  125 },  /* 190 "dui" */
+    { 0x0000000,    0,  126 },  /* 191 "dun" */
+    { 0x0000000,    0,  127 },  /* 192 "duo" */
+    { 0x0002000,  561,   -1 },  /* 193 "fag" */
+    { 0x0000000,    0,  135 },  /* 194 "fai" */
+    { 0x0000040,  562,   -1 },  /* 195 "fam" */
+    { 0x0000040,  563,  137 },  /* 196 "fan" */
+    { 0x0000000,    0,  139 },  /* 197 "fao" */
+    { 0x0002000,  564,   -1 },  /* 198 "feg" */
+    { 0x0000000,    0,  142 },  /* 199 "fei" */
+    { 0x0000040,  565,   -1 },  /* 200 "fem" */
+    { 0x0000040,  566,  144 },  /* 201 "fen" */
+    { 0x0000040,  567,  147 },  /* 202 "fon" */
+    { 0x0000000,    0,  149 },  /* 203 "fou" */
+    { 0x0002100,  568,  151 },  /* 204 "fua" */
+    { 0x0002100,  570,   -1 },  /* 205 "fue" */
+    { 0x0000000,    0,  157 },  /* 206 "fui" */
+    { 0x0000000,    0,  158 },  /* 207 "fun" */
+    { 0x0000000,    0,  159 },  /* 208 "fuo" */
+    { 0x0002000,  572,   -1 },  /* 209 "gag" */
+    { 0x0000000,    0,  163 },  /* 210 "gai" */
+    { 0x0000040,  573,   -1 },  /* 211 "gam" */
+    { 0x0000040,  574,  165 },  /* 212 "gan" */
+    { 0x0000000,    0,  167 },  /* 213 "gao" */
+    { 0x0002000,  575,   -1 },  /* 214 "geg" */
+    { 0x0000000,    0,  170 },  /* 215 "gei" */
+    { 0x0000040,  576,   -1 },  /* 216 "gem" */
+    { 0x0000040,  577,  172 },  /* 217 "gen" */
+    { 0x0002000,  578,   -1 },  /* 218 "gog" */
+    { 0x0000040,  579,   -1 },  /* 219 "gom" */
+    { 0x0000040,  580,  176 },  /* 220 "gon" */
+    { 0x0000000,    0,  178 },  /* 221 "gou" */
+    { 0x0003140,  581,  180 },  /* 222 "gua" */
+    { 0x0002100,  585,   -1 },  /* 223 "gue" */
+    { 0x0000000,    0,  188 },  /* 224 "gui" */
+    { 0x0000000,    0,  189 },  /* 225 "gun" */
+    { 0x0000000,    0,  190 },  /* 226 "guo" */
+    { 0x0002000,  587,   -1 },  /* 227 "hag" */
+    { 0x0000000,    0,  194 },  /* 228 "hai" */
+    { 0x0000040,  588,   -1 },  /* 229 "ham" */
+    { 0x0000040,  589,  196 },  /* 230 "han" */
+    { 0x0000000,    0,  198 },  /* 231 "hao" */
+    { 0x0002000,  590,   -1 },  /* 232 "heg" */
+    { 0x0000000,    0,  201 },  /* 233 "hei" */
+    { 0x0000040,  591,   -1 },  /* 234 "hem" */
+    { 0x0000040,  592,  203 },  /* 235 "hen" */
+    { 0x0002000,  593,   -1 },  /* 236 "hog" */
+    { 0x0000040,  594,   -1 },  /* 237 "hom" */
+    { 0x0000040,  595,  208 },  /* 238 "hon" */
+    { 0x0000000,    0,  210 },  /* 239 "hou" */
+    { 0x0003140,  596,  212 },  /* 240 "hua" */
+    { 0x0002100,  600,   -1 },  /* 241 "hue" */
+    { 0x0000000,    0,  220 },  /* 242 "hui" */
+    { 0x0000000,    0,  221 },  /* 243 "hun" */
+    { 0x0000000,    0,  222 },  /* 244 "huo" */
+    { 0x0007040,  602,  225 },  /* 245 "jia" */
+    { 0x0000000,    0,  231 },  /* 246 "jie" */
+    { 0x0002000,  606,   -1 },  /* 247 "jig" */
+    { 0x0000040,  607,   -1 },  /* 248 "jim" */
+    { 0x0000040,  608,  234 },  /* 249 "jin" */
+    { 0x0103040,  609,   -1 },  /* 250 "jio" */
+    { 0x0000000,    0,  241 },  /* 251 "jiu" */
+    { 0x0002000,  613,   -1 },  /* 252 "jua" */
+    { 0x0002000,  614,  245 },  /* 253 "jue" */
+    { 0x0000000,    0,  247 },  /* 254 "jun" */
+    { 0x0002000,  615,   -1 },  /* 255 "jva" */
+    { 0x0002000,  616,  251 },  /* 256 "jve" */
+    { 0x0000000,    0,  253 },  /* 257 "jvn" */
+    { 0x0002000,  617,   -1 },  /* 258 "kag" */
+    { 0x0000000,    0,  257 },  /* 259 "kai" */
+    { 0x0000040,  618,   -1 },  /* 260 "kam" */
+    { 0x0000040,  619,  259 },  /* 261 "kan" */
+    { 0x0000000,    0,  261 },  /* 262 "kao" */
+    { 0x0002000,  620,   -1 },  /* 263 "keg" */
+    { 0x0000000,    0,  264 },  /* 264 "kei" */
+    { 0x0000040,  621,   -1 },  /* 265 "kem" */
+    { 0x0000040,  622,  266 },  /* 266 "ken" */
+    { 0x0002000,  623,   -1 },  /* 267 "kog" */
+    { 0x0000040,  624,   -1 },  /* 268 "kom" */
+    { 0x0000040,  625,  270 },  /* 269 "kon" */
+    { 0x0000000,    0,  272 },  /* 270 "kou" */
+    { 0x0003140,  626,  274 },  /* 271 "kua" */
+    { 0x0002100,  630,   -1 },  /* 272 "kue" */
+    { 0x0000000,    0,  282 },  /* 273 "kui" */
+    { 0x0000000,    0,  283 },  /* 274 "kun" */
+    { 0x0000000,    0,  284 },  /* 275 "kuo" */
+    { 0x0002000,  632,   -1 },  /* 276 "lag" */
+    { 0x0000000,    0,  288 },  /* 277 "lai" */
+    { 0x0000040,  633,   -1 },  /* 278 "lam" */
+    { 0x0000040,  634,  290 },  /* 279 "lan" */
+    { 0x0000000,    0,  292 },  /* 280 "lao" */
+    { 0x0002000,  635,   -1 },  /* 281 "leg" */
+    { 0x0000000,    0,  295 },  /* 282 "lei" */
+    { 0x0000040,  636,   -1 },  /* 283 "lem" */
+    { 0x0000040,  637,  297 },  /* 284 "len" */
+    { 0x0007040,  638,  300 },  /* 285 "lia" */
+    { 0x0000000,    0,  306 },  /* 286 "lie" */
+    { 0x0002000,  642,   -1 },  /* 287 "lig" */
+    { 0x0000040,  643,   -1 },  /* 288 "lim" */
+    { 0x0000040,  644,  309 },  /* 289 "lin" */
+    { 0x0100000,  645,   -1 },  /* 290 "lio" */
+    { 0x0000000,    0,  312 },  /* 291 "liu" */
+    { 0x0002000,  646,   -1 },  /* 292 "log" */
+    { 0x0000040,  647,   -1 },  /* 293 "lom" */
+    { 0x0000040,  648,  316 },  /* 294 "lon" */
+    { 0x0000000,    0,  318 },  /* 295 "lou" */
+    { 0x0002000,  649,   -1 },  /* 296 "lua" */
+    { 0x0002100,  650,  322 },  /* 297 "lue" */
+    { 0x0000000,    0,  325 },  /* 298 "lui" */
+    { 0x0000000,    0,  326 },  /* 299 "lun" */
+    { 0x0000000,    0,  327 },  /* 300 "luo" */
+    { 0x0000000,    0,  329 },  /* 301 "lve" */
+    { 0x0002000,  652,   -1 },  /* 302 "mag" */
+    { 0x0000000,    0,  333 },  /* 303 "mai" */
+    { 0x0000040,  653,   -1 },  /* 304 "mam" */
+    { 0x0000040,  654,  335 },  /* 305 "man" */
+    { 0x0000000,    0,  337 },  /* 306 "mao" */
+    { 0x0002000,  655,   -1 },  /* 307 "meg" */
+    { 0x0000000,    0,  340 },  /* 308 "mei" */
+    { 0x0000040,  656,   -1 },  /* 309 "mem" */
+    { 0x0000040,  657,  342 },  /* 310 "men" */
+    { 0x0006000,  658,   -1 },  /* 311 "mia" */
+    { 0x0000000,    0,  348 },  /* 312 "mie" */
+    { 0x0002000,  660,   -1 },  /* 313 "mig" */
+    { 0x0000040,  661,   -1 },  /* 314 "mim" */
+    { 0x0000040,  662,  351 },  /* 315 "min" */
+    { 0x0100000,  663,   -1 },  /* 316 "mio" */
+    { 0x0000000,    0,  354 },  /* 317 "miu" */
+    { 0x0000000,    0,  356 },  /* 318 "mou" */
+    { 0x0002000,  664,   -1 },  /* 319 "nag" */
+    { 0x0000000,    0,  361 },  /* 320 "nai" */
+    { 0x0000040,  665,   -1 },  /* 321 "nam" */
+    { 0x0000040,  666,  363 },  /* 322 "nan" */
+    { 0x0000000,    0,  365 },  /* 323 "nao" */
+    { 0x0002000,  667,   -1 },  /* 324 "neg" */
+    { 0x0000000,    0,  368 },  /* 325 "nei" */
+    { 0x0000040,  668,   -1 },  /* 326 "nem" */
+    { 0x0000040,  669,  370 },  /* 327 "nen" */
+    { 0x0007040,  670,  373 },  /* 328 "nia" */
+    { 0x0000000,    0,  379 },  /* 329 "nie" */
+    { 0x0002000,  674,   -1 },  /* 330 "nig" */
+    { 0x0000040,  675,   -1 },  /* 331 "nim" */
+    { 0x0000040,  676,  382 },  /* 332 "nin" */
+    { 0x0100000,  677,   -1 },  /* 333 "nio" */
+    { 0x0000000,    0,  385 },  /* 334 "niu" */
+    { 0x0002000,  678,   -1 },  /* 335 "nog" */
+    { 0x0000040,  679,   -1 },  /* 336 "nom" */
+    { 0x0000040,  680,  389 },  /* 337 "non" */
+    { 0x0000000,    0,  391 },  /* 338 "nou" */
+    { 0x0002000,  681,   -1 },  /* 339 "nua" */
+    { 0x0002000,  682,  395 },  /* 340 "nue" */
+    { 0x0000000,    0,  397 },  /* 341 "nun" */
+    { 0x0000000,    0,  398 },  /* 342 "nuo" */
+    { 0x0000000,    0,  400 },  /* 343 "nve" */
+    { 0x0002000,  683,   -1 },  /* 344 "pag" */
+    { 0x0000000,    0,  406 },  /* 345 "pai" */
+    { 0x0000040,  684,   -1 },  /* 346 "pam" */
+    { 0x0000040,  685,  408 },  /* 347 "pan" */
+    { 0x0000000,    0,  410 },  /* 348 "pao" */
+    { 0x0002000,  686,   -1 },  /* 349 "peg" */
+    { 0x0000000,    0,  412 },  /* 350 "pei" */
+    { 0x0000040,  687,   -1 },  /* 351 "pem" */
+    { 0x0000040,  688,  414 },  /* 352 "pen" */
+    { 0x0006000,  689,   -1 },  /* 353 "pia" */
+    { 0x0000000,    0,  420 },  /* 354 "pie" */
+    { 0x0002000,  691,   -1 },  /* 355 "pig" */
+    { 0x0000040,  692,   -1 },  /* 356 "pim" */
+    { 0x0000040,  693,  423 },  /* 357 "pin" */
+    { 0x0000000,    0,  426 },  /* 358 "pou" */
+    { 0x0007040,  694,  430 },  /* 359 "qia" */
+    { 0x0000000,    0,  436 },  /* 360 "qie" */
+    { 0x0002000,  698,   -1 },  /* 361 "qig" */
+    { 0x0000040,  699,   -1 },  /* 362 "qim" */
+    { 0x0000040,  700,  439 },  /* 363 "qin" */
+    { 0x0103040,  701,   -1 },  /* 364 "qio" */
+    { 0x0000000,    0,  446 },  /* 365 "qiu" */
+    { 0x0002000,  705,   -1 },  /* 366 "qua" */
+    { 0x0002000,  706,  450 },  /* 367 "que" */
+    { 0x0000000,    0,  452 },  /* 368 "qun" */
+    { 0x0002000,  707,   -1 },  /* 369 "qva" */
+    { 0x0002000,  708,  456 },  /* 370 "qve" */
+    { 0x0000000,    0,  458 },  /* 371 "qvn" */
+    { 0x0002000,  709,   -1 },  /* 372 "rag" */
+    { 0x0000000,    0,  462 },  /* 373 "rai" */
+    { 0x0000040,  710,   -1 },  /* 374 "ram" */
+    { 0x0000040,  711,  464 },  /* 375 "ran" */
+    { 0x0000000,    0,  466 },  /* 376 "rao" */
+    { 0x0002000,  712,   -1 },  /* 377 "reg" */
+    { 0x0000000,    0,  469 },  /* 378 "rei" */
+    { 0x0000040,  713,   -1 },  /* 379 "rem" */
+    { 0x0000040,  714,  471 },  /* 380 "ren" */
+    { 0x0006000,  715,  474 },  /* 381 "ria" */
+    { 0x0000000,    0,  478 },  /* 382 "rie" */
+    { 0x0000040,  717,  479 },  /* 383 "rin" */
+    { 0x0100000,  718,   -1 },  /* 384 "rio" */
+    { 0x0000000,    0,  482 },  /* 385 "riu" */
+    { 0x0002000,  719,   -1 },  /* 386 "rog" */
+    { 0x0000040,  720,   -1 },  /* 387 "rom" */
+    { 0x0000040,  721,  486 },  /* 388 "ron" */
+    { 0x0000000,    0,  488 },  /* 389 "rou" */
+    { 0x0002000,  722,   -1 },  /* 390 "rua" */
+    { 0x0002100,  723,  492 },  /* 391 "rue" */
+    { 0x0000000,    0,  495 },  /* 392 "rui" */
+    { 0x0000000,    0,  496 },  /* 393 "run" */
+    { 0x0000000,    0,  497 },  /* 394 "ruo" */
+    { 0x0000000,    0,  499 },  /* 395 "rve" */
+    { 0x0002000,  725,   -1 },  /* 396 "sag" */
+    { 0x0000000,    0,  503 },  /* 397 "sai" */
+    { 0x0000040,  726,   -1 },  /* 398 "sam" */
+    { 0x0000040,  727,  505 },  /* 399 "san" */
+    { 0x0000000,    0,  507 },  /* 400 "sao" */
+    { 0x0002000,  728,   -1 },  /* 401 "seg" */
+    { 0x0000000,    0,  510 },  /* 402 "sei" */
+    { 0x0000040,  729,   -1 },  /* 403 "sem" */
+    { 0x0000040,  730,  512 },  /* 404 "sen" */
+    { 0x0007140,  731,  515 },  /* 405 "sha" */
+    { 0x0003140,  736,  522 },  /* 406 "she" */
+    { 0x0000000,    0,  528 },  /* 407 "shi" */
+    { 0x0102000,  740,   -1 },  /* 408 "sho" */
+    { 0x0006111,  742,  532 },  /* 409 "shu" */
+    { 0x0002000,  747,   -1 },  /* 410 "sog" */
+    { 0x0000040,  748,   -1 },  /* 411 "som" */
+    { 0x0000040,  749,  547 },  /* 412 "son" */
+    { 0x0000000,    0,  549 },  /* 413 "sou" */
+    { 0x0002100,  750,  551 },  /* 414 "sua" */
+    { 0x0002100,  752,   -1 },  /* 415 "sue" */
+    { 0x0000000,    0,  557 },  /* 416 "sui" */
+    { 0x0000000,    0,  558 },  /* 417 "sun" */
+    { 0x0000000,    0,  559 },  /* 418 "suo" */
+    { 0x0002000,  754,   -1 },  /* 419 "tag" */
+    { 0x0000000,    0,  563 },  /* 420 "tai" */
+    { 0x0000040,  755,   -1 },  /* 421 "tam" */
+    { 0x0000040,  756,  565 },  /* 422 "tan" */
+    { 0x0000000,    0,  567 },  /* 423 "tao" */
+    { 0x0002000,  757,   -1 },  /* 424 "teg" */
+    { 0x0000040,  758,   -1 },  /* 425 "tem" */
+    { 0x0000040,  759,  571 },  /* 426 "ten" */
+    { 0x0006000,  760,   -1 },  /* 427 "tia" */
+    { 0x0000000,    0,  577 },  /* 428 "tie" */
+    { 0x0002000,  762,   -1 },  /* 429 "tig" */
+    { 0x0000040,  763,   -1 },  /* 430 "tim" */
+    { 0x0000040,  764,  580 },  /* 431 "tin" */
+    { 0x0002000,  765,   -1 },  /* 432 "tog" */
+    { 0x0000040,  766,   -1 },  /* 433 "tom" */
+    { 0x0000040,  767,  584 },  /* 434 "ton" */
+    { 0x0000000,    0,  586 },  /* 435 "tou" */
+    { 0x0002000,  768,   -1 },  /* 436 "tua" */
+    { 0x0002100,  769,   -1 },  /* 437 "tue" */
+    { 0x0000000,    0,  592 },  /* 438 "tui" */
+    { 0x0000000,    0,  593 },  /* 439 "tun" */
+    { 0x0000000,    0,  594 },  /* 440 "tuo" */
+    { 0x0002000,  771,   -1 },  /* 441 "wag" */
+    { 0x0000000,    0,  598 },  /* 442 "wai" */
+    { 0x0000040,  772,   -1 },  /* 443 "wam" */
+    { 0x0000040,  773,  600 },  /* 444 "wan" */
+    { 0x0002000,  774,   -1 },  /* 445 "weg" */
+    { 0x0000000,    0,  603 },  /* 446 "wei" */
+    { 0x0000040,  775,   -1 },  /* 447 "wem" */
+    { 0x0000040,  776,  605 },  /* 448 "wen" */
+    { 0x0007040,  777,  611 },  /* 449 "xia" */
+    { 0x0000000,    0,  617 },  /* 450 "xie" */
+    { 0x0002000,  781,   -1 },  /* 451 "xig" */
+    { 0x0000040,  782,   -1 },  /* 452 "xim" */
+    { 0x0000040,  783,  620 },  /* 453 "xin" */
+    { 0x0103040,  784,   -1 },  /* 454 "xio" */
+    { 0x0000000,    0,  627 },  /* 455 "xiu" */
+    { 0x0002000,  788,   -1 },  /* 456 "xua" */
+    { 0x0002000,  789,  631 },  /* 457 "xue" */
+    { 0x0000000,    0,  633 },  /* 458 "xun" */
+    { 0x0002000,  790,   -1 },  /* 459 "xva" */
+    { 0x0002000,  791,  637 },  /* 460 "xve" */
+    { 0x0000000,    0,  639 },  /* 461 "xvn" */
+    { 0x0002000,  792,   -1 },  /* 462 "yag" */
+    { 0x0000040,  793,   -1 },  /* 463 "yam" */
+    { 0x0000040,  794,  644 },  /* 464 "yan" */
+    { 0x0000000,    0,  646 },  /* 465 "yao" */
+    { 0x0002000,  795,   -1 },  /* 466 "yig" */
+    { 0x0000040,  796,   -1 },  /* 467 "yim" */
+    { 0x0000040,  797,  651 },  /* 468 "yin" */
+    { 0x0002000,  798,   -1 },  /* 469 "yog" */
+    { 0x0000040,  799,   -1 },  /* 470 "yom" */
+    { 0x0000040,  800,  656 },  /* 471 "yon" */
+    { 0x0000000,    0,  658 },  /* 472 "you" */
+    { 0x0002000,  801,   -1 },  /* 473 "yua" */
+    { 0x0002000,  802,  662 },  /* 474 "yue" */
+    { 0x0000000,    0,  664 },  /* 475 "yun" */
+    { 0x0002000,  803,   -1 },  /* 476 "yva" */
+    { 0x0002000,  804,  668 },  /* 477 "yve" */
+    { 0x0000000,    0,  670 },  /* 478 "yvn" */
+    { 0x0002000,  805,   -1 },  /* 479 "zag" */
+    { 0x0000000,    0,  674 },  /* 480 "zai" */
+    { 0x0000040,  806,   -1 },  /* 481 "zam" */
+    { 0x0000040,  807,  676 },  /* 482 "zan" */
+    { 0x0000000,    0,  678 },  /* 483 "zao" */
+    { 0x0002000,  808,   -1 },  /* 484 "zeg" */
+    { 0x0000000,    0,  681 },  /* 485 "zei" */
+    { 0x0000040,  809,   -1 },  /* 486 "zem" */
+    { 0x0000040,  810,  683 },  /* 487 "zen" */
+    { 0x0007140,  811,  686 },  /* 488 "zha" */
+    { 0x0003140,  816,  693 },  /* 489 "zhe" */
+    { 0x0000000,    0,  699 },  /* 490 "zhi" */
+    { 0x0103040,  820,   -1 },  /* 491 "zho" */
+    { 0x0006111,  824,  705 },  /* 492 "zhu" */
+    { 0x0002000,  829,   -1 },  /* 493 "zog" */
+    { 0x0000040,  830,   -1 },  /* 494 "zom" */
+    { 0x0000040,  831,  720 },  /* 495 "zon" */
+    { 0x0000000,    0,  722 },  /* 496 "zou" */
+    { 0x0002100,  832,  724 },  /* 497 "zua" */
+    { 0x0002100,  834,   -1 },  /* 498 "zue" */
+    { 0x0000000,    0,  730 },  /* 499 "zui" */
+    { 0x0000000,    0,  731 },  /* 500 "zun" */
+    { 0x0000000,    0,  732 },  /* 501 "zuo" */
+    { 0x0000000,    0,    9 },  /* 502 "bagn" */
+    { 0x0000000,    0,   11 },  /* 503 "bamg" */
+    { 0x0000000,    0,   13 },  /* 504 "bang" */
+    { 0x0000000,    0,   15 },  /* 505 "begn" */
+    { 0x0000000,    0,   17 },  /* 506 "bemg" */
+    { 0x0000000,    0,   19 },  /* 507 "beng" */
+    { 0x0000040,  836,   21 },  /* 508 "bian" */
+    { 0x0000000,    0,   23 },  /* 509 "biao" */
+    { 0x0000000,    0,   25 },  /* 510 "bign" */
+    { 0x0000000,    0,   26 },  /* 511 "bimg" */
+    { 0x0000000,    0,   28 },  /* 512 "bing" */
+    { 0x0000000,    0,   33 },  /* 513 "cagn" */
+    { 0x0000000,    0,   35 },  /* 514 "camg" */
+    { 0x0000000,    0,   37 },  /* 515 "cang" */
+    { 0x0000000,    0,   40 },  /* 516 "cegn" */
+    { 0x0000000,    0,   41 },  /* 517 "cemg" */
+    { 0x0000000,    0,   43 },  /* 518 "ceng" */
+    { 0x0002000,  837,   -1 },  /* 519 "chag" */
+    { 0x0000000,    0,   47 },  /* 520 "chai" */
+    { 0x0000040,  838,   -1 },  /* 521 "cham" */
+    { 0x0000040,  839,   49 },  /* 522 "chan" */
+    { 0x0000000,    0,   51 },  /* 523 "chao" */
+    { 0x0002000,  840,   -1 },  /* 524 "cheg" */
+    { 0x0000040,  841,   -1 },  /* 525 "chem" */
+    { 0x0000040,  842,   55 },  /* 526 "chen" */
+    { 0x0002000,  843,   -1 },  /* 527 "chog" */
+    { 0x0000040,  844,   -1 },  /* 528 "chom" */
+    { 0x0000040,  845,   60 },  /* 529 "chon" */
+    { 0x0000000,    0,   62 },  /* 530 "chou" */
+    { 0x0003140,  846,   -1 },  /* 531 "chua" */
+    { 0x0002100,  850,   -1 },  /* 532 "chue" */
+    { 0x0000000,    0,   71 },  /* 533 "chui" */
+    { 0x0000000,    0,   72 },  /* 534 "chun" */
+    { 0x0000000,    0,   73 },  /* 535 "chuo" */
+    { 0x0000000,    0,   75 },  /* 536 "cogn" */
+    { 0x0000000,    0,   76 },  /* 537 "comg" */
+    { 0x0000000,    0,   78 },  /* 538 "cong" */
+    { 0x0000000,    0,   81 },  /* 539 "cuai" */
+    { 0x0000040,  852,   82 },  /* 540 "cuan" */
+    { 0x0000000,    0,   84 },  /* 541 "cuei" */
+    { 0x0000000,    0,   85 },  /* 542 "cuen" */
+    { 0x0000000,    0,   91 },  /* 543 "dagn" */
+    { 0x0000000,    0,   93 },  /* 544 "damg" */
+    { 0x0000000,    0,   95 },  /* 545 "dang" */
+    { 0x0000000,    0,   98 },  /* 546 "degn" */
+    { 0x0000000,    0,  100 },  /* 547 "demg" */
+    { 0x0000000,    0,  102 },  /* 548 "deng" */
+    { 0x0000040,  853,  105 },  /* 549 "dian" */
+    { 0x0000000,    0,  107 },  /* 550 "diao" */
+    { 0x0000000,    0,  109 },  /* 551 "dign" */
+    { 0x0000000,    0,  110 },  /* 552 "dimg" */
+    { 0x0000000,    0,  112 },  /* 553 "ding" */
+    { 0x0000000,    0,  113 },  /* 554 "diou" */
+    { 0x0000000,    0,  115 },  /* 555 "dogn" */
+    { 0x0000000,    0,  116 },  /* 556 "domg" */
+    { 0x0000000,    0,  118 },  /* 557 "dong" */
+    { 0x0000040,  854,  121 },  /* 558 "duan" */
+    { 0x0000000,    0,  123 },  /* 559 "duei" */
+    { 0x0000000,    0,  124 },  /* 560 "duen" */
+    { 0x0000000,    0,  134 },  /* 561 "fagn" */
+    { 0x0000000,    0,  136 },  /* 562 "famg" */
+    { 0x0000000,    0,  138 },  /* 563 "fang" */
+    { 0x0000000,    0,  141 },  /* 564 "fegn" */
+    { 0x0000000,    0,  143 },  /* 565 "femg" */
+    { 0x0000000,    0,  145 },  /* 566 "feng" */
+    { 0x0000000,    0,  148 },  /* 567 "fong" */
+    { 0x0000000,    0,  152 },  /* 568 "fuai" */
+    { 0x0000040,  855,  153 },  /* 569 "fuan" */
+    { 0x0000000,    0,  155 },  /* 570 "fuei" */
+    { 0x0000000,    0,  156 },  /* 571 "fuen" */
+    { 0x0000000,    0,  162 },  /* 572 "gagn" */
+    { 0x0000000,    0,  164 },  /* 573 "gamg" */
+    { 0x0000000,    0,  166 },  /* 574 "gang" */
+    { 0x0000000,    0,  169 },  /* 575 "gegn" */
+    { 0x0000000,    0,  171 },  /* 576 "gemg" */
+    { 0x0000000,    0,  173 },  /* 577 "geng" */
+    { 0x0000000,    0,  174 },  /* 578 "gogn" */
+    { 0x0000000,    0,  175 },  /* 579 "gomg" */
+    { 0x0000000,    0,  177 },  /* 580 "gong" */
+    { 0x0002000,  856,   -1 },  /* 581 "guag" */
+    { 0x0000000,    0,  182 },  /* 582 "guai" */
+    { 0x0000040,  857,   -1 },  /* 583 "guam" */
+    { 0x0000040,  858,  184 },  /* 584 "guan" */
+    { 0x0000000,    0,  186 },  /* 585 "guei" */
+    { 0x0000000,    0,  187 },  /* 586 "guen" */
+    { 0x0000000,    0,  193 },  /* 587 "hagn" */
+    { 0x0000000,    0,  195 },  /* 588 "hamg" */
+    { 0x0000000,    0,  197 },  /* 589 "hang" */
+    { 0x0000000,    0,  200 },  /* 590 "hegn" */
+    { 0x0000000,    0,  202 },  /* 591 "hemg" */
+    { 0x0000000,    0,  204 },  /* 592 "heng" */
+    { 0x0000000,    0,  206 },  /* 593 "hogn" */
+    { 0x0000000,    0,  207 },  /* 594 "homg" */
+    { 0x0000000,    0,  209 },  /* 595 "hong" */
+    { 0x0002000,  859,   -1 },  /* 596 "huag" */
+    { 0x0000000,    0,  214 },  /* 597 "huai" */
+    { 0x0000040,  860,   -1 },  /* 598 "huam" */
+    { 0x0000040,  861,  216 },  /* 599 "huan" */
+    { 0x0000000,    0,  218 },  /* 600 "huei" */
+    { 0x0000000,    0,  219 },  /* 601 "huen" */
+    { 0x0002000,  862,   -1 },  /* 602 "jiag" */
+    { 0x0000040,  863,   -1 },  /* 603 "jiam" */
+    { 0x0000040,  864,  228 },  /* 604 "jian" */
+    { 0x0000000,    0,  230 },  /* 605 "jiao" */
+    { 0x0000000,    0,  232 },  /* 606 "jign" */
+    { 0x0000000,    0,  233 },  /* 607 "jimg" */
+    { 0x0000000,    0,  235 },  /* 608 "jing" */
+    { 0x0002000,  865,   -1 },  /* 609 "jiog" */
+    { 0x0000040,  866,   -1 },  /* 610 "jiom" */
+    { 0x0000040,  867,  238 },  /* 611 "jion" */
+    { 0x0000000,    0,  240 },  /* 612 "jiou" */
+    { 0x0000040,  868,  243 },  /* 613 "juan" */
+    { 0x0000000,    0,  246 },  /* 614 "juen" */
+    { 0x0000040,  869,  249 },  /* 615 "jvan" */
+    { 0x0000000,    0,  252 },  /* 616 "jven" */
+    { 0x0000000,    0,  256 },  /* 617 "kagn" */
+    { 0x0000000,    0,  258 },  /* 618 "kamg" */
+    { 0x0000000,    0,  260 },  /* 619 "kang" */
+    { 0x0000000,    0,  263 },  /* 620 "kegn" */
+    { 0x0000000,    0,  265 },  /* 621 "kemg" */
+    { 0x0000000,    0,  267 },  /* 622 "keng" */
+    { 0x0000000,    0,  268 },  /* 623 "kogn" */
+    { 0x0000000,    0,  269 },  /* 624 "komg" */
+    { 0x0000000,    0,  271 },  /* 625 "kong" */
+    { 0x0002000,  870,   -1 },  /* 626 "kuag" */
+    { 0x0000000,    0,  276 },  /* 627 "kuai" */
+    { 0x0000040,  871,   -1 },  /* 628 "kuam" */
+    { 0x0000040,  872,  278 },  /* 629 "kuan" */
+    { 0x0000000,    0,  280 },  /* 630 "kuei" */
+    { 0x0000000,    0,  281 },  /* 631 "kuen" */
+    { 0x0000000,    0,  287 },  /* 632 "lagn" */
+    { 0x0000000,    0,  289 },  /* 633 "lamg" */
+    { 0x0000000,    0,  291 },  /* 634 "lang" */
+    { 0x0000000,    0,  294 },  /* 635 "legn" */
+    { 0x0000000,    0,  296 },  /* 636 "lemg" */
+    { 0x0000000,    0,  298 },  /* 637 "leng" */
+    { 0x0002000,  873,   -1 },  /* 638 "liag" */
+    { 0x0000040,  874,   -1 },  /* 639 "liam" */
+    { 0x0000040,  875,  303 },  /* 640 "lian" */
+    { 0x0000000,    0,  305 },  /* 641 "liao" */
+    { 0x0000000,    0,  307 },  /* 642 "lign" */
+    { 0x0000000,    0,  308 },  /* 643 "limg" */
+    { 0x0000000,    0,  310 },  /* 644 "ling" */
+    { 0x0000000,    0,  311 },  /* 645 "liou" */
+    { 0x0000000,    0,  314 },  /* 646 "logn" */
+    { 0x0000000,    0,  315 },  /* 647 "lomg" */
+    { 0x0000000,    0,  317 },  /* 648 "long" */
+    { 0x0000040,  876,  320 },  /* 649 "luan" */
+    { 0x0000000,    0,  323 },  /* 650 "luei" */
+    { 0x0000000,    0,  324 },  /* 651 "luen" */
+    { 0x0000000,    0,  332 },  /* 652 "magn" */
+    { 0x0000000,    0,  334 },  /* 653 "mamg" */
+    { 0x0000000,    0,  336 },  /* 654 "mang" */
+    { 0x0000000,    0,  339 },  /* 655 "megn" */
+    { 0x0000000,    0,  341 },  /* 656 "memg" */
+    { 0x0000000,    0,  343 },  /* 657 "meng" */
+    { 0x0000040,  877,  345 },  /* 658 "mian" */
+    { 0x0000000,    0,  347 },  /* 659 "miao" */
+    { 0x0000000,    0,  349 },  /* 660 "mign" */
+    { 0x0000000,    0,  350 },  /* 661 "mimg" */
+    { 0x0000000,    0,  352 },  /* 662 "ming" */
+    { 0x0000000,    0,  353 },  /* 663 "miou" */
+    { 0x0000000,    0,  360 },  /* 664 "nagn" */
+    { 0x0000000,    0,  362 },  /* 665 "namg" */
+    { 0x0000000,    0,  364 },  /* 666 "nang" */
+    { 0x0000000,    0,  367 },  /* 667 "negn" */
+    { 0x0000000,    0,  369 },  /* 668 "nemg" */
+    { 0x0000000,    0,  371 },  /* 669 "neng" */
+    { 0x0002000,  878,   -1 },  /* 670 "niag" */
+    { 0x0000040,  879,   -1 },  /* 671 "niam" */
+    { 0x0000040,  880,  376 },  /* 672 "nian" */
+    { 0x0000000,    0,  378 },  /* 673 "niao" */
+    { 0x0000000,    0,  380 },  /* 674 "nign" */
+    { 0x0000000,    0,  381 },  /* 675 "nimg" */
+    { 0x0000000,    0,  383 },  /* 676 "ning" */
+    { 0x0000000,    0,  384 },  /* 677 "niou" */
+    { 0x0000000,    0,  387 },  /* 678 "nogn" */
+    { 0x0000000,    0,  388 },  /* 679 "nomg" */
+    { 0x0000000,    0,  390 },  /* 680 "nong" */
+    { 0x0000040,  881,  393 },  /* 681 "nuan" */
+    { 0x0000000,    0,  396 },  /* 682 "nuen" */
+    { 0x0000000,    0,  405 },  /* 683 "pagn" */
+    { 0x0000000,    0,  407 },  /* 684 "pamg" */
+    { 0x0000000,    0,  409 },  /* 685 "pang" */
+    { 0x0000000,    0,  411 },  /* 686 "pegn" */
+    { 0x0000000,    0,  413 },  /* 687 "pemg" */
+    { 0x0000000,    0,  415 },  /* 688 "peng" */
+    { 0x0000040,  882,  417 },  /* 689 "pian" */
+    { 0x0000000,    0,  419 },  /* 690 "piao" */
+    { 0x0000000,    0,  421 },  /* 691 "pign" */
+    { 0x0000000,    0,  422 },  /* 692 "pimg" */
+    { 0x0000000,    0,  424 },  /* 693 "ping" */
+    { 0x0002000,  883,   -1 },  /* 694 "qiag" */
+    { 0x0000040,  884,   -1 },  /* 695 "qiam" */
+    { 0x0000040,  885,  433 },  /* 696 "qian" */
+    { 0x0000000,    0,  435 },  /* 697 "qiao" */
+    { 0x0000000,    0,  437 },  /* 698 "qign" */
+    { 0x0000000,    0,  438 },  /* 699 "qimg" */
+    { 0x0000000,    0,  440 },  /* 700 "qing" */
+    { 0x0002000,  886,   -1 },  /* 701 "qiog" */
+    { 0x0000040,  887,   -1 },  /* 702 "qiom" */
+    { 0x0000040,  888,  443 },  /* 703 "qion" */
+    { 0x0000000,    0,  445 },  /* 704 "qiou" */
+    { 0x0000040,  889,  448 },  /* 705 "quan" */
+    { 0x0000000,    0,  451 },  /* 706 "quen" */
+    { 0x0000040,  890,  454 },  /* 707 "qvan" */
+    { 0x0000000,    0,  457 },  /* 708 "qven" */
+    { 0x0000000,    0,  461 },  /* 709 "ragn" */
+    { 0x0000000,    0,  463 },  /* 710 "ramg" */
+    { 0x0000000,    0,  465 },  /* 711 "rang" */
+    { 0x0000000,    0,  468 },  /* 712 "regn" */
+    { 0x0000000,    0,  470 },  /* 713 "remg" */
+    { 0x0000000,    0,  472 },  /* 714 "reng" */
+    { 0x0000040,  891,  475 },  /* 715 "rian" */
+    { 0x0000000,    0,  477 },  /* 716 "riao" */
+    { 0x0000000,    0,  480 },  /* 717 "ring" */
+    { 0x0000000,    0,  481 },  /* 718 "riou" */
+    { 0x0000000,    0,  484 },  /* 719 "rogn" */
+    { 0x0000000,    0,  485 },  /* 720 "romg" */
+    { 0x0000000,    0,  487 },  /* 721 "rong" */
+    { 0x0000040,  892,  490 },  /* 722 "ruan" */
+    { 0x0000000,    0,  493 },  /* 723 "ruei" */
+    { 0x0000000,    0,  494 },  /* 724 "ruen" */
+    { 0x0000000,    0,  502 },  /* 725 "sagn" */
+    { 0x0000000,    0,  504 },  /* 726 "samg" */
+    { 0x0000000,    0,  506 },  /* 727 "sang" */
+    { 0x0000000,    0,  509 },  /* 728 "segn" */
+    { 0x0000000,    0,  511 },  /* 729 "semg" */
+    { 0x0000000,    0,  513 },  /* 730 "seng" */
+    { 0x0002000,  893,   -1 },  /* 731 "shag" */
+    { 0x0000000,    0,  517 },  /* 732 "shai" */
+    { 0x0000040,  894,   -1 },  /* 733 "sham" */
+    { 0x0000040,  895,  519 },  /* 734 "shan" */
+    { 0x0000000,    0,  521 },  /* 735 "shao" */
+    { 0x0002000,  896,   -1 },  /* 736 "sheg" */
+    { 0x0000000,    0,  524 },  /* 737 "shei" */
+    { 0x0000040,  897,   -1 },  /* 738 "shem" */
+    { 0x0000040,  898,  526 },  /* 739 "shen" */
+    { 0x0000040,  899,  529 },  /* 740 "shon" */
+    { 0x0000000,    0,  531 },  /* 741 "shou" */
+    { 0x0003140,  900,  533 },  /* 742 "shua" */
+    { 0x0002100,  904,   -1 },  /* 743 "shue" */
+    { 0x0000000,    0,  541 },  /* 744 "shui" */
+    { 0x0000000,    0,  542 },  /* 745 "shun" */
+    { 0x0000000,    0,  543 },  /* 746 "shuo" */
+    { 0x0000000,    0,  545 },  /* 747 "sogn" */
+    { 0x0000000,    0,  546 },  /* 748 "somg" */
+    { 0x0000000,    0,  548 },  /* 749 "song" */
+    { 0x0000000,    0,  552 },  /* 750 "suai" */
+    { 0x0000040,  906,  553 },  /* 751 "suan" */
+    { 0x0000000,    0,  555 },  /* 752 "suei" */
+    { 0x0000000,    0,  556 },  /* 753 "suen" */
+    { 0x0000000,    0,  562 },  /* 754 "tagn" */
+    { 0x0000000,    0,  564 },  /* 755 "tamg" */
+    { 0x0000000,    0,  566 },  /* 756 "tang" */
+    { 0x0000000,    0,  569 },  /* 757 "tegn" */
+    { 0x0000000,    0,  570 },  /* 758 "temg" */
+    { 0x0000000,    0,  572 },  /* 759 "teng" */
+    { 0x0000040,  907,  574 },  /* 760 "tian" */
+    { 0x0000000,    0,  576 },  /* 761 "tiao" */
+    { 0x0000000,    0,  578 },  /* 762 "tign" */
+    { 0x0000000,    0,  579 },  /* 763 "timg" */
+    { 0x0000000,    0,  581 },  /* 764 "ting" */
+    { 0x0000000,    0,  582 },  /* 765 "togn" */
+    { 0x0000000,    0,  583 },  /* 766 "tomg" */
+    { 0x0000000,    0,  585 },  /* 767 "tong" */
+    { 0x0000040,  908,  588 },  /* 768 "tuan" */
+    { 0x0000000,    0,  590 },  /* 769 "tuei" */
+    { 0x0000000,    0,  591 },  /* 770 "tuen" */
+    { 0x0000000,    0,  597 },  /* 771 "wagn" */
+    { 0x0000000,    0,  599 },  /* 772 "wamg" */
+    { 0x0000000,    0,  601 },  /* 773 "wang" */
+    { 0x0000000,    0,  602 },  /* 774 "wegn" */
+    { 0x0000000,    0,  604 },  /* 775 "wemg" */
+    { 0x0000000,    0,  606 },  /* 776 "weng" */
+    { 0x0002000,  909,   -1 },  /* 777 "xiag" */
+    { 0x0000040,  910,   -1 },  /* 778 "xiam" */
+    { 0x0000040,  911,  614 },  /* 779 "xian" */
+    { 0x0000000,    0,  616 },  /* 780 "xiao" */
+    { 0x0000000,    0,  618 },  /* 781 "xign" */
+    { 0x0000000,    0,  619 },  /* 782 "ximg" */
+    { 0x0000000,    0,  621 },  /* 783 "xing" */
+    { 0x0002000,  912,   -1 },  /* 784 "xiog" */
+    { 0x0000040,  913,   -1 },  /* 785 "xiom" */
+    { 0x0000040,  914,  624 },  /* 786 "xion" */
+    { 0x0000000,    0,  626 },  /* 787 "xiou" */
+    { 0x0000040,  915,  629 },  /* 788 "xuan" */
+    { 0x0000000,    0,  632 },  /* 789 "xuen" */
+    { 0x0000040,  916,  635 },  /* 790 "xvan" */
+    { 0x0000000,    0,  638 },  /* 791 "xven" */
+    { 0x0000000,    0,  642 },  /* 792 "yagn" */
+    { 0x0000000,    0,  643 },  /* 793 "yamg" */
+    { 0x0000000,    0,  645 },  /* 794 "yang" */
+    { 0x0000000,    0,  649 },  /* 795 "yign" */
+    { 0x0000000,    0,  650 },  /* 796 "yimg" */
+    { 0x0000000,    0,  652 },  /* 797 "ying" */
+    { 0x0000000,    0,  654 },  /* 798 "yogn" */
+    { 0x0000000,    0,  655 },  /* 799 "yomg" */
+    { 0x0000000,    0,  657 },  /* 800 "yong" */
+    { 0x0000040,  917,  660 },  /* 801 "yuan" */
+    { 0x0000000,    0,  663 },  /* 802 "yuen" */
+    { 0x0000040,  918,  666 },  /* 803 "yvan" */
+    { 0x0000000,    0,  669 },  /* 804 "yven" */
+    { 0x0000000,    0,  673 },  /* 805 "zagn" */
+    { 0x0000000,    0,  675 },  /* 806 "zamg" */
+    { 0x0000000,    0,  677 },  /* 807 "zang" */
+    { 0x0000000,    0,  680 },  /* 808 "zegn" */
+    { 0x0000000,    0,  682 },  /* 809 "zemg" */
+    { 0x0000000,    0,  684 },  /* 810 "zeng" */
+    { 0x0002000,  919,   -1 },  /* 811 "zhag" */
+    { 0x0000000,    0,  688 },  /* 812 "zhai" */
+    { 0x0000040,  920,   -1 },  /* 813 "zham" */
+    { 0x0000040,  921,  690 },  /* 814 "zhan" */
+    { 0x0000000,    0,  692 },  /* 815 "zhao" */
+    { 0x0002000,  922,   -1 },  /* 816 "zheg" */
+    { 0x0000000,    0,  695 },  /* 817 "zhei" */
+    { 0x0000040,  923,   -1 },  /* 818 "zhem" */
+    { 0x0000040,  924,  697 },  /* 819 "zhen" */
+    { 0x0002000,  925,   -1 },  /* 820 "zhog" */
+    { 0x0000040,  926,   -1 },  /* 821 "zhom" */
+    { 0x0000040,  927,  702 },  /* 822 "zhon" */
+    { 0x0000000,    0,  704 },  /* 823 "zhou" */
+    { 0x0003140,  928,  706 },  /* 824 "zhua" */
+    { 0x0002100,  932,   -1 },  /* 825 "zhue" */
+    { 0x0000000,    0,  714 },  /* 826 "zhui" */
+    { 0x0000000,    0,  715 },  /* 827 "zhun" */
+    { 0x0000000,    0,  716 },  /* 828 "zhuo" */
+    { 0x0000000,    0,  718 },  /* 829 "zogn" */
+    { 0x0000000,    0,  719 },  /* 830 "zomg" */
+    { 0x0000000,    0,  721 },  /* 831 "zong" */
+    { 0x0000000,    0,  725 },  /* 832 "zuai" */
+    { 0x0000040,  934,  726 },  /* 833 "zuan" */
+    { 0x0000000,    0,  728 },  /* 834 "zuei" */
+    { 0x0000000,    0,  729 },  /* 835 "zuen" */
+    { 0x0000000,    0,   22 },  /* 836 "biang" */
+    { 0x0000000,    0,   46 },  /* 837 "chagn" */
+    { 0x0000000,    0,   48 },  /* 838 "chamg" */
+    { 0x0000000,    0,   50 },  /* 839 "chang" */
+    { 0x0000000,    0,   53 },  /* 840 "chegn" */
+    { 0x0000000,    0,   54 },  /* 841 "chemg" */
+    { 0x0000000,    0,   56 },  /* 842 "cheng" */
+    { 0x0000000,    0,   58 },  /* 843 "chogn" */
+    { 0x0000000,    0,   59 },  /* 844 "chomg" */
+    { 0x0000000,    0,   61 },  /* 845 "chong" */
+    { 0x0002000,  935,   -1 },  /* 846 "chuag" */
+    { 0x0000000,    0,   65 },  /* 847 "chuai" */
+    { 0x0000040,  936,   -1 },  /* 848 "chuam" */
+    { 0x0000040,  937,   67 },  /* 849 "chuan" */
+    { 0x0000000,    0,   69 },  /* 850 "chuei" */
+    { 0x0000000,    0,   70 },  /* 851 "chuen" */
+    { 0x0000000,    0,   83 },  /* 852 "cuang" */
+    { 0x0000000,    0,  106 },  /* 853 "diang" */
+    { 0x0000000,    0,  122 },  /* 854 "duang" */
+    { 0x0000000,    0,  154 },  /* 855 "fuang" */
+    { 0x0000000,    0,  181 },  /* 856 "guagn" */
+    { 0x0000000,    0,  183 },  /* 857 "guamg" */
+    { 0x0000000,    0,  185 },  /* 858 "guang" */
+    { 0x0000000,    0,  213 },  /* 859 "huagn" */
+    { 0x0000000,    0,  215 },  /* 860 "huamg" */
+    { 0x0000000,    0,  217 },  /* 861 "huang" */
+    { 0x0000000,    0,  226 },  /* 862 "jiagn" */
+    { 0x0000000,    0,  227 },  /* 863 "jiamg" */
+    { 0x0000000,    0,  229 },  /* 864 "jiang" */
+    { 0x0000000,    0,  236 },  /* 865 "jiogn" */
+    { 0x0000000,    0,  237 },  /* 866 "jiomg" */
+    { 0x0000000,    0,  239 },  /* 867 "jiong" */
+    { 0x0000000,    0,  244 },  /* 868 "juang" */
+    { 0x0000000,    0,  250 },  /* 869 "jvang" */
+    { 0x0000000,    0,  275 },  /* 870 "kuagn" */
+    { 0x0000000,    0,  277 },  /* 871 "kuamg" */
+    { 0x0000000,    0,  279 },  /* 872 "kuang" */
+    { 0x0000000,    0,  301 },  /* 873 "liagn" */
+    { 0x0000000,    0,  302 },  /* 874 "liamg" */
+    { 0x0000000,    0,  304 },  /* 875 "liang" */
+    { 0x0000000,    0,  321 },  /* 876 "luang" */
+    { 0x0000000,    0,  346 },  /* 877 "miang" */
+    { 0x0000000,    0,  374 },  /* 878 "niagn" */
+    { 0x0000000,    0,  375 },  /* 879 "niamg" */
+    { 0x0000000,    0,  377 },  /* 880 "niang" */
+    { 0x0000000,    0,  394 },  /* 881 "nuang" */
+    { 0x0000000,    0,  418 },  /* 882 "piang" */
+    { 0x0000000,    0,  431 },  /* 883 "qiagn" */
+    { 0x0000000,    0,  432 },  /* 884 "qiamg" */
+    { 0x0000000,    0,  434 },  /* 885 "qiang" */
+    { 0x0000000,    0,  441 },  /* 886 "qiogn" */
+    { 0x0000000,    0,  442 },  /* 887 "qiomg" */
+    { 0x0000000,    0,  444 },  /* 888 "qiong" */
+    { 0x0000000,    0,  449 },  /* 889 "quang" */
+    { 0x0000000,    0,  455 },  /* 890 "qvang" */
+    { 0x0000000,    0,  476 },  /* 891 "riang" */
+    { 0x0000000,    0,  491 },  /* 892 "ruang" */
+    { 0x0000000,    0,  516 },  /* 893 "shagn" */
+    { 0x0000000,    0,  518 },  /* 894 "shamg" */
+    { 0x0000000,    0,  520 },  /* 895 "shang" */
+    { 0x0000000,    0,  523 },  /* 896 "shegn" */
+    { 0x0000000,    0,  525 },  /* 897 "shemg" */
+    { 0x0000000,    0,  527 },  /* 898 "sheng" */
+    { 0x0000000,    0,  530 },  /* 899 "shong" */
+    { 0x0002000,  938,   -1 },  /* 900 "shuag" */
+    { 0x0000000,    0,  535 },  /* 901 "shuai" */
+    { 0x0000040,  939,   -1 },  /* 902 "shuam" */
+    { 0x0000040,  940,  537 },  /* 903 "shuan" */
+    { 0x0000000,    0,  539 },  /* 904 "shuei" */
+    { 0x0000000,    0,  540 },  /* 905 "shuen" */
+    { 0x0000000,    0,  554 },  /* 906 "suang" */
+    { 0x0000000,    0,  575 },  /* 907 "tiang" */
+    { 0x0000000,    0,  589 },  /* 908 "tuang" */
+    { 0x0000000,    0,  612 },  /* 909 "xiagn" */
+    { 0x0000000,    0,  613 },  /* 910 "xiamg" */
+    { 0x0000000,    0,  615 },  /* 911 "xiang" */
+    { 0x0000000,    0,  622 },  /* 912 "xiogn" */
+    { 0x0000000,    0,  623 },  /* 913 "xiomg" */
+    { 0x0000000,    0,  625 },  /* 914 "xiong" */
+    { 0x0000000,    0,  630 },  /* 915 "xuang" */
+    { 0x0000000,    0,  636 },  /* 916 "xvang" */
+    { 0x0000000,    0,  661 },  /* 917 "yuang" */
+    { 0x0000000,    0,  667 },  /* 918 "yvang" */
+    { 0x0000000,    0,  687 },  /* 919 "zhagn" */
+    { 0x0000000,    0,  689 },  /* 920 "zhamg" */
+    { 0x0000000,    0,  691 },  /* 921 "zhang" */
+    { 0x0000000,    0,  694 },  /* 922 "zhegn" */
+    { 0x0000000,    0,  696 },  /* 923 "zhemg" */
+    { 0x0000000,    0,  698 },  /* 924 "zheng" */
+    { 0x0000000,    0,  700 },  /* 925 "zhogn" */
+    { 0x0000000,    0,  701 },  /* 926 "zhomg" */
+    { 0x0000000,    0,  703 },  /* 927 "zhong" */
+    { 0x0002000,  941,   -1 },  /* 928 "zhuag" */
+    { 0x0000000,    0,  708 },  /* 929 "zhuai" */
+    { 0x0000040,  942,   -1 },  /* 930 "zhuam" */
+    { 0x0000040,  943,  710 },  /* 931 "zhuan" */
+    { 0x0000000,    0,  712 },  /* 932 "zhuei" */
+    { 0x0000000,    0,  713 },  /* 933 "zhuen" */
+    { 0x0000000,    0,  727 },  /* 934 "zuang" */
+    { 0x0000000,    0,   64 },  /* 935 "chuagn" */
+    { 0x0000000,    0,   66 },  /* 936 "chuamg" */
+    { 0x0000000,    0,   68 },  /* 937 "chuang" */
+    { 0x0000000,    0,  534 },  /* 938 "shuagn" */
+    { 0x0000000,    0,  536 },  /* 939 "shuamg" */
+    { 0x0000000,    0,  538 },  /* 940 "shuang" */
+    { 0x0000000,    0,  707 },  /* 941 "zhuagn" */
+    { 0x0000000,    0,  709 },  /* 942 "zhuamg" */
+    { 0x0000000,    0,  711 },  /* 943 "zhuang" */
 };
 
-static const Pinyin *special_table[][4] = {
-    { &pinyin_table[4],    &pinyin_table[0],    &pinyin_table[0],    &pinyin_table[359],  }, /* an a => a na */
-    { &pinyin_table[4],    &pinyin_table[2],    &pinyin_table[0],    &pinyin_table[361],  }, /* an ai => a nai */
-    { &pinyin_table[4],    &pinyin_table[6],    &pinyin_table[0],    &pinyin_table[365],  }, /* an ao => a nao */
-    { &pinyin_table[4],    &pinyin_table[128],  &pinyin_table[0],    &pinyin_table[366],  }, /* an e => a ne */
-    { &pinyin_table[4],    &pinyin_table[129],  &pinyin_table[0],    &pinyin_table[368],  }, /* an ei => a nei */
-    { &pinyin_table[5],    &pinyin_table[0],    &pinyin_table[4],    &pinyin_table[161],  }, /* ang a => an ga */
-    { &pinyin_table[5],    &pinyin_table[2],    &pinyin_table[4],    &pinyin_table[163],  }, /* ang ai => an gai */
-    { &pinyin_table[5],    &pinyin_table[4],    &pinyin_table[4],    &pinyin_table[165],  }, /* ang an => an gan */
-    { &pinyin_table[5],    &pinyin_table[5],    &pinyin_table[4],    &pinyin_table[166],  }, /* ang ang => an gang */
-    { &pinyin_table[5],    &pinyin_table[6],    &pinyin_table[4],    &pinyin_table[167],  }, /* ang ao => an gao */
-    { &pinyin_table[5],    &pinyin_table[128],  &pinyin_table[4],    &pinyin_table[168],  }, /* ang e => an ge */
-    { &pinyin_table[5],    &pinyin_table[129],  &pinyin_table[4],    &pinyin_table[170],  }, /* ang ei => an gei */
-    { &pinyin_table[5],    &pinyin_table[130],  &pinyin_table[4],    &pinyin_table[172],  }, /* ang en => an gen */
-    { &pinyin_table[5],    &pinyin_table[402],  &pinyin_table[4],    &pinyin_table[178],  }, /* ang ou => an gou */
-    { &pinyin_table[12],   &pinyin_table[0],    &pinyin_table[8],    &pinyin_table[359],  }, /* ban a => ba na */
-    { &pinyin_table[12],   &pinyin_table[5],    &pinyin_table[8],    &pinyin_table[364],  }, /* ban ang => ba nang */
-    { &pinyin_table[12],   &pinyin_table[6],    &pinyin_table[8],    &pinyin_table[365],  }, /* ban ao => ba nao */
-    { &pinyin_table[12],   &pinyin_table[128],  &pinyin_table[8],    &pinyin_table[366],  }, /* ban e => ba ne */
-    { &pinyin_table[12],   &pinyin_table[129],  &pinyin_table[8],    &pinyin_table[368],  }, /* ban ei => ba nei */
-    { &pinyin_table[13],   &pinyin_table[2],    &pinyin_table[12],   &pinyin_table[163],  }, /* bang ai => ban gai */
-    { &pinyin_table[13],   &pinyin_table[5],    &pinyin_table[12],   &pinyin_table[166],  }, /* bang ang => ban gang */
-    { &pinyin_table[13],   &pinyin_table[6],    &pinyin_table[12],   &pinyin_table[167],  }, /* bang ao => ban gao */
-    { &pinyin_table[13],   &pinyin_table[128],  &pinyin_table[12],   &pinyin_table[168],  }, /* bang e => ban ge */
-    { &pinyin_table[13],   &pinyin_table[129],  &pinyin_table[12],   &pinyin_table[170],  }, /* bang ei => ban gei */
-    { &pinyin_table[13],   &pinyin_table[130],  &pinyin_table[12],   &pinyin_table[172],  }, /* bang en => ban gen */
-    { &pinyin_table[19],   &pinyin_table[0],    &pinyin_table[18],   &pinyin_table[161],  }, /* beng a => ben ga */
-    { &pinyin_table[19],   &pinyin_table[2],    &pinyin_table[18],   &pinyin_table[163],  }, /* beng ai => ben gai */
-    { &pinyin_table[19],   &pinyin_table[4],    &pinyin_table[18],   &pinyin_table[165],  }, /* beng an => ben gan */
-    { &pinyin_table[19],   &pinyin_table[5],    &pinyin_table[18],   &pinyin_table[166],  }, /* beng ang => ben gang */
-    { &pinyin_table[19],   &pinyin_table[6],    &pinyin_table[18],   &pinyin_table[167],  }, /* beng ao => ben gao */
-    { &pinyin_table[19],   &pinyin_table[128],  &pinyin_table[18],   &pinyin_table[168],  }, /* beng e => ben ge */
-    { &pinyin_table[19],   &pinyin_table[129],  &pinyin_table[18],   &pinyin_table[170],  }, /* beng ei => ben gei */
-    { &pinyin_table[19],   &pinyin_table[130],  &pinyin_table[18],   &pinyin_table[172],  }, /* beng en => ben gen */
-    { &pinyin_table[19],   &pinyin_table[402],  &pinyin_table[18],   &pinyin_table[178],  }, /* beng ou => ben gou */
-    { &pinyin_table[22],   &pinyin_table[0],    &pinyin_table[21],   &pinyin_table[161],  }, /* biang a => bian ga */
-    { &pinyin_table[22],   &pinyin_table[2],    &pinyin_table[21],   &pinyin_table[163],  }, /* biang ai => bian gai */
-    { &pinyin_table[22],   &pinyin_table[4],    &pinyin_table[21],   &pinyin_table[165],  }, /* biang an => bian gan */
-    { &pinyin_table[22],   &pinyin_table[5],    &pinyin_table[21],   &pinyin_table[166],  }, /* biang ang => bian gang */
-    { &pinyin_table[22],   &pinyin_table[6],    &pinyin_table[21],   &pinyin_table[167],  }, /* biang ao => bian gao */
-    { &pinyin_table[22],   &pinyin_table[128],  &pinyin_table[21],   &pinyin_table[168],  }, /* biang e => bian ge */
-    { &pinyin_table[22],   &pinyin_table[129],  &pinyin_table[21],   &pinyin_table[170],  }, /* biang ei => bian gei */
-    { &pinyin_table[22],   &pinyin_table[130],  &pinyin_table[21],   &pinyin_table[172],  }, /* biang en => bian gen */
-    { &pinyin_table[22],   &pinyin_table[402],  &pinyin_table[21],   &pinyin_table[178],  }, /* biang ou => bian gou */
-    { &pinyin_table[24],   &pinyin_table[459],  &pinyin_table[20],   &pinyin_table[131],  }, /* bie r => bi er */
-    { &pinyin_table[27],   &pinyin_table[0],    &pinyin_table[20],   &pinyin_table[359],  }, /* bin a => bi na */
-    { &pinyin_table[27],   &pinyin_table[2],    &pinyin_table[20],   &pinyin_table[361],  }, /* bin ai => bi nai */
-    { &pinyin_table[27],   &pinyin_table[4],    &pinyin_table[20],   &pinyin_table[363],  }, /* bin an => bi nan */
-    { &pinyin_table[27],   &pinyin_table[5],    &pinyin_table[20],   &pinyin_table[364],  }, /* bin ang => bi nang */
-    { &pinyin_table[27],   &pinyin_table[6],    &pinyin_table[20],   &pinyin_table[365],  }, /* bin ao => bi nao */
-    { &pinyin_table[27],   &pinyin_table[128],  &pinyin_table[20],   &pinyin_table[366],  }, /* bin e => bi ne */
-    { &pinyin_table[27],   &pinyin_table[129],  &pinyin_table[20],   &pinyin_table[368],  }, /* bin ei => bi nei */
-    { &pinyin_table[27],   &pinyin_table[130],  &pinyin_table[20],   &pinyin_table[370],  }, /* bin en => bi nen */
-    { &pinyin_table[28],   &pinyin_table[128],  &pinyin_table[27],   &pinyin_table[168],  }, /* bing e => bin ge */
-    { &pinyin_table[28],   &pinyin_table[129],  &pinyin_table[27],   &pinyin_table[170],  }, /* bing ei => bin gei */
-    { &pinyin_table[36],   &pinyin_table[129],  &pinyin_table[32],   &pinyin_table[368],  }, /* can ei => ca nei */
-    { &pinyin_table[37],   &pinyin_table[4],    &pinyin_table[36],   &pinyin_table[165],  }, /* cang an => can gan */
-    { &pinyin_table[37],   &pinyin_table[5],    &pinyin_table[36],   &pinyin_table[166],  }, /* cang ang => can gang */
-    { &pinyin_table[37],   &pinyin_table[128],  &pinyin_table[36],   &pinyin_table[168],  }, /* cang e => can ge */
-    { &pinyin_table[37],   &pinyin_table[129],  &pinyin_table[36],   &pinyin_table[170],  }, /* cang ei => can gei */
-    { &pinyin_table[37],   &pinyin_table[130],  &pinyin_table[36],   &pinyin_table[172],  }, /* cang en => can gen */
-    { &pinyin_table[37],   &pinyin_table[402],  &pinyin_table[36],   &pinyin_table[178],  }, /* cang ou => can gou */
-    { &pinyin_table[42],   &pinyin_table[0],    &pinyin_table[39],   &pinyin_table[359],  }, /* cen a => ce na */
-    { &pinyin_table[42],   &pinyin_table[2],    &pinyin_table[39],   &pinyin_table[361],  }, /* cen ai => ce nai */
-    { &pinyin_table[42],   &pinyin_table[4],    &pinyin_table[39],   &pinyin_table[363],  }, /* cen an => ce nan */
-    { &pinyin_table[42],   &pinyin_table[5],    &pinyin_table[39],   &pinyin_table[364],  }, /* cen ang => ce nang */
-    { &pinyin_table[42],   &pinyin_table[6],    &pinyin_table[39],   &pinyin_table[365],  }, /* cen ao => ce nao */
-    { &pinyin_table[42],   &pinyin_table[128],  &pinyin_table[39],   &pinyin_table[366],  }, /* cen e => ce ne */
-    { &pinyin_table[42],   &pinyin_table[129],  &pinyin_table[39],   &pinyin_table[368],  }, /* cen ei => ce nei */
-    { &pinyin_table[42],   &pinyin_table[130],  &pinyin_table[39],   &pinyin_table[370],  }, /* cen en => ce nen */
-    { &pinyin_table[43],   &pinyin_table[129],  &pinyin_table[42],   &pinyin_table[170],  }, /* ceng ei => cen gei */
-    { &pinyin_table[49],   &pinyin_table[0],    &pinyin_table[45],   &pinyin_table[359],  }, /* chan a => cha na */
-    { &pinyin_table[49],   &pinyin_table[6],    &pinyin_table[45],   &pinyin_table[365],  }, /* chan ao => cha nao */
-    { &pinyin_table[49],   &pinyin_table[128],  &pinyin_table[45],   &pinyin_table[366],  }, /* chan e => cha ne */
-    { &pinyin_table[49],   &pinyin_table[129],  &pinyin_table[45],   &pinyin_table[368],  }, /* chan ei => cha nei */
-    { &pinyin_table[50],   &pinyin_table[5],    &pinyin_table[49],   &pinyin_table[166],  }, /* chang ang => chan gang */
-    { &pinyin_table[50],   &pinyin_table[6],    &pinyin_table[49],   &pinyin_table[167],  }, /* chang ao => chan gao */
-    { &pinyin_table[50],   &pinyin_table[129],  &pinyin_table[49],   &pinyin_table[170],  }, /* chang ei => chan gei */
-    { &pinyin_table[50],   &pinyin_table[130],  &pinyin_table[49],   &pinyin_table[172],  }, /* chang en => chan gen */
-    { &pinyin_table[50],   &pinyin_table[402],  &pinyin_table[49],   &pinyin_table[178],  }, /* chang ou => chan gou */
-    { &pinyin_table[55],   &pinyin_table[0],    &pinyin_table[52],   &pinyin_table[359],  }, /* chen a => che na */
-    { &pinyin_table[55],   &pinyin_table[4],    &pinyin_table[52],   &pinyin_table[363],  }, /* chen an => che nan */
-    { &pinyin_table[55],   &pinyin_table[5],    &pinyin_table[52],   &pinyin_table[364],  }, /* chen ang => che nang */
-    { &pinyin_table[55],   &pinyin_table[6],    &pinyin_table[52],   &pinyin_table[365],  }, /* chen ao => che nao */
-    { &pinyin_table[55],   &pinyin_table[128],  &pinyin_table[52],   &pinyin_table[366],  }, /* chen e => che ne */
-    { &pinyin_table[55],   &pinyin_table[129],  &pinyin_table[52],   &pinyin_table[368],  }, /* chen ei => che nei */
-    { &pinyin_table[56],   &pinyin_table[5],    &pinyin_table[55],   &pinyin_table[166],  }, /* cheng ang => chen gang */
-    { &pinyin_table[56],   &pinyin_table[6],    &pinyin_table[55],   &pinyin_table[167],  }, /* cheng ao => chen gao */
-    { &pinyin_table[56],   &pinyin_table[129],  &pinyin_table[55],   &pinyin_table[170],  }, /* cheng ei => chen gei */
-    { &pinyin_table[56],   &pinyin_table[402],  &pinyin_table[55],   &pinyin_table[178],  }, /* cheng ou => chen gou */
-    { &pinyin_table[68],   &pinyin_table[4],    &pinyin_table[67],   &pinyin_table[165],  }, /* chuang an => chuan gan */
-    { &pinyin_table[68],   &pinyin_table[5],    &pinyin_table[67],   &pinyin_table[166],  }, /* chuang ang => chuan gang */
-    { &pinyin_table[68],   &pinyin_table[6],    &pinyin_table[67],   &pinyin_table[167],  }, /* chuang ao => chuan gao */
-    { &pinyin_table[68],   &pinyin_table[128],  &pinyin_table[67],   &pinyin_table[168],  }, /* chuang e => chuan ge */
-    { &pinyin_table[68],   &pinyin_table[129],  &pinyin_table[67],   &pinyin_table[170],  }, /* chuang ei => chuan gei */
-    { &pinyin_table[68],   &pinyin_table[130],  &pinyin_table[67],   &pinyin_table[172],  }, /* chuang en => chuan gen */
-    { &pinyin_table[68],   &pinyin_table[402],  &pinyin_table[67],   &pinyin_table[178],  }, /* chuang ou => chuan gou */
-    { &pinyin_table[72],   &pinyin_table[0],    &pinyin_table[63],   &pinyin_table[359],  }, /* chun a => chu na */
-    { &pinyin_table[72],   &pinyin_table[4],    &pinyin_table[63],   &pinyin_table[363],  }, /* chun an => chu nan */
-    { &pinyin_table[72],   &pinyin_table[5],    &pinyin_table[63],   &pinyin_table[364],  }, /* chun ang => chu nang */
-    { &pinyin_table[72],   &pinyin_table[6],    &pinyin_table[63],   &pinyin_table[365],  }, /* chun ao => chu nao */
-    { &pinyin_table[72],   &pinyin_table[128],  &pinyin_table[63],   &pinyin_table[366],  }, /* chun e => chu ne */
-    { &pinyin_table[72],   &pinyin_table[129],  &pinyin_table[63],   &pinyin_table[368],  }, /* chun ei => chu nei */
-    { &pinyin_table[83],   &pinyin_table[0],    &pinyin_table[82],   &pinyin_table[161],  }, /* cuang a => cuan ga */
-    { &pinyin_table[83],   &pinyin_table[2],    &pinyin_table[82],   &pinyin_table[163],  }, /* cuang ai => cuan gai */
-    { &pinyin_table[83],   &pinyin_table[4],    &pinyin_table[82],   &pinyin_table[165],  }, /* cuang an => cuan gan */
-    { &pinyin_table[83],   &pinyin_table[5],    &pinyin_table[82],   &pinyin_table[166],  }, /* cuang ang => cuan gang */
-    { &pinyin_table[83],   &pinyin_table[6],    &pinyin_table[82],   &pinyin_table[167],  }, /* cuang ao => cuan gao */
-    { &pinyin_table[83],   &pinyin_table[128],  &pinyin_table[82],   &pinyin_table[168],  }, /* cuang e => cuan ge */
-    { &pinyin_table[83],   &pinyin_table[129],  &pinyin_table[82],   &pinyin_table[170],  }, /* cuang ei => cuan gei */
-    { &pinyin_table[83],   &pinyin_table[130],  &pinyin_table[82],   &pinyin_table[172],  }, /* cuang en => cuan gen */
-    { &pinyin_table[83],   &pinyin_table[402],  &pinyin_table[82],   &pinyin_table[178],  }, /* cuang ou => cuan gou */
-    { &pinyin_table[87],   &pinyin_table[128],  &pinyin_table[80],   &pinyin_table[366],  }, /* cun e => cu ne */
-    { &pinyin_table[87],   &pinyin_table[129],  &pinyin_table[80],   &pinyin_table[368],  }, /* cun ei => cu nei */
-    { &pinyin_table[94],   &pinyin_table[0],    &pinyin_table[90],   &pinyin_table[359],  }, /* dan a => da na */
-    { &pinyin_table[94],   &pinyin_table[2],    &pinyin_table[90],   &pinyin_table[361],  }, /* dan ai => da nai */
-    { &pinyin_table[94],   &pinyin_table[4],    &pinyin_table[90],   &pinyin_table[363],  }, /* dan an => da nan */
-    { &pinyin_table[94],   &pinyin_table[5],    &pinyin_table[90],   &pinyin_table[364],  }, /* dan ang => da nang */
-    { &pinyin_table[94],   &pinyin_table[6],    &pinyin_table[90],   &pinyin_table[365],  }, /* dan ao => da nao */
-    { &pinyin_table[94],   &pinyin_table[128],  &pinyin_table[90],   &pinyin_table[366],  }, /* dan e => da ne */
-    { &pinyin_table[94],   &pinyin_table[129],  &pinyin_table[90],   &pinyin_table[368],  }, /* dan ei => da nei */
-    { &pinyin_table[95],   &pinyin_table[2],    &pinyin_table[94],   &pinyin_table[163],  }, /* dang ai => dan gai */
-    { &pinyin_table[95],   &pinyin_table[5],    &pinyin_table[94],   &pinyin_table[166],  }, /* dang ang => dan gang */
-    { &pinyin_table[95],   &pinyin_table[6],    &pinyin_table[94],   &pinyin_table[167],  }, /* dang ao => dan gao */
-    { &pinyin_table[95],   &pinyin_table[128],  &pinyin_table[94],   &pinyin_table[168],  }, /* dang e => dan ge */
-    { &pinyin_table[95],   &pinyin_table[129],  &pinyin_table[94],   &pinyin_table[170],  }, /* dang ei => dan gei */
-    { &pinyin_table[95],   &pinyin_table[130],  &pinyin_table[94],   &pinyin_table[172],  }, /* dang en => dan gen */
-    { &pinyin_table[101],  &pinyin_table[0],    &pinyin_table[97],   &pinyin_table[359],  }, /* den a => de na */
-    { &pinyin_table[101],  &pinyin_table[2],    &pinyin_table[97],   &pinyin_table[361],  }, /* den ai => de nai */
-    { &pinyin_table[101],  &pinyin_table[4],    &pinyin_table[97],   &pinyin_table[363],  }, /* den an => de nan */
-    { &pinyin_table[101],  &pinyin_table[5],    &pinyin_table[97],   &pinyin_table[364],  }, /* den ang => de nang */
-    { &pinyin_table[101],  &pinyin_table[6],    &pinyin_table[97],   &pinyin_table[365],  }, /* den ao => de nao */
-    { &pinyin_table[101],  &pinyin_table[128],  &pinyin_table[97],   &pinyin_table[366],  }, /* den e => de ne */
-    { &pinyin_table[101],  &pinyin_table[129],  &pinyin_table[97],   &pinyin_table[368],  }, /* den ei => de nei */
-    { &pinyin_table[101],  &pinyin_table[130],  &pinyin_table[97],   &pinyin_table[370],  }, /* den en => de nen */
-    { &pinyin_table[101],  &pinyin_table[402],  &pinyin_table[97],   &pinyin_table[391],  }, /* den ou => de nou */
-    { &pinyin_table[106],  &pinyin_table[0],    &pinyin_table[105],  &pinyin_table[161],  }, /* diang a => dian ga */
-    { &pinyin_table[106],  &pinyin_table[2],    &pinyin_table[105],  &pinyin_table[163],  }, /* diang ai => dian gai */
-    { &pinyin_table[106],  &pinyin_table[4],    &pinyin_table[105],  &pinyin_table[165],  }, /* diang an => dian gan */
-    { &pinyin_table[106],  &pinyin_table[5],    &pinyin_table[105],  &pinyin_table[166],  }, /* diang ang => dian gang */
-    { &pinyin_table[106],  &pinyin_table[6],    &pinyin_table[105],  &pinyin_table[167],  }, /* diang ao => dian gao */
-    { &pinyin_table[106],  &pinyin_table[128],  &pinyin_table[105],  &pinyin_table[168],  }, /* diang e => dian ge */
-    { &pinyin_table[106],  &pinyin_table[129],  &pinyin_table[105],  &pinyin_table[170],  }, /* diang ei => dian gei */
-    { &pinyin_table[106],  &pinyin_table[130],  &pinyin_table[105],  &pinyin_table[172],  }, /* diang en => dian gen */
-    { &pinyin_table[106],  &pinyin_table[402],  &pinyin_table[105],  &pinyin_table[178],  }, /* diang ou => dian gou */
-    { &pinyin_table[108],  &pinyin_table[459],  &pinyin_table[103],  &pinyin_table[131],  }, /* die r => di er */
-    { &pinyin_table[111],  &pinyin_table[0],    &pinyin_table[103],  &pinyin_table[359],  }, /* din a => di na */
-    { &pinyin_table[111],  &pinyin_table[2],    &pinyin_table[103],  &pinyin_table[361],  }, /* din ai => di nai */
-    { &pinyin_table[111],  &pinyin_table[4],    &pinyin_table[103],  &pinyin_table[363],  }, /* din an => di nan */
-    { &pinyin_table[111],  &pinyin_table[5],    &pinyin_table[103],  &pinyin_table[364],  }, /* din ang => di nang */
-    { &pinyin_table[111],  &pinyin_table[6],    &pinyin_table[103],  &pinyin_table[365],  }, /* din ao => di nao */
-    { &pinyin_table[111],  &pinyin_table[128],  &pinyin_table[103],  &pinyin_table[366],  }, /* din e => di ne */
-    { &pinyin_table[111],  &pinyin_table[129],  &pinyin_table[103],  &pinyin_table[368],  }, /* din ei => di nei */
-    { &pinyin_table[111],  &pinyin_table[130],  &pinyin_table[103],  &pinyin_table[370],  }, /* din en => di nen */
-    { &pinyin_table[111],  &pinyin_table[402],  &pinyin_table[103],  &pinyin_table[391],  }, /* din ou => di nou */
-    { &pinyin_table[122],  &pinyin_table[0],    &pinyin_table[121],  &pinyin_table[161],  }, /* duang a => duan ga */
-    { &pinyin_table[122],  &pinyin_table[2],    &pinyin_table[121],  &pinyin_table[163],  }, /* duang ai => duan gai */
-    { &pinyin_table[122],  &pinyin_table[4],    &pinyin_table[121],  &pinyin_table[165],  }, /* duang an => duan gan */
-    { &pinyin_table[122],  &pinyin_table[5],    &pinyin_table[121],  &pinyin_table[166],  }, /* duang ang => duan gang */
-    { &pinyin_table[122],  &pinyin_table[6],    &pinyin_table[121],  &pinyin_table[167],  }, /* duang ao => duan gao */
-    { &pinyin_table[122],  &pinyin_table[128],  &pinyin_table[121],  &pinyin_table[168],  }, /* duang e => duan ge */
-    { &pinyin_table[122],  &pinyin_table[129],  &pinyin_table[121],  &pinyin_table[170],  }, /* duang ei => duan gei */
-    { &pinyin_table[122],  &pinyin_table[130],  &pinyin_table[121],  &pinyin_table[172],  }, /* duang en => duan gen */
-    { &pinyin_table[122],  &pinyin_table[402],  &pinyin_table[121],  &pinyin_table[178],  }, /* duang ou => duan gou */
-    { &pinyin_table[126],  &pinyin_table[0],    &pinyin_table[120],  &pinyin_table[359],  }, /* dun a => du na */
-    { &pinyin_table[126],  &pinyin_table[4],    &pinyin_table[120],  &pinyin_table[363],  }, /* dun an => du nan */
-    { &pinyin_table[126],  &pinyin_table[5],    &pinyin_table[120],  &pinyin_table[364],  }, /* dun ang => du nang */
-    { &pinyin_table[126],  &pinyin_table[6],    &pinyin_table[120],  &pinyin_table[365],  }, /* dun ao => du nao */
-    { &pinyin_table[126],  &pinyin_table[128],  &pinyin_table[120],  &pinyin_table[366],  }, /* dun e => du ne */
-    { &pinyin_table[126],  &pinyin_table[129],  &pinyin_table[120],  &pinyin_table[368],  }, /* dun ei => du nei */
-    { &pinyin_table[130],  &pinyin_table[4],    &pinyin_table[128],  &pinyin_table[363],  }, /* en an => e nan */
-    { &pinyin_table[130],  &pinyin_table[5],    &pinyin_table[128],  &pinyin_table[364],  }, /* en ang => e nang */
-    { &pinyin_table[130],  &pinyin_table[6],    &pinyin_table[128],  &pinyin_table[365],  }, /* en ao => e nao */
-    { &pinyin_table[130],  &pinyin_table[128],  &pinyin_table[128],  &pinyin_table[366],  }, /* en e => e ne */
-    { &pinyin_table[130],  &pinyin_table[129],  &pinyin_table[128],  &pinyin_table[368],  }, /* en ei => e nei */
-    { &pinyin_table[131],  &pinyin_table[4],    &pinyin_table[128],  &pinyin_table[464],  }, /* er an => e ran */
-    { &pinyin_table[131],  &pinyin_table[5],    &pinyin_table[128],  &pinyin_table[465],  }, /* er ang => e rang */
-    { &pinyin_table[131],  &pinyin_table[130],  &pinyin_table[128],  &pinyin_table[471],  }, /* er en => e ren */
-    { &pinyin_table[131],  &pinyin_table[402],  &pinyin_table[128],  &pinyin_table[488],  }, /* er ou => e rou */
-    { &pinyin_table[137],  &pinyin_table[5],    &pinyin_table[133],  &pinyin_table[364],  }, /* fan ang => fa nang */
-    { &pinyin_table[137],  &pinyin_table[6],    &pinyin_table[133],  &pinyin_table[365],  }, /* fan ao => fa nao */
-    { &pinyin_table[137],  &pinyin_table[129],  &pinyin_table[133],  &pinyin_table[368],  }, /* fan ei => fa nei */
-    { &pinyin_table[138],  &pinyin_table[5],    &pinyin_table[137],  &pinyin_table[166],  }, /* fang ang => fan gang */
-    { &pinyin_table[138],  &pinyin_table[6],    &pinyin_table[137],  &pinyin_table[167],  }, /* fang ao => fan gao */
-    { &pinyin_table[138],  &pinyin_table[128],  &pinyin_table[137],  &pinyin_table[168],  }, /* fang e => fan ge */
-    { &pinyin_table[138],  &pinyin_table[129],  &pinyin_table[137],  &pinyin_table[170],  }, /* fang ei => fan gei */
-    { &pinyin_table[138],  &pinyin_table[130],  &pinyin_table[137],  &pinyin_table[172],  }, /* fang en => fan gen */
-    { &pinyin_table[145],  &pinyin_table[5],    &pinyin_table[144],  &pinyin_table[166],  }, /* feng ang => fen gang */
-    { &pinyin_table[145],  &pinyin_table[6],    &pinyin_table[144],  &pinyin_table[167],  }, /* feng ao => fen gao */
-    { &pinyin_table[145],  &pinyin_table[128],  &pinyin_table[144],  &pinyin_table[168],  }, /* feng e => fen ge */
-    { &pinyin_table[145],  &pinyin_table[129],  &pinyin_table[144],  &pinyin_table[170],  }, /* feng ei => fen gei */
-    { &pinyin_table[145],  &pinyin_table[130],  &pinyin_table[144],  &pinyin_table[172],  }, /* feng en => fen gen */
-    { &pinyin_table[145],  &pinyin_table[402],  &pinyin_table[144],  &pinyin_table[178],  }, /* feng ou => fen gou */
-    { &pinyin_table[147],  &pinyin_table[0],    &pinyin_table[146],  &pinyin_table[359],  }, /* fon a => fo na */
-    { &pinyin_table[147],  &pinyin_table[2],    &pinyin_table[146],  &pinyin_table[361],  }, /* fon ai => fo nai */
-    { &pinyin_table[147],  &pinyin_table[4],    &pinyin_table[146],  &pinyin_table[363],  }, /* fon an => fo nan */
-    { &pinyin_table[147],  &pinyin_table[5],    &pinyin_table[146],  &pinyin_table[364],  }, /* fon ang => fo nang */
-    { &pinyin_table[147],  &pinyin_table[6],    &pinyin_table[146],  &pinyin_table[365],  }, /* fon ao => fo nao */
-    { &pinyin_table[147],  &pinyin_table[128],  &pinyin_table[146],  &pinyin_table[366],  }, /* fon e => fo ne */
-    { &pinyin_table[147],  &pinyin_table[129],  &pinyin_table[146],  &pinyin_table[368],  }, /* fon ei => fo nei */
-    { &pinyin_table[147],  &pinyin_table[130],  &pinyin_table[146],  &pinyin_table[370],  }, /* fon en => fo nen */
-    { &pinyin_table[147],  &pinyin_table[402],  &pinyin_table[146],  &pinyin_table[391],  }, /* fon ou => fo nou */
-    { &pinyin_table[158],  &pinyin_table[0],    &pinyin_table[150],  &pinyin_table[359],  }, /* fun a => fu na */
-    { &pinyin_table[158],  &pinyin_table[2],    &pinyin_table[150],  &pinyin_table[361],  }, /* fun ai => fu nai */
-    { &pinyin_table[158],  &pinyin_table[4],    &pinyin_table[150],  &pinyin_table[363],  }, /* fun an => fu nan */
-    { &pinyin_table[158],  &pinyin_table[5],    &pinyin_table[150],  &pinyin_table[364],  }, /* fun ang => fu nang */
-    { &pinyin_table[158],  &pinyin_table[6],    &pinyin_table[150],  &pinyin_table[365],  }, /* fun ao => fu nao */
-    { &pinyin_table[158],  &pinyin_table[128],  &pinyin_table[150],  &pinyin_table[366],  }, /* fun e => fu ne */
-    { &pinyin_table[158],  &pinyin_table[129],  &pinyin_table[150],  &pinyin_table[368],  }, /* fun ei => fu nei */
-    { &pinyin_table[158],  &pinyin_table[130],  &pinyin_table[150],  &pinyin_table[370],  }, /* fun en => fu nen */
-    { &pinyin_table[158],  &pinyin_table[402],  &pinyin_table[150],  &pinyin_table[391],  }, /* fun ou => fu nou */
-    { &pinyin_table[165],  &pinyin_table[128],  &pinyin_table[161],  &pinyin_table[366],  }, /* gan e => ga ne */
-    { &pinyin_table[165],  &pinyin_table[129],  &pinyin_table[161],  &pinyin_table[368],  }, /* gan ei => ga nei */
-    { &pinyin_table[166],  &pinyin_table[0],    &pinyin_table[165],  &pinyin_table[161],  }, /* gang a => gan ga */
-    { &pinyin_table[166],  &pinyin_table[2],    &pinyin_table[165],  &pinyin_table[163],  }, /* gang ai => gan gai */
-    { &pinyin_table[166],  &pinyin_table[4],    &pinyin_table[165],  &pinyin_table[165],  }, /* gang an => gan gan */
-    { &pinyin_table[166],  &pinyin_table[5],    &pinyin_table[165],  &pinyin_table[166],  }, /* gang ang => gan gang */
-    { &pinyin_table[166],  &pinyin_table[128],  &pinyin_table[165],  &pinyin_table[168],  }, /* gang e => gan ge */
-    { &pinyin_table[166],  &pinyin_table[129],  &pinyin_table[165],  &pinyin_table[170],  }, /* gang ei => gan gei */
-    { &pinyin_table[166],  &pinyin_table[130],  &pinyin_table[165],  &pinyin_table[172],  }, /* gang en => gan gen */
-    { &pinyin_table[166],  &pinyin_table[402],  &pinyin_table[165],  &pinyin_table[178],  }, /* gang ou => gan gou */
-    { &pinyin_table[172],  &pinyin_table[0],    &pinyin_table[168],  &pinyin_table[359],  }, /* gen a => ge na */
-    { &pinyin_table[172],  &pinyin_table[4],    &pinyin_table[168],  &pinyin_table[363],  }, /* gen an => ge nan */
-    { &pinyin_table[172],  &pinyin_table[5],    &pinyin_table[168],  &pinyin_table[364],  }, /* gen ang => ge nang */
-    { &pinyin_table[172],  &pinyin_table[6],    &pinyin_table[168],  &pinyin_table[365],  }, /* gen ao => ge nao */
-    { &pinyin_table[172],  &pinyin_table[128],  &pinyin_table[168],  &pinyin_table[366],  }, /* gen e => ge ne */
-    { &pinyin_table[172],  &pinyin_table[129],  &pinyin_table[168],  &pinyin_table[368],  }, /* gen ei => ge nei */
-    { &pinyin_table[173],  &pinyin_table[5],    &pinyin_table[172],  &pinyin_table[166],  }, /* geng ang => gen gang */
-    { &pinyin_table[173],  &pinyin_table[6],    &pinyin_table[172],  &pinyin_table[167],  }, /* geng ao => gen gao */
-    { &pinyin_table[173],  &pinyin_table[128],  &pinyin_table[172],  &pinyin_table[168],  }, /* geng e => gen ge */
-    { &pinyin_table[173],  &pinyin_table[129],  &pinyin_table[172],  &pinyin_table[170],  }, /* geng ei => gen gei */
-    { &pinyin_table[173],  &pinyin_table[130],  &pinyin_table[172],  &pinyin_table[172],  }, /* geng en => gen gen */
-    { &pinyin_table[173],  &pinyin_table[402],  &pinyin_table[172],  &pinyin_table[178],  }, /* geng ou => gen gou */
-    { &pinyin_table[184],  &pinyin_table[129],  &pinyin_table[180],  &pinyin_table[368],  }, /* guan ei => gua nei */
-    { &pinyin_table[185],  &pinyin_table[2],    &pinyin_table[184],  &pinyin_table[163],  }, /* guang ai => guan gai */
-    { &pinyin_table[185],  &pinyin_table[5],    &pinyin_table[184],  &pinyin_table[166],  }, /* guang ang => guan gang */
-    { &pinyin_table[185],  &pinyin_table[6],    &pinyin_table[184],  &pinyin_table[167],  }, /* guang ao => guan gao */
-    { &pinyin_table[185],  &pinyin_table[128],  &pinyin_table[184],  &pinyin_table[168],  }, /* guang e => guan ge */
-    { &pinyin_table[185],  &pinyin_table[129],  &pinyin_table[184],  &pinyin_table[170],  }, /* guang ei => guan gei */
-    { &pinyin_table[185],  &pinyin_table[130],  &pinyin_table[184],  &pinyin_table[172],  }, /* guang en => guan gen */
-    { &pinyin_table[189],  &pinyin_table[4],    &pinyin_table[179],  &pinyin_table[363],  }, /* gun an => gu nan */
-    { &pinyin_table[189],  &pinyin_table[5],    &pinyin_table[179],  &pinyin_table[364],  }, /* gun ang => gu nang */
-    { &pinyin_table[189],  &pinyin_table[6],    &pinyin_table[179],  &pinyin_table[365],  }, /* gun ao => gu nao */
-    { &pinyin_table[189],  &pinyin_table[128],  &pinyin_table[179],  &pinyin_table[366],  }, /* gun e => gu ne */
-    { &pinyin_table[189],  &pinyin_table[129],  &pinyin_table[179],  &pinyin_table[368],  }, /* gun ei => gu nei */
-    { &pinyin_table[196],  &pinyin_table[5],    &pinyin_table[192],  &pinyin_table[364],  }, /* han ang => ha nang */
-    { &pinyin_table[196],  &pinyin_table[6],    &pinyin_table[192],  &pinyin_table[365],  }, /* han ao => ha nao */
-    { &pinyin_table[196],  &pinyin_table[129],  &pinyin_table[192],  &pinyin_table[368],  }, /* han ei => ha nei */
-    { &pinyin_table[197],  &pinyin_table[2],    &pinyin_table[196],  &pinyin_table[163],  }, /* hang ai => han gai */
-    { &pinyin_table[197],  &pinyin_table[5],    &pinyin_table[196],  &pinyin_table[166],  }, /* hang ang => han gang */
-    { &pinyin_table[197],  &pinyin_table[6],    &pinyin_table[196],  &pinyin_table[167],  }, /* hang ao => han gao */
-    { &pinyin_table[197],  &pinyin_table[128],  &pinyin_table[196],  &pinyin_table[168],  }, /* hang e => han ge */
-    { &pinyin_table[197],  &pinyin_table[129],  &pinyin_table[196],  &pinyin_table[170],  }, /* hang ei => han gei */
-    { &pinyin_table[197],  &pinyin_table[130],  &pinyin_table[196],  &pinyin_table[172],  }, /* hang en => han gen */
-    { &pinyin_table[197],  &pinyin_table[402],  &pinyin_table[196],  &pinyin_table[178],  }, /* hang ou => han gou */
-    { &pinyin_table[203],  &pinyin_table[0],    &pinyin_table[199],  &pinyin_table[359],  }, /* hen a => he na */
-    { &pinyin_table[203],  &pinyin_table[4],    &pinyin_table[199],  &pinyin_table[363],  }, /* hen an => he nan */
-    { &pinyin_table[203],  &pinyin_table[5],    &pinyin_table[199],  &pinyin_table[364],  }, /* hen ang => he nang */
-    { &pinyin_table[203],  &pinyin_table[6],    &pinyin_table[199],  &pinyin_table[365],  }, /* hen ao => he nao */
-    { &pinyin_table[203],  &pinyin_table[129],  &pinyin_table[199],  &pinyin_table[368],  }, /* hen ei => he nei */
-    { &pinyin_table[204],  &pinyin_table[2],    &pinyin_table[203],  &pinyin_table[163],  }, /* heng ai => hen gai */
-    { &pinyin_table[204],  &pinyin_table[4],    &pinyin_table[203],  &pinyin_table[165],  }, /* heng an => hen gan */
-    { &pinyin_table[204],  &pinyin_table[5],    &pinyin_table[203],  &pinyin_table[166],  }, /* heng ang => hen gang */
-    { &pinyin_table[204],  &pinyin_table[6],    &pinyin_table[203],  &pinyin_table[167],  }, /* heng ao => hen gao */
-    { &pinyin_table[204],  &pinyin_table[129],  &pinyin_table[203],  &pinyin_table[170],  }, /* heng ei => hen gei */
-    { &pinyin_table[204],  &pinyin_table[130],  &pinyin_table[203],  &pinyin_table[172],  }, /* heng en => hen gen */
-    { &pinyin_table[204],  &pinyin_table[402],  &pinyin_table[203],  &pinyin_table[178],  }, /* heng ou => hen gou */
-    { &pinyin_table[216],  &pinyin_table[0],    &pinyin_table[212],  &pinyin_table[359],  }, /* huan a => hua na */
-    { &pinyin_table[216],  &pinyin_table[4],    &pinyin_table[212],  &pinyin_table[363],  }, /* huan an => hua nan */
-    { &pinyin_table[216],  &pinyin_table[5],    &pinyin_table[212],  &pinyin_table[364],  }, /* huan ang => hua nang */
-    { &pinyin_table[216],  &pinyin_table[6],    &pinyin_table[212],  &pinyin_table[365],  }, /* huan ao => hua nao */
-    { &pinyin_table[216],  &pinyin_table[128],  &pinyin_table[212],  &pinyin_table[366],  }, /* huan e => hua ne */
-    { &pinyin_table[216],  &pinyin_table[129],  &pinyin_table[212],  &pinyin_table[368],  }, /* huan ei => hua nei */
-    { &pinyin_table[216],  &pinyin_table[130],  &pinyin_table[212],  &pinyin_table[370],  }, /* huan en => hua nen */
-    { &pinyin_table[217],  &pinyin_table[2],    &pinyin_table[216],  &pinyin_table[163],  }, /* huang ai => huan gai */
-    { &pinyin_table[217],  &pinyin_table[5],    &pinyin_table[216],  &pinyin_table[166],  }, /* huang ang => huan gang */
-    { &pinyin_table[217],  &pinyin_table[6],    &pinyin_table[216],  &pinyin_table[167],  }, /* huang ao => huan gao */
-    { &pinyin_table[217],  &pinyin_table[128],  &pinyin_table[216],  &pinyin_table[168],  }, /* huang e => huan ge */
-    { &pinyin_table[217],  &pinyin_table[129],  &pinyin_table[216],  &pinyin_table[170],  }, /* huang ei => huan gei */
-    { &pinyin_table[217],  &pinyin_table[402],  &pinyin_table[216],  &pinyin_table[178],  }, /* huang ou => huan gou */
-    { &pinyin_table[221],  &pinyin_table[4],    &pinyin_table[211],  &pinyin_table[363],  }, /* hun an => hu nan */
-    { &pinyin_table[221],  &pinyin_table[5],    &pinyin_table[211],  &pinyin_table[364],  }, /* hun ang => hu nang */
-    { &pinyin_table[221],  &pinyin_table[6],    &pinyin_table[211],  &pinyin_table[365],  }, /* hun ao => hu nao */
-    { &pinyin_table[221],  &pinyin_table[129],  &pinyin_table[211],  &pinyin_table[368],  }, /* hun ei => hu nei */
-    { &pinyin_table[228],  &pinyin_table[0],    &pinyin_table[225],  &pinyin_table[359],  }, /* jian a => jia na */
-    { &pinyin_table[228],  &pinyin_table[2],    &pinyin_table[225],  &pinyin_table[361],  }, /* jian ai => jia nai */
-    { &pinyin_table[228],  &pinyin_table[5],    &pinyin_table[225],  &pinyin_table[364],  }, /* jian ang => jia nang */
-    { &pinyin_table[228],  &pinyin_table[128],  &pinyin_table[225],  &pinyin_table[366],  }, /* jian e => jia ne */
-    { &pinyin_table[228],  &pinyin_table[129],  &pinyin_table[225],  &pinyin_table[368],  }, /* jian ei => jia nei */
-    { &pinyin_table[229],  &pinyin_table[5],    &pinyin_table[228],  &pinyin_table[166],  }, /* jiang ang => jian gang */
-    { &pinyin_table[229],  &pinyin_table[6],    &pinyin_table[228],  &pinyin_table[167],  }, /* jiang ao => jian gao */
-    { &pinyin_table[229],  &pinyin_table[128],  &pinyin_table[228],  &pinyin_table[168],  }, /* jiang e => jian ge */
-    { &pinyin_table[229],  &pinyin_table[129],  &pinyin_table[228],  &pinyin_table[170],  }, /* jiang ei => jian gei */
-    { &pinyin_table[229],  &pinyin_table[402],  &pinyin_table[228],  &pinyin_table[178],  }, /* jiang ou => jian gou */
-    { &pinyin_table[231],  &pinyin_table[459],  &pinyin_table[224],  &pinyin_table[131],  }, /* jie r => ji er */
-    { &pinyin_table[234],  &pinyin_table[0],    &pinyin_table[224],  &pinyin_table[359],  }, /* jin a => ji na */
-    { &pinyin_table[234],  &pinyin_table[4],    &pinyin_table[224],  &pinyin_table[363],  }, /* jin an => ji nan */
-    { &pinyin_table[234],  &pinyin_table[5],    &pinyin_table[224],  &pinyin_table[364],  }, /* jin ang => ji nang */
-    { &pinyin_table[234],  &pinyin_table[6],    &pinyin_table[224],  &pinyin_table[365],  }, /* jin ao => ji nao */
-    { &pinyin_table[234],  &pinyin_table[129],  &pinyin_table[224],  &pinyin_table[368],  }, /* jin ei => ji nei */
-    { &pinyin_table[235],  &pinyin_table[5],    &pinyin_table[234],  &pinyin_table[166],  }, /* jing ang => jin gang */
-    { &pinyin_table[235],  &pinyin_table[6],    &pinyin_table[234],  &pinyin_table[167],  }, /* jing ao => jin gao */
-    { &pinyin_table[235],  &pinyin_table[129],  &pinyin_table[234],  &pinyin_table[170],  }, /* jing ei => jin gei */
-    { &pinyin_table[235],  &pinyin_table[130],  &pinyin_table[234],  &pinyin_table[172],  }, /* jing en => jin gen */
-    { &pinyin_table[235],  &pinyin_table[402],  &pinyin_table[234],  &pinyin_table[178],  }, /* jing ou => jin gou */
-    { &pinyin_table[244],  &pinyin_table[0],    &pinyin_table[243],  &pinyin_table[161],  }, /* juang a => juan ga */
-    { &pinyin_table[244],  &pinyin_table[2],    &pinyin_table[243],  &pinyin_table[163],  }, /* juang ai => juan gai */
-    { &pinyin_table[244],  &pinyin_table[4],    &pinyin_table[243],  &pinyin_table[165],  }, /* juang an => juan gan */
-    { &pinyin_table[244],  &pinyin_table[5],    &pinyin_table[243],  &pinyin_table[166],  }, /* juang ang => juan gang */
-    { &pinyin_table[244],  &pinyin_table[6],    &pinyin_table[243],  &pinyin_table[167],  }, /* juang ao => juan gao */
-    { &pinyin_table[244],  &pinyin_table[128],  &pinyin_table[243],  &pinyin_table[168],  }, /* juang e => juan ge */
-    { &pinyin_table[244],  &pinyin_table[129],  &pinyin_table[243],  &pinyin_table[170],  }, /* juang ei => juan gei */
-    { &pinyin_table[244],  &pinyin_table[130],  &pinyin_table[243],  &pinyin_table[172],  }, /* juang en => juan gen */
-    { &pinyin_table[244],  &pinyin_table[402],  &pinyin_table[243],  &pinyin_table[178],  }, /* juang ou => juan gou */
-    { &pinyin_table[245],  &pinyin_table[459],  &pinyin_table[242],  &pinyin_table[131],  }, /* jue r => ju er */
-    { &pinyin_table[246],  &pinyin_table[0],    &pinyin_table[245],  &pinyin_table[359],  }, /* juen a => jue na */
-    { &pinyin_table[246],  &pinyin_table[2],    &pinyin_table[245],  &pinyin_table[361],  }, /* juen ai => jue nai */
-    { &pinyin_table[246],  &pinyin_table[4],    &pinyin_table[245],  &pinyin_table[363],  }, /* juen an => jue nan */
-    { &pinyin_table[246],  &pinyin_table[5],    &pinyin_table[245],  &pinyin_table[364],  }, /* juen ang => jue nang */
-    { &pinyin_table[246],  &pinyin_table[6],    &pinyin_table[245],  &pinyin_table[365],  }, /* juen ao => jue nao */
-    { &pinyin_table[246],  &pinyin_table[128],  &pinyin_table[245],  &pinyin_table[366],  }, /* juen e => jue ne */
-    { &pinyin_table[246],  &pinyin_table[129],  &pinyin_table[245],  &pinyin_table[368],  }, /* juen ei => jue nei */
-    { &pinyin_table[246],  &pinyin_table[130],  &pinyin_table[245],  &pinyin_table[370],  }, /* juen en => jue nen */
-    { &pinyin_table[246],  &pinyin_table[402],  &pinyin_table[245],  &pinyin_table[391],  }, /* juen ou => jue nou */
-    { &pinyin_table[247],  &pinyin_table[0],    &pinyin_table[242],  &pinyin_table[359],  }, /* jun a => ju na */
-    { &pinyin_table[247],  &pinyin_table[2],    &pinyin_table[242],  &pinyin_table[361],  }, /* jun ai => ju nai */
-    { &pinyin_table[247],  &pinyin_table[128],  &pinyin_table[242],  &pinyin_table[366],  }, /* jun e => ju ne */
-    { &pinyin_table[247],  &pinyin_table[129],  &pinyin_table[242],  &pinyin_table[368],  }, /* jun ei => ju nei */
-    { &pinyin_table[259],  &pinyin_table[129],  &pinyin_table[255],  &pinyin_table[368],  }, /* kan ei => ka nei */
-    { &pinyin_table[260],  &pinyin_table[4],    &pinyin_table[259],  &pinyin_table[165],  }, /* kang an => kan gan */
-    { &pinyin_table[260],  &pinyin_table[5],    &pinyin_table[259],  &pinyin_table[166],  }, /* kang ang => kan gang */
-    { &pinyin_table[260],  &pinyin_table[6],    &pinyin_table[259],  &pinyin_table[167],  }, /* kang ao => kan gao */
-    { &pinyin_table[260],  &pinyin_table[128],  &pinyin_table[259],  &pinyin_table[168],  }, /* kang e => kan ge */
-    { &pinyin_table[260],  &pinyin_table[129],  &pinyin_table[259],  &pinyin_table[170],  }, /* kang ei => kan gei */
-    { &pinyin_table[260],  &pinyin_table[130],  &pinyin_table[259],  &pinyin_table[172],  }, /* kang en => kan gen */
-    { &pinyin_table[260],  &pinyin_table[402],  &pinyin_table[259],  &pinyin_table[178],  }, /* kang ou => kan gou */
-    { &pinyin_table[266],  &pinyin_table[0],    &pinyin_table[262],  &pinyin_table[359],  }, /* ken a => ke na */
-    { &pinyin_table[266],  &pinyin_table[2],    &pinyin_table[262],  &pinyin_table[361],  }, /* ken ai => ke nai */
-    { &pinyin_table[266],  &pinyin_table[4],    &pinyin_table[262],  &pinyin_table[363],  }, /* ken an => ke nan */
-    { &pinyin_table[266],  &pinyin_table[5],    &pinyin_table[262],  &pinyin_table[364],  }, /* ken ang => ke nang */
-    { &pinyin_table[266],  &pinyin_table[6],    &pinyin_table[262],  &pinyin_table[365],  }, /* ken ao => ke nao */
-    { &pinyin_table[266],  &pinyin_table[128],  &pinyin_table[262],  &pinyin_table[366],  }, /* ken e => ke ne */
-    { &pinyin_table[266],  &pinyin_table[129],  &pinyin_table[262],  &pinyin_table[368],  }, /* ken ei => ke nei */
-    { &pinyin_table[267],  &pinyin_table[2],    &pinyin_table[266],  &pinyin_table[163],  }, /* keng ai => ken gai */
-    { &pinyin_table[267],  &pinyin_table[4],    &pinyin_table[266],  &pinyin_table[165],  }, /* keng an => ken gan */
-    { &pinyin_table[267],  &pinyin_table[5],    &pinyin_table[266],  &pinyin_table[166],  }, /* keng ang => ken gang */
-    { &pinyin_table[267],  &pinyin_table[6],    &pinyin_table[266],  &pinyin_table[167],  }, /* keng ao => ken gao */
-    { &pinyin_table[267],  &pinyin_table[128],  &pinyin_table[266],  &pinyin_table[168],  }, /* keng e => ken ge */
-    { &pinyin_table[267],  &pinyin_table[129],  &pinyin_table[266],  &pinyin_table[170],  }, /* keng ei => ken gei */
-    { &pinyin_table[267],  &pinyin_table[130],  &pinyin_table[266],  &pinyin_table[172],  }, /* keng en => ken gen */
-    { &pinyin_table[267],  &pinyin_table[402],  &pinyin_table[266],  &pinyin_table[178],  }, /* keng ou => ken gou */
-    { &pinyin_table[278],  &pinyin_table[0],    &pinyin_table[274],  &pinyin_table[359],  }, /* kuan a => kua na */
-    { &pinyin_table[278],  &pinyin_table[129],  &pinyin_table[274],  &pinyin_table[368],  }, /* kuan ei => kua nei */
-    { &pinyin_table[279],  &pinyin_table[5],    &pinyin_table[278],  &pinyin_table[166],  }, /* kuang ang => kuan gang */
-    { &pinyin_table[279],  &pinyin_table[128],  &pinyin_table[278],  &pinyin_table[168],  }, /* kuang e => kuan ge */
-    { &pinyin_table[279],  &pinyin_table[129],  &pinyin_table[278],  &pinyin_table[170],  }, /* kuang ei => kuan gei */
-    { &pinyin_table[279],  &pinyin_table[130],  &pinyin_table[278],  &pinyin_table[172],  }, /* kuang en => kuan gen */
-    { &pinyin_table[283],  &pinyin_table[4],    &pinyin_table[273],  &pinyin_table[363],  }, /* kun an => ku nan */
-    { &pinyin_table[283],  &pinyin_table[5],    &pinyin_table[273],  &pinyin_table[364],  }, /* kun ang => ku nang */
-    { &pinyin_table[283],  &pinyin_table[6],    &pinyin_table[273],  &pinyin_table[365],  }, /* kun ao => ku nao */
-    { &pinyin_table[283],  &pinyin_table[128],  &pinyin_table[273],  &pinyin_table[366],  }, /* kun e => ku ne */
-    { &pinyin_table[283],  &pinyin_table[129],  &pinyin_table[273],  &pinyin_table[368],  }, /* kun ei => ku nei */
-    { &pinyin_table[290],  &pinyin_table[0],    &pinyin_table[286],  &pinyin_table[359],  }, /* lan a => la na */
-    { &pinyin_table[290],  &pinyin_table[4],    &pinyin_table[286],  &pinyin_table[363],  }, /* lan an => la nan */
-    { &pinyin_table[290],  &pinyin_table[5],    &pinyin_table[286],  &pinyin_table[364],  }, /* lan ang => la nang */
-    { &pinyin_table[290],  &pinyin_table[6],    &pinyin_table[286],  &pinyin_table[365],  }, /* lan ao => la nao */
-    { &pinyin_table[290],  &pinyin_table[128],  &pinyin_table[286],  &pinyin_table[366],  }, /* lan e => la ne */
-    { &pinyin_table[290],  &pinyin_table[129],  &pinyin_table[286],  &pinyin_table[368],  }, /* lan ei => la nei */
-    { &pinyin_table[291],  &pinyin_table[4],    &pinyin_table[290],  &pinyin_table[165],  }, /* lang an => lan gan */
-    { &pinyin_table[291],  &pinyin_table[5],    &pinyin_table[290],  &pinyin_table[166],  }, /* lang ang => lan gang */
-    { &pinyin_table[291],  &pinyin_table[6],    &pinyin_table[290],  &pinyin_table[167],  }, /* lang ao => lan gao */
-    { &pinyin_table[291],  &pinyin_table[128],  &pinyin_table[290],  &pinyin_table[168],  }, /* lang e => lan ge */
-    { &pinyin_table[291],  &pinyin_table[129],  &pinyin_table[290],  &pinyin_table[170],  }, /* lang ei => lan gei */
-    { &pinyin_table[291],  &pinyin_table[130],  &pinyin_table[290],  &pinyin_table[172],  }, /* lang en => lan gen */
-    { &pinyin_table[291],  &pinyin_table[402],  &pinyin_table[290],  &pinyin_table[178],  }, /* lang ou => lan gou */
-    { &pinyin_table[297],  &pinyin_table[0],    &pinyin_table[293],  &pinyin_table[359],  }, /* len a => le na */
-    { &pinyin_table[297],  &pinyin_table[2],    &pinyin_table[293],  &pinyin_table[361],  }, /* len ai => le nai */
-    { &pinyin_table[297],  &pinyin_table[4],    &pinyin_table[293],  &pinyin_table[363],  }, /* len an => le nan */
-    { &pinyin_table[297],  &pinyin_table[5],    &pinyin_table[293],  &pinyin_table[364],  }, /* len ang => le nang */
-    { &pinyin_table[297],  &pinyin_table[6],    &pinyin_table[293],  &pinyin_table[365],  }, /* len ao => le nao */
-    { &pinyin_table[297],  &pinyin_table[128],  &pinyin_table[293],  &pinyin_table[366],  }, /* len e => le ne */
-    { &pinyin_table[297],  &pinyin_table[129],  &pinyin_table[293],  &pinyin_table[368],  }, /* len ei => le nei */
-    { &pinyin_table[297],  &pinyin_table[130],  &pinyin_table[293],  &pinyin_table[370],  }, /* len en => le nen */
-    { &pinyin_table[297],  &pinyin_table[402],  &pinyin_table[293],  &pinyin_table[391],  }, /* len ou => le nou */
-    { &pinyin_table[303],  &pinyin_table[129],  &pinyin_table[300],  &pinyin_table[368],  }, /* lian ei => lia nei */
-    { &pinyin_table[304],  &pinyin_table[5],    &pinyin_table[303],  &pinyin_table[166],  }, /* liang ang => lian gang */
-    { &pinyin_table[304],  &pinyin_table[6],    &pinyin_table[303],  &pinyin_table[167],  }, /* liang ao => lian gao */
-    { &pinyin_table[304],  &pinyin_table[128],  &pinyin_table[303],  &pinyin_table[168],  }, /* liang e => lian ge */
-    { &pinyin_table[304],  &pinyin_table[129],  &pinyin_table[303],  &pinyin_table[170],  }, /* liang ei => lian gei */
-    { &pinyin_table[304],  &pinyin_table[130],  &pinyin_table[303],  &pinyin_table[172],  }, /* liang en => lian gen */
-    { &pinyin_table[304],  &pinyin_table[402],  &pinyin_table[303],  &pinyin_table[178],  }, /* liang ou => lian gou */
-    { &pinyin_table[306],  &pinyin_table[459],  &pinyin_table[299],  &pinyin_table[131],  }, /* lie r => li er */
-    { &pinyin_table[309],  &pinyin_table[0],    &pinyin_table[299],  &pinyin_table[359],  }, /* lin a => li na */
-    { &pinyin_table[309],  &pinyin_table[4],    &pinyin_table[299],  &pinyin_table[363],  }, /* lin an => li nan */
-    { &pinyin_table[309],  &pinyin_table[5],    &pinyin_table[299],  &pinyin_table[364],  }, /* lin ang => li nang */
-    { &pinyin_table[309],  &pinyin_table[6],    &pinyin_table[299],  &pinyin_table[365],  }, /* lin ao => li nao */
-    { &pinyin_table[309],  &pinyin_table[128],  &pinyin_table[299],  &pinyin_table[366],  }, /* lin e => li ne */
-    { &pinyin_table[309],  &pinyin_table[129],  &pinyin_table[299],  &pinyin_table[368],  }, /* lin ei => li nei */
-    { &pinyin_table[310],  &pinyin_table[5],    &pinyin_table[309],  &pinyin_table[166],  }, /* ling ang => lin gang */
-    { &pinyin_table[310],  &pinyin_table[6],    &pinyin_table[309],  &pinyin_table[167],  }, /* ling ao => lin gao */
-    { &pinyin_table[310],  &pinyin_table[128],  &pinyin_table[309],  &pinyin_table[168],  }, /* ling e => lin ge */
-    { &pinyin_table[310],  &pinyin_table[129],  &pinyin_table[309],  &pinyin_table[170],  }, /* ling ei => lin gei */
-    { &pinyin_table[310],  &pinyin_table[130],  &pinyin_table[309],  &pinyin_table[172],  }, /* ling en => lin gen */
-    { &pinyin_table[310],  &pinyin_table[402],  &pinyin_table[309],  &pinyin_table[178],  }, /* ling ou => lin gou */
-    { &pinyin_table[316],  &pinyin_table[0],    &pinyin_table[313],  &pinyin_table[359],  }, /* lon a => lo na */
-    { &pinyin_table[316],  &pinyin_table[2],    &pinyin_table[313],  &pinyin_table[361],  }, /* lon ai => lo nai */
-    { &pinyin_table[316],  &pinyin_table[4],    &pinyin_table[313],  &pinyin_table[363],  }, /* lon an => lo nan */
-    { &pinyin_table[316],  &pinyin_table[5],    &pinyin_table[313],  &pinyin_table[364],  }, /* lon ang => lo nang */
-    { &pinyin_table[316],  &pinyin_table[6],    &pinyin_table[313],  &pinyin_table[365],  }, /* lon ao => lo nao */
-    { &pinyin_table[316],  &pinyin_table[128],  &pinyin_table[313],  &pinyin_table[366],  }, /* lon e => lo ne */
-    { &pinyin_table[316],  &pinyin_table[129],  &pinyin_table[313],  &pinyin_table[368],  }, /* lon ei => lo nei */
-    { &pinyin_table[316],  &pinyin_table[130],  &pinyin_table[313],  &pinyin_table[370],  }, /* lon en => lo nen */
-    { &pinyin_table[316],  &pinyin_table[402],  &pinyin_table[313],  &pinyin_table[391],  }, /* lon ou => lo nou */
-    { &pinyin_table[321],  &pinyin_table[0],    &pinyin_table[320],  &pinyin_table[161],  }, /* luang a => luan ga */
-    { &pinyin_table[321],  &pinyin_table[2],    &pinyin_table[320],  &pinyin_table[163],  }, /* luang ai => luan gai */
-    { &pinyin_table[321],  &pinyin_table[4],    &pinyin_table[320],  &pinyin_table[165],  }, /* luang an => luan gan */
-    { &pinyin_table[321],  &pinyin_table[5],    &pinyin_table[320],  &pinyin_table[166],  }, /* luang ang => luan gang */
-    { &pinyin_table[321],  &pinyin_table[6],    &pinyin_table[320],  &pinyin_table[167],  }, /* luang ao => luan gao */
-    { &pinyin_table[321],  &pinyin_table[128],  &pinyin_table[320],  &pinyin_table[168],  }, /* luang e => luan ge */
-    { &pinyin_table[321],  &pinyin_table[129],  &pinyin_table[320],  &pinyin_table[170],  }, /* luang ei => luan gei */
-    { &pinyin_table[321],  &pinyin_table[130],  &pinyin_table[320],  &pinyin_table[172],  }, /* luang en => luan gen */
-    { &pinyin_table[321],  &pinyin_table[402],  &pinyin_table[320],  &pinyin_table[178],  }, /* luang ou => luan gou */
-    { &pinyin_table[322],  &pinyin_table[459],  &pinyin_table[319],  &pinyin_table[131],  }, /* lue r => lu er */
-    { &pinyin_table[326],  &pinyin_table[0],    &pinyin_table[319],  &pinyin_table[359],  }, /* lun a => lu na */
-    { &pinyin_table[326],  &pinyin_table[2],    &pinyin_table[319],  &pinyin_table[361],  }, /* lun ai => lu nai */
-    { &pinyin_table[326],  &pinyin_table[4],    &pinyin_table[319],  &pinyin_table[363],  }, /* lun an => lu nan */
-    { &pinyin_table[326],  &pinyin_table[5],    &pinyin_table[319],  &pinyin_table[364],  }, /* lun ang => lu nang */
-    { &pinyin_table[326],  &pinyin_table[6],    &pinyin_table[319],  &pinyin_table[365],  }, /* lun ao => lu nao */
-    { &pinyin_table[326],  &pinyin_table[128],  &pinyin_table[319],  &pinyin_table[366],  }, /* lun e => lu ne */
-    { &pinyin_table[326],  &pinyin_table[129],  &pinyin_table[319],  &pinyin_table[368],  }, /* lun ei => lu nei */
-    { &pinyin_table[329],  &pinyin_table[459],  &pinyin_table[328],  &pinyin_table[131],  }, /* lve r => lv er */
-    { &pinyin_table[335],  &pinyin_table[2],    &pinyin_table[331],  &pinyin_table[361],  }, /* man ai => ma nai */
-    { &pinyin_table[335],  &pinyin_table[4],    &pinyin_table[331],  &pinyin_table[363],  }, /* man an => ma nan */
-    { &pinyin_table[335],  &pinyin_table[5],    &pinyin_table[331],  &pinyin_table[364],  }, /* man ang => ma nang */
-    { &pinyin_table[335],  &pinyin_table[6],    &pinyin_table[331],  &pinyin_table[365],  }, /* man ao => ma nao */
-    { &pinyin_table[335],  &pinyin_table[128],  &pinyin_table[331],  &pinyin_table[366],  }, /* man e => ma ne */
-    { &pinyin_table[335],  &pinyin_table[129],  &pinyin_table[331],  &pinyin_table[368],  }, /* man ei => ma nei */
-    { &pinyin_table[336],  &pinyin_table[2],    &pinyin_table[335],  &pinyin_table[163],  }, /* mang ai => man gai */
-    { &pinyin_table[336],  &pinyin_table[4],    &pinyin_table[335],  &pinyin_table[165],  }, /* mang an => man gan */
-    { &pinyin_table[336],  &pinyin_table[5],    &pinyin_table[335],  &pinyin_table[166],  }, /* mang ang => man gang */
-    { &pinyin_table[336],  &pinyin_table[6],    &pinyin_table[335],  &pinyin_table[167],  }, /* mang ao => man gao */
-    { &pinyin_table[336],  &pinyin_table[128],  &pinyin_table[335],  &pinyin_table[168],  }, /* mang e => man ge */
-    { &pinyin_table[336],  &pinyin_table[129],  &pinyin_table[335],  &pinyin_table[170],  }, /* mang ei => man gei */
-    { &pinyin_table[336],  &pinyin_table[130],  &pinyin_table[335],  &pinyin_table[172],  }, /* mang en => man gen */
-    { &pinyin_table[336],  &pinyin_table[402],  &pinyin_table[335],  &pinyin_table[178],  }, /* mang ou => man gou */
-    { &pinyin_table[342],  &pinyin_table[5],    &pinyin_table[338],  &pinyin_table[364],  }, /* men ang => me nang */
-    { &pinyin_table[342],  &pinyin_table[6],    &pinyin_table[338],  &pinyin_table[365],  }, /* men ao => me nao */
-    { &pinyin_table[342],  &pinyin_table[128],  &pinyin_table[338],  &pinyin_table[366],  }, /* men e => me ne */
-    { &pinyin_table[342],  &pinyin_table[129],  &pinyin_table[338],  &pinyin_table[368],  }, /* men ei => me nei */
-    { &pinyin_table[343],  &pinyin_table[2],    &pinyin_table[342],  &pinyin_table[163],  }, /* meng ai => men gai */
-    { &pinyin_table[343],  &pinyin_table[5],    &pinyin_table[342],  &pinyin_table[166],  }, /* meng ang => men gang */
-    { &pinyin_table[343],  &pinyin_table[6],    &pinyin_table[342],  &pinyin_table[167],  }, /* meng ao => men gao */
-    { &pinyin_table[343],  &pinyin_table[128],  &pinyin_table[342],  &pinyin_table[168],  }, /* meng e => men ge */
-    { &pinyin_table[343],  &pinyin_table[129],  &pinyin_table[342],  &pinyin_table[170],  }, /* meng ei => men gei */
-    { &pinyin_table[343],  &pinyin_table[402],  &pinyin_table[342],  &pinyin_table[178],  }, /* meng ou => men gou */
-    { &pinyin_table[346],  &pinyin_table[0],    &pinyin_table[345],  &pinyin_table[161],  }, /* miang a => mian ga */
-    { &pinyin_table[346],  &pinyin_table[2],    &pinyin_table[345],  &pinyin_table[163],  }, /* miang ai => mian gai */
-    { &pinyin_table[346],  &pinyin_table[4],    &pinyin_table[345],  &pinyin_table[165],  }, /* miang an => mian gan */
-    { &pinyin_table[346],  &pinyin_table[5],    &pinyin_table[345],  &pinyin_table[166],  }, /* miang ang => mian gang */
-    { &pinyin_table[346],  &pinyin_table[6],    &pinyin_table[345],  &pinyin_table[167],  }, /* miang ao => mian gao */
-    { &pinyin_table[346],  &pinyin_table[128],  &pinyin_table[345],  &pinyin_table[168],  }, /* miang e => mian ge */
-    { &pinyin_table[346],  &pinyin_table[129],  &pinyin_table[345],  &pinyin_table[170],  }, /* miang ei => mian gei */
-    { &pinyin_table[346],  &pinyin_table[130],  &pinyin_table[345],  &pinyin_table[172],  }, /* miang en => mian gen */
-    { &pinyin_table[346],  &pinyin_table[402],  &pinyin_table[345],  &pinyin_table[178],  }, /* miang ou => mian gou */
-    { &pinyin_table[348],  &pinyin_table[459],  &pinyin_table[344],  &pinyin_table[131],  }, /* mie r => mi er */
-    { &pinyin_table[351],  &pinyin_table[0],    &pinyin_table[344],  &pinyin_table[359],  }, /* min a => mi na */
-    { &pinyin_table[351],  &pinyin_table[128],  &pinyin_table[344],  &pinyin_table[366],  }, /* min e => mi ne */
-    { &pinyin_table[351],  &pinyin_table[129],  &pinyin_table[344],  &pinyin_table[368],  }, /* min ei => mi nei */
-    { &pinyin_table[352],  &pinyin_table[4],    &pinyin_table[351],  &pinyin_table[165],  }, /* ming an => min gan */
-    { &pinyin_table[352],  &pinyin_table[5],    &pinyin_table[351],  &pinyin_table[166],  }, /* ming ang => min gang */
-    { &pinyin_table[352],  &pinyin_table[6],    &pinyin_table[351],  &pinyin_table[167],  }, /* ming ao => min gao */
-    { &pinyin_table[352],  &pinyin_table[128],  &pinyin_table[351],  &pinyin_table[168],  }, /* ming e => min ge */
-    { &pinyin_table[352],  &pinyin_table[129],  &pinyin_table[351],  &pinyin_table[170],  }, /* ming ei => min gei */
-    { &pinyin_table[352],  &pinyin_table[402],  &pinyin_table[351],  &pinyin_table[178],  }, /* ming ou => min gou */
-    { &pinyin_table[363],  &pinyin_table[0],    &pinyin_table[359],  &pinyin_table[359],  }, /* nan a => na na */
-    { &pinyin_table[363],  &pinyin_table[5],    &pinyin_table[359],  &pinyin_table[364],  }, /* nan ang => na nang */
-    { &pinyin_table[363],  &pinyin_table[128],  &pinyin_table[359],  &pinyin_table[366],  }, /* nan e => na ne */
-    { &pinyin_table[363],  &pinyin_table[129],  &pinyin_table[359],  &pinyin_table[368],  }, /* nan ei => na nei */
-    { &pinyin_table[364],  &pinyin_table[0],    &pinyin_table[363],  &pinyin_table[161],  }, /* nang a => nan ga */
-    { &pinyin_table[364],  &pinyin_table[2],    &pinyin_table[363],  &pinyin_table[163],  }, /* nang ai => nan gai */
-    { &pinyin_table[364],  &pinyin_table[4],    &pinyin_table[363],  &pinyin_table[165],  }, /* nang an => nan gan */
-    { &pinyin_table[364],  &pinyin_table[5],    &pinyin_table[363],  &pinyin_table[166],  }, /* nang ang => nan gang */
-    { &pinyin_table[364],  &pinyin_table[6],    &pinyin_table[363],  &pinyin_table[167],  }, /* nang ao => nan gao */
-    { &pinyin_table[364],  &pinyin_table[128],  &pinyin_table[363],  &pinyin_table[168],  }, /* nang e => nan ge */
-    { &pinyin_table[364],  &pinyin_table[129],  &pinyin_table[363],  &pinyin_table[170],  }, /* nang ei => nan gei */
-    { &pinyin_table[364],  &pinyin_table[130],  &pinyin_table[363],  &pinyin_table[172],  }, /* nang en => nan gen */
-    { &pinyin_table[364],  &pinyin_table[402],  &pinyin_table[363],  &pinyin_table[178],  }, /* nang ou => nan gou */
-    { &pinyin_table[370],  &pinyin_table[0],    &pinyin_table[366],  &pinyin_table[359],  }, /* nen a => ne na */
-    { &pinyin_table[370],  &pinyin_table[2],    &pinyin_table[366],  &pinyin_table[361],  }, /* nen ai => ne nai */
-    { &pinyin_table[370],  &pinyin_table[4],    &pinyin_table[366],  &pinyin_table[363],  }, /* nen an => ne nan */
-    { &pinyin_table[370],  &pinyin_table[5],    &pinyin_table[366],  &pinyin_table[364],  }, /* nen ang => ne nang */
-    { &pinyin_table[370],  &pinyin_table[6],    &pinyin_table[366],  &pinyin_table[365],  }, /* nen ao => ne nao */
-    { &pinyin_table[370],  &pinyin_table[128],  &pinyin_table[366],  &pinyin_table[366],  }, /* nen e => ne ne */
-    { &pinyin_table[370],  &pinyin_table[129],  &pinyin_table[366],  &pinyin_table[368],  }, /* nen ei => ne nei */
-    { &pinyin_table[370],  &pinyin_table[130],  &pinyin_table[366],  &pinyin_table[370],  }, /* nen en => ne nen */
-    { &pinyin_table[371],  &pinyin_table[128],  &pinyin_table[370],  &pinyin_table[168],  }, /* neng e => nen ge */
-    { &pinyin_table[371],  &pinyin_table[129],  &pinyin_table[370],  &pinyin_table[170],  }, /* neng ei => nen gei */
-    { &pinyin_table[377],  &pinyin_table[2],    &pinyin_table[376],  &pinyin_table[163],  }, /* niang ai => nian gai */
-    { &pinyin_table[377],  &pinyin_table[4],    &pinyin_table[376],  &pinyin_table[165],  }, /* niang an => nian gan */
-    { &pinyin_table[377],  &pinyin_table[5],    &pinyin_table[376],  &pinyin_table[166],  }, /* niang ang => nian gang */
-    { &pinyin_table[377],  &pinyin_table[6],    &pinyin_table[376],  &pinyin_table[167],  }, /* niang ao => nian gao */
-    { &pinyin_table[377],  &pinyin_table[128],  &pinyin_table[376],  &pinyin_table[168],  }, /* niang e => nian ge */
-    { &pinyin_table[377],  &pinyin_table[129],  &pinyin_table[376],  &pinyin_table[170],  }, /* niang ei => nian gei */
-    { &pinyin_table[377],  &pinyin_table[130],  &pinyin_table[376],  &pinyin_table[172],  }, /* niang en => nian gen */
-    { &pinyin_table[377],  &pinyin_table[402],  &pinyin_table[376],  &pinyin_table[178],  }, /* niang ou => nian gou */
-    { &pinyin_table[379],  &pinyin_table[459],  &pinyin_table[372],  &pinyin_table[131],  }, /* nie r => ni er */
-    { &pinyin_table[382],  &pinyin_table[0],    &pinyin_table[372],  &pinyin_table[359],  }, /* nin a => ni na */
-    { &pinyin_table[382],  &pinyin_table[4],    &pinyin_table[372],  &pinyin_table[363],  }, /* nin an => ni nan */
-    { &pinyin_table[382],  &pinyin_table[5],    &pinyin_table[372],  &pinyin_table[364],  }, /* nin ang => ni nang */
-    { &pinyin_table[382],  &pinyin_table[6],    &pinyin_table[372],  &pinyin_table[365],  }, /* nin ao => ni nao */
-    { &pinyin_table[382],  &pinyin_table[128],  &pinyin_table[372],  &pinyin_table[366],  }, /* nin e => ni ne */
-    { &pinyin_table[382],  &pinyin_table[129],  &pinyin_table[372],  &pinyin_table[368],  }, /* nin ei => ni nei */
-    { &pinyin_table[383],  &pinyin_table[2],    &pinyin_table[382],  &pinyin_table[163],  }, /* ning ai => nin gai */
-    { &pinyin_table[383],  &pinyin_table[5],    &pinyin_table[382],  &pinyin_table[166],  }, /* ning ang => nin gang */
-    { &pinyin_table[383],  &pinyin_table[6],    &pinyin_table[382],  &pinyin_table[167],  }, /* ning ao => nin gao */
-    { &pinyin_table[383],  &pinyin_table[129],  &pinyin_table[382],  &pinyin_table[170],  }, /* ning ei => nin gei */
-    { &pinyin_table[383],  &pinyin_table[130],  &pinyin_table[382],  &pinyin_table[172],  }, /* ning en => nin gen */
-    { &pinyin_table[383],  &pinyin_table[402],  &pinyin_table[382],  &pinyin_table[178],  }, /* ning ou => nin gou */
-    { &pinyin_table[394],  &pinyin_table[0],    &pinyin_table[393],  &pinyin_table[161],  }, /* nuang a => nuan ga */
-    { &pinyin_table[394],  &pinyin_table[2],    &pinyin_table[393],  &pinyin_table[163],  }, /* nuang ai => nuan gai */
-    { &pinyin_table[394],  &pinyin_table[4],    &pinyin_table[393],  &pinyin_table[165],  }, /* nuang an => nuan gan */
-    { &pinyin_table[394],  &pinyin_table[5],    &pinyin_table[393],  &pinyin_table[166],  }, /* nuang ang => nuan gang */
-    { &pinyin_table[394],  &pinyin_table[6],    &pinyin_table[393],  &pinyin_table[167],  }, /* nuang ao => nuan gao */
-    { &pinyin_table[394],  &pinyin_table[128],  &pinyin_table[393],  &pinyin_table[168],  }, /* nuang e => nuan ge */
-    { &pinyin_table[394],  &pinyin_table[129],  &pinyin_table[393],  &pinyin_table[170],  }, /* nuang ei => nuan gei */
-    { &pinyin_table[394],  &pinyin_table[130],  &pinyin_table[393],  &pinyin_table[172],  }, /* nuang en => nuan gen */
-    { &pinyin_table[394],  &pinyin_table[402],  &pinyin_table[393],  &pinyin_table[178],  }, /* nuang ou => nuan gou */
-    { &pinyin_table[395],  &pinyin_table[459],  &pinyin_table[392],  &pinyin_table[131],  }, /* nue r => nu er */
-    { &pinyin_table[397],  &pinyin_table[0],    &pinyin_table[392],  &pinyin_table[359],  }, /* nun a => nu na */
-    { &pinyin_table[397],  &pinyin_table[2],    &pinyin_table[392],  &pinyin_table[361],  }, /* nun ai => nu nai */
-    { &pinyin_table[397],  &pinyin_table[4],    &pinyin_table[392],  &pinyin_table[363],  }, /* nun an => nu nan */
-    { &pinyin_table[397],  &pinyin_table[5],    &pinyin_table[392],  &pinyin_table[364],  }, /* nun ang => nu nang */
-    { &pinyin_table[397],  &pinyin_table[6],    &pinyin_table[392],  &pinyin_table[365],  }, /* nun ao => nu nao */
-    { &pinyin_table[397],  &pinyin_table[128],  &pinyin_table[392],  &pinyin_table[366],  }, /* nun e => nu ne */
-    { &pinyin_table[397],  &pinyin_table[129],  &pinyin_table[392],  &pinyin_table[368],  }, /* nun ei => nu nei */
-    { &pinyin_table[397],  &pinyin_table[130],  &pinyin_table[392],  &pinyin_table[370],  }, /* nun en => nu nen */
-    { &pinyin_table[397],  &pinyin_table[402],  &pinyin_table[392],  &pinyin_table[391],  }, /* nun ou => nu nou */
-    { &pinyin_table[400],  &pinyin_table[459],  &pinyin_table[399],  &pinyin_table[131],  }, /* nve r => nv er */
-    { &pinyin_table[408],  &pinyin_table[0],    &pinyin_table[404],  &pinyin_table[359],  }, /* pan a => pa na */
-    { &pinyin_table[408],  &pinyin_table[5],    &pinyin_table[404],  &pinyin_table[364],  }, /* pan ang => pa nang */
-    { &pinyin_table[408],  &pinyin_table[6],    &pinyin_table[404],  &pinyin_table[365],  }, /* pan ao => pa nao */
-    { &pinyin_table[408],  &pinyin_table[128],  &pinyin_table[404],  &pinyin_table[366],  }, /* pan e => pa ne */
-    { &pinyin_table[408],  &pinyin_table[129],  &pinyin_table[404],  &pinyin_table[368],  }, /* pan ei => pa nei */
-    { &pinyin_table[409],  &pinyin_table[5],    &pinyin_table[408],  &pinyin_table[166],  }, /* pang ang => pan gang */
-    { &pinyin_table[409],  &pinyin_table[6],    &pinyin_table[408],  &pinyin_table[167],  }, /* pang ao => pan gao */
-    { &pinyin_table[409],  &pinyin_table[128],  &pinyin_table[408],  &pinyin_table[168],  }, /* pang e => pan ge */
-    { &pinyin_table[409],  &pinyin_table[129],  &pinyin_table[408],  &pinyin_table[170],  }, /* pang ei => pan gei */
-    { &pinyin_table[409],  &pinyin_table[130],  &pinyin_table[408],  &pinyin_table[172],  }, /* pang en => pan gen */
-    { &pinyin_table[409],  &pinyin_table[402],  &pinyin_table[408],  &pinyin_table[178],  }, /* pang ou => pan gou */
-    { &pinyin_table[415],  &pinyin_table[5],    &pinyin_table[414],  &pinyin_table[166],  }, /* peng ang => pen gang */
-    { &pinyin_table[415],  &pinyin_table[6],    &pinyin_table[414],  &pinyin_table[167],  }, /* peng ao => pen gao */
-    { &pinyin_table[415],  &pinyin_table[128],  &pinyin_table[414],  &pinyin_table[168],  }, /* peng e => pen ge */
-    { &pinyin_table[415],  &pinyin_table[129],  &pinyin_table[414],  &pinyin_table[170],  }, /* peng ei => pen gei */
-    { &pinyin_table[418],  &pinyin_table[0],    &pinyin_table[417],  &pinyin_table[161],  }, /* piang a => pian ga */
-    { &pinyin_table[418],  &pinyin_table[2],    &pinyin_table[417],  &pinyin_table[163],  }, /* piang ai => pian gai */
-    { &pinyin_table[418],  &pinyin_table[4],    &pinyin_table[417],  &pinyin_table[165],  }, /* piang an => pian gan */
-    { &pinyin_table[418],  &pinyin_table[5],    &pinyin_table[417],  &pinyin_table[166],  }, /* piang ang => pian gang */
-    { &pinyin_table[418],  &pinyin_table[6],    &pinyin_table[417],  &pinyin_table[167],  }, /* piang ao => pian gao */
-    { &pinyin_table[418],  &pinyin_table[128],  &pinyin_table[417],  &pinyin_table[168],  }, /* piang e => pian ge */
-    { &pinyin_table[418],  &pinyin_table[129],  &pinyin_table[417],  &pinyin_table[170],  }, /* piang ei => pian gei */
-    { &pinyin_table[418],  &pinyin_table[130],  &pinyin_table[417],  &pinyin_table[172],  }, /* piang en => pian gen */
-    { &pinyin_table[418],  &pinyin_table[402],  &pinyin_table[417],  &pinyin_table[178],  }, /* piang ou => pian gou */
-    { &pinyin_table[420],  &pinyin_table[459],  &pinyin_table[416],  &pinyin_table[131],  }, /* pie r => pi er */
-    { &pinyin_table[423],  &pinyin_table[0],    &pinyin_table[416],  &pinyin_table[359],  }, /* pin a => pi na */
-    { &pinyin_table[423],  &pinyin_table[5],    &pinyin_table[416],  &pinyin_table[364],  }, /* pin ang => pi nang */
-    { &pinyin_table[423],  &pinyin_table[6],    &pinyin_table[416],  &pinyin_table[365],  }, /* pin ao => pi nao */
-    { &pinyin_table[423],  &pinyin_table[128],  &pinyin_table[416],  &pinyin_table[366],  }, /* pin e => pi ne */
-    { &pinyin_table[423],  &pinyin_table[129],  &pinyin_table[416],  &pinyin_table[368],  }, /* pin ei => pi nei */
-    { &pinyin_table[424],  &pinyin_table[5],    &pinyin_table[423],  &pinyin_table[166],  }, /* ping ang => pin gang */
-    { &pinyin_table[424],  &pinyin_table[6],    &pinyin_table[423],  &pinyin_table[167],  }, /* ping ao => pin gao */
-    { &pinyin_table[424],  &pinyin_table[128],  &pinyin_table[423],  &pinyin_table[168],  }, /* ping e => pin ge */
-    { &pinyin_table[424],  &pinyin_table[129],  &pinyin_table[423],  &pinyin_table[170],  }, /* ping ei => pin gei */
-    { &pinyin_table[424],  &pinyin_table[130],  &pinyin_table[423],  &pinyin_table[172],  }, /* ping en => pin gen */
-    { &pinyin_table[424],  &pinyin_table[402],  &pinyin_table[423],  &pinyin_table[178],  }, /* ping ou => pin gou */
-    { &pinyin_table[433],  &pinyin_table[129],  &pinyin_table[430],  &pinyin_table[368],  }, /* qian ei => qia nei */
-    { &pinyin_table[434],  &pinyin_table[2],    &pinyin_table[433],  &pinyin_table[163],  }, /* qiang ai => qian gai */
-    { &pinyin_table[434],  &pinyin_table[4],    &pinyin_table[433],  &pinyin_table[165],  }, /* qiang an => qian gan */
-    { &pinyin_table[434],  &pinyin_table[5],    &pinyin_table[433],  &pinyin_table[166],  }, /* qiang ang => qian gang */
-    { &pinyin_table[434],  &pinyin_table[6],    &pinyin_table[433],  &pinyin_table[167],  }, /* qiang ao => qian gao */
-    { &pinyin_table[434],  &pinyin_table[128],  &pinyin_table[433],  &pinyin_table[168],  }, /* qiang e => qian ge */
-    { &pinyin_table[434],  &pinyin_table[129],  &pinyin_table[433],  &pinyin_table[170],  }, /* qiang ei => qian gei */
-    { &pinyin_table[434],  &pinyin_table[130],  &pinyin_table[433],  &pinyin_table[172],  }, /* qiang en => qian gen */
-    { &pinyin_table[434],  &pinyin_table[402],  &pinyin_table[433],  &pinyin_table[178],  }, /* qiang ou => qian gou */
-    { &pinyin_table[436],  &pinyin_table[459],  &pinyin_table[429],  &pinyin_table[131],  }, /* qie r => qi er */
-    { &pinyin_table[439],  &pinyin_table[0],    &pinyin_table[429],  &pinyin_table[359],  }, /* qin a => qi na */
-    { &pinyin_table[439],  &pinyin_table[5],    &pinyin_table[429],  &pinyin_table[364],  }, /* qin ang => qi nang */
-    { &pinyin_table[439],  &pinyin_table[6],    &pinyin_table[429],  &pinyin_table[365],  }, /* qin ao => qi nao */
-    { &pinyin_table[439],  &pinyin_table[128],  &pinyin_table[429],  &pinyin_table[366],  }, /* qin e => qi ne */
-    { &pinyin_table[439],  &pinyin_table[129],  &pinyin_table[429],  &pinyin_table[368],  }, /* qin ei => qi nei */
-    { &pinyin_table[440],  &pinyin_table[5],    &pinyin_table[439],  &pinyin_table[166],  }, /* qing ang => qin gang */
-    { &pinyin_table[440],  &pinyin_table[6],    &pinyin_table[439],  &pinyin_table[167],  }, /* qing ao => qin gao */
-    { &pinyin_table[440],  &pinyin_table[128],  &pinyin_table[439],  &pinyin_table[168],  }, /* qing e => qin ge */
-    { &pinyin_table[440],  &pinyin_table[129],  &pinyin_table[439],  &pinyin_table[170],  }, /* qing ei => qin gei */
-    { &pinyin_table[440],  &pinyin_table[130],  &pinyin_table[439],  &pinyin_table[172],  }, /* qing en => qin gen */
-    { &pinyin_table[440],  &pinyin_table[402],  &pinyin_table[439],  &pinyin_table[178],  }, /* qing ou => qin gou */
-    { &pinyin_table[449],  &pinyin_table[0],    &pinyin_table[448],  &pinyin_table[161],  }, /* quang a => quan ga */
-    { &pinyin_table[449],  &pinyin_table[2],    &pinyin_table[448],  &pinyin_table[163],  }, /* quang ai => quan gai */
-    { &pinyin_table[449],  &pinyin_table[4],    &pinyin_table[448],  &pinyin_table[165],  }, /* quang an => quan gan */
-    { &pinyin_table[449],  &pinyin_table[5],    &pinyin_table[448],  &pinyin_table[166],  }, /* quang ang => quan gang */
-    { &pinyin_table[449],  &pinyin_table[6],    &pinyin_table[448],  &pinyin_table[167],  }, /* quang ao => quan gao */
-    { &pinyin_table[449],  &pinyin_table[128],  &pinyin_table[448],  &pinyin_table[168],  }, /* quang e => quan ge */
-    { &pinyin_table[449],  &pinyin_table[129],  &pinyin_table[448],  &pinyin_table[170],  }, /* quang ei => quan gei */
-    { &pinyin_table[449],  &pinyin_table[130],  &pinyin_table[448],  &pinyin_table[172],  }, /* quang en => quan gen */
-    { &pinyin_table[449],  &pinyin_table[402],  &pinyin_table[448],  &pinyin_table[178],  }, /* quang ou => quan gou */
-    { &pinyin_table[450],  &pinyin_table[459],  &pinyin_table[447],  &pinyin_table[131],  }, /* que r => qu er */
-    { &pinyin_table[451],  &pinyin_table[0],    &pinyin_table[450],  &pinyin_table[359],  }, /* quen a => que na */
-    { &pinyin_table[451],  &pinyin_table[2],    &pinyin_table[450],  &pinyin_table[361],  }, /* quen ai => que nai */
-    { &pinyin_table[451],  &pinyin_table[4],    &pinyin_table[450],  &pinyin_table[363],  }, /* quen an => que nan */
-    { &pinyin_table[451],  &pinyin_table[5],    &pinyin_table[450],  &pinyin_table[364],  }, /* quen ang => que nang */
-    { &pinyin_table[451],  &pinyin_table[6],    &pinyin_table[450],  &pinyin_table[365],  }, /* quen ao => que nao */
-    { &pinyin_table[451],  &pinyin_table[128],  &pinyin_table[450],  &pinyin_table[366],  }, /* quen e => que ne */
-    { &pinyin_table[451],  &pinyin_table[129],  &pinyin_table[450],  &pinyin_table[368],  }, /* quen ei => que nei */
-    { &pinyin_table[451],  &pinyin_table[130],  &pinyin_table[450],  &pinyin_table[370],  }, /* quen en => que nen */
-    { &pinyin_table[451],  &pinyin_table[402],  &pinyin_table[450],  &pinyin_table[391],  }, /* quen ou => que nou */
-    { &pinyin_table[452],  &pinyin_table[0],    &pinyin_table[447],  &pinyin_table[359],  }, /* qun a => qu na */
-    { &pinyin_table[452],  &pinyin_table[4],    &pinyin_table[447],  &pinyin_table[363],  }, /* qun an => qu nan */
-    { &pinyin_table[452],  &pinyin_table[5],    &pinyin_table[447],  &pinyin_table[364],  }, /* qun ang => qu nang */
-    { &pinyin_table[452],  &pinyin_table[6],    &pinyin_table[447],  &pinyin_table[365],  }, /* qun ao => qu nao */
-    { &pinyin_table[452],  &pinyin_table[128],  &pinyin_table[447],  &pinyin_table[366],  }, /* qun e => qu ne */
-    { &pinyin_table[452],  &pinyin_table[129],  &pinyin_table[447],  &pinyin_table[368],  }, /* qun ei => qu nei */
-    { &pinyin_table[465],  &pinyin_table[5],    &pinyin_table[464],  &pinyin_table[166],  }, /* rang ang => ran gang */
-    { &pinyin_table[465],  &pinyin_table[6],    &pinyin_table[464],  &pinyin_table[167],  }, /* rang ao => ran gao */
-    { &pinyin_table[465],  &pinyin_table[129],  &pinyin_table[464],  &pinyin_table[170],  }, /* rang ei => ran gei */
-    { &pinyin_table[465],  &pinyin_table[130],  &pinyin_table[464],  &pinyin_table[172],  }, /* rang en => ran gen */
-    { &pinyin_table[471],  &pinyin_table[6],    &pinyin_table[467],  &pinyin_table[365],  }, /* ren ao => re nao */
-    { &pinyin_table[471],  &pinyin_table[128],  &pinyin_table[467],  &pinyin_table[366],  }, /* ren e => re ne */
-    { &pinyin_table[471],  &pinyin_table[129],  &pinyin_table[467],  &pinyin_table[368],  }, /* ren ei => re nei */
-    { &pinyin_table[472],  &pinyin_table[0],    &pinyin_table[471],  &pinyin_table[161],  }, /* reng a => ren ga */
-    { &pinyin_table[472],  &pinyin_table[2],    &pinyin_table[471],  &pinyin_table[163],  }, /* reng ai => ren gai */
-    { &pinyin_table[472],  &pinyin_table[4],    &pinyin_table[471],  &pinyin_table[165],  }, /* reng an => ren gan */
-    { &pinyin_table[472],  &pinyin_table[5],    &pinyin_table[471],  &pinyin_table[166],  }, /* reng ang => ren gang */
-    { &pinyin_table[472],  &pinyin_table[6],    &pinyin_table[471],  &pinyin_table[167],  }, /* reng ao => ren gao */
-    { &pinyin_table[472],  &pinyin_table[128],  &pinyin_table[471],  &pinyin_table[168],  }, /* reng e => ren ge */
-    { &pinyin_table[472],  &pinyin_table[129],  &pinyin_table[471],  &pinyin_table[170],  }, /* reng ei => ren gei */
-    { &pinyin_table[472],  &pinyin_table[130],  &pinyin_table[471],  &pinyin_table[172],  }, /* reng en => ren gen */
-    { &pinyin_table[472],  &pinyin_table[402],  &pinyin_table[471],  &pinyin_table[178],  }, /* reng ou => ren gou */
-    { &pinyin_table[478],  &pinyin_table[459],  &pinyin_table[473],  &pinyin_table[131],  }, /* rie r => ri er */
-    { &pinyin_table[479],  &pinyin_table[0],    &pinyin_table[473],  &pinyin_table[359],  }, /* rin a => ri na */
-    { &pinyin_table[479],  &pinyin_table[2],    &pinyin_table[473],  &pinyin_table[361],  }, /* rin ai => ri nai */
-    { &pinyin_table[479],  &pinyin_table[4],    &pinyin_table[473],  &pinyin_table[363],  }, /* rin an => ri nan */
-    { &pinyin_table[479],  &pinyin_table[5],    &pinyin_table[473],  &pinyin_table[364],  }, /* rin ang => ri nang */
-    { &pinyin_table[479],  &pinyin_table[6],    &pinyin_table[473],  &pinyin_table[365],  }, /* rin ao => ri nao */
-    { &pinyin_table[479],  &pinyin_table[128],  &pinyin_table[473],  &pinyin_table[366],  }, /* rin e => ri ne */
-    { &pinyin_table[479],  &pinyin_table[129],  &pinyin_table[473],  &pinyin_table[368],  }, /* rin ei => ri nei */
-    { &pinyin_table[479],  &pinyin_table[130],  &pinyin_table[473],  &pinyin_table[370],  }, /* rin en => ri nen */
-    { &pinyin_table[479],  &pinyin_table[402],  &pinyin_table[473],  &pinyin_table[391],  }, /* rin ou => ri nou */
-    { &pinyin_table[491],  &pinyin_table[0],    &pinyin_table[490],  &pinyin_table[161],  }, /* ruang a => ruan ga */
-    { &pinyin_table[491],  &pinyin_table[2],    &pinyin_table[490],  &pinyin_table[163],  }, /* ruang ai => ruan gai */
-    { &pinyin_table[491],  &pinyin_table[4],    &pinyin_table[490],  &pinyin_table[165],  }, /* ruang an => ruan gan */
-    { &pinyin_table[491],  &pinyin_table[5],    &pinyin_table[490],  &pinyin_table[166],  }, /* ruang ang => ruan gang */
-    { &pinyin_table[491],  &pinyin_table[6],    &pinyin_table[490],  &pinyin_table[167],  }, /* ruang ao => ruan gao */
-    { &pinyin_table[491],  &pinyin_table[128],  &pinyin_table[490],  &pinyin_table[168],  }, /* ruang e => ruan ge */
-    { &pinyin_table[491],  &pinyin_table[129],  &pinyin_table[490],  &pinyin_table[170],  }, /* ruang ei => ruan gei */
-    { &pinyin_table[491],  &pinyin_table[130],  &pinyin_table[490],  &pinyin_table[172],  }, /* ruang en => ruan gen */
-    { &pinyin_table[491],  &pinyin_table[402],  &pinyin_table[490],  &pinyin_table[178],  }, /* ruang ou => ruan gou */
-    { &pinyin_table[492],  &pinyin_table[459],  &pinyin_table[489],  &pinyin_table[131],  }, /* rue r => ru er */
-    { &pinyin_table[496],  &pinyin_table[0],    &pinyin_table[489],  &pinyin_table[359],  }, /* run a => ru na */
-    { &pinyin_table[496],  &pinyin_table[2],    &pinyin_table[489],  &pinyin_table[361],  }, /* run ai => ru nai */
-    { &pinyin_table[496],  &pinyin_table[4],    &pinyin_table[489],  &pinyin_table[363],  }, /* run an => ru nan */
-    { &pinyin_table[496],  &pinyin_table[5],    &pinyin_table[489],  &pinyin_table[364],  }, /* run ang => ru nang */
-    { &pinyin_table[496],  &pinyin_table[6],    &pinyin_table[489],  &pinyin_table[365],  }, /* run ao => ru nao */
-    { &pinyin_table[496],  &pinyin_table[128],  &pinyin_table[489],  &pinyin_table[366],  }, /* run e => ru ne */
-    { &pinyin_table[496],  &pinyin_table[129],  &pinyin_table[489],  &pinyin_table[368],  }, /* run ei => ru nei */
-    { &pinyin_table[496],  &pinyin_table[130],  &pinyin_table[489],  &pinyin_table[370],  }, /* run en => ru nen */
-    { &pinyin_table[505],  &pinyin_table[0],    &pinyin_table[501],  &pinyin_table[359],  }, /* san a => sa na */
-    { &pinyin_table[505],  &pinyin_table[129],  &pinyin_table[501],  &pinyin_table[368],  }, /* san ei => sa nei */
-    { &pinyin_table[506],  &pinyin_table[2],    &pinyin_table[505],  &pinyin_table[163],  }, /* sang ai => san gai */
-    { &pinyin_table[506],  &pinyin_table[4],    &pinyin_table[505],  &pinyin_table[165],  }, /* sang an => san gan */
-    { &pinyin_table[506],  &pinyin_table[5],    &pinyin_table[505],  &pinyin_table[166],  }, /* sang ang => san gang */
-    { &pinyin_table[506],  &pinyin_table[6],    &pinyin_table[505],  &pinyin_table[167],  }, /* sang ao => san gao */
-    { &pinyin_table[506],  &pinyin_table[128],  &pinyin_table[505],  &pinyin_table[168],  }, /* sang e => san ge */
-    { &pinyin_table[506],  &pinyin_table[129],  &pinyin_table[505],  &pinyin_table[170],  }, /* sang ei => san gei */
-    { &pinyin_table[506],  &pinyin_table[130],  &pinyin_table[505],  &pinyin_table[172],  }, /* sang en => san gen */
-    { &pinyin_table[512],  &pinyin_table[0],    &pinyin_table[508],  &pinyin_table[359],  }, /* sen a => se na */
-    { &pinyin_table[512],  &pinyin_table[2],    &pinyin_table[508],  &pinyin_table[361],  }, /* sen ai => se nai */
-    { &pinyin_table[512],  &pinyin_table[4],    &pinyin_table[508],  &pinyin_table[363],  }, /* sen an => se nan */
-    { &pinyin_table[512],  &pinyin_table[5],    &pinyin_table[508],  &pinyin_table[364],  }, /* sen ang => se nang */
-    { &pinyin_table[512],  &pinyin_table[6],    &pinyin_table[508],  &pinyin_table[365],  }, /* sen ao => se nao */
-    { &pinyin_table[512],  &pinyin_table[128],  &pinyin_table[508],  &pinyin_table[366],  }, /* sen e => se ne */
-    { &pinyin_table[512],  &pinyin_table[129],  &pinyin_table[508],  &pinyin_table[368],  }, /* sen ei => se nei */
-    { &pinyin_table[513],  &pinyin_table[2],    &pinyin_table[512],  &pinyin_table[163],  }, /* seng ai => sen gai */
-    { &pinyin_table[513],  &pinyin_table[4],    &pinyin_table[512],  &pinyin_table[165],  }, /* seng an => sen gan */
-    { &pinyin_table[513],  &pinyin_table[5],    &pinyin_table[512],  &pinyin_table[166],  }, /* seng ang => sen gang */
-    { &pinyin_table[513],  &pinyin_table[6],    &pinyin_table[512],  &pinyin_table[167],  }, /* seng ao => sen gao */
-    { &pinyin_table[513],  &pinyin_table[128],  &pinyin_table[512],  &pinyin_table[168],  }, /* seng e => sen ge */
-    { &pinyin_table[513],  &pinyin_table[129],  &pinyin_table[512],  &pinyin_table[170],  }, /* seng ei => sen gei */
-    { &pinyin_table[513],  &pinyin_table[130],  &pinyin_table[512],  &pinyin_table[172],  }, /* seng en => sen gen */
-    { &pinyin_table[513],  &pinyin_table[402],  &pinyin_table[512],  &pinyin_table[178],  }, /* seng ou => sen gou */
-    { &pinyin_table[519],  &pinyin_table[0],    &pinyin_table[515],  &pinyin_table[359],  }, /* shan a => sha na */
-    { &pinyin_table[519],  &pinyin_table[4],    &pinyin_table[515],  &pinyin_table[363],  }, /* shan an => sha nan */
-    { &pinyin_table[519],  &pinyin_table[129],  &pinyin_table[515],  &pinyin_table[368],  }, /* shan ei => sha nei */
-    { &pinyin_table[520],  &pinyin_table[2],    &pinyin_table[519],  &pinyin_table[163],  }, /* shang ai => shan gai */
-    { &pinyin_table[520],  &pinyin_table[5],    &pinyin_table[519],  &pinyin_table[166],  }, /* shang ang => shan gang */
-    { &pinyin_table[520],  &pinyin_table[6],    &pinyin_table[519],  &pinyin_table[167],  }, /* shang ao => shan gao */
-    { &pinyin_table[520],  &pinyin_table[128],  &pinyin_table[519],  &pinyin_table[168],  }, /* shang e => shan ge */
-    { &pinyin_table[520],  &pinyin_table[129],  &pinyin_table[519],  &pinyin_table[170],  }, /* shang ei => shan gei */
-    { &pinyin_table[520],  &pinyin_table[130],  &pinyin_table[519],  &pinyin_table[172],  }, /* shang en => shan gen */
-    { &pinyin_table[520],  &pinyin_table[402],  &pinyin_table[519],  &pinyin_table[178],  }, /* shang ou => shan gou */
-    { &pinyin_table[526],  &pinyin_table[129],  &pinyin_table[522],  &pinyin_table[368],  }, /* shen ei => she nei */
-    { &pinyin_table[527],  &pinyin_table[4],    &pinyin_table[526],  &pinyin_table[165],  }, /* sheng an => shen gan */
-    { &pinyin_table[527],  &pinyin_table[5],    &pinyin_table[526],  &pinyin_table[166],  }, /* sheng ang => shen gang */
-    { &pinyin_table[527],  &pinyin_table[6],    &pinyin_table[526],  &pinyin_table[167],  }, /* sheng ao => shen gao */
-    { &pinyin_table[527],  &pinyin_table[128],  &pinyin_table[526],  &pinyin_table[168],  }, /* sheng e => shen ge */
-    { &pinyin_table[527],  &pinyin_table[129],  &pinyin_table[526],  &pinyin_table[170],  }, /* sheng ei => shen gei */
-    { &pinyin_table[527],  &pinyin_table[402],  &pinyin_table[526],  &pinyin_table[178],  }, /* sheng ou => shen gou */
-    { &pinyin_table[537],  &pinyin_table[0],    &pinyin_table[533],  &pinyin_table[359],  }, /* shuan a => shua na */
-    { &pinyin_table[537],  &pinyin_table[2],    &pinyin_table[533],  &pinyin_table[361],  }, /* shuan ai => shua nai */
-    { &pinyin_table[537],  &pinyin_table[4],    &pinyin_table[533],  &pinyin_table[363],  }, /* shuan an => shua nan */
-    { &pinyin_table[537],  &pinyin_table[5],    &pinyin_table[533],  &pinyin_table[364],  }, /* shuan ang => shua nang */
-    { &pinyin_table[537],  &pinyin_table[6],    &pinyin_table[533],  &pinyin_table[365],  }, /* shuan ao => shua nao */
-    { &pinyin_table[537],  &pinyin_table[128],  &pinyin_table[533],  &pinyin_table[366],  }, /* shuan e => shua ne */
-    { &pinyin_table[537],  &pinyin_table[129],  &pinyin_table[533],  &pinyin_table[368],  }, /* shuan ei => shua nei */
-    { &pinyin_table[538],  &pinyin_table[129],  &pinyin_table[537],  &pinyin_table[170],  }, /* shuang ei => shuan gei */
-    { &pinyin_table[542],  &pinyin_table[4],    &pinyin_table[532],  &pinyin_table[363],  }, /* shun an => shu nan */
-    { &pinyin_table[542],  &pinyin_table[5],    &pinyin_table[532],  &pinyin_table[364],  }, /* shun ang => shu nang */
-    { &pinyin_table[542],  &pinyin_table[6],    &pinyin_table[532],  &pinyin_table[365],  }, /* shun ao => shu nao */
-    { &pinyin_table[542],  &pinyin_table[128],  &pinyin_table[532],  &pinyin_table[366],  }, /* shun e => shu ne */
-    { &pinyin_table[542],  &pinyin_table[129],  &pinyin_table[532],  &pinyin_table[368],  }, /* shun ei => shu nei */
-    { &pinyin_table[554],  &pinyin_table[0],    &pinyin_table[553],  &pinyin_table[161],  }, /* suang a => suan ga */
-    { &pinyin_table[554],  &pinyin_table[2],    &pinyin_table[553],  &pinyin_table[163],  }, /* suang ai => suan gai */
-    { &pinyin_table[554],  &pinyin_table[4],    &pinyin_table[553],  &pinyin_table[165],  }, /* suang an => suan gan */
-    { &pinyin_table[554],  &pinyin_table[5],    &pinyin_table[553],  &pinyin_table[166],  }, /* suang ang => suan gang */
-    { &pinyin_table[554],  &pinyin_table[6],    &pinyin_table[553],  &pinyin_table[167],  }, /* suang ao => suan gao */
-    { &pinyin_table[554],  &pinyin_table[128],  &pinyin_table[553],  &pinyin_table[168],  }, /* suang e => suan ge */
-    { &pinyin_table[554],  &pinyin_table[129],  &pinyin_table[553],  &pinyin_table[170],  }, /* suang ei => suan gei */
-    { &pinyin_table[554],  &pinyin_table[130],  &pinyin_table[553],  &pinyin_table[172],  }, /* suang en => suan gen */
-    { &pinyin_table[554],  &pinyin_table[402],  &pinyin_table[553],  &pinyin_table[178],  }, /* suang ou => suan gou */
-    { &pinyin_table[558],  &pinyin_table[0],    &pinyin_table[550],  &pinyin_table[359],  }, /* sun a => su na */
-    { &pinyin_table[558],  &pinyin_table[4],    &pinyin_table[550],  &pinyin_table[363],  }, /* sun an => su nan */
-    { &pinyin_table[558],  &pinyin_table[5],    &pinyin_table[550],  &pinyin_table[364],  }, /* sun ang => su nang */
-    { &pinyin_table[558],  &pinyin_table[6],    &pinyin_table[550],  &pinyin_table[365],  }, /* sun ao => su nao */
-    { &pinyin_table[558],  &pinyin_table[128],  &pinyin_table[550],  &pinyin_table[366],  }, /* sun e => su ne */
-    { &pinyin_table[558],  &pinyin_table[129],  &pinyin_table[550],  &pinyin_table[368],  }, /* sun ei => su nei */
-    { &pinyin_table[565],  &pinyin_table[0],    &pinyin_table[561],  &pinyin_table[359],  }, /* tan a => ta na */
-    { &pinyin_table[565],  &pinyin_table[5],    &pinyin_table[561],  &pinyin_table[364],  }, /* tan ang => ta nang */
-    { &pinyin_table[565],  &pinyin_table[6],    &pinyin_table[561],  &pinyin_table[365],  }, /* tan ao => ta nao */
-    { &pinyin_table[565],  &pinyin_table[128],  &pinyin_table[561],  &pinyin_table[366],  }, /* tan e => ta ne */
-    { &pinyin_table[565],  &pinyin_table[129],  &pinyin_table[561],  &pinyin_table[368],  }, /* tan ei => ta nei */
-    { &pinyin_table[566],  &pinyin_table[2],    &pinyin_table[565],  &pinyin_table[163],  }, /* tang ai => tan gai */
-    { &pinyin_table[566],  &pinyin_table[4],    &pinyin_table[565],  &pinyin_table[165],  }, /* tang an => tan gan */
-    { &pinyin_table[566],  &pinyin_table[5],    &pinyin_table[565],  &pinyin_table[166],  }, /* tang ang => tan gang */
-    { &pinyin_table[566],  &pinyin_table[128],  &pinyin_table[565],  &pinyin_table[168],  }, /* tang e => tan ge */
-    { &pinyin_table[566],  &pinyin_table[129],  &pinyin_table[565],  &pinyin_table[170],  }, /* tang ei => tan gei */
-    { &pinyin_table[566],  &pinyin_table[402],  &pinyin_table[565],  &pinyin_table[178],  }, /* tang ou => tan gou */
-    { &pinyin_table[571],  &pinyin_table[0],    &pinyin_table[568],  &pinyin_table[359],  }, /* ten a => te na */
-    { &pinyin_table[571],  &pinyin_table[2],    &pinyin_table[568],  &pinyin_table[361],  }, /* ten ai => te nai */
-    { &pinyin_table[571],  &pinyin_table[4],    &pinyin_table[568],  &pinyin_table[363],  }, /* ten an => te nan */
-    { &pinyin_table[571],  &pinyin_table[5],    &pinyin_table[568],  &pinyin_table[364],  }, /* ten ang => te nang */
-    { &pinyin_table[571],  &pinyin_table[6],    &pinyin_table[568],  &pinyin_table[365],  }, /* ten ao => te nao */
-    { &pinyin_table[571],  &pinyin_table[128],  &pinyin_table[568],  &pinyin_table[366],  }, /* ten e => te ne */
-    { &pinyin_table[571],  &pinyin_table[129],  &pinyin_table[568],  &pinyin_table[368],  }, /* ten ei => te nei */
-    { &pinyin_table[571],  &pinyin_table[130],  &pinyin_table[568],  &pinyin_table[370],  }, /* ten en => te nen */
-    { &pinyin_table[571],  &pinyin_table[402],  &pinyin_table[568],  &pinyin_table[391],  }, /* ten ou => te nou */
-    { &pinyin_table[575],  &pinyin_table[0],    &pinyin_table[574],  &pinyin_table[161],  }, /* tiang a => tian ga */
-    { &pinyin_table[575],  &pinyin_table[2],    &pinyin_table[574],  &pinyin_table[163],  }, /* tiang ai => tian gai */
-    { &pinyin_table[575],  &pinyin_table[4],    &pinyin_table[574],  &pinyin_table[165],  }, /* tiang an => tian gan */
-    { &pinyin_table[575],  &pinyin_table[5],    &pinyin_table[574],  &pinyin_table[166],  }, /* tiang ang => tian gang */
-    { &pinyin_table[575],  &pinyin_table[6],    &pinyin_table[574],  &pinyin_table[167],  }, /* tiang ao => tian gao */
-    { &pinyin_table[575],  &pinyin_table[128],  &pinyin_table[574],  &pinyin_table[168],  }, /* tiang e => tian ge */
-    { &pinyin_table[575],  &pinyin_table[129],  &pinyin_table[574],  &pinyin_table[170],  }, /* tiang ei => tian gei */
-    { &pinyin_table[575],  &pinyin_table[130],  &pinyin_table[574],  &pinyin_table[172],  }, /* tiang en => tian gen */
-    { &pinyin_table[575],  &pinyin_table[402],  &pinyin_table[574],  &pinyin_table[178],  }, /* tiang ou => tian gou */
-    { &pinyin_table[577],  &pinyin_table[459],  &pinyin_table[573],  &pinyin_table[131],  }, /* tie r => ti er */
-    { &pinyin_table[580],  &pinyin_table[0],    &pinyin_table[573],  &pinyin_table[359],  }, /* tin a => ti na */
-    { &pinyin_table[580],  &pinyin_table[2],    &pinyin_table[573],  &pinyin_table[361],  }, /* tin ai => ti nai */
-    { &pinyin_table[580],  &pinyin_table[4],    &pinyin_table[573],  &pinyin_table[363],  }, /* tin an => ti nan */
-    { &pinyin_table[580],  &pinyin_table[5],    &pinyin_table[573],  &pinyin_table[364],  }, /* tin ang => ti nang */
-    { &pinyin_table[580],  &pinyin_table[6],    &pinyin_table[573],  &pinyin_table[365],  }, /* tin ao => ti nao */
-    { &pinyin_table[580],  &pinyin_table[128],  &pinyin_table[573],  &pinyin_table[366],  }, /* tin e => ti ne */
-    { &pinyin_table[580],  &pinyin_table[129],  &pinyin_table[573],  &pinyin_table[368],  }, /* tin ei => ti nei */
-    { &pinyin_table[580],  &pinyin_table[130],  &pinyin_table[573],  &pinyin_table[370],  }, /* tin en => ti nen */
-    { &pinyin_table[580],  &pinyin_table[402],  &pinyin_table[573],  &pinyin_table[391],  }, /* tin ou => ti nou */
-    { &pinyin_table[589],  &pinyin_table[0],    &pinyin_table[588],  &pinyin_table[161],  }, /* tuang a => tuan ga */
-    { &pinyin_table[589],  &pinyin_table[2],    &pinyin_table[588],  &pinyin_table[163],  }, /* tuang ai => tuan gai */
-    { &pinyin_table[589],  &pinyin_table[4],    &pinyin_table[588],  &pinyin_table[165],  }, /* tuang an => tuan gan */
-    { &pinyin_table[589],  &pinyin_table[5],    &pinyin_table[588],  &pinyin_table[166],  }, /* tuang ang => tuan gang */
-    { &pinyin_table[589],  &pinyin_table[6],    &pinyin_table[588],  &pinyin_table[167],  }, /* tuang ao => tuan gao */
-    { &pinyin_table[589],  &pinyin_table[128],  &pinyin_table[588],  &pinyin_table[168],  }, /* tuang e => tuan ge */
-    { &pinyin_table[589],  &pinyin_table[129],  &pinyin_table[588],  &pinyin_table[170],  }, /* tuang ei => tuan gei */
-    { &pinyin_table[589],  &pinyin_table[130],  &pinyin_table[588],  &pinyin_table[172],  }, /* tuang en => tuan gen */
-    { &pinyin_table[589],  &pinyin_table[402],  &pinyin_table[588],  &pinyin_table[178],  }, /* tuang ou => tuan gou */
-    { &pinyin_table[593],  &pinyin_table[0],    &pinyin_table[587],  &pinyin_table[359],  }, /* tun a => tu na */
-    { &pinyin_table[593],  &pinyin_table[2],    &pinyin_table[587],  &pinyin_table[361],  }, /* tun ai => tu nai */
-    { &pinyin_table[593],  &pinyin_table[4],    &pinyin_table[587],  &pinyin_table[363],  }, /* tun an => tu nan */
-    { &pinyin_table[593],  &pinyin_table[5],    &pinyin_table[587],  &pinyin_table[364],  }, /* tun ang => tu nang */
-    { &pinyin_table[593],  &pinyin_table[6],    &pinyin_table[587],  &pinyin_table[365],  }, /* tun ao => tu nao */
-    { &pinyin_table[593],  &pinyin_table[128],  &pinyin_table[587],  &pinyin_table[366],  }, /* tun e => tu ne */
-    { &pinyin_table[593],  &pinyin_table[129],  &pinyin_table[587],  &pinyin_table[368],  }, /* tun ei => tu nei */
-    { &pinyin_table[593],  &pinyin_table[130],  &pinyin_table[587],  &pinyin_table[370],  }, /* tun en => tu nen */
-    { &pinyin_table[600],  &pinyin_table[129],  &pinyin_table[596],  &pinyin_table[368],  }, /* wan ei => wa nei */
-    { &pinyin_table[601],  &pinyin_table[5],    &pinyin_table[600],  &pinyin_table[166],  }, /* wang ang => wan gang */
-    { &pinyin_table[601],  &pinyin_table[6],    &pinyin_table[600],  &pinyin_table[167],  }, /* wang ao => wan gao */
-    { &pinyin_table[601],  &pinyin_table[128],  &pinyin_table[600],  &pinyin_table[168],  }, /* wang e => wan ge */
-    { &pinyin_table[601],  &pinyin_table[129],  &pinyin_table[600],  &pinyin_table[170],  }, /* wang ei => wan gei */
-    { &pinyin_table[601],  &pinyin_table[402],  &pinyin_table[600],  &pinyin_table[178],  }, /* wang ou => wan gou */
-    { &pinyin_table[606],  &pinyin_table[0],    &pinyin_table[605],  &pinyin_table[161],  }, /* weng a => wen ga */
-    { &pinyin_table[606],  &pinyin_table[2],    &pinyin_table[605],  &pinyin_table[163],  }, /* weng ai => wen gai */
-    { &pinyin_table[606],  &pinyin_table[4],    &pinyin_table[605],  &pinyin_table[165],  }, /* weng an => wen gan */
-    { &pinyin_table[606],  &pinyin_table[5],    &pinyin_table[605],  &pinyin_table[166],  }, /* weng ang => wen gang */
-    { &pinyin_table[606],  &pinyin_table[6],    &pinyin_table[605],  &pinyin_table[167],  }, /* weng ao => wen gao */
-    { &pinyin_table[606],  &pinyin_table[128],  &pinyin_table[605],  &pinyin_table[168],  }, /* weng e => wen ge */
-    { &pinyin_table[606],  &pinyin_table[129],  &pinyin_table[605],  &pinyin_table[170],  }, /* weng ei => wen gei */
-    { &pinyin_table[606],  &pinyin_table[130],  &pinyin_table[605],  &pinyin_table[172],  }, /* weng en => wen gen */
-    { &pinyin_table[606],  &pinyin_table[402],  &pinyin_table[605],  &pinyin_table[178],  }, /* weng ou => wen gou */
-    { &pinyin_table[614],  &pinyin_table[0],    &pinyin_table[611],  &pinyin_table[359],  }, /* xian a => xia na */
-    { &pinyin_table[614],  &pinyin_table[5],    &pinyin_table[611],  &pinyin_table[364],  }, /* xian ang => xia nang */
-    { &pinyin_table[614],  &pinyin_table[6],    &pinyin_table[611],  &pinyin_table[365],  }, /* xian ao => xia nao */
-    { &pinyin_table[614],  &pinyin_table[129],  &pinyin_table[611],  &pinyin_table[368],  }, /* xian ei => xia nei */
-    { &pinyin_table[615],  &pinyin_table[5],    &pinyin_table[614],  &pinyin_table[166],  }, /* xiang ang => xian gang */
-    { &pinyin_table[615],  &pinyin_table[6],    &pinyin_table[614],  &pinyin_table[167],  }, /* xiang ao => xian gao */
-    { &pinyin_table[615],  &pinyin_table[129],  &pinyin_table[614],  &pinyin_table[170],  }, /* xiang ei => xian gei */
-    { &pinyin_table[615],  &pinyin_table[130],  &pinyin_table[614],  &pinyin_table[172],  }, /* xiang en => xian gen */
-    { &pinyin_table[615],  &pinyin_table[402],  &pinyin_table[614],  &pinyin_table[178],  }, /* xiang ou => xian gou */
-    { &pinyin_table[617],  &pinyin_table[459],  &pinyin_table[610],  &pinyin_table[131],  }, /* xie r => xi er */
-    { &pinyin_table[620],  &pinyin_table[0],    &pinyin_table[610],  &pinyin_table[359],  }, /* xin a => xi na */
-    { &pinyin_table[620],  &pinyin_table[4],    &pinyin_table[610],  &pinyin_table[363],  }, /* xin an => xi nan */
-    { &pinyin_table[620],  &pinyin_table[128],  &pinyin_table[610],  &pinyin_table[366],  }, /* xin e => xi ne */
-    { &pinyin_table[620],  &pinyin_table[129],  &pinyin_table[610],  &pinyin_table[368],  }, /* xin ei => xi nei */
-    { &pinyin_table[620],  &pinyin_table[130],  &pinyin_table[610],  &pinyin_table[370],  }, /* xin en => xi nen */
-    { &pinyin_table[621],  &pinyin_table[4],    &pinyin_table[620],  &pinyin_table[165],  }, /* xing an => xin gan */
-    { &pinyin_table[621],  &pinyin_table[5],    &pinyin_table[620],  &pinyin_table[166],  }, /* xing ang => xin gang */
-    { &pinyin_table[621],  &pinyin_table[6],    &pinyin_table[620],  &pinyin_table[167],  }, /* xing ao => xin gao */
-    { &pinyin_table[621],  &pinyin_table[128],  &pinyin_table[620],  &pinyin_table[168],  }, /* xing e => xin ge */
-    { &pinyin_table[621],  &pinyin_table[129],  &pinyin_table[620],  &pinyin_table[170],  }, /* xing ei => xin gei */
-    { &pinyin_table[621],  &pinyin_table[130],  &pinyin_table[620],  &pinyin_table[172],  }, /* xing en => xin gen */
-    { &pinyin_table[621],  &pinyin_table[402],  &pinyin_table[620],  &pinyin_table[178],  }, /* xing ou => xin gou */
-    { &pinyin_table[630],  &pinyin_table[0],    &pinyin_table[629],  &pinyin_table[161],  }, /* xuang a => xuan ga */
-    { &pinyin_table[630],  &pinyin_table[2],    &pinyin_table[629],  &pinyin_table[163],  }, /* xuang ai => xuan gai */
-    { &pinyin_table[630],  &pinyin_table[4],    &pinyin_table[629],  &pinyin_table[165],  }, /* xuang an => xuan gan */
-    { &pinyin_table[630],  &pinyin_table[5],    &pinyin_table[629],  &pinyin_table[166],  }, /* xuang ang => xuan gang */
-    { &pinyin_table[630],  &pinyin_table[6],    &pinyin_table[629],  &pinyin_table[167],  }, /* xuang ao => xuan gao */
-    { &pinyin_table[630],  &pinyin_table[128],  &pinyin_table[629],  &pinyin_table[168],  }, /* xuang e => xuan ge */
-    { &pinyin_table[630],  &pinyin_table[129],  &pinyin_table[629],  &pinyin_table[170],  }, /* xuang ei => xuan gei */
-    { &pinyin_table[630],  &pinyin_table[130],  &pinyin_table[629],  &pinyin_table[172],  }, /* xuang en => xuan gen */
-    { &pinyin_table[630],  &pinyin_table[402],  &pinyin_table[629],  &pinyin_table[178],  }, /* xuang ou => xuan gou */
-    { &pinyin_table[631],  &pinyin_table[459],  &pinyin_table[628],  &pinyin_table[131],  }, /* xue r => xu er */
-    { &pinyin_table[632],  &pinyin_table[0],    &pinyin_table[631],  &pinyin_table[359],  }, /* xuen a => xue na */
-    { &pinyin_table[632],  &pinyin_table[2],    &pinyin_table[631],  &pinyin_table[361],  }, /* xuen ai => xue nai */
-    { &pinyin_table[632],  &pinyin_table[4],    &pinyin_table[631],  &pinyin_table[363],  }, /* xuen an => xue nan */
-    { &pinyin_table[632],  &pinyin_table[5],    &pinyin_table[631],  &pinyin_table[364],  }, /* xuen ang => xue nang */
-    { &pinyin_table[632],  &pinyin_table[6],    &pinyin_table[631],  &pinyin_table[365],  }, /* xuen ao => xue nao */
-    { &pinyin_table[632],  &pinyin_table[128],  &pinyin_table[631],  &pinyin_table[366],  }, /* xuen e => xue ne */
-    { &pinyin_table[632],  &pinyin_table[129],  &pinyin_table[631],  &pinyin_table[368],  }, /* xuen ei => xue nei */
-    { &pinyin_table[632],  &pinyin_table[130],  &pinyin_table[631],  &pinyin_table[370],  }, /* xuen en => xue nen */
-    { &pinyin_table[632],  &pinyin_table[402],  &pinyin_table[631],  &pinyin_table[391],  }, /* xuen ou => xue nou */
-    { &pinyin_table[633],  &pinyin_table[5],    &pinyin_table[628],  &pinyin_table[364],  }, /* xun ang => xu nang */
-    { &pinyin_table[633],  &pinyin_table[6],    &pinyin_table[628],  &pinyin_table[365],  }, /* xun ao => xu nao */
-    { &pinyin_table[633],  &pinyin_table[128],  &pinyin_table[628],  &pinyin_table[366],  }, /* xun e => xu ne */
-    { &pinyin_table[633],  &pinyin_table[129],  &pinyin_table[628],  &pinyin_table[368],  }, /* xun ei => xu nei */
-    { &pinyin_table[644],  &pinyin_table[0],    &pinyin_table[641],  &pinyin_table[359],  }, /* yan a => ya na */
-    { &pinyin_table[644],  &pinyin_table[128],  &pinyin_table[641],  &pinyin_table[366],  }, /* yan e => ya ne */
-    { &pinyin_table[644],  &pinyin_table[129],  &pinyin_table[641],  &pinyin_table[368],  }, /* yan ei => ya nei */
-    { &pinyin_table[645],  &pinyin_table[2],    &pinyin_table[644],  &pinyin_table[163],  }, /* yang ai => yan gai */
-    { &pinyin_table[645],  &pinyin_table[4],    &pinyin_table[644],  &pinyin_table[165],  }, /* yang an => yan gan */
-    { &pinyin_table[645],  &pinyin_table[5],    &pinyin_table[644],  &pinyin_table[166],  }, /* yang ang => yan gang */
-    { &pinyin_table[645],  &pinyin_table[6],    &pinyin_table[644],  &pinyin_table[167],  }, /* yang ao => yan gao */
-    { &pinyin_table[645],  &pinyin_table[128],  &pinyin_table[644],  &pinyin_table[168],  }, /* yang e => yan ge */
-    { &pinyin_table[645],  &pinyin_table[129],  &pinyin_table[644],  &pinyin_table[170],  }, /* yang ei => yan gei */
-    { &pinyin_table[645],  &pinyin_table[402],  &pinyin_table[644],  &pinyin_table[178],  }, /* yang ou => yan gou */
-    { &pinyin_table[651],  &pinyin_table[0],    &pinyin_table[648],  &pinyin_table[359],  }, /* yin a => yi na */
-    { &pinyin_table[651],  &pinyin_table[2],    &pinyin_table[648],  &pinyin_table[361],  }, /* yin ai => yi nai */
-    { &pinyin_table[651],  &pinyin_table[4],    &pinyin_table[648],  &pinyin_table[363],  }, /* yin an => yi nan */
-    { &pinyin_table[651],  &pinyin_table[5],    &pinyin_table[648],  &pinyin_table[364],  }, /* yin ang => yi nang */
-    { &pinyin_table[651],  &pinyin_table[6],    &pinyin_table[648],  &pinyin_table[365],  }, /* yin ao => yi nao */
-    { &pinyin_table[651],  &pinyin_table[129],  &pinyin_table[648],  &pinyin_table[368],  }, /* yin ei => yi nei */
-    { &pinyin_table[652],  &pinyin_table[2],    &pinyin_table[651],  &pinyin_table[163],  }, /* ying ai => yin gai */
-    { &pinyin_table[652],  &pinyin_table[5],    &pinyin_table[651],  &pinyin_table[166],  }, /* ying ang => yin gang */
-    { &pinyin_table[652],  &pinyin_table[6],    &pinyin_table[651],  &pinyin_table[167],  }, /* ying ao => yin gao */
-    { &pinyin_table[652],  &pinyin_table[129],  &pinyin_table[651],  &pinyin_table[170],  }, /* ying ei => yin gei */
-    { &pinyin_table[652],  &pinyin_table[130],  &pinyin_table[651],  &pinyin_table[172],  }, /* ying en => yin gen */
-    { &pinyin_table[652],  &pinyin_table[402],  &pinyin_table[651],  &pinyin_table[178],  }, /* ying ou => yin gou */
-    { &pinyin_table[656],  &pinyin_table[0],    &pinyin_table[653],  &pinyin_table[359],  }, /* yon a => yo na */
-    { &pinyin_table[656],  &pinyin_table[2],    &pinyin_table[653],  &pinyin_table[361],  }, /* yon ai => yo nai */
-    { &pinyin_table[656],  &pinyin_table[4],    &pinyin_table[653],  &pinyin_table[363],  }, /* yon an => yo nan */
-    { &pinyin_table[656],  &pinyin_table[5],    &pinyin_table[653],  &pinyin_table[364],  }, /* yon ang => yo nang */
-    { &pinyin_table[656],  &pinyin_table[6],    &pinyin_table[653],  &pinyin_table[365],  }, /* yon ao => yo nao */
-    { &pinyin_table[656],  &pinyin_table[128],  &pinyin_table[653],  &pinyin_table[366],  }, /* yon e => yo ne */
-    { &pinyin_table[656],  &pinyin_table[129],  &pinyin_table[653],  &pinyin_table[368],  }, /* yon ei => yo nei */
-    { &pinyin_table[656],  &pinyin_table[130],  &pinyin_table[653],  &pinyin_table[370],  }, /* yon en => yo nen */
-    { &pinyin_table[656],  &pinyin_table[402],  &pinyin_table[653],  &pinyin_table[391],  }, /* yon ou => yo nou */
-    { &pinyin_table[661],  &pinyin_table[0],    &pinyin_table[660],  &pinyin_table[161],  }, /* yuang a => yuan ga */
-    { &pinyin_table[661],  &pinyin_table[2],    &pinyin_table[660],  &pinyin_table[163],  }, /* yuang ai => yuan gai */
-    { &pinyin_table[661],  &pinyin_table[4],    &pinyin_table[660],  &pinyin_table[165],  }, /* yuang an => yuan gan */
-    { &pinyin_table[661],  &pinyin_table[5],    &pinyin_table[660],  &pinyin_table[166],  }, /* yuang ang => yuan gang */
-    { &pinyin_table[661],  &pinyin_table[6],    &pinyin_table[660],  &pinyin_table[167],  }, /* yuang ao => yuan gao */
-    { &pinyin_table[661],  &pinyin_table[128],  &pinyin_table[660],  &pinyin_table[168],  }, /* yuang e => yuan ge */
-    { &pinyin_table[661],  &pinyin_table[129],  &pinyin_table[660],  &pinyin_table[170],  }, /* yuang ei => yuan gei */
-    { &pinyin_table[661],  &pinyin_table[130],  &pinyin_table[660],  &pinyin_table[172],  }, /* yuang en => yuan gen */
-    { &pinyin_table[661],  &pinyin_table[402],  &pinyin_table[660],  &pinyin_table[178],  }, /* yuang ou => yuan gou */
-    { &pinyin_table[662],  &pinyin_table[459],  &pinyin_table[659],  &pinyin_table[131],  }, /* yue r => yu er */
-    { &pinyin_table[663],  &pinyin_table[0],    &pinyin_table[662],  &pinyin_table[359],  }, /* yuen a => yue na */
-    { &pinyin_table[663],  &pinyin_table[2],    &pinyin_table[662],  &pinyin_table[361],  }, /* yuen ai => yue nai */
-    { &pinyin_table[663],  &pinyin_table[4],    &pinyin_table[662],  &pinyin_table[363],  }, /* yuen an => yue nan */
-    { &pinyin_table[663],  &pinyin_table[5],    &pinyin_table[662],  &pinyin_table[364],  }, /* yuen ang => yue nang */
-    { &pinyin_table[663],  &pinyin_table[6],    &pinyin_table[662],  &pinyin_table[365],  }, /* yuen ao => yue nao */
-    { &pinyin_table[663],  &pinyin_table[128],  &pinyin_table[662],  &pinyin_table[366],  }, /* yuen e => yue ne */
-    { &pinyin_table[663],  &pinyin_table[129],  &pinyin_table[662],  &pinyin_table[368],  }, /* yuen ei => yue nei */
-    { &pinyin_table[663],  &pinyin_table[130],  &pinyin_table[662],  &pinyin_table[370],  }, /* yuen en => yue nen */
-    { &pinyin_table[663],  &pinyin_table[402],  &pinyin_table[662],  &pinyin_table[391],  }, /* yuen ou => yue nou */
-    { &pinyin_table[664],  &pinyin_table[0],    &pinyin_table[659],  &pinyin_table[359],  }, /* yun a => yu na */
-    { &pinyin_table[664],  &pinyin_table[2],    &pinyin_table[659],  &pinyin_table[361],  }, /* yun ai => yu nai */
-    { &pinyin_table[664],  &pinyin_table[4],    &pinyin_table[659],  &pinyin_table[363],  }, /* yun an => yu nan */
-    { &pinyin_table[664],  &pinyin_table[5],    &pinyin_table[659],  &pinyin_table[364],  }, /* yun ang => yu nang */
-    { &pinyin_table[664],  &pinyin_table[6],    &pinyin_table[659],  &pinyin_table[365],  }, /* yun ao => yu nao */
-    { &pinyin_table[664],  &pinyin_table[128],  &pinyin_table[659],  &pinyin_table[366],  }, /* yun e => yu ne */
-    { &pinyin_table[664],  &pinyin_table[129],  &pinyin_table[659],  &pinyin_table[368],  }, /* yun ei => yu nei */
-    { &pinyin_table[676],  &pinyin_table[0],    &pinyin_table[672],  &pinyin_table[359],  }, /* zan a => za na */
-    { &pinyin_table[676],  &pinyin_table[4],    &pinyin_table[672],  &pinyin_table[363],  }, /* zan an => za nan */
-    { &pinyin_table[676],  &pinyin_table[5],    &pinyin_table[672],  &pinyin_table[364],  }, /* zan ang => za nang */
-    { &pinyin_table[676],  &pinyin_table[6],    &pinyin_table[672],  &pinyin_table[365],  }, /* zan ao => za nao */
-    { &pinyin_table[676],  &pinyin_table[128],  &pinyin_table[672],  &pinyin_table[366],  }, /* zan e => za ne */
-    { &pinyin_table[676],  &pinyin_table[129],  &pinyin_table[672],  &pinyin_table[368],  }, /* zan ei => za nei */
-    { &pinyin_table[677],  &pinyin_table[4],    &pinyin_table[676],  &pinyin_table[165],  }, /* zang an => zan gan */
-    { &pinyin_table[677],  &pinyin_table[5],    &pinyin_table[676],  &pinyin_table[166],  }, /* zang ang => zan gang */
-    { &pinyin_table[677],  &pinyin_table[6],    &pinyin_table[676],  &pinyin_table[167],  }, /* zang ao => zan gao */
-    { &pinyin_table[677],  &pinyin_table[128],  &pinyin_table[676],  &pinyin_table[168],  }, /* zang e => zan ge */
-    { &pinyin_table[677],  &pinyin_table[129],  &pinyin_table[676],  &pinyin_table[170],  }, /* zang ei => zan gei */
-    { &pinyin_table[677],  &pinyin_table[130],  &pinyin_table[676],  &pinyin_table[172],  }, /* zang en => zan gen */
-    { &pinyin_table[677],  &pinyin_table[402],  &pinyin_table[676],  &pinyin_table[178],  }, /* zang ou => zan gou */
-    { &pinyin_table[683],  &pinyin_table[0],    &pinyin_table[679],  &pinyin_table[359],  }, /* zen a => ze na */
-    { &pinyin_table[683],  &pinyin_table[4],    &pinyin_table[679],  &pinyin_table[363],  }, /* zen an => ze nan */
-    { &pinyin_table[683],  &pinyin_table[6],    &pinyin_table[679],  &pinyin_table[365],  }, /* zen ao => ze nao */
-    { &pinyin_table[683],  &pinyin_table[128],  &pinyin_table[679],  &pinyin_table[366],  }, /* zen e => ze ne */
-    { &pinyin_table[683],  &pinyin_table[129],  &pinyin_table[679],  &pinyin_table[368],  }, /* zen ei => ze nei */
-    { &pinyin_table[684],  &pinyin_table[2],    &pinyin_table[683],  &pinyin_table[163],  }, /* zeng ai => zen gai */
-    { &pinyin_table[684],  &pinyin_table[4],    &pinyin_table[683],  &pinyin_table[165],  }, /* zeng an => zen gan */
-    { &pinyin_table[684],  &pinyin_table[5],    &pinyin_table[683],  &pinyin_table[166],  }, /* zeng ang => zen gang */
-    { &pinyin_table[684],  &pinyin_table[6],    &pinyin_table[683],  &pinyin_table[167],  }, /* zeng ao => zen gao */
-    { &pinyin_table[684],  &pinyin_table[129],  &pinyin_table[683],  &pinyin_table[170],  }, /* zeng ei => zen gei */
-    { &pinyin_table[684],  &pinyin_table[130],  &pinyin_table[683],  &pinyin_table[172],  }, /* zeng en => zen gen */
-    { &pinyin_table[684],  &pinyin_table[402],  &pinyin_table[683],  &pinyin_table[178],  }, /* zeng ou => zen gou */
-    { &pinyin_table[690],  &pinyin_table[129],  &pinyin_table[686],  &pinyin_table[368],  }, /* zhan ei => zha nei */
-    { &pinyin_table[691],  &pinyin_table[4],    &pinyin_table[690],  &pinyin_table[165],  }, /* zhang an => zhan gan */
-    { &pinyin_table[691],  &pinyin_table[5],    &pinyin_table[690],  &pinyin_table[166],  }, /* zhang ang => zhan gang */
-    { &pinyin_table[691],  &pinyin_table[6],    &pinyin_table[690],  &pinyin_table[167],  }, /* zhang ao => zhan gao */
-    { &pinyin_table[691],  &pinyin_table[128],  &pinyin_table[690],  &pinyin_table[168],  }, /* zhang e => zhan ge */
-    { &pinyin_table[691],  &pinyin_table[129],  &pinyin_table[690],  &pinyin_table[170],  }, /* zhang ei => zhan gei */
-    { &pinyin_table[691],  &pinyin_table[130],  &pinyin_table[690],  &pinyin_table[172],  }, /* zhang en => zhan gen */
-    { &pinyin_table[691],  &pinyin_table[402],  &pinyin_table[690],  &pinyin_table[178],  }, /* zhang ou => zhan gou */
-    { &pinyin_table[697],  &pinyin_table[0],    &pinyin_table[693],  &pinyin_table[359],  }, /* zhen a => zhe na */
-    { &pinyin_table[697],  &pinyin_table[4],    &pinyin_table[693],  &pinyin_table[363],  }, /* zhen an => zhe nan */
-    { &pinyin_table[697],  &pinyin_table[5],    &pinyin_table[693],  &pinyin_table[364],  }, /* zhen ang => zhe nang */
-    { &pinyin_table[697],  &pinyin_table[6],    &pinyin_table[693],  &pinyin_table[365],  }, /* zhen ao => zhe nao */
-    { &pinyin_table[697],  &pinyin_table[128],  &pinyin_table[693],  &pinyin_table[366],  }, /* zhen e => zhe ne */
-    { &pinyin_table[697],  &pinyin_table[129],  &pinyin_table[693],  &pinyin_table[368],  }, /* zhen ei => zhe nei */
-    { &pinyin_table[698],  &pinyin_table[2],    &pinyin_table[697],  &pinyin_table[163],  }, /* zheng ai => zhen gai */
-    { &pinyin_table[698],  &pinyin_table[4],    &pinyin_table[697],  &pinyin_table[165],  }, /* zheng an => zhen gan */
-    { &pinyin_table[698],  &pinyin_table[5],    &pinyin_table[697],  &pinyin_table[166],  }, /* zheng ang => zhen gang */
-    { &pinyin_table[698],  &pinyin_table[6],    &pinyin_table[697],  &pinyin_table[167],  }, /* zheng ao => zhen gao */
-    { &pinyin_table[698],  &pinyin_table[128],  &pinyin_table[697],  &pinyin_table[168],  }, /* zheng e => zhen ge */
-    { &pinyin_table[698],  &pinyin_table[129],  &pinyin_table[697],  &pinyin_table[170],  }, /* zheng ei => zhen gei */
-    { &pinyin_table[698],  &pinyin_table[130],  &pinyin_table[697],  &pinyin_table[172],  }, /* zheng en => zhen gen */
-    { &pinyin_table[698],  &pinyin_table[402],  &pinyin_table[697],  &pinyin_table[178],  }, /* zheng ou => zhen gou */
-    { &pinyin_table[710],  &pinyin_table[6],    &pinyin_table[706],  &pinyin_table[365],  }, /* zhuan ao => zhua nao */
-    { &pinyin_table[710],  &pinyin_table[128],  &pinyin_table[706],  &pinyin_table[366],  }, /* zhuan e => zhua ne */
-    { &pinyin_table[710],  &pinyin_table[129],  &pinyin_table[706],  &pinyin_table[368],  }, /* zhuan ei => zhua nei */
-    { &pinyin_table[711],  &pinyin_table[2],    &pinyin_table[710],  &pinyin_table[163],  }, /* zhuang ai => zhuan gai */
-    { &pinyin_table[711],  &pinyin_table[4],    &pinyin_table[710],  &pinyin_table[165],  }, /* zhuang an => zhuan gan */
-    { &pinyin_table[711],  &pinyin_table[5],    &pinyin_table[710],  &pinyin_table[166],  }, /* zhuang ang => zhuan gang */
-    { &pinyin_table[711],  &pinyin_table[6],    &pinyin_table[710],  &pinyin_table[167],  }, /* zhuang ao => zhuan gao */
-    { &pinyin_table[711],  &pinyin_table[128],  &pinyin_table[710],  &pinyin_table[168],  }, /* zhuang e => zhuan ge */
-    { &pinyin_table[711],  &pinyin_table[129],  &pinyin_table[710],  &pinyin_table[170],  }, /* zhuang ei => zhuan gei */
-    { &pinyin_table[711],  &pinyin_table[130],  &pinyin_table[710],  &pinyin_table[172],  }, /* zhuang en => zhuan gen */
-    { &pinyin_table[711],  &pinyin_table[402],  &pinyin_table[710],  &pinyin_table[178],  }, /* zhuang ou => zhuan gou */
-    { &pinyin_table[715],  &pinyin_table[0],    &pinyin_table[705],  &pinyin_table[359],  }, /* zhun a => zhu na */
-    { &pinyin_table[715],  &pinyin_table[4],    &pinyin_table[705],  &pinyin_table[363],  }, /* zhun an => zhu nan */
-    { &pinyin_table[715],  &pinyin_table[5],    &pinyin_table[705],  &pinyin_table[364],  }, /* zhun ang => zhu nang */
-    { &pinyin_table[715],  &pinyin_table[6],    &pinyin_table[705],  &pinyin_table[365],  }, /* zhun ao => zhu nao */
-    { &pinyin_table[715],  &pinyin_table[128],  &pinyin_table[705],  &pinyin_table[366],  }, /* zhun e => zhu ne */
-    { &pinyin_table[715],  &pinyin_table[129],  &pinyin_table[705],  &pinyin_table[368],  }, /* zhun ei => zhu nei */
-    { &pinyin_table[727],  &pinyin_table[0],    &pinyin_table[726],  &pinyin_table[161],  }, /* zuang a => zuan ga */
-    { &pinyin_table[727],  &pinyin_table[2],    &pinyin_table[726],  &pinyin_table[163],  }, /* zuang ai => zuan gai */
-    { &pinyin_table[727],  &pinyin_table[4],    &pinyin_table[726],  &pinyin_table[165],  }, /* zuang an => zuan gan */
-    { &pinyin_table[727],  &pinyin_table[5],    &pinyin_table[726],  &pinyin_table[166],  }, /* zuang ang => zuan gang */
-    { &pinyin_table[727],  &pinyin_table[6],    &pinyin_table[726],  &pinyin_table[167],  }, /* zuang ao => zuan gao */
-    { &pinyin_table[727],  &pinyin_table[128],  &pinyin_table[726],  &pinyin_table[168],  }, /* zuang e => zuan ge */
-    { &pinyin_table[727],  &pinyin_table[129],  &pinyin_table[726],  &pinyin_table[170],  }, /* zuang ei => zuan gei */
-    { &pinyin_table[727],  &pinyin_table[130],  &pinyin_table[726],  &pinyin_table[172],  }, /* zuang en => zuan gen */
-    { &pinyin_table[727],  &pinyin_table[402],  &pinyin_table[726],  &pinyin_table[178],  }, /* zuang ou => zuan gou */
-    { &pinyin_table[731],  &pinyin_table[0],    &pinyin_table[723],  &pinyin_table[359],  }, /* zun a => zu na */
-    { &pinyin_table[731],  &pinyin_table[4],    &pinyin_table[723],  &pinyin_table[363],  }, /* zun an => zu nan */
-    { &pinyin_table[731],  &pinyin_table[5],    &pinyin_table[723],  &pinyin_table[364],  }, /* zun ang => zu nang */
-    { &pinyin_table[731],  &pinyin_table[6],    &pinyin_table[723],  &pinyin_table[365],  }, /* zun ao => zu nao */
-    { &pinyin_table[731],  &pinyin_table[128],  &pinyin_table[723],  &pinyin_table[366],  }, /* zun e => zu ne */
-    { &pinyin_table[731],  &pinyin_table[129],  &pinyin_table[723],  &pinyin_table[368],  }, /* zun ei => zu nei */
+static const BopomofoTrieNode bopomofo_trie[] = {
+    { G_GUINT64_CONSTANT (0x1efeffffff),    1,   -1 },  /* 0 "" */
+    { G_GUINT64_CONSTANT (0x0dee600000),   36,    7 },  /* 1 "ㄅ" */
+    { G_GUINT64_CONSTANT (0x0dfe600000),   47,  403 },  /* 2 "ㄆ" */
+    { G_GUINT64_CONSTANT (0x0dfee00000),   59,  330 },  /* 3 "ㄇ" */
+    { G_GUINT64_CONSTANT (0x09fee00000),   72,  132 },  /* 4 "ㄈ" */
+    { G_GUINT64_CONSTANT (0x0dfea00000),   84,   89 },  /* 5 "ㄉ" */
+    { G_GUINT64_CONSTANT (0x0dfaa00000),   96,  560 },  /* 6 "ㄊ" */
+    { G_GUINT64_CONSTANT (0x1dfee00000),  107,  358 },  /* 7 "ㄋ" */
+    { G_GUINT64_CONSTANT (0x1dfee00000),  121,  285 },  /* 8 "ㄌ" */
+    { G_GUINT64_CONSTANT (0x09fea00000),  135,  160 },  /* 9 "ㄍ" */
+    { G_GUINT64_CONSTANT (0x09fea00000),  146,  254 },  /* 10 "ㄎ" */
+    { G_GUINT64_CONSTANT (0x09fee00000),  157,  191 },  /* 11 "ㄏ" */
+    { G_GUINT64_CONSTANT (0x1400000000),  169,  223 },  /* 12 "ㄐ" */
+    { G_GUINT64_CONSTANT (0x1400000000),  171,  428 },  /* 13 "ㄑ" */
+    { G_GUINT64_CONSTANT (0x1400000000),  173,  609 },  /* 14 "ㄒ" */
+    { G_GUINT64_CONSTANT (0x09fea00000),  175,  699 },  /* 15 "ㄓ" */
+    { G_GUINT64_CONSTANT (0x09faa00000),  186,   57 },  /* 16 "ㄔ" */
+    { G_GUINT64_CONSTANT (0x09fea00000),  196,  528 },  /* 17 "ㄕ" */
+    { G_GUINT64_CONSTANT (0x1dfee00000),  207,  473 },  /* 18 "ㄖ" */
+    { G_GUINT64_CONSTANT (0x09fea00000),  221,  717 },  /* 19 "ㄗ" */
+    { G_GUINT64_CONSTANT (0x09faa00000),  232,   74 },  /* 20 "ㄘ" */
+    { G_GUINT64_CONSTANT (0x09fea00000),  242,  544 },  /* 21 "ㄙ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,    0 },  /* 22 "ㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  401 },  /* 23 "ㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  128 },  /* 24 "ㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,    2 },  /* 25 "ㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  129 },  /* 26 "ㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,    6 },  /* 27 "ㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  402 },  /* 28 "ㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,    4 },  /* 29 "ㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  130 },  /* 30 "ㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,    5 },  /* 31 "ㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  131 },  /* 32 "ㄦ" */
+    { G_GUINT64_CONSTANT (0x11f9600000),  253,  648 },  /* 33 "ㄧ" */
+    { G_GUINT64_CONSTANT (0x01e6600000),  263,  608 },  /* 34 "ㄨ" */
+    { G_GUINT64_CONSTANT (0x0161000000),  271,  659 },  /* 35 "ㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,    8 },  /* 36 "ㄅㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   29 },  /* 37 "ㄅㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   10 },  /* 38 "ㄅㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   16 },  /* 39 "ㄅㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   14 },  /* 40 "ㄅㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   12 },  /* 41 "ㄅㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   18 },  /* 42 "ㄅㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   13 },  /* 43 "ㄅㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   19 },  /* 44 "ㄅㄥ" */
+    { G_GUINT64_CONSTANT (0x01e9000000),  275,   20 },  /* 45 "ㄅㄧ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   30 },  /* 46 "ㄅㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  404 },  /* 47 "ㄆㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  425 },  /* 48 "ㄆㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  406 },  /* 49 "ㄆㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  412 },  /* 50 "ㄆㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  410 },  /* 51 "ㄆㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  426 },  /* 52 "ㄆㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  408 },  /* 53 "ㄆㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  414 },  /* 54 "ㄆㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  409 },  /* 55 "ㄆㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  415 },  /* 56 "ㄆㄥ" */
+    { G_GUINT64_CONSTANT (0x01e9000000),  281,  416 },  /* 57 "ㄆㄧ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  427 },  /* 58 "ㄆㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  331 },  /* 59 "ㄇㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  355 },  /* 60 "ㄇㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  338 },  /* 61 "ㄇㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  333 },  /* 62 "ㄇㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  340 },  /* 63 "ㄇㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  337 },  /* 64 "ㄇㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  356 },  /* 65 "ㄇㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  335 },  /* 66 "ㄇㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  342 },  /* 67 "ㄇㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  336 },  /* 68 "ㄇㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  343 },  /* 69 "ㄇㄥ" */
+    { G_GUINT64_CONSTANT (0x01f9000000),  287,  344 },  /* 70 "ㄇㄧ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  357 },  /* 71 "ㄇㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  133 },  /* 72 "ㄈㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  146 },  /* 73 "ㄈㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  140 },  /* 74 "ㄈㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  135 },  /* 75 "ㄈㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  142 },  /* 76 "ㄈㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  139 },  /* 77 "ㄈㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  149 },  /* 78 "ㄈㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  137 },  /* 79 "ㄈㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  144 },  /* 80 "ㄈㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  138 },  /* 81 "ㄈㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  145 },  /* 82 "ㄈㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000),  294,  150 },  /* 83 "ㄈㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   90 },  /* 84 "ㄉㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   97 },  /* 85 "ㄉㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   92 },  /* 86 "ㄉㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   99 },  /* 87 "ㄉㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   96 },  /* 88 "ㄉㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  119 },  /* 89 "ㄉㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   94 },  /* 90 "ㄉㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  101 },  /* 91 "ㄉㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   95 },  /* 92 "ㄉㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  102 },  /* 93 "ㄉㄥ" */
+    { G_GUINT64_CONSTANT (0x01f9200000),  302,  103 },  /* 94 "ㄉㄧ" */
+    { G_GUINT64_CONSTANT (0x01e4400000),  310,  120 },  /* 95 "ㄉㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  561 },  /* 96 "ㄊㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  568 },  /* 97 "ㄊㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  563 },  /* 98 "ㄊㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  567 },  /* 99 "ㄊㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  586 },  /* 100 "ㄊㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  565 },  /* 101 "ㄊㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  571 },  /* 102 "ㄊㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  566 },  /* 103 "ㄊㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  572 },  /* 104 "ㄊㄥ" */
+    { G_GUINT64_CONSTANT (0x01e9000000),  316,  573 },  /* 105 "ㄊㄧ" */
+    { G_GUINT64_CONSTANT (0x01e4400000),  322,  587 },  /* 106 "ㄊㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  359 },  /* 107 "ㄋㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  386 },  /* 108 "ㄋㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  366 },  /* 109 "ㄋㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  361 },  /* 110 "ㄋㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  368 },  /* 111 "ㄋㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  365 },  /* 112 "ㄋㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  391 },  /* 113 "ㄋㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  363 },  /* 114 "ㄋㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  370 },  /* 115 "ㄋㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  364 },  /* 116 "ㄋㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  371 },  /* 117 "ㄋㄥ" */
+    { G_GUINT64_CONSTANT (0x01f9200000),  328,  372 },  /* 118 "ㄋㄧ" */
+    { G_GUINT64_CONSTANT (0x01e0400000),  336,  392 },  /* 119 "ㄋㄨ" */
+    { G_GUINT64_CONSTANT (0x0001000000),  341,  399 },  /* 120 "ㄋㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  286 },  /* 121 "ㄌㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  313 },  /* 122 "ㄌㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  293 },  /* 123 "ㄌㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  288 },  /* 124 "ㄌㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  295 },  /* 125 "ㄌㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  292 },  /* 126 "ㄌㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  318 },  /* 127 "ㄌㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  290 },  /* 128 "ㄌㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  297 },  /* 129 "ㄌㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  291 },  /* 130 "ㄌㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  298 },  /* 131 "ㄌㄥ" */
+    { G_GUINT64_CONSTANT (0x01f9200000),  342,  299 },  /* 132 "ㄌㄧ" */
+    { G_GUINT64_CONSTANT (0x01e4400000),  350,  319 },  /* 133 "ㄌㄨ" */
+    { G_GUINT64_CONSTANT (0x0001000000),  356,  328 },  /* 134 "ㄌㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  161 },  /* 135 "ㄍㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  168 },  /* 136 "ㄍㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  163 },  /* 137 "ㄍㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  170 },  /* 138 "ㄍㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  167 },  /* 139 "ㄍㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  178 },  /* 140 "ㄍㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  165 },  /* 141 "ㄍㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  172 },  /* 142 "ㄍㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  166 },  /* 143 "ㄍㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  173 },  /* 144 "ㄍㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000),  357,  179 },  /* 145 "ㄍㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  255 },  /* 146 "ㄎㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  262 },  /* 147 "ㄎㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  257 },  /* 148 "ㄎㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  264 },  /* 149 "ㄎㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  261 },  /* 150 "ㄎㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  272 },  /* 151 "ㄎㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  259 },  /* 152 "ㄎㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  266 },  /* 153 "ㄎㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  260 },  /* 154 "ㄎㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  267 },  /* 155 "ㄎㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000),  365,  273 },  /* 156 "ㄎㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  192 },  /* 157 "ㄏㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  205 },  /* 158 "ㄏㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  199 },  /* 159 "ㄏㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  194 },  /* 160 "ㄏㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  201 },  /* 161 "ㄏㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  198 },  /* 162 "ㄏㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  210 },  /* 163 "ㄏㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  196 },  /* 164 "ㄏㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  203 },  /* 165 "ㄏㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  197 },  /* 166 "ㄏㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  204 },  /* 167 "ㄏㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000),  373,  211 },  /* 168 "ㄏㄨ" */
+    { G_GUINT64_CONSTANT (0x01f9200000),  381,  224 },  /* 169 "ㄐㄧ" */
+    { G_GUINT64_CONSTANT (0x01e1000000),  389,  242 },  /* 170 "ㄐㄩ" */
+    { G_GUINT64_CONSTANT (0x01f9200000),  394,  429 },  /* 171 "ㄑㄧ" */
+    { G_GUINT64_CONSTANT (0x01e1000000),  402,  447 },  /* 172 "ㄑㄩ" */
+    { G_GUINT64_CONSTANT (0x01f9200000),  407,  610 },  /* 173 "ㄒㄧ" */
+    { G_GUINT64_CONSTANT (0x01e1000000),  415,  628 },  /* 174 "ㄒㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  686 },  /* 175 "ㄓㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  693 },  /* 176 "ㄓㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  688 },  /* 177 "ㄓㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  695 },  /* 178 "ㄓㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  692 },  /* 179 "ㄓㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  704 },  /* 180 "ㄓㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  690 },  /* 181 "ㄓㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  697 },  /* 182 "ㄓㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  691 },  /* 183 "ㄓㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  698 },  /* 184 "ㄓㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000),  420,  705 },  /* 185 "ㄓㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   45 },  /* 186 "ㄔㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   52 },  /* 187 "ㄔㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   47 },  /* 188 "ㄔㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   51 },  /* 189 "ㄔㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   62 },  /* 190 "ㄔㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   49 },  /* 191 "ㄔㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   55 },  /* 192 "ㄔㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   50 },  /* 193 "ㄔㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   56 },  /* 194 "ㄔㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6400000),  428,   63 },  /* 195 "ㄔㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  515 },  /* 196 "ㄕㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  522 },  /* 197 "ㄕㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  517 },  /* 198 "ㄕㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  524 },  /* 199 "ㄕㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  521 },  /* 200 "ㄕㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  531 },  /* 201 "ㄕㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  519 },  /* 202 "ㄕㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  526 },  /* 203 "ㄕㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  520 },  /* 204 "ㄕㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  527 },  /* 205 "ㄕㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000),  435,  532 },  /* 206 "ㄕㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  460 },  /* 207 "ㄖㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  483 },  /* 208 "ㄖㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  467 },  /* 209 "ㄖㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  462 },  /* 210 "ㄖㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  469 },  /* 211 "ㄖㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  466 },  /* 212 "ㄖㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  488 },  /* 213 "ㄖㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  464 },  /* 214 "ㄖㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  471 },  /* 215 "ㄖㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  465 },  /* 216 "ㄖㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  472 },  /* 217 "ㄖㄥ" */
+    { G_GUINT64_CONSTANT (0x01f9200000),  443,   -1 },  /* 218 "ㄖㄧ" */
+    { G_GUINT64_CONSTANT (0x01e4400000),  451,  489 },  /* 219 "ㄖㄨ" */
+    { G_GUINT64_CONSTANT (0x0001000000),  457,  498 },  /* 220 "ㄖㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  672 },  /* 221 "ㄗㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  679 },  /* 222 "ㄗㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  674 },  /* 223 "ㄗㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  681 },  /* 224 "ㄗㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  678 },  /* 225 "ㄗㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  722 },  /* 226 "ㄗㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  676 },  /* 227 "ㄗㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  683 },  /* 228 "ㄗㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  677 },  /* 229 "ㄗㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  684 },  /* 230 "ㄗㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000),  458,  723 },  /* 231 "ㄗㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   32 },  /* 232 "ㄘㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   39 },  /* 233 "ㄘㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   34 },  /* 234 "ㄘㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   38 },  /* 235 "ㄘㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   79 },  /* 236 "ㄘㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   36 },  /* 237 "ㄘㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   42 },  /* 238 "ㄘㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   37 },  /* 239 "ㄘㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   43 },  /* 240 "ㄘㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6400000),  466,   80 },  /* 241 "ㄘㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  501 },  /* 242 "ㄙㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  508 },  /* 243 "ㄙㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  503 },  /* 244 "ㄙㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  510 },  /* 245 "ㄙㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  507 },  /* 246 "ㄙㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  549 },  /* 247 "ㄙㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  505 },  /* 248 "ㄙㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  512 },  /* 249 "ㄙㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  506 },  /* 250 "ㄙㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  513 },  /* 251 "ㄙㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000),  473,  550 },  /* 252 "ㄙㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  641 },  /* 253 "ㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  653 },  /* 254 "ㄧㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  647 },  /* 255 "ㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  646 },  /* 256 "ㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  658 },  /* 257 "ㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  644 },  /* 258 "ㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  651 },  /* 259 "ㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  645 },  /* 260 "ㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  652 },  /* 261 "ㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0080000000),  481,   -1 },  /* 262 "ㄧㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  596 },  /* 263 "ㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  607 },  /* 264 "ㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  598 },  /* 265 "ㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  603 },  /* 266 "ㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  600 },  /* 267 "ㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  605 },  /* 268 "ㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  601 },  /* 269 "ㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  606 },  /* 270 "ㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  662 },  /* 271 "ㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  660 },  /* 272 "ㄩㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  664 },  /* 273 "ㄩㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  657 },  /* 274 "ㄩㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   24 },  /* 275 "ㄅㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   23 },  /* 276 "ㄅㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   21 },  /* 277 "ㄅㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   27 },  /* 278 "ㄅㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   22 },  /* 279 "ㄅㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   28 },  /* 280 "ㄅㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  420 },  /* 281 "ㄆㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  419 },  /* 282 "ㄆㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  417 },  /* 283 "ㄆㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  423 },  /* 284 "ㄆㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  418 },  /* 285 "ㄆㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  424 },  /* 286 "ㄆㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  348 },  /* 287 "ㄇㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  347 },  /* 288 "ㄇㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  354 },  /* 289 "ㄇㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  345 },  /* 290 "ㄇㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  351 },  /* 291 "ㄇㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  346 },  /* 292 "ㄇㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  352 },  /* 293 "ㄇㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  151 },  /* 294 "ㄈㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  159 },  /* 295 "ㄈㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  152 },  /* 296 "ㄈㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  157 },  /* 297 "ㄈㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  153 },  /* 298 "ㄈㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  158 },  /* 299 "ㄈㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  154 },  /* 300 "ㄈㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  148 },  /* 301 "ㄈㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  104 },  /* 302 "ㄉㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  108 },  /* 303 "ㄉㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  107 },  /* 304 "ㄉㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  114 },  /* 305 "ㄉㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  105 },  /* 306 "ㄉㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  111 },  /* 307 "ㄉㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  106 },  /* 308 "ㄉㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  112 },  /* 309 "ㄉㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  127 },  /* 310 "ㄉㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  125 },  /* 311 "ㄉㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  121 },  /* 312 "ㄉㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  126 },  /* 313 "ㄉㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  122 },  /* 314 "ㄉㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  118 },  /* 315 "ㄉㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  577 },  /* 316 "ㄊㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  576 },  /* 317 "ㄊㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  574 },  /* 318 "ㄊㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  580 },  /* 319 "ㄊㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  575 },  /* 320 "ㄊㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  581 },  /* 321 "ㄊㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  594 },  /* 322 "ㄊㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  592 },  /* 323 "ㄊㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  588 },  /* 324 "ㄊㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  593 },  /* 325 "ㄊㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  589 },  /* 326 "ㄊㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  585 },  /* 327 "ㄊㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  373 },  /* 328 "ㄋㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  379 },  /* 329 "ㄋㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  378 },  /* 330 "ㄋㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  385 },  /* 331 "ㄋㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  376 },  /* 332 "ㄋㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  382 },  /* 333 "ㄋㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  377 },  /* 334 "ㄋㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  383 },  /* 335 "ㄋㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  398 },  /* 336 "ㄋㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  393 },  /* 337 "ㄋㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  397 },  /* 338 "ㄋㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  394 },  /* 339 "ㄋㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  390 },  /* 340 "ㄋㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  400 },  /* 341 "ㄋㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  300 },  /* 342 "ㄌㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  306 },  /* 343 "ㄌㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  305 },  /* 344 "ㄌㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  312 },  /* 345 "ㄌㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  303 },  /* 346 "ㄌㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  309 },  /* 347 "ㄌㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  304 },  /* 348 "ㄌㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  310 },  /* 349 "ㄌㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  327 },  /* 350 "ㄌㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  325 },  /* 351 "ㄌㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  320 },  /* 352 "ㄌㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  326 },  /* 353 "ㄌㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  321 },  /* 354 "ㄌㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  317 },  /* 355 "ㄌㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  329 },  /* 356 "ㄌㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  180 },  /* 357 "ㄍㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  190 },  /* 358 "ㄍㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  182 },  /* 359 "ㄍㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  188 },  /* 360 "ㄍㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  184 },  /* 361 "ㄍㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  189 },  /* 362 "ㄍㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  185 },  /* 363 "ㄍㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  177 },  /* 364 "ㄍㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  274 },  /* 365 "ㄎㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  284 },  /* 366 "ㄎㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  276 },  /* 367 "ㄎㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  282 },  /* 368 "ㄎㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  278 },  /* 369 "ㄎㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  283 },  /* 370 "ㄎㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  279 },  /* 371 "ㄎㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  271 },  /* 372 "ㄎㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  212 },  /* 373 "ㄏㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  222 },  /* 374 "ㄏㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  214 },  /* 375 "ㄏㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  220 },  /* 376 "ㄏㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  216 },  /* 377 "ㄏㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  221 },  /* 378 "ㄏㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  217 },  /* 379 "ㄏㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  209 },  /* 380 "ㄏㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  225 },  /* 381 "ㄐㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  231 },  /* 382 "ㄐㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  230 },  /* 383 "ㄐㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  241 },  /* 384 "ㄐㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  228 },  /* 385 "ㄐㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  234 },  /* 386 "ㄐㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  229 },  /* 387 "ㄐㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  235 },  /* 388 "ㄐㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  245 },  /* 389 "ㄐㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  243 },  /* 390 "ㄐㄩㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  247 },  /* 391 "ㄐㄩㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  244 },  /* 392 "ㄐㄩㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  239 },  /* 393 "ㄐㄩㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  430 },  /* 394 "ㄑㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  436 },  /* 395 "ㄑㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  435 },  /* 396 "ㄑㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  446 },  /* 397 "ㄑㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  433 },  /* 398 "ㄑㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  439 },  /* 399 "ㄑㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  434 },  /* 400 "ㄑㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  440 },  /* 401 "ㄑㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  450 },  /* 402 "ㄑㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  448 },  /* 403 "ㄑㄩㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  452 },  /* 404 "ㄑㄩㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  449 },  /* 405 "ㄑㄩㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  444 },  /* 406 "ㄑㄩㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  611 },  /* 407 "ㄒㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  617 },  /* 408 "ㄒㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  616 },  /* 409 "ㄒㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  627 },  /* 410 "ㄒㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  614 },  /* 411 "ㄒㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  620 },  /* 412 "ㄒㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  615 },  /* 413 "ㄒㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  621 },  /* 414 "ㄒㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  631 },  /* 415 "ㄒㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  629 },  /* 416 "ㄒㄩㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  633 },  /* 417 "ㄒㄩㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  630 },  /* 418 "ㄒㄩㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  625 },  /* 419 "ㄒㄩㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  706 },  /* 420 "ㄓㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  716 },  /* 421 "ㄓㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  708 },  /* 422 "ㄓㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  714 },  /* 423 "ㄓㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  710 },  /* 424 "ㄓㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  715 },  /* 425 "ㄓㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  711 },  /* 426 "ㄓㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  703 },  /* 427 "ㄓㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   73 },  /* 428 "ㄔㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   65 },  /* 429 "ㄔㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   71 },  /* 430 "ㄔㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   67 },  /* 431 "ㄔㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   72 },  /* 432 "ㄔㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   68 },  /* 433 "ㄔㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   61 },  /* 434 "ㄔㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  533 },  /* 435 "ㄕㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  543 },  /* 436 "ㄕㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  535 },  /* 437 "ㄕㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  541 },  /* 438 "ㄕㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  537 },  /* 439 "ㄕㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  542 },  /* 440 "ㄕㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  538 },  /* 441 "ㄕㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  530 },  /* 442 "ㄕㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  474 },  /* 443 "ㄖㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  478 },  /* 444 "ㄖㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  477 },  /* 445 "ㄖㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  482 },  /* 446 "ㄖㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  475 },  /* 447 "ㄖㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  479 },  /* 448 "ㄖㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  476 },  /* 449 "ㄖㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  480 },  /* 450 "ㄖㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  497 },  /* 451 "ㄖㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  495 },  /* 452 "ㄖㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  490 },  /* 453 "ㄖㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  496 },  /* 454 "ㄖㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  491 },  /* 455 "ㄖㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  487 },  /* 456 "ㄖㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  499 },  /* 457 "ㄖㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  724 },  /* 458 "ㄗㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  732 },  /* 459 "ㄗㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  725 },  /* 460 "ㄗㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  730 },  /* 461 "ㄗㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  726 },  /* 462 "ㄗㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  731 },  /* 463 "ㄗㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  727 },  /* 464 "ㄗㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  721 },  /* 465 "ㄗㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   88 },  /* 466 "ㄘㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   81 },  /* 467 "ㄘㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   86 },  /* 468 "ㄘㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   82 },  /* 469 "ㄘㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   87 },  /* 470 "ㄘㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   83 },  /* 471 "ㄘㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,   78 },  /* 472 "ㄘㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  551 },  /* 473 "ㄙㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  559 },  /* 474 "ㄙㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  552 },  /* 475 "ㄙㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  557 },  /* 476 "ㄙㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  553 },  /* 477 "ㄙㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  558 },  /* 478 "ㄙㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  554 },  /* 479 "ㄙㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  548 },  /* 480 "ㄙㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000),    0,  661 },  /* 481 "ㄧㄩㄤ" */
+};
+
+static const guint16 special_table[][4] = {
+    { 4,    0,    0,    359,  }, /* an a => a na */
+    { 4,    2,    0,    361,  }, /* an ai => a nai */
+    { 4,    6,    0,    365,  }, /* an ao => a nao */
+    { 4,    128,  0,    366,  }, /* an e => a ne */
+    { 4,    129,  0,    368,  }, /* an ei => a nei */
+    { 5,    0,    4,    161,  }, /* ang a => an ga */
+    { 5,    2,    4,    163,  }, /* ang ai => an gai */
+    { 5,    4,    4,    165,  }, /* ang an => an gan */
+    { 5,    5,    4,    166,  }, /* ang ang => an gang */
+    { 5,    6,    4,    167,  }, /* ang ao => an gao */
+    { 5,    128,  4,    168,  }, /* ang e => an ge */
+    { 5,    129,  4,    170,  }, /* ang ei => an gei */
+    { 5,    130,  4,    172,  }, /* ang en => an gen */
+    { 5,    402,  4,    178,  }, /* ang ou => an gou */
+    { 12,   0,    8,    359,  }, /* ban a => ba na */
+    { 12,   5,    8,    364,  }, /* ban ang => ba nang */
+    { 12,   6,    8,    365,  }, /* ban ao => ba nao */
+    { 12,   128,  8,    366,  }, /* ban e => ba ne */
+    { 12,   129,  8,    368,  }, /* ban ei => ba nei */
+    { 13,   2,    12,   163,  }, /* bang ai => ban gai */
+    { 13,   5,    12,   166,  }, /* bang ang => ban gang */
+    { 13,   6,    12,   167,  }, /* bang ao => ban gao */
+    { 13,   128,  12,   168,  }, /* bang e => ban ge */
+    { 13,   129,  12,   170,  }, /* bang ei => ban gei */
+    { 13,   130,  12,   172,  }, /* bang en => ban gen */
+    { 19,   0,    18,   161,  }, /* beng a => ben ga */
+    { 19,   2,    18,   163,  }, /* beng ai => ben gai */
+    { 19,   4,    18,   165,  }, /* beng an => ben gan */
+    { 19,   5,    18,   166,  }, /* beng ang => ben gang */
+    { 19,   6,    18,   167,  }, /* beng ao => ben gao */
+    { 19,   128,  18,   168,  }, /* beng e => ben ge */
+    { 19,   129,  18,   170,  }, /* beng ei => ben gei */
+    { 19,   130,  18,   172,  }, /* beng en => ben gen */
+    { 19,   402,  18,   178,  }, /* beng ou => ben gou */
+    { 22,   0,    21,   161,  }, /* biang a => bian ga */
+    { 22,   2,    21,   163,  }, /* biang ai => bian gai */
+    { 22,   4,    21,   165,  }, /* biang an => bian gan */
+    { 22,   5,    21,   166,  }, /* biang ang => bian gang */
+    { 22,   6,    21,   167,  }, /* biang ao => bian gao */
+    { 22,   128,  21,   168,  }, /* biang e => bian ge */
+    { 22,   129,  21,   170,  }, /* biang ei => bian gei */
+    { 22,   130,  21,   172,  }, /* biang en => bian gen */
+    { 22,   402,  21,   178,  }, /* biang ou => bian gou */
+    { 24,   459,  20,   131,  }, /* bie r => bi er */
+    { 27,   0,    20,   359,  }, /* bin a => bi na */
+    { 27,   2,    20,   361,  }, /* bin ai => bi nai */
+    { 27,   4,    20,   363,  }, /* bin an => bi nan */
+    { 27,   5,    20,   364,  }, /* bin ang => bi nang */
+    { 27,   6,    20,   365,  }, /* bin ao => bi nao */
+    { 27,   128,  20,   366,  }, /* bin e => bi ne */
+    { 27,   129,  20,   368,  }, /* bin ei => bi nei */
+    { 27,   130,  20,   370,  }, /* bin en => bi nen */
+    { 28,   128,  27,   168,  }, /* bing e => bin ge */
+    { 28,   129,  27,   170,  }, /* bing ei => bin gei */
+    { 36,   129,  32,   368,  }, /* can ei => ca nei */
+    { 37,   4,    36,   165,  }, /* cang an => can gan */
+    { 37,   5,    36,   166,  }, /* cang ang => can gang */
+    { 37,   128,  36,   168,  }, /* cang e => can ge */
+    { 37,   129,  36,   170,  }, /* cang ei => can gei */
+    { 37,   130,  36,   172,  }, /* cang en => can gen */
+    { 37,   402,  36,   178,  }, /* cang ou => can gou */
+    { 42,   0,    39,   359,  }, /* cen a => ce na */
+    { 42,   2,    39,   361,  }, /* cen ai => ce nai */
+    { 42,   4,    39,   363,  }, /* cen an => ce nan */
+    { 42,   5,    39,   364,  }, /* cen ang => ce nang */
+    { 42,   6,    39,   365,  }, /* cen ao => ce nao */
+    { 42,   128,  39,   366,  }, /* cen e => ce ne */
+    { 42,   129,  39,   368,  }, /* cen ei => ce nei */
+    { 42,   130,  39,   370,  }, /* cen en => ce nen */
+    { 43,   129,  42,   170,  }, /* ceng ei => cen gei */
+    { 49,   0,    45,   359,  }, /* chan a => cha na */
+    { 49,   6,    45,   365,  }, /* chan ao => cha nao */
+    { 49,   128,  45,   366,  }, /* chan e => cha ne */
+    { 49,   129,  45,   368,  }, /* chan ei => cha nei */
+    { 50,   5,    49,   166,  }, /* chang ang => chan gang */
+    { 50,   6,    49,   167,  }, /* chang ao => chan gao */
+    { 50,   129,  49,   170,  }, /* chang ei => chan gei */
+    { 50,   130,  49,   172,  }, /* chang en => chan gen */
+    { 50,   402,  49,   178,  }, /* chang ou => chan gou */
+    { 55,   0,    52,   359,  }, /* chen a => che na */
+    { 55,   4,    52,   363,  }, /* chen an => che nan */
+    { 55,   5,    52,   364,  }, /* chen ang => che nang */
+    { 55,   6,    52,   365,  }, /* chen ao => che nao */
+    { 55,   128,  52,   366,  }, /* chen e => che ne */
+    { 55,   129,  52,   368,  }, /* chen ei => che nei */
+    { 56,   5,    55,   166,  }, /* cheng ang => chen gang */
+    { 56,   6,    55,   167,  }, /* cheng ao => chen gao */
+    { 56,   129,  55,   170,  }, /* cheng ei => chen gei */
+    { 56,   402,  55,   178,  }, /* cheng ou => chen gou */
+    { 68,   4,    67,   165,  }, /* chuang an => chuan gan */
+    { 68,   5,    67,   166,  }, /* chuang ang => chuan gang */
+    { 68,   6,    67,   167,  }, /* chuang ao => chuan gao */
+    { 68,   128,  67,   168,  }, /* chuang e => chuan ge */
+    { 68,   129,  67,   170,  }, /* chuang ei => chuan gei */
+    { 68,   130,  67,   172,  }, /* chuang en => chuan gen */
+    { 68,   402,  67,   178,  }, /* chuang ou => chuan gou */
+    { 72,   0,    63,   359,  }, /* chun a => chu na */
+    { 72,   4,    63,   363,  }, /* chun an => chu nan */
+    { 72,   5,    63,   364,  }, /* chun ang => chu nang */
+    { 72,   6,    63,   365,  }, /* chun ao => chu nao */
+    { 72,   128,  63,   366,  }, /* chun e => chu ne */
+    { 72,   129,  63,   368,  }, /* chun ei => chu nei */
+    { 83,   0,    82,   161,  }, /* cuang a => cuan ga */
+    { 83,   2,    82,   163,  }, /* cuang ai => cuan gai */
+    { 83,   4,    82,   165,  }, /* cuang an => cuan gan */
+    { 83,   5,    82,   166,  }, /* cuang ang => cuan gang */
+    { 83,   6,    82,   167,  }, /* cuang ao => cuan gao */
+    { 83,   128,  82,   168,  }, /* cuang e => cuan ge */
+    { 83,   129,  82,   170,  }, /* cuang ei => cuan gei */
+    { 83,   130,  82,   172,  }, /* cuang en => cuan gen */
+    { 83,   402,  82,   178,  }, /* cuang ou => cuan gou */
+    { 87,   128,  80,   366,  }, /* cun e => cu ne */
+    { 87,   129,  80,   368,  }, /* cun ei => cu nei */
+    { 94,   0,    90,   359,  }, /* dan a => da na */
+    { 94,   2,    90,   361,  }, /* dan ai => da nai */
+    { 94,   4,    90,   363,  }, /* dan an => da nan */
+    { 94,   5,    90,   364,  }, /* dan ang => da nang */
+    { 94,   6,    90,   365,  }, /* dan ao => da nao */
+    { 94,   128,  90,   366,  }, /* dan e => da ne */
+    { 94,   129,  90,   368,  }, /* dan ei => da nei */
+    { 95,   2,    94,   163,  }, /* dang ai => dan gai */
+    { 95,   5,    94,   166,  }, /* dang ang => dan gang */
+    { 95,   6,    94,   167,  }, /* dang ao => dan gao */
+    { 95,   128,  94,   168,  }, /* dang e => dan ge */
+    { 95,   129,  94,   170,  }, /* dang ei => dan gei */
+    { 95,   130,  94,   172,  }, /* dang en => dan gen */
+    { 101,  0,    97,   359,  }, /* den a => de na */
+    { 101,  2,    97,   361,  }, /* den ai => de nai */
+    { 101,  4,    97,   363,  }, /* den an => de nan */
+    { 101,  5,    97,   364,  }, /* den ang => de nang */
+    { 101,  6,    97,   365,  }, /* den ao => de nao */
+    { 101,  128,  97,   366,  }, /* den e => de ne */
+    { 101,  129,  97,   368,  }, /* den ei => de nei */
+    { 101,  130,  97,   370,  }, /* den en => de nen */
+    { 101,  402,  97,   391,  }, /* den ou => de nou */
+    { 106,  0,    105,  161,  }, /* diang a => dian ga */
+    { 106,  2,    105,  163,  }, /* diang ai => dian gai */
+    { 106,  4,    105,  165,  }, /* diang an => dian gan */
+    { 106,  5,    105,  166,  }, /* diang ang => dian gang */
+    { 106,  6,    105,  167,  }, /* diang ao => dian gao */
+    { 106,  128,  105,  168,  }, /* diang e => dian ge */
+    { 106,  129,  105,  170,  }, /* diang ei => dian gei */
+    { 106,  130,  105,  172,  }, /* diang en => dian gen */
+    { 106,  402,  105,  178,  }, /* diang ou => dian gou */
+    { 108,  459,  103,  131,  }, /* die r => di er */
+    { 111,  0,    103,  359,  }, /* din a => di na */
+    { 111,  2,    103,  361,  }, /* din ai => di nai */
+    { 111,  4,    103,  363,  }, /* din an => di nan */
+    { 111,  5,    103,  364,  }, /* din ang => di nang */
+    { 111,  6,    103,  365,  }, /* din ao => di nao */
+    { 111,  128,  103,  366,  }, /* din e => di ne */
+    { 111,  129,  103,  368,  }, /* din ei => di nei */
+    { 111,  130,  103,  370,  }, /* din en => di nen */
+    { 111,  402,  103,  391,  }, /* din ou => di nou */
+    { 122,  0,    121,  161,  }, /* duang a => duan ga */
+    { 122,  2,    121,  163,  }, /* duang ai => duan gai */
+    { 122,  4,    121,  165,  }, /* duang an => duan gan */
+    { 122,  5,    121,  166,  }, /* duang ang => duan gang */
+    { 122,  6,    121,  167,  }, /* duang ao => duan gao */
+    { 122,  128,  121,  168,  }, /* duang e => duan ge */
+    { 122,  129,  121,  170,  }, /* duang ei => duan gei */
+    { 122,  130,  121,  172,  }, /* duang en => duan gen */
+    { 122,  402,  121,  178,  }, /* duang ou => duan gou */
+    { 126,  0,    120,  359,  }, /* dun a => du na */
+    { 126,  4,    120,  363,  }, /* dun an => du nan */
+    { 126,  5,    120,  364,  }, /* dun ang => du nang */
+    { 126,  6,    120,  365,  }, /* dun ao => du nao */
+    { 126,  128,  120,  366,  }, /* dun e => du ne */
+    { 126,  129,  120,  368,  }, /* dun ei => du nei */
+    { 130,  4,    128,  363,  }, /* en an => e nan */
+    { 130,  5,    128,  364,  }, /* en ang => e nang */
+    { 130,  6,    128,  365,  }, /* en ao => e nao */
+    { 130,  128,  128,  366,  }, /* en e => e ne */
+    { 130,  129,  128,  368,  }, /* en ei => e nei */
+    { 131,  4,    128,  464,  }, /* er an => e ran */
+    { 131,  5,    128,  465,  }, /* er ang => e rang */
+    { 131,  130,  128,  471,  }, /* er en => e ren */
+    { 131,  402,  128,  488,  }, /* er ou => e rou */
+    { 137,  5,    133,  364,  }, /* fan ang => fa nang */
+    { 137,  6,    133,  365,  }, /* fan ao => fa nao */
+    { 137,  129,  133,  368,  }, /* fan ei => fa nei */
+    { 138,  5,    137,  166,  }, /* fang ang => fan gang */
+    { 138,  6,    137,  167,  }, /* fang ao => fan gao */
+    { 138,  128,  137,  168,  }, /* fang e => fan ge */
+    { 138,  129,  137,  170,  }, /* fang ei => fan gei */
+    { 138,  130,  137,  172,  }, /* fang en => fan gen */
+    { 145,  5,    144,  166,  }, /* feng ang => fen gang */
+    { 145,  6,    144,  167,  }, /* feng ao => fen gao */
+    { 145,  128,  144,  168,  }, /* feng e => fen ge */
+    { 145,  129,  144,  170,  }, /* feng ei => fen gei */
+    { 145,  130,  144,  172,  }, /* feng en => fen gen */
+    { 145,  402,  144,  178,  }, /* feng ou => fen gou */
+    { 147,  0,    146,  359,  }, /* fon a => fo na */
+    { 147,  2,    146,  361,  }, /* fon ai => fo nai */
+    { 147,  4,    146,  363,  }, /* fon an => fo nan */
+    { 147,  5,    146,  364,  }, /* fon ang => fo nang */
+    { 147,  6,    146,  365,  }, /* fon ao => fo nao */
+    { 147,  128,  146,  366,  }, /* fon e => fo ne */
+    { 147,  129,  146,  368,  }, /* fon ei => fo nei */
+    { 147,  130,  146,  370,  }, /* fon en => fo nen */
+    { 147,  402,  146,  391,  }, /* fon ou => fo nou */
+    { 158,  0,    150,  359,  }, /* fun a => fu na */
+    { 158,  2,    150,  361,  }, /* fun ai => fu nai */
+    { 158,  4,    150,  363,  }, /* fun an => fu nan */
+    { 158,  5,    150,  364,  }, /* fun ang => fu nang */
+    { 158,  6,    150,  365,  }, /* fun ao => fu nao */
+    { 158,  128,  150,  366,  }, /* fun e => fu ne */
+    { 158,  129,  150,  368,  }, /* fun ei => fu nei */
+    { 158,  130,  150,  370,  }, /* fun en => fu nen */
+    { 158,  402,  150,  391,  }, /* fun ou => fu nou */
+    { 165,  128,  161,  366,  }, /* gan e => ga ne */
+    { 165,  129,  161,  368,  }, /* gan ei => ga nei */
+    { 166,  0,    165,  161,  }, /* gang a => gan ga */
+    { 166,  2,    165,  163,  }, /* gang ai => gan gai */
+    { 166,  4,    165,  165,  }, /* gang an => gan gan */
+    { 166,  5,    165,  166,  }, /* gang ang => gan gang */
+    { 166,  128,  165,  168,  }, /* gang e => gan ge */
+    { 166,  129,  165,  170,  }, /* gang ei => gan gei */
+    { 166,  130,  165,  172,  }, /* gang en => gan gen */
+    { 166,  402,  165,  178,  }, /* gang ou => gan gou */
+    { 172,  0,    168,  359,  }, /* gen a => ge na */
+    { 172,  4,    168,  363,  }, /* gen an => ge nan */
+    { 172,  5,    168,  364,  }, /* gen ang => ge nang */
+    { 172,  6,    168,  365,  }, /* gen ao => ge nao */
+    { 172,  128,  168,  366,  }, /* gen e => ge ne */
+    { 172,  129,  168,  368,  }, /* gen ei => ge nei */
+    { 173,  5,    172,  166,  }, /* geng ang => gen gang */
+    { 173,  6,    172,  167,  }, /* geng ao => gen gao */
+    { 173,  128,  172,  168,  }, /* geng e => gen ge */
+    { 173,  129,  172,  170,  }, /* geng ei => gen gei */
+    { 173,  130,  172,  172,  }, /* geng en => gen gen */
+    { 173,  402,  172,  178,  }, /* geng ou => gen gou */
+    { 184,  129,  180,  368,  }, /* guan ei => gua nei */
+    { 185,  2,    184,  163,  }, /* guang ai => guan gai */
+    { 185,  5,    184,  166,  }, /* guang ang => guan gang */
+    { 185,  6,    184,  167,  }, /* guang ao => guan gao */
+    { 185,  128,  184,  168,  }, /* guang e => guan ge */
+    { 185,  129,  184,  170,  }, /* guang ei => guan gei */
+    { 185,  130,  184,  172,  }, /* guang en => guan gen */
+    { 189,  4,    179,  363,  }, /* gun an => gu nan */
+    { 189,  5,    179,  364,  }, /* gun ang => gu nang */
+    { 189,  6,    179,  365,  }, /* gun ao => gu nao */
+    { 189,  128,  179,  366,  }, /* gun e => gu ne */
+    { 189,  129,  179,  368,  }, /* gun ei => gu nei */
+    { 196,  5,    192,  364,  }, /* han ang => ha nang */
+    { 196,  6,    192,  365,  }, /* han ao => ha nao */
+    { 196,  129,  192,  368,  }, /* han ei => ha nei */
+    { 197,  2,    196,  163,  }, /* hang ai => han gai */
+    { 197,  5,    196,  166,  }, /* hang ang => han gang */
+    { 197,  6,    196,  167,  }, /* hang ao => han gao */
+    { 197,  128,  196,  168,  }, /* hang e => han ge */
+    { 197,  129,  196,  170,  }, /* hang ei => han gei */
+    { 197,  130,  196,  172,  }, /* hang en => han gen */
+    { 197,  402,  196,  178,  }, /* hang ou => han gou */
+    { 203,  0,    199,  359,  }, /* hen a => he na */
+    { 203,  4,    199,  363,  }, /* hen an => he nan */
+    { 203,  5,    199,  364,  }, /* hen ang => he nang */
+    { 203,  6,    199,  365,  }, /* hen ao => he nao */
+    { 203,  129,  199,  368,  }, /* hen ei => he nei */
+    { 204,  2,    203,  163,  }, /* heng ai => hen gai */
+    { 204,  4,    203,  165,  }, /* heng an => hen gan */
+    { 204,  5,    203,  166,  }, /* heng ang => hen gang */
+    { 204,  6,    203,  167,  }, /* heng ao => hen gao */
+    { 204,  129,  203,  170,  }, /* heng ei => hen gei */
+    { 204,  130,  203,  172,  }, /* heng en => hen gen */
+    { 204,  402,  203,  178,  }, /* heng ou => hen gou */
+    { 216,  0,    212,  359,  }, /* huan a => hua na */
+    { 216,  4,    212,  363,  }, /* huan an => hua nan */
+    { 216,  5,    212,  364,  }, /* huan ang => hua nang */
+    { 216,  6,    212,  365,  }, /* huan ao => hua nao */
+    { 216,  128,  212,  366,  }, /* huan e => hua ne */
+    { 216,  129,  212,  368,  }, /* huan ei => hua nei */
+    { 216,  130,  212,  370,  }, /* huan en => hua nen */
+    { 217,  2,    216,  163,  }, /* huang ai => huan gai */
+    { 217,  5,    216,  166,  }, /* huang ang => huan gang */
+    { 217,  6,    216,  167,  }, /* huang ao => huan gao */
+    { 217,  128,  216,  168,  }, /* huang e => huan ge */
+    { 217,  129,  216,  170,  }, /* huang ei => huan gei */
+    { 217,  402,  216,  178,  }, /* huang ou => huan gou */
+    { 221,  4,    211,  363,  }, /* hun an => hu nan */
+    { 221,  5,    211,  364,  }, /* hun ang => hu nang */
+    { 221,  6,    211,  365,  }, /* hun ao => hu nao */
+    { 221,  129,  211,  368,  }, /* hun ei => hu nei */
+    { 228,  0,    225,  359,  }, /* jian a => jia na */
+    { 228,  2,    225,  361,  }, /* jian ai => jia nai */
+    { 228,  5,    225,  364,  }, /* jian ang => jia nang */
+    { 228,  128,  225,  366,  }, /* jian e => jia ne */
+    { 228,  129,  225,  368,  }, /* jian ei => jia nei */
+    { 229,  5,    228,  166,  }, /* jiang ang => jian gang */
+    { 229,  6,    228,  167,  }, /* jiang ao => jian gao */
+    { 229,  128,  228,  168,  }, /* jiang e => jian ge */
+    { 229,  129,  228,  170,  }, /* jiang ei => jian gei */
+    { 229,  402,  228,  178,  }, /* jiang ou => jian gou */
+    { 231,  459,  224,  131,  }, /* jie r => ji er */
+    { 234,  0,    224,  359,  }, /* jin a => ji na */
+    { 234,  4,    224,  363,  }, /* jin an => ji nan */
+    { 234,  5,    224,  364,  }, /* jin ang => ji nang */
+    { 234,  6,    224,  365,  }, /* jin ao => ji nao */
+    { 234,  129,  224,  368,  }, /* jin ei => ji nei */
+    { 235,  5,    234,  166,  }, /* jing ang => jin gang */
+    { 235,  6,    234,  167,  }, /* jing ao => jin gao */
+    { 235,  129,  234,  170,  }, /* jing ei => jin gei */
+    { 235,  130,  234,  172,  }, /* jing en => jin gen */
+    { 235,  402,  234,  178,  }, /* jing ou => jin gou */
+    { 244,  0,    243,  161,  }, /* juang a => juan ga */
+    { 244,  2,    243,  163,  }, /* juang ai => juan gai */
+    { 244,  4,    243,  165,  }, /* juang an => juan gan */
+    { 244,  5,    243,  166,  }, /* juang ang => juan gang */
+    { 244,  6,    243,  167,  }, /* juang ao => juan gao */
+    { 244,  128,  243,  168,  }, /* juang e => juan ge */
+    { 244,  129,  243,  170,  }, /* juang ei => juan gei */
+    { 244,  130,  243,  172,  }, /* juang en => juan gen */
+    { 244,  402,  243,  178,  }, /* juang ou => juan gou */
+    { 245,  459,  242,  131,  }, /* jue r => ju er */
+    { 246,  0,    245,  359,  }, /* juen a => jue na */
+    { 246,  2,    245,  361,  }, /* juen ai => jue nai */
+    { 246,  4,    245,  363,  }, /* juen an => jue nan */
+    { 246,  5,    245,  364,  }, /* juen ang => jue nang */
+    { 246,  6,    245,  365,  }, /* juen ao => jue nao */
+    { 246,  128,  245,  366,  }, /* juen e => jue ne */
+    { 246,  129,  245,  368,  }, /* juen ei => jue nei */
+    { 246,  130,  245,  370,  }, /* juen en => jue nen */
+    { 246,  402,  245,  391,  }, /* juen ou => jue nou */
+    { 247,  0,    242,  359,  }, /* jun a => ju na */
+    { 247,  2,    242,  361,  }, /* jun ai => ju nai */
+    { 247,  128,  242,  366,  }, /* jun e => ju ne */
+    { 247,  129,  242,  368,  }, /* jun ei => ju nei */
+    { 259,  129,  255,  368,  }, /* kan ei => ka nei */
+    { 260,  4,    259,  165,  }, /* kang an => kan gan */
+    { 260,  5,    259,  166,  }, /* kang ang => kan gang */
+    { 260,  6,    259,  167,  }, /* kang ao => kan gao */
+    { 260,  128,  259,  168,  }, /* kang e => kan ge */
+    { 260,  129,  259,  170,  }, /* kang ei => kan gei */
+    { 260,  130,  259,  172,  }, /* kang en => kan gen */
+    { 260,  402,  259,  178,  }, /* kang ou => kan gou */
+    { 266,  0,    262,  359,  }, /* ken a => ke na */
+    { 266,  2,    262,  361,  }, /* ken ai => ke nai */
+    { 266,  4,    262,  363,  }, /* ken an => ke nan */
+    { 266,  5,    262,  364,  }, /* ken ang => ke nang */
+    { 266,  6,    262,  365,  }, /* ken ao => ke nao */
+    { 266,  128,  262,  366,  }, /* ken e => ke ne */
+    { 266,  129,  262,  368,  }, /* ken ei => ke nei */
+    { 267,  2,    266,  163,  }, /* keng ai => ken gai */
+    { 267,  4,    266,  165,  }, /* keng an => ken gan */
+    { 267,  5,    266,  166,  }, /* keng ang => ken gang */
+    { 267,  6,    266,  167,  }, /* keng ao => ken gao */
+    { 267,  128,  266,  168,  }, /* keng e => ken ge */
+    { 267,  129,  266,  170,  }, /* keng ei => ken gei */
+    { 267,  130,  266,  172,  }, /* keng en => ken gen */
+    { 267,  402,  266,  178,  }, /* keng ou => ken gou */
+    { 278,  0,    274,  359,  }, /* kuan a => kua na */
+    { 278,  129,  274,  368,  }, /* kuan ei => kua nei */
+    { 279,  5,    278,  166,  }, /* kuang ang => kuan gang */
+    { 279,  128,  278,  168,  }, /* kuang e => kuan ge */
+    { 279,  129,  278,  170,  }, /* kuang ei => kuan gei */
+    { 279,  130,  278,  172,  }, /* kuang en => kuan gen */
+    { 283,  4,    273,  363,  }, /* kun an => ku nan */
+    { 283,  5,    273,  364,  }, /* kun ang => ku nang */
+    { 283,  6,    273,  365,  }, /* kun ao => ku nao */
+    { 283,  128,  273,  366,  }, /* kun e => ku ne */
+    { 283,  129,  273,  368,  }, /* kun ei => ku nei */
+    { 290,  0,    286,  359,  }, /* lan a => la na */
+    { 290,  4,    286,  363,  }, /* lan an => la nan */
+    { 290,  5,    286,  364,  }, /* lan ang => la nang */
+    { 290,  6,    286,  365,  }, /* lan ao => la nao */
+    { 290,  128,  286,  366,  }, /* lan e => la ne */
+    { 290,  129,  286,  368,  }, /* lan ei => la nei */
+    { 291,  4,    290,  165,  }, /* lang an => lan gan */
+    { 291,  5,    290,  166,  }, /* lang ang => lan gang */
+    { 291,  6,    290,  167,  }, /* lang ao => lan gao */
+    { 291,  128,  290,  168,  }, /* lang e => lan ge */
+    { 291,  129,  290,  170,  }, /* lang ei => lan gei */
+    { 291,  130,  290,  172,  }, /* lang en => lan gen */
+    { 291,  402,  290,  178,  }, /* lang ou => lan gou */
+    { 297,  0,    293,  359,  }, /* len a => le na */
+    { 297,  2,    293,  361,  }, /* len ai => le nai */
+    { 297,  4,    293,  363,  }, /* len an => le nan */
+    { 297,  5,    293,  364,  }, /* len ang => le nang */
+    { 297,  6,    293,  365,  }, /* len ao => le nao */
+    { 297,  128,  293,  366,  }, /* len e => le ne */
+    { 297,  129,  293,  368,  }, /* len ei => le nei */
+    { 297,  130,  293,  370,  }, /* len en => le nen */
+    { 297,  402,  293,  391,  }, /* len ou => le nou */
+    { 303,  129,  300,  368,  }, /* lian ei => lia nei */
+    { 304,  5,    303,  166,  }, /* liang ang => lian gang */
+    { 304,  6,    303,  167,  }, /* liang ao => lian gao */
+    { 304,  128,  303,  168,  }, /* liang e => lian ge */
+    { 304,  129,  303,  170,  }, /* liang ei => lian gei */
+    { 304,  130,  303,  172,  }, /* liang en => lian gen */
+    { 304,  402,  303,  178,  }, /* liang ou => lian gou */
+    { 306,  459,  299,  131,  }, /* lie r => li er */
+    { 309,  0,    299,  359,  }, /* lin a => li na */
+    { 309,  4,    299,  363,  }, /* lin an => li nan */
+    { 309,  5,    299,  364,  }, /* lin ang => li nang */
+    { 309,  6,    299,  365,  }, /* lin ao => li nao */
+    { 309,  128,  299,  366,  }, /* lin e => li ne */
+    { 309,  129,  299,  368,  }, /* lin ei => li nei */
+    { 310,  5,    309,  166,  }, /* ling ang => lin gang */
+    { 310,  6,    309,  167,  }, /* ling ao => lin gao */
+    { 310,  128,  309,  168,  }, /* ling e => lin ge */
+    { 310,  129,  309,  170,  }, /* ling ei => lin gei */
+    { 310,  130,  309,  172,  }, /* ling en => lin gen */
+    { 310,  402,  309,  178,  }, /* ling ou => lin gou */
+    { 316,  0,    313,  359,  }, /* lon a => lo na */
+    { 316,  2,    313,  361,  }, /* lon ai => lo nai */
+    { 316,  4,    313,  363,  }, /* lon an => lo nan */
+    { 316,  5,    313,  364,  }, /* lon ang => lo nang */
+    { 316,  6,    313,  365,  }, /* lon ao => lo nao */
+    { 316,  128,  313,  366,  }, /* lon e => lo ne */
+    { 316,  129,  313,  368,  }, /* lon ei => lo nei */
+    { 316,  130,  313,  370,  }, /* lon en => lo nen */
+    { 316,  402,  313,  391,  }, /* lon ou => lo nou */
+    { 321,  0,    320,  161,  }, /* luang a => luan ga */
+    { 321,  2,    320,  163,  }, /* luang ai => luan gai */
+    { 321,  4,    320,  165,  }, /* luang an => luan gan */
+    { 321,  5,    320,  166,  }, /* luang ang => luan gang */
+    { 321,  6,    320,  167,  }, /* luang ao => luan gao */
+    { 321,  128,  320,  168,  }, /* luang e => luan ge */
+    { 321,  129,  320,  170,  }, /* luang ei => luan gei */
+    { 321,  130,  320,  172,  }, /* luang en => luan gen */
+    { 321,  402,  320,  178,  }, /* luang ou => luan gou */
+    { 322,  459,  319,  131,  }, /* lue r => lu er */
+    { 326,  0,    319,  359,  }, /* lun a => lu na */
+    { 326,  2,    319,  361,  }, /* lun ai => lu nai */
+    { 326,  4,    319,  363,  }, /* lun an => lu nan */
+    { 326,  5,    319,  364,  }, /* lun ang => lu nang */
+    { 326,  6,    319,  365,  }, /* lun ao => lu nao */
+    { 326,  128,  319,  366,  }, /* lun e => lu ne */
+    { 326,  129,  319,  368,  }, /* lun ei => lu nei */
+    { 329,  459,  328,  131,  }, /* lve r => lv er */
+    { 335,  2,    331,  361,  }, /* man ai => ma nai */
+    { 335,  4,    331,  363,  }, /* man an => ma nan */
+    { 335,  5,    331,  364,  }, /* man ang => ma nang */
+    { 335,  6,    331,  365,  }, /* man ao => ma nao */
+    { 335,  128,  331,  366,  }, /* man e => ma ne */
+    { 335,  129,  331,  368,  }, /* man ei => ma nei */
+    { 336,  2,    335,  163,  }, /* mang ai => man gai */
+    { 336,  4,    335,  165,  }, /* mang an => man gan */
+    { 336,  5,    335,  166,  }, /* mang ang => man gang */
+    { 336,  6,    335,  167,  }, /* mang ao => man gao */
+    { 336,  128,  335,  168,  }, /* mang e => man ge */
+    { 336,  129,  335,  170,  }, /* mang ei => man gei */
+    { 336,  130,  335,  172,  }, /* mang en => man gen */
+    { 336,  402,  335,  178,  }, /* mang ou => man gou */
+    { 342,  5,    338,  364,  }, /* men ang => me nang */
+    { 342,  6,    338,  365,  }, /* men ao => me nao */
+    { 342,  128,  338,  366,  }, /* men e => me ne */
+    { 342,  129,  338,  368,  }, /* men ei => me nei */
+    { 343,  2,    342,  163,  }, /* meng ai => men gai */
+    { 343,  5,    342,  166,  }, /* meng ang => men gang */
+    { 343,  6,    342,  167,  }, /* meng ao => men gao */
+    { 343,  128,  342,  168,  }, /* meng e => men ge */
+    { 343,  129,  342,  170,  }, /* meng ei => men gei */
+    { 343,  402,  342,  178,  }, /* meng ou => men gou */
+    { 346,  0,    345,  161,  }, /* miang a => mian ga */
+    { 346,  2,    345,  163,  }, /* miang ai => mian gai */
+    { 346,  4,    345,  165,  }, /* miang an => mian gan */
+    { 346,  5,    345,  166,  }, /* miang ang => mian gang */
+    { 346,  6,    345,  167,  }, /* miang ao => mian gao */
+    { 346,  128,  345,  168,  }, /* miang e => mian ge */
+    { 346,  129,  345,  170,  }, /* miang ei => mian gei */
+    { 346,  130,  345,  172,  }, /* miang en => mian gen */
+    { 346,  402,  345,  178,  }, /* miang ou => mian gou */
+    { 348,  459,  344,  131,  }, /* mie r => mi er */
+    { 351,  0,    344,  359,  }, /* min a => mi na */
+    { 351,  128,  344,  366,  }, /* min e => mi ne */
+    { 351,  129,  344,  368,  }, /* min ei => mi nei */
+    { 352,  4,    351,  165,  }, /* ming an => min gan */
+    { 352,  5,    351,  166,  }, /* ming ang => min gang */
+    { 352,  6,    351,  167,  }, /* ming ao => min gao */
+    { 352,  128,  351,  168,  }, /* ming e => min ge */
+    { 352,  129,  351,  170,  }, /* ming ei => min gei */
+    { 352,  402,  351,  178,  }, /* ming ou => min gou */
+    { 363,  0,    359,  359,  }, /* nan a => na na */
+    { 363,  5,    359,  364,  }, /* nan ang => na nang */
+    { 363,  128,  359,  366,  }, /* nan e => na ne */
+    { 363,  129,  359,  368,  }, /* nan ei => na nei */
+    { 364,  0,    363,  161,  }, /* nang a => nan ga */
+    { 364,  2,    363,  163,  }, /* nang ai => nan gai */
+    { 364,  4,    363,  165,  }, /* nang an => nan gan */
+    { 364,  5,    363,  166,  }, /* nang ang => nan gang */
+    { 364,  6,    363,  167,  }, /* nang ao => nan gao */
+    { 364,  128,  363,  168,  }, /* nang e => nan ge */
+    { 364,  129,  363,  170,  }, /* nang ei => nan gei */
+    { 364,  130,  363,  172,  }, /* nang en => nan gen */
+    { 364,  402,  363,  178,  }, /* nang ou => nan gou */
+    { 370,  0,    366,  359,  }, /* nen a => ne na */
+    { 370,  2,    366,  361,  }, /* nen ai => ne nai */
+    { 370,  4,    366,  363,  }, /* nen an => ne nan */
+    { 370,  5,    366,  364,  }, /* nen ang => ne nang */
+    { 370,  6,    366,  365,  }, /* nen ao => ne nao */
+    { 370,  128,  366,  366,  }, /* nen e => ne ne */
+    { 370,  129,  366,  368,  }, /* nen ei => ne nei */
+    { 370,  130,  366,  370,  }, /* nen en => ne nen */
+    { 371,  128,  370,  168,  }, /* neng e => nen ge */
+    { 371,  129,  370,  170,  }, /* neng ei => nen gei */
+    { 377,  2,    376,  163,  }, /* niang ai => nian gai */
+    { 377,  4,    376,  165,  }, /* niang an => nian gan */
+    { 377,  5,    376,  166,  }, /* niang ang => nian gang */
+    { 377,  6,    376,  167,  }, /* niang ao => nian gao */
+    { 377,  128,  376,  168,  }, /* niang e => nian ge */
+    { 377,  129,  376,  170,  }, /* niang ei => nian gei */
+    { 377,  130,  376,  172,  }, /* niang en => nian gen */
+    { 377,  402,  376,  178,  }, /* niang ou => nian gou */
+    { 379,  459,  372,  131,  }, /* nie r => ni er */
+    { 382,  0,    372,  359,  }, /* nin a => ni na */
+    { 382,  4,    372,  363,  }, /* nin an => ni nan */
+    { 382,  5,    372,  364,  }, /* nin ang => ni nang */
+    { 382,  6,    372,  365,  }, /* nin ao => ni nao */
+    { 382,  128,  372,  366,  }, /* nin e => ni ne */
+    { 382,  129,  372,  368,  }, /* nin ei => ni nei */
+    { 383,  2,    382,  163,  }, /* ning ai => nin gai */
+    { 383,  5,    382,  166,  }, /* ning ang => nin gang */
+    { 383,  6,    382,  167,  }, /* ning ao => nin gao */
+    { 383,  129,  382,  170,  }, /* ning ei => nin gei */
+    { 383,  130,  382,  172,  }, /* ning en => nin gen */
+    { 383,  402,  382,  178,  }, /* ning ou => nin gou */
+    { 394,  0,    393,  161,  }, /* nuang a => nuan ga */
+    { 394,  2,    393,  163,  }, /* nuang ai => nuan gai */
+    { 394,  4,    393,  165,  }, /* nuang an => nuan gan */
+    { 394,  5,    393,  166,  }, /* nuang ang => nuan gang */
+    { 394,  6,    393,  167,  }, /* nuang ao => nuan gao */
+    { 394,  128,  393,  168,  }, /* nuang e => nuan ge */
+    { 394,  129,  393,  170,  }, /* nuang ei => nuan gei */
+    { 394,  130,  393,  172,  }, /* nuang en => nuan gen */
+    { 394,  402,  393,  178,  }, /* nuang ou => nuan gou */
+    { 395,  459,  392,  131,  }, /* nue r => nu er */
+    { 397,  0,    392,  359,  }, /* nun a => nu na */
+    { 397,  2,    392,  361,  }, /* nun ai => nu nai */
+    { 397,  4,    392,  363,  }, /* nun an => nu nan */
+    { 397,  5,    392,  364,  }, /* nun ang => nu nang */
+    { 397,  6,    392,  365,  }, /* nun ao => nu nao */
+    { 397,  128,  392,  366,  }, /* nun e => nu ne */
+    { 397,  129,  392,  368,  }, /* nun ei => nu nei */
+    { 397,  130,  392,  370,  }, /* nun en => nu nen */
+    { 397,  402,  392,  391,  }, /* nun ou => nu nou */
+    { 400,  459,  399,  131,  }, /* nve r => nv er */
+    { 408,  0,    404,  359,  }, /* pan a => pa na */
+    { 408,  5,    404,  364,  }, /* pan ang => pa nang */
+    { 408,  6,    404,  365,  }, /* pan ao => pa nao */
+    { 408,  128,  404,  366,  }, /* pan e => pa ne */
+    { 408,  129,  404,  368,  }, /* pan ei => pa nei */
+    { 409,  5,    408,  166,  }, /* pang ang => pan gang */
+    { 409,  6,    408,  167,  }, /* pang ao => pan gao */
+    { 409,  128,  408,  168,  }, /* pang e => pan ge */
+    { 409,  129,  408,  170,  }, /* pang ei => pan gei */
+    { 409,  130,  408,  172,  }, /* pang en => pan gen */
+    { 409,  402,  408,  178,  }, /* pang ou => pan gou */
+    { 415,  5,    414,  166,  }, /* peng ang => pen gang */
+    { 415,  6,    414,  167,  }, /* peng ao => pen gao */
+    { 415,  128,  414,  168,  }, /* peng e => pen ge */
+    { 415,  129,  414,  170,  }, /* peng ei => pen gei */
+    { 418,  0,    417,  161,  }, /* piang a => pian ga */
+    { 418,  2,    417,  163,  }, /* piang ai => pian gai */
+    { 418,  4,    417,  165,  }, /* piang an => pian gan */
+    { 418,  5,    417,  166,  }, /* piang ang => pian gang */
+    { 418,  6,    417,  167,  }, /* piang ao => pian gao */
+    { 418,  128,  417,  168,  }, /* piang e => pian ge */
+    { 418,  129,  417,  170,  }, /* piang ei => pian gei */
+    { 418,  130,  417,  172,  }, /* piang en => pian gen */
+    { 418,  402,  417,  178,  }, /* piang ou => pian gou */
+    { 420,  459,  416,  131,  }, /* pie r => pi er */
+    { 423,  0,    416,  359,  }, /* pin a => pi na */
+    { 423,  5,    416,  364,  }, /* pin ang => pi nang */
+    { 423,  6,    416,  365,  }, /* pin ao => pi nao */
+    { 423,  128,  416,  366,  }, /* pin e => pi ne */
+    { 423,  129,  416,  368,  }, /* pin ei => pi nei */
+    { 424,  5,    423,  166,  }, /* ping ang => pin gang */
+    { 424,  6,    423,  167,  }, /* ping ao => pin gao */
+    { 424,  128,  423,  168,  }, /* ping e => pin ge */
+    { 424,  129,  423,  170,  }, /* ping ei => pin gei */
+    { 424,  130,  423,  172,  }, /* ping en => pin gen */
+    { 424,  402,  423,  178,  }, /* ping ou => pin gou */
+    { 433,  129,  430,  368,  }, /* qian ei => qia nei */
+    { 434,  2,    433,  163,  }, /* qiang ai => qian gai */
+    { 434,  4,    433,  165,  }, /* qiang an => qian gan */
+    { 434,  5,    433,  166,  }, /* qiang ang => qian gang */
+    { 434,  6,    433,  167,  }, /* qiang ao => qian gao */
+    { 434,  128,  433,  168,  }, /* qiang e => qian ge */
+    { 434,  129,  433,  170,  }, /* qiang ei => qian gei */
+    { 434,  130,  433,  172,  }, /* qiang en => qian gen */
+    { 434,  402,  433,  178,  }, /* qiang ou => qian gou */
+    { 436,  459,  429,  131,  }, /* qie r => qi er */
+    { 439,  0,    429,  359,  }, /* qin a => qi na */
+    { 439,  5,    429,  364,  }, /* qin ang => qi nang */
+    { 439,  6,    429,  365,  }, /* qin ao => qi nao */
+    { 439,  128,  429,  366,  }, /* qin e => qi ne */
+    { 439,  129,  429,  368,  }, /* qin ei => qi nei */
+    { 440,  5,    439,  166,  }, /* qing ang => qin gang */
+    { 440,  6,    439,  167,  }, /* qing ao => qin gao */
+    { 440,  128,  439,  168,  }, /* qing e => qin ge */
+    { 440,  129,  439,  170,  }, /* qing ei => qin gei */
+    { 440,  130,  439,  172,  }, /* qing en => qin gen */
+    { 440,  402,  439,  178,  }, /* qing ou => qin gou */
+    { 449,  0,    448,  161,  }, /* quang a => quan ga */
+    { 449,  2,    448,  163,  }, /* quang ai => quan gai */
+    { 449,  4,    448,  165,  }, /* quang an => quan gan */
+    { 449,  5,    448,  166,  }, /* quang ang => quan gang */
+    { 449,  6,    448,  167,  }, /* quang ao => quan gao */
+    { 449,  128,  448,  168,  }, /* quang e => quan ge */
+    { 449,  129,  448,  170,  }, /* quang ei => quan gei */
+    { 449,  130,  448,  172,  }, /* quang en => quan gen */
+    { 449,  402,  448,  178,  }, /* quang ou => quan gou */
+    { 450,  459,  447,  131,  }, /* que r => qu er */
+    { 451,  0,    450,  359,  }, /* quen a => que na */
+    { 451,  2,    450,  361,  }, /* quen ai => que nai */
+    { 451,  4,    450,  363,  }, /* quen an => que nan */
+    { 451,  5,    450,  364,  }, /* quen ang => que nang */
+    { 451,  6,    450,  365,  }, /* quen ao => que nao */
+    { 451,  128,  450,  366,  }, /* quen e => que ne */
+    { 451,  129,  450,  368,  }, /* quen ei => que nei */
+    { 451,  130,  450,  370,  }, /* quen en => que nen */
+    { 451,  402,  450,  391,  }, /* quen ou => que nou */
+    { 452,  0,    447,  359,  }, /* qun a => qu na */
+    { 452,  4,    447,  363,  }, /* qun an => qu nan */
+    { 452,  5,    447,  364,  }, /* qun ang => qu nang */
+    { 452,  6,    447,  365,  }, /* qun ao => qu nao */
+    { 452,  128,  447,  366,  }, /* qun e => qu ne */
+    { 452,  129,  447,  368,  }, /* qun ei => qu nei */
+    { 465,  5,    464,  166,  }, /* rang ang => ran gang */
+    { 465,  6,    464,  167,  }, /* rang ao => ran gao */
+    { 465,  129,  464,  170,  }, /* rang ei => ran gei */
+    { 465,  130,  464,  172,  }, /* rang en => ran gen */
+    { 471,  6,    467,  365,  }, /* ren ao => re nao */
+    { 471,  128,  467,  366,  }, /* ren e => re ne */
+    { 471,  129,  467,  368,  }, /* ren ei => re nei */
+    { 472,  0,    471,  161,  }, /* reng a => ren ga */
+    { 472,  2,    471,  163,  }, /* reng ai => ren gai */
+    { 472,  4,    471,  165,  }, /* reng an => ren gan */
+    { 472,  5,    471,  166,  }, /* reng ang => ren gang */
+    { 472,  6,    471,  167,  }, /* reng ao => ren gao */
+    { 472,  128,  471,  168,  }, /* reng e => ren ge */
+    { 472,  129,  471,  170,  }, /* reng ei => ren gei */
+    { 472,  130,  471,  172,  }, /* reng en => ren gen */
+    { 472,  402,  471,  178,  }, /* reng ou => ren gou */
+    { 478,  459,  473,  131,  }, /* rie r => ri er */
+    { 479,  0,    473,  359,  }, /* rin a => ri na */
+    { 479,  2,    473,  361,  }, /* rin ai => ri nai */
+    { 479,  4,    473,  363,  }, /* rin an => ri nan */
+    { 479,  5,    473,  364,  }, /* rin ang => ri nang */
+    { 479,  6,    473,  365,  }, /* rin ao => ri nao */
+    { 479,  128,  473,  366,  }, /* rin e => ri ne */
+    { 479,  129,  473,  368,  }, /* rin ei => ri nei */
+    { 479,  130,  473,  370,  }, /* rin en => ri nen */
+    { 479,  402,  473,  391,  }, /* rin ou => ri nou */
+    { 491,  0,    490,  161,  }, /* ruang a => ruan ga */
+    { 491,  2,    490,  163,  }, /* ruang ai => ruan gai */
+    { 491,  4,    490,  165,  }, /* ruang an => ruan gan */
+    { 491,  5,    490,  166,  }, /* ruang ang => ruan gang */
+    { 491,  6,    490,  167,  }, /* ruang ao => ruan gao */
+    { 491,  128,  490,  168,  }, /* ruang e => ruan ge */
+    { 491,  129,  490,  170,  }, /* ruang ei => ruan gei */
+    { 491,  130,  490,  172,  }, /* ruang en => ruan gen */
+    { 491,  402,  490,  178,  }, /* ruang ou => ruan gou */
+    { 492,  459,  489,  131,  }, /* rue r => ru er */
+    { 496,  0,    489,  359,  }, /* run a => ru na */
+    { 496,  2,    489,  361,  }, /* run ai => ru nai */
+    { 496,  4,    489,  363,  }, /* run an => ru nan */
+    { 496,  5,    489,  364,  }, /* run ang => ru nang */
+    { 496,  6,    489,  365,  }, /* run ao => ru nao */
+    { 496,  128,  489,  366,  }, /* run e => ru ne */
+    { 496,  129,  489,  368,  }, /* run ei => ru nei */
+    { 496,  130,  489,  370,  }, /* run en => ru nen */
+    { 505,  0,    501,  359,  }, /* san a => sa na */
+    { 505,  129,  501,  368,  }, /* san ei => sa nei */
+    { 506,  2,    505,  163,  }, /* sang ai => san gai */
+    { 506,  4,    505,  165,  }, /* sang an => san gan */
+    { 506,  5,    505,  166,  }, /* sang ang => san gang */
+    { 506,  6,    505,  167,  }, /* sang ao => san gao */
+    { 506,  128,  505,  168,  }, /* sang e => san ge */
+    { 506,  129,  505,  170,  }, /* sang ei => san gei */
+    { 506,  130,  505,  172,  }, /* sang en => san gen */
+    { 512,  0,    508,  359,  }, /* sen a => se na */
+    { 512,  2,    508,  361,  }, /* sen ai => se nai */
+    { 512,  4,    508,  363,  }, /* sen an => se nan */
+    { 512,  5,    508,  364,  }, /* sen ang => se nang */
+    { 512,  6,    508,  365,  }, /* sen ao => se nao */
+    { 512,  128,  508,  366,  }, /* sen e => se ne */
+    { 512,  129,  508,  368,  }, /* sen ei => se nei */
+    { 513,  2,    512,  163,  }, /* seng ai => sen gai */
+    { 513,  4,    512,  165,  }, /* seng an => sen gan */
+    { 513,  5,    512,  166,  }, /* seng ang => sen gang */
+    { 513,  6,    512,  167,  }, /* seng ao => sen gao */
+    { 513,  128,  512,  168,  }, /* seng e => sen ge */
+    { 513,  129,  512,  170,  }, /* seng ei => sen gei */
+    { 513,  130,  512,  172,  }, /* seng en => sen gen */
+    { 513,  402,  512,  178,  }, /* seng ou => sen gou */
+    { 519,  0,    515,  359,  }, /* shan a => sha na */
+    { 519,  4,    515,  363,  }, /* shan an => sha nan */
+    { 519,  129,  515,  368,  }, /* shan ei => sha nei */
+    { 520,  2,    519,  163,  }, /* shang ai => shan gai */
+    { 520,  5,    519,  166,  }, /* shang ang => shan gang */
+    { 520,  6,    519,  167,  }, /* shang ao => shan gao */
+    { 520,  128,  519,  168,  }, /* shang e => shan ge */
+    { 520,  129,  519,  170,  }, /* shang ei => shan gei */
+    { 520,  130,  519,  172,  }, /* shang en => shan gen */
+    { 520,  402,  519,  178,  }, /* shang ou => shan gou */
+    { 526,  129,  522,  368,  }, /* shen ei => she nei */
+    { 527,  4,    526,  165,  }, /* sheng an => shen gan */
+    { 527,  5,    526,  166,  }, /* sheng ang => shen gang */
+    { 527,  6,    526,  167,  }, /* sheng ao => shen gao */
+    { 527,  128,  526,  168,  }, /* sheng e => shen ge */
+    { 527,  129,  526,  170,  }, /* sheng ei => shen gei */
+    { 527,  402,  526,  178,  }, /* sheng ou => shen gou */
+    { 537,  0,    533,  359,  }, /* shuan a => shua na */
+    { 537,  2,    533,  361,  }, /* shuan ai => shua nai */
+    { 537,  4,    533,  363,  }, /* shuan an => shua nan */
+    { 537,  5,    533,  364,  }, /* shuan ang => shua nang */
+    { 537,  6,    533,  365,  }, /* shuan ao => shua nao */
+    { 537,  128,  533,  366,  }, /* shuan e => shua ne */
+    { 537,  129,  533,  368,  }, /* shuan ei => shua nei */
+    { 538,  129,  537,  170,  }, /* shuang ei => shuan gei */
+    { 542,  4,    532,  363,  }, /* shun an => shu nan */
+    { 542,  5,    532,  364,  }, /* shun ang => shu nang */
+    { 542,  6,    532,  365,  }, /* shun ao => shu nao */
+    { 542,  128,  532,  366,  }, /* shun e => shu ne */
+    { 542,  129,  532,  368,  }, /* shun ei => shu nei */
+    { 554,  0,    553,  161,  }, /* suang a => suan ga */
+    { 554,  2,    553,  163,  }, /* suang ai => suan gai */
+    { 554,  4,    553,  165,  }, /* suang an => suan gan */
+    { 554,  5,    553,  166,  }, /* suang ang => suan gang */
+    { 554,  6,    553,  167,  }, /* suang ao => suan gao */
+    { 554,  128,  553,  168,  }, /* suang e => suan ge */
+    { 554,  129,  553,  170,  }, /* suang ei => suan gei */
+    { 554,  130,  553,  172,  }, /* suang en => suan gen */
+    { 554,  402,  553,  178,  }, /* suang ou => suan gou */
+    { 558,  0,    550,  359,  }, /* sun a => su na */
+    { 558,  4,    550,  363,  }, /* sun an => su nan */
+    { 558,  5,    550,  364,  }, /* sun ang => su nang */
+    { 558,  6,    550,  365,  }, /* sun ao => su nao */
+    { 558,  128,  550,  366,  }, /* sun e => su ne */
+    { 558,  129,  550,  368,  }, /* sun ei => su nei */
+    { 565,  0,    561,  359,  }, /* tan a => ta na */
+    { 565,  5,    561,  364,  }, /* tan ang => ta nang */
+    { 565,  6,    561,  365,  }, /* tan ao => ta nao */
+    { 565,  128,  561,  366,  }, /* tan e => ta ne */
+    { 565,  129,  561,  368,  }, /* tan ei => ta nei */
+    { 566,  2,    565,  163,  }, /* tang ai => tan gai */
+    { 566,  4,    565,  165,  }, /* tang an => tan gan */
+    { 566,  5,    565,  166,  }, /* tang ang => tan gang */
+    { 566,  128,  565,  168,  }, /* tang e => tan ge */
+    { 566,  129,  565,  170,  }, /* tang ei => tan gei */
+    { 566,  402,  565,  178,  }, /* tang ou => tan gou */
+    { 571,  0,    568,  359,  }, /* ten a => te na */
+    { 571,  2,    568,  361,  }, /* ten ai => te nai */
+    { 571,  4,    568,  363,  }, /* ten an => te nan */
+    { 571,  5,    568,  364,  }, /* ten ang => te nang */
+    { 571,  6,    568,  365,  }, /* ten ao => te nao */
+    { 571,  128,  568,  366,  }, /* ten e => te ne */
+    { 571,  129,  568,  368,  }, /* ten ei => te nei */
+    { 571,  130,  568,  370,  }, /* ten en => te nen */
+    { 571,  402,  568,  391,  }, /* ten ou => te nou */
+    { 575,  0,    574,  161,  }, /* tiang a => tian ga */
+    { 575,  2,    574,  163,  }, /* tiang ai => tian gai */
+    { 575,  4,    574,  165,  }, /* tiang an => tian gan */
+    { 575,  5,    574,  166,  }, /* tiang ang => tian gang */
+    { 575,  6,    574,  167,  }, /* tiang ao => tian gao */
+    { 575,  128,  574,  168,  }, /* tiang e => tian ge */
+    { 575,  129,  574,  170,  }, /* tiang ei => tian gei */
+    { 575,  130,  574,  172,  }, /* tiang en => tian gen */
+    { 575,  402,  574,  178,  }, /* tiang ou => tian gou */
+    { 577,  459,  573,  131,  }, /* tie r => ti er */
+    { 580,  0,    573,  359,  }, /* tin a => ti na */
+    { 580,  2,    573,  361,  }, /* tin ai => ti nai */
+    { 580,  4,    573,  363,  }, /* tin an => ti nan */
+    { 580,  5,    573,  364,  }, /* tin ang => ti nang */
+    { 580,  6,    573,  365,  }, /* tin ao => ti nao */
+    { 580,  128,  573,  366,  }, /* tin e => ti ne */
+    { 580,  129,  573,  368,  }, /* tin ei => ti nei */
+    { 580,  130,  573,  370,  }, /* tin en => ti nen */
+    { 580,  402,  573,  391,  }, /* tin ou => ti nou */
+    { 589,  0,    588,  161,  }, /* tuang a => tuan ga */
+    { 589,  2,    588,  163,  }, /* tuang ai => tuan gai */
+    { 589,  4,    588,  165,  }, /* tuang an => tuan gan */
+    { 589,  5,    588,  166,  }, /* tuang ang => tuan gang */
+    { 589,  6,    588,  167,  }, /* tuang ao => tuan gao */
+    { 589,  128,  588,  168,  }, /* tuang e => tuan ge */
+    { 589,  129,  588,  170,  }, /* tuang ei => tuan gei */
+    { 589,  130,  588,  172,  }, /* tuang en => tuan gen */
+    { 589,  402,  588,  178,  }, /* tuang ou => tuan gou */
+    { 593,  0,    587,  359,  }, /* tun a => tu na */
+    { 593,  2,    587,  361,  }, /* tun ai => tu nai */
+    { 593,  4,    587,  363,  }, /* tun an => tu nan */
+    { 593,  5,    587,  364,  }, /* tun ang => tu nang */
+    { 593,  6,    587,  365,  }, /* tun ao => tu nao */
+    { 593,  128,  587,  366,  }, /* tun e => tu ne */
+    { 593,  129,  587,  368,  }, /* tun ei => tu nei */
+    { 593,  130,  587,  370,  }, /* tun en => tu nen */
+    { 600,  129,  596,  368,  }, /* wan ei => wa nei */
+    { 601,  5,    600,  166,  }, /* wang ang => wan gang */
+    { 601,  6,    600,  167,  }, /* wang ao => wan gao */
+    { 601,  128,  600,  168,  }, /* wang e => wan ge */
+    { 601,  129,  600,  170,  }, /* wang ei => wan gei */
+    { 601,  402,  600,  178,  }, /* wang ou => wan gou */
+    { 606,  0,    605,  161,  }, /* weng a => wen ga */
+    { 606,  2,    605,  163,  }, /* weng ai => wen gai */
+    { 606,  4,    605,  165,  }, /* weng an => wen gan */
+    { 606,  5,    605,  166,  }, /* weng ang => wen gang */
+    { 606,  6,    605,  167,  }, /* weng ao => wen gao */
+    { 606,  128,  605,  168,  }, /* weng e => wen ge */
+    { 606,  129,  605,  170,  }, /* weng ei => wen gei */
+    { 606,  130,  605,  172,  }, /* weng en => wen gen */
+    { 606,  402,  605,  178,  }, /* weng ou => wen gou */
+    { 614,  0,    611,  359,  }, /* xian a => xia na */
+    { 614,  5,    611,  364,  }, /* xian ang => xia nang */
+    { 614,  6,    611,  365,  }, /* xian ao => xia nao */
+    { 614,  129,  611,  368,  }, /* xian ei => xia nei */
+    { 615,  5,    614,  166,  }, /* xiang ang => xian gang */
+    { 615,  6,    614,  167,  }, /* xiang ao => xian gao */
+    { 615,  129,  614,  170,  }, /* xiang ei => xian gei */
+    { 615,  130,  614,  172,  }, /* xiang en => xian gen */
+    { 615,  402,  614,  178,  }, /* xiang ou => xian gou */
+    { 617,  459,  610,  131,  }, /* xie r => xi er */
+    { 620,  0,    610,  359,  }, /* xin a => xi na */
+    { 620,  4,    610,  363,  }, /* xin an => xi nan */
+    { 620,  128,  610,  366,  }, /* xin e => xi ne */
+    { 620,  129,  610,  368,  }, /* xin ei => xi nei */
+    { 620,  130,  610,  370,  }, /* xin en => xi nen */
+    { 621,  4,    620,  165,  }, /* xing an => xin gan */
+    { 621,  5,    620,  166,  }, /* xing ang => xin gang */
+    { 621,  6,    620,  167,  }, /* xing ao => xin gao */
+    { 621,  128,  620,  168,  }, /* xing e => xin ge */
+    { 621,  129,  620,  170,  }, /* xing ei => xin gei */
+    { 621,  130,  620,  172,  }, /* xing en => xin gen */
+    { 621,  402,  620,  178,  }, /* xing ou => xin gou */
+    { 630,  0,    629,  161,  }, /* xuang a => xuan ga */
+    { 630,  2,    629,  163,  }, /* xuang ai => xuan gai */
+    { 630,  4,    629,  165,  }, /* xuang an => xuan gan */
+    { 630,  5,    629,  166,  }, /* xuang ang => xuan gang */
+    { 630,  6,    629,  167,  }, /* xuang ao => xuan gao */
+    { 630,  128,  629,  168,  }, /* xuang e => xuan ge */
+    { 630,  129,  629,  170,  }, /* xuang ei => xuan gei */
+    { 630,  130,  629,  172,  }, /* xuang en => xuan gen */
+    { 630,  402,  629,  178,  }, /* xuang ou => xuan gou */
+    { 631,  459,  628,  131,  }, /* xue r => xu er */
+    { 632,  0,    631,  359,  }, /* xuen a => xue na */
+    { 632,  2,    631,  361,  }, /* xuen ai => xue nai */
+    { 632,  4,    631,  363,  }, /* xuen an => xue nan */
+    { 632,  5,    631,  364,  }, /* xuen ang => xue nang */
+    { 632,  6,    631,  365,  }, /* xuen ao => xue nao */
+    { 632,  128,  631,  366,  }, /* xuen e => xue ne */
+    { 632,  129,  631,  368,  }, /* xuen ei => xue nei */
+    { 632,  130,  631,  370,  }, /* xuen en => xue nen */
+    { 632,  402,  631,  391,  }, /* xuen ou => xue nou */
+    { 633,  5,    628,  364,  }, /* xun ang => xu nang */
+    { 633,  6,    628,  365,  }, /* xun ao => xu nao */
+    { 633,  128,  628,  366,  }, /* xun e => xu ne */
+    { 633,  129,  628,  368,  }, /* xun ei => xu nei */
+    { 644,  0,    641,  359,  }, /* yan a => ya na */
+    { 644,  128,  641,  366,  }, /* yan e => ya ne */
+    { 644,  129,  641,  368,  }, /* yan ei => ya nei */
+    { 645,  2,    644,  163,  }, /* yang ai => yan gai */
+    { 645,  4,    644,  165,  }, /* yang an => yan gan */
+    { 645,  5,    644,  166,  }, /* yang ang => yan gang */
+    { 645,  6,    644,  167,  }, /* yang ao => yan gao */
+    { 645,  128,  644,  168,  }, /* yang e => yan ge */
+    { 645,  129,  644,  170,  }, /* yang ei => yan gei */
+    { 645,  402,  644,  178,  }, /* yang ou => yan gou */
+    { 651,  0,    648,  359,  }, /* yin a => yi na */
+    { 651,  2,    648,  361,  }, /* yin ai => yi nai */
+    { 651,  4,    648,  363,  }, /* yin an => yi nan */
+    { 651,  5,    648,  364,  }, /* yin ang => yi nang */
+    { 651,  6,    648,  365,  }, /* yin ao => yi nao */
+    { 651,  129,  648,  368,  }, /* yin ei => yi nei */
+    { 652,  2,    651,  163,  }, /* ying ai => yin gai */
+    { 652,  5,    651,  166,  }, /* ying ang => yin gang */
+    { 652,  6,    651,  167,  }, /* ying ao => yin gao */
+    { 652,  129,  651,  170,  }, /* ying ei => yin gei */
+    { 652,  130,  651,  172,  }, /* ying en => yin gen */
+    { 652,  402,  651,  178,  }, /* ying ou => yin gou */
+    { 656,  0,    653,  359,  }, /* yon a => yo na */
+    { 656,  2,    653,  361,  }, /* yon ai => yo nai */
+    { 656,  4,    653,  363,  }, /* yon an => yo nan */
+    { 656,  5,    653,  364,  }, /* yon ang => yo nang */
+    { 656,  6,    653,  365,  }, /* yon ao => yo nao */
+    { 656,  128,  653,  366,  }, /* yon e => yo ne */
+    { 656,  129,  653,  368,  }, /* yon ei => yo nei */
+    { 656,  130,  653,  370,  }, /* yon en => yo nen */
+    { 656,  402,  653,  391,  }, /* yon ou => yo nou */
+    { 661,  0,    660,  161,  }, /* yuang a => yuan ga */
+    { 661,  2,    660,  163,  }, /* yuang ai => yuan gai */
+    { 661,  4,    660,  165,  }, /* yuang an => yuan gan */
+    { 661,  5,    660,  166,  }, /* yuang ang => yuan gang */
+    { 661,  6,    660,  167,  }, /* yuang ao => yuan gao */
+    { 661,  128,  660,  168,  }, /* yuang e => yuan ge */
+    { 661,  129,  660,  170,  }, /* yuang ei => yuan gei */
+    { 661,  130,  660,  172,  }, /* yuang en => yuan gen */
+    { 661,  402,  660,  178,  }, /* yuang ou => yuan gou */
+    { 662,  459,  659,  131,  }, /* yue r => yu er */
+    { 663,  0,    662,  359,  }, /* yuen a => yue na */
+    { 663,  2,    662,  361,  }, /* yuen ai => yue nai */
+    { 663,  4,    662,  363,  }, /* yuen an => yue nan */
+    { 663,  5,    662,  364,  }, /* yuen ang => yue nang */
+    { 663,  6,    662,  365,  }, /* yuen ao => yue nao */
+    { 663,  128,  662,  366,  }, /* yuen e => yue ne */
+    { 663,  129,  662,  368,  }, /* yuen ei => yue nei */
+    { 663,  130,  662,  370,  }, /* yuen en => yue nen */
+    { 663,  402,  662,  391,  }, /* yuen ou => yue nou */
+    { 664,  0,    659,  359,  }, /* yun a => yu na */
+    { 664,  2,    659,  361,  }, /* yun ai => yu nai */
+    { 664,  4,    659,  363,  }, /* yun an => yu nan */
+    { 664,  5,    659,  364,  }, /* yun ang => yu nang */
+    { 664,  6,    659,  365,  }, /* yun ao => yu nao */
+    { 664,  128,  659,  366,  }, /* yun e => yu ne */
+    { 664,  129,  659,  368,  }, /* yun ei => yu nei */
+    { 676,  0,    672,  359,  }, /* zan a => za na */
+    { 676,  4,    672,  363,  }, /* zan an => za nan */
+    { 676,  5,    672,  364,  }, /* zan ang => za nang */
+    { 676,  6,    672,  365,  }, /* zan ao => za nao */
+    { 676,  128,  672,  366,  }, /* zan e => za ne */
+    { 676,  129,  672,  368,  }, /* zan ei => za nei */
+    { 677,  4,    676,  165,  }, /* zang an => zan gan */
+    { 677,  5,    676,  166,  }, /* zang ang => zan gang */
+    { 677,  6,    676,  167,  }, /* zang ao => zan gao */
+    { 677,  128,  676,  168,  }, /* zang e => zan ge */
+    { 677,  129,  676,  170,  }, /* zang ei => zan gei */
+    { 677,  130,  676,  172,  }, /* zang en => zan gen */
+    { 677,  402,  676,  178,  }, /* zang ou => zan gou */
+    { 683,  0,    679,  359,  }, /* zen a => ze na */
+    { 683,  4,    679,  363,  }, /* zen an => ze nan */
+    { 683,  6,    679,  365,  }, /* zen ao => ze nao */
+    { 683,  128,  679,  366,  }, /* zen e => ze ne */
+    { 683,  129,  679,  368,  }, /* zen ei => ze nei */
+    { 684,  2,    683,  163,  }, /* zeng ai => zen gai */
+    { 684,  4,    683,  165,  }, /* zeng an => zen gan */
+    { 684,  5,    683,  166,  }, /* zeng ang => zen gang */
+    { 684,  6,    683,  167,  }, /* zeng ao => zen gao */
+    { 684,  129,  683,  170,  }, /* zeng ei => zen gei */
+    { 684,  130,  683,  172,  }, /* zeng en => zen gen */
+    { 684,  402,  683,  178,  }, /* zeng ou => zen gou */
+    { 690,  129,  686,  368,  }, /* zhan ei => zha nei */
+    { 691,  4,    690,  165,  }, /* zhang an => zhan gan */
+    { 691,  5,    690,  166,  }, /* zhang ang => zhan gang */
+    { 691,  6,    690,  167,  }, /* zhang ao => zhan gao */
+    { 691,  128,  690,  168,  }, /* zhang e => zhan ge */
+    { 691,  129,  690,  170,  }, /* zhang ei => zhan gei */
+    { 691,  130,  690,  172,  }, /* zhang en => zhan gen */
+    { 691,  402,  690,  178,  }, /* zhang ou => zhan gou */
+    { 697,  0,    693,  359,  }, /* zhen a => zhe na */
+    { 697,  4,    693,  363,  }, /* zhen an => zhe nan */
+    { 697,  5,    693,  364,  }, /* zhen ang => zhe nang */
+    { 697,  6,    693,  365,  }, /* zhen ao => zhe nao */
+    { 697,  128,  693,  366,  }, /* zhen e => zhe ne */
+    { 697,  129,  693,  368,  }, /* zhen ei => zhe nei */
+    { 698,  2,    697,  163,  }, /* zheng ai => zhen gai */
+    { 698,  4,    697,  165,  }, /* zheng an => zhen gan */
+    { 698,  5,    697,  166,  }, /* zheng ang => zhen gang */
+    { 698,  6,    697,  167,  }, /* zheng ao => zhen gao */
+    { 698,  128,  697,  168,  }, /* zheng e => zhen ge */
+    { 698,  129,  697,  170,  }, /* zheng ei => zhen gei */
+    { 698,  130,  697,  172,  }, /* zheng en => zhen gen */
+    { 698,  402,  697,  178,  }, /* zheng ou => zhen gou */
+    { 710,  6,    706,  365,  }, /* zhuan ao => zhua nao */
+    { 710,  128,  706,  366,  }, /* zhuan e => zhua ne */
+    { 710,  129,  706,  368,  }, /* zhuan ei => zhua nei */
+    { 711,  2,    710,  163,  }, /* zhuang ai => zhuan gai */
+    { 711,  4,    710,  165,  }, /* zhuang an => zhuan gan */
+    { 711,  5,    710,  166,  }, /* zhuang ang => zhuan gang */
+    { 711,  6,    710,  167,  }, /* zhuang ao => zhuan gao */
+    { 711,  128,  710,  168,  }, /* zhuang e => zhuan ge */
+    { 711,  129,  710,  170,  }, /* zhuang ei => zhuan gei */
+    { 711,  130,  710,  172,  }, /* zhuang en => zhuan gen */
+    { 711,  402,  710,  178,  }, /* zhuang ou => zhuan gou */
+    { 715,  0,    705,  359,  }, /* zhun a => zhu na */
+    { 715,  4,    705,  363,  }, /* zhun an => zhu nan */
+    { 715,  5,    705,  364,  }, /* zhun ang => zhu nang */
+    { 715,  6,    705,  365,  }, /* zhun ao => zhu nao */
+    { 715,  128,  705,  366,  }, /* zhun e => zhu ne */
+    { 715,  129,  705,  368,  }, /* zhun ei => zhu nei */
+    { 727,  0,    726,  161,  }, /* zuang a => zuan ga */
+    { 727,  2,    726,  163,  }, /* zuang ai => zuan gai */
+    { 727,  4,    726,  165,  }, /* zuang an => zuan gan */
+    { 727,  5,    726,  166,  }, /* zuang ang => zuan gang */
+    { 727,  6,    726,  167,  }, /* zuang ao => zuan gao */
+    { 727,  128,  726,  168,  }, /* zuang e => zuan ge */
+    { 727,  129,  726,  170,  }, /* zuang ei => zuan gei */
+    { 727,  130,  726,  172,  }, /* zuang en => zuan gen */
+    { 727,  402,  726,  178,  }, /* zuang ou => zuan gou */
+    { 731,  0,    723,  359,  }, /* zun a => zu na */
+    { 731,  4,    723,  363,  }, /* zun an => zu nan */
+    { 731,  5,    723,  364,  }, /* zun ang => zu nang */
+    { 731,  6,    723,  365,  }, /* zun ao => zu nao */
+    { 731,  128,  723,  366,  }, /* zun e => zu ne */
+    { 731,  129,  723,  368,  }, /* zun ei => zu nei */
 };
 
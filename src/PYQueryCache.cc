@@ -0,0 +1,139 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+#include "PYQueryCache.h"
+#include <algorithm>
+
+namespace PY {
+
+QueryCache::QueryCache (guint max_phrases)
+    : m_size (0),
+      m_max_phrases (max_phrases),
+      m_hits (0),
+      m_misses (0)
+{
+}
+
+inline void
+QueryCache::makeKey (const LexiconSyllable *syllables, guint len)
+{
+    m_key.clear ();
+    for (guint i = 0; i < len; i++) {
+        const LexiconSyllable & s = syllables[i];
+        m_key += (gchar) s.n_sheng;
+        m_key += (gchar) s.sheng[0];
+        m_key += (gchar) (s.n_sheng > 1 ? s.sheng[1] : 0);
+        m_key += (gchar) (s.n_sheng > 2 ? s.sheng[2] : 0);
+        m_key += (gchar) s.n_yun;
+        m_key += (gchar) (s.n_yun > 0 ? s.yun[0] : 0);
+        m_key += (gchar) (s.n_yun > 1 ? s.yun[1] : 0);
+    }
+}
+
+const PhraseArray *
+QueryCache::lookup (const LexiconSyllable   *syllables,
+                    guint                    len,
+                    gboolean               & complete)
+{
+    makeKey (syllables, len);
+
+    EntryMap::iterator it = m_index.find (m_key);
+    if (it == m_index.end ()) {
+        m_misses ++;
+        return NULL;
+    }
+
+    m_hits ++;
+    /* move it to the front */
+    m_entries.splice (m_entries.begin (), m_entries, it->second);
+    complete = it->second->complete;
+    return &it->second->phrases;
+}
+
+const PhraseArray *
+QueryCache::insert (const LexiconSyllable   *syllables,
+                    guint                    len,
+                    PhraseArray            & phrases,
+                    gboolean                 complete)
+{
+    makeKey (syllables, len);
+
+    EntryMap::iterator it = m_index.find (m_key);
+    if (it != m_index.end ())
+        erase (it->second);
+
+    /* an entry costs one phrase even if it is empty */
+    guint size = phrases.size () + 1;
+    while (!m_entries.empty () && m_size + size > m_max_phrases)
+        erase (--m_entries.end ());
+
+    m_entries.push_front (Entry ());
+    Entry & entry = m_entries.front ();
+    entry.key = m_key;
+    std::copy (syllables, syllables + len, entry.syllables);
+    entry.len = len;
+    entry.phrases.swap (phrases);
+    entry.complete = complete;
+
+    m_index[m_key] = m_entries.begin ();
+    m_size += size;
+
+    return &entry.phrases;
+}
+
+void
+QueryCache::erase (EntryList::iterator it)
+{
+    m_size -= it->phrases.size () + 1;
+    m_index.erase (it->key);
+    m_entries.erase (it);
+}
+
+void
+QueryCache::invalidate (const Phrase & phrase)
+{
+    EntryList::iterator it = m_entries.begin ();
+    while (it != m_entries.end ()) {
+        EntryList::iterator next = it;
+        ++next;
+
+        if (it->len == phrase.len) {
+            guint i;
+            for (i = 0; i < phrase.len; i++) {
+                if (!it->syllables[i].accepts (phrase.pinyin_id[i].sheng,
+                                               phrase.pinyin_id[i].yun))
+                    break;
+            }
+            if (i == phrase.len)
+                erase (it);
+        }
+        it = next;
+    }
+}
+
+void
+QueryCache::clear (void)
+{
+    m_entries.clear ();
+    m_index.clear ();
+    m_size = 0;
+}
+
+};
@@ -0,0 +1,80 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+#ifndef __PY_QUERY_CACHE_H_
+#define __PY_QUERY_CACHE_H_
+
+#include <list>
+#include <map>
+#include <string>
+#include "PYLexicon.h"
+#include "PYPhraseArray.h"
+
+namespace PY {
+
+/* LRU cache of ranked query results, keyed by the ids accepted for
+ * each syllable. Fuzzy options are already expanded in the key. */
+class QueryCache {
+public:
+    QueryCache (guint max_phrases);
+
+    /* returns NULL if the syllables are not cached */
+    const PhraseArray *lookup (const LexiconSyllable   *syllables,
+                               guint                    len,
+                               gboolean               & complete);
+    /* takes the content of phrases */
+    const PhraseArray *insert (const LexiconSyllable   *syllables,
+                               guint                    len,
+                               PhraseArray            & phrases,
+                               gboolean                 complete);
+    /* drops all results the phrase could be part of */
+    void invalidate (const Phrase & phrase);
+    void clear (void);
+
+    guint hits (void) const { return m_hits; }
+    guint misses (void) const { return m_misses; }
+
+private:
+    struct Entry {
+        std::string key;
+        LexiconSyllable syllables[MAX_PHRASE_LEN];
+        guint len;
+        PhraseArray phrases;
+        gboolean complete;
+    };
+    typedef std::list<Entry> EntryList;
+    typedef std::map<std::string, EntryList::iterator> EntryMap;
+
+    void makeKey (const LexiconSyllable *syllables, guint len);
+    void erase (EntryList::iterator it);
+
+private:
+    EntryList m_entries;        /* most recently used first */
+    EntryMap m_index;
+    std::string m_key;
+    guint m_size;               /* number of cached phrases */
+    guint m_max_phrases;
+    guint m_hits;
+    guint m_misses;
+};
+
+};
+
+#endif
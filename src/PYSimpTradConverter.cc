@@ -25,24 +25,26 @@
 
 #include "PYSimpTradConverter.h"
 
+#include <cstring>
 #ifdef HAVE_OPENCC
+#  include <algorithm>
+#  include <vector>
 #  include <opencc.h>
-#else
-#  include <cstring>
-#  include <cstdlib>
 #endif
 
 #include "PYTypes.h"
 #include "PYString.h"
+#include "PYPhraseArray.h"
 
 namespace PY {
 
 #ifdef HAVE_OPENCC
 
+/* An OpenCC handle with its buffers. The buffers only grow, so the
+ * conversions are done without allocation once they are large enough */
 class opencc {
-    static const int BUFFER_SIZE = 64;
 public:
-    opencc (void)
+    opencc (void) : m_n_texts (0)
     {
         m_od = opencc_open (OPENCC_DEFAULT_CONFIG_SIMP_TO_TRAD);
         g_assert (m_od != NULL);
@@ -53,125 +55,256 @@ public:
         opencc_close(m_od);
     }
 
-    void convert (const gchar *in, String &out)
+    /* adds a text to convert, they are separated by '\n' */
+    void add (const gchar *text)
+    {
+        for (const gchar *p = text; *p != '\0'; p = g_utf8_next_char (p))
+            m_in.push_back (g_utf8_get_char (p));
+        m_in.push_back ('\n');
+        m_n_texts ++;
+    }
+
+    /* converts the texts added with one call, out gets each result
+     * followed by '\0' */
+    void convert (String &out)
+    {
+        guint begin = out.size ();
+
+        if (G_UNLIKELY (append (convert (0, m_in.size ()), out) != m_n_texts)) {
+            /* a separator is lost, convert them one by one */
+            out.truncate (begin);
+            for (guint i = 0, j = 0; j < m_in.size (); j++) {
+                if (m_in[j] != '\n')
+                    continue;
+                if (append (convert (i, j + 1 - i), out) == 0)
+                    out << '\0';
+                i = j + 1;
+            }
+        }
+
+        m_in.clear ();
+        m_n_texts = 0;
+    }
+
+    /* a buffer for the results to be copied out of order */
+    String & scratch (void) { return m_scratch; }
+
+private:
+    /* converts m_in[begin..begin + n) to m_out, and returns the length of
+     * the result */
+    guint convert (guint begin, guint n)
     {
-        glong n_char;
-        gunichar *in_ucs4 = g_utf8_to_ucs4_fast (in, -1, &n_char);
+        ucs4_t *pinbuf = (ucs4_t *) &m_in[begin];
+        size_t inbuf_left = n;
+        guint len = 0;
 
-        ucs4_t *pinbuf = (ucs4_t *)in_ucs4;
-        size_t inbuf_left = n_char;
         while (inbuf_left != 0) {
-            ucs4_t *poutbuf = (ucs4_t *)m_buffer;
-            size_t outbuf_left = BUFFER_SIZE;
-            size_t retval = opencc_convert(m_od, &pinbuf, &inbuf_left, &poutbuf, &outbuf_left);
-            if (retval == (size_t) -1) {
+            if (m_out.size () < len + inbuf_left * 2)
+                m_out.resize (len + inbuf_left * 2);
+
+            ucs4_t *poutbuf = (ucs4_t *) &m_out[len];
+            size_t outbuf_left = m_out.size () - len;
+            size_t inbuf_before = inbuf_left;
+            size_t retval = opencc_convert (m_od, &pinbuf, &inbuf_left, &poutbuf, &outbuf_left);
+            guint converted = poutbuf - (ucs4_t *) &m_out[len];
+            len += converted;
+            if (retval == (size_t) -1 ||
+                (converted == 0 && inbuf_left == inbuf_before)) {
                 /* append left chars in pinbuf */
                 g_warning ("opencc_convert return failed");
-                out << (gunichar *) pinbuf;
+                if (m_out.size () < len + inbuf_left)
+                    m_out.resize (len + inbuf_left);
+                std::copy (pinbuf, pinbuf + inbuf_left, (ucs4_t *) &m_out[len]);
+                len += inbuf_left;
                 break;
             }
-            *poutbuf = L'\0';
-            out << m_buffer;
         }
-        g_free (in_ucs4);
+        return len;
+    }
+
+    /* appends m_out[0..len) to out in utf8, with '\0' for each separator,
+     * and returns the number of separators */
+    guint append (guint len, String &out)
+    {
+        guint n = 0;
+        for (guint i = 0; i < len; i++) {
+            if (m_out[i] == '\n') {
+                out << '\0';
+                n ++;
+            }
+            else {
+                gchar buf[6];
+                out.append (buf, g_unichar_to_utf8 (m_out[i], buf));
+            }
+        }
+        return n;
     }
+
 private:
     opencc_t m_od;
-    gunichar m_buffer[BUFFER_SIZE + 1];
+    std::vector<gunichar> m_in;
+    std::vector<gunichar> m_out;
+    String m_scratch;
+    guint m_n_texts;
 };
 
-void
-SimpTradConverter::simpToTrad (const gchar *in, String &out)
+static void
+opencc_free (gpointer data)
 {
-    static opencc opencc;
-    opencc.convert (in, out);
+    delete (opencc *) data;
 }
 
-#else
+/* each thread has its own handle and buffers */
+static opencc &
+get_opencc (void)
+{
+    static GPrivate key = G_PRIVATE_INIT (opencc_free);
+    opencc *od = (opencc *) g_private_get (&key);
+    if (G_UNLIKELY (od == NULL)) {
+        od = new opencc ();
+        g_private_set (&key, od);
+    }
+    return *od;
+}
 
-static gint _xcmp (const gchar *p1, const gchar *p2, const gchar *str)
+void
+SimpTradConverter::simpToTrad (const gchar *in, String &out)
 {
-    for (;;) {
-        // both reach end
-        if (p1 == p2 && *str == '\0')
-            return 0;
-        // p1 reaches end
-        if (p1 == p2)
-            return -1;
-        // str reaches end
-        if (*str == '\0')
-            return 1;
-
-        if (*p1 < *str)
-            return -1;
-        if (*p1 > *str)
-            return 1;
-
-        p1 ++; str ++;
-    };
+    opencc & od = get_opencc ();
+    od.add (in);
+    od.convert (out);
+    /* drop the '\0' after the result */
+    out.truncate (out.size () - 1);
 }
 
-static gint _cmp (gconstpointer p1, gconstpointer p2)
+void
+SimpTradConverter::simpToTrad (const PhraseArray     &phrases,
+                               guint                  begin,
+                               guint                  end,
+                               String                &out,
+                               std::vector<guint>    &offsets)
 {
-    const gchar **pp = (const gchar **) p1;
-    const gchar **s2 = (const gchar **) p2;
+    opencc & od = get_opencc ();
+    String & converted = od.scratch ();
+    gboolean any = FALSE;
+
+    /* only the phrases without a traditional form go to opencc */
+    for (guint i = begin; i < end; i++) {
+        if (phrases[i].trad == NULL) {
+            od.add (phrases[i].phrase);
+            any = TRUE;
+        }
+    }
+
+    converted.clear ();
+    if (any)
+        od.convert (converted);
 
-    return _xcmp (pp[0], pp[1], s2[0]);
+    const gchar *p = converted;
+    offsets.clear ();
+    for (guint i = begin; i < end; i++) {
+        offsets.push_back (out.size ());
+        if (phrases[i].trad != NULL) {
+            out << phrases[i].trad;
+        }
+        else {
+            out << p;
+            p += std::strlen (p) + 1;
+        }
+        out << '\0';
+    }
 }
 
+#else
+
+/* a cell of the double-array trie, see scripts/update-simptrad-table.py */
+struct SimpTradTrieNode {
+    gint32 base;
+    guint32 check;
+};
+
 #include "PYSimpTradConverterTable.h"
 
+/* returns the end of the longest simplified text from p, and sets trad
+ * to its traditional text, or returns p if none is found */
+static const gchar *
+match (const gchar *p, const gchar *end, const gchar * & trad)
+{
+    const gchar *match_end = p;
+    guint32 state = 1;
+
+    for (; p < end; p++) {
+        guint32 t = simp_to_trad_trie[state].base + (guchar) *p + 1;
+        if (t >= G_N_ELEMENTS (simp_to_trad_trie) ||
+            simp_to_trad_trie[t].check != state)
+            break;
+        state = t;
+
+        t = simp_to_trad_trie[state].base;
+        if (t < G_N_ELEMENTS (simp_to_trad_trie) &&
+            simp_to_trad_trie[t].check == state) {
+            match_end = p + 1;
+            trad = simp_to_trad_strings - 1 - simp_to_trad_trie[t].base;
+        }
+    }
+    return match_end;
+}
+
 void
 SimpTradConverter::simpToTrad (const gchar *in, String &out)
 {
+    const gchar *p;
     const gchar *pend;
-    const gchar *pp[2];
-    glong len;
-    glong begin;
 
     if (!g_utf8_validate (in, -1 , NULL)) {
         g_warning ("\%s\" is not an utf8 string!", in);
         g_assert_not_reached ();
     }
 
-    begin = 0;
     pend = in + std::strlen (in);
-    len = g_utf8_strlen (in, -1);   // length in charactoers
-    pp[0] = in;
-
-    while (pp[0] != pend) {
-        glong slen  = std::min (len - begin, (glong) SIMP_TO_TRAD_MAX_LEN); // the length of sub string in character
-        pp[1] = g_utf8_offset_to_pointer (pp[0], slen);    // the end of sub string
-
-        for (;;) {
-            const gchar **result;
-            result = (const gchar **) std::bsearch (pp, simp_to_trad,
-                                            G_N_ELEMENTS (simp_to_trad), sizeof (simp_to_trad[0]),
-                                            _cmp);
-
-            if (result != NULL) {
-                // found item in table,
-                // append the trad to out and adjust pointers
-                out << result[1];
-                pp[0] = pp[1];
-                begin += slen;
-                break;
-            }
 
-            if (slen == 1) {
-                // if only one character left,
-                // append origin character to out and adjust pointers
-                out.append (pp[0], pp[1] - pp[0]);
-                pp[0] = pp[1];
-                begin += 1;
-                break;
-            }
+    for (p = in; p < pend;) {
+        const gchar *trad;
+        const gchar *next = match (p, pend, trad);
 
-            // if more than on characters left,
-            // adjust pp[1] to previous character
-            pp[1] = g_utf8_prev_char (pp[1]);
-            slen--;
+        if (next != p) {
+            // found the longest text in table
+            out << trad;
         }
+        else {
+            // append the origin character
+            next = g_utf8_next_char (p);
+            out.append (p, next - p);
+        }
+        p = next;
+    }
+}
+#endif
+
+void
+SimpTradConverter::simpToTrad (const Phrase &phrase, String &out)
+{
+    /* the lexicon has the traditional forms of its phrases */
+    if (phrase.trad != NULL) {
+        out << phrase.trad;
+        return;
+    }
+    simpToTrad (phrase.phrase, out);
+}
+
+#ifndef HAVE_OPENCC
+void
+SimpTradConverter::simpToTrad (const PhraseArray     &phrases,
+                               guint                  begin,
+                               guint                  end,
+                               String                &out,
+                               std::vector<guint>    &offsets)
+{
+    offsets.clear ();
+    for (guint i = begin; i < end; i++) {
+        offsets.push_back (out.size ());
+        simpToTrad (phrases[i], out);
+        out << '\0';
     }
 }
 #endif
@@ -22,6 +22,8 @@
 #define __PY_SIMP_TRAD_CONVERTER_H_
 
 #include <glib.h>
+#include <vector>
+#include "PYPhraseArray.h"
 
 namespace PY {
 
@@ -30,6 +32,15 @@ class String;
 class SimpTradConverter {
 public:
     static void simpToTrad (const gchar *in, String &out);
+    /* uses the traditional form of phrase if the lexicon has it */
+    static void simpToTrad (const Phrase &phrase, String &out);
+    /* converts phrases[begin..end) in one go, out gets each result
+     * followed by '\0', and offsets the start of each in out */
+    static void simpToTrad (const PhraseArray     &phrases,
+                            guint                  begin,
+                            guint                  end,
+                            String                &out,
+                            std::vector<guint>    &offsets);
 };
 
 };
@@ -1,7406 +1,14620 @@
-static const gchar *simp_to_trad[][2] = {
-    { "〇余", "〇餘" },
-    { "〇只", "〇隻" },
-    { "一个准", "一個準" },
-    { "一争两丑", "一爭兩醜" },
-    { "一伙", "一夥" },
-    { "一余", "一餘" },
-    { "一冲", "一衝" },
-    { "一准", "一準" },
-    { "一出子", "一齣子" },
-    { "一划", "一划" },
-    { "一别头", "一彆頭" },
-    { "一发千钧", "一髮千鈞" },
-    { "一只", "一隻" },
-    { "一吊", "一弔" },
-    { "一哄而散", "一鬨而散" },
-    { "一地里", "一地裡" },
-    { "一天钟", "一天鐘" },
-    { "一头长发", "一頭長髮" },
-    { "一干二净", "一乾二淨" },
-    { "一并", "一併" },
-    { "一扎", "一紮" },
-    { "一树百获", "一樹百穫" },
-    { "一物克一物", "一物剋一物" },
-    { "一锅面", "一鍋麵" },
-    { "七余", "七餘" },
-    { "七只", "七隻" },
-    { "七情六欲", "七情六慾" },
-    { "七扎", "七紮" },
-    { "万", "萬" },
-    { "万余", "萬餘" },
-    { "万俟", "万俟" },
-    { "万历", "萬曆" },
-    { "万只", "萬隻" },
-    { "万年历表", "萬年曆錶" },
-    { "万扎", "萬紮" },
-    { "万旗", "万旗" },
-    { "万签插架", "萬籤插架" },
-    { "三余", "三餘" },
-    { "三准", "三準" },
-    { "三只", "三隻" },
-    { "三复", "三複" },
-    { "三征七辟", "三徵七辟" },
-    { "三扎", "三紮" },
-    { "三统历", "三統曆" },
-    { "上梁", "上樑" },
-    { "上签", "上籤" },
-    { "上药", "上藥" },
-    { "上课钟", "上課鐘" },
-    { "下仑路", "下崙路" },
-    { "下梁", "下樑" },
-    { "下签", "下籤" },
-    { "下药", "下藥" },
-    { "下课钟", "下課鐘" },
-    { "不丑", "不醜" },
-    { "不克制", "不剋制" },
-    { "不准", "不準" },
-    { "不占", "不佔" },
-    { "不吊", "不弔" },
-    { "不寒而栗", "不寒而慄" },
-    { "不干", "不幹" },
-    { "不干不净", "不乾不淨" },
-    { "不托", "不託" },
-    { "不斗", "不鬥" },
-    { "不药而愈", "不藥而癒" },
-    { "不谷", "不穀" },
-    { "不通吊庆", "不通弔慶" },
-    { "不采", "不採" },
-    { "不锈钢", "不鏽鋼" },
-    { "不食干腊", "不食乾腊" },
-    { "与", "與" },
-    { "与克制", "與剋制" },
-    { "丑丑", "醜醜" },
-    { "丑丫头", "醜丫頭" },
-    { "丑事", "醜事" },
-    { "丑于", "醜於" },
-    { "丑人", "醜人" },
-    { "丑侪", "醜儕" },
-    { "丑八怪", "醜八怪" },
-    { "丑剌剌", "醜剌剌" },
-    { "丑剧", "醜劇" },
-    { "丑化", "醜化" },
-    { "丑史", "醜史" },
-    { "丑名", "醜名" },
-    { "丑咤", "醜吒" },
-    { "丑地", "醜地" },
-    { "丑声", "醜聲" },
-    { "丑头怪脸", "醜頭怪臉" },
-    { "丑夷", "醜夷" },
-    { "丑女", "醜女" },
-    { "丑奴儿", "醜奴兒" },
-    { "丑妇", "醜婦" },
-    { "丑媳", "醜媳" },
-    { "丑小鸭", "醜小鴨" },
-    { "丑巴怪", "醜巴怪" },
-    { "丑徒", "醜徒" },
-    { "丑态", "醜態" },
-    { "丑恶", "醜惡" },
-    { "丑末", "醜末" },
-    { "丑杂", "醜雜" },
-    { "丑样", "醜樣" },
-    { "丑死", "醜死" },
-    { "丑比", "醜比" },
-    { "丑毙了", "醜斃了" },
-    { "丑沮", "醜沮" },
-    { "丑男", "醜男" },
-    { "丑类", "醜類" },
-    { "丑脸", "醜臉" },
-    { "丑虏", "醜虜" },
-    { "丑行", "醜行" },
-    { "丑言", "醜言" },
-    { "丑诋", "醜詆" },
-    { "丑话", "醜話" },
-    { "丑语", "醜語" },
-    { "丑贼生", "醜賊生" },
-    { "丑辞", "醜辭" },
-    { "丑辱", "醜辱" },
-    { "丑逆", "醜逆" },
-    { "丑闻", "醜聞" },
-    { "丑陋", "醜陋" },
-    { "专", "專" },
-    { "专注", "專註" },
-    { "专辑里", "專輯裡" },
-    { "世界杯", "世界盃" },
-    { "世界里", "世界裡" },
-    { "世纪钟", "世紀鐘" },
-    { "业", "業" },
-    { "业余", "業餘" },
-    { "丛", "叢" },
-    { "东", "東" },
-    { "东冲西突", "東衝西突" },
-    { "东周钟", "東周鐘" },
-    { "东岳", "東嶽" },
-    { "东游", "東遊" },
-    { "丝", "絲" },
-    { "丝制", "絲製" },
-    { "丝发", "絲髮" },
-    { "丝恩发怨", "絲恩髮怨" },
-    { "丢", "丟" },
-    { "丢丑", "丟醜" },
-    { "两", "兩" },
-    { "两余", "兩餘" },
-    { "两只", "兩隻" },
-    { "两天晒网", "兩天晒網" },
-    { "两扎", "兩紮" },
-    { "两虎共斗", "兩虎共鬥" },
-    { "两鼠斗穴", "兩鼠鬥穴" },
-    { "严", "嚴" },
-    { "严云农", "嚴云農" },
-    { "丧", "喪" },
-    { "丧钟", "喪鐘" },
-    { "个", "個" },
-    { "个中原因", "箇中原因" },
-    { "个中奥妙", "箇中奧妙" },
-    { "个中奥秘", "箇中奧秘" },
-    { "个中好手", "箇中好手" },
-    { "个中强手", "箇中強手" },
-    { "个中消息", "箇中消息" },
-    { "个中滋味", "箇中滋味" },
-    { "个中玄机", "箇中玄機" },
-    { "个中理由", "箇中理由" },
-    { "个中讯息", "箇中訊息" },
-    { "个中资讯", "箇中資訊" },
-    { "个中高手", "箇中高手" },
-    { "个旧", "箇舊" },
-    { "个里", "個裡" },
-    { "个钟", "個鐘" },
-    { "个钟表", "個鐘錶" },
-    { "中仑", "中崙" },
-    { "中型钟", "中型鐘" },
-    { "中岳", "中嶽" },
-    { "中文里", "中文裡" },
-    { "中签", "中籤" },
-    { "中药", "中藥" },
-    { "丰", "豐" },
-    { "丰仪", "丰儀" },
-    { "丰儀", "丰儀" },
-    { "丰南", "丰南" },
-    { "丰台", "丰台" },
-    { "丰姿", "丰姿" },
-    { "丰容", "丰容" },
-    { "丰度", "丰度" },
-    { "丰情", "丰情" },
-    { "丰标", "丰標" },
-    { "丰標不凡", "丰標不凡" },
-    { "丰神", "丰神" },
-    { "丰茸", "丰茸" },
-    { "丰采", "丰采" },
-    { "丰韵", "丰韻" },
-    { "丰韻", "丰韻" },
-    { "临", "臨" },
-    { "临潼斗宝", "臨潼鬥寶" },
-    { "丸药", "丸藥" },
-    { "丹药", "丹藥" },
-    { "为", "為" },
-    { "为准", "為準" },
-    { "为着", "為著" },
-    { "主仆", "主僕" },
-    { "主干", "主幹" },
-    { "主钟曲线", "主鐘曲線" },
-    { "丽", "麗" },
-    { "举", "舉" },
-    { "么么小丑", "么麼小丑" },
-    { "义", "義" },
-    { "义仆", "義僕" },
-    { "义占", "義佔" },
-    { "义庄", "義莊" },
-    { "之余", "之餘" },
-    { "之征", "之徵" },
-    { "之托", "之託" },
-    { "之钟", "之鐘" },
-    { "乌", "烏" },
-    { "乌发", "烏髮" },
-    { "乌龙面", "烏龍麵" },
-    { "乐", "樂" },
-    { "乐器钟", "樂器鐘" },
-    { "乔", "喬" },
-    { "乔岳", "喬嶽" },
-    { "九世之仇", "九世之讎" },
-    { "九余", "九餘" },
-    { "九只", "九隻" },
-    { "九扎", "九紮" },
-    { "九谷", "九穀" },
-    { "也克制", "也剋制" },
-    { "习", "習" },
-    { "乡", "鄉" },
-    { "乡愿", "鄉愿" },
-    { "书", "書" },
-    { "书签", "書籤" },
-    { "买", "買" },
-    { "买凶", "買兇" },
-    { "乱", "亂" },
-    { "乱发", "亂髮" },
-    { "乱哄", "亂鬨" },
-    { "乾象历", "乾象曆" },
-    { "了克制", "了剋制" },
-    { "了望", "瞭望" },
-    { "了然", "瞭然" },
-    { "了若指掌", "瞭若指掌" },
-    { "争", "爭" },
-    { "争奇斗妍", "爭奇鬥妍" },
-    { "争奇斗异", "爭奇鬥異" },
-    { "争妍斗奇", "爭妍鬥奇" },
-    { "争斗", "爭鬥" },
-    { "争红斗紫", "爭紅鬥紫" },
-    { "事迹", "事迹" },
-    { "二仑", "二崙" },
-    { "二余", "二餘" },
-    { "二只", "二隻" },
-    { "二缶钟惑", "二缶鐘惑" },
-    { "于", "於" },
-    { "于丑", "於醜" },
-    { "于丹", "于丹" },
-    { "于于", "于于" },
-    { "于云鹤", "于雲鶴" },
-    { "于仁泰", "于仁泰" },
-    { "于从濂", "于從濂" },
-    { "于仲文", "于仲文" },
-    { "于会泳", "于會泳" },
-    { "于伟国", "于偉國" },
-    { "于余曲折", "于餘曲折" },
-    { "于佳卉", "于佳卉" },
-    { "于偉國", "于偉國" },
-    { "于光新", "于光新" },
-    { "于光远", "于光遠" },
-    { "于光遠", "于光遠" },
-    { "于克制", "於剋制" },
-    { "于克勒", "于克勒" },
-    { "于再清", "于再清" },
-    { "于冕", "于冕" },
-    { "于军", "于軍" },
-    { "于冠华", "于冠華" },
-    { "于凌奎", "于凌奎" },
-    { "于凌辰", "于凌辰" },
-    { "于凤桐", "于鳳桐" },
-    { "于凤至", "于鳳至" },
-    { "于勒", "于勒" },
-    { "于化虎", "于化虎" },
-    { "于占元", "于占元" },
-    { "于友泽", "于友澤" },
-    { "于双戈", "于雙戈" },
-    { "于台烟", "于台煙" },
-    { "于台煙", "于台煙" },
-    { "于右任", "于右任" },
-    { "于吉", "于吉" },
-    { "于和伟", "于和偉" },
-    { "于品海", "于品海" },
-    { "于国桢", "于國楨" },
-    { "于国治", "于國治" },
-    { "于國楨", "于國楨" },
-    { "于國治", "于國治" },
-    { "于坏", "於坏" },
-    { "于坚", "于堅" },
-    { "于堅", "于堅" },
-    { "于大宝", "于大寶" },
-    { "于大寶", "于大寶" },
-    { "于天仁", "于天仁" },
-    { "于天龙", "于天龍" },
-    { "于奇库杜克", "于奇庫杜克" },
-    { "于奇庫杜克", "于奇庫杜克" },
-    { "于姓", "于姓" },
-    { "于娜", "于娜" },
-    { "于娟", "于娟" },
-    { "于子千", "于子千" },
-    { "于孔兼", "于孔兼" },
-    { "于学忠", "于學忠" },
-    { "于學忠", "于學忠" },
-    { "于家堡", "于家堡" },
-    { "于寘", "于寘" },
-    { "于小伟", "于小偉" },
-    { "于小偉", "于小偉" },
-    { "于小彤", "于小彤" },
-    { "于小惠", "于小惠" },
-    { "于少保", "于少保" },
-    { "于尔岑", "于爾岑" },
-    { "于尔根", "于爾根" },
-    { "于尔里克", "于爾里克" },
-    { "于山", "于山" },
-    { "于帅", "于帥" },
-    { "于帥", "于帥" },
-    { "于幼军", "于幼軍" },
-    { "于幼軍", "于幼軍" },
-    { "于广洲", "于廣洲" },
-    { "于康震", "于康震" },
-    { "于廣洲", "于廣洲" },
-    { "于式枚", "于式枚" },
-    { "于归", "于歸" },
-    { "于征", "於徵" },
-    { "于從濂", "于從濂" },
-    { "于德海", "于德海" },
-    { "于志宁", "于志寧" },
-    { "于志寧", "于志寧" },
-    { "于忠肃集", "于忠肅集" },
-    { "于思", "于思" },
-    { "于慎行", "于慎行" },
-    { "于慧", "于慧" },
-    { "于成龍", "于成龍" },
-    { "于成龙", "于成龍" },
-    { "于振", "于振" },
-    { "于敏", "于敏" },
-    { "于斌", "于斌" },
-    { "于斯塔德", "于斯塔德" },
-    { "于斯达尔", "于斯達爾" },
-    { "于斯達爾", "于斯達爾" },
-    { "于明涛", "于明濤" },
-    { "于明濤", "于明濤" },
-    { "于是之", "于是之" },
-    { "于晨楠", "于晨楠" },
-    { "于晴", "于晴" },
-    { "于會泳", "于會泳" },
-    { "于来山", "于來山" },
-    { "于枫", "于楓" },
-    { "于树洁", "于樹潔" },
-    { "于根伟", "于根偉" },
-    { "于根偉", "于根偉" },
-    { "于格", "于格" },
-    { "于楓", "于楓" },
-    { "于樂", "于樂" },
-    { "于樹潔", "于樹潔" },
-    { "于欣", "于欣" },
-    { "于正升", "于正昇" },
-    { "于正昇", "于正昇" },
-    { "于正昌", "于正昌" },
-    { "于永波", "于永波" },
-    { "于汉超", "于漢超" },
-    { "于江震", "于江震" },
-    { "于波", "于波" },
-    { "于泽尔", "于澤爾" },
-    { "于洋", "于洋" },
-    { "于洪区", "于洪區" },
-    { "于洪區", "于洪區" },
-    { "于浩威", "于浩威" },
-    { "于海", "于海" },
-    { "于涛", "于濤" },
-    { "于湘兰", "于湘蘭" },
-    { "于湘蘭", "于湘蘭" },
-    { "于漢超", "于漢超" },
-    { "于澄", "于澄" },
-    { "于澤爾", "于澤爾" },
-    { "于濤", "于濤" },
-    { "于熙珍", "于熙珍" },
-    { "于爾岑", "于爾岑" },
-    { "于爾根", "于爾根" },
-    { "于爾里克", "于爾里克" },
-    { "于特森", "于特森" },
-    { "于玉立", "于玉立" },
-    { "于田", "于田" },
-    { "于禁", "于禁" },
-    { "于秀敏", "于秀敏" },
-    { "于立成", "于立成" },
-    { "于素秋", "于素秋" },
-    { "于美人", "于美人" },
-    { "于耘婕", "于耘婕" },
-    { "于若木", "于若木" },
-    { "于荣光", "于榮光" },
-    { "于荫霖", "于蔭霖" },
-    { "于蔭霖", "于蔭霖" },
-    { "于衡", "于衡" },
-    { "于西翰", "于西翰" },
-    { "于謙", "于謙" },
-    { "于谦", "于謙" },
-    { "于谨", "于謹" },
-    { "于貝爾", "于貝爾" },
-    { "于贈", "于贈" },
-    { "于贝尔", "于貝爾" },
-    { "于赠", "于贈" },
-    { "于越", "于越" },
-    { "于軍", "于軍" },
-    { "于远伟", "于遠偉" },
-    { "于道泉", "于道泉" },
-    { "于遠偉", "于遠偉" },
-    { "于都县", "于都縣" },
-    { "于都縣", "于都縣" },
-    { "于里察", "于里察" },
-    { "于阗", "于闐" },
-    { "于雙戈", "于雙戈" },
-    { "于震", "于震" },
-    { "于震后", "於震后" },
-    { "于靖", "于靖" },
-    { "于非闇", "于非闇" },
-    { "于韋斯屈萊", "于韋斯屈萊" },
-    { "于韦斯屈莱", "于韋斯屈萊" },
-    { "于風政", "于風政" },
-    { "于风政", "于風政" },
-    { "于飛島", "于飛島" },
-    { "于飞", "于飛" },
-    { "于鬯", "于鬯" },
-    { "于魁智", "于魁智" },
-    { "于鳳桐", "于鳳桐" },
-    { "于鳳至", "于鳳至" },
-    { "于默奥", "于默奧" },
-    { "于默奧", "于默奧" },
-    { "亏", "虧" },
-    { "云", "雲" },
-    { "云为", "云為" },
-    { "云乎", "云乎" },
-    { "云云", "云云" },
-    { "云何", "云何" },
-    { "云南白药", "雲南白藥" },
-    { "云尔", "云爾" },
-    { "云游", "雲遊" },
-    { "云為", "云為" },
-    { "云然", "云然" },
-    { "云笈七签", "雲笈七籤" },
-    { "云须", "雲鬚" },
-    { "五余", "五餘" },
-    { "五出", "五齣" },
-    { "五只", "五隻" },
-    { "五岳", "五嶽" },
-    { "五扎", "五紮" },
-    { "五行生克", "五行生剋" },
-    { "五谷", "五穀" },
-    { "井干摧败", "井榦摧敗" },
-    { "井里", "井裡" },
-    { "亚", "亞" },
-    { "亚美尼亚历", "亞美尼亞曆" },
-    { "交哄", "交鬨" },
-    { "交托", "交託" },
-    { "交游", "交遊" },
-    { "亦云", "亦云" },
-    { "亦庄亦谐", "亦莊亦諧" },
-    { "产", "產" },
-    { "亩", "畝" },
-    { "亮丑", "亮醜" },
-    { "亮钟", "亮鐘" },
-    { "亲", "親" },
-    { "亵", "褻" },
-    { "人云", "人云" },
-    { "人参", "人蔘" },
-    { "人欲", "人慾" },
-    { "人物志", "人物誌" },
-    { "亿", "億" },
-    { "亿余", "億餘" },
-    { "亿只", "億隻" },
-    { "什么", "什麼" },
-    { "什锦面", "什錦麵" },
-    { "仅", "僅" },
-    { "仆人", "僕人" },
-    { "仆仆", "僕僕" },
-    { "仆从", "僕從" },
-    { "仆使", "僕使" },
-    { "仆僮", "僕僮" },
-    { "仆吏", "僕吏" },
-    { "仆固怀恩", "僕固懷恩" },
-    { "仆夫", "僕夫" },
-    { "仆妇", "僕婦" },
-    { "仆姑", "僕姑" },
-    { "仆婢", "僕婢" },
-    { "仆射", "僕射" },
-    { "仆少", "僕少" },
-    { "仆役", "僕役" },
-    { "仆憎", "僕憎" },
-    { "仆欧", "僕歐" },
-    { "仆程", "僕程" },
-    { "仆虽罢驽", "僕雖罷駑" },
-    { "仇仇", "仇讎" },
-    { "仇問", "讎問" },
-    { "仇夷", "讎夷" },
-    { "仇校", "讎校" },
-    { "仇正", "讎正" },
-    { "仇隙", "讎隙" },
-    { "从", "從" },
-    { "从里到外", "從裡到外" },
-    { "从里向外", "從裡向外" },
-    { "仑", "侖" },
-    { "仑背", "崙背" },
-    { "仓", "倉" },
-    { "他克制", "他剋制" },
-    { "他钟", "他鐘" },
-    { "付托", "付託" },
-    { "仙后", "仙后" },
-    { "仙药", "仙藥" },
-    { "仪", "儀" },
-    { "仪范", "儀範" },
-    { "仪表", "儀錶" },
-    { "们", "們" },
-    { "们克制", "們剋制" },
-    { "仰药", "仰藥" },
-    { "件钟", "件鐘" },
-    { "价", "價" },
-    { "任何表", "任何錶" },
-    { "任何钟", "任何鐘" },
-    { "仿佛", "彷彿" },
-    { "仿制", "仿製" },
-    { "伊东怜", "伊東怜" },
-    { "伊于湖底", "伊于湖底" },
-    { "伊尔汗历表", "伊爾汗曆表" },
-    { "伊府面", "伊府麵" },
-    { "伊斯兰历", "伊斯蘭曆" },
-    { "伊斯兰教历", "伊斯蘭教曆" },
-    { "伊适杰", "伊適杰" },
-    { "伊郁", "伊鬱" },
-    { "伏几", "伏几" },
-    { "休征", "休徵" },
-    { "众", "眾" },
-    { "优", "優" },
-    { "优游", "優遊" },
-    { "伙众", "夥眾" },
-    { "伙伴", "夥伴" },
-    { "伙友", "夥友" },
-    { "伙同", "夥同" },
-    { "伙计", "夥計" },
-    { "会", "會" },
-    { "会占", "會佔" },
-    { "会吊", "會弔" },
-    { "会干", "會幹" },
-    { "会里", "會裡" },
-    { "伛", "傴" },
-    { "伞", "傘" },
-    { "伟", "偉" },
-    { "传", "傳" },
-    { "传位于四太子", "傳位于四太子" },
-    { "伤", "傷" },
-    { "伤痕累累", "傷痕纍纍" },
-    { "伥", "倀" },
-    { "伦", "倫" },
-    { "伧", "傖" },
-    { "伪", "偽" },
-    { "伪药", "偽藥" },
-    { "伫", "佇" },
-    { "伴游", "伴遊" },
-    { "但云", "但云" },
-    { "位准", "位準" },
-    { "低洼", "低洼" },
-    { "住扎", "住紮" },
-    { "体", "體" },
-    { "体范", "體範" },
-    { "何杰", "何杰" },
-    { "余〇", "餘〇" },
-    { "余一", "餘一" },
-    { "余七", "餘七" },
-    { "余三", "餘三" },
-    { "余下", "餘下" },
-    { "余业", "餘業" },
-    { "余九", "餘九" },
-    { "余事", "餘事" },
-    { "余二", "餘二" },
-    { "余五", "餘五" },
-    { "余人", "餘人" },
-    { "余众", "餘眾" },
-    { "余俗", "餘俗" },
-    { "余倍", "餘倍" },
-    { "余僇", "餘僇" },
-    { "余光", "餘光" },
-    { "余党", "餘黨" },
-    { "余八", "餘八" },
-    { "余六", "餘六" },
-    { "余兴", "餘興" },
-    { "余刃", "餘刃" },
-    { "余切", "餘切" },
-    { "余利", "餘利" },
-    { "余割", "餘割" },
-    { "余力", "餘力" },
-    { "余勇", "餘勇" },
-    { "余十", "餘十" },
-    { "余味", "餘味" },
-    { "余响", "餘響" },
-    { "余喘", "餘喘" },
-    { "余四", "餘四" },
-    { "余地", "餘地" },
-    { "余墨", "餘墨" },
-    { "余声", "餘聲" },
-    { "余外", "餘外" },
-    { "余妙", "餘妙" },
-    { "余姚", "餘姚" },
-    { "余威", "餘威" },
-    { "余子", "餘子" },
-    { "余存", "餘存" },
-    { "余孽", "餘孽" },
-    { "余庆", "餘慶" },
-    { "余弦", "餘弦" },
-    { "余思", "餘思" },
-    { "余悸", "餘悸" },
-    { "余数", "餘數" },
-    { "余明", "餘明" },
-    { "余映", "餘映" },
-    { "余晖", "餘暉" },
-    { "余暇", "餘暇" },
-    { "余杭", "餘杭" },
-    { "余杯", "餘杯" },
-    { "余桃", "餘桃" },
-    { "余桶", "餘桶" },
-    { "余款", "餘款" },
-    { "余步", "餘步" },
-    { "余殃", "餘殃" },
-    { "余毒", "餘毒" },
-    { "余气", "餘氣" },
-    { "余沥", "餘瀝" },
-    { "余波", "餘波" },
-    { "余波荡漾", "餘波盪漾" },
-    { "余泽", "餘澤" },
-    { "余温", "餘溫" },
-    { "余烈", "餘烈" },
-    { "余烬", "餘燼" },
-    { "余热", "餘熱" },
-    { "余珍", "餘珍" },
-    { "余生", "餘生" },
-    { "余窍", "餘竅" },
-    { "余粮", "餘糧" },
-    { "余绪", "餘緒" },
-    { "余缺", "餘缺" },
-    { "余罪", "餘罪" },
-    { "余羡", "餘羨" },
-    { "余膏", "餘膏" },
-    { "余荫", "餘蔭" },
-    { "余蓄", "餘蓄" },
-    { "余裕", "餘裕" },
-    { "余角", "餘角" },
-    { "余论", "餘論" },
-    { "余貾", "餘貾" },
-    { "余责", "餘責" },
-    { "余辉", "餘輝" },
-    { "余辜", "餘辜" },
-    { "余酲", "餘酲" },
-    { "余量", "餘量" },
-    { "余闰", "餘閏" },
-    { "余闲", "餘閒" },
-    { "余零", "餘零" },
-    { "余震", "餘震" },
-    { "余霞", "餘霞" },
-    { "余音", "餘音" },
-    { "余音绕梁", "餘音繞梁" },
-    { "余韵", "餘韻" },
-    { "余额", "餘額" },
-    { "余风", "餘風" },
-    { "余食", "餘食" },
-    { "佛罗棱萨", "佛羅稜薩" },
-    { "佛钟", "佛鐘" },
-    { "作准", "作準" },
-    { "作品里", "作品裡" },
-    { "作奸犯科", "作姦犯科" },
-    { "作庄", "作莊" },
-    { "你克制", "你剋制" },
-    { "你才子发昏", "你纔子發昏" },
-    { "佣中佼佼", "傭中佼佼" },
-    { "佣书", "傭書" },
-    { "佣人", "傭人" },
-    { "佣仆", "傭僕" },
-    { "佣兵", "傭兵" },
-    { "佣工", "傭工" },
-    { "佣懒", "傭懶" },
-    { "佣金", "傭金" },
-    { "佥", "僉" },
-    { "佳肴", "佳肴" },
-    { "使其斗", "使其鬥" },
-    { "侍仆", "侍僕" },
-    { "供制", "供製" },
-    { "依依不舍", "依依不捨" },
-    { "依托", "依託" },
-    { "侠", "俠" },
-    { "侣", "侶" },
-    { "侥", "僥" },
-    { "侥幸", "僥倖" },
-    { "侦", "偵" },
-    { "侧", "側" },
-    { "侨", "僑" },
-    { "侩", "儈" },
-    { "侪", "儕" },
-    { "侬", "儂" },
-    { "侵占", "侵佔" },
-    { "侵并", "侵併" },
-    { "便药", "便藥" },
-    { "俄占", "俄佔" },
-    { "保险柜", "保險柜" },
-    { "信托", "信託" },
-    { "俣", "俁" },
-    { "俦", "儔" },
-    { "俨", "儼" },
-    { "俩", "倆" },
-    { "俪", "儷" },
-    { "俭", "儉" },
-    { "俭仆", "儉僕" },
-    { "俭朴", "儉樸" },
-    { "俭确之教", "儉确之教" },
-    { "修杰楷", "修杰楷" },
-    { "修杰麟", "修杰麟" },
-    { "修炼", "修鍊" },
-    { "修胡刀", "修鬍刀" },
-    { "俯冲", "俯衝" },
-    { "倒绷孩儿", "倒繃孩兒" },
-    { "倛丑", "倛醜" },
-    { "借以", "藉以" },
-    { "借助", "藉助" },
-    { "借寇兵", "藉寇兵" },
-    { "借手", "藉手" },
-    { "借机", "藉機" },
-    { "借此", "藉此" },
-    { "借由", "藉由" },
-    { "借着", "藉著" },
-    { "借箸代筹", "藉箸代籌" },
-    { "借资", "藉資" },
-    { "倦游", "倦遊" },
-    { "债", "債" },
-    { "倾", "傾" },
-    { "倾复", "傾複" },
-    { "假发", "假髮" },
-    { "假托", "假託" },
-    { "假药", "假藥" },
-    { "偎干", "偎乾" },
-    { "做庄", "做莊" },
-    { "停制", "停製" },
-    { "停征", "停徵" },
-    { "偬", "傯" },
-    { "偷鸡不着", "偷雞不著" },
-    { "偻", "僂" },
-    { "偾", "僨" },
-    { "偿", "償" },
-    { "傥", "儻" },
-    { "傧", "儐" },
-    { "储", "儲" },
-    { "傩", "儺" },
-    { "催并", "催併" },
-    { "傲游", "傲遊" },
-    { "傲霜斗雪", "傲霜鬥雪" },
-    { "傳位于四太子", "傳位于四太子" },
-    { "傻里傻气", "傻裡傻氣" },
-    { "僮仆", "僮僕" },
-    { "僵尸", "殭屍" },
-    { "儒略历", "儒略曆" },
-    { "儒略改革历", "儒略改革曆" },
-    { "儿", "兒" },
-    { "兀术", "兀朮" },
-    { "元凶", "元兇" },
-    { "充饥", "充饑" },
-    { "兆余", "兆餘" },
-    { "先占", "先佔" },
-    { "先采", "先採" },
-    { "光致致", "光緻緻" },
-    { "克制不了", "剋制不了" },
-    { "克制不住", "剋制不住" },
-    { "克复", "克複" },
-    { "克扣", "剋扣" },
-    { "克星", "剋星" },
-    { "克期", "剋期" },
-    { "克死", "剋死" },
-    { "克药", "克藥" },
-    { "克薄", "剋薄" },
-    { "免征", "免徵" },
-    { "兑", "兌" },
-    { "兖", "兗" },
-    { "党", "黨" },
-    { "党参", "党參" },
-    { "党太尉", "党太尉" },
-    { "党怀英", "党懷英" },
-    { "党进", "党進" },
-    { "党項", "党項" },
-    { "党项", "党項" },
-    { "全干", "全乾" },
-    { "八余", "八餘" },
-    { "八只", "八隻" },
-    { "八字胡", "八字鬍" },
-    { "八扎", "八紮" },
-    { "八蜡", "八蜡" },
-    { "公仆", "公僕" },
-    { "公仔面", "公仔麵" },
-    { "公余", "公餘" },
-    { "公历", "公曆" },
-    { "公厘", "公釐" },
-    { "公干", "公幹" },
-    { "六余", "六餘" },
-    { "六冲", "六衝" },
-    { "六出", "六齣" },
-    { "六只", "六隻" },
-    { "六扎", "六紮" },
-    { "六谷", "六穀" },
-    { "兰", "蘭" },
-    { "共和历", "共和曆" },
-    { "关", "關" },
-    { "关弓与我确", "關弓與我确" },
-    { "关系", "關係" },
-    { "关系着", "關係著" },
-    { "兴", "興" },
-    { "兴致", "興緻" },
-    { "其余", "其餘" },
-    { "典范", "典範" },
-    { "兹", "茲" },
-    { "养", "養" },
-    { "兼并", "兼并" },
-    { "兽", "獸" },
-    { "兽欲", "獸慾" },
-    { "冁", "囅" },
-    { "内", "內" },
-    { "内制", "內製" },
-    { "内哄", "內鬨" },
-    { "内斗", "內鬥" },
-    { "冈", "岡" },
-    { "册", "冊" },
-    { "冗余", "冗餘" },
-    { "写", "寫" },
-    { "写字台", "寫字檯" },
-    { "军", "軍" },
-    { "军队克制", "軍隊剋制" },
-    { "农", "農" },
-    { "农历", "農曆" },
-    { "农庄", "農莊" },
-    { "农民历", "農民曆" },
-    { "农药", "農藥" },
-    { "冤仇", "冤讎" },
-    { "冥蒙", "冥濛" },
-    { "冬冬鼓", "鼕鼕鼓" },
-    { "冬天里", "冬天裡" },
-    { "冬日里", "冬日裡" },
-    { "冬游", "冬遊" },
-    { "冯", "馮" },
-    { "冲", "沖" },
-    { "冲上", "衝上" },
-    { "冲下", "衝下" },
-    { "冲倒", "衝倒" },
-    { "冲克", "衝剋" },
-    { "冲冠", "衝冠" },
-    { "冲冠发怒", "沖冠髮怒" },
-    { "冲决", "衝決" },
-    { "冲出", "衝出" },
-    { "冲击", "衝擊" },
-    { "冲到", "衝到" },
-    { "冲刺", "衝刺" },
-    { "冲力", "衝力" },
-    { "冲动", "衝動" },
-    { "冲劲", "衝勁" },
-    { "冲压", "衝壓" },
-    { "冲去", "衝去" },
-    { "冲口", "衝口" },
-    { "冲坚陷阵", "衝堅陷陣" },
-    { "冲垮", "衝垮" },
-    { "冲堂", "衝堂" },
-    { "冲天", "衝天" },
-    { "冲头阵", "衝頭陣" },
-    { "冲州撞府", "衝州撞府" },
-    { "冲心", "衝心" },
-    { "冲掉", "衝掉" },
-    { "冲撞", "衝撞" },
-    { "冲散", "衝散" },
-    { "冲杀", "衝殺" },
-    { "冲来", "衝來" },
-    { "冲波", "衝波" },
-    { "冲浪", "衝浪" },
-    { "冲激", "衝激" },
-    { "冲然", "衝然" },
-    { "冲盹", "衝盹" },
-    { "冲着", "衝著" },
-    { "冲破", "衝破" },
-    { "冲程", "衝程" },
-    { "冲突", "衝突" },
-    { "冲线", "衝線" },
-    { "冲要", "衝要" },
-    { "冲起", "衝起" },
-    { "冲车", "衝車" },
-    { "冲过", "衝過" },
-    { "冲进", "衝進" },
-    { "冲量", "衝量" },
-    { "冲锋", "衝鋒" },
-    { "冲陷", "衝陷" },
-    { "冲风", "衝風" },
-    { "决", "決" },
-    { "决斗", "決鬥" },
-    { "况", "況" },
-    { "冶游", "冶遊" },
-    { "冷面", "冷麵" },
-    { "冻", "凍" },
-    { "净", "凈" },
-    { "净余", "淨餘" },
-    { "净发", "淨髮" },
-    { "准三后", "准三后" },
-    { "准不准", "準不準" },
-    { "准会", "準會" },
-    { "准例", "準例" },
-    { "准保", "準保" },
-    { "准儿", "準兒" },
-    { "准决赛", "準決賽" },
-    { "准分子", "準分子" },
-    { "准则", "準則" },
-    { "准噶尔", "準噶爾" },
-    { "准备", "準備" },
-    { "准头", "準頭" },
-    { "准定", "準定" },
-    { "准平原", "準平原" },
-    { "准度", "準度" },
-    { "准式", "準式" },
-    { "准拟", "準擬" },
-    { "准拿督", "準拿督" },
-    { "准据", "準據" },
-    { "准新娘", "準新娘" },
-    { "准新郎", "準新郎" },
-    { "准时", "準時" },
-    { "准星", "準星" },
-    { "准是", "準是" },
-    { "准点", "準點" },
-    { "准的", "準的" },
-    { "准直", "準直" },
-    { "准确", "準確" },
-    { "准线", "準線" },
-    { "准绳", "準繩" },
-    { "准话", "準話" },
-    { "准谱", "準譜" },
-    { "准货币", "準貨幣" },
-    { "凉", "涼" },
-    { "凉面", "涼麵" },
-    { "凌蒙初", "凌濛初" },
-    { "减", "減" },
-    { "减肥药", "減肥藥" },
-    { "凑", "湊" },
-    { "凛", "凜" },
-    { "凝炼", "凝鍊" },
-    { "几", "幾" },
-    { "几上", "几上" },
-    { "几丝", "几絲" },
-    { "几净窗明", "几淨窗明" },
-    { "几几", "几几" },
-    { "几凳", "几凳" },
-    { "几出", "幾齣" },
-    { "几只", "幾隻" },
-    { "几子", "几子" },
-    { "几旁", "几旁" },
-    { "几杖", "几杖" },
-    { "几案", "几案" },
-    { "几椅", "几椅" },
-    { "几榻", "几榻" },
-    { "几筵", "几筵" },
-    { "几面上", "几面上" },
-    { "凤", "鳳" },
-    { "凫", "鳧" },
-    { "凭", "憑" },
-    { "凭借", "憑藉" },
-    { "凭借着", "憑藉著" },
-    { "凭准", "憑準" },
-    { "凭几", "憑几" },
-    { "凭吊", "憑弔" },
-    { "凭折", "憑摺" },
-    { "凯", "凱" },
-    { "凶刀", "兇刀" },
-    { "凶器", "兇器" },
-    { "凶嫌", "兇嫌" },
-    { "凶巴巴", "兇巴巴" },
-    { "凶徒", "兇徒" },
-    { "凶恶", "兇惡" },
-    { "凶悍", "兇悍" },
-    { "凶手", "兇手" },
-    { "凶杀", "兇殺" },
-    { "凶枪", "兇槍" },
-    { "凶案", "兇案" },
-    { "凶横", "兇橫" },
-    { "凶残", "兇殘" },
-    { "凶殘", "兇殘" },
-    { "凶殺", "兇殺" },
-    { "凶犯", "兇犯" },
-    { "凶狠", "兇狠" },
-    { "凶猛", "兇猛" },
-    { "凶疑", "兇疑" },
-    { "凶相", "兇相" },
-    { "凶险", "兇險" },
-    { "凹洞里", "凹洞裡" },
-    { "出丑", "出醜" },
-    { "出儿", "齣兒" },
-    { "出剧", "齣劇" },
-    { "出动画", "齣動畫" },
-    { "出卡通", "齣卡通" },
-    { "出戏", "齣戲" },
-    { "出游", "出遊" },
-    { "出电影", "齣電影" },
-    { "出电视", "齣電視" },
-    { "出节目", "齣節目" },
-    { "出锤", "出鎚" },
-    { "击", "擊" },
-    { "击扑", "擊扑" },
-    { "击钟", "擊鐘" },
-    { "凿", "鑿" },
-    { "分别致", "分别致" },
-    { "分半钟", "分半鐘" },
-    { "分占", "分佔" },
-    { "分多钟", "分多鐘" },
-    { "分子钟", "分子鐘" },
-    { "分钟", "分鐘" },
-    { "刍", "芻" },
-    { "刑余", "刑餘" },
-    { "划", "劃" },
-    { "划一桨", "划一槳" },
-    { "划上", "划上" },
-    { "划下", "划下" },
-    { "划不来", "划不來" },
-    { "划了", "划了" },
-    { "划具", "划具" },
-    { "划出", "划出" },
-    { "划到", "划到" },
-    { "划动", "划動" },
-    { "划去", "划去" },
-    { "划子", "划子" },
-    { "划得来", "划得來" },
-    { "划拳", "划拳" },
-    { "划来划去", "划來划去" },
-    { "划桨", "划槳" },
-    { "划水", "划水" },
-    { "划着", "划著" },
-    { "划算", "划算" },
-    { "划船", "划船" },
-    { "划艇", "划艇" },
-    { "划行", "划行" },
-    { "划走", "划走" },
-    { "划起", "划起" },
-    { "划过", "划過" },
-    { "划进", "划進" },
-    { "划龙舟", "划龍舟" },
-    { "刘", "劉" },
-    { "刘佳怜", "劉佳怜" },
-    { "刘克庄", "劉克莊" },
-    { "刘芸后", "劉芸后" },
-    { "则", "則" },
-    { "刚", "剛" },
-    { "刚干", "剛乾" },
-    { "刚才一载", "剛纔一載" },
-    { "刚雇", "剛僱" },
-    { "创", "創" },
-    { "创制", "創製" },
-    { "创获", "創穫" },
-    { "删", "刪" },
-    { "利欲", "利慾" },
-    { "别", "別" },
-    { "别口气", "彆口氣" },
-    { "别庄", "別莊" },
-    { "别强", "彆強" },
-    { "别扭", "彆扭" },
-    { "别拗", "彆拗" },
-    { "别气", "彆氣" },
-    { "别着", "別著" },
-    { "别致", "別緻" },
-    { "别辟", "別闢" },
-    { "刭", "剄" },
-    { "刮了", "颳了" },
-    { "刮倒", "颳倒" },
-    { "刮去", "颳去" },
-    { "刮得", "颳得" },
-    { "刮着", "刮著" },
-    { "刮胡", "刮鬍" },
-    { "刮走", "颳走" },
-    { "刮起", "颳起" },
-    { "刮雪", "颳雪" },
-    { "刮风", "颳風" },
-    { "制为", "製為" },
-    { "制件", "製件" },
-    { "制作", "製作" },
-    { "制做", "製做" },
-    { "制冰", "製冰" },
-    { "制冷", "製冷" },
-    { "制剂", "製劑" },
-    { "制取", "製取" },
-    { "制品", "製品" },
-    { "制图", "製圖" },
-    { "制备", "製備" },
-    { "制得", "製得" },
-    { "制成", "製成" },
-    { "制法", "製法" },
-    { "制浆", "製漿" },
-    { "制片", "製片" },
-    { "制版", "製版" },
-    { "制盐", "製鹽" },
-    { "制程", "製程" },
-    { "制签", "制籤" },
-    { "制糖", "製糖" },
-    { "制纸", "製紙" },
-    { "制药", "製藥" },
-    { "制表", "製表" },
-    { "制造", "製造" },
-    { "制钟", "制鐘" },
-    { "制革", "製革" },
-    { "制鞋", "製鞋" },
-    { "刹", "剎" },
-    { "刺绣", "刺繡" },
-    { "刻半钟", "刻半鐘" },
-    { "刻多钟", "刻多鐘" },
-    { "刻钟", "刻鐘" },
-    { "刽", "劊" },
-    { "刿", "劌" },
-    { "剀", "剴" },
-    { "剂", "劑" },
-    { "剃发", "剃髮" },
-    { "剃胡", "剃鬍" },
-    { "剃须", "剃鬚" },
-    { "削发", "削髮" },
-    { "削面", "削麵" },
-    { "剐", "剮" },
-    { "剑", "劍" },
-    { "剔庄货", "剔莊貨" },
-    { "剥", "剝" },
-    { "剥制", "剝製" },
-    { "剧", "劇" },
-    { "剧药", "劇藥" },
-    { "剩余", "剩餘" },
-    { "剪其发", "剪其髮" },
-    { "剪发", "剪髮" },
-    { "剪彩", "剪綵" },
-    { "割舍", "割捨" },
-    { "劉佳怜", "劉佳怜" },
-    { "力争上游", "力爭上遊" },
-    { "力克制", "力剋制" },
-    { "力拼", "力拚" },
-    { "力求克制", "力求剋制" },
-    { "劝", "勸" },
-    { "办", "辦" },
-    { "办公台", "辦公檯" },
-    { "功致", "功緻" },
-    { "加注", "加註" },
-    { "加药", "加藥" },
-    { "务", "務" },
-    { "劢", "勱" },
-    { "动", "動" },
-    { "动荡", "動蕩" },
-    { "劫余", "劫餘" },
-    { "励", "勵" },
-    { "劲", "勁" },
-    { "劳", "勞" },
-    { "劳力士表", "勞力士錶" },
-    { "势", "勢" },
-    { "勃郁", "勃鬱" },
-    { "勋", "勛" },
-    { "勋章", "勳章" },
-    { "勤仆", "勤僕" },
-    { "勤朴", "勤樸" },
-    { "勺药", "勺藥" },
-    { "勾干", "勾幹" },
-    { "勾心斗角", "勾心鬥角" },
-    { "勾魂荡魄", "勾魂蕩魄" },
-    { "匀", "勻" },
-    { "包准", "包準" },
-    { "包庄", "包莊" },
-    { "包扎", "包紮" },
-    { "包谷", "包穀" },
-    { "匏系", "匏繫" },
-    { "北回线", "北迴線" },
-    { "北回铁路", "北迴鐵路" },
-    { "北岳", "北嶽" },
-    { "匡复", "匡複" },
-    { "匦", "匭" },
-    { "匪干", "匪幹" },
-    { "匮", "匱" },
-    { "区", "區" },
-    { "医", "醫" },
-    { "医药", "醫藥" },
-    { "医院里", "醫院裡" },
-    { "十余", "十餘" },
-    { "十出", "十齣" },
-    { "十只", "十隻" },
-    { "十扎", "十紮" },
-    { "千余", "千餘" },
-    { "千只", "千隻" },
-    { "千回百折", "千迴百折" },
-    { "千回百转", "千迴百轉" },
-    { "千扎", "千紮" },
-    { "千钧一发", "千鈞一髮" },
-    { "升官", "陞官" },
-    { "升平", "昇平" },
-    { "升阳", "昇陽" },
-    { "半只", "半隻" },
-    { "华", "華" },
-    { "华严钟", "華嚴鐘" },
-    { "华发", "華髮" },
-    { "协", "協" },
-    { "单", "單" },
-    { "单于", "單于" },
-    { "单干", "單幹" },
-    { "单打独斗", "單打獨鬥" },
-    { "卖", "賣" },
-    { "卖呆", "賣獃" },
-    { "南京钟", "南京鐘" },
-    { "南回线", "南迴線" },
-    { "南回铁路", "南迴鐵路" },
-    { "南宫适", "南宮适" },
-    { "南岳", "南嶽" },
-    { "南游", "南遊" },
-    { "南筑", "南筑" },
-    { "博汇", "博彙" },
-    { "博采", "博採" },
-    { "卜云吉", "卜云吉" },
-    { "卞庄", "卞莊" },
-    { "占〇", "佔〇" },
-    { "占一", "佔一" },
-    { "占七", "佔七" },
-    { "占万", "佔万" },
-    { "占三", "佔三" },
-    { "占上风", "佔上風" },
-    { "占下", "佔下" },
-    { "占不占", "佔不佔" },
-    { "占不足", "佔不足" },
-    { "占世界", "佔世界" },
-    { "占东", "佔東" },
-    { "占两", "佔兩" },
-    { "占个", "佔個" },
-    { "占中", "佔中" },
-    { "占为", "佔為" },
-    { "占主", "佔主" },
-    { "占九", "佔九" },
-    { "占了", "佔了" },
-    { "占二", "佔二" },
-    { "占五", "佔五" },
-    { "占人便宜", "佔人便宜" },
-    { "占亿", "佔億" },
-    { "占优", "佔優" },
-    { "占位", "佔位" },
-    { "占住", "佔住" },
-    { "占便宜", "佔便宜" },
-    { "占便宜的是呆", "占便宜的是獃" },
-    { "占俄", "佔俄" },
-    { "占停车", "佔停車" },
-    { "占先", "佔先" },
-    { "占光", "佔光" },
-    { "占全", "佔全" },
-    { "占八", "佔八" },
-    { "占六", "佔六" },
-    { "占分", "佔分" },
-    { "占到", "佔到" },
-    { "占加", "佔加" },
-    { "占劣", "佔劣" },
-    { "占北", "佔北" },
-    { "占十", "佔十" },
-    { "占千", "佔千" },
-    { "占半", "佔半" },
-    { "占南", "佔南" },
-    { "占占", "佔佔" },
-    { "占印", "佔印" },
-    { "占压", "佔壓" },
-    { "占去", "佔去" },
-    { "占取", "佔取" },
-    { "占台", "佔台" },
-    { "占后", "佔後" },
-    { "占哺乳", "佔哺乳" },
-    { "占嗫", "佔囁" },
-    { "占四", "佔四" },
-    { "占国内", "佔國內" },
-    { "占在", "佔在" },
-    { "占地", "佔地" },
-    { "占场", "佔場" },
-    { "占多", "佔多" },
-    { "占大", "佔大" },
-    { "占头", "佔頭" },
-    { "占好", "佔好" },
-    { "占小", "佔小" },
-    { "占少", "佔少" },
-    { "占尽", "佔盡" },
-    { "占局部", "佔局部" },
-    { "占屋", "佔屋" },
-    { "占山", "佔山" },
-    { "占市场", "佔市場" },
-    { "占平均", "佔平均" },
-    { "占床", "佔床" },
-    { "占座", "佔座" },
-    { "占得", "佔得" },
-    { "占德", "佔德" },
-    { "占总", "佔總" },
-    { "占据", "佔據" },
-    { "占掉", "佔掉" },
-    { "占整体", "佔整體" },
-    { "占新", "佔新" },
-    { "占有", "佔有" },
-    { "占有欲", "佔有慾" },
-    { "占查", "佔查" },
-    { "占次", "佔次" },
-    { "占比", "佔比" },
-    { "占毕", "佔畢" },
-    { "占法", "佔法" },
-    { "占满", "佔滿" },
-    { "占澳", "佔澳" },
-    { "占率", "佔率" },
-    { "占用", "佔用" },
-    { "占百", "佔百" },
-    { "占着", "佔著" },
-    { "占稳", "佔穩" },
-    { "占线", "佔線" },
-    { "占缺", "佔缺" },
-    { "占网", "佔網" },
-    { "占美", "佔美" },
-    { "占耕", "佔耕" },
-    { "占至多", "佔至多" },
-    { "占至少", "佔至少" },
-    { "占苏", "佔蘇" },
-    { "占英", "佔英" },
-    { "占葡", "佔葡" },
-    { "占西", "佔西" },
-    { "占资源", "佔資源" },
-    { "占起", "佔起" },
-    { "占超过", "佔超過" },
-    { "占过", "佔過" },
-    { "占道", "佔道" },
-    { "占零", "佔零" },
-    { "占領", "佔領" },
-    { "占领", "佔領" },
-    { "占饭", "佔飯" },
-    { "占香", "佔香" },
-    { "占马", "佔馬" },
-    { "占高枝儿", "佔高枝兒" },
-    { "卢", "盧" },
-    { "卢棱伽", "盧稜伽" },
-    { "卤", "鹵" },
-    { "卤制", "滷製" },
-    { "卤味", "滷味" },
-    { "卤水", "滷水" },
-    { "卤汁", "滷汁" },
-    { "卤湖", "滷湖" },
-    { "卤肉", "滷肉" },
-    { "卤菜", "滷菜" },
-    { "卤蛋", "滷蛋" },
-    { "卤面", "滷麵" },
-    { "卤鸡", "滷雞" },
-    { "卧游", "臥遊" },
-    { "卫", "衛" },
-    { "卫后庄公", "衛後莊公" },
-    { "卫星钟", "衛星鐘" },
-    { "印制", "印製" },
-    { "印累绶若", "印纍綬若" },
-    { "却", "卻" },
-    { "卵与石斗", "卵與石鬥" },
-    { "卷云", "捲雲" },
-    { "卷住", "捲住" },
-    { "卷儿", "捲兒" },
-    { "卷入", "捲入" },
-    { "卷动", "捲動" },
-    { "卷去", "捲去" },
-    { "卷发", "捲髮" },
-    { "卷图", "捲圖" },
-    { "卷土重来", "捲土重來" },
-    { "卷尺", "捲尺" },
-    { "卷帘", "捲簾" },
-    { "卷心菜", "捲心菜" },
-    { "卷成", "捲成" },
-    { "卷曲", "捲曲" },
-    { "卷来", "捲來" },
-    { "卷款", "捲款" },
-    { "卷毛", "捲毛" },
-    { "卷烟", "捲煙" },
-    { "卷筒", "捲筒" },
-    { "卷纸", "捲紙" },
-    { "卷缩", "捲縮" },
-    { "卷舌", "捲舌" },
-    { "卷舖盖", "捲舖蓋" },
-    { "卷菸", "捲菸" },
-    { "卷袖", "捲袖" },
-    { "卷走", "捲走" },
-    { "卷起", "捲起" },
-    { "卷轴", "捲軸" },
-    { "卷逃", "捲逃" },
-    { "卷铺盖", "捲鋪蓋" },
-    { "卷须", "卷鬚" },
-    { "卷风", "捲風" },
-    { "卺", "巹" },
-    { "厂", "廠" },
-    { "厂部", "厂部" },
-    { "厅", "廳" },
-    { "历", "歷" },
-    { "历书", "曆書" },
-    { "历元", "曆元" },
-    { "历史里", "歷史裡" },
-    { "历命", "曆命" },
-    { "历始", "曆始" },
-    { "历室", "曆室" },
-    { "历尾", "曆尾" },
-    { "历数", "曆數" },
-    { "历日", "曆日" },
-    { "历本", "曆本" },
-    { "历法", "曆法" },
-    { "历物之意", "厤物之意" },
-    { "历狱", "曆獄" },
-    { "历纪", "曆紀" },
-    { "历象", "曆象" },
-    { "厉", "厲" },
-    { "压", "壓" },
-    { "厌", "厭" },
-    { "厍", "厙" },
-    { "厕", "廁" },
-    { "厘出", "釐出" },
-    { "厘升", "釐升" },
-    { "厘定", "釐定" },
-    { "厘正", "釐正" },
-    { "厘清", "釐清" },
-    { "厘订", "釐訂" },
-    { "原子钟", "原子鐘" },
-    { "原钟", "原鐘" },
-    { "厢", "廂" },
-    { "厣", "厴" },
-    { "厦", "廈" },
-    { "厨", "廚" },
-    { "厨余", "廚餘" },
-    { "厩", "廄" },
-    { "厮", "廝" },
-    { "厮斗", "廝鬥" },
-    { "县", "縣" },
-    { "县志", "縣誌" },
-    { "县里", "縣裡" },
-    { "参", "參" },
-    { "参绥", "蔘綏" },
-    { "双", "雙" },
-    { "双折", "雙摺" },
-    { "双胜类", "雙胜類" },
-    { "双雕", "雙鵰" },
-    { "反冲", "反衝" },
-    { "反复", "反覆" },
-    { "反复制", "反複製" },
-    { "反朴", "反樸" },
-    { "发", "發" },
-    { "发上冲冠", "髮上沖冠" },
-    { "发上指冠", "髮上指冠" },
-    { "发丝", "髮絲" },
-    { "发为血之本", "髮為血之本" },
-    { "发乳", "髮乳" },
-    { "发光可鉴", "髮光可鑑" },
-    { "发匪", "髮匪" },
-    { "发卷", "髮捲" },
-    { "发呆", "發獃" },
-    { "发型", "髮型" },
-    { "发夹", "髮夾" },
-    { "发妻", "髮妻" },
-    { "发姐", "髮姐" },
-    { "发屋", "髮屋" },
-    { "发已霜白", "髮已霜白" },
-    { "发带", "髮帶" },
-    { "发干", "發乾" },
-    { "发庄", "發莊" },
-    { "发廊", "髮廊" },
-    { "发式", "髮式" },
-    { "发引千钧", "髮引千鈞" },
-    { "发指", "髮指" },
-    { "发松", "發鬆" },
-    { "发根", "髮根" },
-    { "发汗药", "發汗藥" },
-    { "发油", "髮油" },
-    { "发漂", "髮漂" },
-    { "发状", "髮狀" },
-    { "发癣", "髮癬" },
-    { "发着", "發著" },
-    { "发短心长", "髮短心長" },
-    { "发禁", "髮禁" },
-    { "发笺", "髮箋" },
-    { "发签", "發籤" },
-    { "发纱", "髮紗" },
-    { "发结", "髮結" },
-    { "发网", "髮網" },
-    { "发肤", "髮膚" },
-    { "发胶", "髮膠" },
-    { "发脚", "髮腳" },
-    { "发菜", "髮菜" },
-    { "发蒙", "發矇" },
-    { "发蜡", "髮蠟" },
-    { "发踊冲冠", "髮踊沖冠" },
-    { "发辫", "髮辮" },
-    { "发针", "髮針" },
-    { "发钗", "髮釵" },
-    { "发长", "髮長" },
-    { "发际", "髮際" },
-    { "发雕", "髮雕" },
-    { "发霜", "髮霜" },
-    { "发面", "發麵" },
-    { "发饰", "髮飾" },
-    { "发髻", "髮髻" },
-    { "发鬓", "髮鬢" },
-    { "取舍", "取捨" },
-    { "受托", "受託" },
-    { "变", "變" },
-    { "变丑", "變醜" },
-    { "变征", "變徵" },
-    { "变脏", "變髒" },
-    { "叙", "敘" },
-    { "叠", "疊" },
-    { "口干", "口乾" },
-    { "口腹之欲", "口腹之慾" },
-    { "口里", "口裡" },
-    { "口钟", "口鐘" },
-    { "古书云", "古書云" },
-    { "古書云", "古書云" },
-    { "古朴", "古樸" },
-    { "古柯咸", "古柯鹹" },
-    { "古語云", "古語云" },
-    { "古迹", "古迹" },
-    { "古钟", "古鐘" },
-    { "古钟表", "古鐘錶" },
-    { "另辟", "另闢" },
-    { "叩钟", "叩鐘" },
-    { "只冲", "只衝" },
-    { "只占", "只佔" },
-    { "只字", "隻字" },
-    { "只影", "隻影" },
-    { "只手遮天", "隻手遮天" },
-    { "只眼", "隻眼" },
-    { "只言片语", "隻言片語" },
-    { "只身", "隻身" },
-    { "只采", "只採" },
-    { "叮叮当当", "叮叮噹噹" },
-    { "叮当", "叮噹" },
-    { "可以克制", "可以剋制" },
-    { "可紧可松", "可緊可鬆" },
-    { "台子", "檯子" },
-    { "台布", "檯布" },
-    { "台灯", "檯燈" },
-    { "台球", "檯球" },
-    { "台钟", "台鐘" },
-    { "台面", "檯面" },
-    { "台风", "颱風" },
-    { "叱咤乐坛", "叱咤樂壇" },
-    { "叱咤叱叱咤", "叱咤叱叱咤" },
-    { "叱咤咤", "叱咤咤" },
-    { "叱咤樂壇", "叱咤樂壇" },
-    { "叶", "葉" },
-    { "叶不二子", "叶不二子" },
-    { "叶叶琴", "葉叶琴" },
-    { "叶志穗", "叶志穗" },
-    { "叶恭弘", "叶恭弘" },
-    { "叶音", "叶音" },
-    { "叶韵", "叶韻" },
-    { "号", "號" },
-    { "号志", "號誌" },
-    { "叹", "嘆" },
-    { "叽", "嘰" },
-    { "吁天", "籲天" },
-    { "吁求", "籲求" },
-    { "吁请", "籲請" },
-    { "吃姜", "吃薑" },
-    { "吃板刀面", "吃板刀麵" },
-    { "吃着不尽", "吃著不盡" },
-    { "吃药", "吃藥" },
-    { "吃辣面", "吃辣麵" },
-    { "吃里扒外", "吃裡扒外" },
-    { "吃里爬外", "吃裡爬外" },
-    { "吃错药", "吃錯藥" },
-    { "各类钟", "各類鐘" },
-    { "各辟", "各闢" },
-    { "合伙", "合夥" },
-    { "合准", "合準" },
-    { "合历", "合曆" },
-    { "合并", "合併" },
-    { "合府", "閤府" },
-    { "合着", "合著" },
-    { "合采", "合採" },
-    { "吊丧", "弔喪" },
-    { "吊书", "弔書" },
-    { "吊儿郎当", "弔兒郎當" },
-    { "吊卷", "弔卷" },
-    { "吊取", "弔取" },
-    { "吊古", "弔古" },
-    { "吊唁", "弔唁" },
-    { "吊喉", "弔喉" },
-    { "吊喭", "弔喭" },
-    { "吊场", "弔場" },
-    { "吊头", "弔頭" },
-    { "吊奠", "弔奠" },
-    { "吊孝", "弔孝" },
-    { "吊客", "弔客" },
-    { "吊宴", "弔宴" },
-    { "吊带", "弔帶" },
-    { "吊影", "弔影" },
-    { "吊慰", "弔慰" },
-    { "吊扣", "弔扣" },
-    { "吊拷", "弔拷" },
-    { "吊拷绷扒", "弔拷繃扒" },
-    { "吊挂", "弔掛" },
-    { "吊挂着", "吊掛著" },
-    { "吊撒", "弔撒" },
-    { "吊文", "弔文" },
-    { "吊旗", "弔旗" },
-    { "吊杆", "吊杆" },
-    { "吊桥", "弔橋" },
-    { "吊死", "弔死" },
-    { "吊民", "弔民" },
-    { "吊着", "吊著" },
-    { "吊祭", "弔祭" },
-    { "吊纸", "弔紙" },
-    { "吊者大悦", "弔者大悅" },
-    { "吊脚儿事", "弔腳兒事" },
-    { "吊腰撒跨", "弔腰撒跨" },
-    { "吊膀子", "弔膀子" },
-    { "吊词", "弔詞" },
-    { "吊诡", "弔詭" },
-    { "吊谎", "弔謊" },
-    { "吊贺迎送", "弔賀迎送" },
-    { "吊钟", "吊鐘" },
-    { "吊问", "弔問" },
-    { "吊颈", "弔頸" },
-    { "吊鹤", "弔鶴" },
-    { "同伙", "同夥" },
-    { "同余", "同餘" },
-    { "后", "後" },
-    { "后丰", "后豐" },
-    { "后冠", "后冠" },
-    { "后北街", "后北街" },
-    { "后发座", "后髮座" },
-    { "后发星系团", "后髮星系團" },
-    { "后土", "后土" },
-    { "后妃", "后妃" },
-    { "后安路", "后安路" },
-    { "后平路", "后平路" },
-    { "后座", "后座" },
-    { "后海湾", "后海灣" },
-    { "后海灣", "后海灣" },
-    { "后瑞站", "后瑞站" },
-    { "后稷", "后稷" },
-    { "后羿", "后羿" },
-    { "后街", "后街" },
-    { "后角", "后角" },
-    { "后豐", "后豐" },
-    { "后里", "后里" },
-    { "后髮座", "后髮座" },
-    { "后髮星系團", "后髮星系團" },
-    { "向导", "嚮導" },
-    { "向应", "嚮應" },
-    { "向往", "嚮往" },
-    { "向着", "向著" },
-    { "向迩", "嚮邇" },
-    { "吓", "嚇" },
-    { "吕", "呂" },
-    { "吕后", "呂后" },
-    { "吗", "嗎" },
-    { "吞并", "吞併" },
-    { "吟游", "吟遊" },
-    { "吣", "唚" },
-    { "吨", "噸" },
-    { "含齿戴发", "含齒戴髮" },
-    { "听", "聽" },
-    { "启", "啟" },
-    { "吴", "吳" },
-    { "吹发", "吹髮" },
-    { "吹干", "吹乾" },
-    { "吹胡", "吹鬍" },
-    { "呂后", "呂后" },
-    { "呆串了皮", "獃串了皮" },
-    { "呆事", "獃事" },
-    { "呆人", "獃人" },
-    { "呆呆", "獃獃" },
-    { "呆头", "獃頭" },
-    { "呆子", "獃子" },
-    { "呆性", "獃性" },
-    { "呆想", "獃想" },
-    { "呆憨呆", "獃憨獃" },
-    { "呆根", "獃根" },
-    { "呆气", "獃氣" },
-    { "呆滞", "獃滯" },
-    { "呆痴", "獃痴" },
-    { "呆着", "獃著" },
-    { "呆磕", "獃磕" },
-    { "呆等", "獃等" },
-    { "呆脑", "獃腦" },
-    { "呆致致", "呆緻緻" },
-    { "呆话", "獃話" },
-    { "呆里呆气", "呆裡呆氣" },
-    { "呐", "吶" },
-    { "呒", "嘸" },
-    { "呓", "囈" },
-    { "呕", "嘔" },
-    { "呖", "嚦" },
-    { "呗", "唄" },
-    { "呗赞", "唄讚" },
-    { "员", "員" },
-    { "呙", "咼" },
-    { "呛", "嗆" },
-    { "呜", "嗚" },
-    { "周历", "周曆" },
-    { "周后", "周后" },
-    { "周庄王", "周莊王" },
-    { "周杰倫", "周杰倫" },
-    { "周游", "周遊" },
-    { "周游世界", "週遊世界" },
-    { "呼吁", "呼籲" },
-    { "和克制", "和剋制" },
-    { "和奸", "和姦" },
-    { "咎征", "咎徵" },
-    { "咏", "詠" },
-    { "咕咕钟", "咕咕鐘" },
-    { "咙", "嚨" },
-    { "咛", "嚀" },
-    { "咤", "吒" },
-    { "咨询", "諮詢" },
-    { "咬姜呷醋", "咬薑呷醋" },
-    { "咯当", "咯噹" },
-    { "咳嗽药", "咳嗽藥" },
-    { "咸卤", "鹹鹵" },
-    { "咸味", "鹹味" },
-    { "咸咸", "鹹鹹" },
-    { "咸嘴淡舌", "鹹嘴淡舌" },
-    { "咸土", "鹹土" },
-    { "咸度", "鹹度" },
-    { "咸得", "鹹得" },
-    { "咸批", "鹹批" },
-    { "咸水", "鹹水" },
-    { "咸汤", "鹹湯" },
-    { "咸派", "鹹派" },
-    { "咸海", "鹹海" },
-    { "咸淡", "鹹淡" },
-    { "咸湖", "鹹湖" },
-    { "咸潟", "鹹潟" },
-    { "咸猪肉", "鹹豬肉" },
-    { "咸的", "鹹的" },
-    { "咸类", "鹹類" },
-    { "咸粥", "鹹粥" },
-    { "咸肉", "鹹肉" },
-    { "咸菜", "鹹菜" },
-    { "咸菜干", "鹹菜乾" },
-    { "咸蛋", "鹹蛋" },
-    { "咸食", "鹹食" },
-    { "咸鱼", "鹹魚" },
-    { "咸鸭蛋", "鹹鴨蛋" },
-    { "哀吊", "哀弔" },
-    { "哀挽", "哀輓" },
-    { "品汇", "品彙" },
-    { "哄动", "鬨動" },
-    { "哄堂", "鬨堂" },
-    { "哄笑", "鬨笑" },
-    { "响", "響" },
-    { "响钟", "響鐘" },
-    { "哑", "啞" },
-    { "哒", "噠" },
-    { "哓", "嘵" },
-    { "哔", "嗶" },
-    { "哕", "噦" },
-    { "哗", "嘩" },
-    { "哙", "噲" },
-    { "哜", "嚌" },
-    { "哝", "噥" },
-    { "哟", "喲" },
-    { "哪里", "哪裡" },
-    { "哭脏", "哭髒" },
-    { "唁吊", "唁弔" },
-    { "唇干", "唇乾" },
-    { "唛", "嘜" },
-    { "唠", "嘮" },
-    { "唢", "嗩" },
-    { "唤", "喚" },
-    { "唱游", "唱遊" },
-    { "唾余", "唾餘" },
-    { "唾面自干", "唾面自乾" },
-    { "商历", "商曆" },
-    { "啧", "嘖" },
-    { "啬", "嗇" },
-    { "啭", "囀" },
-    { "啮", "嚙" },
-    { "啷当", "啷噹" },
-    { "啸", "嘯" },
-    { "喂乳", "餵乳" },
-    { "喂了", "餵了" },
-    { "喂养", "餵養" },
-    { "喂奶", "餵奶" },
-    { "喂猪", "餵豬" },
-    { "喂给", "餵給" },
-    { "喂羊", "餵羊" },
-    { "喂过", "餵過" },
-    { "喂食", "餵食" },
-    { "喂饱", "餵飽" },
-    { "喂驴", "餵驢" },
-    { "喂鱼", "餵魚" },
-    { "喂鸡", "餵雞" },
-    { "喂鸭", "餵鴨" },
-    { "喂鹅", "餵鵝" },
-    { "喜欢表", "喜歡錶" },
-    { "喜欢钟", "喜歡鐘" },
-    { "喝干", "喝乾" },
-    { "喧哄", "喧鬨" },
-    { "喷", "噴" },
-    { "喷洒", "噴洒" },
-    { "喽", "嘍" },
-    { "喾", "嚳" },
-    { "嗑药", "嗑藥" },
-    { "嗫", "囁" },
-    { "嗳", "噯" },
-    { "嘀嗒的表", "嘀嗒的錶" },
-    { "嘉肴", "嘉肴" },
-    { "嘉谷", "嘉穀" },
-    { "嘘", "噓" },
-    { "嘤", "嚶" },
-    { "嘱", "囑" },
-    { "嘱托", "囑託" },
-    { "嘴里", "嘴裡" },
-    { "噙齿戴发", "噙齒戴髮" },
-    { "噜", "嚕" },
-    { "噜苏", "嚕囌" },
-    { "嚣", "囂" },
-    { "嚼谷", "嚼穀" },
-    { "囉囉苏苏", "囉囉囌囌" },
-    { "囉苏", "囉囌" },
-    { "四余", "四餘" },
-    { "四出", "四齣" },
-    { "四出征收", "四出徵收" },
-    { "四分历", "四分曆" },
-    { "四只", "四隻" },
-    { "四扎", "四紮" },
-    { "四舍五入", "四捨五入" },
-    { "四舍六入", "四捨六入" },
-    { "四面钟", "四面鐘" },
-    { "回光返照", "迴光返照" },
-    { "回历", "回曆" },
-    { "回向", "迴向" },
-    { "回响", "迴響" },
-    { "回圈", "迴圈" },
-    { "回廊", "迴廊" },
-    { "回形夹", "迴形夾" },
-    { "回文", "迴文" },
-    { "回旋", "迴旋" },
-    { "回流", "迴流" },
-    { "回游", "回遊" },
-    { "回环", "迴環" },
-    { "回着", "回著" },
-    { "回纹针", "迴紋針" },
-    { "回绕", "迴繞" },
-    { "回翔", "迴翔" },
-    { "回肠", "迴腸" },
-    { "回荡", "回蕩" },
-    { "回诵", "迴誦" },
-    { "回路", "迴路" },
-    { "回转", "迴轉" },
-    { "回递性", "迴遞性" },
-    { "回避", "迴避" },
-    { "回采", "回採" },
-    { "回銮", "迴鑾" },
-    { "回阳荡气", "回陽蕩氣" },
-    { "回音", "迴音" },
-    { "回风", "迴風" },
-    { "团", "團" },
-    { "团子", "糰子" },
-    { "园", "園" },
-    { "园游会", "園遊會" },
-    { "园里", "園裡" },
-    { "困乏", "睏乏" },
-    { "困倦", "睏倦" },
-    { "困兽之斗", "困獸之鬥" },
-    { "困兽犹斗", "困獸猶鬥" },
-    { "困斗", "困鬥" },
-    { "困觉", "睏覺" },
-    { "囱", "囪" },
-    { "围", "圍" },
-    { "囵", "圇" },
-    { "固征", "固徵" },
-    { "国", "國" },
-    { "国之桢干", "國之楨榦" },
-    { "国仇", "國讎" },
-    { "国历", "國曆" },
-    { "图", "圖" },
-    { "图里", "圖裡" },
-    { "图鉴", "圖鑑" },
-    { "圆", "圓" },
-    { "圈占", "圈佔" },
-    { "圈子里", "圈子裡" },
-    { "圈梁", "圈樑" },
-    { "圈里", "圈裡" },
-    { "土制", "土製" },
-    { "土里", "土裡" },
-    { "圣", "聖" },
-    { "圣后", "聖后" },
-    { "在克制", "在剋制" },
-    { "地丑德齐", "地醜德齊" },
-    { "地克制", "地剋制" },
-    { "地占", "地佔" },
-    { "地心历表", "地心曆表" },
-    { "地志", "地誌" },
-    { "圹", "壙" },
-    { "场", "場" },
-    { "坏", "壞" },
-    { "坏于", "坏於" },
-    { "坐如钟", "坐如鐘" },
-    { "坐庄", "坐莊" },
-    { "坐钟", "坐鐘" },
-    { "坑里", "坑裡" },
-    { "块", "塊" },
-    { "坚", "堅" },
-    { "坚致", "堅緻" },
-    { "坛", "壇" },
-    { "坛坛罐罐", "罈罈罐罐" },
-    { "坛子", "罈子" },
-    { "坛騞", "罈騞" },
-    { "坜", "壢" },
-    { "坝", "壩" },
-    { "坞", "塢" },
-    { "坟", "墳" },
-    { "坠", "墜" },
-    { "坤范", "坤範" },
-    { "坦荡", "坦蕩" },
-    { "坦荡荡", "坦蕩蕩" },
-    { "坱郁", "坱鬱" },
-    { "垂发", "垂髮" },
-    { "垂范", "垂範" },
-    { "垄", "壟" },
-    { "垆", "壚" },
-    { "型范", "型範" },
-    { "垒", "壘" },
-    { "垦", "墾" },
-    { "垦复", "墾複" },
-    { "垦辟", "墾闢" },
-    { "垩", "堊" },
-    { "垫", "墊" },
-    { "垭", "埡" },
-    { "垲", "塏" },
-    { "埃及历", "埃及曆" },
-    { "埃及艳后", "埃及豔后" },
-    { "埃荣冲", "埃榮衝" },
-    { "埋头寻表", "埋頭尋錶" },
-    { "埋头寻钟", "埋頭尋鐘" },
-    { "城里", "城裡" },
-    { "埔裡社撫墾局", "埔裏社撫墾局" },
-    { "埔里社抚垦局", "埔裏社撫墾局" },
-    { "埘", "塒" },
-    { "埙", "塤" },
-    { "埚", "堝" },
-    { "埯", "垵" },
-    { "基准", "基準" },
-    { "基干", "基幹" },
-    { "堑", "塹" },
-    { "堕", "墮" },
-    { "堕胎药", "墮胎藥" },
-    { "堙淀", "堙澱" },
-    { "塞药", "塞藥" },
-    { "墓志", "墓誌" },
-    { "墙", "牆" },
-    { "墙里", "牆裡" },
-    { "增辟", "增闢" },
-    { "墨沈未干", "墨瀋未乾" },
-    { "壮", "壯" },
-    { "壮游", "壯遊" },
-    { "壮面", "壯麵" },
-    { "声", "聲" },
-    { "壳", "殼" },
-    { "壳里", "殼裡" },
-    { "壶", "壺" },
-    { "壶里", "壺裡" },
-    { "壹郁", "壹鬱" },
-    { "处", "處" },
-    { "备", "備" },
-    { "备注", "備註" },
-    { "复", "復" },
-    { "复习", "複習" },
-    { "复亩珍", "複畝珍" },
-    { "复仞年如", "複仞年如" },
-    { "复以百万", "複以百萬" },
-    { "复位", "複位" },
-    { "复信", "複信" },
-    { "复元音", "複元音" },
-    { "复写", "複寫" },
-    { "复决", "複決" },
-    { "复函数", "複函數" },
-    { "复分数", "複分數" },
-    { "复分析", "複分析" },
-    { "复分解", "複分解" },
-    { "复列", "複列" },
-    { "复利", "複利" },
-    { "复制", "複製" },
-    { "复印", "複印" },
-    { "复发", "複發" },
-    { "复变函数", "複變函數" },
-    { "复句", "複句" },
-    { "复叶", "複葉" },
-    { "复合", "複合" },
-    { "复名", "複名" },
-    { "复员", "複員" },
-    { "复壁", "複壁" },
-    { "复壮", "複壯" },
-    { "复复", "複復" },
-    { "复姓", "複姓" },
-    { "复字键", "複字鍵" },
-    { "复审", "複審" },
-    { "复对数", "複對數" },
-    { "复平面", "複平面" },
-    { "复式", "複式" },
-    { "复数", "複數" },
-    { "复本", "複本" },
-    { "复杂", "複雜" },
-    { "复查", "複查" },
-    { "复核", "複核" },
-    { "复检", "複檢" },
-    { "复次", "複次" },
-    { "复比", "複比" },
-    { "复活节历表", "復活節曆表" },
-    { "复流", "複流" },
-    { "复测", "複測" },
-    { "复电", "複電" },
-    { "复目", "複目" },
-    { "复眼", "複眼" },
-    { "复种", "複種" },
-    { "复线", "複線" },
-    { "复色", "複色" },
-    { "复议", "複議" },
-    { "复评", "複評" },
-    { "复诊", "複診" },
-    { "复词", "複詞" },
-    { "复试", "複試" },
-    { "复课", "複課" },
-    { "复赛", "複賽" },
-    { "复辅音", "複輔音" },
-    { "复述", "複述" },
-    { "复选", "複選" },
-    { "复钱", "複錢" },
-    { "复阅", "複閱" },
-    { "复音", "複音" },
-    { "复韵", "複韻" },
-    { "夏于乔", "夏于喬" },
-    { "夏于喬", "夏于喬" },
-    { "夏历", "夏曆" },
-    { "夏天里", "夏天裡" },
-    { "夏日里", "夏日裡" },
-    { "夏游", "夏遊" },
-    { "外制", "外製" },
-    { "外强中干", "外強中乾" },
-    { "多丑", "多醜" },
-    { "多么", "多麼" },
-    { "多余", "多餘" },
-    { "多冲", "多衝" },
-    { "多占", "多佔" },
-    { "多只", "多隻" },
-    { "夜光表", "夜光錶" },
-    { "夜游", "夜遊" },
-    { "夜里", "夜裡" },
-    { "够", "夠" },
-    { "够克制", "夠剋制" },
-    { "大伙", "大夥" },
-    { "大历", "大曆" },
-    { "大只", "大隻" },
-    { "大呆", "大獃" },
-    { "大周折", "大週摺" },
-    { "大型钟", "大型鐘" },
-    { "大干", "大幹" },
-    { "大批涌到", "大批湧到" },
-    { "大折儿", "大摺兒" },
-    { "大明历", "大明曆" },
-    { "大曲", "大麴" },
-    { "大本钟", "大本鐘" },
-    { "大病初愈", "大病初癒" },
-    { "大目干连", "大目乾連" },
-    { "大笨钟", "大笨鐘" },
-    { "大蜡", "大蜡" },
-    { "大衍历", "大衍曆" },
-    { "大言非夸", "大言非夸" },
-    { "大赞", "大讚" },
-    { "大钟", "大鐘" },
-    { "大锤", "大鎚" },
-    { "天克地冲", "天克地衝" },
-    { "天历", "天曆" },
-    { "天后", "天后" },
-    { "天地为范", "天地為範" },
-    { "天干物燥", "天乾物燥" },
-    { "天文历表", "天文曆表" },
-    { "天文学钟", "天文學鐘" },
-    { "天文钟", "天文鐘" },
-    { "太仆", "太僕" },
-    { "太初历", "太初曆" },
-    { "太后", "太后" },
-    { "夯干", "夯幹" },
-    { "头", "頭" },
-    { "头发", "頭髮" },
-    { "头巾吊在水里", "頭巾弔在水裡" },
-    { "头里", "頭裡" },
-    { "夸", "誇" },
-    { "夸丽", "夸麗" },
-    { "夸人", "夸人" },
-    { "夸克", "夸克" },
-    { "夸多斗靡", "誇多鬥靡" },
-    { "夸夸其谈", "夸夸其談" },
-    { "夸姣", "夸姣" },
-    { "夸容", "夸容" },
-    { "夸毗", "夸毗" },
-    { "夸父", "夸父" },
-    { "夸特", "夸特" },
-    { "夸脱", "夸脫" },
-    { "夸诞", "夸誕" },
-    { "夸赞", "誇讚" },
-    { "夹", "夾" },
-    { "夺", "奪" },
-    { "夺斗", "奪鬥" },
-    { "奁", "奩" },
-    { "奂", "奐" },
-    { "奇丑", "奇醜" },
-    { "奇迹", "奇蹟" },
-    { "奋", "奮" },
-    { "奋斗", "奮鬥" },
-    { "奏折", "奏摺" },
-    { "奖", "獎" },
-    { "奖杯", "獎盃" },
-    { "奥", "奧" },
-    { "奥占", "奧佔" },
-    { "女仆", "女僕" },
-    { "女佣", "女傭" },
-    { "奴仆", "奴僕" },
-    { "奸夫", "姦夫" },
-    { "奸妇", "姦婦" },
-    { "奸宄", "姦宄" },
-    { "奸情", "姦情" },
-    { "奸杀", "姦殺" },
-    { "奸污", "姦汙" },
-    { "奸淫", "姦淫" },
-    { "奸猾", "姦猾" },
-    { "奸细", "姦細" },
-    { "奸邪", "姦邪" },
-    { "她克制", "她剋制" },
-    { "好丑", "好醜" },
-    { "好呆", "好獃" },
-    { "好困", "好睏" },
-    { "好家伙", "好傢夥" },
-    { "好干", "好乾" },
-    { "好斗", "好鬥" },
-    { "好签", "好籤" },
-    { "如果干", "如果幹" },
-    { "如饥似渴", "如饑似渴" },
-    { "妆", "妝" },
-    { "妇", "婦" },
-    { "妈", "媽" },
-    { "妖后", "妖后" },
-    { "妙药", "妙藥" },
-    { "妩", "嫵" },
-    { "妪", "嫗" },
-    { "妫", "媯" },
-    { "委托", "委託" },
-    { "姗", "姍" },
-    { "姜丝", "薑絲" },
-    { "姜文杰", "姜文杰" },
-    { "姜是老的辣", "薑是老的辣" },
-    { "姜末", "薑末" },
-    { "姜桂", "薑桂" },
-    { "姜母", "薑母" },
-    { "姜汁", "薑汁" },
-    { "姜汤", "薑湯" },
-    { "姜片", "薑片" },
-    { "姜糖", "薑糖" },
-    { "姜老辣", "薑老辣" },
-    { "姜茶", "薑茶" },
-    { "姜蓉", "薑蓉" },
-    { "姜饼", "薑餅" },
-    { "姜黄", "薑黃" },
-    { "姹", "奼" },
-    { "威棱", "威稜" },
-    { "娄", "婁" },
-    { "娅", "婭" },
-    { "娆", "嬈" },
-    { "娇", "嬌" },
-    { "娈", "孌" },
-    { "娱", "娛" },
-    { "娲", "媧" },
-    { "娲杆", "媧杆" },
-    { "娴", "嫻" },
-    { "婢仆", "婢僕" },
-    { "婴", "嬰" },
-    { "婵", "嬋" },
-    { "婶", "嬸" },
-    { "媪", "媼" },
-    { "嫌凶", "嫌兇" },
-    { "嫌好道丑", "嫌好道醜" },
-    { "嫒", "嬡" },
-    { "嫔", "嬪" },
-    { "嫱", "嬙" },
-    { "嬉游", "嬉遊" },
-    { "嬖幸", "嬖倖" },
-    { "嬴余", "嬴餘" },
-    { "嬷", "嬤" },
-    { "子之丰兮", "子之丰兮" },
-    { "子云", "子云" },
-    { "字汇", "字彙" },
-    { "字里行间", "字裡行間" },
-    { "存折", "存摺" },
-    { "孙", "孫" },
-    { "学", "學" },
-    { "学里", "學裡" },
-    { "孪", "孿" },
-    { "宁", "寧" },
-    { "宇宙志", "宇宙誌" },
-    { "安沈铁路", "安瀋鐵路" },
-    { "安眠药", "安眠藥" },
-    { "安胎药", "安胎藥" },
-    { "宗周钟", "宗周鐘" },
-    { "官历", "官曆" },
-    { "官地为采", "官地為寀" },
-    { "官庄", "官莊" },
-    { "定准", "定準" },
-    { "定制", "定製" },
-    { "宜云", "宜云" },
-    { "宝", "寶" },
-    { "宝历", "寶曆" },
-    { "宝庄", "寶莊" },
-    { "宝里宝气", "寶裡寶氣" },
-    { "实", "實" },
-    { "实干", "實幹" },
-    { "宠", "寵" },
-    { "审", "審" },
-    { "宣泄", "宣洩" },
-    { "宦游", "宦遊" },
-    { "宪", "憲" },
-    { "宫", "宮" },
-    { "宫里", "宮裡" },
-    { "宴游", "宴遊" },
-    { "家丑", "家醜" },
-    { "家仆", "家僕" },
-    { "家伙", "傢伙" },
-    { "家俱", "傢俱" },
-    { "家具", "傢具" },
-    { "家庄", "家莊" },
-    { "家里", "家裡" },
-    { "容范", "容範" },
-    { "宽", "寬" },
-    { "宽余", "寬餘" },
-    { "宽宽松松", "寬寬鬆鬆" },
-    { "宽松", "寬鬆" },
-    { "宾", "賓" },
-    { "寄托", "寄託" },
-    { "密致", "密緻" },
-    { "寇仇", "寇讎" },
-    { "寇准", "寇準" },
-    { "富余", "富餘" },
-    { "寒假里", "寒假裡" },
-    { "寒栗", "寒慄" },
-    { "寝", "寢" },
-    { "寡占", "寡佔" },
-    { "寡欲", "寡慾" },
-    { "寮采", "寮寀" },
-    { "寸发千金", "寸髮千金" },
-    { "对", "對" },
-    { "对准", "對準" },
-    { "对准表", "對準錶" },
-    { "对准钟", "對準鐘" },
-    { "对折", "對摺" },
-    { "对表", "對錶" },
-    { "寺钟", "寺鐘" },
-    { "寻", "尋" },
-    { "导", "導" },
-    { "导游", "導遊" },
-    { "寿", "壽" },
-    { "寿面", "壽麵" },
-    { "封后", "封后" },
-    { "封面里", "封面裡" },
-    { "射雕", "射鵰" },
-    { "将", "將" },
-    { "将占", "將佔" },
-    { "尊后", "尊后" },
-    { "小仆", "小僕" },
-    { "小价", "小价" },
-    { "小伙子", "小夥子" },
-    { "小几", "小几" },
-    { "小只", "小隻" },
-    { "小型钟", "小型鐘" },
-    { "小米面", "小米麵" },
-    { "少占", "少佔" },
-    { "少采", "少採" },
-    { "尔", "爾" },
-    { "尔冬升", "爾冬陞" },
-    { "尘", "塵" },
-    { "尝", "嘗" },
-    { "尧", "堯" },
-    { "就克制", "就剋制" },
-    { "就范", "就範" },
-    { "就里", "就裡" },
-    { "尴", "尷" },
-    { "尸", "屍" },
-    { "尸位素餐", "尸位素餐" },
-    { "尸利", "尸利" },
-    { "尸居余气", "尸居餘氣" },
-    { "尸弃佛", "尸棄佛" },
-    { "尸祝", "尸祝" },
-    { "尸禄", "尸祿" },
-    { "尸罗精舍", "尸羅精舍" },
-    { "尸羅精舍", "尸羅精舍" },
-    { "尸臣", "尸臣" },
-    { "尸谏", "尸諫" },
-    { "尸魂界", "尸魂界" },
-    { "尸鸠", "尸鳩" },
-    { "尽", "盡" },
-    { "尽先", "儘先" },
-    { "尽其所有", "儘其所有" },
-    { "尽力", "儘力" },
-    { "尽可能", "儘可能" },
-    { "尽尽", "儘儘" },
-    { "尽快", "儘快" },
-    { "尽早", "儘早" },
-    { "尽是", "儘是" },
-    { "尽管", "儘管" },
-    { "尽速", "儘速" },
-    { "尽量克制", "盡量剋制" },
-    { "局里", "局裡" },
-    { "屁股大吊了心", "屁股大弔了心" },
-    { "层", "層" },
-    { "屉", "屜" },
-    { "届", "屆" },
-    { "屋子里", "屋子裡" },
-    { "屋梁", "屋樑" },
-    { "屋里", "屋裡" },
-    { "属", "屬" },
-    { "属托", "屬託" },
-    { "屡", "屢" },
-    { "屡顾尔仆", "屢顧爾僕" },
-    { "屦", "屨" },
-    { "屯扎", "屯紮" },
-    { "屯里", "屯裡" },
-    { "山岳", "山嶽" },
-    { "山崩钟应", "山崩鐘應" },
-    { "山庄", "山莊" },
-    { "山梁", "山樑" },
-    { "山棱", "山稜" },
-    { "山洞里", "山洞裡" },
-    { "山羊胡", "山羊鬍" },
-    { "山药", "山藥" },
-    { "山里", "山裡" },
-    { "山重水复", "山重水複" },
-    { "屿", "嶼" },
-    { "岁", "歲" },
-    { "岁聿云暮", "歲聿云暮" },
-    { "岂", "豈" },
-    { "岖", "嶇" },
-    { "岗", "崗" },
-    { "岘", "峴" },
-    { "岙", "嶴" },
-    { "岚", "嵐" },
-    { "岛", "島" },
-    { "岭", "嶺" },
-    { "岱岳", "岱嶽" },
-    { "岳岳", "嶽嶽" },
-    { "岳麓", "嶽麓" },
-    { "岿", "巋" },
-    { "峄", "嶧" },
-    { "峡", "峽" },
-    { "峤", "嶠" },
-    { "峥", "崢" },
-    { "峦", "巒" },
-    { "峰回", "峰迴" },
-    { "峻岭", "峻岭" },
-    { "崂", "嶗" },
-    { "崃", "崍" },
-    { "崖广", "崖广" },
-    { "崭", "嶄" },
-    { "嵘", "嶸" },
-    { "嵝", "嶁" },
-    { "嶒棱", "嶒稜" },
-    { "巅", "巔" },
-    { "川谷", "川穀" },
-    { "巡回", "巡迴" },
-    { "巡游", "巡遊" },
-    { "工致", "工緻" },
-    { "左冲右突", "左衝右突" },
-    { "巧历", "巧曆" },
-    { "巧干", "巧幹" },
-    { "巩", "鞏" },
-    { "巯", "巰" },
-    { "已占", "已佔" },
-    { "巴尔干", "巴爾幹" },
-    { "巷里", "巷裡" },
-    { "币", "幣" },
-    { "市占", "市佔" },
-    { "市里", "市裡" },
-    { "布于", "佈於" },
-    { "布庄", "布莊" },
-    { "布谷", "布穀" },
-    { "布谷鸟钟", "布穀鳥鐘" },
-    { "布道", "佈道" },
-    { "布雷封锁", "佈雷封鎖" },
-    { "布雷的", "佈雷的" },
-    { "布雷舰", "佈雷艦" },
-    { "布雷艇", "佈雷艇" },
-    { "布雷速度", "佈雷速度" },
-    { "帅", "帥" },
-    { "师", "師" },
-    { "师范", "師範" },
-    { "希伯来历", "希伯來曆" },
-    { "帏", "幃" },
-    { "帐", "帳" },
-    { "帘", "簾" },
-    { "帘子", "帘子" },
-    { "帘布", "帘布" },
-    { "帜", "幟" },
-    { "帝后台", "帝后臺" },
-    { "带", "帶" },
-    { "带发修行", "帶髮修行" },
-    { "带征", "帶徵" },
-    { "帧", "幀" },
-    { "席卷", "席捲" },
-    { "帮", "幫" },
-    { "帮佣", "幫傭" },
-    { "帱", "幬" },
-    { "帻", "幘" },
-    { "帼", "幗" },
-    { "幂", "冪" },
-    { "幞", "襆" },
-    { "干上", "幹上" },
-    { "干下去", "幹下去" },
-    { "干不了", "幹不了" },
-    { "干不成", "幹不成" },
-    { "干丝", "乾絲" },
-    { "干个", "幹個" },
-    { "干个够", "乾個夠" },
-    { "干么", "幹麼" },
-    { "干乔", "乾喬" },
-    { "干了", "幹了" },
-    { "干事", "幹事" },
-    { "干井", "乾井" },
-    { "干些", "幹些" },
-    { "干产", "乾產" },
-    { "干亲", "乾親" },
-    { "干人", "幹人" },
-    { "干什么", "幹什麼" },
-    { "干儿", "乾兒" },
-    { "干冰", "乾冰" },
-    { "干冷", "乾冷" },
-    { "干净", "乾淨" },
-    { "干凉", "乾涼" },
-    { "干刍", "乾芻" },
-    { "干刻版", "乾刻版" },
-    { "干剥剥", "乾剝剝" },
-    { "干办", "幹辦" },
-    { "干劲", "幹勁" },
-    { "干劲冲天", "幹勁沖天" },
-    { "干卦", "乾卦" },
-    { "干台", "乾颱" },
-    { "干号", "乾號" },
-    { "干吊着下巴", "乾吊著下巴" },
-    { "干吏", "幹吏" },
-    { "干吗", "幹嗎" },
-    { "干呕", "乾嘔" },
-    { "干员", "幹員" },
-    { "干和", "乾和" },
-    { "干咳", "乾咳" },
-    { "干咽", "乾咽" },
-    { "干哕", "乾噦" },
-    { "干哥", "乾哥" },
-    { "干哭", "乾哭" },
-    { "干唱", "乾唱" },
-    { "干啥", "幹啥" },
-    { "干啼", "乾啼" },
-    { "干嘛", "幹嘛" },
-    { "干嚎", "乾嚎" },
-    { "干回付", "乾回付" },
-    { "干圆洁净", "乾圓潔淨" },
-    { "干地", "乾地" },
-    { "干坏事", "幹壞事" },
-    { "干坞", "乾塢" },
-    { "干坤", "乾坤" },
-    { "干头", "幹頭" },
-    { "干女", "乾女" },
-    { "干奴才", "乾奴才" },
-    { "干妈", "乾媽" },
-    { "干妹", "乾妹" },
-    { "干姊", "乾姊" },
-    { "干姜", "乾薑" },
-    { "干娘", "乾娘" },
-    { "干子", "乾子" },
-    { "干季", "乾季" },
-    { "干完", "幹完" },
-    { "干家", "幹家" },
-    { "干将", "幹將" },
-    { "干尸", "乾屍" },
-    { "干屎橛", "乾屎橛" },
-    { "干巴", "乾巴" },
-    { "干干", "乾乾" },
-    { "干干净净", "乾乾淨淨" },
-    { "干式", "乾式" },
-    { "干弟", "乾弟" },
-    { "干当", "幹當" },
-    { "干得", "幹得" },
-    { "干急", "乾急" },
-    { "干性", "乾性" },
-    { "干性油", "幹性油" },
-    { "干才", "幹才" },
-    { "干打雷", "乾打雷" },
-    { "干折", "乾折" },
-    { "干掉", "幹掉" },
-    { "干探", "幹探" },
-    { "干撂台", "乾撂台" },
-    { "干撇下", "乾撇下" },
-    { "干擦", "乾擦" },
-    { "干支剌", "乾支剌" },
-    { "干支支", "乾支支" },
-    { "干料", "乾料" },
-    { "干旱", "乾旱" },
-    { "干暖", "乾暖" },
-    { "干材", "乾材" },
-    { "干村沙", "乾村沙" },
-    { "干杯", "乾杯" },
-    { "干果", "乾果" },
-    { "干枯", "乾枯" },
-    { "干柴", "乾柴" },
-    { "干校", "幹校" },
-    { "干梅", "乾梅" },
-    { "干死", "乾死" },
-    { "干池", "乾池" },
-    { "干沟", "乾溝" },
-    { "干没", "乾沒" },
-    { "干洗", "乾洗" },
-    { "干活", "幹活" },
-    { "干流", "幹流" },
-    { "干济", "幹濟" },
-    { "干涩", "乾澀" },
-    { "干涸", "乾涸" },
-    { "干渠", "乾渠" },
-    { "干渴", "乾渴" },
-    { "干湿", "乾濕" },
-    { "干漆", "乾漆" },
-    { "干灯盏", "乾燈盞" },
-    { "干热", "乾熱" },
-    { "干熬", "乾熬" },
-    { "干熱", "乾熱" },
-    { "干燥", "乾燥" },
-    { "干父之蛊", "幹父之蠱" },
-    { "干爸", "乾爸" },
-    { "干爹", "乾爹" },
-    { "干爽", "乾爽" },
-    { "干片", "乾片" },
-    { "干球温度", "幹球溫度" },
-    { "干甚么", "幹甚麼" },
-    { "干生受", "乾生受" },
-    { "干生子", "乾生子" },
-    { "干田", "乾田" },
-    { "干电", "乾電" },
-    { "干略", "幹略" },
-    { "干疥", "乾疥" },
-    { "干瘦", "乾瘦" },
-    { "干瘪", "乾癟" },
-    { "干瘾", "乾癮" },
-    { "干癣", "乾癬" },
-    { "干白儿", "乾白兒" },
-    { "干的", "乾的" },
-    { "干的停当", "幹的停當" },
-    { "干眼", "乾眼" },
-    { "干着", "乾著" },
-    { "干着急", "干著急" },
-    { "干瞪眼", "乾瞪眼" },
-    { "干礼", "乾禮" },
-    { "干稿", "乾稿" },
-    { "干笑", "乾笑" },
-    { "干等", "乾等" },
-    { "干篾片", "乾篾片" },
-    { "干粉", "乾粉" },
-    { "干粮", "乾糧" },
-    { "干糇", "乾餱" },
-    { "干系", "干係" },
-    { "干細胞", "幹細胞" },
-    { "干纲", "乾綱" },
-    { "干线", "幹線" },
-    { "干练", "幹練" },
-    { "干细胞", "幹細胞" },
-    { "干结", "乾結" },
-    { "干绷", "乾繃" },
-    { "干缺", "幹缺" },
-    { "干群关系", "幹群關係" },
-    { "干耗", "乾耗" },
-    { "干肉片", "乾肉片" },
-    { "干股", "乾股" },
-    { "干肥", "乾肥" },
-    { "干脆", "乾脆" },
-    { "干花", "乾花" },
-    { "干苔", "乾苔" },
-    { "干茨腊", "乾茨臘" },
-    { "干茶钱", "乾茶錢" },
-    { "干草", "乾草" },
-    { "干菜", "乾菜" },
-    { "干营生", "幹營生" },
-    { "干落", "乾落" },
-    { "干薪", "乾薪" },
-    { "干虔", "乾虔" },
-    { "干蛊", "幹蠱" },
-    { "干血浆", "乾血漿" },
-    { "干衣", "乾衣" },
-    { "干裂", "乾裂" },
-    { "干警", "幹警" },
-    { "干贝", "乾貝" },
-    { "干货", "乾貨" },
-    { "干起来", "幹起來" },
-    { "干路", "幹路" },
-    { "干躁", "乾躁" },
-    { "干这一行", "幹這一行" },
-    { "干这种事", "幹這種事" },
-    { "干逼", "乾逼" },
-    { "干道", "幹道" },
-    { "干部", "幹部" },
-    { "干酪", "乾酪" },
-    { "干酵母", "乾酵母" },
-    { "干醋", "乾醋" },
-    { "干重", "乾重" },
-    { "干量", "乾量" },
-    { "干阿奶", "乾阿奶" },
-    { "干隆", "乾隆" },
-    { "干雷", "乾雷" },
-    { "干霍乱", "乾霍亂" },
-    { "干面", "乾麵" },
-    { "干革命", "幹革命" },
-    { "干颡", "乾顙" },
-    { "干饭", "乾飯" },
-    { "干馆", "乾館" },
-    { "干馏", "乾餾" },
-    { "干鱼", "乾魚" },
-    { "干鲜", "乾鮮" },
-    { "平准", "平準" },
-    { "平泉庄", "平泉莊" },
-    { "年代里", "年代裡" },
-    { "年历", "年曆" },
-    { "年谷", "年穀" },
-    { "年里", "年裡" },
-    { "并", "並" },
-    { "并一不二", "併一不二" },
-    { "并为一体", "併為一體" },
-    { "并为一家", "併為一家" },
-    { "并产", "併產" },
-    { "并入", "併入" },
-    { "并兼", "併兼" },
-    { "并到", "併到" },
-    { "并力", "并力" },
-    { "并发型模式", "併發型模式" },
-    { "并发模式", "併發模式" },
-    { "并发症", "併發症" },
-    { "并发重症", "併發重症" },
-    { "并叠", "併疊" },
-    { "并合", "併合" },
-    { "并名", "併名" },
-    { "并吞", "并吞" },
-    { "并吞下", "併吞下" },
-    { "并存着", "並存著" },
-    { "并州", "并州" },
-    { "并当", "併當" },
-    { "并拢", "併攏" },
-    { "并日而食", "并日而食" },
-    { "并曰入淀", "並曰入澱" },
-    { "并案", "併案" },
-    { "并流", "併流" },
-    { "并火", "併火" },
-    { "并科", "併科" },
-    { "并线", "併線" },
-    { "并网", "併網" },
-    { "并肩子", "併肩子" },
-    { "并购", "併購" },
-    { "并迭", "并迭" },
-    { "并除", "併除" },
-    { "并骨", "併骨" },
-    { "幸免", "倖免" },
-    { "幸存", "倖存" },
-    { "幸幸", "倖幸" },
-    { "幸运胡", "幸運鬍" },
-    { "广", "廣" },
-    { "广征", "廣徵" },
-    { "广舍", "廣捨" },
-    { "广部", "广部" },
-    { "庄上", "莊上" },
-    { "庄严", "莊嚴" },
-    { "庄主", "莊主" },
-    { "庄农", "莊農" },
-    { "庄员", "莊員" },
-    { "庄周", "莊周" },
-    { "庄园", "莊園" },
-    { "庄士顿道", "莊士頓道" },
-    { "庄子", "莊子" },
-    { "庄客", "莊客" },
-    { "庄家", "莊家" },
-    { "庄户", "莊戶" },
-    { "庄房", "莊房" },
-    { "庄敬", "莊敬" },
-    { "庄田", "莊田" },
-    { "庄稼", "莊稼" },
-    { "庄舄越吟", "莊舄越吟" },
-    { "庄语", "莊語" },
-    { "庄里", "莊裡" },
-    { "庄重", "莊重" },
-    { "庄院", "莊院" },
-    { "庄骚", "莊騷" },
-    { "庆", "慶" },
-    { "庆历", "慶曆" },
-    { "庆吊", "慶弔" },
-    { "庐", "廬" },
-    { "庑", "廡" },
-    { "库", "庫" },
-    { "应", "應" },
-    { "应克制", "應剋制" },
-    { "应征", "應徵" },
-    { "应钟", "應鐘" },
-    { "店里", "店裡" },
-    { "庙", "廟" },
-    { "庙里", "廟裡" },
-    { "府干", "府幹" },
-    { "庞", "龐" },
-    { "废", "廢" },
-    { "废后", "廢后" },
-    { "座钟", "座鐘" },
-    { "康庄", "康莊" },
-    { "廢后", "廢后" },
-    { "廪", "廩" },
-    { "延历", "延曆" },
-    { "开", "開" },
-    { "开吊", "開弔" },
-    { "开哄", "開鬨" },
-    { "开征", "開徵" },
-    { "开药", "開藥" },
-    { "开辟", "開闢" },
-    { "开采", "開採" },
-    { "异", "異" },
-    { "弃", "棄" },
-    { "弃舍", "棄捨" },
-    { "弄丑", "弄醜" },
-    { "弄干", "弄乾" },
-    { "弄松", "弄鬆" },
-    { "弄脏", "弄髒" },
-    { "弄鬼吊猴", "弄鬼弔猴" },
-    { "弑", "弒" },
-    { "引斗", "引鬥" },
-    { "弘历", "弘曆" },
-    { "张", "張" },
-    { "张三丰", "張三丰" },
-    { "张乐于张徐", "張樂于張徐" },
-    { "张勋", "張勳" },
-    { "弥", "彌" },
-    { "弥山遍野", "瀰山遍野" },
-    { "弥弥", "瀰瀰" },
-    { "弥漫", "瀰漫" },
-    { "弥漫着", "瀰漫著" },
-    { "弪", "弳" },
-    { "弯", "彎" },
-    { "張三丰", "張三丰" },
-    { "弹", "彈" },
-    { "弹子台", "彈子檯" },
-    { "弹珠台", "彈珠檯" },
-    { "弹药", "彈藥" },
-    { "强", "強" },
-    { "强占", "強佔" },
-    { "强奸", "強姦" },
-    { "强干", "強幹" },
-    { "归", "歸" },
-    { "归余", "歸餘" },
-    { "归并", "歸併" },
-    { "当", "當" },
-    { "当准", "當準" },
-    { "当啷", "噹啷" },
-    { "当当", "噹噹" },
-    { "当着", "當著" },
-    { "录", "錄" },
-    { "录制", "錄製" },
-    { "录着", "錄著" },
-    { "形单影只", "形單影隻" },
-    { "形影相吊", "形影相弔" },
-    { "彦", "彥" },
-    { "彩带", "綵帶" },
-    { "彩排", "綵排" },
-    { "彩楼", "綵樓" },
-    { "彩牌楼", "綵牌樓" },
-    { "彩球", "綵球" },
-    { "彩线", "綵線" },
-    { "彩绸", "綵綢" },
-    { "彩船", "綵船" },
-    { "彩衣", "綵衣" },
-    { "彭于晏", "彭于晏" },
-    { "影后", "影后" },
-    { "彻", "徹" },
-    { "彼此克制", "彼此剋制" },
-    { "往复", "往複" },
-    { "往日無仇", "往日無讎" },
-    { "往里", "往裡" },
-    { "征人", "徵人" },
-    { "征令", "徵令" },
-    { "征信", "徵信" },
-    { "征候", "徵候" },
-    { "征兆", "徵兆" },
-    { "征兵", "徵兵" },
-    { "征到", "徵到" },
-    { "征募", "徵募" },
-    { "征占", "徵佔" },
-    { "征友", "徵友" },
-    { "征发", "徵發" },
-    { "征召", "徵召" },
-    { "征名责实", "徵名責實" },
-    { "征吏", "徵吏" },
-    { "征启", "徵啟" },
-    { "征咎", "徵咎" },
-    { "征圣", "徵聖" },
-    { "征士", "徵士" },
-    { "征婚", "徵婚" },
-    { "征实", "徵實" },
-    { "征庸", "徵庸" },
-    { "征引", "徵引" },
-    { "征得", "徵得" },
-    { "征怪", "徵怪" },
-    { "征才", "徵才" },
-    { "征招", "徵招" },
-    { "征收", "徵收" },
-    { "征效", "徵效" },
-    { "征文", "徵文" },
-    { "征求", "徵求" },
-    { "征状", "徵狀" },
-    { "征用", "徵用" },
-    { "征税", "徵稅" },
-    { "征稿", "徵稿" },
-    { "征答", "徵答" },
-    { "征结", "徵結" },
-    { "征聘", "徵聘" },
-    { "征训", "徵訓" },
-    { "征询", "徵詢" },
-    { "征调", "徵調" },
-    { "征象", "徵象" },
-    { "征购", "徵購" },
-    { "征车", "徵車" },
-    { "征辟", "徵辟" },
-    { "征迹", "徵跡" },
-    { "征选", "徵選" },
-    { "征逐", "徵逐" },
-    { "征集", "徵集" },
-    { "征风召雨", "徵風召雨" },
-    { "征验", "徵驗" },
-    { "径", "徑" },
-    { "很丑", "很醜" },
-    { "很凶", "很兇" },
-    { "很干", "很乾" },
-    { "律历志", "律曆志" },
-    { "徐干", "徐幹" },
-    { "徒托空言", "徒託空言" },
-    { "徕", "徠" },
-    { "得克制", "得剋制" },
-    { "御侮", "禦侮" },
-    { "御寇", "禦寇" },
-    { "御寒", "禦寒" },
-    { "御敌", "禦敵" },
-    { "德占", "德佔" },
-    { "心余", "心餘" },
-    { "心愿", "心愿" },
-    { "心系一", "心繫一" },
-    { "心系万", "心繫萬" },
-    { "心系东", "心繫東" },
-    { "心系两", "心繫兩" },
-    { "心系中", "心繫中" },
-    { "心系乔", "心繫乔" },
-    { "心系五", "心繫五" },
-    { "心系京", "心繫京" },
-    { "心系人", "心繫人" },
-    { "心系他", "心繫他" },
-    { "心系伊", "心繫伊" },
-    { "心系众", "心繫眾" },
-    { "心系传", "心繫傳" },
-    { "心系何", "心繫何" },
-    { "心系你", "心繫你" },
-    { "心系健", "心繫健" },
-    { "心系全", "心繫全" },
-    { "心系兰", "心繫蘭" },
-    { "心系农", "心繫农" },
-    { "心系功", "心繫功" },
-    { "心系动", "心繫動" },
-    { "心系募", "心繫募" },
-    { "心系北", "心繫北" },
-    { "心系十", "心繫十" },
-    { "心系千", "心繫千" },
-    { "心系南", "心繫南" },
-    { "心系台", "心繫台" },
-    { "心系和", "心繫和" },
-    { "心系哪", "心繫哪" },
-    { "心系唐", "心繫唐" },
-    { "心系嘱", "心繫囑" },
-    { "心系四", "心繫四" },
-    { "心系困", "心繫困" },
-    { "心系国", "心繫國" },
-    { "心系在", "心繫在" },
-    { "心系地", "心繫地" },
-    { "心系大", "心繫大" },
-    { "心系天", "心繫天" },
-    { "心系夫", "心繫夫" },
-    { "心系奥", "心繫奧" },
-    { "心系女", "心繫女" },
-    { "心系她", "心繫她" },
-    { "心系妇", "心繫婦" },
-    { "心系妻", "心繫妻" },
-    { "心系子", "心繫子" },
-    { "心系它", "心繫它" },
-    { "心系宣", "心繫宣" },
-    { "心系家", "心繫家" },
-    { "心系富", "心繫富" },
-    { "心系小", "心繫小" },
-    { "心系山", "心繫山" },
-    { "心系川", "心繫川" },
-    { "心系幼", "心繫幼" },
-    { "心系广", "心繫廣" },
-    { "心系彼", "心繫彼" },
-    { "心系德", "心繫德" },
-    { "心系您", "心繫您" },
-    { "心系慈", "心繫慈" },
-    { "心系我", "心繫我" },
-    { "心系摩", "心繫摩" },
-    { "心系故", "心繫故" },
-    { "心系新", "心繫新" },
-    { "心系日", "心繫日" },
-    { "心系昌", "心繫昌" },
-    { "心系晓", "心繫曉" },
-    { "心系曼", "心繫曼" },
-    { "心系林", "心繫林" },
-    { "心系母", "心繫母" },
-    { "心系民", "心繫民" },
-    { "心系江", "心繫江" },
-    { "心系汶", "心繫汶" },
-    { "心系沈", "心繫沈" },
-    { "心系沙", "心繫沙" },
-    { "心系泰", "心繫泰" },
-    { "心系浙", "心繫浙" },
-    { "心系港", "心繫港" },
-    { "心系湖", "心繫湖" },
-    { "心系澳", "心繫澳" },
-    { "心系灾", "心繫災" },
-    { "心系父", "心繫父" },
-    { "心系生", "心繫生" },
-    { "心系病", "心繫病" },
-    { "心系百", "心繫百" },
-    { "心系的", "心繫的" },
-    { "心系着", "心繫著" },
-    { "心系社", "心繫社" },
-    { "心系祖", "心繫祖" },
-    { "心系神", "心繫神" },
-    { "心系红", "心繫紅" },
-    { "心系美", "心繫美" },
-    { "心系群", "心繫群" },
-    { "心系老", "心繫老" },
-    { "心系舞", "心繫舞" },
-    { "心系英", "心繫英" },
-    { "心系茶", "心繫茶" },
-    { "心系西", "心繫西" },
-    { "心系贫", "心繫貧" },
-    { "心系输", "心繫輸" },
-    { "心系近", "心繫近" },
-    { "心系远", "心繫遠" },
-    { "心系选", "心繫選" },
-    { "心系重", "心繫重" },
-    { "心系长", "心繫長" },
-    { "心系阮", "心繫阮" },
-    { "心系震", "心繫震" },
-    { "心系非", "心繫非" },
-    { "心系风", "心繫風" },
-    { "心系香", "心繫香" },
-    { "心系高", "心繫高" },
-    { "心系麦", "心繫麥" },
-    { "心系黄", "心繫黃" },
-    { "心荡", "心蕩" },
-    { "心药", "心藥" },
-    { "心里", "心裡" },
-    { "心里面", "心裏面" },
-    { "心长发短", "心長髮短" },
-    { "忆", "憶" },
-    { "忏", "懺" },
-    { "志哀", "誌哀" },
-    { "志喜", "誌喜" },
-    { "志庆", "誌慶" },
-    { "志异", "誌異" },
-    { "忙并", "忙併" },
-    { "忙里", "忙裡" },
-    { "忙里偷闲", "忙裡偷閒" },
-    { "忠仆", "忠僕" },
-    { "忧", "憂" },
-    { "忧郁", "憂鬱" },
-    { "快克制", "快剋制" },
-    { "快冲", "快衝" },
-    { "快干", "快乾" },
-    { "忾", "愾" },
-    { "怀", "懷" },
-    { "怀表", "懷錶" },
-    { "怀里", "懷裡" },
-    { "怀钟", "懷鐘" },
-    { "态", "態" },
-    { "怂", "慫" },
-    { "怃", "憮" },
-    { "怄", "慪" },
-    { "怅", "悵" },
-    { "怆", "愴" },
-    { "怎么", "怎麼" },
-    { "怎么着", "怎麼著" },
-    { "怒发冲冠", "怒髮衝冠" },
-    { "怜", "憐" },
-    { "思如泉涌", "思如泉湧" },
-    { "急冲而下", "急衝而下" },
-    { "性征", "性徵" },
-    { "性欲", "性慾" },
-    { "怪里怪气", "怪裡怪氣" },
-    { "怫郁", "怫鬱" },
-    { "总", "總" },
-    { "怼", "懟" },
-    { "怿", "懌" },
-    { "恂栗", "恂慄" },
-    { "恋", "戀" },
-    { "恋恋不舍", "戀戀不捨" },
-    { "恒", "恆" },
-    { "恒生", "恒生" },
-    { "恕乏价催", "恕乏价催" },
-    { "息交绝游", "息交絕遊" },
-    { "息谷", "息穀" },
-    { "恰才", "恰纔" },
-    { "恳", "懇" },
-    { "恳托", "懇託" },
-    { "恶", "惡" },
-    { "恶心", "噁心" },
-    { "恶斗", "惡鬥" },
-    { "恶直丑正", "惡直醜正" },
-    { "恸", "慟" },
-    { "恹", "懨" },
-    { "恺", "愷" },
-    { "恻", "惻" },
-    { "恼", "惱" },
-    { "恽", "惲" },
-    { "悍药", "悍藥" },
-    { "悒郁", "悒鬱" },
-    { "悠悠荡荡", "悠悠蕩蕩" },
-    { "悠游", "悠遊" },
-    { "悠荡", "悠蕩" },
-    { "悦", "悅" },
-    { "您克制", "您剋制" },
-    { "悫", "愨" },
-    { "悬", "懸" },
-    { "悬梁", "懸樑" },
-    { "悬臂梁", "懸臂樑" },
-    { "悬钟", "懸鐘" },
-    { "悭", "慳" },
-    { "悯", "憫" },
-    { "悲筑", "悲筑" },
-    { "悲郁", "悲鬱" },
-    { "悸栗", "悸慄" },
-    { "情欲", "情慾" },
-    { "惇朴", "惇樸" },
-    { "惊", "驚" },
-    { "惊赞", "驚讚" },
-    { "惊钟", "驚鐘" },
-    { "惧", "懼" },
-    { "惨", "慘" },
-    { "惩", "懲" },
-    { "惫", "憊" },
-    { "惬", "愜" },
-    { "惭", "慚" },
-    { "惮", "憚" },
-    { "惯", "慣" },
-    { "想克制", "想剋制" },
-    { "惴栗", "惴慄" },
-    { "愈合", "癒合" },
-    { "意克制", "意剋制" },
-    { "意占", "意佔" },
-    { "意大利面", "意大利麵" },
-    { "意面", "意麵" },
-    { "感冒药", "感冒藥" },
-    { "愠", "慍" },
-    { "愤", "憤" },
-    { "愦", "憒" },
-    { "愿", "願" },
-    { "愿朴", "愿樸" },
-    { "愿而恭", "愿而恭" },
-    { "慌里慌张", "慌裡慌張" },
-    { "慑", "懾" },
-    { "懈松", "懈鬆" },
-    { "懑", "懣" },
-    { "懒", "懶" },
-    { "懔", "懍" },
-    { "懔栗", "懍慄" },
-    { "懿范", "懿範" },
-    { "戆", "戇" },
-    { "戋", "戔" },
-    { "戏", "戲" },
-    { "戏彩娱亲", "戲綵娛親" },
-    { "戏里", "戲裡" },
-    { "成药", "成藥" },
-    { "我克制", "我剋制" },
-    { "戗", "戧" },
-    { "战", "戰" },
-    { "战天斗地", "戰天鬥地" },
-    { "战斗", "戰鬥" },
-    { "战栗", "戰慄" },
-    { "截发", "截髮" },
-    { "戬", "戩" },
-    { "戬谷", "戩穀" },
-    { "戯", "戱" },
-    { "戴发含齿", "戴髮含齒" },
-    { "戴表", "戴錶" },
-    { "户", "戶" },
-    { "房里", "房裡" },
-    { "所云", "所云" },
-    { "所云云", "所云云" },
-    { "所占", "所佔" },
-    { "所托", "所託" },
-    { "扁拟谷盗虫", "扁擬穀盜蟲" },
-    { "手冢治虫", "手塚治虫" },
-    { "手塚治虫", "手塚治虫" },
-    { "手折", "手摺" },
-    { "手松", "手鬆" },
-    { "手表", "手錶" },
-    { "手里", "手裡" },
-    { "手里剑", "手裏劍" },
-    { "才克制", "才剋制" },
-    { "才则", "纔則" },
-    { "才干", "才幹" },
-    { "才得两年", "纔得兩年" },
-    { "才此", "纔此" },
-    { "扎上", "紮上" },
-    { "扎下", "紮下" },
-    { "扎囮", "紮囮" },
-    { "扎好", "紮好" },
-    { "扎实", "紮實" },
-    { "扎寨", "紮寨" },
-    { "扎带子", "紮帶子" },
-    { "扎成", "紮成" },
-    { "扎根", "紮根" },
-    { "扎紧", "紮緊" },
-    { "扎脚", "紮腳" },
-    { "扎营", "紮營" },
-    { "扎裹", "紮裹" },
-    { "扎诈", "紮詐" },
-    { "扎起", "紮起" },
-    { "扎铁", "紮鐵" },
-    { "扑", "撲" },
-    { "扑作教刑", "扑作教刑" },
-    { "扑冬", "撲鼕" },
-    { "扑冬冬", "撲鼕鼕" },
-    { "扑打", "扑打" },
-    { "扑挞", "扑撻" },
-    { "打出吊入", "打出弔入" },
-    { "打卡钟", "打卡鐘" },
-    { "打吨", "打吨" },
-    { "打干", "打幹" },
-    { "打干哕", "打乾噦" },
-    { "打并", "打併" },
-    { "打拼", "打拚" },
-    { "打斗", "打鬥" },
-    { "打着钟", "打著鐘" },
-    { "打谷", "打穀" },
-    { "打路庄板", "打路莊板" },
-    { "打钟", "打鐘" },
-    { "托买", "託買" },
-    { "托了", "託了" },
-    { "托事", "託事" },
-    { "托交", "託交" },
-    { "托人", "託人" },
-    { "托付", "託付" },
-    { "托儿所", "託兒所" },
-    { "托卖", "託賣" },
-    { "托古讽今", "託古諷今" },
-    { "托名", "託名" },
-    { "托命", "託命" },
-    { "托咎", "託咎" },
-    { "托大", "託大" },
-    { "托孤", "託孤" },
-    { "托庇", "託庇" },
-    { "托故", "託故" },
-    { "托梦", "託夢" },
-    { "托疾", "託疾" },
-    { "托病", "託病" },
-    { "托管", "託管" },
-    { "托言", "託言" },
-    { "托词", "託詞" },
-    { "托身", "託身" },
-    { "托辞", "託辭" },
-    { "托过", "託過" },
-    { "托运", "託運" },
-    { "托附", "託附" },
-    { "扛大梁", "扛大樑" },
-    { "扞御", "扞禦" },
-    { "执", "執" },
-    { "扩", "擴" },
-    { "扪", "捫" },
-    { "扫", "掃" },
-    { "扫荡", "掃蕩" },
-    { "扬", "揚" },
-    { "扯面", "扯麵" },
-    { "扰", "擾" },
-    { "扶余国", "扶餘國" },
-    { "批复", "批複" },
-    { "批斗", "批鬥" },
-    { "批注", "批註" },
-    { "承制", "承製" },
-    { "抑郁", "抑鬱" },
-    { "抓奸", "抓姦" },
-    { "抓斗", "抓鬥" },
-    { "抓药", "抓藥" },
-    { "投药", "投藥" },
-    { "抗御", "抗禦" },
-    { "抗癌药", "抗癌藥" },
-    { "抗药", "抗藥" },
-    { "折冲", "折衝" },
-    { "折叠", "摺疊" },
-    { "折合", "摺合" },
-    { "折奏", "摺奏" },
-    { "折子", "摺子" },
-    { "折尺", "摺尺" },
-    { "折扇", "摺扇" },
-    { "折梯", "摺梯" },
-    { "折椅", "摺椅" },
-    { "折痕", "摺痕" },
-    { "折篷", "摺篷" },
-    { "折纸", "摺紙" },
-    { "折裙", "摺裙" },
-    { "抚", "撫" },
-    { "抛", "拋" },
-    { "抟", "摶" },
-    { "抠", "摳" },
-    { "抡", "掄" },
-    { "抢", "搶" },
-    { "抢占", "搶佔" },
-    { "护", "護" },
-    { "护发", "護髮" },
-    { "报", "報" },
-    { "披发", "披髮" },
-    { "披头散发", "披頭散髮" },
-    { "披榛采兰", "披榛採蘭" },
-    { "抱素怀朴", "抱素懷樸" },
-    { "抵御", "抵禦" },
-    { "抹干", "抹乾" },
-    { "抽公签", "抽公籤" },
-    { "抽签", "抽籤" },
-    { "抿发", "抿髮" },
-    { "拂钟无声", "拂鐘無聲" },
-    { "担", "擔" },
-    { "担仔面", "擔仔麵" },
-    { "担担面", "擔擔麵" },
-    { "担着", "擔著" },
-    { "担负着", "擔負著" },
-    { "拆伙", "拆夥" },
-    { "拈须", "拈鬚" },
-    { "拉克施尔德钟", "拉克施爾德鐘" },
-    { "拉杆", "拉杆" },
-    { "拉纤", "拉縴" },
-    { "拉面", "拉麵" },
-    { "拓朴", "拓樸" },
-    { "拔发", "拔髮" },
-    { "拔须", "拔鬚" },
-    { "拗别", "拗彆" },
-    { "拙朴", "拙樸" },
-    { "拜托", "拜託" },
-    { "拟", "擬" },
-    { "拢", "攏" },
-    { "拣", "揀" },
-    { "拥", "擁" },
-    { "拦", "攔" },
-    { "拧", "擰" },
-    { "拧干", "擰乾" },
-    { "拨", "撥" },
-    { "拨谷", "撥穀" },
-    { "择", "擇" },
-    { "括发", "括髮" },
-    { "拭干", "拭乾" },
-    { "拮据", "拮据" },
-    { "拼却", "拚卻" },
-    { "拼命", "拚命" },
-    { "拼斗", "拚鬥" },
-    { "拼死", "拚死" },
-    { "拼生尽死", "拚生盡死" },
-    { "拼绝", "拚絕" },
-    { "拼老命", "拚老命" },
-    { "拼舍", "拚捨" },
-    { "拾沈", "拾瀋" },
-    { "拿下表", "拿下錶" },
-    { "拿下钟", "拿下鐘" },
-    { "拿准", "拿準" },
-    { "拿破仑", "拿破崙" },
-    { "挂", "掛" },
-    { "挂历", "掛曆" },
-    { "挂号", "挂號" },
-    { "挂图", "挂圖" },
-    { "挂帅", "挂帥" },
-    { "挂帘", "掛帘" },
-    { "挂彩", "挂彩" },
-    { "挂念", "挂念" },
-    { "挂车", "挂車" },
-    { "挂钟", "掛鐘" },
-    { "挂钩", "掛鈎" },
-    { "挂面", "挂面" },
-    { "挌斗", "挌鬥" },
-    { "挑大梁", "挑大樑" },
-    { "挑斗", "挑鬥" },
-    { "挚", "摯" },
-    { "挛", "攣" },
-    { "挝", "撾" },
-    { "挞", "撻" },
-    { "挟", "挾" },
-    { "挠", "撓" },
-    { "挡", "擋" },
-    { "挢", "撟" },
-    { "挣", "掙" },
-    { "挤", "擠" },
-    { "挥", "揮" },
-    { "挥杆", "揮杆" },
-    { "振荡", "振蕩" },
-    { "挽曲", "輓曲" },
-    { "挽歌", "輓歌" },
-    { "挽联", "輓聯" },
-    { "挽聯", "輓聯" },
-    { "挽詞", "輓詞" },
-    { "挽詩", "輓詩" },
-    { "挽词", "輓詞" },
-    { "挽诗", "輓詩" },
-    { "捆扎", "捆紮" },
-    { "捉发", "捉髮" },
-    { "捉奸", "捉姦" },
-    { "捍御", "捍禦" },
-    { "捏面人", "捏麵人" },
-    { "捞", "撈" },
-    { "捞干", "撈乾" },
-    { "捞面", "撈麵" },
-    { "损", "損" },
-    { "捡", "撿" },
-    { "换", "換" },
-    { "换发", "換髮" },
-    { "换只", "換隻" },
-    { "换签", "換籤" },
-    { "换药", "換藥" },
-    { "捣", "搗" },
-    { "捣鬼吊白", "搗鬼弔白" },
-    { "据", "據" },
-    { "据云", "據云" },
-    { "据干而窥井底", "據榦而窺井底" },
-    { "捵面", "捵麵" },
-    { "捶炼", "捶鍊" },
-    { "掌柜", "掌柜" },
-    { "排骨面", "排骨麵" },
-    { "掣签", "掣籤" },
-    { "接着说", "接著說" },
-    { "推情准理", "推情準理" },
-    { "推托", "推託" },
-    { "掳", "擄" },
-    { "掴", "摑" },
-    { "掷", "擲" },
-    { "掸", "撣" },
-    { "掺", "摻" },
-    { "掼", "摜" },
-    { "提子干", "提子乾" },
-    { "提心吊胆", "提心弔膽" },
-    { "握发", "握髮" },
-    { "揩干", "揩乾" },
-    { "揪发", "揪髮" },
-    { "揪采", "揪採" },
-    { "揪须", "揪鬚" },
-    { "揭丑", "揭醜" },
-    { "揽", "攬" },
-    { "揿", "撳" },
-    { "搀", "攙" },
-    { "搁", "擱" },
-    { "搂", "摟" },
-    { "搅", "攪" },
-    { "搋面", "搋麵" },
-    { "搏斗", "搏鬥" },
-    { "搤肮拊背", "搤肮拊背" },
-    { "搬斗", "搬鬥" },
-    { "搭伙", "搭夥" },
-    { "搭干铺", "搭乾鋪" },
-    { "携", "攜" },
-    { "搽药", "搽藥" },
-    { "摄", "攝" },
-    { "摄制", "攝製" },
-    { "摅", "攄" },
-    { "摆", "擺" },
-    { "摆钟", "擺鐘" },
-    { "摇", "搖" },
-    { "摇摇荡荡", "搖搖蕩蕩" },
-    { "摇荡", "搖蕩" },
-    { "摈", "擯" },
-    { "摊", "攤" },
-    { "摧坚获丑", "摧堅獲醜" },
-    { "摭采", "摭採" },
-    { "摸棱", "摸稜" },
-    { "摸钟", "摸鐘" },
-    { "撄", "攖" },
-    { "撇吊", "撇弔" },
-    { "撑", "撐" },
-    { "撚须", "撚鬚" },
-    { "撞球台", "撞球檯" },
-    { "撞钟", "撞鐘" },
-    { "撞阵冲军", "撞陣衝軍" },
-    { "撤并", "撤併" },
-    { "撩斗", "撩鬥" },
-    { "撵", "攆" },
-    { "撷", "擷" },
-    { "撸", "擼" },
-    { "撺", "攛" },
-    { "擀面", "擀麵" },
-    { "操作钟", "操作鐘" },
-    { "擞", "擻" },
-    { "擢发", "擢髮" },
-    { "擦干", "擦乾" },
-    { "擦干净", "擦乾淨" },
-    { "擦药", "擦藥" },
-    { "攒", "攢" },
-    { "支干", "支幹" },
-    { "支杆", "支杆" },
-    { "收获", "收穫" },
-    { "改征", "改徵" },
-    { "攻占", "攻佔" },
-    { "放松", "放鬆" },
-    { "放荡", "放蕩" },
-    { "放蒙挣", "放懞掙" },
-    { "故事里", "故事裡" },
-    { "故云", "故云" },
-    { "敌", "敵" },
-    { "敌忾同仇", "敵愾同讎" },
-    { "救药", "救藥" },
-    { "教学钟", "教學鐘" },
-    { "教范", "教範" },
-    { "敛", "斂" },
-    { "敢干", "敢幹" },
-    { "散伙", "散夥" },
-    { "散荡", "散蕩" },
-    { "敦朴", "敦樸" },
-    { "敬挽", "敬輓" },
-    { "数", "數" },
-    { "数与虏确", "數與虜确" },
-    { "数字钟", "數字鐘" },
-    { "数罪并罚", "數罪併罰" },
-    { "敲扑", "敲扑" },
-    { "敲钟", "敲鐘" },
-    { "整发用品", "整髮用品" },
-    { "整只", "整隻" },
-    { "整庄", "整莊" },
-    { "敷药", "敷藥" },
-    { "文征明", "文徵明" },
-    { "文思泉涌", "文思泉湧" },
-    { "斋", "齋" },
-    { "斓", "斕" },
-    { "斗上", "鬥上" },
-    { "斗不过", "鬥不過" },
-    { "斗丽", "鬥麗" },
-    { "斗了", "鬥了" },
-    { "斗争", "鬥爭" },
-    { "斗倒", "鬥倒" },
-    { "斗分子", "鬥分子" },
-    { "斗别气", "鬥彆氣" },
-    { "斗力", "鬥力" },
-    { "斗劲", "鬥勁" },
-    { "斗叠", "鬥疊" },
-    { "斗口", "鬥口" },
-    { "斗叶儿", "鬥葉兒" },
-    { "斗叶子", "鬥葉子" },
-    { "斗合", "鬥合" },
-    { "斗哄", "鬥鬨" },
-    { "斗嘴", "鬥嘴" },
-    { "斗地主", "鬥地主" },
-    { "斗士", "鬥士" },
-    { "斗头", "鬥頭" },
-    { "斗富", "鬥富" },
-    { "斗巧", "鬥巧" },
-    { "斗幌子", "鬥幌子" },
-    { "斗弄", "鬥弄" },
-    { "斗引", "鬥引" },
-    { "斗彩", "鬥彩" },
-    { "斗心眼", "鬥心眼" },
-    { "斗志", "鬥志" },
-    { "斗成", "鬥成" },
-    { "斗打", "鬥打" },
-    { "斗批改", "鬥批改" },
-    { "斗技", "鬥技" },
-    { "斗文", "鬥文" },
-    { "斗斗", "鬥鬥" },
-    { "斗智", "鬥智" },
-    { "斗暴", "鬥暴" },
-    { "斗来斗去", "鬥來鬥去" },
-    { "斗武", "鬥武" },
-    { "斗殴", "鬥毆" },
-    { "斗气", "鬥氣" },
-    { "斗法", "鬥法" },
-    { "斗牌", "鬥牌" },
-    { "斗牙拌齿", "鬥牙拌齒" },
-    { "斗牙斗齿", "鬥牙鬥齒" },
-    { "斗牛", "鬥牛" },
-    { "斗犀台", "鬥犀臺" },
-    { "斗犬", "鬥犬" },
-    { "斗狠", "鬥狠" },
-    { "斗百草", "鬥百草" },
-    { "斗眼", "鬥眼" },
-    { "斗着", "鬥著" },
-    { "斗私批修", "鬥私批修" },
-    { "斗而铸兵", "鬥而鑄兵" },
-    { "斗而铸锥", "鬥而鑄錐" },
-    { "斗胜", "鬥勝" },
-    { "斗脚", "鬥腳" },
-    { "斗舰", "鬥艦" },
-    { "斗艳", "鬥豔" },
-    { "斗茶", "鬥茶" },
-    { "斗草", "鬥草" },
-    { "斗蟋蟀", "鬥蟋蟀" },
-    { "斗话", "鬥話" },
-    { "斗起", "鬥起" },
-    { "斗趣", "鬥趣" },
-    { "斗闲气", "鬥閑氣" },
-    { "斗闷", "鬥悶" },
-    { "斗雪红", "鬥雪紅" },
-    { "斗风", "鬥風" },
-    { "斗鱼", "鬥魚" },
-    { "斗鸡", "鬥雞" },
-    { "斗鸭", "鬥鴨" },
-    { "斗鹌鹑", "鬥鵪鶉" },
-    { "斩", "斬" },
-    { "斫雕为朴", "斫雕為樸" },
-    { "断", "斷" },
-    { "断发", "斷髮" },
-    { "新历", "新曆" },
-    { "新庄", "新莊" },
-    { "新扎", "新紮" },
-    { "斲雕为朴", "斲雕為樸" },
-    { "方便面", "方便麵" },
-    { "方几", "方几" },
-    { "方志", "方誌" },
-    { "施舍", "施捨" },
-    { "施药", "施藥" },
-    { "旁征博引", "旁徵博引" },
-    { "旁注", "旁註" },
-    { "旅游", "旅遊" },
-    { "旋回", "旋迴" },
-    { "旋干转坤", "旋乾轉坤" },
-    { "旋绕着", "旋繞著" },
-    { "族里", "族裡" },
-    { "旗杆", "旗杆" },
-    { "无", "無" },
-    { "无余", "無餘" },
-    { "无征不信", "無徵不信" },
-    { "无梁楼盖", "無樑樓蓋" },
-    { "无法克制", "無法剋制" },
-    { "无药可救", "無藥可救" },
-    { "日占", "日佔" },
-    { "日历", "日曆" },
-    { "日子里", "日子裡" },
-    { "日心历表", "日心曆表" },
-    { "日志", "日誌" },
-    { "日晒", "日晒" },
-    { "旧", "舊" },
-    { "旧历", "舊曆" },
-    { "旧游", "舊遊" },
-    { "旧药", "舊藥" },
-    { "旧表", "舊錶" },
-    { "旧钟", "舊鐘" },
-    { "旧钟表", "舊鐘錶" },
-    { "旱干", "旱乾" },
-    { "时", "時" },
-    { "时钟", "時鐘" },
-    { "时间里", "時間裡" },
-    { "旷", "曠" },
-    { "昆仑", "崑崙" },
-    { "昆仑山", "昆崙山" },
-    { "昆剧", "崑劇" },
-    { "昆山", "崑山" },
-    { "昆曲", "崑曲" },
-    { "昆腔", "崑腔" },
-    { "昆苏", "崑蘇" },
-    { "昆调", "崑調" },
-    { "明征", "明徵" },
-    { "明目张胆", "明目張胆" },
-    { "明窗净几", "明窗淨几" },
-    { "明范", "明範" },
-    { "明里", "明裡" },
-    { "易克制", "易剋制" },
-    { "昙", "曇" },
-    { "星历", "星曆" },
-    { "星辰表", "星辰錶" },
-    { "春假里", "春假裡" },
-    { "春天里", "春天裡" },
-    { "春日里", "春日裡" },
-    { "春游", "春遊" },
-    { "春药", "春藥" },
-    { "春香斗学", "春香鬥學" },
-    { "昼", "晝" },
-    { "显", "顯" },
-    { "显示表", "顯示錶" },
-    { "显示钟", "顯示鐘" },
-    { "晃荡", "晃蕩" },
-    { "晋", "晉" },
-    { "晋升", "晉陞" },
-    { "晒", "曬" },
-    { "晒伤", "晒傷" },
-    { "晒图", "晒圖" },
-    { "晒干", "晒乾" },
-    { "晒成", "晒成" },
-    { "晒晒", "晒晒" },
-    { "晒烟", "晒煙" },
-    { "晒种", "晒種" },
-    { "晒衣", "晒衣" },
-    { "晒谷", "曬穀" },
-    { "晒黑", "晒黑" },
-    { "晓", "曉" },
-    { "晔", "曄" },
-    { "晕", "暈" },
-    { "晕船药", "暈船藥" },
-    { "晕车药", "暈車藥" },
-    { "晖", "暉" },
-    { "晚钟", "晚鐘" },
-    { "晞发", "晞髮" },
-    { "晨钟", "晨鐘" },
-    { "普冬冬", "普鼕鼕" },
-    { "景致", "景緻" },
-    { "晾干", "晾乾" },
-    { "暂", "暫" },
-    { "暑假里", "暑假裡" },
-    { "暗地里", "暗地裡" },
-    { "暗斗", "暗鬥" },
-    { "暗沟里", "暗溝裡" },
-    { "暗里", "暗裡" },
-    { "暧", "曖" },
-    { "暴敛横征", "暴斂橫徵" },
-    { "暴晒", "暴晒" },
-    { "曝晒", "曝晒" },
-    { "曰云", "曰云" },
-    { "曲尘", "麴塵" },
-    { "曲生", "麴生" },
-    { "曲秀才", "麴秀才" },
-    { "曲菌", "麴菌" },
-    { "曲蘖", "麴櫱" },
-    { "曲车", "麴車" },
-    { "曲道士", "麴道士" },
-    { "曲钱", "麴錢" },
-    { "曲院", "麴院" },
-    { "曲霉", "麴黴" },
-    { "更仆难数", "更僕難數" },
-    { "更签", "更籤" },
-    { "更钟", "更鐘" },
-    { "曾朴", "曾樸" },
-    { "月历", "月曆" },
-    { "月球历表", "月球曆表" },
-    { "有事之无范", "有事之無範" },
-    { "有仆", "有僕" },
-    { "有余", "有餘" },
-    { "有准", "有準" },
-    { "有发头陀寺", "有髮頭陀寺" },
-    { "有只", "有隻" },
-    { "有只采", "有只採" },
-    { "有够赞", "有夠讚" },
-    { "有征", "有徵" },
-    { "有恒街", "有恒街" },
-    { "有栖川", "有栖川" },
-    { "有棱有角", "有稜有角" },
-    { "服药", "服藥" },
-    { "望后石", "望后石" },
-    { "望着表", "望著錶" },
-    { "望着钟", "望著鐘" },
-    { "望着钟表", "望著鐘錶" },
-    { "朝钟", "朝鐘" },
-    { "木偶戏扎", "木偶戲紮" },
-    { "木制", "木製" },
-    { "木杆", "木杆" },
-    { "木材干馏", "木材乾餾" },
-    { "木梁", "木樑" },
-    { "木钟", "木鐘" },
-    { "未干", "未乾" },
-    { "末药", "末藥" },
-    { "本征", "本徵" },
-    { "术", "術" },
-    { "术赤", "朮赤" },
-    { "朱仑街", "朱崙街" },
-    { "朱唇皓齿", "硃唇皓齒" },
-    { "朱庆余", "朱慶餘" },
-    { "朱批", "硃批" },
-    { "朱理安历", "朱理安曆" },
-    { "朱砂", "硃砂" },
-    { "朱笔", "硃筆" },
-    { "朱红色", "硃紅色" },
-    { "朱色", "硃色" },
-    { "朱谕", "硃諭" },
-    { "朴修斯", "樸修斯" },
-    { "朴厚", "樸厚" },
-    { "朴学", "樸學" },
-    { "朴实", "樸實" },
-    { "朴念仁", "樸念仁" },
-    { "朴拙", "樸拙" },
-    { "朴樕", "樸樕" },
-    { "朴父", "樸父" },
-    { "朴直", "樸直" },
-    { "朴素", "樸素" },
-    { "朴讷", "樸訥" },
-    { "朴质", "樸質" },
-    { "朴鄙", "樸鄙" },
-    { "朴重", "樸重" },
-    { "朴野", "樸野" },
-    { "朴钝", "樸鈍" },
-    { "朴陋", "樸陋" },
-    { "朴马", "樸馬" },
-    { "朴鲁", "樸魯" },
-    { "机", "機" },
-    { "机械表", "機械錶" },
-    { "机械钟", "機械鐘" },
-    { "机绣", "機繡" },
-    { "杀", "殺" },
-    { "杀虫药", "殺蟲藥" },
-    { "杂", "雜" },
-    { "杂合面儿", "雜合麵兒" },
-    { "杂志", "雜誌" },
-    { "杂面", "雜麵" },
-    { "权", "權" },
-    { "杆", "桿" },
-    { "杆子", "杆子" },
-    { "李连杰", "李連杰" },
-    { "李連杰", "李連杰" },
-    { "材干", "材幹" },
-    { "村子里", "村子裡" },
-    { "村庄", "村莊" },
-    { "村里", "村裡" },
-    { "杜老志道", "杜老誌道" },
-    { "杞宋无征", "杞宋無徵" },
-    { "束发", "束髮" },
-    { "杠杆", "槓桿" },
-    { "条", "條" },
-    { "条干", "條幹" },
-    { "来", "來" },
-    { "来复", "來複" },
-    { "杨", "楊" },
-    { "杨雅筑", "楊雅筑" },
-    { "杩", "榪" },
-    { "杯干", "杯乾" },
-    { "杯面", "杯麵" },
-    { "杰", "傑" },
-    { "杰伦", "杰倫" },
-    { "杰威尔音乐", "杰威爾音樂" },
-    { "杰威爾音樂", "杰威爾音樂" },
-    { "杰特", "杰特" },
-    { "松一口气", "鬆一口氣" },
-    { "松了", "鬆了" },
-    { "松些", "鬆些" },
-    { "松元音", "鬆元音" },
-    { "松动", "鬆動" },
-    { "松劲", "鬆勁" },
-    { "松口", "鬆口" },
-    { "松喉", "鬆喉" },
-    { "松土", "鬆土" },
-    { "松宽", "鬆寬" },
-    { "松开", "鬆開" },
-    { "松弛", "鬆弛" },
-    { "松快", "鬆快" },
-    { "松懈", "鬆懈" },
-    { "松手", "鬆手" },
-    { "松掉", "鬆掉" },
-    { "松散", "鬆散" },
-    { "松松", "鬆鬆" },
-    { "松柔", "鬆柔" },
-    { "松气", "鬆氣" },
-    { "松浮", "鬆浮" },
-    { "松紧", "鬆緊" },
-    { "松绑", "鬆綁" },
-    { "松缓", "鬆緩" },
-    { "松脆", "鬆脆" },
-    { "松脱", "鬆脫" },
-    { "松蛋", "鬆蛋" },
-    { "松起", "鬆起" },
-    { "松软", "鬆軟" },
-    { "松通", "鬆通" },
-    { "松饼", "鬆餅" },
-    { "板着脸", "板著臉" },
-    { "板荡", "板蕩" },
-    { "极", "極" },
-    { "构", "構" },
-    { "林宏岳", "林宏嶽" },
-    { "林钟", "林鐘" },
-    { "果子干", "果子乾" },
-    { "果干", "果乾" },
-    { "枝不得大于干", "枝不得大於榦" },
-    { "枝干", "枝幹" },
-    { "枞", "樅" },
-    { "枢", "樞" },
-    { "枣", "棗" },
-    { "枣庄", "棗莊" },
-    { "枥", "櫪" },
-    { "枨", "棖" },
-    { "枪", "槍" },
-    { "枫", "楓" },
-    { "枭", "梟" },
-    { "枯干", "枯乾" },
-    { "架钟", "架鐘" },
-    { "某只", "某隻" },
-    { "染发", "染髮" },
-    { "染殿后", "染殿后" },
-    { "柜", "櫃" },
-    { "柜上", "柜上" },
-    { "柜台", "櫃檯" },
-    { "柜子", "柜子" },
-    { "柜柳", "柜柳" },
-    { "柠", "檸" },
-    { "柱梁", "柱樑" },
-    { "柳诒征", "柳詒徵" },
-    { "柽", "檉" },
-    { "栀", "梔" },
-    { "栅", "柵" },
-    { "标", "標" },
-    { "标准", "標準" },
-    { "标志", "標誌" },
-    { "标杆", "標杆" },
-    { "标注", "標註" },
-    { "标签", "標籤" },
-    { "标致", "標緻" },
-    { "栈", "棧" },
-    { "栉", "櫛" },
-    { "栉发工", "櫛髮工" },
-    { "栊", "櫳" },
-    { "栋", "棟" },
-    { "栋梁", "棟樑" },
-    { "栌", "櫨" },
-    { "栎", "櫟" },
-    { "栏", "欄" },
-    { "栏杆", "欄杆" },
-    { "树", "樹" },
-    { "树干", "樹榦" },
-    { "树梁", "樹樑" },
-    { "栖", "棲" },
-    { "栖栖皇皇", "栖栖皇皇" },
-    { "栗冽", "慄冽" },
-    { "栗栗", "慄慄" },
-    { "校仇", "校讎" },
-    { "校准", "校準" },
-    { "样", "樣" },
-    { "样范", "樣範" },
-    { "格斗", "格鬥" },
-    { "格范", "格範" },
-    { "格里历", "格里曆" },
-    { "格里高利历", "格里高利曆" },
-    { "栾", "欒" },
-    { "桂圆干", "桂圓乾" },
-    { "桅杆", "桅杆" },
-    { "桌几", "桌几" },
-    { "桌历", "桌曆" },
-    { "桑干", "桑乾" },
-    { "桠", "椏" },
-    { "桡", "橈" },
-    { "桢", "楨" },
-    { "桢干", "楨幹" },
-    { "档", "檔" },
-    { "桤", "榿" },
-    { "桥", "橋" },
-    { "桥梁", "橋樑" },
-    { "桦", "樺" },
-    { "桧", "檜" },
-    { "桨", "槳" },
-    { "桩", "樁" },
-    { "梁上", "樑上" },
-    { "梁柱", "樑柱" },
-    { "梦", "夢" },
-    { "梦游", "夢遊" },
-    { "梦里", "夢裡" },
-    { "梨干", "梨乾" },
-    { "梯冲", "梯衝" },
-    { "械斗", "械鬥" },
-    { "械系", "械繫" },
-    { "梼", "檮" },
-    { "检", "檢" },
-    { "棂", "欞" },
-    { "棉制", "棉製" },
-    { "棒子面", "棒子麵" },
-    { "棫朴", "棫樸" },
-    { "森林里", "森林裡" },
-    { "棱体", "稜體" },
-    { "棱台", "稜台" },
-    { "棱子", "稜子" },
-    { "棱层", "稜層" },
-    { "棱柱", "稜柱" },
-    { "棱棱", "稜稜" },
-    { "棱登", "稜登" },
-    { "棱等登", "稜等登" },
-    { "棱线", "稜線" },
-    { "棱缝", "稜縫" },
-    { "棱角", "稜角" },
-    { "棱锥", "稜錐" },
-    { "棱镜", "稜鏡" },
-    { "棺材里", "棺材裡" },
-    { "椁", "槨" },
-    { "植发", "植髮" },
-    { "椟", "櫝" },
-    { "椠", "槧" },
-    { "椤", "欏" },
-    { "椭", "橢" },
-    { "椰枣干", "椰棗乾" },
-    { "楊雅筑", "楊雅筑" },
-    { "楚庄王", "楚莊王" },
-    { "楚庄绝缨", "楚莊絕纓" },
-    { "楚庄问鼎", "楚莊問鼎" },
-    { "楼", "樓" },
-    { "榄", "欖" },
-    { "榇", "櫬" },
-    { "榈", "櫚" },
-    { "榉", "櫸" },
-    { "榨干", "榨乾" },
-    { "槛", "檻" },
-    { "槟", "檳" },
-    { "槠", "櫧" },
-    { "模制", "模製" },
-    { "模棱", "模稜" },
-    { "模范", "模範" },
-    { "横", "橫" },
-    { "横冲", "橫衝" },
-    { "横征暴敛", "橫徵暴斂" },
-    { "横杆", "橫杆" },
-    { "横梁", "橫樑" },
-    { "樯", "檣" },
-    { "樱", "櫻" },
-    { "樵采", "樵採" },
-    { "橥", "櫫" },
-    { "橱", "櫥" },
-    { "橹", "櫓" },
-    { "橼", "櫞" },
-    { "檩", "檁" },
-    { "欢", "歡" },
-    { "欤", "歟" },
-    { "欧", "歐" },
-    { "欧游", "歐遊" },
-    { "欲令智昏", "慾令智昏" },
-    { "欲壑难填", "慾壑難填" },
-    { "欲念", "慾念" },
-    { "欲望", "慾望" },
-    { "欲海", "慾海" },
-    { "欲火", "慾火" },
-    { "欲障", "慾障" },
-    { "欺蒙", "欺矇" },
-    { "歌后", "歌后" },
-    { "歌钟", "歌鐘" },
-    { "止咳药", "止咳藥" },
-    { "止痛药", "止痛藥" },
-    { "止血药", "止血藥" },
-    { "正在叱咤", "正在叱咤" },
-    { "武后", "武后" },
-    { "武斗", "武鬥" },
-    { "歹斗", "歹鬥" },
-    { "死里求生", "死裡求生" },
-    { "死里逃生", "死裡逃生" },
-    { "歼", "殲" },
-    { "殁", "歿" },
-    { "殇", "殤" },
-    { "残", "殘" },
-    { "残余", "殘餘" },
-    { "残肴", "殘肴" },
-    { "殒", "殞" },
-    { "殓", "殮" },
-    { "殖谷", "殖穀" },
-    { "殚", "殫" },
-    { "殡", "殯" },
-    { "殴", "毆" },
-    { "殴斗", "毆鬥" },
-    { "殷师牛斗", "殷師牛鬥" },
-    { "殿钟自鸣", "殿鐘自鳴" },
-    { "毁", "毀" },
-    { "毁钟为铎", "毀鐘為鐸" },
-    { "毂", "轂" },
-    { "母丑", "母醜" },
-    { "母后", "母后" },
-    { "母范", "母範" },
-    { "每只", "每隻" },
-    { "毒药", "毒藥" },
-    { "毕", "畢" },
-    { "毗婆尸佛", "毗婆尸佛" },
-    { "毙", "斃" },
-    { "毛发", "毛髮" },
-    { "毛坏", "毛坏" },
-    { "毛姜", "毛薑" },
-    { "毡", "氈" },
-    { "毫厘", "毫釐" },
-    { "毫发", "毫髮" },
-    { "毵", "毿" },
-    { "氇", "氌" },
-    { "气", "氣" },
-    { "气郁", "氣鬱" },
-    { "氢", "氫" },
-    { "氤郁", "氤鬱" },
-    { "氩", "氬" },
-    { "氲", "氳" },
-    { "水准", "水準" },
-    { "水无怜奈", "水無怜奈" },
-    { "水来汤里去", "水來湯裡去" },
-    { "水里", "水裡" },
-    { "永历", "永曆" },
-    { "永志不忘", "永誌不忘" },
-    { "求知欲", "求知慾" },
-    { "求签", "求籤" },
-    { "汇", "匯" },
-    { "汇刊", "彙刊" },
-    { "汇报", "彙報" },
-    { "汇整", "彙整" },
-    { "汇算", "彙算" },
-    { "汇纂", "彙纂" },
-    { "汇编", "彙編" },
-    { "汇辑", "彙輯" },
-    { "汇集", "彙集" },
-    { "汉", "漢" },
-    { "汉弥登钟", "漢彌登鐘" },
-    { "池里", "池裡" },
-    { "污蔑", "污衊" },
-    { "汤", "湯" },
-    { "汤下面", "湯下麵" },
-    { "汤团", "湯糰" },
-    { "汤药", "湯藥" },
-    { "汤面", "湯麵" },
-    { "汹", "洶" },
-    { "汹涌", "洶湧" },
-    { "沈吉线", "瀋吉線" },
-    { "沈山线", "瀋山線" },
-    { "沈州", "瀋州" },
-    { "沈水", "瀋水" },
-    { "沈河", "瀋河" },
-    { "沈海", "瀋海" },
-    { "沈淀", "沈澱" },
-    { "沈着", "沈著" },
-    { "沈郁", "沈鬱" },
-    { "沈阳", "瀋陽" },
-    { "沉淀", "沉澱" },
-    { "沉郁", "沉鬱" },
-    { "沙里淘金", "沙裡淘金" },
-    { "沟", "溝" },
-    { "没", "沒" },
-    { "没事干", "沒事幹" },
-    { "没准", "沒準" },
-    { "没干", "沒幹" },
-    { "没干没净", "沒乾沒淨" },
-    { "没折至", "沒摺至" },
-    { "没梢干", "沒梢幹" },
-    { "没药", "沒藥" },
-    { "沣", "灃" },
-    { "沤", "漚" },
-    { "沤郁", "漚鬱" },
-    { "沥", "瀝" },
-    { "沦", "淪" },
-    { "沧", "滄" },
-    { "沩", "溈" },
-    { "沪", "滬" },
-    { "河岳", "河嶽" },
-    { "河里", "河裡" },
-    { "油斗", "油鬥" },
-    { "油面", "油麵" },
-    { "治愈", "治癒" },
-    { "沿溯", "沿泝" },
-    { "泄欲", "洩慾" },
-    { "法占", "法佔" },
-    { "泛游", "泛遊" },
-    { "泞", "濘" },
-    { "泡制", "泡製" },
-    { "泡面", "泡麵" },
-    { "波发藻", "波髮藻" },
-    { "波棱菜", "波稜菜" },
-    { "注上", "註上" },
-    { "注云", "注云" },
-    { "注册", "註冊" },
-    { "注失", "註失" },
-    { "注定", "註定" },
-    { "注明", "註明" },
-    { "注标", "註標" },
-    { "注生娘娘", "註生娘娘" },
-    { "注疏", "註疏" },
-    { "注脚", "註腳" },
-    { "注解", "註解" },
-    { "注记", "註記" },
-    { "注译", "註譯" },
-    { "注销", "註銷" },
-    { "泪", "淚" },
-    { "泪如泉涌", "淚如泉湧" },
-    { "泪干", "淚乾" },
-    { "泱郁", "泱鬱" },
-    { "泳气钟", "泳氣鐘" },
-    { "泶", "澩" },
-    { "泷", "瀧" },
-    { "泸", "瀘" },
-    { "泺", "濼" },
-    { "泻", "瀉" },
-    { "泻药", "瀉藥" },
-    { "泼", "潑" },
-    { "泽", "澤" },
-    { "泽渗漓而下降", "澤滲灕而下降" },
-    { "泾", "涇" },
-    { "洁", "潔" },
-    { "洄游", "洄遊" },
-    { "洒", "灑" },
-    { "洒家", "洒家" },
-    { "洒扫", "洒掃" },
-    { "洒水", "洒水" },
-    { "洒洒", "洒洒" },
-    { "洒涤", "洒滌" },
-    { "洒淅", "洒淅" },
-    { "洒濯", "洒濯" },
-    { "洒然", "洒然" },
-    { "洒脱", "洒脫" },
-    { "洗发", "洗髮" },
-    { "洗炼", "洗鍊" },
-    { "洗练", "洗鍊" },
-    { "洛钟东应", "洛鐘東應" },
-    { "洪范", "洪範" },
-    { "洪适", "洪适" },
-    { "洪钟", "洪鐘" },
-    { "洼", "窪" },
-    { "流征", "流徵" },
-    { "流荡", "流蕩" },
-    { "浃", "浹" },
-    { "浅", "淺" },
-    { "浅淀", "淺澱" },
-    { "浆", "漿" },
-    { "浇", "澆" },
-    { "浈", "湞" },
-    { "浊", "濁" },
-    { "测", "測" },
-    { "浍", "澮" },
-    { "济", "濟" },
-    { "浏", "瀏" },
-    { "浑", "渾" },
-    { "浑个", "渾箇" },
-    { "浑朴", "渾樸" },
-    { "浒", "滸" },
-    { "浓", "濃" },
-    { "浓发", "濃髮" },
-    { "浔", "潯" },
-    { "浩浩荡荡", "浩浩蕩蕩" },
-    { "浩荡", "浩蕩" },
-    { "浪游", "浪遊" },
-    { "浪琴表", "浪琴錶" },
-    { "浪荡", "浪蕩" },
-    { "浮松", "浮鬆" },
-    { "浮荡", "浮蕩" },
-    { "海上布雷", "海上佈雷" },
-    { "海干", "海乾" },
-    { "海湾布雷", "海灣佈雷" },
-    { "涂", "塗" },
-    { "涂善妮", "涂善妮" },
-    { "涂坤", "涂坤" },
-    { "涂壮勋", "涂壯勳" },
-    { "涂壯勳", "涂壯勳" },
-    { "涂天相", "涂天相" },
-    { "涂姓", "涂姓" },
-    { "涂序瑄", "涂序瑄" },
-    { "涂敏恆", "涂敏恆" },
-    { "涂敏恒", "涂敏恆" },
-    { "涂泽民", "涂澤民" },
-    { "涂澤民", "涂澤民" },
-    { "涂着", "塗著" },
-    { "涂绍煃", "涂紹煃" },
-    { "涂羽卿", "涂羽卿" },
-    { "涂药", "塗藥" },
-    { "涂謹申", "涂謹申" },
-    { "涂谨申", "涂謹申" },
-    { "涂逢年", "涂逢年" },
-    { "涂醒哲", "涂醒哲" },
-    { "涂長望", "涂長望" },
-    { "涂长望", "涂長望" },
-    { "涂鴻欽", "涂鴻欽" },
-    { "涂鸿钦", "涂鴻欽" },
-    { "消炎药", "消炎藥" },
-    { "消肿药", "消腫藥" },
-    { "涌上", "湧上" },
-    { "涌入", "湧入" },
-    { "涌出", "湧出" },
-    { "涌向", "湧向" },
-    { "涌来", "湧來" },
-    { "涌泉", "湧泉" },
-    { "涌现", "湧現" },
-    { "涌起", "湧起" },
-    { "涌进", "湧進" },
-    { "涛", "濤" },
-    { "涝", "澇" },
-    { "涞", "淶" },
-    { "涟", "漣" },
-    { "涠", "潿" },
-    { "涡", "渦" },
-    { "涣", "渙" },
-    { "涤", "滌" },
-    { "润", "潤" },
-    { "涧", "澗" },
-    { "涨", "漲" },
-    { "涩", "澀" },
-    { "液晶表", "液晶錶" },
-    { "涳蒙", "涳濛" },
-    { "涸干", "涸乾" },
-    { "淀乃不耕之地", "澱乃不耕之地" },
-    { "淀北片", "澱北片" },
-    { "淀山", "澱山" },
-    { "淀淀", "澱澱" },
-    { "淀积", "澱積" },
-    { "淀粉", "澱粉" },
-    { "淀解物", "澱解物" },
-    { "淀谓之滓", "澱謂之滓" },
-    { "淋余土", "淋餘土" },
-    { "淑范", "淑範" },
-    { "淡朱", "淡硃" },
-    { "淡蒙蒙", "淡濛濛" },
-    { "淫欲", "淫慾" },
-    { "淫荡", "淫蕩" },
-    { "淬炼", "淬鍊" },
-    { "深山何处钟", "深山何處鐘" },
-    { "深渊里", "深淵裡" },
-    { "淳于", "淳于" },
-    { "淳朴", "淳樸" },
-    { "清汤挂面", "清湯掛麵" },
-    { "渊", "淵" },
-    { "渊淳岳峙", "淵淳嶽峙" },
-    { "渌", "淥" },
-    { "渍", "漬" },
-    { "渎", "瀆" },
-    { "渐", "漸" },
-    { "渑", "澠" },
-    { "渔", "漁" },
-    { "渖", "瀋" },
-    { "渗", "滲" },
-    { "渠冲", "渠衝" },
-    { "温", "溫" },
-    { "港制", "港製" },
-    { "游丝", "遊絲" },
-    { "游乐", "遊樂" },
-    { "游了", "遊了" },
-    { "游人", "遊人" },
-    { "游仙", "遊仙" },
-    { "游伴", "遊伴" },
-    { "游侠", "遊俠" },
-    { "游兴", "遊興" },
-    { "游冶", "遊冶" },
-    { "游刃有余", "遊刃有餘" },
-    { "游动", "遊動" },
-    { "游历", "遊歷" },
-    { "游园", "遊園" },
-    { "游子", "遊子" },
-    { "游学", "遊學" },
-    { "游客", "遊客" },
-    { "游宦", "遊宦" },
-    { "游山玩水", "遊山玩水" },
-    { "游必有方", "遊必有方" },
-    { "游憩", "遊憩" },
-    { "游戏", "遊戲" },
-    { "游手好闲", "遊手好閒" },
-    { "游方", "遊方" },
-    { "游星", "遊星" },
-    { "游标卡尺", "遊標卡尺" },
-    { "游民", "遊民" },
-    { "游河", "遊河" },
-    { "游猎", "遊獵" },
-    { "游玩", "遊玩" },
-    { "游目骋怀", "遊目騁懷" },
-    { "游离", "遊離" },
-    { "游程", "遊程" },
-    { "游船", "遊船" },
-    { "游艇", "遊艇" },
-    { "游艺", "遊藝" },
-    { "游荡", "遊盪" },
-    { "游荡不归", "遊蕩不歸" },
-    { "游行", "遊行" },
-    { "游街", "遊街" },
-    { "游览", "遊覽" },
-    { "游记", "遊記" },
-    { "游说", "遊說" },
-    { "游资", "遊資" },
-    { "游走", "遊走" },
-    { "游踪", "遊蹤" },
-    { "游逛", "遊逛" },
-    { "游错", "遊錯" },
-    { "游骑兵", "遊騎兵" },
-    { "游魂", "遊魂" },
-    { "湖里", "湖裡" },
-    { "湘累", "湘纍" },
-    { "湘绣", "湘繡" },
-    { "湟潦生苹", "湟潦生苹" },
-    { "湮郁", "湮鬱" },
-    { "湾", "灣" },
-    { "湿", "濕" },
-    { "溃", "潰" },
-    { "溅", "濺" },
-    { "溆", "漵" },
-    { "溟蒙", "溟濛" },
-    { "溲面", "溲麵" },
-    { "滃郁", "滃鬱" },
-    { "滑借", "滑藉" },
-    { "滗", "潷" },
-    { "滚", "滾" },
-    { "滞", "滯" },
-    { "滠", "灄" },
-    { "满", "滿" },
-    { "满头洋发", "滿頭洋髮" },
-    { "满拼自尽", "滿拚自盡" },
-    { "滢", "瀅" },
-    { "滤", "濾" },
-    { "滥", "濫" },
-    { "滦", "灤" },
-    { "滨", "濱" },
-    { "滩", "灘" },
-    { "滩涂", "灘涂" },
-    { "漂荡", "漂蕩" },
-    { "漓水", "灕水" },
-    { "漓江", "灕江" },
-    { "漓湘", "灕湘" },
-    { "漓然", "灕然" },
-    { "漕挽", "漕輓" },
-    { "漤", "灠" },
-    { "漫游", "漫遊" },
-    { "潆", "瀠" },
-    { "潇", "瀟" },
-    { "潇洒", "瀟洒" },
-    { "潋", "瀲" },
-    { "潍", "濰" },
-    { "潜", "潛" },
-    { "潜意识里", "潛意識裡" },
-    { "潜水表", "潛水錶" },
-    { "潜水钟", "潛水鐘" },
-    { "潭里", "潭裡" },
-    { "潮涌", "潮湧" },
-    { "潴", "瀦" },
-    { "澒蒙", "澒濛" },
-    { "澜", "瀾" },
-    { "澹台", "澹臺" },
-    { "澹荡", "澹蕩" },
-    { "激荡", "激蕩" },
-    { "濑", "瀨" },
-    { "濒", "瀕" },
-    { "灌药", "灌藥" },
-    { "灏", "灝" },
-    { "火并", "火併" },
-    { "火拼", "火拚" },
-    { "火签", "火籤" },
-    { "火箭布雷", "火箭佈雷" },
-    { "火药", "火藥" },
-    { "灭", "滅" },
-    { "灯", "燈" },
-    { "灰蒙", "灰濛" },
-    { "灰蒙蒙", "灰濛濛" },
-    { "灵", "靈" },
-    { "灵药", "靈藥" },
-    { "灾", "災" },
-    { "灿", "燦" },
-    { "炀", "煬" },
-    { "炆面", "炆麵" },
-    { "炉", "爐" },
-    { "炒面", "炒麵" },
-    { "炖", "燉" },
-    { "炖药", "燉藥" },
-    { "炜", "煒" },
-    { "炝", "熗" },
-    { "炮制", "炮製" },
-    { "炸药", "炸藥" },
-    { "炸酱面", "炸醬麵" },
-    { "点", "點" },
-    { "点半钟", "點半鐘" },
-    { "点多钟", "點多鐘" },
-    { "点里", "點裡" },
-    { "点钟", "點鐘" },
-    { "炼", "煉" },
-    { "炼冶", "鍊冶" },
-    { "炼制", "煉製" },
-    { "炼句", "鍊句" },
-    { "炼字", "鍊字" },
-    { "炼师", "鍊師" },
-    { "炼度", "鍊度" },
-    { "炼形", "鍊形" },
-    { "炼气", "鍊氣" },
-    { "炼汞", "鍊汞" },
-    { "炼石", "鍊石" },
-    { "炼药", "煉藥" },
-    { "炼贫", "鍊貧" },
-    { "炼金术", "鍊金術" },
-    { "炼钢", "鍊鋼" },
-    { "炽", "熾" },
-    { "烁", "爍" },
-    { "烂", "爛" },
-    { "烃", "烴" },
-    { "烘制", "烘製" },
-    { "烘干", "烘乾" },
-    { "烛", "燭" },
-    { "烟", "煙" },
-    { "烟卷", "煙捲" },
-    { "烤干", "烤乾" },
-    { "烤晒", "烤晒" },
-    { "烦", "煩" },
-    { "烧", "燒" },
-    { "烧干", "燒乾" },
-    { "烨", "燁" },
-    { "烩", "燴" },
-    { "烫", "燙" },
-    { "烫一个发", "燙一個髮" },
-    { "烫一次发", "燙一次髮" },
-    { "烫个发", "燙個髮" },
-    { "烫发", "燙髮" },
-    { "烫完发", "燙完髮" },
-    { "烫次发", "燙次髮" },
-    { "烫面", "燙麵" },
-    { "烬", "燼" },
-    { "烬余", "燼餘" },
-    { "热", "熱" },
-    { "焕", "煥" },
-    { "焖", "燜" },
-    { "焘", "燾" },
-    { "焙干", "焙乾" },
-    { "無言不仇", "無言不讎" },
-    { "煎药", "煎藥" },
-    { "煎面", "煎麵" },
-    { "照入签", "照入籤" },
-    { "照准", "照準" },
-    { "照占", "照佔" },
-    { "煨干", "煨乾" },
-    { "煮面", "煮麵" },
-    { "熊杰", "熊杰" },
-    { "熬药", "熬藥" },
-    { "燎发", "燎髮" },
-    { "燕几", "燕几" },
-    { "燕游", "燕遊" },
-    { "爰定祥历", "爰定祥厤" },
-    { "爱", "愛" },
-    { "爱困", "愛睏" },
-    { "爷", "爺" },
-    { "爽荡", "爽蕩" },
-    { "片言只语", "片言隻語" },
-    { "牍", "牘" },
-    { "牙签", "牙籤" },
-    { "牛只", "牛隻" },
-    { "牛肉面", "牛肉麵" },
-    { "牦", "氂" },
-    { "物欲", "物慾" },
-    { "牵", "牽" },
-    { "牵一发", "牽一髮" },
-    { "牵系", "牽繫" },
-    { "特别致", "特别致" },
-    { "特制", "特製" },
-    { "特征", "特徵" },
-    { "特效药", "特效藥" },
-    { "牺", "犧" },
-    { "犊", "犢" },
-    { "状", "狀" },
-    { "犷", "獷" },
-    { "犹", "猶" },
-    { "犹如表", "猶如錶" },
-    { "犹如钟", "猶如鐘" },
-    { "狂占", "狂佔" },
-    { "狂并潮", "狂併潮" },
-    { "狄志杰", "狄志杰" },
-    { "狈", "狽" },
-    { "狐借虎威", "狐藉虎威" },
-    { "狞", "獰" },
-    { "独", "獨" },
-    { "独占", "獨佔" },
-    { "独辟蹊径", "獨闢蹊徑" },
-    { "狭", "狹" },
-    { "狮", "獅" },
-    { "狯", "獪" },
-    { "狰", "猙" },
-    { "狱", "獄" },
-    { "狱里", "獄裡" },
-    { "狲", "猻" },
-    { "猃", "獫" },
-    { "猎", "獵" },
-    { "猕", "獼" },
-    { "猛冲", "猛衝" },
-    { "猜三划五", "猜三划五" },
-    { "猡", "玀" },
-    { "猪", "豬" },
-    { "猫", "貓" },
-    { "猬", "蝟" },
-    { "献", "獻" },
-    { "献丑", "獻醜" },
-    { "獭", "獺" },
-    { "玉历", "玉曆" },
-    { "王余鱼", "王餘魚" },
-    { "王侯后", "王侯后" },
-    { "王后", "王后" },
-    { "王庄", "王莊" },
-    { "玑", "璣" },
-    { "玛", "瑪" },
-    { "玮", "瑋" },
-    { "环", "環" },
-    { "环游", "環遊" },
-    { "现", "現" },
-    { "玺", "璽" },
-    { "珍肴异馔", "珍肴異饌" },
-    { "珐", "琺" },
-    { "珑", "瓏" },
-    { "班里", "班裡" },
-    { "珲", "琿" },
-    { "球杆", "球杆" },
-    { "理一个发", "理一個髮" },
-    { "理一次发", "理一次髮" },
-    { "理个发", "理個髮" },
-    { "理发", "理髮" },
-    { "理完发", "理完髮" },
-    { "理次发", "理次髮" },
-    { "琏", "璉" },
-    { "琐", "瑣" },
-    { "琴钟", "琴鐘" },
-    { "琼", "瓊" },
-    { "瑞征", "瑞徵" },
-    { "瑶", "瑤" },
-    { "瑶签", "瑤籤" },
-    { "瑷", "璦" },
-    { "璎", "瓔" },
-    { "瓒", "瓚" },
-    { "瓮安", "甕安" },
-    { "瓯", "甌" },
-    { "瓷制", "瓷製" },
-    { "甄后", "甄后" },
-    { "甚么", "甚麼" },
-    { "甜水面", "甜水麵" },
-    { "甜面酱", "甜麵醬" },
-    { "生力面", "生力麵" },
-    { "生发", "生髮" },
-    { "生姜", "生薑" },
-    { "生物钟", "生物鐘" },
-    { "生锈", "生鏽" },
-    { "用药", "用藥" },
-    { "甩发", "甩髮" },
-    { "田庄", "田莊" },
-    { "田谷", "田穀" },
-    { "田里", "田裡" },
-    { "由表及里", "由表及裡" },
-    { "甲后路", "甲后路" },
-    { "电", "電" },
-    { "电冲", "電衝" },
-    { "电子表", "電子錶" },
-    { "电子钟", "電子鐘" },
-    { "电杆", "電杆" },
-    { "电波钟", "電波鐘" },
-    { "电线杆", "電線杆" },
-    { "电表", "電錶" },
-    { "电钟", "電鐘" },
-    { "男仆", "男僕" },
-    { "男用表", "男用錶" },
-    { "画", "畫" },
-    { "画着", "畫著" },
-    { "畅", "暢" },
-    { "畅游", "暢遊" },
-    { "留发", "留髮" },
-    { "畴", "疇" },
-    { "疏松", "疏鬆" },
-    { "疑凶", "疑兇" },
-    { "疑系", "疑係" },
-    { "疖", "癤" },
-    { "疗", "療" },
-    { "疟", "瘧" },
-    { "疠", "癘" },
-    { "疡", "瘍" },
-    { "疬", "癧" },
-    { "疮", "瘡" },
-    { "疯", "瘋" },
-    { "疱", "皰" },
-    { "疲困", "疲睏" },
-    { "疴", "痾" },
-    { "病余", "病餘" },
-    { "病征", "病徵" },
-    { "病愈", "病癒" },
-    { "症候", "癥候" },
-    { "症状", "癥狀" },
-    { "症结", "癥結" },
-    { "痈", "癰" },
-    { "痉", "痙" },
-    { "痊愈", "痊癒" },
-    { "痒", "癢" },
-    { "痒疹", "痒疹" },
-    { "痒痒", "痒痒" },
-    { "痕迹", "痕迹" },
-    { "痨", "癆" },
-    { "痪", "瘓" },
-    { "痫", "癇" },
-    { "瘅", "癉" },
-    { "瘗", "瘞" },
-    { "瘘", "瘺" },
-    { "瘪", "癟" },
-    { "瘫", "癱" },
-    { "瘾", "癮" },
-    { "瘿", "癭" },
-    { "癞", "癩" },
-    { "癣", "癬" },
-    { "癫", "癲" },
-    { "白兔擣药", "白兔擣藥" },
-    { "白净面皮", "白淨面皮" },
-    { "白发", "白髮" },
-    { "白干", "白乾" },
-    { "白术", "白朮" },
-    { "白朴", "白樸" },
-    { "白粉面", "白粉麵" },
-    { "白胡", "白鬍" },
-    { "白里透红", "白裡透紅" },
-    { "白霉", "白黴" },
-    { "百余", "百餘" },
-    { "百只", "百隻" },
-    { "百扎", "百紮" },
-    { "百拙千丑", "百拙千醜" },
-    { "百炼", "百鍊" },
-    { "百科里", "百科裡" },
-    { "百花历", "百花曆" },
-    { "百药之长", "百藥之長" },
-    { "百谷", "百穀" },
-    { "的克制", "的剋制" },
-    { "的钟", "的鐘" },
-    { "的钟表", "的鐘錶" },
-    { "的长发", "的長髮" },
-    { "皆准", "皆準" },
-    { "皆可作淀", "皆可作澱" },
-    { "皇历", "皇曆" },
-    { "皇后", "皇后" },
-    { "皇庄", "皇莊" },
-    { "皇极历", "皇極曆" },
-    { "皑", "皚" },
-    { "皓发", "皓髮" },
-    { "皮制", "皮製" },
-    { "皮松", "皮鬆" },
-    { "皮里春秋", "皮裡春秋" },
-    { "皮里阳秋", "皮裡陽秋" },
-    { "皱", "皺" },
-    { "皱别", "皺彆" },
-    { "皱折", "皺摺" },
-    { "皲", "皸" },
-    { "盆吊", "盆弔" },
-    { "盈余", "盈餘" },
-    { "盏", "盞" },
-    { "盐", "鹽" },
-    { "盐余", "鹽餘" },
-    { "盐卤", "鹽滷" },
-    { "盐打怎么咸", "鹽打怎麼鹹" },
-    { "监", "監" },
-    { "监制", "監製" },
-    { "盒里", "盒裡" },
-    { "盖", "蓋" },
-    { "盗", "盜" },
-    { "盗采", "盜採" },
-    { "盗钟", "盜鐘" },
-    { "盘", "盤" },
-    { "盘回", "盤迴" },
-    { "盘里", "盤裡" },
-    { "盛赞", "盛讚" },
-    { "盲干", "盲幹" },
-    { "直冲", "直衝" },
-    { "直接参与", "直接參与" },
-    { "相克", "相剋" },
-    { "相冲", "相衝" },
-    { "相并", "相併" },
-    { "相斗", "相鬥" },
-    { "看下表", "看下錶" },
-    { "看下钟", "看下鐘" },
-    { "看准", "看準" },
-    { "看着表", "看著錶" },
-    { "看着钟", "看著鐘" },
-    { "看着钟表", "看著鐘錶" },
-    { "看表", "看錶" },
-    { "看钟", "看鐘" },
-    { "真个", "真箇" },
-    { "真凶", "真兇" },
-    { "眦", "眥" },
-    { "眼帘", "眼帘" },
-    { "眼干", "眼乾" },
-    { "眼眶里", "眼眶裡" },
-    { "眼睛里", "眼睛裡" },
-    { "眼药", "眼藥" },
-    { "眼里", "眼裡" },
-    { "着书立说", "著書立說" },
-    { "着儿", "著兒" },
-    { "着克制", "著剋制" },
-    { "着录", "著錄" },
-    { "着色软体", "著色軟體" },
-    { "着重指出", "著重指出" },
-    { "睁", "睜" },
-    { "睐", "睞" },
-    { "睑", "瞼" },
-    { "睡游病", "睡遊病" },
-    { "睡着了", "睡著了" },
-    { "瞄准", "瞄準" },
-    { "瞅下表", "瞅下錶" },
-    { "瞅下钟", "瞅下鐘" },
-    { "瞒", "瞞" },
-    { "瞧着表", "瞧著錶" },
-    { "瞧着钟", "瞧著鐘" },
-    { "瞧着钟表", "瞧著鐘錶" },
-    { "瞩", "矚" },
-    { "瞩托", "矚託" },
-    { "瞳蒙", "瞳矇" },
-    { "矜庄", "矜莊" },
-    { "矫", "矯" },
-    { "短几", "短几" },
-    { "短发", "短髮" },
-    { "矮几", "矮几" },
-    { "石几", "石几" },
-    { "石梁", "石樑" },
-    { "石英表", "石英錶" },
-    { "石英钟", "石英鐘" },
-    { "石莼", "石蓴" },
-    { "石钟乳", "石鐘乳" },
-    { "矶", "磯" },
-    { "矾", "礬" },
-    { "矿", "礦" },
-    { "砀", "碭" },
-    { "码", "碼" },
-    { "码表", "碼錶" },
-    { "研制", "研製" },
-    { "砖", "磚" },
-    { "砗", "硨" },
-    { "砚", "硯" },
-    { "砰当", "砰噹" },
-    { "砺", "礪" },
-    { "砻", "礱" },
-    { "砻谷机", "礱穀機" },
-    { "砾", "礫" },
-    { "础", "礎" },
-    { "硕", "碩" },
-    { "硖", "硤" },
-    { "硗", "磽" },
-    { "硗确", "磽确" },
-    { "硬干", "硬幹" },
-    { "确", "確" },
-    { "确瘠", "确瘠" },
-    { "碍", "礙" },
-    { "碑志", "碑誌" },
-    { "碛", "磧" },
-    { "碜", "磣" },
-    { "碰钟", "碰鐘" },
-    { "碱", "鹼" },
-    { "磁制", "磁製" },
-    { "磨制", "磨製" },
-    { "磨炼", "磨鍊" },
-    { "磬钟", "磬鐘" },
-    { "示范", "示範" },
-    { "礼", "禮" },
-    { "礼赞", "禮讚" },
-    { "社里", "社裡" },
-    { "祝发", "祝髮" },
-    { "祝赞", "祝讚" },
-    { "神游", "神遊" },
-    { "神雕", "神鵰" },
-    { "祢", "禰" },
-    { "票庄", "票莊" },
-    { "祭吊", "祭弔" },
-    { "祯", "禎" },
-    { "祷", "禱" },
-    { "祸", "禍" },
-    { "禀", "稟" },
-    { "禁欲", "禁慾" },
-    { "禁药", "禁藥" },
-    { "禄", "祿" },
-    { "禅", "禪" },
-    { "离", "離" },
-    { "禾谷", "禾穀" },
-    { "秀发", "秀髮" },
-    { "私下里", "私下裡" },
-    { "私斗", "私鬥" },
-    { "私欲", "私慾" },
-    { "秃", "禿" },
-    { "秃发", "禿髮" },
-    { "秃妃之发", "禿妃之髮" },
-    { "秆", "稈" },
-    { "秋假里", "秋假裡" },
-    { "秋千", "鞦韆" },
-    { "秋发", "秋髮" },
-    { "秋天里", "秋天裡" },
-    { "秋日里", "秋日裡" },
-    { "秋游", "秋遊" },
-    { "秋阴入井干", "秋陰入井幹" },
-    { "种", "種" },
-    { "种师中", "种師中" },
-    { "种师道", "种師道" },
-    { "种放", "种放" },
-    { "种谷", "種穀" },
-    { "科范", "科範" },
-    { "秒表", "秒錶" },
-    { "秒钟", "秒鐘" },
-    { "秦庄襄王", "秦莊襄王" },
-    { "积", "積" },
-    { "积极参与", "積极參与" },
-    { "积极参加", "積极參加" },
-    { "积淀", "積澱" },
-    { "积谷", "積穀" },
-    { "积谷防饥", "積穀防饑" },
-    { "积郁", "積鬱" },
-    { "称", "稱" },
-    { "称赞", "稱讚" },
-    { "秽", "穢" },
-    { "稀松", "稀鬆" },
-    { "稆", "穭" },
-    { "税", "稅" },
-    { "稣", "穌" },
-    { "稳", "穩" },
-    { "稳占", "穩佔" },
-    { "稳扎", "穩紮" },
-    { "稻谷", "稻穀" },
-    { "稽征", "稽徵" },
-    { "穆罕默德历", "穆罕默德曆" },
-    { "穑", "穡" },
-    { "穗帏飘井干", "繐幃飄井幹" },
-    { "穷", "窮" },
-    { "穷发", "窮髮" },
-    { "穷追不舍", "窮追不捨" },
-    { "空中布雷", "空中佈雷" },
-    { "空余", "空餘" },
-    { "空投布雷", "空投佈雷" },
-    { "空荡", "空蕩" },
-    { "空荡荡", "空蕩蕩" },
-    { "空蒙", "空濛" },
-    { "空钟", "空鐘" },
-    { "窃", "竊" },
-    { "窃钟掩耳", "竊鐘掩耳" },
-    { "窍", "竅" },
-    { "窑", "窯" },
-    { "窒欲", "窒慾" },
-    { "窗台", "窗檯" },
-    { "窗帘", "窗帘" },
-    { "窗明几亮", "窗明几亮" },
-    { "窗明几净", "窗明几淨" },
-    { "窜", "竄" },
-    { "窝", "窩" },
-    { "窝里", "窩裡" },
-    { "窥", "窺" },
-    { "窦", "竇" },
-    { "窭", "窶" },
-    { "立后综", "立后綜" },
-    { "立范", "立範" },
-    { "竖", "豎" },
-    { "竖着", "豎著" },
-    { "站干岸儿", "站乾岸兒" },
-    { "竞", "競" },
-    { "竞斗", "競鬥" },
-    { "童仆", "童僕" },
-    { "端庄", "端莊" },
-    { "竹几", "竹几" },
-    { "竹制", "竹製" },
-    { "竹林之游", "竹林之遊" },
-    { "竹签", "竹籤" },
-    { "笃", "篤" },
-    { "笋", "筍" },
-    { "笋干", "筍乾" },
-    { "笑里藏刀", "笑裡藏刀" },
-    { "笔", "筆" },
-    { "笔秃墨干", "筆禿墨乾" },
-    { "笕", "筧" },
-    { "笺", "箋" },
-    { "笼", "籠" },
-    { "笾", "籩" },
-    { "筑", "築" },
-    { "筑前", "筑前" },
-    { "筑北", "筑北" },
-    { "筑后", "筑後" },
-    { "筑州", "筑州" },
-    { "筑後", "筑後" },
-    { "筑波", "筑波" },
-    { "筑紫", "筑紫" },
-    { "筑肥", "筑肥" },
-    { "筑西", "筑西" },
-    { "筑邦", "筑邦" },
-    { "筑阳", "筑陽" },
-    { "筑陽", "筑陽" },
-    { "答复", "答覆" },
-    { "筚", "篳" },
-    { "筛", "篩" },
-    { "筝", "箏" },
-    { "筵几", "筵几" },
-    { "筹", "籌" },
-    { "签", "簽" },
-    { "签押", "籤押" },
-    { "签条", "籤條" },
-    { "签着", "簽著" },
-    { "签诗", "籤詩" },
-    { "简", "簡" },
-    { "简并", "簡併" },
-    { "简朴", "簡樸" },
-    { "简筑翎", "簡筑翎" },
-    { "算准", "算準" },
-    { "算历", "算曆" },
-    { "算发", "算髮" },
-    { "管干", "管幹" },
-    { "箦", "簀" },
-    { "箧", "篋" },
-    { "箨", "籜" },
-    { "箩", "籮" },
-    { "箪", "簞" },
-    { "箫", "簫" },
-    { "篑", "簣" },
-    { "篓", "簍" },
-    { "篮", "籃" },
-    { "篱", "籬" },
-    { "簖", "籪" },
-    { "簡筑翎", "簡筑翎" },
-    { "簸荡", "簸蕩" },
-    { "籁", "籟" },
-    { "米谷", "米穀" },
-    { "籴", "糴" },
-    { "类", "類" },
-    { "籼", "秈" },
-    { "粉拳绣腿", "粉拳繡腿" },
-    { "粉签子", "粉籤子" },
-    { "粗制", "粗製" },
-    { "粜", "糶" },
-    { "粝", "糲" },
-    { "粤", "粵" },
-    { "粪", "糞" },
-    { "粪秽蔑面", "糞穢衊面" },
-    { "粮", "糧" },
-    { "精准", "精準" },
-    { "精制", "精製" },
-    { "精干", "精幹" },
-    { "精松", "精鬆" },
-    { "精炼", "精鍊" },
-    { "精致", "精緻" },
-    { "精辟", "精闢" },
-    { "糁", "糝" },
-    { "糇", "餱" },
-    { "糊里糊涂", "糊裡糊塗" },
-    { "糕干", "糕乾" },
-    { "系上", "繫上" },
-    { "系世", "繫世" },
-    { "系为", "係為" },
-    { "系于", "繫於" },
-    { "系于一发", "繫於一髮" },
-    { "系列里", "系列裡" },
-    { "系到", "繫到" },
-    { "系囚", "繫囚" },
-    { "系心", "繫心" },
-    { "系念", "繫念" },
-    { "系怀", "繫懷" },
-    { "系恋", "繫戀" },
-    { "系数", "係數" },
-    { "系着", "系著" },
-    { "系紧", "繫緊" },
-    { "系累", "繫纍" },
-    { "系结", "繫結" },
-    { "系绳", "繫繩" },
-    { "系辞", "繫辭" },
-    { "系里", "系裡" },
-    { "系风捕影", "繫風捕影" },
-    { "素发", "素髮" },
-    { "素朴", "素樸" },
-    { "素面", "素麵" },
-    { "索面", "索麵" },
-    { "紧", "緊" },
-    { "紧绷", "緊繃" },
-    { "紧绷着", "緊繃著" },
-    { "紧绷绷", "緊繃繃" },
-    { "紧致", "緊緻" },
-    { "紧追不舍", "緊追不捨" },
-    { "紫姜", "紫薑" },
-    { "累囚", "纍囚" },
-    { "累堆", "纍堆" },
-    { "累瓦结绳", "纍瓦結繩" },
-    { "累绁", "纍紲" },
-    { "累臣", "纍臣" },
-    { "絷", "縶" },
-    { "綑扎", "綑紮" },
-    { "經有云", "經有云" },
-    { "緝凶", "緝兇" },
-    { "繁复", "繁複" },
-    { "繁钟", "繁鐘" },
-    { "纠", "糾" },
-    { "纡", "紆" },
-    { "纡余", "紆餘" },
-    { "纡回", "紆迴" },
-    { "纡郁", "紆鬱" },
-    { "红", "紅" },
-    { "红发", "紅髮" },
-    { "红绳系足", "紅繩繫足" },
-    { "红色长发", "紅色長髮" },
-    { "红钟", "紅鐘" },
-    { "纣", "紂" },
-    { "纤", "纖" },
-    { "纤夫", "縴夫" },
-    { "纤手", "縴手" },
-    { "纥", "紇" },
-    { "约", "約" },
-    { "约占", "約佔" },
-    { "级", "級" },
-    { "纨", "紈" },
-    { "纩", "纊" },
-    { "纪", "紀" },
-    { "纪历", "紀曆" },
-    { "纫", "紉" },
-    { "纬", "緯" },
-    { "纭", "紜" },
-    { "纯", "純" },
-    { "纯朴", "純樸" },
-    { "纰", "紕" },
-    { "纱", "紗" },
-    { "纲", "綱" },
-    { "纳", "納" },
-    { "纳征", "納徵" },
-    { "纵", "縱" },
-    { "纵欲", "縱慾" },
-    { "纶", "綸" },
-    { "纷", "紛" },
-    { "纸", "紙" },
-    { "纸扎", "紙紮" },
-    { "纹", "紋" },
-    { "纺", "紡" },
-    { "纽", "紐" },
-    { "纾", "紓" },
-    { "线", "線" },
-    { "绀", "紺" },
-    { "绁", "紲" },
-    { "绂", "紱" },
-    { "练", "練" },
-    { "组", "組" },
-    { "组里", "組裡" },
-    { "绅", "紳" },
-    { "细", "細" },
-    { "细不容发", "細不容髮" },
-    { "细如发", "細如髮" },
-    { "细炼", "細鍊" },
-    { "细致", "細緻" },
-    { "织", "織" },
-    { "终", "終" },
-    { "绉", "縐" },
-    { "绊", "絆" },
-    { "绋", "紼" },
-    { "绌", "絀" },
-    { "绍", "紹" },
-    { "绎", "繹" },
-    { "经", "經" },
-    { "经有云", "經有云" },
-    { "绐", "紿" },
-    { "绑", "綁" },
-    { "绑扎", "綁紮" },
-    { "绒", "絨" },
-    { "结", "結" },
-    { "结伙", "結夥" },
-    { "结伴同游", "結伴同遊" },
-    { "结余", "結餘" },
-    { "结发", "結髮" },
-    { "结彩", "結綵" },
-    { "结扎", "結紮" },
-    { "绕", "繞" },
-    { "绕梁", "繞樑" },
-    { "绗", "絎" },
-    { "绘", "繪" },
-    { "绘制", "繪製" },
-    { "给", "給" },
-    { "绚", "絢" },
-    { "绛", "絳" },
-    { "络", "絡" },
-    { "络腮胡", "絡腮鬍" },
-    { "绝", "絕" },
-    { "绞", "絞" },
-    { "绞干", "絞乾" },
-    { "统", "統" },
-    { "绠", "綆" },
-    { "绡", "綃" },
-    { "绢", "絹" },
-    { "绣", "綉" },
-    { "绣像", "繡像" },
-    { "绣口", "繡口" },
-    { "绣得", "繡得" },
-    { "绣户", "繡戶" },
-    { "绣房", "繡房" },
-    { "绣毯", "繡毯" },
-    { "绣球", "繡球" },
-    { "绣的", "繡的" },
-    { "绣花", "繡花" },
-    { "绣衣", "繡衣" },
-    { "绣起", "繡起" },
-    { "绣阁", "繡閣" },
-    { "绣鞋", "繡鞋" },
-    { "绥", "綏" },
-    { "绦", "絛" },
-    { "继", "繼" },
-    { "绨", "綈" },
-    { "绩", "績" },
-    { "绪", "緒" },
-    { "绪余", "緒餘" },
-    { "绫", "綾" },
-    { "续", "續" },
-    { "绮", "綺" },
-    { "绯", "緋" },
-    { "绰", "綽" },
-    { "绲", "緄" },
-    { "绳", "繩" },
-    { "维", "維" },
-    { "维系", "維繫" },
-    { "绵", "綿" },
-    { "绶", "綬" },
-    { "绷住", "繃住" },
-    { "绷子", "繃子" },
-    { "绷带", "繃帶" },
-    { "绷开", "繃開" },
-    { "绷扒吊拷", "繃扒弔拷" },
-    { "绷着", "繃著" },
-    { "绷紧", "繃緊" },
-    { "绷脸", "繃臉" },
-    { "绸", "綢" },
-    { "绸缎庄", "綢緞莊" },
-    { "绺", "綹" },
-    { "绻", "綣" },
-    { "综", "綜" },
-    { "绽", "綻" },
-    { "绾", "綰" },
-    { "绾发", "綰髮" },
-    { "绿", "綠" },
-    { "绿发", "綠髮" },
-    { "缀", "綴" },
-    { "缁", "緇" },
-    { "缂", "緙" },
-    { "缃", "緗" },
-    { "缄", "緘" },
-    { "缅", "緬" },
-    { "缆", "纜" },
-    { "缇", "緹" },
-    { "缈", "緲" },
-    { "缉", "緝" },
-    { "缉凶", "緝兇" },
-    { "缋", "繢" },
-    { "缌", "緦" },
-    { "缍", "綞" },
-    { "缎", "緞" },
-    { "缏", "緶" },
-    { "缑", "緱" },
-    { "缒", "縋" },
-    { "缓", "緩" },
-    { "缓冲", "緩衝" },
-    { "缓征", "緩徵" },
-    { "缔", "締" },
-    { "缕", "縷" },
-    { "编", "編" },
-    { "编制", "編製" },
-    { "编发", "編髮" },
-    { "编采", "編採" },
-    { "编钟", "編鐘" },
-    { "缗", "緡" },
-    { "缘", "緣" },
-    { "缙", "縉" },
-    { "缚", "縛" },
-    { "缛", "縟" },
-    { "缜", "縝" },
-    { "缜致", "縝緻" },
-    { "缝", "縫" },
-    { "缝制", "縫製" },
-    { "缝里", "縫裡" },
-    { "缟", "縞" },
-    { "缠", "纏" },
-    { "缠斗", "纏鬥" },
-    { "缡", "縭" },
-    { "缢", "縊" },
-    { "缣", "縑" },
-    { "缤", "繽" },
-    { "缥", "縹" },
-    { "缦", "縵" },
-    { "缧", "縲" },
-    { "缨", "纓" },
-    { "缩", "縮" },
-    { "缩栗", "縮慄" },
-    { "缪", "繆" },
-    { "缫", "繅" },
-    { "缬", "纈" },
-    { "缭", "繚" },
-    { "缮", "繕" },
-    { "缯", "繒" },
-    { "缰", "韁" },
-    { "缱", "繾" },
-    { "缲", "繰" },
-    { "缳", "繯" },
-    { "缴", "繳" },
-    { "缵", "纘" },
-    { "罂", "罌" },
-    { "网", "網" },
-    { "网志", "網誌" },
-    { "网游", "網遊" },
-    { "网里", "網裡" },
-    { "罗", "羅" },
-    { "罚", "罰" },
-    { "罢", "罷" },
-    { "置言成范", "置言成範" },
-    { "罴", "羆" },
-    { "羁", "羈" },
-    { "羁系", "羈繫" },
-    { "美丑", "美醜" },
-    { "美仑", "美崙" },
-    { "美制", "美製" },
-    { "美占", "美佔" },
-    { "美发", "美髮" },
-    { "羟", "羥" },
-    { "羡", "羨" },
-    { "羡余", "羨餘" },
-    { "群丑", "群醜" },
-    { "翕辟", "翕闢" },
-    { "翘", "翹" },
-    { "翱游", "翱遊" },
-    { "翻松", "翻鬆" },
-    { "翻涌", "翻湧" },
-    { "老仆", "老僕" },
-    { "老姜", "老薑" },
-    { "老干", "老乾" },
-    { "老干部", "老幹部" },
-    { "老庄", "老莊" },
-    { "老板", "老闆" },
-    { "老爷钟", "老爺鐘" },
-    { "老蒙", "老懞" },
-    { "考征", "考徵" },
-    { "而克制", "而剋制" },
-    { "耍斗", "耍鬥" },
-    { "耕佣", "耕傭" },
-    { "耕获", "耕穫" },
-    { "耧", "耬" },
-    { "耳余", "耳餘" },
-    { "耸", "聳" },
-    { "耻", "恥" },
-    { "聂", "聶" },
-    { "聋", "聾" },
-    { "职", "職" },
-    { "聍", "聹" },
-    { "联", "聯" },
-    { "联系", "聯繫" },
-    { "聘雇", "聘僱" },
-    { "聩", "聵" },
-    { "聪", "聰" },
-    { "肃", "肅" },
-    { "肉丝面", "肉絲麵" },
-    { "肉干", "肉乾" },
-    { "肉松", "肉鬆" },
-    { "肉欲", "肉慾" },
-    { "肉羹面", "肉羹麵" },
-    { "肚里", "肚裡" },
-    { "肝郁", "肝鬱" },
-    { "肠", "腸" },
-    { "股栗", "股慄" },
-    { "肤", "膚" },
-    { "肤发", "膚髮" },
-    { "肥筑方言", "肥筑方言" },
-    { "肮", "骯" },
-    { "肮肮脏脏", "骯骯髒髒" },
-    { "肮脏", "骯髒" },
-    { "肴", "餚" },
-    { "肴馔", "肴饌" },
-    { "肾", "腎" },
-    { "肿", "腫" },
-    { "胀", "脹" },
-    { "胁", "脅" },
-    { "胃药", "胃藥" },
-    { "胃里", "胃裡" },
-    { "胆", "膽" },
-    { "背地里", "背地裡" },
-    { "胎发", "胎髮" },
-    { "胜", "勝" },
-    { "胜肽", "胜肽" },
-    { "胜键", "胜鍵" },
-    { "胡云", "胡云" },
-    { "胡同", "衚衕" },
-    { "胡子", "鬍子" },
-    { "胡朴安", "胡樸安" },
-    { "胡梢", "鬍梢" },
-    { "胡渣", "鬍渣" },
-    { "胡里胡涂", "胡裡胡塗" },
-    { "胡须", "鬍鬚" },
-    { "胡髭", "鬍髭" },
-    { "胡髯", "鬍髯" },
-    { "胧", "朧" },
-    { "胪", "臚" },
-    { "胫", "脛" },
-    { "胶", "膠" },
-    { "胶卷", "膠捲" },
-    { "能克制", "能剋制" },
-    { "能干", "能幹" },
-    { "脉", "脈" },
-    { "脉冲", "脈衝" },
-    { "脊梁", "脊樑" },
-    { "脍", "膾" },
-    { "脏", "臟" },
-    { "脏东西", "髒東西" },
-    { "脏乱", "髒亂" },
-    { "脏了", "髒了" },
-    { "脏兮兮", "髒兮兮" },
-    { "脏发", "髒髮" },
-    { "脏字", "髒字" },
-    { "脏得", "髒得" },
-    { "脏心", "髒心" },
-    { "脏水", "髒水" },
-    { "脏的", "髒的" },
-    { "脏词", "髒詞" },
-    { "脏话", "髒話" },
-    { "脏钱", "髒錢" },
-    { "脐", "臍" },
-    { "脑", "腦" },
-    { "脑子里", "腦子裡" },
-    { "脑干", "腦幹" },
-    { "脓", "膿" },
-    { "脔", "臠" },
-    { "脚", "腳" },
-    { "脚注", "腳註" },
-    { "脚炼", "腳鍊" },
-    { "脱", "脫" },
-    { "脱发", "脫髮" },
-    { "脱谷机", "脫穀機" },
-    { "脶", "腡" },
-    { "脸", "臉" },
-    { "腊", "臘" },
-    { "腊之以为饵", "腊之以為餌" },
-    { "腊味", "腊味" },
-    { "腊毒", "腊毒" },
-    { "腊笔", "腊筆" },
-    { "腐余", "腐餘" },
-    { "腐干", "腐乾" },
-    { "腕表", "腕錶" },
-    { "腭", "齶" },
-    { "腰里", "腰裡" },
-    { "腻", "膩" },
-    { "腼", "靦" },
-    { "腽", "膃" },
-    { "腾", "騰" },
-    { "腾冲", "騰衝" },
-    { "膏药", "膏藥" },
-    { "膑", "臏" },
-    { "膨松", "膨鬆" },
-    { "臣仆", "臣僕" },
-    { "臧谷亡羊", "臧穀亡羊" },
-    { "自制", "自製" },
-    { "自觉自愿", "自覺自愿" },
-    { "致密", "緻密" },
-    { "舂谷", "舂穀" },
-    { "舆", "輿" },
-    { "舌干唇焦", "舌乾唇焦" },
-    { "舍不得", "捨不得" },
-    { "舍出", "捨出" },
-    { "舍去", "捨去" },
-    { "舍命", "捨命" },
-    { "舍堕", "捨墮" },
-    { "舍安就危", "捨安就危" },
-    { "舍实", "捨實" },
-    { "舍己为人", "捨己為人" },
-    { "舍己为公", "捨己為公" },
-    { "舍己为国", "捨己為國" },
-    { "舍己从人", "捨己從人" },
-    { "舍己救人", "捨己救人" },
-    { "舍弃", "捨棄" },
-    { "舍得", "捨得" },
-    { "舍我其谁", "捨我其誰" },
-    { "舍本逐末", "捨本逐末" },
-    { "舍死忘生", "捨死忘生" },
-    { "舍生", "捨生" },
-    { "舍短取长", "捨短取長" },
-    { "舍身", "捨身" },
-    { "舍车保帅", "捨車保帥" },
-    { "舍近求远", "捨近求遠" },
-    { "舒卷", "舒捲" },
-    { "舞后", "舞后" },
-    { "舣", "艤" },
-    { "航海历", "航海曆" },
-    { "舰", "艦" },
-    { "舰只", "艦隻" },
-    { "舱", "艙" },
-    { "船只", "船隻" },
-    { "船钟", "船鐘" },
-    { "舻", "艫" },
-    { "良药", "良藥" },
-    { "艰", "艱" },
-    { "色欲", "色慾" },
-    { "艳", "艷" },
-    { "艳后", "艷后" },
-    { "艷后", "艷后" },
-    { "艸木丰丰", "艸木丰丰" },
-    { "艺", "藝" },
-    { "节", "節" },
-    { "节余", "節餘" },
-    { "节欲", "節慾" },
-    { "芈", "羋" },
-    { "芍药", "芍藥" },
-    { "芗", "薌" },
-    { "芜", "蕪" },
-    { "芦", "蘆" },
-    { "花卷", "花捲" },
-    { "花哄", "花鬨" },
-    { "花庵词选", "花菴詞選" },
-    { "花拳绣腿", "花拳繡腿" },
-    { "花盆里", "花盆裡" },
-    { "花药", "花藥" },
-    { "花钟", "花鐘" },
-    { "花马吊嘴", "花馬弔嘴" },
-    { "苁", "蓯" },
-    { "苇", "葦" },
-    { "苈", "藶" },
-    { "苋", "莧" },
-    { "苌", "萇" },
-    { "苍", "蒼" },
-    { "苍发", "蒼髮" },
-    { "苍术", "蒼朮" },
-    { "苍郁", "蒼鬱" },
-    { "苎", "苧" },
-    { "苏", "蘇" },
-    { "苏昆", "蘇崑" },
-    { "苑里", "苑裡" },
-    { "苦干", "苦幹" },
-    { "苦斗", "苦鬥" },
-    { "苦药", "苦藥" },
-    { "苦里", "苦裡" },
-    { "苧", "薴" },
-    { "英占", "英佔" },
-    { "苹", "蘋" },
-    { "苹萦", "苹縈" },
-    { "茂都淀", "茂都澱" },
-    { "范例", "範例" },
-    { "范围", "範圍" },
-    { "范字", "範字" },
-    { "范式", "範式" },
-    { "范性形变", "範性形變" },
-    { "范数", "範數" },
-    { "范文", "範文" },
-    { "范本", "範本" },
-    { "范畴", "範疇" },
-    { "范金", "範金" },
-    { "茎", "莖" },
-    { "茎干", "莖幹" },
-    { "茏", "蘢" },
-    { "茑", "蔦" },
-    { "茔", "塋" },
-    { "茕", "煢" },
-    { "茧", "繭" },
-    { "茶余", "茶餘" },
-    { "茶几", "茶几" },
-    { "茶庄", "茶莊" },
-    { "茶面", "茶麵" },
-    { "荆", "荊" },
-    { "草丛里", "草叢裡" },
-    { "草广", "草广" },
-    { "草荐", "草荐" },
-    { "草药", "草藥" },
-    { "荐", "薦" },
-    { "荐居", "荐居" },
-    { "荐臻", "荐臻" },
-    { "荐饥", "荐饑" },
-    { "荚", "莢" },
-    { "荛", "蕘" },
-    { "荜", "蓽" },
-    { "荞", "蕎" },
-    { "荞麦面", "蕎麥麵" },
-    { "荟", "薈" },
-    { "荠", "薺" },
-    { "荡", "盪" },
-    { "荡产", "蕩產" },
-    { "荡女", "蕩女" },
-    { "荡妇", "蕩婦" },
-    { "荡寇", "蕩寇" },
-    { "荡平", "蕩平" },
-    { "荡来荡去", "蕩來蕩去" },
-    { "荡气回肠", "蕩氣迴腸" },
-    { "荡涤", "蕩滌" },
-    { "荡漾", "蕩漾" },
-    { "荡然", "蕩然" },
-    { "荡舟", "蕩舟" },
-    { "荡船", "蕩船" },
-    { "荡荡", "蕩蕩" },
-    { "荣", "榮" },
-    { "荤", "葷" },
-    { "荥", "滎" },
-    { "荦", "犖" },
-    { "荦确", "犖确" },
-    { "荧", "熒" },
-    { "荧郁", "熒鬱" },
-    { "荨", "蕁" },
-    { "荩", "藎" },
-    { "荪", "蓀" },
-    { "荫", "蔭" },
-    { "荭", "葒" },
-    { "药", "葯" },
-    { "药专", "藥專" },
-    { "药丸", "藥丸" },
-    { "药典", "藥典" },
-    { "药到命除", "藥到命除" },
-    { "药到病除", "藥到病除" },
-    { "药剂", "藥劑" },
-    { "药力", "藥力" },
-    { "药包", "藥包" },
-    { "药医学系", "藥醫學系" },
-    { "药单", "藥單" },
-    { "药厂", "藥廠" },
-    { "药名", "藥名" },
-    { "药味", "藥味" },
-    { "药品", "藥品" },
-    { "药商", "藥商" },
-    { "药头", "藥頭" },
-    { "药婆", "藥婆" },
-    { "药学", "藥學" },
-    { "药害", "藥害" },
-    { "药局", "藥局" },
-    { "药师", "藥師" },
-    { "药店", "藥店" },
-    { "药引", "藥引" },
-    { "药性", "藥性" },
-    { "药房", "藥房" },
-    { "药效", "藥效" },
-    { "药方", "藥方" },
-    { "药材", "藥材" },
-    { "药检局", "藥檢局" },
-    { "药棉", "藥棉" },
-    { "药水", "藥水" },
-    { "药油", "藥油" },
-    { "药液", "藥液" },
-    { "药渣", "藥渣" },
-    { "药片", "藥片" },
-    { "药物", "藥物" },
-    { "药王", "藥王" },
-    { "药理", "藥理" },
-    { "药瓶", "藥瓶" },
-    { "药用", "藥用" },
-    { "药皂", "藥皂" },
-    { "药盒", "藥盒" },
-    { "药石", "藥石" },
-    { "药科", "藥科" },
-    { "药签", "藥籤" },
-    { "药箱", "藥箱" },
-    { "药粉", "藥粉" },
-    { "药糖", "藥糖" },
-    { "药线", "藥線" },
-    { "药罐", "藥罐" },
-    { "药膏", "藥膏" },
-    { "药舖", "藥舖" },
-    { "药茶", "藥茶" },
-    { "药草", "藥草" },
-    { "药行", "藥行" },
-    { "药贩", "藥販" },
-    { "药费", "藥費" },
-    { "药酒", "藥酒" },
-    { "药量", "藥量" },
-    { "药针", "藥針" },
-    { "药铺", "藥鋪" },
-    { "药面儿", "藥麵兒" },
-    { "药饵", "藥餌" },
-    { "荷花淀", "荷花澱" },
-    { "莅", "蒞" },
-    { "莜面", "莜麵" },
-    { "莱", "萊" },
-    { "莲", "蓮" },
-    { "莳", "蒔" },
-    { "莴", "萵" },
-    { "莶", "薟" },
-    { "获", "獲" },
-    { "获匪其丑", "獲匪其醜" },
-    { "莸", "蕕" },
-    { "莹", "瑩" },
-    { "莺", "鶯" },
-    { "莽荡", "莽蕩" },
-    { "菜干", "菜乾" },
-    { "菜肴", "菜肴" },
-    { "菠棱菜", "菠稜菜" },
-    { "菠萝干", "菠蘿乾" },
-    { "萝", "蘿" },
-    { "萝卜", "蘿蔔" },
-    { "萝卜干", "蘿蔔乾" },
-    { "萤", "螢" },
-    { "营", "營" },
-    { "营干", "營幹" },
-    { "萦", "縈" },
-    { "萦回", "縈迴" },
-    { "萧", "蕭" },
-    { "萧参", "蕭蔘" },
-    { "萨", "薩" },
-    { "落发", "落髮" },
-    { "落腮胡", "落腮鬍" },
-    { "葡占", "葡佔" },
-    { "葡萄干", "葡萄乾" },
-    { "董氏封发", "董氏封髮" },
-    { "葱", "蔥" },
-    { "葱郁", "蔥鬱" },
-    { "蒇", "蕆" },
-    { "蒉", "蕢" },
-    { "蒋", "蔣" },
-    { "蒌", "蔞" },
-    { "蒙事", "矇事" },
-    { "蒙头转", "矇頭轉" },
-    { "蒙庄", "蒙莊" },
-    { "蒙懂", "懞懂" },
-    { "蒙昧无知", "矇昧無知" },
-    { "蒙松雨", "濛鬆雨" },
-    { "蒙汗药", "蒙汗藥" },
-    { "蒙汜", "濛汜" },
-    { "蒙混", "矇混" },
-    { "蒙直", "懞直" },
-    { "蒙着", "矇著" },
-    { "蒙瞍", "矇瞍" },
-    { "蒙聩", "矇聵" },
-    { "蒙胧", "朦朧" },
-    { "蒙蒙懂懂", "懞懞懂懂" },
-    { "蒙蒙细雨", "濛濛細雨" },
-    { "蒙雾", "濛霧" },
-    { "蒙骗", "矇騙" },
-    { "蒙鸿", "濛鴻" },
-    { "蒜发", "蒜髮" },
-    { "蓄发", "蓄髮" },
-    { "蓄胡", "蓄鬍" },
-    { "蓄须", "蓄鬚" },
-    { "蓊郁", "蓊鬱" },
-    { "蓝", "藍" },
-    { "蓝淀", "藍澱" },
-    { "蓟", "薊" },
-    { "蓠", "蘺" },
-    { "蓣", "蕷" },
-    { "蓥", "鎣" },
-    { "蓦", "驀" },
-    { "蓬发", "蓬髮" },
-    { "蓬松", "蓬鬆" },
-    { "蓬蓬松松", "蓬蓬鬆鬆" },
-    { "蔂", "虆" },
-    { "蔷", "薔" },
-    { "蔹", "蘞" },
-    { "蔺", "藺" },
-    { "蔼", "藹" },
-    { "蕲", "蘄" },
-    { "蕴", "蘊" },
-    { "蕴含着", "蘊含著" },
-    { "蕴涵着", "蘊涵著" },
-    { "薄干", "薄幹" },
-    { "薄幸", "薄倖" },
-    { "薙发", "薙髮" },
-    { "薝卜", "薝蔔" },
-    { "薮", "藪" },
-    { "藏历", "藏曆" },
-    { "藏蒙歌儿", "藏矇歌兒" },
-    { "藓", "蘚" },
-    { "藤制", "藤製" },
-    { "蘖", "櫱" },
-    { "虎斗", "虎鬥" },
-    { "虎须", "虎鬚" },
-    { "虏", "虜" },
-    { "虑", "慮" },
-    { "虚", "虛" },
-    { "虫", "蟲" },
-    { "虫部", "虫部" },
-    { "虬", "虯" },
-    { "虮", "蟣" },
-    { "虮蝨相吊", "蟣蝨相弔" },
-    { "虽", "雖" },
-    { "虾", "蝦" },
-    { "虿", "蠆" },
-    { "蚀", "蝕" },
-    { "蚁", "蟻" },
-    { "蚁后", "蟻后" },
-    { "蚂", "螞" },
-    { "蚊动牛斗", "蚊動牛鬥" },
-    { "蚕", "蠶" },
-    { "蚬", "蜆" },
-    { "蛇发女妖", "蛇髮女妖" },
-    { "蛊", "蠱" },
-    { "蛎", "蠣" },
-    { "蛏", "蟶" },
-    { "蛏干", "蟶乾" },
-    { "蛔虫药", "蛔蟲藥" },
-    { "蛮", "蠻" },
-    { "蛮干", "蠻幹" },
-    { "蛰", "蟄" },
-    { "蛱", "蛺" },
-    { "蛲", "蟯" },
-    { "蛳", "螄" },
-    { "蛴", "蠐" },
-    { "蜂准", "蜂準" },
-    { "蜂后", "蜂后" },
-    { "蜂涌", "蜂湧" },
-    { "蜕", "蛻" },
-    { "蜗", "蝸" },
-    { "蜜里调油", "蜜裡調油" },
-    { "蜡", "蠟" },
-    { "蜡月", "蜡月" },
-    { "蜡祭", "蜡祭" },
-    { "蝇", "蠅" },
-    { "蝈", "蟈" },
-    { "蝉", "蟬" },
-    { "蝎", "蠍" },
-    { "蝎蝎螫螫", "蝎蝎螫螫" },
-    { "蝎谮", "蝎譖" },
-    { "蝼", "螻" },
-    { "蝾", "蠑" },
-    { "蟻后", "蟻后" },
-    { "蠁干", "蠁幹" },
-    { "血余", "血餘" },
-    { "血拼", "血拚" },
-    { "衅", "釁" },
-    { "衅钟", "釁鐘" },
-    { "行事历", "行事曆" },
-    { "行凶", "行兇" },
-    { "衔", "銜" },
-    { "衣绣昼行", "衣繡晝行" },
-    { "补", "補" },
-    { "补注", "補註" },
-    { "补药", "補藥" },
-    { "补血药", "補血藥" },
-    { "表停", "錶停" },
-    { "表冠", "錶冠" },
-    { "表厂", "錶廠" },
-    { "表壳", "錶殼" },
-    { "表带", "錶帶" },
-    { "表店", "錶店" },
-    { "表征", "表徵" },
-    { "表快", "錶快" },
-    { "表慢", "錶慢" },
-    { "表板", "錶板" },
-    { "表王", "錶王" },
-    { "表的历史", "錶的歷史" },
-    { "表的嘀嗒", "錶的嘀嗒" },
-    { "表盘", "錶盤" },
-    { "表蒙子", "錶蒙子" },
-    { "表行", "錶行" },
-    { "表转", "錶轉" },
-    { "表速", "錶速" },
-    { "表里", "表裡" },
-    { "表针", "錶針" },
-    { "表链", "錶鏈" },
-    { "衬", "襯" },
-    { "衬里", "襯裡" },
-    { "衮", "袞" },
-    { "袄", "襖" },
-    { "袅", "裊" },
-    { "袋表", "袋錶" },
-    { "袋里", "袋裡" },
-    { "袖里", "袖裡" },
-    { "袜", "襪" },
-    { "被发佯狂", "被髮佯狂" },
-    { "被发入山", "被髮入山" },
-    { "被发左衽", "被髮左衽" },
-    { "被发缨冠", "被髮纓冠" },
-    { "被发阳狂", "被髮陽狂" },
-    { "被复", "被複" },
-    { "被里", "被裡" },
-    { "袭", "襲" },
-    { "裁制", "裁製" },
-    { "裁并", "裁併" },
-    { "装", "裝" },
-    { "装折", "裝摺" },
-    { "裆", "襠" },
-    { "裢", "褳" },
-    { "裣", "襝" },
-    { "裤", "褲" },
-    { "褒赞", "褒讚" },
-    { "褛", "褸" },
-    { "褴", "襤" },
-    { "西占", "西佔" },
-    { "西历", "西曆" },
-    { "西周钟", "西周鐘" },
-    { "西岳", "西嶽" },
-    { "西晒", "西晒" },
-    { "西游", "西遊" },
-    { "西药", "西藥" },
-    { "要么", "要麼" },
-    { "要克制", "要剋制" },
-    { "要冲", "要衝" },
-    { "要占", "要佔" },
-    { "覆盖着", "覆蓋著" },
-    { "覆着", "覆著" },
-    { "见", "見" },
-    { "见棱见角", "見稜見角" },
-    { "见素抱朴", "見素抱樸" },
-    { "观", "觀" },
-    { "观采", "觀採" },
-    { "规", "規" },
-    { "规范", "規範" },
-    { "觅", "覓" },
-    { "视", "視" },
-    { "觇", "覘" },
-    { "览", "覽" },
-    { "觉", "覺" },
-    { "觊", "覬" },
-    { "觋", "覡" },
-    { "觌", "覿" },
-    { "觎", "覦" },
-    { "觏", "覯" },
-    { "觐", "覲" },
-    { "觑", "覷" },
-    { "角落里", "角落裡" },
-    { "觚棱", "觚稜" },
-    { "觞", "觴" },
-    { "解发佯狂", "解髮佯狂" },
-    { "解痛药", "解痛藥" },
-    { "解药", "解藥" },
-    { "解雇", "解僱" },
-    { "触", "觸" },
-    { "触须", "觸鬚" },
-    { "觯", "觶" },
-    { "言云", "言云" },
-    { "言大而夸", "言大而夸" },
-    { "言辩而确", "言辯而确" },
-    { "詩云", "詩云" },
-    { "誉", "譽" },
-    { "誊", "謄" },
-    { "語有云", "語有云" },
-    { "謷丑", "謷醜" },
-    { "警世钟", "警世鐘" },
-    { "警报钟", "警報鐘" },
-    { "警示钟", "警示鐘" },
-    { "警钟", "警鐘" },
-    { "计", "計" },
-    { "计时表", "計時錶" },
-    { "订", "訂" },
-    { "订制", "訂製" },
-    { "讣", "訃" },
-    { "认", "認" },
-    { "认准", "認準" },
-    { "讥", "譏" },
-    { "讦", "訐" },
-    { "讧", "訌" },
-    { "讨", "討" },
-    { "让", "讓" },
-    { "讪", "訕" },
-    { "讫", "訖" },
-    { "训", "訓" },
-    { "议", "議" },
-    { "讯", "訊" },
-    { "记", "記" },
-    { "讲", "講" },
-    { "讳", "諱" },
-    { "讴", "謳" },
-    { "讵", "詎" },
-    { "讶", "訝" },
-    { "讷", "訥" },
-    { "许", "許" },
-    { "许愿起经", "許愿起經" },
-    { "许虬", "許虬" },
-    { "讹", "訛" },
-    { "论", "論" },
-    { "讼", "訟" },
-    { "讽", "諷" },
-    { "设", "設" },
-    { "访", "訪" },
-    { "诀", "訣" },
-    { "证", "證" },
-    { "诂", "詁" },
-    { "诃", "訶" },
-    { "评", "評" },
-    { "评注", "評註" },
-    { "诅", "詛" },
-    { "识", "識" },
-    { "诈", "詐" },
-    { "诉", "訴" },
-    { "诊", "診" },
-    { "诋", "詆" },
-    { "诌", "謅" },
-    { "词", "詞" },
-    { "词余", "詞餘" },
-    { "词干", "詞幹" },
-    { "词汇", "詞彙" },
-    { "诎", "詘" },
-    { "诏", "詔" },
-    { "译", "譯" },
-    { "译注", "譯註" },
-    { "诒", "詒" },
-    { "诓", "誆" },
-    { "诔", "誄" },
-    { "诔赞", "誄讚" },
-    { "试", "試" },
-    { "试制", "試製" },
-    { "试药", "試藥" },
-    { "诖", "詿" },
-    { "诗", "詩" },
-    { "诗云", "詩云" },
-    { "诗余", "詩餘" },
-    { "诗赞", "詩讚" },
-    { "诗钟", "詩鐘" },
-    { "诘", "詰" },
-    { "诙", "詼" },
-    { "诚", "誠" },
-    { "诚征", "誠徵" },
-    { "诚朴", "誠樸" },
-    { "诛", "誅" },
-    { "诜", "詵" },
-    { "话", "話" },
-    { "话里有话", "話裡有話" },
-    { "诞", "誕" },
-    { "诟", "詬" },
-    { "诠", "詮" },
-    { "诡", "詭" },
-    { "询", "詢" },
-    { "诣", "詣" },
-    { "诤", "諍" },
-    { "该", "該" },
-    { "该钟", "該鐘" },
-    { "详", "詳" },
-    { "详征博引", "詳徵博引" },
-    { "详注", "詳註" },
-    { "诧", "詫" },
-    { "诨", "諢" },
-    { "诩", "詡" },
-    { "诫", "誡" },
-    { "诬", "誣" },
-    { "诬蔑", "誣衊" },
-    { "语", "語" },
-    { "语云", "語云" },
-    { "语有云", "語有云" },
-    { "语汇", "語彙" },
-    { "诮", "誚" },
-    { "误", "誤" },
-    { "诰", "誥" },
-    { "诱", "誘" },
-    { "诱奸", "誘姦" },
-    { "诲", "誨" },
-    { "诳", "誑" },
-    { "说", "說" },
-    { "说着", "說著" },
-    { "诵", "誦" },
-    { "诶", "誒" },
-    { "请", "請" },
-    { "请君入瓮", "請君入甕" },
-    { "请托", "請託" },
-    { "诸", "諸" },
-    { "诸余", "諸餘" },
-    { "诹", "諏" },
-    { "诺", "諾" },
-    { "读", "讀" },
-    { "诼", "諑" },
-    { "诽", "誹" },
-    { "课", "課" },
-    { "课余", "課餘" },
-    { "课征", "課徵" },
-    { "诿", "諉" },
-    { "谀", "諛" },
-    { "谁", "誰" },
-    { "谁干的", "誰幹的" },
-    { "谂", "諗" },
-    { "调", "調" },
-    { "调准", "調準" },
-    { "调制", "調製" },
-    { "调表", "調錶" },
-    { "谄", "諂" },
-    { "谅", "諒" },
-    { "谆", "諄" },
-    { "谇", "誶" },
-    { "谈", "談" },
-    { "谈征", "談徵" },
-    { "谊", "誼" },
-    { "谋", "謀" },
-    { "谋干", "謀幹" },
-    { "谌", "諶" },
-    { "谍", "諜" },
-    { "谎", "謊" },
-    { "谏", "諫" },
-    { "谐", "諧" },
-    { "谑", "謔" },
-    { "谒", "謁" },
-    { "谓", "謂" },
-    { "谔", "諤" },
-    { "谕", "諭" },
-    { "谖", "諼" },
-    { "谗", "讒" },
-    { "谘", "諮" },
-    { "谙", "諳" },
-    { "谚", "諺" },
-    { "谛", "諦" },
-    { "谜", "謎" },
-    { "谝", "諞" },
-    { "谟", "謨" },
-    { "谠", "讜" },
-    { "谡", "謖" },
-    { "谢", "謝" },
-    { "谢华后", "謝華后" },
-    { "谣", "謠" },
-    { "谤", "謗" },
-    { "谥", "謚" },
-    { "谦", "謙" },
-    { "谧", "謐" },
-    { "谨", "謹" },
-    { "谩", "謾" },
-    { "谪", "謫" },
-    { "谫", "譾" },
-    { "谬", "謬" },
-    { "谬赞", "謬讚" },
-    { "谬采虚声", "謬採虛聲" },
-    { "谭", "譚" },
-    { "谮", "譖" },
-    { "谯", "譙" },
-    { "谰", "讕" },
-    { "谱", "譜" },
-    { "谲", "譎" },
-    { "谳", "讞" },
-    { "谴", "譴" },
-    { "谵", "譫" },
-    { "谶", "讖" },
-    { "谷人", "穀人" },
-    { "谷仓", "穀倉" },
-    { "谷保家商", "穀保家商" },
-    { "谷圭", "穀圭" },
-    { "谷场", "穀場" },
-    { "谷壳", "穀殼" },
-    { "谷子", "穀子" },
-    { "谷日", "穀日" },
-    { "谷旦", "穀旦" },
-    { "谷梁", "穀梁" },
-    { "谷物", "穀物" },
-    { "谷皮", "穀皮" },
-    { "谷神", "穀神" },
-    { "谷米", "穀米" },
-    { "谷类", "穀類" },
-    { "谷粒", "穀粒" },
-    { "谷舱", "穀艙" },
-    { "谷苗", "穀苗" },
-    { "谷草", "穀草" },
-    { "谷谷", "穀穀" },
-    { "谷贱伤农", "穀賤傷農" },
-    { "谷贵饿农", "穀貴餓農" },
-    { "谷道", "穀道" },
-    { "谷雨", "穀雨" },
-    { "谷食", "穀食" },
-    { "豆干", "豆乾" },
-    { "象征", "象徵" },
-    { "象征着", "象徵著" },
-    { "買凶", "買兇" },
-    { "賈后", "賈后" },
-    { "賢后", "賢后" },
-    { "賸余", "賸餘" },
-    { "贝", "貝" },
-    { "贞", "貞" },
-    { "负", "負" },
-    { "负债累累", "負債纍纍" },
-    { "贡", "貢" },
-    { "财", "財" },
-    { "责", "責" },
-    { "贤", "賢" },
-    { "贤后", "賢后" },
-    { "败", "敗" },
-    { "账", "賬" },
-    { "货", "貨" },
-    { "质", "質" },
-    { "质朴", "質樸" },
-    { "贩", "販" },
-    { "贪", "貪" },
-    { "贪欲", "貪慾" },
-    { "贫", "貧" },
-    { "贬", "貶" },
-    { "购", "購" },
-    { "购买欲", "購買慾" },
-    { "购并", "購併" },
-    { "贮", "貯" },
-    { "贯", "貫" },
-    { "贰", "貳" },
-    { "贱", "賤" },
-    { "贲", "賁" },
-    { "贳", "貰" },
-    { "贴", "貼" },
-    { "贵", "貴" },
-    { "贵价", "貴价" },
-    { "贵干", "貴幹" },
-    { "贵征", "貴徵" },
-    { "贶", "貺" },
-    { "贷", "貸" },
-    { "贸", "貿" },
-    { "费", "費" },
-    { "费占", "費佔" },
-    { "贺", "賀" },
-    { "贻", "貽" },
-    { "贻范", "貽範" },
-    { "贼", "賊" },
-    { "贽", "贄" },
-    { "贾", "賈" },
-    { "贾后", "賈后" },
-    { "贿", "賄" },
-    { "赀", "貲" },
-    { "赁", "賃" },
-    { "赂", "賂" },
-    { "赃", "贓" },
-    { "资", "資" },
-    { "赅", "賅" },
-    { "赆", "贐" },
-    { "赇", "賕" },
-    { "赈", "賑" },
-    { "赈饥", "賑饑" },
-    { "赉", "賚" },
-    { "赊", "賒" },
-    { "赋", "賦" },
-    { "赌", "賭" },
-    { "赌台", "賭檯" },
-    { "赌后", "賭后" },
-    { "赌斗", "賭鬥" },
-    { "赍", "齎" },
-    { "赎", "贖" },
-    { "赏", "賞" },
-    { "赏赞", "賞讚" },
-    { "赐", "賜" },
-    { "赓", "賡" },
-    { "赔", "賠" },
-    { "赕", "賧" },
-    { "赖", "賴" },
-    { "赘", "贅" },
-    { "赙", "賻" },
-    { "赚", "賺" },
-    { "赛", "賽" },
-    { "赜", "賾" },
-    { "赝", "贗" },
-    { "赞", "贊" },
-    { "赞不绝口", "讚不絕口" },
-    { "赞乐", "讚樂" },
-    { "赞佩", "讚佩" },
-    { "赞叹", "讚歎" },
-    { "赞叹不已", "讚嘆不已" },
-    { "赞呗", "讚唄" },
-    { "赞扬", "讚揚" },
-    { "赞歌", "讚歌" },
-    { "赞美", "讚美" },
-    { "赞羡", "讚羨" },
-    { "赞誉", "讚譽" },
-    { "赞许", "讚許" },
-    { "赞词", "讚詞" },
-    { "赞赏", "讚賞" },
-    { "赞辞", "讚辭" },
-    { "赞颂", "讚頌" },
-    { "赠", "贈" },
-    { "赡", "贍" },
-    { "赢", "贏" },
-    { "赢余", "贏餘" },
-    { "赣", "贛" },
-    { "赤术", "赤朮" },
-    { "赤绳系足", "赤繩繫足" },
-    { "赵", "趙" },
-    { "赵威后", "趙威后" },
-    { "赵庄", "趙莊" },
-    { "赵惠后", "趙惠后" },
-    { "赵治勋", "趙治勳" },
-    { "赶", "趕" },
-    { "赶制", "趕製" },
-    { "赶面棍", "趕麵棍" },
-    { "起哄", "起鬨" },
-    { "起复", "起複" },
-    { "超级杯", "超級盃" },
-    { "趋", "趨" },
-    { "趱", "趲" },
-    { "趱干", "趲幹" },
-    { "趸", "躉" },
-    { "跃", "躍" },
-    { "跄", "蹌" },
-    { "跌扑", "跌扑" },
-    { "跌荡", "跌蕩" },
-    { "跞", "躒" },
-    { "路签", "路籤" },
-    { "跳梁小丑", "跳樑小丑" },
-    { "跳荡", "跳蕩" },
-    { "跳表", "跳錶" },
-    { "践", "踐" },
-    { "跷", "蹺" },
-    { "跸", "蹕" },
-    { "跹", "躚" },
-    { "跻", "躋" },
-    { "踊", "踴" },
-    { "踌", "躊" },
-    { "踪", "蹤" },
-    { "踬", "躓" },
-    { "踯", "躑" },
-    { "蹑", "躡" },
-    { "蹒", "蹣" },
-    { "蹰", "躕" },
-    { "蹿", "躥" },
-    { "躁郁", "躁鬱" },
-    { "躏", "躪" },
-    { "躜", "躦" },
-    { "躯", "軀" },
-    { "躯干", "軀幹" },
-    { "车", "車" },
-    { "车库里", "車庫裡" },
-    { "车站里", "車站裡" },
-    { "车里", "車裡" },
-    { "轧", "軋" },
-    { "轨", "軌" },
-    { "轨范", "軌範" },
-    { "轩", "軒" },
-    { "轩辟", "軒闢" },
-    { "轫", "軔" },
-    { "转", "轉" },
-    { "转台", "轉檯" },
-    { "转托", "轉託" },
-    { "转斗千里", "轉鬥千里" },
-    { "轭", "軛" },
-    { "轮", "輪" },
-    { "轮回", "輪迴" },
-    { "轮奸", "輪姦" },
-    { "软", "軟" },
-    { "轰", "轟" },
-    { "轲", "軻" },
-    { "轳", "轤" },
-    { "轴", "軸" },
-    { "轵", "軹" },
-    { "轶", "軼" },
-    { "轸", "軫" },
-    { "轹", "轢" },
-    { "轺", "軺" },
-    { "轻", "輕" },
-    { "轻松", "輕鬆" },
-    { "轻轻松松", "輕輕鬆鬆" },
-    { "轼", "軾" },
-    { "载", "載" },
-    { "轾", "輊" },
-    { "轿", "轎" },
-    { "辁", "輇" },
-    { "辂", "輅" },
-    { "较", "較" },
-    { "辄", "輒" },
-    { "辅", "輔" },
-    { "辆", "輛" },
-    { "辇", "輦" },
-    { "辈", "輩" },
-    { "辉", "輝" },
-    { "辊", "輥" },
-    { "辋", "輞" },
-    { "辍", "輟" },
-    { "辎", "輜" },
-    { "辏", "輳" },
-    { "辐", "輻" },
-    { "辑", "輯" },
-    { "输", "輸" },
-    { "辔", "轡" },
-    { "辕", "轅" },
-    { "辖", "轄" },
-    { "辗", "輾" },
-    { "辘", "轆" },
-    { "辙", "轍" },
-    { "辚", "轔" },
-    { "辞", "辭" },
-    { "辞汇", "辭彙" },
-    { "辟为", "闢為" },
-    { "辟佛", "闢佛" },
-    { "辟作", "闢作" },
-    { "辟划", "闢劃" },
-    { "辟土", "闢土" },
-    { "辟地", "闢地" },
-    { "辟室", "闢室" },
-    { "辟建", "闢建" },
-    { "辟田", "闢田" },
-    { "辟筑", "闢築" },
-    { "辟谣", "闢謠" },
-    { "辟谷", "辟穀" },
-    { "辟辟", "闢辟" },
-    { "辟邪以律", "闢邪以律" },
-    { "辩", "辯" },
-    { "辩斗", "辯鬥" },
-    { "辫", "辮" },
-    { "辫发", "辮髮" },
-    { "边", "邊" },
-    { "辽", "遼" },
-    { "辽沈", "遼瀋" },
-    { "达", "達" },
-    { "迁", "遷" },
-    { "迂回", "迂迴" },
-    { "过", "過" },
-    { "过杆", "過杆" },
-    { "过水面", "過水麵" },
-    { "迈", "邁" },
-    { "运", "運" },
-    { "近日無仇", "近日無讎" },
-    { "近日里", "近日裡" },
-    { "返朴", "返樸" },
-    { "还", "還" },
-    { "还冲", "還衝" },
-    { "还占", "還佔" },
-    { "还采", "還採" },
-    { "这", "這" },
-    { "这么", "這麼" },
-    { "这么着", "這麼著" },
-    { "这伙人", "這夥人" },
-    { "这只", "這隻" },
-    { "这只采", "這只採" },
-    { "这里", "這裡" },
-    { "这钟", "這鐘" },
-    { "进", "進" },
-    { "进占", "進佔" },
-    { "远", "遠" },
-    { "远县才至", "遠縣纔至" },
-    { "远游", "遠遊" },
-    { "违", "違" },
-    { "连", "連" },
-    { "连三并四", "連三併四" },
-    { "连占", "連佔" },
-    { "连庄", "連莊" },
-    { "连系", "連繫" },
-    { "连采", "連採" },
-    { "迟", "遲" },
-    { "迥然回异", "迥然迴異" },
-    { "迩", "邇" },
-    { "迳", "逕" },
-    { "迷幻药", "迷幻藥" },
-    { "迷药", "迷藥" },
-    { "迷蒙", "迷濛" },
-    { "迷魂药", "迷魂藥" },
-    { "迹", "跡" },
-    { "追凶", "追兇" },
-    { "退伙", "退夥" },
-    { "退烧药", "退燒藥" },
-    { "适", "適" },
-    { "逆钟", "逆鐘" },
-    { "选", "選" },
-    { "逊", "遜" },
-    { "逋发", "逋髮" },
-    { "逍遥游", "逍遙遊" },
-    { "透辟", "透闢" },
-    { "递", "遞" },
-    { "递回", "遞迴" },
-    { "通历", "通曆" },
-    { "通奸", "通姦" },
-    { "通庄", "通莊" },
-    { "通心面", "通心麵" },
-    { "逞凶斗狠", "逞兇鬥狠" },
-    { "逞凶鬥狠", "逞兇鬥狠" },
-    { "造钟", "造鐘" },
-    { "造钟表", "造鐘錶" },
-    { "逦", "邐" },
-    { "逻", "邏" },
-    { "逼并", "逼併" },
-    { "道范", "道範" },
-    { "遗", "遺" },
-    { "遗传钟", "遺傳鐘" },
-    { "遗范", "遺範" },
-    { "遗迹", "遺迹" },
-    { "遥", "遙" },
-    { "遨游", "遨遊" },
-    { "遮丑", "遮醜" },
-    { "避孕药", "避孕藥" },
-    { "邀天之幸", "邀天之倖" },
-    { "邋里邋遢", "邋裡邋遢" },
-    { "邓", "鄧" },
-    { "邝", "鄺" },
-    { "那么", "那麼" },
-    { "那么着", "那麼著" },
-    { "那卷", "那捲" },
-    { "那只", "那隻" },
-    { "那里", "那裡" },
-    { "邬", "鄔" },
-    { "邮", "郵" },
-    { "邱于庭", "邱于庭" },
-    { "邹", "鄒" },
-    { "邺", "鄴" },
-    { "邻", "鄰" },
-    { "郁伊", "鬱伊" },
-    { "郁勃", "鬱勃" },
-    { "郁卒", "鬱卒" },
-    { "郁南", "鬱南" },
-    { "郁垒", "鬱壘" },
-    { "郁堙不偶", "鬱堙不偶" },
-    { "郁塞", "鬱塞" },
-    { "郁律", "鬱律" },
-    { "郁悒", "鬱悒" },
-    { "郁愤", "鬱憤" },
-    { "郁抑", "鬱抑" },
-    { "郁挹", "鬱挹" },
-    { "郁朴", "郁樸" },
-    { "郁林", "鬱林" },
-    { "郁气", "鬱氣" },
-    { "郁江", "鬱江" },
-    { "郁沉沉", "鬱沉沉" },
-    { "郁泱", "鬱泱" },
-    { "郁火", "鬱火" },
-    { "郁热", "鬱熱" },
-    { "郁燠", "鬱燠" },
-    { "郁症", "鬱症" },
-    { "郁积", "鬱積" },
-    { "郁纡", "鬱紆" },
-    { "郁结", "鬱結" },
-    { "郁蒸", "鬱蒸" },
-    { "郁蓊", "鬱蓊" },
-    { "郁血", "鬱血" },
-    { "郁邑", "鬱邑" },
-    { "郁郁", "鬱郁" },
-    { "郁郁不乐", "鬱鬱不樂" },
-    { "郁郁不平", "鬱鬱不平" },
-    { "郁郁寡欢", "鬱鬱寡歡" },
-    { "郁郁而终", "鬱鬱而終" },
-    { "郁郁葱葱", "鬱鬱蔥蔥" },
-    { "郁金", "鬱金" },
-    { "郁闭", "鬱閉" },
-    { "郁闷", "鬱悶" },
-    { "郁陶", "鬱陶" },
-    { "郁黑", "鬱黑" },
-    { "郊游", "郊遊" },
-    { "郏", "郟" },
-    { "郐", "鄶" },
-    { "郑", "鄭" },
-    { "郑凯云", "鄭凱云" },
-    { "郑庄公", "鄭莊公" },
-    { "郓", "鄆" },
-    { "郘钟", "郘鐘" },
-    { "郦", "酈" },
-    { "郧", "鄖" },
-    { "郭后", "郭后" },
-    { "郸", "鄲" },
-    { "鄉愿", "鄉愿" },
-    { "鄭凱云", "鄭凱云" },
-    { "配制", "配製" },
-    { "配水干管", "配水幹管" },
-    { "配药", "配藥" },
-    { "酒坛", "酒罈" },
-    { "酒帘", "酒帘" },
-    { "酒曲", "酒麴" },
-    { "酒肴", "酒肴" },
-    { "酒药", "酒藥" },
-    { "酝", "醞" },
-    { "酝酿着", "醞釀著" },
-    { "酥松", "酥鬆" },
-    { "酱", "醬" },
-    { "酽", "釅" },
-    { "酾", "釃" },
-    { "酿", "釀" },
-    { "酿制", "釀製" },
-    { "醇朴", "醇樸" },
-    { "醋坛", "醋罈" },
-    { "采下", "採下" },
-    { "采为", "採為" },
-    { "采买", "採買" },
-    { "采伐", "採伐" },
-    { "采住", "採住" },
-    { "采信", "採信" },
-    { "采光", "採光" },
-    { "采到", "採到" },
-    { "采制", "採制" },
-    { "采办", "採辦" },
-    { "采区", "採區" },
-    { "采去", "採去" },
-    { "采取", "採取" },
-    { "采回", "採回" },
-    { "采在", "採在" },
-    { "采好", "採好" },
-    { "采录", "採錄" },
-    { "采得", "採得" },
-    { "采择", "採擇" },
-    { "采拾", "採拾" },
-    { "采挖", "採挖" },
-    { "采掘", "採掘" },
-    { "采摘", "採摘" },
-    { "采摭", "採摭" },
-    { "采撷", "採擷" },
-    { "采收", "採收" },
-    { "采料", "採料" },
-    { "采暖", "採暖" },
-    { "采树种", "採樹種" },
-    { "采样", "採樣" },
-    { "采桑", "採桑" },
-    { "采樵人", "採樵人" },
-    { "采气", "採氣" },
-    { "采油", "採油" },
-    { "采煤", "採煤" },
-    { "采猎", "採獵" },
-    { "采珠", "採珠" },
-    { "采生折割", "採生折割" },
-    { "采用", "採用" },
-    { "采的", "採的" },
-    { "采盐", "採鹽" },
-    { "采石", "採石" },
-    { "采矿", "採礦" },
-    { "采砂场", "採砂場" },
-    { "采种", "採種" },
-    { "采空区", "採空區" },
-    { "采空采穗", "採空採穗" },
-    { "采納", "採納" },
-    { "采纳", "採納" },
-    { "采给", "採給" },
-    { "采花", "採花" },
-    { "采芹人", "採芹人" },
-    { "采茶", "採茶" },
-    { "采药", "採藥" },
-    { "采莲", "採蓮" },
-    { "采获", "採獲" },
-    { "采菊", "採菊" },
-    { "采薇", "採薇" },
-    { "采薪", "採薪" },
-    { "采行", "採行" },
-    { "采补", "採補" },
-    { "采访", "採訪" },
-    { "采证", "採證" },
-    { "采购", "採購" },
-    { "采过", "採過" },
-    { "采运", "採運" },
-    { "采选", "採選" },
-    { "采金", "採金" },
-    { "采铁", "採鐵" },
-    { "采集", "採集" },
-    { "采风", "採風" },
-    { "采食", "採食" },
-    { "釉药", "釉藥" },
-    { "释", "釋" },
-    { "里勾外连", "裡勾外連" },
-    { "里头", "裡頭" },
-    { "里层", "裡層" },
-    { "里屋", "裡屋" },
-    { "里布", "裡布" },
-    { "里带", "裡帶" },
-    { "里应外合", "裡應外合" },
-    { "里弦", "裡弦" },
-    { "里手", "裏手" },
-    { "里海", "裏海" },
-    { "里程表", "里程錶" },
-    { "里脊", "裡脊" },
-    { "里衣", "裡衣" },
-    { "里边", "裡邊" },
-    { "里通外国", "裡通外國" },
-    { "里通外敌", "裡通外敵" },
-    { "里间", "裡間" },
-    { "里面", "裡面" },
-    { "重制", "重製" },
-    { "重复", "重複" },
-    { "重托", "重託" },
-    { "重折", "重摺" },
-    { "重游", "重遊" },
-    { "重罗面", "重羅麵" },
-    { "重锤", "重鎚" },
-    { "野姜", "野薑" },
-    { "野游", "野遊" },
-    { "金仑溪", "金崙溪" },
-    { "金发", "金髮" },
-    { "金色长发", "金色長髮" },
-    { "金范", "金範" },
-    { "金表", "金錶" },
-    { "金装玉里", "金裝玉裡" },
-    { "金钟", "金鐘" },
-    { "金马仑道", "金馬崙道" },
-    { "鉴", "鑒" },
-    { "銮", "鑾" },
-    { "錾", "鏨" },
-    { "鎭", "鎮" },
-    { "钆", "釓" },
-    { "钇", "釔" },
-    { "针", "針" },
-    { "钉", "釘" },
-    { "钉锤", "釘鎚" },
-    { "钊", "釗" },
-    { "钋", "釙" },
-    { "钌", "釕" },
-    { "钍", "釷" },
-    { "钏", "釧" },
-    { "钐", "釤" },
-    { "钒", "釩" },
-    { "钓", "釣" },
-    { "钔", "鍆" },
-    { "钕", "釹" },
-    { "钗", "釵" },
-    { "钙", "鈣" },
-    { "钛", "鈦" },
-    { "钜", "鉅" },
-    { "钝", "鈍" },
-    { "钞", "鈔" },
-    { "钟", "鍾" },
-    { "钟上", "鐘上" },
-    { "钟下", "鐘下" },
-    { "钟不", "鐘不" },
-    { "钟乳洞", "鐘乳洞" },
-    { "钟乳石", "鐘乳石" },
-    { "钟体", "鐘體" },
-    { "钟停", "鐘停" },
-    { "钟关", "鐘關" },
-    { "钟匠", "鐘匠" },
-    { "钟发音", "鐘發音" },
-    { "钟口", "鐘口" },
-    { "钟响", "鐘響" },
-    { "钟在寺里", "鐘在寺裡" },
-    { "钟塔", "鐘塔" },
-    { "钟壁", "鐘壁" },
-    { "钟声", "鐘聲" },
-    { "钟太", "鐘太" },
-    { "钟头", "鐘頭" },
-    { "钟好", "鐘好" },
-    { "钟山", "鐘山" },
-    { "钟左右", "鐘左右" },
-    { "钟差", "鐘差" },
-    { "钟座", "鐘座" },
-    { "钟形", "鐘形" },
-    { "钟律", "鐘律" },
-    { "钟快", "鐘快" },
-    { "钟意", "鐘意" },
-    { "钟慢", "鐘慢" },
-    { "钟摆", "鐘擺" },
-    { "钟敲", "鐘敲" },
-    { "钟有", "鐘有" },
-    { "钟楼", "鐘樓" },
-    { "钟模", "鐘模" },
-    { "钟没", "鐘沒" },
-    { "钟漏", "鐘漏" },
-    { "钟点", "鐘點" },
-    { "钟王", "鐘王" },
-    { "钟琴", "鐘琴" },
-    { "钟的", "鐘的" },
-    { "钟盘", "鐘盤" },
-    { "钟相", "鐘相" },
-    { "钟磬", "鐘磬" },
-    { "钟纽", "鐘紐" },
-    { "钟罩", "鐘罩" },
-    { "钟腰", "鐘腰" },
-    { "钟螺", "鐘螺" },
-    { "钟行", "鐘行" },
-    { "钟表", "鐘錶" },
-    { "钟表面", "鐘表面" },
-    { "钟被", "鐘被" },
-    { "钟调", "鐘調" },
-    { "钟身", "鐘身" },
-    { "钟速", "鐘速" },
-    { "钟陈列", "鐘陳列" },
-    { "钟面", "鐘面" },
-    { "钟顶", "鐘頂" },
-    { "钟鸣", "鐘鳴" },
-    { "钟鼎", "鐘鼎" },
-    { "钟鼓", "鐘鼓" },
-    { "钠", "鈉" },
-    { "钡", "鋇" },
-    { "钢", "鋼" },
-    { "钢制", "鋼製" },
-    { "钢梁", "鋼樑" },
-    { "钣", "鈑" },
-    { "钤", "鈐" },
-    { "钥", "鑰" },
-    { "钦", "欽" },
-    { "钧", "鈞" },
-    { "钨", "鎢" },
-    { "钩", "鉤" },
-    { "钩心斗角", "鈎心鬥角" },
-    { "钪", "鈧" },
-    { "钫", "鈁" },
-    { "钬", "鈥" },
-    { "钭", "鈄" },
-    { "钮", "鈕" },
-    { "钯", "鈀" },
-    { "钰", "鈺" },
-    { "钱", "錢" },
-    { "钱庄", "錢莊" },
-    { "钱范", "錢範" },
-    { "钱谷", "錢穀" },
-    { "钲", "鉦" },
-    { "钳", "鉗" },
-    { "钴", "鈷" },
-    { "钵", "缽" },
-    { "钶", "鈳" },
-    { "钸", "鈽" },
-    { "钹", "鈸" },
-    { "钺", "鉞" },
-    { "钻", "鑽" },
-    { "钼", "鉬" },
-    { "钽", "鉭" },
-    { "钾", "鉀" },
-    { "钿", "鈿" },
-    { "铀", "鈾" },
-    { "铁", "鐵" },
-    { "铁杆", "鐵杆" },
-    { "铁钟", "鐵鐘" },
-    { "铁锈", "鐵鏽" },
-    { "铁锤", "鐵鎚" },
-    { "铂", "鉑" },
-    { "铃", "鈴" },
-    { "铄", "鑠" },
-    { "铅", "鉛" },
-    { "铆", "鉚" },
-    { "铈", "鈰" },
-    { "铉", "鉉" },
-    { "铊", "鉈" },
-    { "铋", "鉍" },
-    { "铌", "鈮" },
-    { "铍", "鈹" },
-    { "铎", "鐸" },
-    { "铐", "銬" },
-    { "铑", "銠" },
-    { "铒", "鉺" },
-    { "铕", "銪" },
-    { "铖", "鋮" },
-    { "铗", "鋏" },
-    { "铙", "鐃" },
-    { "铛", "鐺" },
-    { "铜", "銅" },
-    { "铜制", "銅製" },
-    { "铜范", "銅範" },
-    { "铜钟", "銅鐘" },
-    { "铝", "鋁" },
-    { "铝制", "鋁製" },
-    { "铟", "銦" },
-    { "铠", "鎧" },
-    { "铡", "鍘" },
-    { "铢", "銖" },
-    { "铣", "銑" },
-    { "铤", "鋌" },
-    { "铥", "銩" },
-    { "铧", "鏵" },
-    { "铨", "銓" },
-    { "铩", "鎩" },
-    { "铪", "鉿" },
-    { "铫", "銚" },
-    { "铬", "鉻" },
-    { "铭", "銘" },
-    { "铮", "錚" },
-    { "铯", "銫" },
-    { "铯钟", "銫鐘" },
-    { "铰", "鉸" },
-    { "铱", "銥" },
-    { "铲", "鏟" },
-    { "铲出", "剷出" },
-    { "铲刈", "剷刈" },
-    { "铲头", "剷頭" },
-    { "铲平", "剷平" },
-    { "铲除", "剷除" },
-    { "铳", "銃" },
-    { "铴", "鐋" },
-    { "铵", "銨" },
-    { "银", "銀" },
-    { "银发", "銀髮" },
-    { "银朱", "銀硃" },
-    { "铷", "銣" },
-    { "铸", "鑄" },
-    { "铸钟", "鑄鐘" },
-    { "铹", "鐒" },
-    { "铺", "鋪" },
-    { "铺锦列绣", "鋪錦列繡" },
-    { "铼", "錸" },
-    { "铽", "鋱" },
-    { "链", "鏈" },
-    { "铿", "鏗" },
-    { "销", "銷" },
-    { "锁", "鎖" },
-    { "锂", "鋰" },
-    { "锄", "鋤" },
-    { "锅", "鍋" },
-    { "锅庄", "鍋莊" },
-    { "锆", "鋯" },
-    { "锇", "鋨" },
-    { "锈", "銹" },
-    { "锈病", "鏽病" },
-    { "锈菌", "鏽菌" },
-    { "锈蚀", "鏽蝕" },
-    { "锉", "銼" },
-    { "锊", "鋝" },
-    { "锋", "鋒" },
-    { "锌", "鋅" },
-    { "锐", "銳" },
-    { "锑", "銻" },
-    { "锒", "鋃" },
-    { "锓", "鋟" },
-    { "锔", "鋦" },
-    { "锕", "錒" },
-    { "锖", "錆" },
-    { "锗", "鍺" },
-    { "错", "錯" },
-    { "锚", "錨" },
-    { "锛", "錛" },
-    { "锞", "錁" },
-    { "锟", "錕" },
-    { "锡", "錫" },
-    { "锢", "錮" },
-    { "锣", "鑼" },
-    { "锤", "錘" },
-    { "锤儿", "鎚兒" },
-    { "锤头", "鎚頭" },
-    { "锤子", "鎚子" },
-    { "锤炼", "錘鍊" },
-    { "锥", "錐" },
-    { "锦", "錦" },
-    { "锦绣", "錦繡" },
-    { "锨", "杴" },
-    { "锩", "錈" },
-    { "锬", "錟" },
-    { "锭", "錠" },
-    { "键", "鍵" },
-    { "锯", "鋸" },
-    { "锰", "錳" },
-    { "锱", "錙" },
-    { "锲", "鍥" },
-    { "锲而不舍", "鍥而不捨" },
-    { "锴", "鍇" },
-    { "锵", "鏘" },
-    { "锶", "鍶" },
-    { "锷", "鍔" },
-    { "锸", "鍤" },
-    { "锹", "鍬" },
-    { "锺", "鍾" },
-    { "锻", "鍛" },
-    { "锻炼出", "鍛鍊出" },
-    { "锼", "鎪" },
-    { "锾", "鍰" },
-    { "镀", "鍍" },
-    { "镁", "鎂" },
-    { "镂", "鏤" },
-    { "镄", "鐨" },
-    { "镆", "鏌" },
-    { "镇", "鎮" },
-    { "镉", "鎘" },
-    { "镊", "鑷" },
-    { "镌", "鐫" },
-    { "镍", "鎳" },
-    { "镏", "鎦" },
-    { "镐", "鎬" },
-    { "镑", "鎊" },
-    { "镒", "鎰" },
-    { "镓", "鎵" },
-    { "镔", "鑌" },
-    { "镖", "鏢" },
-    { "镗", "鏜" },
-    { "镘", "鏝" },
-    { "镙", "鏍" },
-    { "镛", "鏞" },
-    { "镜", "鏡" },
-    { "镝", "鏑" },
-    { "镞", "鏃" },
-    { "镟", "鏇" },
-    { "镡", "鐔" },
-    { "镢", "钁" },
-    { "镣", "鐐" },
-    { "镤", "鏷" },
-    { "镦", "鐓" },
-    { "镧", "鑭" },
-    { "镨", "鐠" },
-    { "镪", "鏹" },
-    { "镫", "鐙" },
-    { "镬", "鑊" },
-    { "镭", "鐳" },
-    { "镯", "鐲" },
-    { "镰", "鐮" },
-    { "镰仓", "鎌倉" },
-    { "镱", "鐿" },
-    { "镳", "鑣" },
-    { "镶", "鑲" },
-    { "长", "長" },
-    { "长几", "長几" },
-    { "长历", "長曆" },
-    { "长生药", "長生藥" },
-    { "长胡", "長鬍" },
-    { "门", "門" },
-    { "门吊儿", "門弔兒" },
-    { "门帘", "門帘" },
-    { "门里", "門裡" },
-    { "闩", "閂" },
-    { "闪", "閃" },
-    { "闫", "閆" },
-    { "闭", "閉" },
-    { "问", "問" },
-    { "闯", "闖" },
-    { "闯炼", "闖鍊" },
-    { "闯荡", "闖蕩" },
-    { "闰", "閏" },
-    { "闱", "闈" },
-    { "闲", "閑" },
-    { "闲情逸致", "閒情逸緻" },
-    { "闲游", "閒遊" },
-    { "闲荡", "閒蕩" },
-    { "闳", "閎" },
-    { "间", "間" },
-    { "间不容发", "間不容髮" },
-    { "闵", "閔" },
-    { "闵采尔", "閔採爾" },
-    { "闶", "閌" },
-    { "闷", "悶" },
-    { "闷着头儿干", "悶著頭兒幹" },
-    { "闸", "閘" },
-    { "闹", "鬧" },
-    { "闹着玩儿", "鬧著玩兒" },
-    { "闹表", "鬧錶" },
-    { "闹钟", "鬧鐘" },
-    { "闺", "閨" },
-    { "闺范", "閨範" },
-    { "闻", "聞" },
-    { "闼", "闥" },
-    { "闽", "閩" },
-    { "闾", "閭" },
-    { "阀", "閥" },
-    { "阁", "閣" },
-    { "阂", "閡" },
-    { "阃", "閫" },
-    { "阃范", "閫範" },
-    { "阄", "鬮" },
-    { "阅", "閱" },
-    { "阆", "閬" },
-    { "阈", "閾" },
-    { "阉", "閹" },
-    { "阊", "閶" },
-    { "阋", "鬩" },
-    { "阌", "閿" },
-    { "阍", "閽" },
-    { "阎", "閻" },
-    { "阏", "閼" },
-    { "阐", "闡" },
-    { "阑", "闌" },
-    { "阒", "闃" },
-    { "阔", "闊" },
-    { "阕", "闋" },
-    { "阖", "闔" },
-    { "阗", "闐" },
-    { "阙", "闕" },
-    { "阚", "闞" },
-    { "队", "隊" },
-    { "防台", "防颱" },
-    { "防御", "防禦" },
-    { "防晒", "防晒" },
-    { "防水表", "防水錶" },
-    { "防范", "防範" },
-    { "防锈", "防鏽" },
-    { "阳", "陽" },
-    { "阳历", "陽曆" },
-    { "阳春面", "陽春麵" },
-    { "阴", "陰" },
-    { "阴历", "陰曆" },
-    { "阴干", "陰乾" },
-    { "阴沟里翻船", "陰溝裡翻船" },
-    { "阴郁", "陰鬱" },
-    { "阵", "陣" },
-    { "阶", "階" },
-    { "阿呆", "阿獃" },
-    { "附注", "附註" },
-    { "际", "際" },
-    { "陆", "陸" },
-    { "陆游", "陸遊" },
-    { "陇", "隴" },
-    { "陈", "陳" },
-    { "陈冲", "陳冲" },
-    { "陈有后", "陳有后" },
-    { "陈炼", "陳鍊" },
-    { "陉", "陘" },
-    { "降压药", "降壓藥" },
-    { "陕", "陝" },
-    { "除臭药", "除臭藥" },
-    { "陧", "隉" },
-    { "陨", "隕" },
-    { "险", "險" },
-    { "陪吊", "陪弔" },
-    { "陳冲", "陳冲" },
-    { "隆准", "隆準" },
-    { "随", "隨" },
-    { "隐", "隱" },
-    { "隐几", "隱几" },
-    { "隐占", "隱佔" },
-    { "隶", "隸" },
-    { "隽", "雋" },
-    { "难", "難" },
-    { "难舍", "難捨" },
-    { "雅致", "雅緻" },
-    { "雅范", "雅範" },
-    { "集游法", "集遊法" },
-    { "雇主", "僱主" },
-    { "雇人", "僱人" },
-    { "雇佣", "僱傭" },
-    { "雇农", "僱農" },
-    { "雇到", "僱到" },
-    { "雇员", "僱員" },
-    { "雇工", "僱工" },
-    { "雇用", "僱用" },
-    { "雏", "雛" },
-    { "雕心雁爪", "鵰心雁爪" },
-    { "雕悍", "鵰悍" },
-    { "雕梁画栋", "雕樑畫棟" },
-    { "雕翎", "鵰翎" },
-    { "雕鹗", "鵰鶚" },
-    { "雠", "讎" },
-    { "雪窗萤几", "雪窗螢几" },
-    { "雪里", "雪裡" },
-    { "雳", "靂" },
-    { "零余", "零餘" },
-    { "零只", "零隻" },
-    { "雾", "霧" },
-    { "雾里", "霧裡" },
-    { "霁", "霽" },
-    { "霁范", "霽範" },
-    { "震栗", "震慄" },
-    { "震荡", "震蕩" },
-    { "霉毒", "黴毒" },
-    { "霉素", "黴素" },
-    { "霉菌", "黴菌" },
-    { "霉黑", "黴黑" },
-    { "霉黧", "黴黧" },
-    { "霭", "靄" },
-    { "露丑", "露醜" },
-    { "霸占", "霸佔" },
-    { "青山一发", "青山一髮" },
-    { "青苹", "青苹" },
-    { "青霉", "青黴" },
-    { "靓", "靚" },
-    { "静", "靜" },
-    { "非占不可", "非佔不可" },
-    { "面临着", "面臨著" },
-    { "面人儿", "麵人兒" },
-    { "面价", "麵價" },
-    { "面包", "麵包" },
-    { "面包扎", "面包紮" },
-    { "面包着", "面包著" },
-    { "面厂", "麵廠" },
-    { "面团", "麵糰" },
-    { "面坊", "麵坊" },
-    { "面坯儿", "麵坯兒" },
-    { "面塑", "麵塑" },
-    { "面店", "麵店" },
-    { "面摊", "麵攤" },
-    { "面朝着", "面朝著" },
-    { "面杖", "麵杖" },
-    { "面条", "麵條" },
-    { "面汤", "麵湯" },
-    { "面浆", "麵漿" },
-    { "面灰", "麵灰" },
-    { "面疙瘩", "麵疙瘩" },
-    { "面皮", "麵皮" },
-    { "面码儿", "麵碼兒" },
-    { "面筋", "麵筋" },
-    { "面粉", "麵粉" },
-    { "面糊", "麵糊" },
-    { "面线", "麵線" },
-    { "面缸", "麵缸" },
-    { "面茶", "麵茶" },
-    { "面食", "麵食" },
-    { "面食面", "面食麵" },
-    { "面饺", "麵餃" },
-    { "面饼", "麵餅" },
-    { "面馆", "麵館" },
-    { "靥", "靨" },
-    { "鞋里", "鞋裡" },
-    { "鞑", "韃" },
-    { "鞣制", "鞣製" },
-    { "鞭辟入里", "鞭辟入裡" },
-    { "鞯", "韉" },
-    { "鞲", "韝" },
-    { "韦", "韋" },
-    { "韦庄", "韋莊" },
-    { "韧", "韌" },
-    { "韩", "韓" },
-    { "韩制", "韓製" },
-    { "韩国制", "韓國製" },
-    { "韪", "韙" },
-    { "韫", "韞" },
-    { "韬", "韜" },
-    { "音准", "音準" },
-    { "音声如钟", "音聲如鐘" },
-    { "韵", "韻" },
-    { "页", "頁" },
-    { "顶", "頂" },
-    { "顷", "頃" },
-    { "顸", "頇" },
-    { "项", "項" },
-    { "项庄", "項莊" },
-    { "顺", "順" },
-    { "顺钟向", "順鐘向" },
-    { "须", "須" },
-    { "须发", "鬚髮" },
-    { "须根", "鬚根" },
-    { "须毛", "鬚毛" },
-    { "须生", "鬚生" },
-    { "须眉", "鬚眉" },
-    { "须胡", "鬚鬍" },
-    { "须须", "鬚鬚" },
-    { "须鲨", "鬚鯊" },
-    { "须鲸", "鬚鯨" },
-    { "顼", "頊" },
-    { "顽", "頑" },
-    { "顾", "顧" },
-    { "顿", "頓" },
-    { "颀", "頎" },
-    { "颁", "頒" },
-    { "颂", "頌" },
-    { "颂系", "頌繫" },
-    { "颂赞", "頌讚" },
-    { "颃", "頏" },
-    { "预", "預" },
-    { "预制", "預製" },
-    { "颅", "顱" },
-    { "领", "領" },
-    { "领域里", "領域裡" },
-    { "领袖欲", "領袖慾" },
-    { "颇", "頗" },
-    { "颈", "頸" },
-    { "颉", "頡" },
-    { "颊", "頰" },
-    { "颊须", "頰鬚" },
-    { "颌", "頜" },
-    { "颍", "潁" },
-    { "颏", "頦" },
-    { "颐", "頤" },
-    { "频", "頻" },
-    { "颓", "頹" },
-    { "颔", "頷" },
-    { "颖", "穎" },
-    { "颗", "顆" },
-    { "题", "題" },
-    { "题签", "題籤" },
-    { "颚", "顎" },
-    { "颛", "顓" },
-    { "颜", "顏" },
-    { "颜范", "顏範" },
-    { "额", "額" },
-    { "额征", "額徵" },
-    { "额我略历", "額我略曆" },
-    { "颞", "顳" },
-    { "颟", "顢" },
-    { "颠", "顛" },
-    { "颠干倒坤", "顛乾倒坤" },
-    { "颡", "顙" },
-    { "颢", "顥" },
-    { "颤", "顫" },
-    { "颤栗", "顫慄" },
-    { "颦", "顰" },
-    { "颧", "顴" },
-    { "风", "風" },
-    { "风卷残云", "風捲殘雲" },
-    { "风后", "風后" },
-    { "风土志", "風土誌" },
-    { "风干", "風乾" },
-    { "风物志", "風物誌" },
-    { "风范", "風範" },
-    { "风起云涌", "風起雲湧" },
-    { "风里", "風裡" },
-    { "飑", "颮" },
-    { "飒", "颯" },
-    { "飓", "颶" },
-    { "飕", "颼" },
-    { "飘", "飄" },
-    { "飘游", "飄遊" },
-    { "飘荡", "飄蕩" },
-    { "飘飘荡荡", "飄飄蕩蕩" },
-    { "飙", "飆" },
-    { "飞", "飛" },
-    { "飞刍挽粟", "飛芻輓粟" },
-    { "飞扎", "飛紮" },
-    { "飞行钟", "飛行鐘" },
-    { "食欲", "食慾" },
-    { "食野之苹", "食野之苹" },
-    { "食面", "食麵" },
-    { "飨", "饗" },
-    { "餍", "饜" },
-    { "饥", "飢" },
-    { "饥寒", "饑寒" },
-    { "饥民", "饑民" },
-    { "饥渴", "饑渴" },
-    { "饥溺", "饑溺" },
-    { "饥荒", "饑荒" },
-    { "饥饱", "饑飽" },
-    { "饥馑", "饑饉" },
-    { "饧", "餳" },
-    { "饨", "飩" },
-    { "饩", "餼" },
-    { "饪", "飪" },
-    { "饫", "飫" },
-    { "饬", "飭" },
-    { "饭", "飯" },
-    { "饭后钟", "飯後鐘" },
-    { "饭团", "飯糰" },
-    { "饭庄", "飯莊" },
-    { "饮", "飲" },
-    { "饯", "餞" },
-    { "饰", "飾" },
-    { "饱", "飽" },
-    { "饲", "飼" },
-    { "饲喂", "飼餵" },
-    { "饴", "飴" },
-    { "饵", "餌" },
-    { "饶", "饒" },
-    { "饷", "餉" },
-    { "饺", "餃" },
-    { "饼", "餅" },
-    { "饼干", "餅乾" },
-    { "饽", "餑" },
-    { "饿", "餓" },
-    { "馀", "餘" },
-    { "馁", "餒" },
-    { "馄", "餛" },
-    { "馄饨面", "餛飩麵" },
-    { "馅", "餡" },
-    { "馆", "館" },
-    { "馆谷", "館穀" },
-    { "馆里", "館裡" },
-    { "馈", "饋" },
-    { "馊", "餿" },
-    { "馋", "饞" },
-    { "馍", "饃" },
-    { "馏", "餾" },
-    { "馐", "饈" },
-    { "馑", "饉" },
-    { "馒", "饅" },
-    { "馔", "饌" },
-    { "首只", "首隻" },
-    { "首当其冲", "首當其衝" },
-    { "香干", "香乾" },
-    { "马", "馬" },
-    { "马干", "馬乾" },
-    { "马杆", "馬杆" },
-    { "马表", "馬錶" },
-    { "驭", "馭" },
-    { "驮", "馱" },
-    { "驯", "馴" },
-    { "驰", "馳" },
-    { "驱", "驅" },
-    { "驳", "駁" },
-    { "驴", "驢" },
-    { "驵", "駔" },
-    { "驶", "駛" },
-    { "驷", "駟" },
-    { "驸", "駙" },
-    { "驹", "駒" },
-    { "驺", "騶" },
-    { "驻", "駐" },
-    { "驻扎", "駐紮" },
-    { "驼", "駝" },
-    { "驽", "駑" },
-    { "驾", "駕" },
-    { "驿", "驛" },
-    { "骀", "駘" },
-    { "骀荡", "駘蕩" },
-    { "骁", "驍" },
-    { "骂", "罵" },
-    { "骂着", "罵著" },
-    { "骄", "驕" },
-    { "骅", "驊" },
-    { "骆", "駱" },
-    { "骇", "駭" },
-    { "骈", "駢" },
-    { "骊", "驪" },
-    { "骋", "騁" },
-    { "验", "驗" },
-    { "骏", "駿" },
-    { "骐", "騏" },
-    { "骑", "騎" },
-    { "骒", "騍" },
-    { "骓", "騅" },
-    { "骖", "驂" },
-    { "骗", "騙" },
-    { "骘", "騭" },
-    { "骚", "騷" },
-    { "骛", "騖" },
-    { "骜", "驁" },
-    { "骝", "騮" },
-    { "骞", "騫" },
-    { "骟", "騸" },
-    { "骠", "驃" },
-    { "骡", "騾" },
-    { "骢", "驄" },
-    { "骣", "驏" },
-    { "骤", "驟" },
-    { "骥", "驥" },
-    { "骧", "驤" },
-    { "骨坛", "骨罈" },
-    { "骨子里", "骨子裡" },
-    { "骨干", "骨幹" },
-    { "骨灰坛", "骨灰罈" },
-    { "髅", "髏" },
-    { "髋", "髖" },
-    { "髌", "髕" },
-    { "高几", "高几" },
-    { "高干", "高幹" },
-    { "高清愿", "高清愿" },
-    { "髡发", "髡髮" },
-    { "髭胡", "髭鬍" },
-    { "髭须", "髭鬚" },
-    { "髯胡", "髯鬍" },
-    { "髼松", "髼鬆" },
-    { "鬅松", "鬅鬆" },
-    { "鬈发", "鬈髮" },
-    { "鬒发", "鬒髮" },
-    { "鬓", "鬢" },
-    { "鬓发", "鬢髮" },
-    { "魂牵梦系", "魂牽夢繫" },
-    { "魇", "魘" },
-    { "魉", "魎" },
-    { "魏征", "魏徵" },
-    { "魔杰座", "魔杰座" },
-    { "魔表", "魔錶" },
-    { "鱼", "魚" },
-    { "鱼干", "魚乾" },
-    { "鱼松", "魚鬆" },
-    { "鱿", "魷" },
-    { "鲁", "魯" },
-    { "鲂", "魴" },
-    { "鲆", "鮃" },
-    { "鲇", "鯰" },
-    { "鲈", "鱸" },
-    { "鲋", "鮒" },
-    { "鲍", "鮑" },
-    { "鲎", "鱟" },
-    { "鲐", "鮐" },
-    { "鲑", "鮭" },
-    { "鲒", "鮚" },
-    { "鲔", "鮪" },
-    { "鲕", "鮞" },
-    { "鲚", "鱭" },
-    { "鲛", "鮫" },
-    { "鲜", "鮮" },
-    { "鲞", "鯗" },
-    { "鲟", "鱘" },
-    { "鲠", "鯁" },
-    { "鲡", "鱺" },
-    { "鲢", "鰱" },
-    { "鲣", "鰹" },
-    { "鲤", "鯉" },
-    { "鲥", "鰣" },
-    { "鲦", "鰷" },
-    { "鲧", "鯀" },
-    { "鲨", "鯊" },
-    { "鲩", "鯇" },
-    { "鲫", "鯽" },
-    { "鲭", "鯖" },
-    { "鲮", "鯪" },
-    { "鲰", "鯫" },
-    { "鲱", "鯡" },
-    { "鲲", "鯤" },
-    { "鲳", "鯧" },
-    { "鲵", "鯢" },
-    { "鲶", "鯰" },
-    { "鲷", "鯛" },
-    { "鲸", "鯨" },
-    { "鲸须", "鯨鬚" },
-    { "鲻", "鯔" },
-    { "鲽", "鰈" },
-    { "鳃", "鰓" },
-    { "鳄", "鱷" },
-    { "鳅", "鰍" },
-    { "鳆", "鰒" },
-    { "鳇", "鰉" },
-    { "鳌", "鰲" },
-    { "鳍", "鰭" },
-    { "鳎", "鰨" },
-    { "鳏", "鰥" },
-    { "鳐", "鰩" },
-    { "鳓", "鰳" },
-    { "鳔", "鰾" },
-    { "鳕", "鱈" },
-    { "鳖", "鱉" },
-    { "鳗", "鰻" },
-    { "鳜", "鱖" },
-    { "鳝", "鱔" },
-    { "鳞", "鱗" },
-    { "鳟", "鱒" },
-    { "鳢", "鱧" },
-    { "鸟", "鳥" },
-    { "鸠", "鳩" },
-    { "鸠占鹊巢", "鳩佔鵲巢" },
-    { "鸡", "雞" },
-    { "鸡丝面", "雞絲麵" },
-    { "鸡争鹅斗", "雞爭鵝鬥" },
-    { "鸡只", "雞隻" },
-    { "鸡吵鹅斗", "雞吵鵝鬥" },
-    { "鸡奸", "雞姦" },
-    { "鸡腿面", "雞腿麵" },
-    { "鸡蛋里挑骨头", "雞蛋裡挑骨頭" },
-    { "鸢", "鳶" },
-    { "鸣", "鳴" },
-    { "鸣钟", "鳴鐘" },
-    { "鸥", "鷗" },
-    { "鸦", "鴉" },
-    { "鸨", "鴇" },
-    { "鸩", "鴆" },
-    { "鸪", "鴣" },
-    { "鸫", "鶇" },
-    { "鸬", "鸕" },
-    { "鸭", "鴨" },
-    { "鸯", "鴦" },
-    { "鸱", "鴟" },
-    { "鸲", "鴝" },
-    { "鸳", "鴛" },
-    { "鸵", "鴕" },
-    { "鸶", "鷥" },
-    { "鸷", "鷙" },
-    { "鸸", "鴯" },
-    { "鸹", "鴰" },
-    { "鸺", "鵂" },
-    { "鸽", "鴿" },
-    { "鸾", "鸞" },
-    { "鸿", "鴻" },
-    { "鸿案相庄", "鴻案相莊" },
-    { "鸿篇巨制", "鴻篇巨製" },
-    { "鸿范", "鴻範" },
-    { "鹁", "鵓" },
-    { "鹂", "鸝" },
-    { "鹃", "鵑" },
-    { "鹄", "鵠" },
-    { "鹄发", "鵠髮" },
-    { "鹅", "鵝" },
-    { "鹅准", "鵝準" },
-    { "鹆", "鵒" },
-    { "鹇", "鷳" },
-    { "鹈", "鵜" },
-    { "鹉", "鵡" },
-    { "鹊", "鵲" },
-    { "鹌", "鵪" },
-    { "鹎", "鵯" },
-    { "鹏", "鵬" },
-    { "鹑", "鶉" },
-    { "鹕", "鶘" },
-    { "鹗", "鶚" },
-    { "鹘", "鶻" },
-    { "鹚", "鶿" },
-    { "鹜", "鶩" },
-    { "鹞", "鷂" },
-    { "鹣", "鶼" },
-    { "鹤", "鶴" },
-    { "鹤发", "鶴髮" },
-    { "鹤吊", "鶴弔" },
-    { "鹦", "鸚" },
-    { "鹧", "鷓" },
-    { "鹨", "鷚" },
-    { "鹩", "鷯" },
-    { "鹪", "鷦" },
-    { "鹫", "鷲" },
-    { "鹬", "鷸" },
-    { "鹭", "鷺" },
-    { "鹰", "鷹" },
-    { "鹰雕", "鹰鵰" },
-    { "鹳", "鸛" },
-    { "鹾", "鹺" },
-    { "麦", "麥" },
-    { "麸", "麩" },
-    { "麻药", "麻藥" },
-    { "麻酱面", "麻醬麵" },
-    { "麻醉药", "麻醉藥" },
-    { "黃詩杰", "黃詩杰" },
-    { "黃鈺筑", "黃鈺筑" },
-    { "黄", "黃" },
-    { "黄历", "黃曆" },
-    { "黄发", "黃髮" },
-    { "黄干黑瘦", "黃乾黑瘦" },
-    { "黄曲毒素", "黃麴毒素" },
-    { "黄诗杰", "黃詩杰" },
-    { "黄钟", "黃鐘" },
-    { "黄钰筑", "黃鈺筑" },
-    { "黉", "黌" },
-    { "黑发", "黑髮" },
-    { "黑色长发", "黑色長髮" },
-    { "黩", "黷" },
-    { "黪", "黲" },
-    { "黾", "黽" },
-    { "鼋", "黿" },
-    { "鼍", "鼉" },
-    { "鼓里", "鼓裡" },
-    { "鼗", "鞀" },
-    { "鼠曲草", "鼠麴草" },
-    { "鼠药", "鼠藥" },
-    { "鼹", "鼴" },
-    { "鼻准", "鼻準" },
-    { "鼻梁", "鼻樑" },
-    { "齄", "齇" },
-    { "齐", "齊" },
-    { "齐庄", "齊莊" },
-    { "齐王舍牛", "齊王捨牛" },
-    { "齑", "齏" },
-    { "齿", "齒" },
-    { "齿危发秀", "齒危髮秀" },
-    { "齿发", "齒髮" },
-    { "龀", "齔" },
-    { "龃", "齟" },
-    { "龄", "齡" },
-    { "龅", "齙" },
-    { "龆", "齠" },
-    { "龇", "齜" },
-    { "龈", "齦" },
-    { "龉", "齬" },
-    { "龊", "齪" },
-    { "龋", "齲" },
-    { "龌", "齷" },
-    { "龙", "龍" },
-    { "龙卷", "龍捲" },
-    { "龙斗虎伤", "龍鬥虎傷" },
-    { "龙须", "龍鬚" },
-    { "龚", "龔" },
-    { "龛", "龕" },
-    { "龟", "龜" },
+static const gchar simp_to_trad_strings[] =
+    "〇餘\0"  /* 〇余 */
+    "〇隻\0"  /* 〇只 */
+    "一個準\0"  /* 一个准 */
+    "一爭兩醜\0"  /* 一争两丑 */
+    "一夥\0"  /* 一伙 */
+    "一餘\0"  /* 一余 */
+    "一衝\0"  /* 一冲 */
+    "一準\0"  /* 一准 */
+    "一齣子\0"  /* 一出子 */
+    "一划\0"  /* 一划 */
+    "一彆頭\0"  /* 一别头 */
+    "一髮千鈞\0"  /* 一发千钧 */
+    "一隻\0"  /* 一只 */
+    "一弔\0"  /* 一吊 */
+    "一鬨而散\0"  /* 一哄而散 */
+    "一地裡\0"  /* 一地里 */
+    "一天鐘\0"  /* 一天钟 */
+    "一頭長髮\0"  /* 一头长发 */
+    "一乾二淨\0"  /* 一干二净 */
+    "一併\0"  /* 一并 */
+    "一紮\0"  /* 一扎 */
+    "一樹百穫\0"  /* 一树百获 */
+    "一物剋一物\0"  /* 一物克一物 */
+    "一鍋麵\0"  /* 一锅面 */
+    "七餘\0"  /* 七余 */
+    "七隻\0"  /* 七只 */
+    "七情六慾\0"  /* 七情六欲 */
+    "七紮\0"  /* 七扎 */
+    "萬\0"  /* 万 */
+    "萬餘\0"  /* 万余 */
+    "万俟\0"  /* 万俟 */
+    "萬曆\0"  /* 万历 */
+    "萬隻\0"  /* 万只 */
+    "萬年曆錶\0"  /* 万年历表 */
+    "萬紮\0"  /* 万扎 */
+    "万旗\0"  /* 万旗 */
+    "萬籤插架\0"  /* 万签插架 */
+    "三餘\0"  /* 三余 */
+    "三準\0"  /* 三准 */
+    "三隻\0"  /* 三只 */
+    "三複\0"  /* 三复 */
+    "三徵七辟\0"  /* 三征七辟 */
+    "三紮\0"  /* 三扎 */
+    "三統曆\0"  /* 三统历 */
+    "上樑\0"  /* 上梁 */
+    "上籤\0"  /* 上签 */
+    "上藥\0"  /* 上药 */
+    "上課鐘\0"  /* 上课钟 */
+    "下崙路\0"  /* 下仑路 */
+    "下樑\0"  /* 下梁 */
+    "下籤\0"  /* 下签 */
+    "下藥\0"  /* 下药 */
+    "下課鐘\0"  /* 下课钟 */
+    "不醜\0"  /* 不丑 */
+    "不剋制\0"  /* 不克制 */
+    "不準\0"  /* 不准 */
+    "不佔\0"  /* 不占 */
+    "不弔\0"  /* 不吊 */
+    "不寒而慄\0"  /* 不寒而栗 */
+    "不幹\0"  /* 不干 */
+    "不乾不淨\0"  /* 不干不净 */
+    "不託\0"  /* 不托 */
+    "不鬥\0"  /* 不斗 */
+    "不藥而癒\0"  /* 不药而愈 */
+    "不穀\0"  /* 不谷 */
+    "不通弔慶\0"  /* 不通吊庆 */
+    "不採\0"  /* 不采 */
+    "不鏽鋼\0"  /* 不锈钢 */
+    "不食乾腊\0"  /* 不食干腊 */
+    "與\0"  /* 与 */
+    "與剋制\0"  /* 与克制 */
+    "醜醜\0"  /* 丑丑 */
+    "醜丫頭\0"  /* 丑丫头 */
+    "醜事\0"  /* 丑事 */
+    "醜於\0"  /* 丑于 */
+    "醜人\0"  /* 丑人 */
+    "醜儕\0"  /* 丑侪 */
+    "醜八怪\0"  /* 丑八怪 */
+    "醜剌剌\0"  /* 丑剌剌 */
+    "醜劇\0"  /* 丑剧 */
+    "醜化\0"  /* 丑化 */
+    "醜史\0"  /* 丑史 */
+    "醜名\0"  /* 丑名 */
+    "醜吒\0"  /* 丑咤 */
+    "醜地\0"  /* 丑地 */
+    "醜聲\0"  /* 丑声 */
+    "醜頭怪臉\0"  /* 丑头怪脸 */
+    "醜夷\0"  /* 丑夷 */
+    "醜女\0"  /* 丑女 */
+    "醜奴兒\0"  /* 丑奴儿 */
+    "醜婦\0"  /* 丑妇 */
+    "醜媳\0"  /* 丑媳 */
+    "醜小鴨\0"  /* 丑小鸭 */
+    "醜巴怪\0"  /* 丑巴怪 */
+    "醜徒\0"  /* 丑徒 */
+    "醜態\0"  /* 丑态 */
+    "醜惡\0"  /* 丑恶 */
+    "醜末\0"  /* 丑末 */
+    "醜雜\0"  /* 丑杂 */
+    "醜樣\0"  /* 丑样 */
+    "醜死\0"  /* 丑死 */
+    "醜比\0"  /* 丑比 */
+    "醜斃了\0"  /* 丑毙了 */
+    "醜沮\0"  /* 丑沮 */
+    "醜男\0"  /* 丑男 */
+    "醜類\0"  /* 丑类 */
+    "醜臉\0"  /* 丑脸 */
+    "醜虜\0"  /* 丑虏 */
+    "醜行\0"  /* 丑行 */
+    "醜言\0"  /* 丑言 */
+    "醜詆\0"  /* 丑诋 */
+    "醜話\0"  /* 丑话 */
+    "醜語\0"  /* 丑语 */
+    "醜賊生\0"  /* 丑贼生 */
+    "醜辭\0"  /* 丑辞 */
+    "醜辱\0"  /* 丑辱 */
+    "醜逆\0"  /* 丑逆 */
+    "醜聞\0"  /* 丑闻 */
+    "醜陋\0"  /* 丑陋 */
+    "專\0"  /* 专 */
+    "專註\0"  /* 专注 */
+    "專輯裡\0"  /* 专辑里 */
+    "世界盃\0"  /* 世界杯 */
+    "世界裡\0"  /* 世界里 */
+    "世紀鐘\0"  /* 世纪钟 */
+    "業\0"  /* 业 */
+    "業餘\0"  /* 业余 */
+    "叢\0"  /* 丛 */
+    "東\0"  /* 东 */
+    "東衝西突\0"  /* 东冲西突 */
+    "東周鐘\0"  /* 东周钟 */
+    "東嶽\0"  /* 东岳 */
+    "東遊\0"  /* 东游 */
+    "絲\0"  /* 丝 */
+    "絲製\0"  /* 丝制 */
+    "絲髮\0"  /* 丝发 */
+    "絲恩髮怨\0"  /* 丝恩发怨 */
+    "丟\0"  /* 丢 */
+    "丟醜\0"  /* 丢丑 */
+    "兩\0"  /* 两 */
+    "兩餘\0"  /* 两余 */
+    "兩隻\0"  /* 两只 */
+    "兩天晒網\0"  /* 两天晒网 */
+    "兩紮\0"  /* 两扎 */
+    "兩虎共鬥\0"  /* 两虎共斗 */
+    "兩鼠鬥穴\0"  /* 两鼠斗穴 */
+    "嚴\0"  /* 严 */
+    "嚴云農\0"  /* 严云农 */
+    "喪\0"  /* 丧 */
+    "喪鐘\0"  /* 丧钟 */
+    "個\0"  /* 个 */
+    "箇中原因\0"  /* 个中原因 */
+    "箇中奧妙\0"  /* 个中奥妙 */
+    "箇中奧秘\0"  /* 个中奥秘 */
+    "箇中好手\0"  /* 个中好手 */
+    "箇中強手\0"  /* 个中强手 */
+    "箇中消息\0"  /* 个中消息 */
+    "箇中滋味\0"  /* 个中滋味 */
+    "箇中玄機\0"  /* 个中玄机 */
+    "箇中理由\0"  /* 个中理由 */
+    "箇中訊息\0"  /* 个中讯息 */
+    "箇中資訊\0"  /* 个中资讯 */
+    "箇中高手\0"  /* 个中高手 */
+    "箇舊\0"  /* 个旧 */
+    "個裡\0"  /* 个里 */
+    "個鐘\0"  /* 个钟 */
+    "個鐘錶\0"  /* 个钟表 */
+    "中崙\0"  /* 中仑 */
+    "中型鐘\0"  /* 中型钟 */
+    "中嶽\0"  /* 中岳 */
+    "中文裡\0"  /* 中文里 */
+    "中籤\0"  /* 中签 */
+    "中藥\0"  /* 中药 */
+    "豐\0"  /* 丰 */
+    "丰儀\0"  /* 丰仪 */
+    "丰儀\0"  /* 丰儀 */
+    "丰南\0"  /* 丰南 */
+    "丰台\0"  /* 丰台 */
+    "丰姿\0"  /* 丰姿 */
+    "丰容\0"  /* 丰容 */
+    "丰度\0"  /* 丰度 */
+    "丰情\0"  /* 丰情 */
+    "丰標\0"  /* 丰标 */
+    "丰標不凡\0"  /* 丰標不凡 */
+    "丰神\0"  /* 丰神 */
+    "丰茸\0"  /* 丰茸 */
+    "丰采\0"  /* 丰采 */
+    "丰韻\0"  /* 丰韵 */
+    "丰韻\0"  /* 丰韻 */
+    "臨\0"  /* 临 */
+    "臨潼鬥寶\0"  /* 临潼斗宝 */
+    "丸藥\0"  /* 丸药 */
+    "丹藥\0"  /* 丹药 */
+    "為\0"  /* 为 */
+    "為準\0"  /* 为准 */
+    "為著\0"  /* 为着 */
+    "主僕\0"  /* 主仆 */
+    "主幹\0"  /* 主干 */
+    "主鐘曲線\0"  /* 主钟曲线 */
+    "麗\0"  /* 丽 */
+    "舉\0"  /* 举 */
+    "么麼小丑\0"  /* 么么小丑 */
+    "義\0"  /* 义 */
+    "義僕\0"  /* 义仆 */
+    "義佔\0"  /* 义占 */
+    "義莊\0"  /* 义庄 */
+    "之餘\0"  /* 之余 */
+    "之徵\0"  /* 之征 */
+    "之託\0"  /* 之托 */
+    "之鐘\0"  /* 之钟 */
+    "烏\0"  /* 乌 */
+    "烏髮\0"  /* 乌发 */
+    "烏龍麵\0"  /* 乌龙面 */
+    "樂\0"  /* 乐 */
+    "樂器鐘\0"  /* 乐器钟 */
+    "喬\0"  /* 乔 */
+    "喬嶽\0"  /* 乔岳 */
+    "九世之讎\0"  /* 九世之仇 */
+    "九餘\0"  /* 九余 */
+    "九隻\0"  /* 九只 */
+    "九紮\0"  /* 九扎 */
+    "九穀\0"  /* 九谷 */
+    "也剋制\0"  /* 也克制 */
+    "習\0"  /* 习 */
+    "鄉\0"  /* 乡 */
+    "鄉愿\0"  /* 乡愿 */
+    "書\0"  /* 书 */
+    "書籤\0"  /* 书签 */
+    "買\0"  /* 买 */
+    "買兇\0"  /* 买凶 */
+    "亂\0"  /* 乱 */
+    "亂髮\0"  /* 乱发 */
+    "亂鬨\0"  /* 乱哄 */
+    "乾象曆\0"  /* 乾象历 */
+    "了剋制\0"  /* 了克制 */
+    "瞭望\0"  /* 了望 */
+    "瞭然\0"  /* 了然 */
+    "瞭若指掌\0"  /* 了若指掌 */
+    "爭\0"  /* 争 */
+    "爭奇鬥妍\0"  /* 争奇斗妍 */
+    "爭奇鬥異\0"  /* 争奇斗异 */
+    "爭妍鬥奇\0"  /* 争妍斗奇 */
+    "爭鬥\0"  /* 争斗 */
+    "爭紅鬥紫\0"  /* 争红斗紫 */
+    "事迹\0"  /* 事迹 */
+    "二崙\0"  /* 二仑 */
+    "二餘\0"  /* 二余 */
+    "二隻\0"  /* 二只 */
+    "二缶鐘惑\0"  /* 二缶钟惑 */
+    "於\0"  /* 于 */
+    "於醜\0"  /* 于丑 */
+    "于丹\0"  /* 于丹 */
+    "于于\0"  /* 于于 */
+    "于雲鶴\0"  /* 于云鹤 */
+    "于仁泰\0"  /* 于仁泰 */
+    "于從濂\0"  /* 于从濂 */
+    "于仲文\0"  /* 于仲文 */
+    "于會泳\0"  /* 于会泳 */
+    "于偉國\0"  /* 于伟国 */
+    "于餘曲折\0"  /* 于余曲折 */
+    "于佳卉\0"  /* 于佳卉 */
+    "于偉國\0"  /* 于偉國 */
+    "于光新\0"  /* 于光新 */
+    "于光遠\0"  /* 于光远 */
+    "于光遠\0"  /* 于光遠 */
+    "於剋制\0"  /* 于克制 */
+    "于克勒\0"  /* 于克勒 */
+    "于再清\0"  /* 于再清 */
+    "于冕\0"  /* 于冕 */
+    "于軍\0"  /* 于军 */
+    "于冠華\0"  /* 于冠华 */
+    "于凌奎\0"  /* 于凌奎 */
+    "于凌辰\0"  /* 于凌辰 */
+    "于鳳桐\0"  /* 于凤桐 */
+    "于鳳至\0"  /* 于凤至 */
+    "于勒\0"  /* 于勒 */
+    "于化虎\0"  /* 于化虎 */
+    "于占元\0"  /* 于占元 */
+    "于友澤\0"  /* 于友泽 */
+    "于雙戈\0"  /* 于双戈 */
+    "于台煙\0"  /* 于台烟 */
+    "于台煙\0"  /* 于台煙 */
+    "于右任\0"  /* 于右任 */
+    "于吉\0"  /* 于吉 */
+    "于和偉\0"  /* 于和伟 */
+    "于品海\0"  /* 于品海 */
+    "于國楨\0"  /* 于国桢 */
+    "于國治\0"  /* 于国治 */
+    "于國楨\0"  /* 于國楨 */
+    "于國治\0"  /* 于國治 */
+    "於坏\0"  /* 于坏 */
+    "于堅\0"  /* 于坚 */
+    "于堅\0"  /* 于堅 */
+    "于大寶\0"  /* 于大宝 */
+    "于大寶\0"  /* 于大寶 */
+    "于天仁\0"  /* 于天仁 */
+    "于天龍\0"  /* 于天龙 */
+    "于奇庫杜克\0"  /* 于奇库杜克 */
+    "于奇庫杜克\0"  /* 于奇庫杜克 */
+    "于姓\0"  /* 于姓 */
+    "于娜\0"  /* 于娜 */
+    "于娟\0"  /* 于娟 */
+    "于子千\0"  /* 于子千 */
+    "于孔兼\0"  /* 于孔兼 */
+    "于學忠\0"  /* 于学忠 */
+    "于學忠\0"  /* 于學忠 */
+    "于家堡\0"  /* 于家堡 */
+    "于寘\0"  /* 于寘 */
+    "于小偉\0"  /* 于小伟 */
+    "于小偉\0"  /* 于小偉 */
+    "于小彤\0"  /* 于小彤 */
+    "于小惠\0"  /* 于小惠 */
+    "于少保\0"  /* 于少保 */
+    "于爾岑\0"  /* 于尔岑 */
+    "于爾根\0"  /* 于尔根 */
+    "于爾里克\0"  /* 于尔里克 */
+    "于山\0"  /* 于山 */
+    "于帥\0"  /* 于帅 */
+    "于帥\0"  /* 于帥 */
+    "于幼軍\0"  /* 于幼军 */
+    "于幼軍\0"  /* 于幼軍 */
+    "于廣洲\0"  /* 于广洲 */
+    "于康震\0"  /* 于康震 */
+    "于廣洲\0"  /* 于廣洲 */
+    "于式枚\0"  /* 于式枚 */
+    "于歸\0"  /* 于归 */
+    "於徵\0"  /* 于征 */
+    "于從濂\0"  /* 于從濂 */
+    "于德海\0"  /* 于德海 */
+    "于志寧\0"  /* 于志宁 */
+    "于志寧\0"  /* 于志寧 */
+    "于忠肅集\0"  /* 于忠肃集 */
+    "于思\0"  /* 于思 */
+    "于慎行\0"  /* 于慎行 */
+    "于慧\0"  /* 于慧 */
+    "于成龍\0"  /* 于成龍 */
+    "于成龍\0"  /* 于成龙 */
+    "于振\0"  /* 于振 */
+    "于敏\0"  /* 于敏 */
+    "于斌\0"  /* 于斌 */
+    "于斯塔德\0"  /* 于斯塔德 */
+    "于斯達爾\0"  /* 于斯达尔 */
+    "于斯達爾\0"  /* 于斯達爾 */
+    "于明濤\0"  /* 于明涛 */
+    "于明濤\0"  /* 于明濤 */
+    "于是之\0"  /* 于是之 */
+    "于晨楠\0"  /* 于晨楠 */
+    "于晴\0"  /* 于晴 */
+    "于會泳\0"  /* 于會泳 */
+    "于來山\0"  /* 于来山 */
+    "于楓\0"  /* 于枫 */
+    "于樹潔\0"  /* 于树洁 */
+    "于根偉\0"  /* 于根伟 */
+    "于根偉\0"  /* 于根偉 */
+    "于格\0"  /* 于格 */
+    "于楓\0"  /* 于楓 */
+    "于樂\0"  /* 于樂 */
+    "于樹潔\0"  /* 于樹潔 */
+    "于欣\0"  /* 于欣 */
+    "于正昇\0"  /* 于正升 */
+    "于正昇\0"  /* 于正昇 */
+    "于正昌\0"  /* 于正昌 */
+    "于永波\0"  /* 于永波 */
+    "于漢超\0"  /* 于汉超 */
+    "于江震\0"  /* 于江震 */
+    "于波\0"  /* 于波 */
+    "于澤爾\0"  /* 于泽尔 */
+    "于洋\0"  /* 于洋 */
+    "于洪區\0"  /* 于洪区 */
+    "于洪區\0"  /* 于洪區 */
+    "于浩威\0"  /* 于浩威 */
+    "于海\0"  /* 于海 */
+    "于濤\0"  /* 于涛 */
+    "于湘蘭\0"  /* 于湘兰 */
+    "于湘蘭\0"  /* 于湘蘭 */
+    "于漢超\0"  /* 于漢超 */
+    "于澄\0"  /* 于澄 */
+    "于澤爾\0"  /* 于澤爾 */
+    "于濤\0"  /* 于濤 */
+    "于熙珍\0"  /* 于熙珍 */
+    "于爾岑\0"  /* 于爾岑 */
+    "于爾根\0"  /* 于爾根 */
+    "于爾里克\0"  /* 于爾里克 */
+    "于特森\0"  /* 于特森 */
+    "于玉立\0"  /* 于玉立 */
+    "于田\0"  /* 于田 */
+    "于禁\0"  /* 于禁 */
+    "于秀敏\0"  /* 于秀敏 */
+    "于立成\0"  /* 于立成 */
+    "于素秋\0"  /* 于素秋 */
+    "于美人\0"  /* 于美人 */
+    "于耘婕\0"  /* 于耘婕 */
+    "于若木\0"  /* 于若木 */
+    "于榮光\0"  /* 于荣光 */
+    "于蔭霖\0"  /* 于荫霖 */
+    "于蔭霖\0"  /* 于蔭霖 */
+    "于衡\0"  /* 于衡 */
+    "于西翰\0"  /* 于西翰 */
+    "于謙\0"  /* 于謙 */
+    "于謙\0"  /* 于谦 */
+    "于謹\0"  /* 于谨 */
+    "于貝爾\0"  /* 于貝爾 */
+    "于贈\0"  /* 于贈 */
+    "于貝爾\0"  /* 于贝尔 */
+    "于贈\0"  /* 于赠 */
+    "于越\0"  /* 于越 */
+    "于軍\0"  /* 于軍 */
+    "于遠偉\0"  /* 于远伟 */
+    "于道泉\0"  /* 于道泉 */
+    "于遠偉\0"  /* 于遠偉 */
+    "于都縣\0"  /* 于都县 */
+    "于都縣\0"  /* 于都縣 */
+    "于里察\0"  /* 于里察 */
+    "于闐\0"  /* 于阗 */
+    "于雙戈\0"  /* 于雙戈 */
+    "于震\0"  /* 于震 */
+    "於震后\0"  /* 于震后 */
+    "于靖\0"  /* 于靖 */
+    "于非闇\0"  /* 于非闇 */
+    "于韋斯屈萊\0"  /* 于韋斯屈萊 */
+    "于韋斯屈萊\0"  /* 于韦斯屈莱 */
+    "于風政\0"  /* 于風政 */
+    "于風政\0"  /* 于风政 */
+    "于飛島\0"  /* 于飛島 */
+    "于飛\0"  /* 于飞 */
+    "于鬯\0"  /* 于鬯 */
+    "于魁智\0"  /* 于魁智 */
+    "于鳳桐\0"  /* 于鳳桐 */
+    "于鳳至\0"  /* 于鳳至 */
+    "于默奧\0"  /* 于默奥 */
+    "于默奧\0"  /* 于默奧 */
+    "虧\0"  /* 亏 */
+    "雲\0"  /* 云 */
+    "云為\0"  /* 云为 */
+    "云乎\0"  /* 云乎 */
+    "云云\0"  /* 云云 */
+    "云何\0"  /* 云何 */
+    "雲南白藥\0"  /* 云南白药 */
+    "云爾\0"  /* 云尔 */
+    "雲遊\0"  /* 云游 */
+    "云為\0"  /* 云為 */
+    "云然\0"  /* 云然 */
+    "雲笈七籤\0"  /* 云笈七签 */
+    "雲鬚\0"  /* 云须 */
+    "五餘\0"  /* 五余 */
+    "五齣\0"  /* 五出 */
+    "五隻\0"  /* 五只 */
+    "五嶽\0"  /* 五岳 */
+    "五紮\0"  /* 五扎 */
+    "五行生剋\0"  /* 五行生克 */
+    "五穀\0"  /* 五谷 */
+    "井榦摧敗\0"  /* 井干摧败 */
+    "井裡\0"  /* 井里 */
+    "亞\0"  /* 亚 */
+    "亞美尼亞曆\0"  /* 亚美尼亚历 */
+    "交鬨\0"  /* 交哄 */
+    "交託\0"  /* 交托 */
+    "交遊\0"  /* 交游 */
+    "亦云\0"  /* 亦云 */
+    "亦莊亦諧\0"  /* 亦庄亦谐 */
+    "產\0"  /* 产 */
+    "畝\0"  /* 亩 */
+    "亮醜\0"  /* 亮丑 */
+    "亮鐘\0"  /* 亮钟 */
+    "親\0"  /* 亲 */
+    "褻\0"  /* 亵 */
+    "人云\0"  /* 人云 */
+    "人蔘\0"  /* 人参 */
+    "人慾\0"  /* 人欲 */
+    "人物誌\0"  /* 人物志 */
+    "億\0"  /* 亿 */
+    "億餘\0"  /* 亿余 */
+    "億隻\0"  /* 亿只 */
+    "什麼\0"  /* 什么 */
+    "什錦麵\0"  /* 什锦面 */
+    "僅\0"  /* 仅 */
+    "僕人\0"  /* 仆人 */
+    "僕僕\0"  /* 仆仆 */
+    "僕從\0"  /* 仆从 */
+    "僕使\0"  /* 仆使 */
+    "僕僮\0"  /* 仆僮 */
+    "僕吏\0"  /* 仆吏 */
+    "僕固懷恩\0"  /* 仆固怀恩 */
+    "僕夫\0"  /* 仆夫 */
+    "僕婦\0"  /* 仆妇 */
+    "僕姑\0"  /* 仆姑 */
+    "僕婢\0"  /* 仆婢 */
+    "僕射\0"  /* 仆射 */
+    "僕少\0"  /* 仆少 */
+    "僕役\0"  /* 仆役 */
+    "僕憎\0"  /* 仆憎 */
+    "僕歐\0"  /* 仆欧 */
+    "僕程\0"  /* 仆程 */
+    "僕雖罷駑\0"  /* 仆虽罢驽 */
+    "仇讎\0"  /* 仇仇 */
+    "讎問\0"  /* 仇問 */
+    "讎夷\0"  /* 仇夷 */
+    "讎校\0"  /* 仇校 */
+    "讎正\0"  /* 仇正 */
+    "讎隙\0"  /* 仇隙 */
+    "從\0"  /* 从 */
+    "從裡到外\0"  /* 从里到外 */
+    "從裡向外\0"  /* 从里向外 */
+    "侖\0"  /* 仑 */
+    "崙背\0"  /* 仑背 */
+    "倉\0"  /* 仓 */
+    "他剋制\0"  /* 他克制 */
+    "他鐘\0"  /* 他钟 */
+    "付託\0"  /* 付托 */
+    "仙后\0"  /* 仙后 */
+    "仙藥\0"  /* 仙药 */
+    "儀\0"  /* 仪 */
+    "儀範\0"  /* 仪范 */
+    "儀錶\0"  /* 仪表 */
+    "們\0"  /* 们 */
+    "們剋制\0"  /* 们克制 */
+    "仰藥\0"  /* 仰药 */
+    "件鐘\0"  /* 件钟 */
+    "價\0"  /* 价 */
+    "任何錶\0"  /* 任何表 */
+    "任何鐘\0"  /* 任何钟 */
+    "彷彿\0"  /* 仿佛 */
+    "仿製\0"  /* 仿制 */
+    "伊東怜\0"  /* 伊东怜 */
+    "伊于湖底\0"  /* 伊于湖底 */
+    "伊爾汗曆表\0"  /* 伊尔汗历表 */
+    "伊府麵\0"  /* 伊府面 */
+    "伊斯蘭曆\0"  /* 伊斯兰历 */
+    "伊斯蘭教曆\0"  /* 伊斯兰教历 */
+    "伊適杰\0"  /* 伊适杰 */
+    "伊鬱\0"  /* 伊郁 */
+    "伏几\0"  /* 伏几 */
+    "休徵\0"  /* 休征 */
+    "眾\0"  /* 众 */
+    "優\0"  /* 优 */
+    "優遊\0"  /* 优游 */
+    "夥眾\0"  /* 伙众 */
+    "夥伴\0"  /* 伙伴 */
+    "夥友\0"  /* 伙友 */
+    "夥同\0"  /* 伙同 */
+    "夥計\0"  /* 伙计 */
+    "會\0"  /* 会 */
+    "會佔\0"  /* 会占 */
+    "會弔\0"  /* 会吊 */
+    "會幹\0"  /* 会干 */
+    "會裡\0"  /* 会里 */
+    "傴\0"  /* 伛 */
+    "傘\0"  /* 伞 */
+    "偉\0"  /* 伟 */
+    "傳\0"  /* 传 */
+    "傳位于四太子\0"  /* 传位于四太子 */
+    "傷\0"  /* 伤 */
+    "傷痕纍纍\0"  /* 伤痕累累 */
+    "倀\0"  /* 伥 */
+    "倫\0"  /* 伦 */
+    "傖\0"  /* 伧 */
+    "偽\0"  /* 伪 */
+    "偽藥\0"  /* 伪药 */
+    "佇\0"  /* 伫 */
+    "伴遊\0"  /* 伴游 */
+    "但云\0"  /* 但云 */
+    "位準\0"  /* 位准 */
+    "低洼\0"  /* 低洼 */
+    "住紮\0"  /* 住扎 */
+    "體\0"  /* 体 */
+    "體範\0"  /* 体范 */
+    "何杰\0"  /* 何杰 */
+    "餘〇\0"  /* 余〇 */
+    "餘一\0"  /* 余一 */
+    "餘七\0"  /* 余七 */
+    "餘三\0"  /* 余三 */
+    "餘下\0"  /* 余下 */
+    "餘業\0"  /* 余业 */
+    "餘九\0"  /* 余九 */
+    "餘事\0"  /* 余事 */
+    "餘二\0"  /* 余二 */
+    "餘五\0"  /* 余五 */
+    "餘人\0"  /* 余人 */
+    "餘眾\0"  /* 余众 */
+    "餘俗\0"  /* 余俗 */
+    "餘倍\0"  /* 余倍 */
+    "餘僇\0"  /* 余僇 */
+    "餘光\0"  /* 余光 */
+    "餘黨\0"  /* 余党 */
+    "餘八\0"  /* 余八 */
+    "餘六\0"  /* 余六 */
+    "餘興\0"  /* 余兴 */
+    "餘刃\0"  /* 余刃 */
+    "餘切\0"  /* 余切 */
+    "餘利\0"  /* 余利 */
+    "餘割\0"  /* 余割 */
+    "餘力\0"  /* 余力 */
+    "餘勇\0"  /* 余勇 */
+    "餘十\0"  /* 余十 */
+    "餘味\0"  /* 余味 */
+    "餘響\0"  /* 余响 */
+    "餘喘\0"  /* 余喘 */
+    "餘四\0"  /* 余四 */
+    "餘地\0"  /* 余地 */
+    "餘墨\0"  /* 余墨 */
+    "餘聲\0"  /* 余声 */
+    "餘外\0"  /* 余外 */
+    "餘妙\0"  /* 余妙 */
+    "餘姚\0"  /* 余姚 */
+    "餘威\0"  /* 余威 */
+    "餘子\0"  /* 余子 */
+    "餘存\0"  /* 余存 */
+    "餘孽\0"  /* 余孽 */
+    "餘慶\0"  /* 余庆 */
+    "餘弦\0"  /* 余弦 */
+    "餘思\0"  /* 余思 */
+    "餘悸\0"  /* 余悸 */
+    "餘數\0"  /* 余数 */
+    "餘明\0"  /* 余明 */
+    "餘映\0"  /* 余映 */
+    "餘暉\0"  /* 余晖 */
+    "餘暇\0"  /* 余暇 */
+    "餘杭\0"  /* 余杭 */
+    "餘杯\0"  /* 余杯 */
+    "餘桃\0"  /* 余桃 */
+    "餘桶\0"  /* 余桶 */
+    "餘款\0"  /* 余款 */
+    "餘步\0"  /* 余步 */
+    "餘殃\0"  /* 余殃 */
+    "餘毒\0"  /* 余毒 */
+    "餘氣\0"  /* 余气 */
+    "餘瀝\0"  /* 余沥 */
+    "餘波\0"  /* 余波 */
+    "餘波盪漾\0"  /* 余波荡漾 */
+    "餘澤\0"  /* 余泽 */
+    "餘溫\0"  /* 余温 */
+    "餘烈\0"  /* 余烈 */
+    "餘燼\0"  /* 余烬 */
+    "餘熱\0"  /* 余热 */
+    "餘珍\0"  /* 余珍 */
+    "餘生\0"  /* 余生 */
+    "餘竅\0"  /* 余窍 */
+    "餘糧\0"  /* 余粮 */
+    "餘緒\0"  /* 余绪 */
+    "餘缺\0"  /* 余缺 */
+    "餘罪\0"  /* 余罪 */
+    "餘羨\0"  /* 余羡 */
+    "餘膏\0"  /* 余膏 */
+    "餘蔭\0"  /* 余荫 */
+    "餘蓄\0"  /* 余蓄 */
+    "餘裕\0"  /* 余裕 */
+    "餘角\0"  /* 余角 */
+    "餘論\0"  /* 余论 */
+    "餘貾\0"  /* 余貾 */
+    "餘責\0"  /* 余责 */
+    "餘輝\0"  /* 余辉 */
+    "餘辜\0"  /* 余辜 */
+    "餘酲\0"  /* 余酲 */
+    "餘量\0"  /* 余量 */
+    "餘閏\0"  /* 余闰 */
+    "餘閒\0"  /* 余闲 */
+    "餘零\0"  /* 余零 */
+    "餘震\0"  /* 余震 */
+    "餘霞\0"  /* 余霞 */
+    "餘音\0"  /* 余音 */
+    "餘音繞梁\0"  /* 余音绕梁 */
+    "餘韻\0"  /* 余韵 */
+    "餘額\0"  /* 余额 */
+    "餘風\0"  /* 余风 */
+    "餘食\0"  /* 余食 */
+    "佛羅稜薩\0"  /* 佛罗棱萨 */
+    "佛鐘\0"  /* 佛钟 */
+    "作準\0"  /* 作准 */
+    "作品裡\0"  /* 作品里 */
+    "作姦犯科\0"  /* 作奸犯科 */
+    "作莊\0"  /* 作庄 */
+    "你剋制\0"  /* 你克制 */
+    "你纔子發昏\0"  /* 你才子发昏 */
+    "傭中佼佼\0"  /* 佣中佼佼 */
+    "傭書\0"  /* 佣书 */
+    "傭人\0"  /* 佣人 */
+    "傭僕\0"  /* 佣仆 */
+    "傭兵\0"  /* 佣兵 */
+    "傭工\0"  /* 佣工 */
+    "傭懶\0"  /* 佣懒 */
+    "傭金\0"  /* 佣金 */
+    "僉\0"  /* 佥 */
+    "佳肴\0"  /* 佳肴 */
+    "使其鬥\0"  /* 使其斗 */
+    "侍僕\0"  /* 侍仆 */
+    "供製\0"  /* 供制 */
+    "依依不捨\0"  /* 依依不舍 */
+    "依託\0"  /* 依托 */
+    "俠\0"  /* 侠 */
+    "侶\0"  /* 侣 */
+    "僥\0"  /* 侥 */
+    "僥倖\0"  /* 侥幸 */
+    "偵\0"  /* 侦 */
+    "側\0"  /* 侧 */
+    "僑\0"  /* 侨 */
+    "儈\0"  /* 侩 */
+    "儕\0"  /* 侪 */
+    "儂\0"  /* 侬 */
+    "侵佔\0"  /* 侵占 */
+    "侵併\0"  /* 侵并 */
+    "便藥\0"  /* 便药 */
+    "俄佔\0"  /* 俄占 */
+    "保險柜\0"  /* 保险柜 */
+    "信託\0"  /* 信托 */
+    "俁\0"  /* 俣 */
+    "儔\0"  /* 俦 */
+    "儼\0"  /* 俨 */
+    "倆\0"  /* 俩 */
+    "儷\0"  /* 俪 */
+    "儉\0"  /* 俭 */
+    "儉僕\0"  /* 俭仆 */
+    "儉樸\0"  /* 俭朴 */
+    "儉确之教\0"  /* 俭确之教 */
+    "修杰楷\0"  /* 修杰楷 */
+    "修杰麟\0"  /* 修杰麟 */
+    "修鍊\0"  /* 修炼 */
+    "修鬍刀\0"  /* 修胡刀 */
+    "俯衝\0"  /* 俯冲 */
+    "倒繃孩兒\0"  /* 倒绷孩儿 */
+    "倛醜\0"  /* 倛丑 */
+    "藉以\0"  /* 借以 */
+    "藉助\0"  /* 借助 */
+    "藉寇兵\0"  /* 借寇兵 */
+    "藉手\0"  /* 借手 */
+    "藉機\0"  /* 借机 */
+    "藉此\0"  /* 借此 */
+    "藉由\0"  /* 借由 */
+    "藉著\0"  /* 借着 */
+    "藉箸代籌\0"  /* 借箸代筹 */
+    "藉資\0"  /* 借资 */
+    "倦遊\0"  /* 倦游 */
+    "債\0"  /* 债 */
+    "傾\0"  /* 倾 */
+    "傾複\0"  /* 倾复 */
+    "假髮\0"  /* 假发 */
+    "假託\0"  /* 假托 */
+    "假藥\0"  /* 假药 */
+    "偎乾\0"  /* 偎干 */
+    "做莊\0"  /* 做庄 */
+    "停製\0"  /* 停制 */
+    "停徵\0"  /* 停征 */
+    "傯\0"  /* 偬 */
+    "偷雞不著\0"  /* 偷鸡不着 */
+    "僂\0"  /* 偻 */
+    "僨\0"  /* 偾 */
+    "償\0"  /* 偿 */
+    "儻\0"  /* 傥 */
+    "儐\0"  /* 傧 */
+    "儲\0"  /* 储 */
+    "儺\0"  /* 傩 */
+    "催併\0"  /* 催并 */
+    "傲遊\0"  /* 傲游 */
+    "傲霜鬥雪\0"  /* 傲霜斗雪 */
+    "傳位于四太子\0"  /* 傳位于四太子 */
+    "傻裡傻氣\0"  /* 傻里傻气 */
+    "僮僕\0"  /* 僮仆 */
+    "殭屍\0"  /* 僵尸 */
+    "儒略曆\0"  /* 儒略历 */
+    "儒略改革曆\0"  /* 儒略改革历 */
+    "兒\0"  /* 儿 */
+    "兀朮\0"  /* 兀术 */
+    "元兇\0"  /* 元凶 */
+    "充饑\0"  /* 充饥 */
+    "兆餘\0"  /* 兆余 */
+    "先佔\0"  /* 先占 */
+    "先採\0"  /* 先采 */
+    "光緻緻\0"  /* 光致致 */
+    "剋制不了\0"  /* 克制不了 */
+    "剋制不住\0"  /* 克制不住 */
+    "克複\0"  /* 克复 */
+    "剋扣\0"  /* 克扣 */
+    "剋星\0"  /* 克星 */
+    "剋期\0"  /* 克期 */
+    "剋死\0"  /* 克死 */
+    "克藥\0"  /* 克药 */
+    "剋薄\0"  /* 克薄 */
+    "免徵\0"  /* 免征 */
+    "兌\0"  /* 兑 */
+    "兗\0"  /* 兖 */
+    "黨\0"  /* 党 */
+    "党參\0"  /* 党参 */
+    "党太尉\0"  /* 党太尉 */
+    "党懷英\0"  /* 党怀英 */
+    "党進\0"  /* 党进 */
+    "党項\0"  /* 党項 */
+    "党項\0"  /* 党项 */
+    "全乾\0"  /* 全干 */
+    "八餘\0"  /* 八余 */
+    "八隻\0"  /* 八只 */
+    "八字鬍\0"  /* 八字胡 */
+    "八紮\0"  /* 八扎 */
+    "八蜡\0"  /* 八蜡 */
+    "公僕\0"  /* 公仆 */
+    "公仔麵\0"  /* 公仔面 */
+    "公餘\0"  /* 公余 */
+    "公曆\0"  /* 公历 */
+    "公釐\0"  /* 公厘 */
+    "公幹\0"  /* 公干 */
+    "六餘\0"  /* 六余 */
+    "六衝\0"  /* 六冲 */
+    "六齣\0"  /* 六出 */
+    "六隻\0"  /* 六只 */
+    "六紮\0"  /* 六扎 */
+    "六穀\0"  /* 六谷 */
+    "蘭\0"  /* 兰 */
+    "共和曆\0"  /* 共和历 */
+    "關\0"  /* 关 */
+    "關弓與我确\0"  /* 关弓与我确 */
+    "關係\0"  /* 关系 */
+    "關係著\0"  /* 关系着 */
+    "興\0"  /* 兴 */
+    "興緻\0"  /* 兴致 */
+    "其餘\0"  /* 其余 */
+    "典範\0"  /* 典范 */
+    "茲\0"  /* 兹 */
+    "養\0"  /* 养 */
+    "兼并\0"  /* 兼并 */
+    "獸\0"  /* 兽 */
+    "獸慾\0"  /* 兽欲 */
+    "囅\0"  /* 冁 */
+    "內\0"  /* 内 */
+    "內製\0"  /* 内制 */
+    "內鬨\0"  /* 内哄 */
+    "內鬥\0"  /* 内斗 */
+    "岡\0"  /* 冈 */
+    "冊\0"  /* 册 */
+    "冗餘\0"  /* 冗余 */
+    "寫\0"  /* 写 */
+    "寫字檯\0"  /* 写字台 */
+    "軍\0"  /* 军 */
+    "軍隊剋制\0"  /* 军队克制 */
+    "農\0"  /* 农 */
+    "農曆\0"  /* 农历 */
+    "農莊\0"  /* 农庄 */
+    "農民曆\0"  /* 农民历 */
+    "農藥\0"  /* 农药 */
+    "冤讎\0"  /* 冤仇 */
+    "冥濛\0"  /* 冥蒙 */
+    "鼕鼕鼓\0"  /* 冬冬鼓 */
+    "冬天裡\0"  /* 冬天里 */
+    "冬日裡\0"  /* 冬日里 */
+    "冬遊\0"  /* 冬游 */
+    "馮\0"  /* 冯 */
+    "沖\0"  /* 冲 */
+    "衝上\0"  /* 冲上 */
+    "衝下\0"  /* 冲下 */
+    "衝倒\0"  /* 冲倒 */
+    "衝剋\0"  /* 冲克 */
+    "衝冠\0"  /* 冲冠 */
+    "沖冠髮怒\0"  /* 冲冠发怒 */
+    "衝決\0"  /* 冲决 */
+    "衝出\0"  /* 冲出 */
+    "衝擊\0"  /* 冲击 */
+    "衝到\0"  /* 冲到 */
+    "衝刺\0"  /* 冲刺 */
+    "衝力\0"  /* 冲力 */
+    "衝動\0"  /* 冲动 */
+    "衝勁\0"  /* 冲劲 */
+    "衝壓\0"  /* 冲压 */
+    "衝去\0"  /* 冲去 */
+    "衝口\0"  /* 冲口 */
+    "衝堅陷陣\0"  /* 冲坚陷阵 */
+    "衝垮\0"  /* 冲垮 */
+    "衝堂\0"  /* 冲堂 */
+    "衝天\0"  /* 冲天 */
+    "衝頭陣\0"  /* 冲头阵 */
+    "衝州撞府\0"  /* 冲州撞府 */
+    "衝心\0"  /* 冲心 */
+    "衝掉\0"  /* 冲掉 */
+    "衝撞\0"  /* 冲撞 */
+    "衝散\0"  /* 冲散 */
+    "衝殺\0"  /* 冲杀 */
+    "衝來\0"  /* 冲来 */
+    "衝波\0"  /* 冲波 */
+    "衝浪\0"  /* 冲浪 */
+    "衝激\0"  /* 冲激 */
+    "衝然\0"  /* 冲然 */
+    "衝盹\0"  /* 冲盹 */
+    "衝著\0"  /* 冲着 */
+    "衝破\0"  /* 冲破 */
+    "衝程\0"  /* 冲程 */
+    "衝突\0"  /* 冲突 */
+    "衝線\0"  /* 冲线 */
+    "衝要\0"  /* 冲要 */
+    "衝起\0"  /* 冲起 */
+    "衝車\0"  /* 冲车 */
+    "衝過\0"  /* 冲过 */
+    "衝進\0"  /* 冲进 */
+    "衝量\0"  /* 冲量 */
+    "衝鋒\0"  /* 冲锋 */
+    "衝陷\0"  /* 冲陷 */
+    "衝風\0"  /* 冲风 */
+    "決\0"  /* 决 */
+    "決鬥\0"  /* 决斗 */
+    "況\0"  /* 况 */
+    "冶遊\0"  /* 冶游 */
+    "冷麵\0"  /* 冷面 */
+    "凍\0"  /* 冻 */
+    "凈\0"  /* 净 */
+    "淨餘\0"  /* 净余 */
+    "淨髮\0"  /* 净发 */
+    "准三后\0"  /* 准三后 */
+    "準不準\0"  /* 准不准 */
+    "準會\0"  /* 准会 */
+    "準例\0"  /* 准例 */
+    "準保\0"  /* 准保 */
+    "準兒\0"  /* 准儿 */
+    "準決賽\0"  /* 准决赛 */
+    "準分子\0"  /* 准分子 */
+    "準則\0"  /* 准则 */
+    "準噶爾\0"  /* 准噶尔 */
+    "準備\0"  /* 准备 */
+    "準頭\0"  /* 准头 */
+    "準定\0"  /* 准定 */
+    "準平原\0"  /* 准平原 */
+    "準度\0"  /* 准度 */
+    "準式\0"  /* 准式 */
+    "準擬\0"  /* 准拟 */
+    "準拿督\0"  /* 准拿督 */
+    "準據\0"  /* 准据 */
+    "準新娘\0"  /* 准新娘 */
+    "準新郎\0"  /* 准新郎 */
+    "準時\0"  /* 准时 */
+    "準星\0"  /* 准星 */
+    "準是\0"  /* 准是 */
+    "準點\0"  /* 准点 */
+    "準的\0"  /* 准的 */
+    "準直\0"  /* 准直 */
+    "準確\0"  /* 准确 */
+    "準線\0"  /* 准线 */
+    "準繩\0"  /* 准绳 */
+    "準話\0"  /* 准话 */
+    "準譜\0"  /* 准谱 */
+    "準貨幣\0"  /* 准货币 */
+    "涼\0"  /* 凉 */
+    "涼麵\0"  /* 凉面 */
+    "凌濛初\0"  /* 凌蒙初 */
+    "減\0"  /* 减 */
+    "減肥藥\0"  /* 减肥药 */
+    "湊\0"  /* 凑 */
+    "凜\0"  /* 凛 */
+    "凝鍊\0"  /* 凝炼 */
+    "幾\0"  /* 几 */
+    "几上\0"  /* 几上 */
+    "几絲\0"  /* 几丝 */
+    "几淨窗明\0"  /* 几净窗明 */
+    "几几\0"  /* 几几 */
+    "几凳\0"  /* 几凳 */
+    "幾齣\0"  /* 几出 */
+    "幾隻\0"  /* 几只 */
+    "几子\0"  /* 几子 */
+    "几旁\0"  /* 几旁 */
+    "几杖\0"  /* 几杖 */
+    "几案\0"  /* 几案 */
+    "几椅\0"  /* 几椅 */
+    "几榻\0"  /* 几榻 */
+    "几筵\0"  /* 几筵 */
+    "几面上\0"  /* 几面上 */
+    "鳳\0"  /* 凤 */
+    "鳧\0"  /* 凫 */
+    "憑\0"  /* 凭 */
+    "憑藉\0"  /* 凭借 */
+    "憑藉著\0"  /* 凭借着 */
+    "憑準\0"  /* 凭准 */
+    "憑几\0"  /* 凭几 */
+    "憑弔\0"  /* 凭吊 */
+    "憑摺\0"  /* 凭折 */
+    "凱\0"  /* 凯 */
+    "兇刀\0"  /* 凶刀 */
+    "兇器\0"  /* 凶器 */
+    "兇嫌\0"  /* 凶嫌 */
+    "兇巴巴\0"  /* 凶巴巴 */
+    "兇徒\0"  /* 凶徒 */
+    "兇惡\0"  /* 凶恶 */
+    "兇悍\0"  /* 凶悍 */
+    "兇手\0"  /* 凶手 */
+    "兇殺\0"  /* 凶杀 */
+    "兇槍\0"  /* 凶枪 */
+    "兇案\0"  /* 凶案 */
+    "兇橫\0"  /* 凶横 */
+    "兇殘\0"  /* 凶残 */
+    "兇殘\0"  /* 凶殘 */
+    "兇殺\0"  /* 凶殺 */
+    "兇犯\0"  /* 凶犯 */
+    "兇狠\0"  /* 凶狠 */
+    "兇猛\0"  /* 凶猛 */
+    "兇疑\0"  /* 凶疑 */
+    "兇相\0"  /* 凶相 */
+    "兇險\0"  /* 凶险 */
+    "凹洞裡\0"  /* 凹洞里 */
+    "出醜\0"  /* 出丑 */
+    "齣兒\0"  /* 出儿 */
+    "齣劇\0"  /* 出剧 */
+    "齣動畫\0"  /* 出动画 */
+    "齣卡通\0"  /* 出卡通 */
+    "齣戲\0"  /* 出戏 */
+    "出遊\0"  /* 出游 */
+    "齣電影\0"  /* 出电影 */
+    "齣電視\0"  /* 出电视 */
+    "齣節目\0"  /* 出节目 */
+    "出鎚\0"  /* 出锤 */
+    "擊\0"  /* 击 */
+    "擊扑\0"  /* 击扑 */
+    "擊鐘\0"  /* 击钟 */
+    "鑿\0"  /* 凿 */
+    "分别致\0"  /* 分别致 */
+    "分半鐘\0"  /* 分半钟 */
+    "分佔\0"  /* 分占 */
+    "分多鐘\0"  /* 分多钟 */
+    "分子鐘\0"  /* 分子钟 */
+    "分鐘\0"  /* 分钟 */
+    "芻\0"  /* 刍 */
+    "刑餘\0"  /* 刑余 */
+    "劃\0"  /* 划 */
+    "划一槳\0"  /* 划一桨 */
+    "划上\0"  /* 划上 */
+    "划下\0"  /* 划下 */
+    "划不來\0"  /* 划不来 */
+    "划了\0"  /* 划了 */
+    "划具\0"  /* 划具 */
+    "划出\0"  /* 划出 */
+    "划到\0"  /* 划到 */
+    "划動\0"  /* 划动 */
+    "划去\0"  /* 划去 */
+    "划子\0"  /* 划子 */
+    "划得來\0"  /* 划得来 */
+    "划拳\0"  /* 划拳 */
+    "划來划去\0"  /* 划来划去 */
+    "划槳\0"  /* 划桨 */
+    "划水\0"  /* 划水 */
+    "划著\0"  /* 划着 */
+    "划算\0"  /* 划算 */
+    "划船\0"  /* 划船 */
+    "划艇\0"  /* 划艇 */
+    "划行\0"  /* 划行 */
+    "划走\0"  /* 划走 */
+    "划起\0"  /* 划起 */
+    "划過\0"  /* 划过 */
+    "划進\0"  /* 划进 */
+    "划龍舟\0"  /* 划龙舟 */
+    "劉\0"  /* 刘 */
+    "劉佳怜\0"  /* 刘佳怜 */
+    "劉克莊\0"  /* 刘克庄 */
+    "劉芸后\0"  /* 刘芸后 */
+    "則\0"  /* 则 */
+    "剛\0"  /* 刚 */
+    "剛乾\0"  /* 刚干 */
+    "剛纔一載\0"  /* 刚才一载 */
+    "剛僱\0"  /* 刚雇 */
+    "創\0"  /* 创 */
+    "創製\0"  /* 创制 */
+    "創穫\0"  /* 创获 */
+    "刪\0"  /* 删 */
+    "利慾\0"  /* 利欲 */
+    "別\0"  /* 别 */
+    "彆口氣\0"  /* 别口气 */
+    "別莊\0"  /* 别庄 */
+    "彆強\0"  /* 别强 */
+    "彆扭\0"  /* 别扭 */
+    "彆拗\0"  /* 别拗 */
+    "彆氣\0"  /* 别气 */
+    "別著\0"  /* 别着 */
+    "別緻\0"  /* 别致 */
+    "別闢\0"  /* 别辟 */
+    "剄\0"  /* 刭 */
+    "颳了\0"  /* 刮了 */
+    "颳倒\0"  /* 刮倒 */
+    "颳去\0"  /* 刮去 */
+    "颳得\0"  /* 刮得 */
+    "刮著\0"  /* 刮着 */
+    "刮鬍\0"  /* 刮胡 */
+    "颳走\0"  /* 刮走 */
+    "颳起\0"  /* 刮起 */
+    "颳雪\0"  /* 刮雪 */
+    "颳風\0"  /* 刮风 */
+    "製為\0"  /* 制为 */
+    "製件\0"  /* 制件 */
+    "製作\0"  /* 制作 */
+    "製做\0"  /* 制做 */
+    "製冰\0"  /* 制冰 */
+    "製冷\0"  /* 制冷 */
+    "製劑\0"  /* 制剂 */
+    "製取\0"  /* 制取 */
+    "製品\0"  /* 制品 */
+    "製圖\0"  /* 制图 */
+    "製備\0"  /* 制备 */
+    "製得\0"  /* 制得 */
+    "製成\0"  /* 制成 */
+    "製法\0"  /* 制法 */
+    "製漿\0"  /* 制浆 */
+    "製片\0"  /* 制片 */
+    "製版\0"  /* 制版 */
+    "製鹽\0"  /* 制盐 */
+    "製程\0"  /* 制程 */
+    "制籤\0"  /* 制签 */
+    "製糖\0"  /* 制糖 */
+    "製紙\0"  /* 制纸 */
+    "製藥\0"  /* 制药 */
+    "製表\0"  /* 制表 */
+    "製造\0"  /* 制造 */
+    "制鐘\0"  /* 制钟 */
+    "製革\0"  /* 制革 */
+    "製鞋\0"  /* 制鞋 */
+    "剎\0"  /* 刹 */
+    "刺繡\0"  /* 刺绣 */
+    "刻半鐘\0"  /* 刻半钟 */
+    "刻多鐘\0"  /* 刻多钟 */
+    "刻鐘\0"  /* 刻钟 */
+    "劊\0"  /* 刽 */
+    "劌\0"  /* 刿 */
+    "剴\0"  /* 剀 */
+    "劑\0"  /* 剂 */
+    "剃髮\0"  /* 剃发 */
+    "剃鬍\0"  /* 剃胡 */
+    "剃鬚\0"  /* 剃须 */
+    "削髮\0"  /* 削发 */
+    "削麵\0"  /* 削面 */
+    "剮\0"  /* 剐 */
+    "劍\0"  /* 剑 */
+    "剔莊貨\0"  /* 剔庄货 */
+    "剝\0"  /* 剥 */
+    "剝製\0"  /* 剥制 */
+    "劇\0"  /* 剧 */
+    "劇藥\0"  /* 剧药 */
+    "剩餘\0"  /* 剩余 */
+    "剪其髮\0"  /* 剪其发 */
+    "剪髮\0"  /* 剪发 */
+    "剪綵\0"  /* 剪彩 */
+    "割捨\0"  /* 割舍 */
+    "劉佳怜\0"  /* 劉佳怜 */
+    "力爭上遊\0"  /* 力争上游 */
+    "力剋制\0"  /* 力克制 */
+    "力拚\0"  /* 力拼 */
+    "力求剋制\0"  /* 力求克制 */
+    "勸\0"  /* 劝 */
+    "辦\0"  /* 办 */
+    "辦公檯\0"  /* 办公台 */
+    "功緻\0"  /* 功致 */
+    "加註\0"  /* 加注 */
+    "加藥\0"  /* 加药 */
+    "務\0"  /* 务 */
+    "勱\0"  /* 劢 */
+    "動\0"  /* 动 */
+    "動蕩\0"  /* 动荡 */
+    "劫餘\0"  /* 劫余 */
+    "勵\0"  /* 励 */
+    "勁\0"  /* 劲 */
+    "勞\0"  /* 劳 */
+    "勞力士錶\0"  /* 劳力士表 */
+    "勢\0"  /* 势 */
+    "勃鬱\0"  /* 勃郁 */
+    "勛\0"  /* 勋 */
+    "勳章\0"  /* 勋章 */
+    "勤僕\0"  /* 勤仆 */
+    "勤樸\0"  /* 勤朴 */
+    "勺藥\0"  /* 勺药 */
+    "勾幹\0"  /* 勾干 */
+    "勾心鬥角\0"  /* 勾心斗角 */
+    "勾魂蕩魄\0"  /* 勾魂荡魄 */
+    "勻\0"  /* 匀 */
+    "包準\0"  /* 包准 */
+    "包莊\0"  /* 包庄 */
+    "包紮\0"  /* 包扎 */
+    "包穀\0"  /* 包谷 */
+    "匏繫\0"  /* 匏系 */
+    "北迴線\0"  /* 北回线 */
+    "北迴鐵路\0"  /* 北回铁路 */
+    "北嶽\0"  /* 北岳 */
+    "匡複\0"  /* 匡复 */
+    "匭\0"  /* 匦 */
+    "匪幹\0"  /* 匪干 */
+    "匱\0"  /* 匮 */
+    "區\0"  /* 区 */
+    "醫\0"  /* 医 */
+    "醫藥\0"  /* 医药 */
+    "醫院裡\0"  /* 医院里 */
+    "十餘\0"  /* 十余 */
+    "十齣\0"  /* 十出 */
+    "十隻\0"  /* 十只 */
+    "十紮\0"  /* 十扎 */
+    "千餘\0"  /* 千余 */
+    "千隻\0"  /* 千只 */
+    "千迴百折\0"  /* 千回百折 */
+    "千迴百轉\0"  /* 千回百转 */
+    "千紮\0"  /* 千扎 */
+    "千鈞一髮\0"  /* 千钧一发 */
+    "陞官\0"  /* 升官 */
+    "昇平\0"  /* 升平 */
+    "昇陽\0"  /* 升阳 */
+    "半隻\0"  /* 半只 */
+    "華\0"  /* 华 */
+    "華嚴鐘\0"  /* 华严钟 */
+    "華髮\0"  /* 华发 */
+    "協\0"  /* 协 */
+    "單\0"  /* 单 */
+    "單于\0"  /* 单于 */
+    "單幹\0"  /* 单干 */
+    "單打獨鬥\0"  /* 单打独斗 */
+    "賣\0"  /* 卖 */
+    "賣獃\0"  /* 卖呆 */
+    "南京鐘\0"  /* 南京钟 */
+    "南迴線\0"  /* 南回线 */
+    "南迴鐵路\0"  /* 南回铁路 */
+    "南宮适\0"  /* 南宫适 */
+    "南嶽\0"  /* 南岳 */
+    "南遊\0"  /* 南游 */
+    "南筑\0"  /* 南筑 */
+    "博彙\0"  /* 博汇 */
+    "博採\0"  /* 博采 */
+    "卜云吉\0"  /* 卜云吉 */
+    "卞莊\0"  /* 卞庄 */
+    "佔〇\0"  /* 占〇 */
+    "佔一\0"  /* 占一 */
+    "佔七\0"  /* 占七 */
+    "佔万\0"  /* 占万 */
+    "佔三\0"  /* 占三 */
+    "佔上風\0"  /* 占上风 */
+    "佔下\0"  /* 占下 */
+    "佔不佔\0"  /* 占不占 */
+    "佔不足\0"  /* 占不足 */
+    "佔世界\0"  /* 占世界 */
+    "佔東\0"  /* 占东 */
+    "佔兩\0"  /* 占两 */
+    "佔個\0"  /* 占个 */
+    "佔中\0"  /* 占中 */
+    "佔為\0"  /* 占为 */
+    "佔主\0"  /* 占主 */
+    "佔九\0"  /* 占九 */
+    "佔了\0"  /* 占了 */
+    "佔二\0"  /* 占二 */
+    "佔五\0"  /* 占五 */
+    "佔人便宜\0"  /* 占人便宜 */
+    "佔億\0"  /* 占亿 */
+    "佔優\0"  /* 占优 */
+    "佔位\0"  /* 占位 */
+    "佔住\0"  /* 占住 */
+    "佔便宜\0"  /* 占便宜 */
+    "占便宜的是獃\0"  /* 占便宜的是呆 */
+    "佔俄\0"  /* 占俄 */
+    "佔停車\0"  /* 占停车 */
+    "佔先\0"  /* 占先 */
+    "佔光\0"  /* 占光 */
+    "佔全\0"  /* 占全 */
+    "佔八\0"  /* 占八 */
+    "佔六\0"  /* 占六 */
+    "佔分\0"  /* 占分 */
+    "佔到\0"  /* 占到 */
+    "佔加\0"  /* 占加 */
+    "佔劣\0"  /* 占劣 */
+    "佔北\0"  /* 占北 */
+    "佔十\0"  /* 占十 */
+    "佔千\0"  /* 占千 */
+    "佔半\0"  /* 占半 */
+    "佔南\0"  /* 占南 */
+    "佔佔\0"  /* 占占 */
+    "佔印\0"  /* 占印 */
+    "佔壓\0"  /* 占压 */
+    "佔去\0"  /* 占去 */
+    "佔取\0"  /* 占取 */
+    "佔台\0"  /* 占台 */
+    "佔後\0"  /* 占后 */
+    "佔哺乳\0"  /* 占哺乳 */
+    "佔囁\0"  /* 占嗫 */
+    "佔四\0"  /* 占四 */
+    "佔國內\0"  /* 占国内 */
+    "佔在\0"  /* 占在 */
+    "佔地\0"  /* 占地 */
+    "佔場\0"  /* 占场 */
+    "佔多\0"  /* 占多 */
+    "佔大\0"  /* 占大 */
+    "佔頭\0"  /* 占头 */
+    "佔好\0"  /* 占好 */
+    "佔小\0"  /* 占小 */
+    "佔少\0"  /* 占少 */
+    "佔盡\0"  /* 占尽 */
+    "佔局部\0"  /* 占局部 */
+    "佔屋\0"  /* 占屋 */
+    "佔山\0"  /* 占山 */
+    "佔市場\0"  /* 占市场 */
+    "佔平均\0"  /* 占平均 */
+    "佔床\0"  /* 占床 */
+    "佔座\0"  /* 占座 */
+    "佔得\0"  /* 占得 */
+    "佔德\0"  /* 占德 */
+    "佔總\0"  /* 占总 */
+    "佔據\0"  /* 占据 */
+    "佔掉\0"  /* 占掉 */
+    "佔整體\0"  /* 占整体 */
+    "佔新\0"  /* 占新 */
+    "佔有\0"  /* 占有 */
+    "佔有慾\0"  /* 占有欲 */
+    "佔查\0"  /* 占查 */
+    "佔次\0"  /* 占次 */
+    "佔比\0"  /* 占比 */
+    "佔畢\0"  /* 占毕 */
+    "佔法\0"  /* 占法 */
+    "佔滿\0"  /* 占满 */
+    "佔澳\0"  /* 占澳 */
+    "佔率\0"  /* 占率 */
+    "佔用\0"  /* 占用 */
+    "佔百\0"  /* 占百 */
+    "佔著\0"  /* 占着 */
+    "佔穩\0"  /* 占稳 */
+    "佔線\0"  /* 占线 */
+    "佔缺\0"  /* 占缺 */
+    "佔網\0"  /* 占网 */
+    "佔美\0"  /* 占美 */
+    "佔耕\0"  /* 占耕 */
+    "佔至多\0"  /* 占至多 */
+    "佔至少\0"  /* 占至少 */
+    "佔蘇\0"  /* 占苏 */
+    "佔英\0"  /* 占英 */
+    "佔葡\0"  /* 占葡 */
+    "佔西\0"  /* 占西 */
+    "佔資源\0"  /* 占资源 */
+    "佔起\0"  /* 占起 */
+    "佔超過\0"  /* 占超过 */
+    "佔過\0"  /* 占过 */
+    "佔道\0"  /* 占道 */
+    "佔零\0"  /* 占零 */
+    "佔領\0"  /* 占領 */
+    "佔領\0"  /* 占领 */
+    "佔飯\0"  /* 占饭 */
+    "佔香\0"  /* 占香 */
+    "佔馬\0"  /* 占马 */
+    "佔高枝兒\0"  /* 占高枝儿 */
+    "盧\0"  /* 卢 */
+    "盧稜伽\0"  /* 卢棱伽 */
+    "鹵\0"  /* 卤 */
+    "滷製\0"  /* 卤制 */
+    "滷味\0"  /* 卤味 */
+    "滷水\0"  /* 卤水 */
+    "滷汁\0"  /* 卤汁 */
+    "滷湖\0"  /* 卤湖 */
+    "滷肉\0"  /* 卤肉 */
+    "滷菜\0"  /* 卤菜 */
+    "滷蛋\0"  /* 卤蛋 */
+    "滷麵\0"  /* 卤面 */
+    "滷雞\0"  /* 卤鸡 */
+    "臥遊\0"  /* 卧游 */
+    "衛\0"  /* 卫 */
+    "衛後莊公\0"  /* 卫后庄公 */
+    "衛星鐘\0"  /* 卫星钟 */
+    "印製\0"  /* 印制 */
+    "印纍綬若\0"  /* 印累绶若 */
+    "卻\0"  /* 却 */
+    "卵與石鬥\0"  /* 卵与石斗 */
+    "捲雲\0"  /* 卷云 */
+    "捲住\0"  /* 卷住 */
+    "捲兒\0"  /* 卷儿 */
+    "捲入\0"  /* 卷入 */
+    "捲動\0"  /* 卷动 */
+    "捲去\0"  /* 卷去 */
+    "捲髮\0"  /* 卷发 */
+    "捲圖\0"  /* 卷图 */
+    "捲土重來\0"  /* 卷土重来 */
+    "捲尺\0"  /* 卷尺 */
+    "捲簾\0"  /* 卷帘 */
+    "捲心菜\0"  /* 卷心菜 */
+    "捲成\0"  /* 卷成 */
+    "捲曲\0"  /* 卷曲 */
+    "捲來\0"  /* 卷来 */
+    "捲款\0"  /* 卷款 */
+    "捲毛\0"  /* 卷毛 */
+    "捲煙\0"  /* 卷烟 */
+    "捲筒\0"  /* 卷筒 */
+    "捲紙\0"  /* 卷纸 */
+    "捲縮\0"  /* 卷缩 */
+    "捲舌\0"  /* 卷舌 */
+    "捲舖蓋\0"  /* 卷舖盖 */
+    "捲菸\0"  /* 卷菸 */
+    "捲袖\0"  /* 卷袖 */
+    "捲走\0"  /* 卷走 */
+    "捲起\0"  /* 卷起 */
+    "捲軸\0"  /* 卷轴 */
+    "捲逃\0"  /* 卷逃 */
+    "捲鋪蓋\0"  /* 卷铺盖 */
+    "卷鬚\0"  /* 卷须 */
+    "捲風\0"  /* 卷风 */
+    "巹\0"  /* 卺 */
+    "廠\0"  /* 厂 */
+    "厂部\0"  /* 厂部 */
+    "廳\0"  /* 厅 */
+    "歷\0"  /* 历 */
+    "曆書\0"  /* 历书 */
+    "曆元\0"  /* 历元 */
+    "歷史裡\0"  /* 历史里 */
+    "曆命\0"  /* 历命 */
+    "曆始\0"  /* 历始 */
+    "曆室\0"  /* 历室 */
+    "曆尾\0"  /* 历尾 */
+    "曆數\0"  /* 历数 */
+    "曆日\0"  /* 历日 */
+    "曆本\0"  /* 历本 */
+    "曆法\0"  /* 历法 */
+    "厤物之意\0"  /* 历物之意 */
+    "曆獄\0"  /* 历狱 */
+    "曆紀\0"  /* 历纪 */
+    "曆象\0"  /* 历象 */
+    "厲\0"  /* 厉 */
+    "壓\0"  /* 压 */
+    "厭\0"  /* 厌 */
+    "厙\0"  /* 厍 */
+    "廁\0"  /* 厕 */
+    "釐出\0"  /* 厘出 */
+    "釐升\0"  /* 厘升 */
+    "釐定\0"  /* 厘定 */
+    "釐正\0"  /* 厘正 */
+    "釐清\0"  /* 厘清 */
+    "釐訂\0"  /* 厘订 */
+    "原子鐘\0"  /* 原子钟 */
+    "原鐘\0"  /* 原钟 */
+    "廂\0"  /* 厢 */
+    "厴\0"  /* 厣 */
+    "廈\0"  /* 厦 */
+    "廚\0"  /* 厨 */
+    "廚餘\0"  /* 厨余 */
+    "廄\0"  /* 厩 */
+    "廝\0"  /* 厮 */
+    "廝鬥\0"  /* 厮斗 */
+    "縣\0"  /* 县 */
+    "縣誌\0"  /* 县志 */
+    "縣裡\0"  /* 县里 */
+    "參\0"  /* 参 */
+    "蔘綏\0"  /* 参绥 */
+    "雙\0"  /* 双 */
+    "雙摺\0"  /* 双折 */
+    "雙胜類\0"  /* 双胜类 */
+    "雙鵰\0"  /* 双雕 */
+    "反衝\0"  /* 反冲 */
+    "反覆\0"  /* 反复 */
+    "反複製\0"  /* 反复制 */
+    "反樸\0"  /* 反朴 */
+    "發\0"  /* 发 */
+    "髮上沖冠\0"  /* 发上冲冠 */
+    "髮上指冠\0"  /* 发上指冠 */
+    "髮絲\0"  /* 发丝 */
+    "髮為血之本\0"  /* 发为血之本 */
+    "髮乳\0"  /* 发乳 */
+    "髮光可鑑\0"  /* 发光可鉴 */
+    "髮匪\0"  /* 发匪 */
+    "髮捲\0"  /* 发卷 */
+    "發獃\0"  /* 发呆 */
+    "髮型\0"  /* 发型 */
+    "髮夾\0"  /* 发夹 */
+    "髮妻\0"  /* 发妻 */
+    "髮姐\0"  /* 发姐 */
+    "髮屋\0"  /* 发屋 */
+    "髮已霜白\0"  /* 发已霜白 */
+    "髮帶\0"  /* 发带 */
+    "發乾\0"  /* 发干 */
+    "發莊\0"  /* 发庄 */
+    "髮廊\0"  /* 发廊 */
+    "髮式\0"  /* 发式 */
+    "髮引千鈞\0"  /* 发引千钧 */
+    "髮指\0"  /* 发指 */
+    "發鬆\0"  /* 发松 */
+    "髮根\0"  /* 发根 */
+    "發汗藥\0"  /* 发汗药 */
+    "髮油\0"  /* 发油 */
+    "髮漂\0"  /* 发漂 */
+    "髮狀\0"  /* 发状 */
+    "髮癬\0"  /* 发癣 */
+    "發著\0"  /* 发着 */
+    "髮短心長\0"  /* 发短心长 */
+    "髮禁\0"  /* 发禁 */
+    "髮箋\0"  /* 发笺 */
+    "發籤\0"  /* 发签 */
+    "髮紗\0"  /* 发纱 */
+    "髮結\0"  /* 发结 */
+    "髮網\0"  /* 发网 */
+    "髮膚\0"  /* 发肤 */
+    "髮膠\0"  /* 发胶 */
+    "髮腳\0"  /* 发脚 */
+    "髮菜\0"  /* 发菜 */
+    "發矇\0"  /* 发蒙 */
+    "髮蠟\0"  /* 发蜡 */
+    "髮踊沖冠\0"  /* 发踊冲冠 */
+    "髮辮\0"  /* 发辫 */
+    "髮針\0"  /* 发针 */
+    "髮釵\0"  /* 发钗 */
+    "髮長\0"  /* 发长 */
+    "髮際\0"  /* 发际 */
+    "髮雕\0"  /* 发雕 */
+    "髮霜\0"  /* 发霜 */
+    "發麵\0"  /* 发面 */
+    "髮飾\0"  /* 发饰 */
+    "髮髻\0"  /* 发髻 */
+    "髮鬢\0"  /* 发鬓 */
+    "取捨\0"  /* 取舍 */
+    "受託\0"  /* 受托 */
+    "變\0"  /* 变 */
+    "變醜\0"  /* 变丑 */
+    "變徵\0"  /* 变征 */
+    "變髒\0"  /* 变脏 */
+    "敘\0"  /* 叙 */
+    "疊\0"  /* 叠 */
+    "口乾\0"  /* 口干 */
+    "口腹之慾\0"  /* 口腹之欲 */
+    "口裡\0"  /* 口里 */
+    "口鐘\0"  /* 口钟 */
+    "古書云\0"  /* 古书云 */
+    "古書云\0"  /* 古書云 */
+    "古樸\0"  /* 古朴 */
+    "古柯鹹\0"  /* 古柯咸 */
+    "古語云\0"  /* 古語云 */
+    "古迹\0"  /* 古迹 */
+    "古鐘\0"  /* 古钟 */
+    "古鐘錶\0"  /* 古钟表 */
+    "另闢\0"  /* 另辟 */
+    "叩鐘\0"  /* 叩钟 */
+    "只衝\0"  /* 只冲 */
+    "只佔\0"  /* 只占 */
+    "隻字\0"  /* 只字 */
+    "隻影\0"  /* 只影 */
+    "隻手遮天\0"  /* 只手遮天 */
+    "隻眼\0"  /* 只眼 */
+    "隻言片語\0"  /* 只言片语 */
+    "隻身\0"  /* 只身 */
+    "只採\0"  /* 只采 */
+    "叮叮噹噹\0"  /* 叮叮当当 */
+    "叮噹\0"  /* 叮当 */
+    "可以剋制\0"  /* 可以克制 */
+    "可緊可鬆\0"  /* 可紧可松 */
+    "檯子\0"  /* 台子 */
+    "檯布\0"  /* 台布 */
+    "檯燈\0"  /* 台灯 */
+    "檯球\0"  /* 台球 */
+    "台鐘\0"  /* 台钟 */
+    "檯面\0"  /* 台面 */
+    "颱風\0"  /* 台风 */
+    "叱咤樂壇\0"  /* 叱咤乐坛 */
+    "叱咤叱叱咤\0"  /* 叱咤叱叱咤 */
+    "叱咤咤\0"  /* 叱咤咤 */
+    "叱咤樂壇\0"  /* 叱咤樂壇 */
+    "葉\0"  /* 叶 */
+    "叶不二子\0"  /* 叶不二子 */
+    "葉叶琴\0"  /* 叶叶琴 */
+    "叶志穗\0"  /* 叶志穗 */
+    "叶恭弘\0"  /* 叶恭弘 */
+    "叶音\0"  /* 叶音 */
+    "叶韻\0"  /* 叶韵 */
+    "號\0"  /* 号 */
+    "號誌\0"  /* 号志 */
+    "嘆\0"  /* 叹 */
+    "嘰\0"  /* 叽 */
+    "籲天\0"  /* 吁天 */
+    "籲求\0"  /* 吁求 */
+    "籲請\0"  /* 吁请 */
+    "吃薑\0"  /* 吃姜 */
+    "吃板刀麵\0"  /* 吃板刀面 */
+    "吃著不盡\0"  /* 吃着不尽 */
+    "吃藥\0"  /* 吃药 */
+    "吃辣麵\0"  /* 吃辣面 */
+    "吃裡扒外\0"  /* 吃里扒外 */
+    "吃裡爬外\0"  /* 吃里爬外 */
+    "吃錯藥\0"  /* 吃错药 */
+    "各類鐘\0"  /* 各类钟 */
+    "各闢\0"  /* 各辟 */
+    "合夥\0"  /* 合伙 */
+    "合準\0"  /* 合准 */
+    "合曆\0"  /* 合历 */
+    "合併\0"  /* 合并 */
+    "閤府\0"  /* 合府 */
+    "合著\0"  /* 合着 */
+    "合採\0"  /* 合采 */
+    "弔喪\0"  /* 吊丧 */
+    "弔書\0"  /* 吊书 */
+    "弔兒郎當\0"  /* 吊儿郎当 */
+    "弔卷\0"  /* 吊卷 */
+    "弔取\0"  /* 吊取 */
+    "弔古\0"  /* 吊古 */
+    "弔唁\0"  /* 吊唁 */
+    "弔喉\0"  /* 吊喉 */
+    "弔喭\0"  /* 吊喭 */
+    "弔場\0"  /* 吊场 */
+    "弔頭\0"  /* 吊头 */
+    "弔奠\0"  /* 吊奠 */
+    "弔孝\0"  /* 吊孝 */
+    "弔客\0"  /* 吊客 */
+    "弔宴\0"  /* 吊宴 */
+    "弔帶\0"  /* 吊带 */
+    "弔影\0"  /* 吊影 */
+    "弔慰\0"  /* 吊慰 */
+    "弔扣\0"  /* 吊扣 */
+    "弔拷\0"  /* 吊拷 */
+    "弔拷繃扒\0"  /* 吊拷绷扒 */
+    "弔掛\0"  /* 吊挂 */
+    "吊掛著\0"  /* 吊挂着 */
+    "弔撒\0"  /* 吊撒 */
+    "弔文\0"  /* 吊文 */
+    "弔旗\0"  /* 吊旗 */
+    "吊杆\0"  /* 吊杆 */
+    "弔橋\0"  /* 吊桥 */
+    "弔死\0"  /* 吊死 */
+    "弔民\0"  /* 吊民 */
+    "吊著\0"  /* 吊着 */
+    "弔祭\0"  /* 吊祭 */
+    "弔紙\0"  /* 吊纸 */
+    "弔者大悅\0"  /* 吊者大悦 */
+    "弔腳兒事\0"  /* 吊脚儿事 */
+    "弔腰撒跨\0"  /* 吊腰撒跨 */
+    "弔膀子\0"  /* 吊膀子 */
+    "弔詞\0"  /* 吊词 */
+    "弔詭\0"  /* 吊诡 */
+    "弔謊\0"  /* 吊谎 */
+    "弔賀迎送\0"  /* 吊贺迎送 */
+    "吊鐘\0"  /* 吊钟 */
+    "弔問\0"  /* 吊问 */
+    "弔頸\0"  /* 吊颈 */
+    "弔鶴\0"  /* 吊鹤 */
+    "同夥\0"  /* 同伙 */
+    "同餘\0"  /* 同余 */
+    "後\0"  /* 后 */
+    "后豐\0"  /* 后丰 */
+    "后冠\0"  /* 后冠 */
+    "后北街\0"  /* 后北街 */
+    "后髮座\0"  /* 后发座 */
+    "后髮星系團\0"  /* 后发星系团 */
+    "后土\0"  /* 后土 */
+    "后妃\0"  /* 后妃 */
+    "后安路\0"  /* 后安路 */
+    "后平路\0"  /* 后平路 */
+    "后座\0"  /* 后座 */
+    "后海灣\0"  /* 后海湾 */
+    "后海灣\0"  /* 后海灣 */
+    "后瑞站\0"  /* 后瑞站 */
+    "后稷\0"  /* 后稷 */
+    "后羿\0"  /* 后羿 */
+    "后街\0"  /* 后街 */
+    "后角\0"  /* 后角 */
+    "后豐\0"  /* 后豐 */
+    "后里\0"  /* 后里 */
+    "后髮座\0"  /* 后髮座 */
+    "后髮星系團\0"  /* 后髮星系團 */
+    "嚮導\0"  /* 向导 */
+    "嚮應\0"  /* 向应 */
+    "嚮往\0"  /* 向往 */
+    "向著\0"  /* 向着 */
+    "嚮邇\0"  /* 向迩 */
+    "嚇\0"  /* 吓 */
+    "呂\0"  /* 吕 */
+    "呂后\0"  /* 吕后 */
+    "嗎\0"  /* 吗 */
+    "吞併\0"  /* 吞并 */
+    "吟遊\0"  /* 吟游 */
+    "唚\0"  /* 吣 */
+    "噸\0"  /* 吨 */
+    "含齒戴髮\0"  /* 含齿戴发 */
+    "聽\0"  /* 听 */
+    "啟\0"  /* 启 */
+    "吳\0"  /* 吴 */
+    "吹髮\0"  /* 吹发 */
+    "吹乾\0"  /* 吹干 */
+    "吹鬍\0"  /* 吹胡 */
+    "呂后\0"  /* 呂后 */
+    "獃串了皮\0"  /* 呆串了皮 */
+    "獃事\0"  /* 呆事 */
+    "獃人\0"  /* 呆人 */
+    "獃獃\0"  /* 呆呆 */
+    "獃頭\0"  /* 呆头 */
+    "獃子\0"  /* 呆子 */
+    "獃性\0"  /* 呆性 */
+    "獃想\0"  /* 呆想 */
+    "獃憨獃\0"  /* 呆憨呆 */
+    "獃根\0"  /* 呆根 */
+    "獃氣\0"  /* 呆气 */
+    "獃滯\0"  /* 呆滞 */
+    "獃痴\0"  /* 呆痴 */
+    "獃著\0"  /* 呆着 */
+    "獃磕\0"  /* 呆磕 */
+    "獃等\0"  /* 呆等 */
+    "獃腦\0"  /* 呆脑 */
+    "呆緻緻\0"  /* 呆致致 */
+    "獃話\0"  /* 呆话 */
+    "呆裡呆氣\0"  /* 呆里呆气 */
+    "吶\0"  /* 呐 */
+    "嘸\0"  /* 呒 */
+    "囈\0"  /* 呓 */
+    "嘔\0"  /* 呕 */
+    "嚦\0"  /* 呖 */
+    "唄\0"  /* 呗 */
+    "唄讚\0"  /* 呗赞 */
+    "員\0"  /* 员 */
+    "咼\0"  /* 呙 */
+    "嗆\0"  /* 呛 */
+    "嗚\0"  /* 呜 */
+    "周曆\0"  /* 周历 */
+    "周后\0"  /* 周后 */
+    "周莊王\0"  /* 周庄王 */
+    "周杰倫\0"  /* 周杰倫 */
+    "周遊\0"  /* 周游 */
+    "週遊世界\0"  /* 周游世界 */
+    "呼籲\0"  /* 呼吁 */
+    "和剋制\0"  /* 和克制 */
+    "和姦\0"  /* 和奸 */
+    "咎徵\0"  /* 咎征 */
+    "詠\0"  /* 咏 */
+    "咕咕鐘\0"  /* 咕咕钟 */
+    "嚨\0"  /* 咙 */
+    "嚀\0"  /* 咛 */
+    "吒\0"  /* 咤 */
+    "諮詢\0"  /* 咨询 */
+    "咬薑呷醋\0"  /* 咬姜呷醋 */
+    "咯噹\0"  /* 咯当 */
+    "咳嗽藥\0"  /* 咳嗽药 */
+    "鹹鹵\0"  /* 咸卤 */
+    "鹹味\0"  /* 咸味 */
+    "鹹鹹\0"  /* 咸咸 */
+    "鹹嘴淡舌\0"  /* 咸嘴淡舌 */
+    "鹹土\0"  /* 咸土 */
+    "鹹度\0"  /* 咸度 */
+    "鹹得\0"  /* 咸得 */
+    "鹹批\0"  /* 咸批 */
+    "鹹水\0"  /* 咸水 */
+    "鹹湯\0"  /* 咸汤 */
+    "鹹派\0"  /* 咸派 */
+    "鹹海\0"  /* 咸海 */
+    "鹹淡\0"  /* 咸淡 */
+    "鹹湖\0"  /* 咸湖 */
+    "鹹潟\0"  /* 咸潟 */
+    "鹹豬肉\0"  /* 咸猪肉 */
+    "鹹的\0"  /* 咸的 */
+    "鹹類\0"  /* 咸类 */
+    "鹹粥\0"  /* 咸粥 */
+    "鹹肉\0"  /* 咸肉 */
+    "鹹菜\0"  /* 咸菜 */
+    "鹹菜乾\0"  /* 咸菜干 */
+    "鹹蛋\0"  /* 咸蛋 */
+    "鹹食\0"  /* 咸食 */
+    "鹹魚\0"  /* 咸鱼 */
+    "鹹鴨蛋\0"  /* 咸鸭蛋 */
+    "哀弔\0"  /* 哀吊 */
+    "哀輓\0"  /* 哀挽 */
+    "品彙\0"  /* 品汇 */
+    "鬨動\0"  /* 哄动 */
+    "鬨堂\0"  /* 哄堂 */
+    "鬨笑\0"  /* 哄笑 */
+    "響\0"  /* 响 */
+    "響鐘\0"  /* 响钟 */
+    "啞\0"  /* 哑 */
+    "噠\0"  /* 哒 */
+    "嘵\0"  /* 哓 */
+    "嗶\0"  /* 哔 */
+    "噦\0"  /* 哕 */
+    "嘩\0"  /* 哗 */
+    "噲\0"  /* 哙 */
+    "嚌\0"  /* 哜 */
+    "噥\0"  /* 哝 */
+    "喲\0"  /* 哟 */
+    "哪裡\0"  /* 哪里 */
+    "哭髒\0"  /* 哭脏 */
+    "唁弔\0"  /* 唁吊 */
+    "唇乾\0"  /* 唇干 */
+    "嘜\0"  /* 唛 */
+    "嘮\0"  /* 唠 */
+    "嗩\0"  /* 唢 */
+    "喚\0"  /* 唤 */
+    "唱遊\0"  /* 唱游 */
+    "唾餘\0"  /* 唾余 */
+    "唾面自乾\0"  /* 唾面自干 */
+    "商曆\0"  /* 商历 */
+    "嘖\0"  /* 啧 */
+    "嗇\0"  /* 啬 */
+    "囀\0"  /* 啭 */
+    "嚙\0"  /* 啮 */
+    "啷噹\0"  /* 啷当 */
+    "嘯\0"  /* 啸 */
+    "餵乳\0"  /* 喂乳 */
+    "餵了\0"  /* 喂了 */
+    "餵養\0"  /* 喂养 */
+    "餵奶\0"  /* 喂奶 */
+    "餵豬\0"  /* 喂猪 */
+    "餵給\0"  /* 喂给 */
+    "餵羊\0"  /* 喂羊 */
+    "餵過\0"  /* 喂过 */
+    "餵食\0"  /* 喂食 */
+    "餵飽\0"  /* 喂饱 */
+    "餵驢\0"  /* 喂驴 */
+    "餵魚\0"  /* 喂鱼 */
+    "餵雞\0"  /* 喂鸡 */
+    "餵鴨\0"  /* 喂鸭 */
+    "餵鵝\0"  /* 喂鹅 */
+    "喜歡錶\0"  /* 喜欢表 */
+    "喜歡鐘\0"  /* 喜欢钟 */
+    "喝乾\0"  /* 喝干 */
+    "喧鬨\0"  /* 喧哄 */
+    "噴\0"  /* 喷 */
+    "噴洒\0"  /* 喷洒 */
+    "嘍\0"  /* 喽 */
+    "嚳\0"  /* 喾 */
+    "嗑藥\0"  /* 嗑药 */
+    "囁\0"  /* 嗫 */
+    "噯\0"  /* 嗳 */
+    "嘀嗒的錶\0"  /* 嘀嗒的表 */
+    "嘉肴\0"  /* 嘉肴 */
+    "嘉穀\0"  /* 嘉谷 */
+    "噓\0"  /* 嘘 */
+    "嚶\0"  /* 嘤 */
+    "囑\0"  /* 嘱 */
+    "囑託\0"  /* 嘱托 */
+    "嘴裡\0"  /* 嘴里 */
+    "噙齒戴髮\0"  /* 噙齿戴发 */
+    "嚕\0"  /* 噜 */
+    "嚕囌\0"  /* 噜苏 */
+    "囂\0"  /* 嚣 */
+    "嚼穀\0"  /* 嚼谷 */
+    "囉囉囌囌\0"  /* 囉囉苏苏 */
+    "囉囌\0"  /* 囉苏 */
+    "四餘\0"  /* 四余 */
+    "四齣\0"  /* 四出 */
+    "四出徵收\0"  /* 四出征收 */
+    "四分曆\0"  /* 四分历 */
+    "四隻\0"  /* 四只 */
+    "四紮\0"  /* 四扎 */
+    "四捨五入\0"  /* 四舍五入 */
+    "四捨六入\0"  /* 四舍六入 */
+    "四面鐘\0"  /* 四面钟 */
+    "迴光返照\0"  /* 回光返照 */
+    "回曆\0"  /* 回历 */
+    "迴向\0"  /* 回向 */
+    "迴響\0"  /* 回响 */
+    "迴圈\0"  /* 回圈 */
+    "迴廊\0"  /* 回廊 */
+    "迴形夾\0"  /* 回形夹 */
+    "迴文\0"  /* 回文 */
+    "迴旋\0"  /* 回旋 */
+    "迴流\0"  /* 回流 */
+    "回遊\0"  /* 回游 */
+    "迴環\0"  /* 回环 */
+    "回著\0"  /* 回着 */
+    "迴紋針\0"  /* 回纹针 */
+    "迴繞\0"  /* 回绕 */
+    "迴翔\0"  /* 回翔 */
+    "迴腸\0"  /* 回肠 */
+    "回蕩\0"  /* 回荡 */
+    "迴誦\0"  /* 回诵 */
+    "迴路\0"  /* 回路 */
+    "迴轉\0"  /* 回转 */
+    "迴遞性\0"  /* 回递性 */
+    "迴避\0"  /* 回避 */
+    "回採\0"  /* 回采 */
+    "迴鑾\0"  /* 回銮 */
+    "回陽蕩氣\0"  /* 回阳荡气 */
+    "迴音\0"  /* 回音 */
+    "迴風\0"  /* 回风 */
+    "團\0"  /* 团 */
+    "糰子\0"  /* 团子 */
+    "園\0"  /* 园 */
+    "園遊會\0"  /* 园游会 */
+    "園裡\0"  /* 园里 */
+    "睏乏\0"  /* 困乏 */
+    "睏倦\0"  /* 困倦 */
+    "困獸之鬥\0"  /* 困兽之斗 */
+    "困獸猶鬥\0"  /* 困兽犹斗 */
+    "困鬥\0"  /* 困斗 */
+    "睏覺\0"  /* 困觉 */
+    "囪\0"  /* 囱 */
+    "圍\0"  /* 围 */
+    "圇\0"  /* 囵 */
+    "固徵\0"  /* 固征 */
+    "國\0"  /* 国 */
+    "國之楨榦\0"  /* 国之桢干 */
+    "國讎\0"  /* 国仇 */
+    "國曆\0"  /* 国历 */
+    "圖\0"  /* 图 */
+    "圖裡\0"  /* 图里 */
+    "圖鑑\0"  /* 图鉴 */
+    "圓\0"  /* 圆 */
+    "圈佔\0"  /* 圈占 */
+    "圈子裡\0"  /* 圈子里 */
+    "圈樑\0"  /* 圈梁 */
+    "圈裡\0"  /* 圈里 */
+    "土製\0"  /* 土制 */
+    "土裡\0"  /* 土里 */
+    "聖\0"  /* 圣 */
+    "聖后\0"  /* 圣后 */
+    "在剋制\0"  /* 在克制 */
+    "地醜德齊\0"  /* 地丑德齐 */
+    "地剋制\0"  /* 地克制 */
+    "地佔\0"  /* 地占 */
+    "地心曆表\0"  /* 地心历表 */
+    "地誌\0"  /* 地志 */
+    "壙\0"  /* 圹 */
+    "場\0"  /* 场 */
+    "壞\0"  /* 坏 */
+    "坏於\0"  /* 坏于 */
+    "坐如鐘\0"  /* 坐如钟 */
+    "坐莊\0"  /* 坐庄 */
+    "坐鐘\0"  /* 坐钟 */
+    "坑裡\0"  /* 坑里 */
+    "塊\0"  /* 块 */
+    "堅\0"  /* 坚 */
+    "堅緻\0"  /* 坚致 */
+    "壇\0"  /* 坛 */
+    "罈罈罐罐\0"  /* 坛坛罐罐 */
+    "罈子\0"  /* 坛子 */
+    "罈騞\0"  /* 坛騞 */
+    "壢\0"  /* 坜 */
+    "壩\0"  /* 坝 */
+    "塢\0"  /* 坞 */
+    "墳\0"  /* 坟 */
+    "墜\0"  /* 坠 */
+    "坤範\0"  /* 坤范 */
+    "坦蕩\0"  /* 坦荡 */
+    "坦蕩蕩\0"  /* 坦荡荡 */
+    "坱鬱\0"  /* 坱郁 */
+    "垂髮\0"  /* 垂发 */
+    "垂範\0"  /* 垂范 */
+    "壟\0"  /* 垄 */
+    "壚\0"  /* 垆 */
+    "型範\0"  /* 型范 */
+    "壘\0"  /* 垒 */
+    "墾\0"  /* 垦 */
+    "墾複\0"  /* 垦复 */
+    "墾闢\0"  /* 垦辟 */
+    "堊\0"  /* 垩 */
+    "墊\0"  /* 垫 */
+    "埡\0"  /* 垭 */
+    "塏\0"  /* 垲 */
+    "埃及曆\0"  /* 埃及历 */
+    "埃及豔后\0"  /* 埃及艳后 */
+    "埃榮衝\0"  /* 埃荣冲 */
+    "埋頭尋錶\0"  /* 埋头寻表 */
+    "埋頭尋鐘\0"  /* 埋头寻钟 */
+    "城裡\0"  /* 城里 */
+    "埔裏社撫墾局\0"  /* 埔裡社撫墾局 */
+    "埔裏社撫墾局\0"  /* 埔里社抚垦局 */
+    "塒\0"  /* 埘 */
+    "塤\0"  /* 埙 */
+    "堝\0"  /* 埚 */
+    "垵\0"  /* 埯 */
+    "基準\0"  /* 基准 */
+    "基幹\0"  /* 基干 */
+    "塹\0"  /* 堑 */
+    "墮\0"  /* 堕 */
+    "墮胎藥\0"  /* 堕胎药 */
+    "堙澱\0"  /* 堙淀 */
+    "塞藥\0"  /* 塞药 */
+    "墓誌\0"  /* 墓志 */
+    "牆\0"  /* 墙 */
+    "牆裡\0"  /* 墙里 */
+    "增闢\0"  /* 增辟 */
+    "墨瀋未乾\0"  /* 墨沈未干 */
+    "壯\0"  /* 壮 */
+    "壯遊\0"  /* 壮游 */
+    "壯麵\0"  /* 壮面 */
+    "聲\0"  /* 声 */
+    "殼\0"  /* 壳 */
+    "殼裡\0"  /* 壳里 */
+    "壺\0"  /* 壶 */
+    "壺裡\0"  /* 壶里 */
+    "壹鬱\0"  /* 壹郁 */
+    "處\0"  /* 处 */
+    "備\0"  /* 备 */
+    "備註\0"  /* 备注 */
+    "復\0"  /* 复 */
+    "複習\0"  /* 复习 */
+    "複畝珍\0"  /* 复亩珍 */
+    "複仞年如\0"  /* 复仞年如 */
+    "複以百萬\0"  /* 复以百万 */
+    "複位\0"  /* 复位 */
+    "複信\0"  /* 复信 */
+    "複元音\0"  /* 复元音 */
+    "複寫\0"  /* 复写 */
+    "複決\0"  /* 复决 */
+    "複函數\0"  /* 复函数 */
+    "複分數\0"  /* 复分数 */
+    "複分析\0"  /* 复分析 */
+    "複分解\0"  /* 复分解 */
+    "複列\0"  /* 复列 */
+    "複利\0"  /* 复利 */
+    "複製\0"  /* 复制 */
+    "複印\0"  /* 复印 */
+    "複發\0"  /* 复发 */
+    "複變函數\0"  /* 复变函数 */
+    "複句\0"  /* 复句 */
+    "複葉\0"  /* 复叶 */
+    "複合\0"  /* 复合 */
+    "複名\0"  /* 复名 */
+    "複員\0"  /* 复员 */
+    "複壁\0"  /* 复壁 */
+    "複壯\0"  /* 复壮 */
+    "複復\0"  /* 复复 */
+    "複姓\0"  /* 复姓 */
+    "複字鍵\0"  /* 复字键 */
+    "複審\0"  /* 复审 */
+    "複對數\0"  /* 复对数 */
+    "複平面\0"  /* 复平面 */
+    "複式\0"  /* 复式 */
+    "複數\0"  /* 复数 */
+    "複本\0"  /* 复本 */
+    "複雜\0"  /* 复杂 */
+    "複查\0"  /* 复查 */
+    "複核\0"  /* 复核 */
+    "複檢\0"  /* 复检 */
+    "複次\0"  /* 复次 */
+    "複比\0"  /* 复比 */
+    "復活節曆表\0"  /* 复活节历表 */
+    "複流\0"  /* 复流 */
+    "複測\0"  /* 复测 */
+    "複電\0"  /* 复电 */
+    "複目\0"  /* 复目 */
+    "複眼\0"  /* 复眼 */
+    "複種\0"  /* 复种 */
+    "複線\0"  /* 复线 */
+    "複色\0"  /* 复色 */
+    "複議\0"  /* 复议 */
+    "複評\0"  /* 复评 */
+    "複診\0"  /* 复诊 */
+    "複詞\0"  /* 复词 */
+    "複試\0"  /* 复试 */
+    "複課\0"  /* 复课 */
+    "複賽\0"  /* 复赛 */
+    "複輔音\0"  /* 复辅音 */
+    "複述\0"  /* 复述 */
+    "複選\0"  /* 复选 */
+    "複錢\0"  /* 复钱 */
+    "複閱\0"  /* 复阅 */
+    "複音\0"  /* 复音 */
+    "複韻\0"  /* 复韵 */
+    "夏于喬\0"  /* 夏于乔 */
+    "夏于喬\0"  /* 夏于喬 */
+    "夏曆\0"  /* 夏历 */
+    "夏天裡\0"  /* 夏天里 */
+    "夏日裡\0"  /* 夏日里 */
+    "夏遊\0"  /* 夏游 */
+    "外製\0"  /* 外制 */
+    "外強中乾\0"  /* 外强中干 */
+    "多醜\0"  /* 多丑 */
+    "多麼\0"  /* 多么 */
+    "多餘\0"  /* 多余 */
+    "多衝\0"  /* 多冲 */
+    "多佔\0"  /* 多占 */
+    "多隻\0"  /* 多只 */
+    "夜光錶\0"  /* 夜光表 */
+    "夜遊\0"  /* 夜游 */
+    "夜裡\0"  /* 夜里 */
+    "夠\0"  /* 够 */
+    "夠剋制\0"  /* 够克制 */
+    "大夥\0"  /* 大伙 */
+    "大曆\0"  /* 大历 */
+    "大隻\0"  /* 大只 */
+    "大獃\0"  /* 大呆 */
+    "大週摺\0"  /* 大周折 */
+    "大型鐘\0"  /* 大型钟 */
+    "大幹\0"  /* 大干 */
+    "大批湧到\0"  /* 大批涌到 */
+    "大摺兒\0"  /* 大折儿 */
+    "大明曆\0"  /* 大明历 */
+    "大麴\0"  /* 大曲 */
+    "大本鐘\0"  /* 大本钟 */
+    "大病初癒\0"  /* 大病初愈 */
+    "大目乾連\0"  /* 大目干连 */
+    "大笨鐘\0"  /* 大笨钟 */
+    "大蜡\0"  /* 大蜡 */
+    "大衍曆\0"  /* 大衍历 */
+    "大言非夸\0"  /* 大言非夸 */
+    "大讚\0"  /* 大赞 */
+    "大鐘\0"  /* 大钟 */
+    "大鎚\0"  /* 大锤 */
+    "天克地衝\0"  /* 天克地冲 */
+    "天曆\0"  /* 天历 */
+    "天后\0"  /* 天后 */
+    "天地為範\0"  /* 天地为范 */
+    "天乾物燥\0"  /* 天干物燥 */
+    "天文曆表\0"  /* 天文历表 */
+    "天文學鐘\0"  /* 天文学钟 */
+    "天文鐘\0"  /* 天文钟 */
+    "太僕\0"  /* 太仆 */
+    "太初曆\0"  /* 太初历 */
+    "太后\0"  /* 太后 */
+    "夯幹\0"  /* 夯干 */
+    "頭\0"  /* 头 */
+    "頭髮\0"  /* 头发 */
+    "頭巾弔在水裡\0"  /* 头巾吊在水里 */
+    "頭裡\0"  /* 头里 */
+    "誇\0"  /* 夸 */
+    "夸麗\0"  /* 夸丽 */
+    "夸人\0"  /* 夸人 */
+    "夸克\0"  /* 夸克 */
+    "誇多鬥靡\0"  /* 夸多斗靡 */
+    "夸夸其談\0"  /* 夸夸其谈 */
+    "夸姣\0"  /* 夸姣 */
+    "夸容\0"  /* 夸容 */
+    "夸毗\0"  /* 夸毗 */
+    "夸父\0"  /* 夸父 */
+    "夸特\0"  /* 夸特 */
+    "夸脫\0"  /* 夸脱 */
+    "夸誕\0"  /* 夸诞 */
+    "誇讚\0"  /* 夸赞 */
+    "夾\0"  /* 夹 */
+    "奪\0"  /* 夺 */
+    "奪鬥\0"  /* 夺斗 */
+    "奩\0"  /* 奁 */
+    "奐\0"  /* 奂 */
+    "奇醜\0"  /* 奇丑 */
+    "奇蹟\0"  /* 奇迹 */
+    "奮\0"  /* 奋 */
+    "奮鬥\0"  /* 奋斗 */
+    "奏摺\0"  /* 奏折 */
+    "獎\0"  /* 奖 */
+    "獎盃\0"  /* 奖杯 */
+    "奧\0"  /* 奥 */
+    "奧佔\0"  /* 奥占 */
+    "女僕\0"  /* 女仆 */
+    "女傭\0"  /* 女佣 */
+    "奴僕\0"  /* 奴仆 */
+    "姦夫\0"  /* 奸夫 */
+    "姦婦\0"  /* 奸妇 */
+    "姦宄\0"  /* 奸宄 */
+    "姦情\0"  /* 奸情 */
+    "姦殺\0"  /* 奸杀 */
+    "姦汙\0"  /* 奸污 */
+    "姦淫\0"  /* 奸淫 */
+    "姦猾\0"  /* 奸猾 */
+    "姦細\0"  /* 奸细 */
+    "姦邪\0"  /* 奸邪 */
+    "她剋制\0"  /* 她克制 */
+    "好醜\0"  /* 好丑 */
+    "好獃\0"  /* 好呆 */
+    "好睏\0"  /* 好困 */
+    "好傢夥\0"  /* 好家伙 */
+    "好乾\0"  /* 好干 */
+    "好鬥\0"  /* 好斗 */
+    "好籤\0"  /* 好签 */
+    "如果幹\0"  /* 如果干 */
+    "如饑似渴\0"  /* 如饥似渴 */
+    "妝\0"  /* 妆 */
+    "婦\0"  /* 妇 */
+    "媽\0"  /* 妈 */
+    "妖后\0"  /* 妖后 */
+    "妙藥\0"  /* 妙药 */
+    "嫵\0"  /* 妩 */
+    "嫗\0"  /* 妪 */
+    "媯\0"  /* 妫 */
+    "委託\0"  /* 委托 */
+    "姍\0"  /* 姗 */
+    "薑絲\0"  /* 姜丝 */
+    "姜文杰\0"  /* 姜文杰 */
+    "薑是老的辣\0"  /* 姜是老的辣 */
+    "薑末\0"  /* 姜末 */
+    "薑桂\0"  /* 姜桂 */
+    "薑母\0"  /* 姜母 */
+    "薑汁\0"  /* 姜汁 */
+    "薑湯\0"  /* 姜汤 */
+    "薑片\0"  /* 姜片 */
+    "薑糖\0"  /* 姜糖 */
+    "薑老辣\0"  /* 姜老辣 */
+    "薑茶\0"  /* 姜茶 */
+    "薑蓉\0"  /* 姜蓉 */
+    "薑餅\0"  /* 姜饼 */
+    "薑黃\0"  /* 姜黄 */
+    "奼\0"  /* 姹 */
+    "威稜\0"  /* 威棱 */
+    "婁\0"  /* 娄 */
+    "婭\0"  /* 娅 */
+    "嬈\0"  /* 娆 */
+    "嬌\0"  /* 娇 */
+    "孌\0"  /* 娈 */
+    "娛\0"  /* 娱 */
+    "媧\0"  /* 娲 */
+    "媧杆\0"  /* 娲杆 */
+    "嫻\0"  /* 娴 */
+    "婢僕\0"  /* 婢仆 */
+    "嬰\0"  /* 婴 */
+    "嬋\0"  /* 婵 */
+    "嬸\0"  /* 婶 */
+    "媼\0"  /* 媪 */
+    "嫌兇\0"  /* 嫌凶 */
+    "嫌好道醜\0"  /* 嫌好道丑 */
+    "嬡\0"  /* 嫒 */
+    "嬪\0"  /* 嫔 */
+    "嬙\0"  /* 嫱 */
+    "嬉遊\0"  /* 嬉游 */
+    "嬖倖\0"  /* 嬖幸 */
+    "嬴餘\0"  /* 嬴余 */
+    "嬤\0"  /* 嬷 */
+    "子之丰兮\0"  /* 子之丰兮 */
+    "子云\0"  /* 子云 */
+    "字彙\0"  /* 字汇 */
+    "字裡行間\0"  /* 字里行间 */
+    "存摺\0"  /* 存折 */
+    "孫\0"  /* 孙 */
+    "學\0"  /* 学 */
+    "學裡\0"  /* 学里 */
+    "孿\0"  /* 孪 */
+    "寧\0"  /* 宁 */
+    "宇宙誌\0"  /* 宇宙志 */
+    "安瀋鐵路\0"  /* 安沈铁路 */
+    "安眠藥\0"  /* 安眠药 */
+    "安胎藥\0"  /* 安胎药 */
+    "宗周鐘\0"  /* 宗周钟 */
+    "官曆\0"  /* 官历 */
+    "官地為寀\0"  /* 官地为采 */
+    "官莊\0"  /* 官庄 */
+    "定準\0"  /* 定准 */
+    "定製\0"  /* 定制 */
+    "宜云\0"  /* 宜云 */
+    "寶\0"  /* 宝 */
+    "寶曆\0"  /* 宝历 */
+    "寶莊\0"  /* 宝庄 */
+    "寶裡寶氣\0"  /* 宝里宝气 */
+    "實\0"  /* 实 */
+    "實幹\0"  /* 实干 */
+    "寵\0"  /* 宠 */
+    "審\0"  /* 审 */
+    "宣洩\0"  /* 宣泄 */
+    "宦遊\0"  /* 宦游 */
+    "憲\0"  /* 宪 */
+    "宮\0"  /* 宫 */
+    "宮裡\0"  /* 宫里 */
+    "宴遊\0"  /* 宴游 */
+    "家醜\0"  /* 家丑 */
+    "家僕\0"  /* 家仆 */
+    "傢伙\0"  /* 家伙 */
+    "傢俱\0"  /* 家俱 */
+    "傢具\0"  /* 家具 */
+    "家莊\0"  /* 家庄 */
+    "家裡\0"  /* 家里 */
+    "容範\0"  /* 容范 */
+    "寬\0"  /* 宽 */
+    "寬餘\0"  /* 宽余 */
+    "寬寬鬆鬆\0"  /* 宽宽松松 */
+    "寬鬆\0"  /* 宽松 */
+    "賓\0"  /* 宾 */
+    "寄託\0"  /* 寄托 */
+    "密緻\0"  /* 密致 */
+    "寇讎\0"  /* 寇仇 */
+    "寇準\0"  /* 寇准 */
+    "富餘\0"  /* 富余 */
+    "寒假裡\0"  /* 寒假里 */
+    "寒慄\0"  /* 寒栗 */
+    "寢\0"  /* 寝 */
+    "寡佔\0"  /* 寡占 */
+    "寡慾\0"  /* 寡欲 */
+    "寮寀\0"  /* 寮采 */
+    "寸髮千金\0"  /* 寸发千金 */
+    "對\0"  /* 对 */
+    "對準\0"  /* 对准 */
+    "對準錶\0"  /* 对准表 */
+    "對準鐘\0"  /* 对准钟 */
+    "對摺\0"  /* 对折 */
+    "對錶\0"  /* 对表 */
+    "寺鐘\0"  /* 寺钟 */
+    "尋\0"  /* 寻 */
+    "導\0"  /* 导 */
+    "導遊\0"  /* 导游 */
+    "壽\0"  /* 寿 */
+    "壽麵\0"  /* 寿面 */
+    "封后\0"  /* 封后 */
+    "封面裡\0"  /* 封面里 */
+    "射鵰\0"  /* 射雕 */
+    "將\0"  /* 将 */
+    "將佔\0"  /* 将占 */
+    "尊后\0"  /* 尊后 */
+    "小僕\0"  /* 小仆 */
+    "小价\0"  /* 小价 */
+    "小夥子\0"  /* 小伙子 */
+    "小几\0"  /* 小几 */
+    "小隻\0"  /* 小只 */
+    "小型鐘\0"  /* 小型钟 */
+    "小米麵\0"  /* 小米面 */
+    "少佔\0"  /* 少占 */
+    "少採\0"  /* 少采 */
+    "爾\0"  /* 尔 */
+    "爾冬陞\0"  /* 尔冬升 */
+    "塵\0"  /* 尘 */
+    "嘗\0"  /* 尝 */
+    "堯\0"  /* 尧 */
+    "就剋制\0"  /* 就克制 */
+    "就範\0"  /* 就范 */
+    "就裡\0"  /* 就里 */
+    "尷\0"  /* 尴 */
+    "屍\0"  /* 尸 */
+    "尸位素餐\0"  /* 尸位素餐 */
+    "尸利\0"  /* 尸利 */
+    "尸居餘氣\0"  /* 尸居余气 */
+    "尸棄佛\0"  /* 尸弃佛 */
+    "尸祝\0"  /* 尸祝 */
+    "尸祿\0"  /* 尸禄 */
+    "尸羅精舍\0"  /* 尸罗精舍 */
+    "尸羅精舍\0"  /* 尸羅精舍 */
+    "尸臣\0"  /* 尸臣 */
+    "尸諫\0"  /* 尸谏 */
+    "尸魂界\0"  /* 尸魂界 */
+    "尸鳩\0"  /* 尸鸠 */
+    "盡\0"  /* 尽 */
+    "儘先\0"  /* 尽先 */
+    "儘其所有\0"  /* 尽其所有 */
+    "儘力\0"  /* 尽力 */
+    "儘可能\0"  /* 尽可能 */
+    "儘儘\0"  /* 尽尽 */
+    "儘快\0"  /* 尽快 */
+    "儘早\0"  /* 尽早 */
+    "儘是\0"  /* 尽是 */
+    "儘管\0"  /* 尽管 */
+    "儘速\0"  /* 尽速 */
+    "盡量剋制\0"  /* 尽量克制 */
+    "局裡\0"  /* 局里 */
+    "屁股大弔了心\0"  /* 屁股大吊了心 */
+    "層\0"  /* 层 */
+    "屜\0"  /* 屉 */
+    "屆\0"  /* 届 */
+    "屋子裡\0"  /* 屋子里 */
+    "屋樑\0"  /* 屋梁 */
+    "屋裡\0"  /* 屋里 */
+    "屬\0"  /* 属 */
+    "屬託\0"  /* 属托 */
+    "屢\0"  /* 屡 */
+    "屢顧爾僕\0"  /* 屡顾尔仆 */
+    "屨\0"  /* 屦 */
+    "屯紮\0"  /* 屯扎 */
+    "屯裡\0"  /* 屯里 */
+    "山嶽\0"  /* 山岳 */
+    "山崩鐘應\0"  /* 山崩钟应 */
+    "山莊\0"  /* 山庄 */
+    "山樑\0"  /* 山梁 */
+    "山稜\0"  /* 山棱 */
+    "山洞裡\0"  /* 山洞里 */
+    "山羊鬍\0"  /* 山羊胡 */
+    "山藥\0"  /* 山药 */
+    "山裡\0"  /* 山里 */
+    "山重水複\0"  /* 山重水复 */
+    "嶼\0"  /* 屿 */
+    "歲\0"  /* 岁 */
+    "歲聿云暮\0"  /* 岁聿云暮 */
+    "豈\0"  /* 岂 */
+    "嶇\0"  /* 岖 */
+    "崗\0"  /* 岗 */
+    "峴\0"  /* 岘 */
+    "嶴\0"  /* 岙 */
+    "嵐\0"  /* 岚 */
+    "島\0"  /* 岛 */
+    "嶺\0"  /* 岭 */
+    "岱嶽\0"  /* 岱岳 */
+    "嶽嶽\0"  /* 岳岳 */
+    "嶽麓\0"  /* 岳麓 */
+    "巋\0"  /* 岿 */
+    "嶧\0"  /* 峄 */
+    "峽\0"  /* 峡 */
+    "嶠\0"  /* 峤 */
+    "崢\0"  /* 峥 */
+    "巒\0"  /* 峦 */
+    "峰迴\0"  /* 峰回 */
+    "峻岭\0"  /* 峻岭 */
+    "嶗\0"  /* 崂 */
+    "崍\0"  /* 崃 */
+    "崖广\0"  /* 崖广 */
+    "嶄\0"  /* 崭 */
+    "嶸\0"  /* 嵘 */
+    "嶁\0"  /* 嵝 */
+    "嶒稜\0"  /* 嶒棱 */
+    "巔\0"  /* 巅 */
+    "川穀\0"  /* 川谷 */
+    "巡迴\0"  /* 巡回 */
+    "巡遊\0"  /* 巡游 */
+    "工緻\0"  /* 工致 */
+    "左衝右突\0"  /* 左冲右突 */
+    "巧曆\0"  /* 巧历 */
+    "巧幹\0"  /* 巧干 */
+    "鞏\0"  /* 巩 */
+    "巰\0"  /* 巯 */
+    "已佔\0"  /* 已占 */
+    "巴爾幹\0"  /* 巴尔干 */
+    "巷裡\0"  /* 巷里 */
+    "幣\0"  /* 币 */
+    "市佔\0"  /* 市占 */
+    "市裡\0"  /* 市里 */
+    "佈於\0"  /* 布于 */
+    "布莊\0"  /* 布庄 */
+    "布穀\0"  /* 布谷 */
+    "布穀鳥鐘\0"  /* 布谷鸟钟 */
+    "佈道\0"  /* 布道 */
+    "佈雷封鎖\0"  /* 布雷封锁 */
+    "佈雷的\0"  /* 布雷的 */
+    "佈雷艦\0"  /* 布雷舰 */
+    "佈雷艇\0"  /* 布雷艇 */
+    "佈雷速度\0"  /* 布雷速度 */
+    "帥\0"  /* 帅 */
+    "師\0"  /* 师 */
+    "師範\0"  /* 师范 */
+    "希伯來曆\0"  /* 希伯来历 */
+    "幃\0"  /* 帏 */
+    "帳\0"  /* 帐 */
+    "簾\0"  /* 帘 */
+    "帘子\0"  /* 帘子 */
+    "帘布\0"  /* 帘布 */
+    "幟\0"  /* 帜 */
+    "帝后臺\0"  /* 帝后台 */
+    "帶\0"  /* 带 */
+    "帶髮修行\0"  /* 带发修行 */
+    "帶徵\0"  /* 带征 */
+    "幀\0"  /* 帧 */
+    "席捲\0"  /* 席卷 */
+    "幫\0"  /* 帮 */
+    "幫傭\0"  /* 帮佣 */
+    "幬\0"  /* 帱 */
+    "幘\0"  /* 帻 */
+    "幗\0"  /* 帼 */
+    "冪\0"  /* 幂 */
+    "襆\0"  /* 幞 */
+    "幹上\0"  /* 干上 */
+    "幹下去\0"  /* 干下去 */
+    "幹不了\0"  /* 干不了 */
+    "幹不成\0"  /* 干不成 */
+    "乾絲\0"  /* 干丝 */
+    "幹個\0"  /* 干个 */
+    "乾個夠\0"  /* 干个够 */
+    "幹麼\0"  /* 干么 */
+    "乾喬\0"  /* 干乔 */
+    "幹了\0"  /* 干了 */
+    "幹事\0"  /* 干事 */
+    "乾井\0"  /* 干井 */
+    "幹些\0"  /* 干些 */
+    "乾產\0"  /* 干产 */
+    "乾親\0"  /* 干亲 */
+    "幹人\0"  /* 干人 */
+    "幹什麼\0"  /* 干什么 */
+    "乾兒\0"  /* 干儿 */
+    "乾冰\0"  /* 干冰 */
+    "乾冷\0"  /* 干冷 */
+    "乾淨\0"  /* 干净 */
+    "乾涼\0"  /* 干凉 */
+    "乾芻\0"  /* 干刍 */
+    "乾刻版\0"  /* 干刻版 */
+    "乾剝剝\0"  /* 干剥剥 */
+    "幹辦\0"  /* 干办 */
+    "幹勁\0"  /* 干劲 */
+    "幹勁沖天\0"  /* 干劲冲天 */
+    "乾卦\0"  /* 干卦 */
+    "乾颱\0"  /* 干台 */
+    "乾號\0"  /* 干号 */
+    "乾吊著下巴\0"  /* 干吊着下巴 */
+    "幹吏\0"  /* 干吏 */
+    "幹嗎\0"  /* 干吗 */
+    "乾嘔\0"  /* 干呕 */
+    "幹員\0"  /* 干员 */
+    "乾和\0"  /* 干和 */
+    "乾咳\0"  /* 干咳 */
+    "乾咽\0"  /* 干咽 */
+    "乾噦\0"  /* 干哕 */
+    "乾哥\0"  /* 干哥 */
+    "乾哭\0"  /* 干哭 */
+    "乾唱\0"  /* 干唱 */
+    "幹啥\0"  /* 干啥 */
+    "乾啼\0"  /* 干啼 */
+    "幹嘛\0"  /* 干嘛 */
+    "乾嚎\0"  /* 干嚎 */
+    "乾回付\0"  /* 干回付 */
+    "乾圓潔淨\0"  /* 干圆洁净 */
+    "乾地\0"  /* 干地 */
+    "幹壞事\0"  /* 干坏事 */
+    "乾塢\0"  /* 干坞 */
+    "乾坤\0"  /* 干坤 */
+    "幹頭\0"  /* 干头 */
+    "乾女\0"  /* 干女 */
+    "乾奴才\0"  /* 干奴才 */
+    "乾媽\0"  /* 干妈 */
+    "乾妹\0"  /* 干妹 */
+    "乾姊\0"  /* 干姊 */
+    "乾薑\0"  /* 干姜 */
+    "乾娘\0"  /* 干娘 */
+    "乾子\0"  /* 干子 */
+    "乾季\0"  /* 干季 */
+    "幹完\0"  /* 干完 */
+    "幹家\0"  /* 干家 */
+    "幹將\0"  /* 干将 */
+    "乾屍\0"  /* 干尸 */
+    "乾屎橛\0"  /* 干屎橛 */
+    "乾巴\0"  /* 干巴 */
+    "乾乾\0"  /* 干干 */
+    "乾乾淨淨\0"  /* 干干净净 */
+    "乾式\0"  /* 干式 */
+    "乾弟\0"  /* 干弟 */
+    "幹當\0"  /* 干当 */
+    "幹得\0"  /* 干得 */
+    "乾急\0"  /* 干急 */
+    "乾性\0"  /* 干性 */
+    "幹性油\0"  /* 干性油 */
+    "幹才\0"  /* 干才 */
+    "乾打雷\0"  /* 干打雷 */
+    "乾折\0"  /* 干折 */
+    "幹掉\0"  /* 干掉 */
+    "幹探\0"  /* 干探 */
+    "乾撂台\0"  /* 干撂台 */
+    "乾撇下\0"  /* 干撇下 */
+    "乾擦\0"  /* 干擦 */
+    "乾支剌\0"  /* 干支剌 */
+    "乾支支\0"  /* 干支支 */
+    "乾料\0"  /* 干料 */
+    "乾旱\0"  /* 干旱 */
+    "乾暖\0"  /* 干暖 */
+    "乾材\0"  /* 干材 */
+    "乾村沙\0"  /* 干村沙 */
+    "乾杯\0"  /* 干杯 */
+    "乾果\0"  /* 干果 */
+    "乾枯\0"  /* 干枯 */
+    "乾柴\0"  /* 干柴 */
+    "幹校\0"  /* 干校 */
+    "乾梅\0"  /* 干梅 */
+    "乾死\0"  /* 干死 */
+    "乾池\0"  /* 干池 */
+    "乾溝\0"  /* 干沟 */
+    "乾沒\0"  /* 干没 */
+    "乾洗\0"  /* 干洗 */
+    "幹活\0"  /* 干活 */
+    "幹流\0"  /* 干流 */
+    "幹濟\0"  /* 干济 */
+    "乾澀\0"  /* 干涩 */
+    "乾涸\0"  /* 干涸 */
+    "乾渠\0"  /* 干渠 */
+    "乾渴\0"  /* 干渴 */
+    "乾濕\0"  /* 干湿 */
+    "乾漆\0"  /* 干漆 */
+    "乾燈盞\0"  /* 干灯盏 */
+    "乾熱\0"  /* 干热 */
+    "乾熬\0"  /* 干熬 */
+    "乾熱\0"  /* 干熱 */
+    "乾燥\0"  /* 干燥 */
+    "幹父之蠱\0"  /* 干父之蛊 */
+    "乾爸\0"  /* 干爸 */
+    "乾爹\0"  /* 干爹 */
+    "乾爽\0"  /* 干爽 */
+    "乾片\0"  /* 干片 */
+    "幹球溫度\0"  /* 干球温度 */
+    "幹甚麼\0"  /* 干甚么 */
+    "乾生受\0"  /* 干生受 */
+    "乾生子\0"  /* 干生子 */
+    "乾田\0"  /* 干田 */
+    "乾電\0"  /* 干电 */
+    "幹略\0"  /* 干略 */
+    "乾疥\0"  /* 干疥 */
+    "乾瘦\0"  /* 干瘦 */
+    "乾癟\0"  /* 干瘪 */
+    "乾癮\0"  /* 干瘾 */
+    "乾癬\0"  /* 干癣 */
+    "乾白兒\0"  /* 干白儿 */
+    "乾的\0"  /* 干的 */
+    "幹的停當\0"  /* 干的停当 */
+    "乾眼\0"  /* 干眼 */
+    "乾著\0"  /* 干着 */
+    "干著急\0"  /* 干着急 */
+    "乾瞪眼\0"  /* 干瞪眼 */
+    "乾禮\0"  /* 干礼 */
+    "乾稿\0"  /* 干稿 */
+    "乾笑\0"  /* 干笑 */
+    "乾等\0"  /* 干等 */
+    "乾篾片\0"  /* 干篾片 */
+    "乾粉\0"  /* 干粉 */
+    "乾糧\0"  /* 干粮 */
+    "乾餱\0"  /* 干糇 */
+    "干係\0"  /* 干系 */
+    "幹細胞\0"  /* 干細胞 */
+    "乾綱\0"  /* 干纲 */
+    "幹線\0"  /* 干线 */
+    "幹練\0"  /* 干练 */
+    "幹細胞\0"  /* 干细胞 */
+    "乾結\0"  /* 干结 */
+    "乾繃\0"  /* 干绷 */
+    "幹缺\0"  /* 干缺 */
+    "幹群關係\0"  /* 干群关系 */
+    "乾耗\0"  /* 干耗 */
+    "乾肉片\0"  /* 干肉片 */
+    "乾股\0"  /* 干股 */
+    "乾肥\0"  /* 干肥 */
+    "乾脆\0"  /* 干脆 */
+    "乾花\0"  /* 干花 */
+    "乾苔\0"  /* 干苔 */
+    "乾茨臘\0"  /* 干茨腊 */
+    "乾茶錢\0"  /* 干茶钱 */
+    "乾草\0"  /* 干草 */
+    "乾菜\0"  /* 干菜 */
+    "幹營生\0"  /* 干营生 */
+    "乾落\0"  /* 干落 */
+    "乾薪\0"  /* 干薪 */
+    "乾虔\0"  /* 干虔 */
+    "幹蠱\0"  /* 干蛊 */
+    "乾血漿\0"  /* 干血浆 */
+    "乾衣\0"  /* 干衣 */
+    "乾裂\0"  /* 干裂 */
+    "幹警\0"  /* 干警 */
+    "乾貝\0"  /* 干贝 */
+    "乾貨\0"  /* 干货 */
+    "幹起來\0"  /* 干起来 */
+    "幹路\0"  /* 干路 */
+    "乾躁\0"  /* 干躁 */
+    "幹這一行\0"  /* 干这一行 */
+    "幹這種事\0"  /* 干这种事 */
+    "乾逼\0"  /* 干逼 */
+    "幹道\0"  /* 干道 */
+    "幹部\0"  /* 干部 */
+    "乾酪\0"  /* 干酪 */
+    "乾酵母\0"  /* 干酵母 */
+    "乾醋\0"  /* 干醋 */
+    "乾重\0"  /* 干重 */
+    "乾量\0"  /* 干量 */
+    "乾阿奶\0"  /* 干阿奶 */
+    "乾隆\0"  /* 干隆 */
+    "乾雷\0"  /* 干雷 */
+    "乾霍亂\0"  /* 干霍乱 */
+    "乾麵\0"  /* 干面 */
+    "幹革命\0"  /* 干革命 */
+    "乾顙\0"  /* 干颡 */
+    "乾飯\0"  /* 干饭 */
+    "乾館\0"  /* 干馆 */
+    "乾餾\0"  /* 干馏 */
+    "乾魚\0"  /* 干鱼 */
+    "乾鮮\0"  /* 干鲜 */
+    "平準\0"  /* 平准 */
+    "平泉莊\0"  /* 平泉庄 */
+    "年代裡\0"  /* 年代里 */
+    "年曆\0"  /* 年历 */
+    "年穀\0"  /* 年谷 */
+    "年裡\0"  /* 年里 */
+    "並\0"  /* 并 */
+    "併一不二\0"  /* 并一不二 */
+    "併為一體\0"  /* 并为一体 */
+    "併為一家\0"  /* 并为一家 */
+    "併產\0"  /* 并产 */
+    "併入\0"  /* 并入 */
+    "併兼\0"  /* 并兼 */
+    "併到\0"  /* 并到 */
+    "并力\0"  /* 并力 */
+    "併發型模式\0"  /* 并发型模式 */
+    "併發模式\0"  /* 并发模式 */
+    "併發症\0"  /* 并发症 */
+    "併發重症\0"  /* 并发重症 */
+    "併疊\0"  /* 并叠 */
+    "併合\0"  /* 并合 */
+    "併名\0"  /* 并名 */
+    "并吞\0"  /* 并吞 */
+    "併吞下\0"  /* 并吞下 */
+    "並存著\0"  /* 并存着 */
+    "并州\0"  /* 并州 */
+    "併當\0"  /* 并当 */
+    "併攏\0"  /* 并拢 */
+    "并日而食\0"  /* 并日而食 */
+    "並曰入澱\0"  /* 并曰入淀 */
+    "併案\0"  /* 并案 */
+    "併流\0"  /* 并流 */
+    "併火\0"  /* 并火 */
+    "併科\0"  /* 并科 */
+    "併線\0"  /* 并线 */
+    "併網\0"  /* 并网 */
+    "併肩子\0"  /* 并肩子 */
+    "併購\0"  /* 并购 */
+    "并迭\0"  /* 并迭 */
+    "併除\0"  /* 并除 */
+    "併骨\0"  /* 并骨 */
+    "倖免\0"  /* 幸免 */
+    "倖存\0"  /* 幸存 */
+    "倖幸\0"  /* 幸幸 */
+    "幸運鬍\0"  /* 幸运胡 */
+    "廣\0"  /* 广 */
+    "廣徵\0"  /* 广征 */
+    "廣捨\0"  /* 广舍 */
+    "广部\0"  /* 广部 */
+    "莊上\0"  /* 庄上 */
+    "莊嚴\0"  /* 庄严 */
+    "莊主\0"  /* 庄主 */
+    "莊農\0"  /* 庄农 */
+    "莊員\0"  /* 庄员 */
+    "莊周\0"  /* 庄周 */
+    "莊園\0"  /* 庄园 */
+    "莊士頓道\0"  /* 庄士顿道 */
+    "莊子\0"  /* 庄子 */
+    "莊客\0"  /* 庄客 */
+    "莊家\0"  /* 庄家 */
+    "莊戶\0"  /* 庄户 */
+    "莊房\0"  /* 庄房 */
+    "莊敬\0"  /* 庄敬 */
+    "莊田\0"  /* 庄田 */
+    "莊稼\0"  /* 庄稼 */
+    "莊舄越吟\0"  /* 庄舄越吟 */
+    "莊語\0"  /* 庄语 */
+    "莊裡\0"  /* 庄里 */
+    "莊重\0"  /* 庄重 */
+    "莊院\0"  /* 庄院 */
+    "莊騷\0"  /* 庄骚 */
+    "慶\0"  /* 庆 */
+    "慶曆\0"  /* 庆历 */
+    "慶弔\0"  /* 庆吊 */
+    "廬\0"  /* 庐 */
+    "廡\0"  /* 庑 */
+    "庫\0"  /* 库 */
+    "應\0"  /* 应 */
+    "應剋制\0"  /* 应克制 */
+    "應徵\0"  /* 应征 */
+    "應鐘\0"  /* 应钟 */
+    "店裡\0"  /* 店里 */
+    "廟\0"  /* 庙 */
+    "廟裡\0"  /* 庙里 */
+    "府幹\0"  /* 府干 */
+    "龐\0"  /* 庞 */
+    "廢\0"  /* 废 */
+    "廢后\0"  /* 废后 */
+    "座鐘\0"  /* 座钟 */
+    "康莊\0"  /* 康庄 */
+    "廢后\0"  /* 廢后 */
+    "廩\0"  /* 廪 */
+    "延曆\0"  /* 延历 */
+    "開\0"  /* 开 */
+    "開弔\0"  /* 开吊 */
+    "開鬨\0"  /* 开哄 */
+    "開徵\0"  /* 开征 */
+    "開藥\0"  /* 开药 */
+    "開闢\0"  /* 开辟 */
+    "開採\0"  /* 开采 */
+    "異\0"  /* 异 */
+    "棄\0"  /* 弃 */
+    "棄捨\0"  /* 弃舍 */
+    "弄醜\0"  /* 弄丑 */
+    "弄乾\0"  /* 弄干 */
+    "弄鬆\0"  /* 弄松 */
+    "弄髒\0"  /* 弄脏 */
+    "弄鬼弔猴\0"  /* 弄鬼吊猴 */
+    "弒\0"  /* 弑 */
+    "引鬥\0"  /* 引斗 */
+    "弘曆\0"  /* 弘历 */
+    "張\0"  /* 张 */
+    "張三丰\0"  /* 张三丰 */
+    "張樂于張徐\0"  /* 张乐于张徐 */
+    "張勳\0"  /* 张勋 */
+    "彌\0"  /* 弥 */
+    "瀰山遍野\0"  /* 弥山遍野 */
+    "瀰瀰\0"  /* 弥弥 */
+    "瀰漫\0"  /* 弥漫 */
+    "瀰漫著\0"  /* 弥漫着 */
+    "弳\0"  /* 弪 */
+    "彎\0"  /* 弯 */
+    "張三丰\0"  /* 張三丰 */
+    "彈\0"  /* 弹 */
+    "彈子檯\0"  /* 弹子台 */
+    "彈珠檯\0"  /* 弹珠台 */
+    "彈藥\0"  /* 弹药 */
+    "強\0"  /* 强 */
+    "強佔\0"  /* 强占 */
+    "強姦\0"  /* 强奸 */
+    "強幹\0"  /* 强干 */
+    "歸\0"  /* 归 */
+    "歸餘\0"  /* 归余 */
+    "歸併\0"  /* 归并 */
+    "當\0"  /* 当 */
+    "當準\0"  /* 当准 */
+    "噹啷\0"  /* 当啷 */
+    "噹噹\0"  /* 当当 */
+    "當著\0"  /* 当着 */
+    "錄\0"  /* 录 */
+    "錄製\0"  /* 录制 */
+    "錄著\0"  /* 录着 */
+    "形單影隻\0"  /* 形单影只 */
+    "形影相弔\0"  /* 形影相吊 */
+    "彥\0"  /* 彦 */
+    "綵帶\0"  /* 彩带 */
+    "綵排\0"  /* 彩排 */
+    "綵樓\0"  /* 彩楼 */
+    "綵牌樓\0"  /* 彩牌楼 */
+    "綵球\0"  /* 彩球 */
+    "綵線\0"  /* 彩线 */
+    "綵綢\0"  /* 彩绸 */
+    "綵船\0"  /* 彩船 */
+    "綵衣\0"  /* 彩衣 */
+    "彭于晏\0"  /* 彭于晏 */
+    "影后\0"  /* 影后 */
+    "徹\0"  /* 彻 */
+    "彼此剋制\0"  /* 彼此克制 */
+    "往複\0"  /* 往复 */
+    "往日無讎\0"  /* 往日無仇 */
+    "往裡\0"  /* 往里 */
+    "徵人\0"  /* 征人 */
+    "徵令\0"  /* 征令 */
+    "徵信\0"  /* 征信 */
+    "徵候\0"  /* 征候 */
+    "徵兆\0"  /* 征兆 */
+    "徵兵\0"  /* 征兵 */
+    "徵到\0"  /* 征到 */
+    "徵募\0"  /* 征募 */
+    "徵佔\0"  /* 征占 */
+    "徵友\0"  /* 征友 */
+    "徵發\0"  /* 征发 */
+    "徵召\0"  /* 征召 */
+    "徵名責實\0"  /* 征名责实 */
+    "徵吏\0"  /* 征吏 */
+    "徵啟\0"  /* 征启 */
+    "徵咎\0"  /* 征咎 */
+    "徵聖\0"  /* 征圣 */
+    "徵士\0"  /* 征士 */
+    "徵婚\0"  /* 征婚 */
+    "徵實\0"  /* 征实 */
+    "徵庸\0"  /* 征庸 */
+    "徵引\0"  /* 征引 */
+    "徵得\0"  /* 征得 */
+    "徵怪\0"  /* 征怪 */
+    "徵才\0"  /* 征才 */
+    "徵招\0"  /* 征招 */
+    "徵收\0"  /* 征收 */
+    "徵效\0"  /* 征效 */
+    "徵文\0"  /* 征文 */
+    "徵求\0"  /* 征求 */
+    "徵狀\0"  /* 征状 */
+    "徵用\0"  /* 征用 */
+    "徵稅\0"  /* 征税 */
+    "徵稿\0"  /* 征稿 */
+    "徵答\0"  /* 征答 */
+    "徵結\0"  /* 征结 */
+    "徵聘\0"  /* 征聘 */
+    "徵訓\0"  /* 征训 */
+    "徵詢\0"  /* 征询 */
+    "徵調\0"  /* 征调 */
+    "徵象\0"  /* 征象 */
+    "徵購\0"  /* 征购 */
+    "徵車\0"  /* 征车 */
+    "徵辟\0"  /* 征辟 */
+    "徵跡\0"  /* 征迹 */
+    "徵選\0"  /* 征选 */
+    "徵逐\0"  /* 征逐 */
+    "徵集\0"  /* 征集 */
+    "徵風召雨\0"  /* 征风召雨 */
+    "徵驗\0"  /* 征验 */
+    "徑\0"  /* 径 */
+    "很醜\0"  /* 很丑 */
+    "很兇\0"  /* 很凶 */
+    "很乾\0"  /* 很干 */
+    "律曆志\0"  /* 律历志 */
+    "徐幹\0"  /* 徐干 */
+    "徒託空言\0"  /* 徒托空言 */
+    "徠\0"  /* 徕 */
+    "得剋制\0"  /* 得克制 */
+    "禦侮\0"  /* 御侮 */
+    "禦寇\0"  /* 御寇 */
+    "禦寒\0"  /* 御寒 */
+    "禦敵\0"  /* 御敌 */
+    "德佔\0"  /* 德占 */
+    "心餘\0"  /* 心余 */
+    "心愿\0"  /* 心愿 */
+    "心繫一\0"  /* 心系一 */
+    "心繫萬\0"  /* 心系万 */
+    "心繫東\0"  /* 心系东 */
+    "心繫兩\0"  /* 心系两 */
+    "心繫中\0"  /* 心系中 */
+    "心繫乔\0"  /* 心系乔 */
+    "心繫五\0"  /* 心系五 */
+    "心繫京\0"  /* 心系京 */
+    "心繫人\0"  /* 心系人 */
+    "心繫他\0"  /* 心系他 */
+    "心繫伊\0"  /* 心系伊 */
+    "心繫眾\0"  /* 心系众 */
+    "心繫傳\0"  /* 心系传 */
+    "心繫何\0"  /* 心系何 */
+    "心繫你\0"  /* 心系你 */
+    "心繫健\0"  /* 心系健 */
+    "心繫全\0"  /* 心系全 */
+    "心繫蘭\0"  /* 心系兰 */
+    "心繫农\0"  /* 心系农 */
+    "心繫功\0"  /* 心系功 */
+    "心繫動\0"  /* 心系动 */
+    "心繫募\0"  /* 心系募 */
+    "心繫北\0"  /* 心系北 */
+    "心繫十\0"  /* 心系十 */
+    "心繫千\0"  /* 心系千 */
+    "心繫南\0"  /* 心系南 */
+    "心繫台\0"  /* 心系台 */
+    "心繫和\0"  /* 心系和 */
+    "心繫哪\0"  /* 心系哪 */
+    "心繫唐\0"  /* 心系唐 */
+    "心繫囑\0"  /* 心系嘱 */
+    "心繫四\0"  /* 心系四 */
+    "心繫困\0"  /* 心系困 */
+    "心繫國\0"  /* 心系国 */
+    "心繫在\0"  /* 心系在 */
+    "心繫地\0"  /* 心系地 */
+    "心繫大\0"  /* 心系大 */
+    "心繫天\0"  /* 心系天 */
+    "心繫夫\0"  /* 心系夫 */
+    "心繫奧\0"  /* 心系奥 */
+    "心繫女\0"  /* 心系女 */
+    "心繫她\0"  /* 心系她 */
+    "心繫婦\0"  /* 心系妇 */
+    "心繫妻\0"  /* 心系妻 */
+    "心繫子\0"  /* 心系子 */
+    "心繫它\0"  /* 心系它 */
+    "心繫宣\0"  /* 心系宣 */
+    "心繫家\0"  /* 心系家 */
+    "心繫富\0"  /* 心系富 */
+    "心繫小\0"  /* 心系小 */
+    "心繫山\0"  /* 心系山 */
+    "心繫川\0"  /* 心系川 */
+    "心繫幼\0"  /* 心系幼 */
+    "心繫廣\0"  /* 心系广 */
+    "心繫彼\0"  /* 心系彼 */
+    "心繫德\0"  /* 心系德 */
+    "心繫您\0"  /* 心系您 */
+    "心繫慈\0"  /* 心系慈 */
+    "心繫我\0"  /* 心系我 */
+    "心繫摩\0"  /* 心系摩 */
+    "心繫故\0"  /* 心系故 */
+    "心繫新\0"  /* 心系新 */
+    "心繫日\0"  /* 心系日 */
+    "心繫昌\0"  /* 心系昌 */
+    "心繫曉\0"  /* 心系晓 */
+    "心繫曼\0"  /* 心系曼 */
+    "心繫林\0"  /* 心系林 */
+    "心繫母\0"  /* 心系母 */
+    "心繫民\0"  /* 心系民 */
+    "心繫江\0"  /* 心系江 */
+    "心繫汶\0"  /* 心系汶 */
+    "心繫沈\0"  /* 心系沈 */
+    "心繫沙\0"  /* 心系沙 */
+    "心繫泰\0"  /* 心系泰 */
+    "心繫浙\0"  /* 心系浙 */
+    "心繫港\0"  /* 心系港 */
+    "心繫湖\0"  /* 心系湖 */
+    "心繫澳\0"  /* 心系澳 */
+    "心繫災\0"  /* 心系灾 */
+    "心繫父\0"  /* 心系父 */
+    "心繫生\0"  /* 心系生 */
+    "心繫病\0"  /* 心系病 */
+    "心繫百\0"  /* 心系百 */
+    "心繫的\0"  /* 心系的 */
+    "心繫著\0"  /* 心系着 */
+    "心繫社\0"  /* 心系社 */
+    "心繫祖\0"  /* 心系祖 */
+    "心繫神\0"  /* 心系神 */
+    "心繫紅\0"  /* 心系红 */
+    "心繫美\0"  /* 心系美 */
+    "心繫群\0"  /* 心系群 */
+    "心繫老\0"  /* 心系老 */
+    "心繫舞\0"  /* 心系舞 */
+    "心繫英\0"  /* 心系英 */
+    "心繫茶\0"  /* 心系茶 */
+    "心繫西\0"  /* 心系西 */
+    "心繫貧\0"  /* 心系贫 */
+    "心繫輸\0"  /* 心系输 */
+    "心繫近\0"  /* 心系近 */
+    "心繫遠\0"  /* 心系远 */
+    "心繫選\0"  /* 心系选 */
+    "心繫重\0"  /* 心系重 */
+    "心繫長\0"  /* 心系长 */
+    "心繫阮\0"  /* 心系阮 */
+    "心繫震\0"  /* 心系震 */
+    "心繫非\0"  /* 心系非 */
+    "心繫風\0"  /* 心系风 */
+    "心繫香\0"  /* 心系香 */
+    "心繫高\0"  /* 心系高 */
+    "心繫麥\0"  /* 心系麦 */
+    "心繫黃\0"  /* 心系黄 */
+    "心蕩\0"  /* 心荡 */
+    "心藥\0"  /* 心药 */
+    "心裡\0"  /* 心里 */
+    "心裏面\0"  /* 心里面 */
+    "心長髮短\0"  /* 心长发短 */
+    "憶\0"  /* 忆 */
+    "懺\0"  /* 忏 */
+    "誌哀\0"  /* 志哀 */
+    "誌喜\0"  /* 志喜 */
+    "誌慶\0"  /* 志庆 */
+    "誌異\0"  /* 志异 */
+    "忙併\0"  /* 忙并 */
+    "忙裡\0"  /* 忙里 */
+    "忙裡偷閒\0"  /* 忙里偷闲 */
+    "忠僕\0"  /* 忠仆 */
+    "憂\0"  /* 忧 */
+    "憂鬱\0"  /* 忧郁 */
+    "快剋制\0"  /* 快克制 */
+    "快衝\0"  /* 快冲 */
+    "快乾\0"  /* 快干 */
+    "愾\0"  /* 忾 */
+    "懷\0"  /* 怀 */
+    "懷錶\0"  /* 怀表 */
+    "懷裡\0"  /* 怀里 */
+    "懷鐘\0"  /* 怀钟 */
+    "態\0"  /* 态 */
+    "慫\0"  /* 怂 */
+    "憮\0"  /* 怃 */
+    "慪\0"  /* 怄 */
+    "悵\0"  /* 怅 */
+    "愴\0"  /* 怆 */
+    "怎麼\0"  /* 怎么 */
+    "怎麼著\0"  /* 怎么着 */
+    "怒髮衝冠\0"  /* 怒发冲冠 */
+    "憐\0"  /* 怜 */
+    "思如泉湧\0"  /* 思如泉涌 */
+    "急衝而下\0"  /* 急冲而下 */
+    "性徵\0"  /* 性征 */
+    "性慾\0"  /* 性欲 */
+    "怪裡怪氣\0"  /* 怪里怪气 */
+    "怫鬱\0"  /* 怫郁 */
+    "總\0"  /* 总 */
+    "懟\0"  /* 怼 */
+    "懌\0"  /* 怿 */
+    "恂慄\0"  /* 恂栗 */
+    "戀\0"  /* 恋 */
+    "戀戀不捨\0"  /* 恋恋不舍 */
+    "恆\0"  /* 恒 */
+    "恒生\0"  /* 恒生 */
+    "恕乏价催\0"  /* 恕乏价催 */
+    "息交絕遊\0"  /* 息交绝游 */
+    "息穀\0"  /* 息谷 */
+    "恰纔\0"  /* 恰才 */
+    "懇\0"  /* 恳 */
+    "懇託\0"  /* 恳托 */
+    "惡\0"  /* 恶 */
+    "噁心\0"  /* 恶心 */
+    "惡鬥\0"  /* 恶斗 */
+    "惡直醜正\0"  /* 恶直丑正 */
+    "慟\0"  /* 恸 */
+    "懨\0"  /* 恹 */
+    "愷\0"  /* 恺 */
+    "惻\0"  /* 恻 */
+    "惱\0"  /* 恼 */
+    "惲\0"  /* 恽 */
+    "悍藥\0"  /* 悍药 */
+    "悒鬱\0"  /* 悒郁 */
+    "悠悠蕩蕩\0"  /* 悠悠荡荡 */
+    "悠遊\0"  /* 悠游 */
+    "悠蕩\0"  /* 悠荡 */
+    "悅\0"  /* 悦 */
+    "您剋制\0"  /* 您克制 */
+    "愨\0"  /* 悫 */
+    "懸\0"  /* 悬 */
+    "懸樑\0"  /* 悬梁 */
+    "懸臂樑\0"  /* 悬臂梁 */
+    "懸鐘\0"  /* 悬钟 */
+    "慳\0"  /* 悭 */
+    "憫\0"  /* 悯 */
+    "悲筑\0"  /* 悲筑 */
+    "悲鬱\0"  /* 悲郁 */
+    "悸慄\0"  /* 悸栗 */
+    "情慾\0"  /* 情欲 */
+    "惇樸\0"  /* 惇朴 */
+    "驚\0"  /* 惊 */
+    "驚讚\0"  /* 惊赞 */
+    "驚鐘\0"  /* 惊钟 */
+    "懼\0"  /* 惧 */
+    "慘\0"  /* 惨 */
+    "懲\0"  /* 惩 */
+    "憊\0"  /* 惫 */
+    "愜\0"  /* 惬 */
+    "慚\0"  /* 惭 */
+    "憚\0"  /* 惮 */
+    "慣\0"  /* 惯 */
+    "想剋制\0"  /* 想克制 */
+    "惴慄\0"  /* 惴栗 */
+    "癒合\0"  /* 愈合 */
+    "意剋制\0"  /* 意克制 */
+    "意佔\0"  /* 意占 */
+    "意大利麵\0"  /* 意大利面 */
+    "意麵\0"  /* 意面 */
+    "感冒藥\0"  /* 感冒药 */
+    "慍\0"  /* 愠 */
+    "憤\0"  /* 愤 */
+    "憒\0"  /* 愦 */
+    "願\0"  /* 愿 */
+    "愿樸\0"  /* 愿朴 */
+    "愿而恭\0"  /* 愿而恭 */
+    "慌裡慌張\0"  /* 慌里慌张 */
+    "懾\0"  /* 慑 */
+    "懈鬆\0"  /* 懈松 */
+    "懣\0"  /* 懑 */
+    "懶\0"  /* 懒 */
+    "懍\0"  /* 懔 */
+    "懍慄\0"  /* 懔栗 */
+    "懿範\0"  /* 懿范 */
+    "戇\0"  /* 戆 */
+    "戔\0"  /* 戋 */
+    "戲\0"  /* 戏 */
+    "戲綵娛親\0"  /* 戏彩娱亲 */
+    "戲裡\0"  /* 戏里 */
+    "成藥\0"  /* 成药 */
+    "我剋制\0"  /* 我克制 */
+    "戧\0"  /* 戗 */
+    "戰\0"  /* 战 */
+    "戰天鬥地\0"  /* 战天斗地 */
+    "戰鬥\0"  /* 战斗 */
+    "戰慄\0"  /* 战栗 */
+    "截髮\0"  /* 截发 */
+    "戩\0"  /* 戬 */
+    "戩穀\0"  /* 戬谷 */
+    "戱\0"  /* 戯 */
+    "戴髮含齒\0"  /* 戴发含齿 */
+    "戴錶\0"  /* 戴表 */
+    "戶\0"  /* 户 */
+    "房裡\0"  /* 房里 */
+    "所云\0"  /* 所云 */
+    "所云云\0"  /* 所云云 */
+    "所佔\0"  /* 所占 */
+    "所託\0"  /* 所托 */
+    "扁擬穀盜蟲\0"  /* 扁拟谷盗虫 */
+    "手塚治虫\0"  /* 手冢治虫 */
+    "手塚治虫\0"  /* 手塚治虫 */
+    "手摺\0"  /* 手折 */
+    "手鬆\0"  /* 手松 */
+    "手錶\0"  /* 手表 */
+    "手裡\0"  /* 手里 */
+    "手裏劍\0"  /* 手里剑 */
+    "才剋制\0"  /* 才克制 */
+    "纔則\0"  /* 才则 */
+    "才幹\0"  /* 才干 */
+    "纔得兩年\0"  /* 才得两年 */
+    "纔此\0"  /* 才此 */
+    "紮上\0"  /* 扎上 */
+    "紮下\0"  /* 扎下 */
+    "紮囮\0"  /* 扎囮 */
+    "紮好\0"  /* 扎好 */
+    "紮實\0"  /* 扎实 */
+    "紮寨\0"  /* 扎寨 */
+    "紮帶子\0"  /* 扎带子 */
+    "紮成\0"  /* 扎成 */
+    "紮根\0"  /* 扎根 */
+    "紮緊\0"  /* 扎紧 */
+    "紮腳\0"  /* 扎脚 */
+    "紮營\0"  /* 扎营 */
+    "紮裹\0"  /* 扎裹 */
+    "紮詐\0"  /* 扎诈 */
+    "紮起\0"  /* 扎起 */
+    "紮鐵\0"  /* 扎铁 */
+    "撲\0"  /* 扑 */
+    "扑作教刑\0"  /* 扑作教刑 */
+    "撲鼕\0"  /* 扑冬 */
+    "撲鼕鼕\0"  /* 扑冬冬 */
+    "扑打\0"  /* 扑打 */
+    "扑撻\0"  /* 扑挞 */
+    "打出弔入\0"  /* 打出吊入 */
+    "打卡鐘\0"  /* 打卡钟 */
+    "打吨\0"  /* 打吨 */
+    "打幹\0"  /* 打干 */
+    "打乾噦\0"  /* 打干哕 */
+    "打併\0"  /* 打并 */
+    "打拚\0"  /* 打拼 */
+    "打鬥\0"  /* 打斗 */
+    "打著鐘\0"  /* 打着钟 */
+    "打穀\0"  /* 打谷 */
+    "打路莊板\0"  /* 打路庄板 */
+    "打鐘\0"  /* 打钟 */
+    "託買\0"  /* 托买 */
+    "託了\0"  /* 托了 */
+    "託事\0"  /* 托事 */
+    "託交\0"  /* 托交 */
+    "託人\0"  /* 托人 */
+    "託付\0"  /* 托付 */
+    "託兒所\0"  /* 托儿所 */
+    "託賣\0"  /* 托卖 */
+    "託古諷今\0"  /* 托古讽今 */
+    "託名\0"  /* 托名 */
+    "託命\0"  /* 托命 */
+    "託咎\0"  /* 托咎 */
+    "託大\0"  /* 托大 */
+    "託孤\0"  /* 托孤 */
+    "託庇\0"  /* 托庇 */
+    "託故\0"  /* 托故 */
+    "託夢\0"  /* 托梦 */
+    "託疾\0"  /* 托疾 */
+    "託病\0"  /* 托病 */
+    "託管\0"  /* 托管 */
+    "託言\0"  /* 托言 */
+    "託詞\0"  /* 托词 */
+    "託身\0"  /* 托身 */
+    "託辭\0"  /* 托辞 */
+    "託過\0"  /* 托过 */
+    "託運\0"  /* 托运 */
+    "託附\0"  /* 托附 */
+    "扛大樑\0"  /* 扛大梁 */
+    "扞禦\0"  /* 扞御 */
+    "執\0"  /* 执 */
+    "擴\0"  /* 扩 */
+    "捫\0"  /* 扪 */
+    "掃\0"  /* 扫 */
+    "掃蕩\0"  /* 扫荡 */
+    "揚\0"  /* 扬 */
+    "扯麵\0"  /* 扯面 */
+    "擾\0"  /* 扰 */
+    "扶餘國\0"  /* 扶余国 */
+    "批複\0"  /* 批复 */
+    "批鬥\0"  /* 批斗 */
+    "批註\0"  /* 批注 */
+    "承製\0"  /* 承制 */
+    "抑鬱\0"  /* 抑郁 */
+    "抓姦\0"  /* 抓奸 */
+    "抓鬥\0"  /* 抓斗 */
+    "抓藥\0"  /* 抓药 */
+    "投藥\0"  /* 投药 */
+    "抗禦\0"  /* 抗御 */
+    "抗癌藥\0"  /* 抗癌药 */
+    "抗藥\0"  /* 抗药 */
+    "折衝\0"  /* 折冲 */
+    "摺疊\0"  /* 折叠 */
+    "摺合\0"  /* 折合 */
+    "摺奏\0"  /* 折奏 */
+    "摺子\0"  /* 折子 */
+    "摺尺\0"  /* 折尺 */
+    "摺扇\0"  /* 折扇 */
+    "摺梯\0"  /* 折梯 */
+    "摺椅\0"  /* 折椅 */
+    "摺痕\0"  /* 折痕 */
+    "摺篷\0"  /* 折篷 */
+    "摺紙\0"  /* 折纸 */
+    "摺裙\0"  /* 折裙 */
+    "撫\0"  /* 抚 */
+    "拋\0"  /* 抛 */
+    "摶\0"  /* 抟 */
+    "摳\0"  /* 抠 */
+    "掄\0"  /* 抡 */
+    "搶\0"  /* 抢 */
+    "搶佔\0"  /* 抢占 */
+    "護\0"  /* 护 */
+    "護髮\0"  /* 护发 */
+    "報\0"  /* 报 */
+    "披髮\0"  /* 披发 */
+    "披頭散髮\0"  /* 披头散发 */
+    "披榛採蘭\0"  /* 披榛采兰 */
+    "抱素懷樸\0"  /* 抱素怀朴 */
+    "抵禦\0"  /* 抵御 */
+    "抹乾\0"  /* 抹干 */
+    "抽公籤\0"  /* 抽公签 */
+    "抽籤\0"  /* 抽签 */
+    "抿髮\0"  /* 抿发 */
+    "拂鐘無聲\0"  /* 拂钟无声 */
+    "擔\0"  /* 担 */
+    "擔仔麵\0"  /* 担仔面 */
+    "擔擔麵\0"  /* 担担面 */
+    "擔著\0"  /* 担着 */
+    "擔負著\0"  /* 担负着 */
+    "拆夥\0"  /* 拆伙 */
+    "拈鬚\0"  /* 拈须 */
+    "拉克施爾德鐘\0"  /* 拉克施尔德钟 */
+    "拉杆\0"  /* 拉杆 */
+    "拉縴\0"  /* 拉纤 */
+    "拉麵\0"  /* 拉面 */
+    "拓樸\0"  /* 拓朴 */
+    "拔髮\0"  /* 拔发 */
+    "拔鬚\0"  /* 拔须 */
+    "拗彆\0"  /* 拗别 */
+    "拙樸\0"  /* 拙朴 */
+    "拜託\0"  /* 拜托 */
+    "擬\0"  /* 拟 */
+    "攏\0"  /* 拢 */
+    "揀\0"  /* 拣 */
+    "擁\0"  /* 拥 */
+    "攔\0"  /* 拦 */
+    "擰\0"  /* 拧 */
+    "擰乾\0"  /* 拧干 */
+    "撥\0"  /* 拨 */
+    "撥穀\0"  /* 拨谷 */
+    "擇\0"  /* 择 */
+    "括髮\0"  /* 括发 */
+    "拭乾\0"  /* 拭干 */
+    "拮据\0"  /* 拮据 */
+    "拚卻\0"  /* 拼却 */
+    "拚命\0"  /* 拼命 */
+    "拚鬥\0"  /* 拼斗 */
+    "拚死\0"  /* 拼死 */
+    "拚生盡死\0"  /* 拼生尽死 */
+    "拚絕\0"  /* 拼绝 */
+    "拚老命\0"  /* 拼老命 */
+    "拚捨\0"  /* 拼舍 */
+    "拾瀋\0"  /* 拾沈 */
+    "拿下錶\0"  /* 拿下表 */
+    "拿下鐘\0"  /* 拿下钟 */
+    "拿準\0"  /* 拿准 */
+    "拿破崙\0"  /* 拿破仑 */
+    "掛\0"  /* 挂 */
+    "掛曆\0"  /* 挂历 */
+    "挂號\0"  /* 挂号 */
+    "挂圖\0"  /* 挂图 */
+    "挂帥\0"  /* 挂帅 */
+    "掛帘\0"  /* 挂帘 */
+    "挂彩\0"  /* 挂彩 */
+    "挂念\0"  /* 挂念 */
+    "挂車\0"  /* 挂车 */
+    "掛鐘\0"  /* 挂钟 */
+    "掛鈎\0"  /* 挂钩 */
+    "挂面\0"  /* 挂面 */
+    "挌鬥\0"  /* 挌斗 */
+    "挑大樑\0"  /* 挑大梁 */
+    "挑鬥\0"  /* 挑斗 */
+    "摯\0"  /* 挚 */
+    "攣\0"  /* 挛 */
+    "撾\0"  /* 挝 */
+    "撻\0"  /* 挞 */
+    "挾\0"  /* 挟 */
+    "撓\0"  /* 挠 */
+    "擋\0"  /* 挡 */
+    "撟\0"  /* 挢 */
+    "掙\0"  /* 挣 */
+    "擠\0"  /* 挤 */
+    "揮\0"  /* 挥 */
+    "揮杆\0"  /* 挥杆 */
+    "振蕩\0"  /* 振荡 */
+    "輓曲\0"  /* 挽曲 */
+    "輓歌\0"  /* 挽歌 */
+    "輓聯\0"  /* 挽联 */
+    "輓聯\0"  /* 挽聯 */
+    "輓詞\0"  /* 挽詞 */
+    "輓詩\0"  /* 挽詩 */
+    "輓詞\0"  /* 挽词 */
+    "輓詩\0"  /* 挽诗 */
+    "捆紮\0"  /* 捆扎 */
+    "捉髮\0"  /* 捉发 */
+    "捉姦\0"  /* 捉奸 */
+    "捍禦\0"  /* 捍御 */
+    "捏麵人\0"  /* 捏面人 */
+    "撈\0"  /* 捞 */
+    "撈乾\0"  /* 捞干 */
+    "撈麵\0"  /* 捞面 */
+    "損\0"  /* 损 */
+    "撿\0"  /* 捡 */
+    "換\0"  /* 换 */
+    "換髮\0"  /* 换发 */
+    "換隻\0"  /* 换只 */
+    "換籤\0"  /* 换签 */
+    "換藥\0"  /* 换药 */
+    "搗\0"  /* 捣 */
+    "搗鬼弔白\0"  /* 捣鬼吊白 */
+    "據\0"  /* 据 */
+    "據云\0"  /* 据云 */
+    "據榦而窺井底\0"  /* 据干而窥井底 */
+    "捵麵\0"  /* 捵面 */
+    "捶鍊\0"  /* 捶炼 */
+    "掌柜\0"  /* 掌柜 */
+    "排骨麵\0"  /* 排骨面 */
+    "掣籤\0"  /* 掣签 */
+    "接著說\0"  /* 接着说 */
+    "推情準理\0"  /* 推情准理 */
+    "推託\0"  /* 推托 */
+    "擄\0"  /* 掳 */
+    "摑\0"  /* 掴 */
+    "擲\0"  /* 掷 */
+    "撣\0"  /* 掸 */
+    "摻\0"  /* 掺 */
+    "摜\0"  /* 掼 */
+    "提子乾\0"  /* 提子干 */
+    "提心弔膽\0"  /* 提心吊胆 */
+    "握髮\0"  /* 握发 */
+    "揩乾\0"  /* 揩干 */
+    "揪髮\0"  /* 揪发 */
+    "揪採\0"  /* 揪采 */
+    "揪鬚\0"  /* 揪须 */
+    "揭醜\0"  /* 揭丑 */
+    "攬\0"  /* 揽 */
+    "撳\0"  /* 揿 */
+    "攙\0"  /* 搀 */
+    "擱\0"  /* 搁 */
+    "摟\0"  /* 搂 */
+    "攪\0"  /* 搅 */
+    "搋麵\0"  /* 搋面 */
+    "搏鬥\0"  /* 搏斗 */
+    "搤肮拊背\0"  /* 搤肮拊背 */
+    "搬鬥\0"  /* 搬斗 */
+    "搭夥\0"  /* 搭伙 */
+    "搭乾鋪\0"  /* 搭干铺 */
+    "攜\0"  /* 携 */
+    "搽藥\0"  /* 搽药 */
+    "攝\0"  /* 摄 */
+    "攝製\0"  /* 摄制 */
+    "攄\0"  /* 摅 */
+    "擺\0"  /* 摆 */
+    "擺鐘\0"  /* 摆钟 */
+    "搖\0"  /* 摇 */
+    "搖搖蕩蕩\0"  /* 摇摇荡荡 */
+    "搖蕩\0"  /* 摇荡 */
+    "擯\0"  /* 摈 */
+    "攤\0"  /* 摊 */
+    "摧堅獲醜\0"  /* 摧坚获丑 */
+    "摭採\0"  /* 摭采 */
+    "摸稜\0"  /* 摸棱 */
+    "摸鐘\0"  /* 摸钟 */
+    "攖\0"  /* 撄 */
+    "撇弔\0"  /* 撇吊 */
+    "撐\0"  /* 撑 */
+    "撚鬚\0"  /* 撚须 */
+    "撞球檯\0"  /* 撞球台 */
+    "撞鐘\0"  /* 撞钟 */
+    "撞陣衝軍\0"  /* 撞阵冲军 */
+    "撤併\0"  /* 撤并 */
+    "撩鬥\0"  /* 撩斗 */
+    "攆\0"  /* 撵 */
+    "擷\0"  /* 撷 */
+    "擼\0"  /* 撸 */
+    "攛\0"  /* 撺 */
+    "擀麵\0"  /* 擀面 */
+    "操作鐘\0"  /* 操作钟 */
+    "擻\0"  /* 擞 */
+    "擢髮\0"  /* 擢发 */
+    "擦乾\0"  /* 擦干 */
+    "擦乾淨\0"  /* 擦干净 */
+    "擦藥\0"  /* 擦药 */
+    "攢\0"  /* 攒 */
+    "支幹\0"  /* 支干 */
+    "支杆\0"  /* 支杆 */
+    "收穫\0"  /* 收获 */
+    "改徵\0"  /* 改征 */
+    "攻佔\0"  /* 攻占 */
+    "放鬆\0"  /* 放松 */
+    "放蕩\0"  /* 放荡 */
+    "放懞掙\0"  /* 放蒙挣 */
+    "故事裡\0"  /* 故事里 */
+    "故云\0"  /* 故云 */
+    "敵\0"  /* 敌 */
+    "敵愾同讎\0"  /* 敌忾同仇 */
+    "救藥\0"  /* 救药 */
+    "教學鐘\0"  /* 教学钟 */
+    "教範\0"  /* 教范 */
+    "斂\0"  /* 敛 */
+    "敢幹\0"  /* 敢干 */
+    "散夥\0"  /* 散伙 */
+    "散蕩\0"  /* 散荡 */
+    "敦樸\0"  /* 敦朴 */
+    "敬輓\0"  /* 敬挽 */
+    "數\0"  /* 数 */
+    "數與虜确\0"  /* 数与虏确 */
+    "數字鐘\0"  /* 数字钟 */
+    "數罪併罰\0"  /* 数罪并罚 */
+    "敲扑\0"  /* 敲扑 */
+    "敲鐘\0"  /* 敲钟 */
+    "整髮用品\0"  /* 整发用品 */
+    "整隻\0"  /* 整只 */
+    "整莊\0"  /* 整庄 */
+    "敷藥\0"  /* 敷药 */
+    "文徵明\0"  /* 文征明 */
+    "文思泉湧\0"  /* 文思泉涌 */
+    "齋\0"  /* 斋 */
+    "斕\0"  /* 斓 */
+    "鬥上\0"  /* 斗上 */
+    "鬥不過\0"  /* 斗不过 */
+    "鬥麗\0"  /* 斗丽 */
+    "鬥了\0"  /* 斗了 */
+    "鬥爭\0"  /* 斗争 */
+    "鬥倒\0"  /* 斗倒 */
+    "鬥分子\0"  /* 斗分子 */
+    "鬥彆氣\0"  /* 斗别气 */
+    "鬥力\0"  /* 斗力 */
+    "鬥勁\0"  /* 斗劲 */
+    "鬥疊\0"  /* 斗叠 */
+    "鬥口\0"  /* 斗口 */
+    "鬥葉兒\0"  /* 斗叶儿 */
+    "鬥葉子\0"  /* 斗叶子 */
+    "鬥合\0"  /* 斗合 */
+    "鬥鬨\0"  /* 斗哄 */
+    "鬥嘴\0"  /* 斗嘴 */
+    "鬥地主\0"  /* 斗地主 */
+    "鬥士\0"  /* 斗士 */
+    "鬥頭\0"  /* 斗头 */
+    "鬥富\0"  /* 斗富 */
+    "鬥巧\0"  /* 斗巧 */
+    "鬥幌子\0"  /* 斗幌子 */
+    "鬥弄\0"  /* 斗弄 */
+    "鬥引\0"  /* 斗引 */
+    "鬥彩\0"  /* 斗彩 */
+    "鬥心眼\0"  /* 斗心眼 */
+    "鬥志\0"  /* 斗志 */
+    "鬥成\0"  /* 斗成 */
+    "鬥打\0"  /* 斗打 */
+    "鬥批改\0"  /* 斗批改 */
+    "鬥技\0"  /* 斗技 */
+    "鬥文\0"  /* 斗文 */
+    "鬥鬥\0"  /* 斗斗 */
+    "鬥智\0"  /* 斗智 */
+    "鬥暴\0"  /* 斗暴 */
+    "鬥來鬥去\0"  /* 斗来斗去 */
+    "鬥武\0"  /* 斗武 */
+    "鬥毆\0"  /* 斗殴 */
+    "鬥氣\0"  /* 斗气 */
+    "鬥法\0"  /* 斗法 */
+    "鬥牌\0"  /* 斗牌 */
+    "鬥牙拌齒\0"  /* 斗牙拌齿 */
+    "鬥牙鬥齒\0"  /* 斗牙斗齿 */
+    "鬥牛\0"  /* 斗牛 */
+    "鬥犀臺\0"  /* 斗犀台 */
+    "鬥犬\0"  /* 斗犬 */
+    "鬥狠\0"  /* 斗狠 */
+    "鬥百草\0"  /* 斗百草 */
+    "鬥眼\0"  /* 斗眼 */
+    "鬥著\0"  /* 斗着 */
+    "鬥私批修\0"  /* 斗私批修 */
+    "鬥而鑄兵\0"  /* 斗而铸兵 */
+    "鬥而鑄錐\0"  /* 斗而铸锥 */
+    "鬥勝\0"  /* 斗胜 */
+    "鬥腳\0"  /* 斗脚 */
+    "鬥艦\0"  /* 斗舰 */
+    "鬥豔\0"  /* 斗艳 */
+    "鬥茶\0"  /* 斗茶 */
+    "鬥草\0"  /* 斗草 */
+    "鬥蟋蟀\0"  /* 斗蟋蟀 */
+    "鬥話\0"  /* 斗话 */
+    "鬥起\0"  /* 斗起 */
+    "鬥趣\0"  /* 斗趣 */
+    "鬥閑氣\0"  /* 斗闲气 */
+    "鬥悶\0"  /* 斗闷 */
+    "鬥雪紅\0"  /* 斗雪红 */
+    "鬥風\0"  /* 斗风 */
+    "鬥魚\0"  /* 斗鱼 */
+    "鬥雞\0"  /* 斗鸡 */
+    "鬥鴨\0"  /* 斗鸭 */
+    "鬥鵪鶉\0"  /* 斗鹌鹑 */
+    "斬\0"  /* 斩 */
+    "斫雕為樸\0"  /* 斫雕为朴 */
+    "斷\0"  /* 断 */
+    "斷髮\0"  /* 断发 */
+    "新曆\0"  /* 新历 */
+    "新莊\0"  /* 新庄 */
+    "新紮\0"  /* 新扎 */
+    "斲雕為樸\0"  /* 斲雕为朴 */
+    "方便麵\0"  /* 方便面 */
+    "方几\0"  /* 方几 */
+    "方誌\0"  /* 方志 */
+    "施捨\0"  /* 施舍 */
+    "施藥\0"  /* 施药 */
+    "旁徵博引\0"  /* 旁征博引 */
+    "旁註\0"  /* 旁注 */
+    "旅遊\0"  /* 旅游 */
+    "旋迴\0"  /* 旋回 */
+    "旋乾轉坤\0"  /* 旋干转坤 */
+    "旋繞著\0"  /* 旋绕着 */
+    "族裡\0"  /* 族里 */
+    "旗杆\0"  /* 旗杆 */
+    "無\0"  /* 无 */
+    "無餘\0"  /* 无余 */
+    "無徵不信\0"  /* 无征不信 */
+    "無樑樓蓋\0"  /* 无梁楼盖 */
+    "無法剋制\0"  /* 无法克制 */
+    "無藥可救\0"  /* 无药可救 */
+    "日佔\0"  /* 日占 */
+    "日曆\0"  /* 日历 */
+    "日子裡\0"  /* 日子里 */
+    "日心曆表\0"  /* 日心历表 */
+    "日誌\0"  /* 日志 */
+    "日晒\0"  /* 日晒 */
+    "舊\0"  /* 旧 */
+    "舊曆\0"  /* 旧历 */
+    "舊遊\0"  /* 旧游 */
+    "舊藥\0"  /* 旧药 */
+    "舊錶\0"  /* 旧表 */
+    "舊鐘\0"  /* 旧钟 */
+    "舊鐘錶\0"  /* 旧钟表 */
+    "旱乾\0"  /* 旱干 */
+    "時\0"  /* 时 */
+    "時鐘\0"  /* 时钟 */
+    "時間裡\0"  /* 时间里 */
+    "曠\0"  /* 旷 */
+    "崑崙\0"  /* 昆仑 */
+    "昆崙山\0"  /* 昆仑山 */
+    "崑劇\0"  /* 昆剧 */
+    "崑山\0"  /* 昆山 */
+    "崑曲\0"  /* 昆曲 */
+    "崑腔\0"  /* 昆腔 */
+    "崑蘇\0"  /* 昆苏 */
+    "崑調\0"  /* 昆调 */
+    "明徵\0"  /* 明征 */
+    "明目張胆\0"  /* 明目张胆 */
+    "明窗淨几\0"  /* 明窗净几 */
+    "明範\0"  /* 明范 */
+    "明裡\0"  /* 明里 */
+    "易剋制\0"  /* 易克制 */
+    "曇\0"  /* 昙 */
+    "星曆\0"  /* 星历 */
+    "星辰錶\0"  /* 星辰表 */
+    "春假裡\0"  /* 春假里 */
+    "春天裡\0"  /* 春天里 */
+    "春日裡\0"  /* 春日里 */
+    "春遊\0"  /* 春游 */
+    "春藥\0"  /* 春药 */
+    "春香鬥學\0"  /* 春香斗学 */
+    "晝\0"  /* 昼 */
+    "顯\0"  /* 显 */
+    "顯示錶\0"  /* 显示表 */
+    "顯示鐘\0"  /* 显示钟 */
+    "晃蕩\0"  /* 晃荡 */
+    "晉\0"  /* 晋 */
+    "晉陞\0"  /* 晋升 */
+    "曬\0"  /* 晒 */
+    "晒傷\0"  /* 晒伤 */
+    "晒圖\0"  /* 晒图 */
+    "晒乾\0"  /* 晒干 */
+    "晒成\0"  /* 晒成 */
+    "晒晒\0"  /* 晒晒 */
+    "晒煙\0"  /* 晒烟 */
+    "晒種\0"  /* 晒种 */
+    "晒衣\0"  /* 晒衣 */
+    "曬穀\0"  /* 晒谷 */
+    "晒黑\0"  /* 晒黑 */
+    "曉\0"  /* 晓 */
+    "曄\0"  /* 晔 */
+    "暈\0"  /* 晕 */
+    "暈船藥\0"  /* 晕船药 */
+    "暈車藥\0"  /* 晕车药 */
+    "暉\0"  /* 晖 */
+    "晚鐘\0"  /* 晚钟 */
+    "晞髮\0"  /* 晞发 */
+    "晨鐘\0"  /* 晨钟 */
+    "普鼕鼕\0"  /* 普冬冬 */
+    "景緻\0"  /* 景致 */
+    "晾乾\0"  /* 晾干 */
+    "暫\0"  /* 暂 */
+    "暑假裡\0"  /* 暑假里 */
+    "暗地裡\0"  /* 暗地里 */
+    "暗鬥\0"  /* 暗斗 */
+    "暗溝裡\0"  /* 暗沟里 */
+    "暗裡\0"  /* 暗里 */
+    "曖\0"  /* 暧 */
+    "暴斂橫徵\0"  /* 暴敛横征 */
+    "暴晒\0"  /* 暴晒 */
+    "曝晒\0"  /* 曝晒 */
+    "曰云\0"  /* 曰云 */
+    "麴塵\0"  /* 曲尘 */
+    "麴生\0"  /* 曲生 */
+    "麴秀才\0"  /* 曲秀才 */
+    "麴菌\0"  /* 曲菌 */
+    "麴櫱\0"  /* 曲蘖 */
+    "麴車\0"  /* 曲车 */
+    "麴道士\0"  /* 曲道士 */
+    "麴錢\0"  /* 曲钱 */
+    "麴院\0"  /* 曲院 */
+    "麴黴\0"  /* 曲霉 */
+    "更僕難數\0"  /* 更仆难数 */
+    "更籤\0"  /* 更签 */
+    "更鐘\0"  /* 更钟 */
+    "曾樸\0"  /* 曾朴 */
+    "月曆\0"  /* 月历 */
+    "月球曆表\0"  /* 月球历表 */
+    "有事之無範\0"  /* 有事之无范 */
+    "有僕\0"  /* 有仆 */
+    "有餘\0"  /* 有余 */
+    "有準\0"  /* 有准 */
+    "有髮頭陀寺\0"  /* 有发头陀寺 */
+    "有隻\0"  /* 有只 */
+    "有只採\0"  /* 有只采 */
+    "有夠讚\0"  /* 有够赞 */
+    "有徵\0"  /* 有征 */
+    "有恒街\0"  /* 有恒街 */
+    "有栖川\0"  /* 有栖川 */
+    "有稜有角\0"  /* 有棱有角 */
+    "服藥\0"  /* 服药 */
+    "望后石\0"  /* 望后石 */
+    "望著錶\0"  /* 望着表 */
+    "望著鐘\0"  /* 望着钟 */
+    "望著鐘錶\0"  /* 望着钟表 */
+    "朝鐘\0"  /* 朝钟 */
+    "木偶戲紮\0"  /* 木偶戏扎 */
+    "木製\0"  /* 木制 */
+    "木杆\0"  /* 木杆 */
+    "木材乾餾\0"  /* 木材干馏 */
+    "木樑\0"  /* 木梁 */
+    "木鐘\0"  /* 木钟 */
+    "未乾\0"  /* 未干 */
+    "末藥\0"  /* 末药 */
+    "本徵\0"  /* 本征 */
+    "術\0"  /* 术 */
+    "朮赤\0"  /* 术赤 */
+    "朱崙街\0"  /* 朱仑街 */
+    "硃唇皓齒\0"  /* 朱唇皓齿 */
+    "朱慶餘\0"  /* 朱庆余 */
+    "硃批\0"  /* 朱批 */
+    "朱理安曆\0"  /* 朱理安历 */
+    "硃砂\0"  /* 朱砂 */
+    "硃筆\0"  /* 朱笔 */
+    "硃紅色\0"  /* 朱红色 */
+    "硃色\0"  /* 朱色 */
+    "硃諭\0"  /* 朱谕 */
+    "樸修斯\0"  /* 朴修斯 */
+    "樸厚\0"  /* 朴厚 */
+    "樸學\0"  /* 朴学 */
+    "樸實\0"  /* 朴实 */
+    "樸念仁\0"  /* 朴念仁 */
+    "樸拙\0"  /* 朴拙 */
+    "樸樕\0"  /* 朴樕 */
+    "樸父\0"  /* 朴父 */
+    "樸直\0"  /* 朴直 */
+    "樸素\0"  /* 朴素 */
+    "樸訥\0"  /* 朴讷 */
+    "樸質\0"  /* 朴质 */
+    "樸鄙\0"  /* 朴鄙 */
+    "樸重\0"  /* 朴重 */
+    "樸野\0"  /* 朴野 */
+    "樸鈍\0"  /* 朴钝 */
+    "樸陋\0"  /* 朴陋 */
+    "樸馬\0"  /* 朴马 */
+    "樸魯\0"  /* 朴鲁 */
+    "機\0"  /* 机 */
+    "機械錶\0"  /* 机械表 */
+    "機械鐘\0"  /* 机械钟 */
+    "機繡\0"  /* 机绣 */
+    "殺\0"  /* 杀 */
+    "殺蟲藥\0"  /* 杀虫药 */
+    "雜\0"  /* 杂 */
+    "雜合麵兒\0"  /* 杂合面儿 */
+    "雜誌\0"  /* 杂志 */
+    "雜麵\0"  /* 杂面 */
+    "權\0"  /* 权 */
+    "桿\0"  /* 杆 */
+    "杆子\0"  /* 杆子 */
+    "李連杰\0"  /* 李连杰 */
+    "李連杰\0"  /* 李連杰 */
+    "材幹\0"  /* 材干 */
+    "村子裡\0"  /* 村子里 */
+    "村莊\0"  /* 村庄 */
+    "村裡\0"  /* 村里 */
+    "杜老誌道\0"  /* 杜老志道 */
+    "杞宋無徵\0"  /* 杞宋无征 */
+    "束髮\0"  /* 束发 */
+    "槓桿\0"  /* 杠杆 */
+    "條\0"  /* 条 */
+    "條幹\0"  /* 条干 */
+    "來\0"  /* 来 */
+    "來複\0"  /* 来复 */
+    "楊\0"  /* 杨 */
+    "楊雅筑\0"  /* 杨雅筑 */
+    "榪\0"  /* 杩 */
+    "杯乾\0"  /* 杯干 */
+    "杯麵\0"  /* 杯面 */
+    "傑\0"  /* 杰 */
+    "杰倫\0"  /* 杰伦 */
+    "杰威爾音樂\0"  /* 杰威尔音乐 */
+    "杰威爾音樂\0"  /* 杰威爾音樂 */
+    "杰特\0"  /* 杰特 */
+    "鬆一口氣\0"  /* 松一口气 */
+    "鬆了\0"  /* 松了 */
+    "鬆些\0"  /* 松些 */
+    "鬆元音\0"  /* 松元音 */
+    "鬆動\0"  /* 松动 */
+    "鬆勁\0"  /* 松劲 */
+    "鬆口\0"  /* 松口 */
+    "鬆喉\0"  /* 松喉 */
+    "鬆土\0"  /* 松土 */
+    "鬆寬\0"  /* 松宽 */
+    "鬆開\0"  /* 松开 */
+    "鬆弛\0"  /* 松弛 */
+    "鬆快\0"  /* 松快 */
+    "鬆懈\0"  /* 松懈 */
+    "鬆手\0"  /* 松手 */
+    "鬆掉\0"  /* 松掉 */
+    "鬆散\0"  /* 松散 */
+    "鬆鬆\0"  /* 松松 */
+    "鬆柔\0"  /* 松柔 */
+    "鬆氣\0"  /* 松气 */
+    "鬆浮\0"  /* 松浮 */
+    "鬆緊\0"  /* 松紧 */
+    "鬆綁\0"  /* 松绑 */
+    "鬆緩\0"  /* 松缓 */
+    "鬆脆\0"  /* 松脆 */
+    "鬆脫\0"  /* 松脱 */
+    "鬆蛋\0"  /* 松蛋 */
+    "鬆起\0"  /* 松起 */
+    "鬆軟\0"  /* 松软 */
+    "鬆通\0"  /* 松通 */
+    "鬆餅\0"  /* 松饼 */
+    "板著臉\0"  /* 板着脸 */
+    "板蕩\0"  /* 板荡 */
+    "極\0"  /* 极 */
+    "構\0"  /* 构 */
+    "林宏嶽\0"  /* 林宏岳 */
+    "林鐘\0"  /* 林钟 */
+    "果子乾\0"  /* 果子干 */
+    "果乾\0"  /* 果干 */
+    "枝不得大於榦\0"  /* 枝不得大于干 */
+    "枝幹\0"  /* 枝干 */
+    "樅\0"  /* 枞 */
+    "樞\0"  /* 枢 */
+    "棗\0"  /* 枣 */
+    "棗莊\0"  /* 枣庄 */
+    "櫪\0"  /* 枥 */
+    "棖\0"  /* 枨 */
+    "槍\0"  /* 枪 */
+    "楓\0"  /* 枫 */
+    "梟\0"  /* 枭 */
+    "枯乾\0"  /* 枯干 */
+    "架鐘\0"  /* 架钟 */
+    "某隻\0"  /* 某只 */
+    "染髮\0"  /* 染发 */
+    "染殿后\0"  /* 染殿后 */
+    "櫃\0"  /* 柜 */
+    "柜上\0"  /* 柜上 */
+    "櫃檯\0"  /* 柜台 */
+    "柜子\0"  /* 柜子 */
+    "柜柳\0"  /* 柜柳 */
+    "檸\0"  /* 柠 */
+    "柱樑\0"  /* 柱梁 */
+    "柳詒徵\0"  /* 柳诒征 */
+    "檉\0"  /* 柽 */
+    "梔\0"  /* 栀 */
+    "柵\0"  /* 栅 */
+    "標\0"  /* 标 */
+    "標準\0"  /* 标准 */
+    "標誌\0"  /* 标志 */
+    "標杆\0"  /* 标杆 */
+    "標註\0"  /* 标注 */
+    "標籤\0"  /* 标签 */
+    "標緻\0"  /* 标致 */
+    "棧\0"  /* 栈 */
+    "櫛\0"  /* 栉 */
+    "櫛髮工\0"  /* 栉发工 */
+    "櫳\0"  /* 栊 */
+    "棟\0"  /* 栋 */
+    "棟樑\0"  /* 栋梁 */
+    "櫨\0"  /* 栌 */
+    "櫟\0"  /* 栎 */
+    "欄\0"  /* 栏 */
+    "欄杆\0"  /* 栏杆 */
+    "樹\0"  /* 树 */
+    "樹榦\0"  /* 树干 */
+    "樹樑\0"  /* 树梁 */
+    "棲\0"  /* 栖 */
+    "栖栖皇皇\0"  /* 栖栖皇皇 */
+    "慄冽\0"  /* 栗冽 */
+    "慄慄\0"  /* 栗栗 */
+    "校讎\0"  /* 校仇 */
+    "校準\0"  /* 校准 */
+    "樣\0"  /* 样 */
+    "樣範\0"  /* 样范 */
+    "格鬥\0"  /* 格斗 */
+    "格範\0"  /* 格范 */
+    "格里曆\0"  /* 格里历 */
+    "格里高利曆\0"  /* 格里高利历 */
+    "欒\0"  /* 栾 */
+    "桂圓乾\0"  /* 桂圆干 */
+    "桅杆\0"  /* 桅杆 */
+    "桌几\0"  /* 桌几 */
+    "桌曆\0"  /* 桌历 */
+    "桑乾\0"  /* 桑干 */
+    "椏\0"  /* 桠 */
+    "橈\0"  /* 桡 */
+    "楨\0"  /* 桢 */
+    "楨幹\0"  /* 桢干 */
+    "檔\0"  /* 档 */
+    "榿\0"  /* 桤 */
+    "橋\0"  /* 桥 */
+    "橋樑\0"  /* 桥梁 */
+    "樺\0"  /* 桦 */
+    "檜\0"  /* 桧 */
+    "槳\0"  /* 桨 */
+    "樁\0"  /* 桩 */
+    "樑上\0"  /* 梁上 */
+    "樑柱\0"  /* 梁柱 */
+    "夢\0"  /* 梦 */
+    "夢遊\0"  /* 梦游 */
+    "夢裡\0"  /* 梦里 */
+    "梨乾\0"  /* 梨干 */
+    "梯衝\0"  /* 梯冲 */
+    "械鬥\0"  /* 械斗 */
+    "械繫\0"  /* 械系 */
+    "檮\0"  /* 梼 */
+    "檢\0"  /* 检 */
+    "欞\0"  /* 棂 */
+    "棉製\0"  /* 棉制 */
+    "棒子麵\0"  /* 棒子面 */
+    "棫樸\0"  /* 棫朴 */
+    "森林裡\0"  /* 森林里 */
+    "稜體\0"  /* 棱体 */
+    "稜台\0"  /* 棱台 */
+    "稜子\0"  /* 棱子 */
+    "稜層\0"  /* 棱层 */
+    "稜柱\0"  /* 棱柱 */
+    "稜稜\0"  /* 棱棱 */
+    "稜登\0"  /* 棱登 */
+    "稜等登\0"  /* 棱等登 */
+    "稜線\0"  /* 棱线 */
+    "稜縫\0"  /* 棱缝 */
+    "稜角\0"  /* 棱角 */
+    "稜錐\0"  /* 棱锥 */
+    "稜鏡\0"  /* 棱镜 */
+    "棺材裡\0"  /* 棺材里 */
+    "槨\0"  /* 椁 */
+    "植髮\0"  /* 植发 */
+    "櫝\0"  /* 椟 */
+    "槧\0"  /* 椠 */
+    "欏\0"  /* 椤 */
+    "橢\0"  /* 椭 */
+    "椰棗乾\0"  /* 椰枣干 */
+    "楊雅筑\0"  /* 楊雅筑 */
+    "楚莊王\0"  /* 楚庄王 */
+    "楚莊絕纓\0"  /* 楚庄绝缨 */
+    "楚莊問鼎\0"  /* 楚庄问鼎 */
+    "樓\0"  /* 楼 */
+    "欖\0"  /* 榄 */
+    "櫬\0"  /* 榇 */
+    "櫚\0"  /* 榈 */
+    "櫸\0"  /* 榉 */
+    "榨乾\0"  /* 榨干 */
+    "檻\0"  /* 槛 */
+    "檳\0"  /* 槟 */
+    "櫧\0"  /* 槠 */
+    "模製\0"  /* 模制 */
+    "模稜\0"  /* 模棱 */
+    "模範\0"  /* 模范 */
+    "橫\0"  /* 横 */
+    "橫衝\0"  /* 横冲 */
+    "橫徵暴斂\0"  /* 横征暴敛 */
+    "橫杆\0"  /* 横杆 */
+    "橫樑\0"  /* 横梁 */
+    "檣\0"  /* 樯 */
+    "櫻\0"  /* 樱 */
+    "樵採\0"  /* 樵采 */
+    "櫫\0"  /* 橥 */
+    "櫥\0"  /* 橱 */
+    "櫓\0"  /* 橹 */
+    "櫞\0"  /* 橼 */
+    "檁\0"  /* 檩 */
+    "歡\0"  /* 欢 */
+    "歟\0"  /* 欤 */
+    "歐\0"  /* 欧 */
+    "歐遊\0"  /* 欧游 */
+    "慾令智昏\0"  /* 欲令智昏 */
+    "慾壑難填\0"  /* 欲壑难填 */
+    "慾念\0"  /* 欲念 */
+    "慾望\0"  /* 欲望 */
+    "慾海\0"  /* 欲海 */
+    "慾火\0"  /* 欲火 */
+    "慾障\0"  /* 欲障 */
+    "欺矇\0"  /* 欺蒙 */
+    "歌后\0"  /* 歌后 */
+    "歌鐘\0"  /* 歌钟 */
+    "止咳藥\0"  /* 止咳药 */
+    "止痛藥\0"  /* 止痛药 */
+    "止血藥\0"  /* 止血药 */
+    "正在叱咤\0"  /* 正在叱咤 */
+    "武后\0"  /* 武后 */
+    "武鬥\0"  /* 武斗 */
+    "歹鬥\0"  /* 歹斗 */
+    "死裡求生\0"  /* 死里求生 */
+    "死裡逃生\0"  /* 死里逃生 */
+    "殲\0"  /* 歼 */
+    "歿\0"  /* 殁 */
+    "殤\0"  /* 殇 */
+    "殘\0"  /* 残 */
+    "殘餘\0"  /* 残余 */
+    "殘肴\0"  /* 残肴 */
+    "殞\0"  /* 殒 */
+    "殮\0"  /* 殓 */
+    "殖穀\0"  /* 殖谷 */
+    "殫\0"  /* 殚 */
+    "殯\0"  /* 殡 */
+    "毆\0"  /* 殴 */
+    "毆鬥\0"  /* 殴斗 */
+    "殷師牛鬥\0"  /* 殷师牛斗 */
+    "殿鐘自鳴\0"  /* 殿钟自鸣 */
+    "毀\0"  /* 毁 */
+    "毀鐘為鐸\0"  /* 毁钟为铎 */
+    "轂\0"  /* 毂 */
+    "母醜\0"  /* 母丑 */
+    "母后\0"  /* 母后 */
+    "母範\0"  /* 母范 */
+    "每隻\0"  /* 每只 */
+    "毒藥\0"  /* 毒药 */
+    "畢\0"  /* 毕 */
+    "毗婆尸佛\0"  /* 毗婆尸佛 */
+    "斃\0"  /* 毙 */
+    "毛髮\0"  /* 毛发 */
+    "毛坏\0"  /* 毛坏 */
+    "毛薑\0"  /* 毛姜 */
+    "氈\0"  /* 毡 */
+    "毫釐\0"  /* 毫厘 */
+    "毫髮\0"  /* 毫发 */
+    "毿\0"  /* 毵 */
+    "氌\0"  /* 氇 */
+    "氣\0"  /* 气 */
+    "氣鬱\0"  /* 气郁 */
+    "氫\0"  /* 氢 */
+    "氤鬱\0"  /* 氤郁 */
+    "氬\0"  /* 氩 */
+    "氳\0"  /* 氲 */
+    "水準\0"  /* 水准 */
+    "水無怜奈\0"  /* 水无怜奈 */
+    "水來湯裡去\0"  /* 水来汤里去 */
+    "水裡\0"  /* 水里 */
+    "永曆\0"  /* 永历 */
+    "永誌不忘\0"  /* 永志不忘 */
+    "求知慾\0"  /* 求知欲 */
+    "求籤\0"  /* 求签 */
+    "匯\0"  /* 汇 */
+    "彙刊\0"  /* 汇刊 */
+    "彙報\0"  /* 汇报 */
+    "彙整\0"  /* 汇整 */
+    "彙算\0"  /* 汇算 */
+    "彙纂\0"  /* 汇纂 */
+    "彙編\0"  /* 汇编 */
+    "彙輯\0"  /* 汇辑 */
+    "彙集\0"  /* 汇集 */
+    "漢\0"  /* 汉 */
+    "漢彌登鐘\0"  /* 汉弥登钟 */
+    "池裡\0"  /* 池里 */
+    "污衊\0"  /* 污蔑 */
+    "湯\0"  /* 汤 */
+    "湯下麵\0"  /* 汤下面 */
+    "湯糰\0"  /* 汤团 */
+    "湯藥\0"  /* 汤药 */
+    "湯麵\0"  /* 汤面 */
+    "洶\0"  /* 汹 */
+    "洶湧\0"  /* 汹涌 */
+    "瀋吉線\0"  /* 沈吉线 */
+    "瀋山線\0"  /* 沈山线 */
+    "瀋州\0"  /* 沈州 */
+    "瀋水\0"  /* 沈水 */
+    "瀋河\0"  /* 沈河 */
+    "瀋海\0"  /* 沈海 */
+    "沈澱\0"  /* 沈淀 */
+    "沈著\0"  /* 沈着 */
+    "沈鬱\0"  /* 沈郁 */
+    "瀋陽\0"  /* 沈阳 */
+    "沉澱\0"  /* 沉淀 */
+    "沉鬱\0"  /* 沉郁 */
+    "沙裡淘金\0"  /* 沙里淘金 */
+    "溝\0"  /* 沟 */
+    "沒\0"  /* 没 */
+    "沒事幹\0"  /* 没事干 */
+    "沒準\0"  /* 没准 */
+    "沒幹\0"  /* 没干 */
+    "沒乾沒淨\0"  /* 没干没净 */
+    "沒摺至\0"  /* 没折至 */
+    "沒梢幹\0"  /* 没梢干 */
+    "沒藥\0"  /* 没药 */
+    "灃\0"  /* 沣 */
+    "漚\0"  /* 沤 */
+    "漚鬱\0"  /* 沤郁 */
+    "瀝\0"  /* 沥 */
+    "淪\0"  /* 沦 */
+    "滄\0"  /* 沧 */
+    "溈\0"  /* 沩 */
+    "滬\0"  /* 沪 */
+    "河嶽\0"  /* 河岳 */
+    "河裡\0"  /* 河里 */
+    "油鬥\0"  /* 油斗 */
+    "油麵\0"  /* 油面 */
+    "治癒\0"  /* 治愈 */
+    "沿泝\0"  /* 沿溯 */
+    "洩慾\0"  /* 泄欲 */
+    "法佔\0"  /* 法占 */
+    "泛遊\0"  /* 泛游 */
+    "濘\0"  /* 泞 */
+    "泡製\0"  /* 泡制 */
+    "泡麵\0"  /* 泡面 */
+    "波髮藻\0"  /* 波发藻 */
+    "波稜菜\0"  /* 波棱菜 */
+    "註上\0"  /* 注上 */
+    "注云\0"  /* 注云 */
+    "註冊\0"  /* 注册 */
+    "註失\0"  /* 注失 */
+    "註定\0"  /* 注定 */
+    "註明\0"  /* 注明 */
+    "註標\0"  /* 注标 */
+    "註生娘娘\0"  /* 注生娘娘 */
+    "註疏\0"  /* 注疏 */
+    "註腳\0"  /* 注脚 */
+    "註解\0"  /* 注解 */
+    "註記\0"  /* 注记 */
+    "註譯\0"  /* 注译 */
+    "註銷\0"  /* 注销 */
+    "淚\0"  /* 泪 */
+    "淚如泉湧\0"  /* 泪如泉涌 */
+    "淚乾\0"  /* 泪干 */
+    "泱鬱\0"  /* 泱郁 */
+    "泳氣鐘\0"  /* 泳气钟 */
+    "澩\0"  /* 泶 */
+    "瀧\0"  /* 泷 */
+    "瀘\0"  /* 泸 */
+    "濼\0"  /* 泺 */
+    "瀉\0"  /* 泻 */
+    "瀉藥\0"  /* 泻药 */
+    "潑\0"  /* 泼 */
+    "澤\0"  /* 泽 */
+    "澤滲灕而下降\0"  /* 泽渗漓而下降 */
+    "涇\0"  /* 泾 */
+    "潔\0"  /* 洁 */
+    "洄遊\0"  /* 洄游 */
+    "灑\0"  /* 洒 */
+    "洒家\0"  /* 洒家 */
+    "洒掃\0"  /* 洒扫 */
+    "洒水\0"  /* 洒水 */
+    "洒洒\0"  /* 洒洒 */
+    "洒滌\0"  /* 洒涤 */
+    "洒淅\0"  /* 洒淅 */
+    "洒濯\0"  /* 洒濯 */
+    "洒然\0"  /* 洒然 */
+    "洒脫\0"  /* 洒脱 */
+    "洗髮\0"  /* 洗发 */
+    "洗鍊\0"  /* 洗炼 */
+    "洗鍊\0"  /* 洗练 */
+    "洛鐘東應\0"  /* 洛钟东应 */
+    "洪範\0"  /* 洪范 */
+    "洪适\0"  /* 洪适 */
+    "洪鐘\0"  /* 洪钟 */
+    "窪\0"  /* 洼 */
+    "流徵\0"  /* 流征 */
+    "流蕩\0"  /* 流荡 */
+    "浹\0"  /* 浃 */
+    "淺\0"  /* 浅 */
+    "淺澱\0"  /* 浅淀 */
+    "漿\0"  /* 浆 */
+    "澆\0"  /* 浇 */
+    "湞\0"  /* 浈 */
+    "濁\0"  /* 浊 */
+    "測\0"  /* 测 */
+    "澮\0"  /* 浍 */
+    "濟\0"  /* 济 */
+    "瀏\0"  /* 浏 */
+    "渾\0"  /* 浑 */
+    "渾箇\0"  /* 浑个 */
+    "渾樸\0"  /* 浑朴 */
+    "滸\0"  /* 浒 */
+    "濃\0"  /* 浓 */
+    "濃髮\0"  /* 浓发 */
+    "潯\0"  /* 浔 */
+    "浩浩蕩蕩\0"  /* 浩浩荡荡 */
+    "浩蕩\0"  /* 浩荡 */
+    "浪遊\0"  /* 浪游 */
+    "浪琴錶\0"  /* 浪琴表 */
+    "浪蕩\0"  /* 浪荡 */
+    "浮鬆\0"  /* 浮松 */
+    "浮蕩\0"  /* 浮荡 */
+    "海上佈雷\0"  /* 海上布雷 */
+    "海乾\0"  /* 海干 */
+    "海灣佈雷\0"  /* 海湾布雷 */
+    "塗\0"  /* 涂 */
+    "涂善妮\0"  /* 涂善妮 */
+    "涂坤\0"  /* 涂坤 */
+    "涂壯勳\0"  /* 涂壮勋 */
+    "涂壯勳\0"  /* 涂壯勳 */
+    "涂天相\0"  /* 涂天相 */
+    "涂姓\0"  /* 涂姓 */
+    "涂序瑄\0"  /* 涂序瑄 */
+    "涂敏恆\0"  /* 涂敏恆 */
+    "涂敏恆\0"  /* 涂敏恒 */
+    "涂澤民\0"  /* 涂泽民 */
+    "涂澤民\0"  /* 涂澤民 */
+    "塗著\0"  /* 涂着 */
+    "涂紹煃\0"  /* 涂绍煃 */
+    "涂羽卿\0"  /* 涂羽卿 */
+    "塗藥\0"  /* 涂药 */
+    "涂謹申\0"  /* 涂謹申 */
+    "涂謹申\0"  /* 涂谨申 */
+    "涂逢年\0"  /* 涂逢年 */
+    "涂醒哲\0"  /* 涂醒哲 */
+    "涂長望\0"  /* 涂長望 */
+    "涂長望\0"  /* 涂长望 */
+    "涂鴻欽\0"  /* 涂鴻欽 */
+    "涂鴻欽\0"  /* 涂鸿钦 */
+    "消炎藥\0"  /* 消炎药 */
+    "消腫藥\0"  /* 消肿药 */
+    "湧上\0"  /* 涌上 */
+    "湧入\0"  /* 涌入 */
+    "湧出\0"  /* 涌出 */
+    "湧向\0"  /* 涌向 */
+    "湧來\0"  /* 涌来 */
+    "湧泉\0"  /* 涌泉 */
+    "湧現\0"  /* 涌现 */
+    "湧起\0"  /* 涌起 */
+    "湧進\0"  /* 涌进 */
+    "濤\0"  /* 涛 */
+    "澇\0"  /* 涝 */
+    "淶\0"  /* 涞 */
+    "漣\0"  /* 涟 */
+    "潿\0"  /* 涠 */
+    "渦\0"  /* 涡 */
+    "渙\0"  /* 涣 */
+    "滌\0"  /* 涤 */
+    "潤\0"  /* 润 */
+    "澗\0"  /* 涧 */
+    "漲\0"  /* 涨 */
+    "澀\0"  /* 涩 */
+    "液晶錶\0"  /* 液晶表 */
+    "涳濛\0"  /* 涳蒙 */
+    "涸乾\0"  /* 涸干 */
+    "澱乃不耕之地\0"  /* 淀乃不耕之地 */
+    "澱北片\0"  /* 淀北片 */
+    "澱山\0"  /* 淀山 */
+    "澱澱\0"  /* 淀淀 */
+    "澱積\0"  /* 淀积 */
+    "澱粉\0"  /* 淀粉 */
+    "澱解物\0"  /* 淀解物 */
+    "澱謂之滓\0"  /* 淀谓之滓 */
+    "淋餘土\0"  /* 淋余土 */
+    "淑範\0"  /* 淑范 */
+    "淡硃\0"  /* 淡朱 */
+    "淡濛濛\0"  /* 淡蒙蒙 */
+    "淫慾\0"  /* 淫欲 */
+    "淫蕩\0"  /* 淫荡 */
+    "淬鍊\0"  /* 淬炼 */
+    "深山何處鐘\0"  /* 深山何处钟 */
+    "深淵裡\0"  /* 深渊里 */
+    "淳于\0"  /* 淳于 */
+    "淳樸\0"  /* 淳朴 */
+    "清湯掛麵\0"  /* 清汤挂面 */
+    "淵\0"  /* 渊 */
+    "淵淳嶽峙\0"  /* 渊淳岳峙 */
+    "淥\0"  /* 渌 */
+    "漬\0"  /* 渍 */
+    "瀆\0"  /* 渎 */
+    "漸\0"  /* 渐 */
+    "澠\0"  /* 渑 */
+    "漁\0"  /* 渔 */
+    "瀋\0"  /* 渖 */
+    "滲\0"  /* 渗 */
+    "渠衝\0"  /* 渠冲 */
+    "溫\0"  /* 温 */
+    "港製\0"  /* 港制 */
+    "遊絲\0"  /* 游丝 */
+    "遊樂\0"  /* 游乐 */
+    "遊了\0"  /* 游了 */
+    "遊人\0"  /* 游人 */
+    "遊仙\0"  /* 游仙 */
+    "遊伴\0"  /* 游伴 */
+    "遊俠\0"  /* 游侠 */
+    "遊興\0"  /* 游兴 */
+    "遊冶\0"  /* 游冶 */
+    "遊刃有餘\0"  /* 游刃有余 */
+    "遊動\0"  /* 游动 */
+    "遊歷\0"  /* 游历 */
+    "遊園\0"  /* 游园 */
+    "遊子\0"  /* 游子 */
+    "遊學\0"  /* 游学 */
+    "遊客\0"  /* 游客 */
+    "遊宦\0"  /* 游宦 */
+    "遊山玩水\0"  /* 游山玩水 */
+    "遊必有方\0"  /* 游必有方 */
+    "遊憩\0"  /* 游憩 */
+    "遊戲\0"  /* 游戏 */
+    "遊手好閒\0"  /* 游手好闲 */
+    "遊方\0"  /* 游方 */
+    "遊星\0"  /* 游星 */
+    "遊標卡尺\0"  /* 游标卡尺 */
+    "遊民\0"  /* 游民 */
+    "遊河\0"  /* 游河 */
+    "遊獵\0"  /* 游猎 */
+    "遊玩\0"  /* 游玩 */
+    "遊目騁懷\0"  /* 游目骋怀 */
+    "遊離\0"  /* 游离 */
+    "遊程\0"  /* 游程 */
+    "遊船\0"  /* 游船 */
+    "遊艇\0"  /* 游艇 */
+    "遊藝\0"  /* 游艺 */
+    "遊盪\0"  /* 游荡 */
+    "遊蕩不歸\0"  /* 游荡不归 */
+    "遊行\0"  /* 游行 */
+    "遊街\0"  /* 游街 */
+    "遊覽\0"  /* 游览 */
+    "遊記\0"  /* 游记 */
+    "遊說\0"  /* 游说 */
+    "遊資\0"  /* 游资 */
+    "遊走\0"  /* 游走 */
+    "遊蹤\0"  /* 游踪 */
+    "遊逛\0"  /* 游逛 */
+    "遊錯\0"  /* 游错 */
+    "遊騎兵\0"  /* 游骑兵 */
+    "遊魂\0"  /* 游魂 */
+    "湖裡\0"  /* 湖里 */
+    "湘纍\0"  /* 湘累 */
+    "湘繡\0"  /* 湘绣 */
+    "湟潦生苹\0"  /* 湟潦生苹 */
+    "湮鬱\0"  /* 湮郁 */
+    "灣\0"  /* 湾 */
+    "濕\0"  /* 湿 */
+    "潰\0"  /* 溃 */
+    "濺\0"  /* 溅 */
+    "漵\0"  /* 溆 */
+    "溟濛\0"  /* 溟蒙 */
+    "溲麵\0"  /* 溲面 */
+    "滃鬱\0"  /* 滃郁 */
+    "滑藉\0"  /* 滑借 */
+    "潷\0"  /* 滗 */
+    "滾\0"  /* 滚 */
+    "滯\0"  /* 滞 */
+    "灄\0"  /* 滠 */
+    "滿\0"  /* 满 */
+    "滿頭洋髮\0"  /* 满头洋发 */
+    "滿拚自盡\0"  /* 满拼自尽 */
+    "瀅\0"  /* 滢 */
+    "濾\0"  /* 滤 */
+    "濫\0"  /* 滥 */
+    "灤\0"  /* 滦 */
+    "濱\0"  /* 滨 */
+    "灘\0"  /* 滩 */
+    "灘涂\0"  /* 滩涂 */
+    "漂蕩\0"  /* 漂荡 */
+    "灕水\0"  /* 漓水 */
+    "灕江\0"  /* 漓江 */
+    "灕湘\0"  /* 漓湘 */
+    "灕然\0"  /* 漓然 */
+    "漕輓\0"  /* 漕挽 */
+    "灠\0"  /* 漤 */
+    "漫遊\0"  /* 漫游 */
+    "瀠\0"  /* 潆 */
+    "瀟\0"  /* 潇 */
+    "瀟洒\0"  /* 潇洒 */
+    "瀲\0"  /* 潋 */
+    "濰\0"  /* 潍 */
+    "潛\0"  /* 潜 */
+    "潛意識裡\0"  /* 潜意识里 */
+    "潛水錶\0"  /* 潜水表 */
+    "潛水鐘\0"  /* 潜水钟 */
+    "潭裡\0"  /* 潭里 */
+    "潮湧\0"  /* 潮涌 */
+    "瀦\0"  /* 潴 */
+    "澒濛\0"  /* 澒蒙 */
+    "瀾\0"  /* 澜 */
+    "澹臺\0"  /* 澹台 */
+    "澹蕩\0"  /* 澹荡 */
+    "激蕩\0"  /* 激荡 */
+    "瀨\0"  /* 濑 */
+    "瀕\0"  /* 濒 */
+    "灌藥\0"  /* 灌药 */
+    "灝\0"  /* 灏 */
+    "火併\0"  /* 火并 */
+    "火拚\0"  /* 火拼 */
+    "火籤\0"  /* 火签 */
+    "火箭佈雷\0"  /* 火箭布雷 */
+    "火藥\0"  /* 火药 */
+    "滅\0"  /* 灭 */
+    "燈\0"  /* 灯 */
+    "灰濛\0"  /* 灰蒙 */
+    "灰濛濛\0"  /* 灰蒙蒙 */
+    "靈\0"  /* 灵 */
+    "靈藥\0"  /* 灵药 */
+    "災\0"  /* 灾 */
+    "燦\0"  /* 灿 */
+    "煬\0"  /* 炀 */
+    "炆麵\0"  /* 炆面 */
+    "爐\0"  /* 炉 */
+    "炒麵\0"  /* 炒面 */
+    "燉\0"  /* 炖 */
+    "燉藥\0"  /* 炖药 */
+    "煒\0"  /* 炜 */
+    "熗\0"  /* 炝 */
+    "炮製\0"  /* 炮制 */
+    "炸藥\0"  /* 炸药 */
+    "炸醬麵\0"  /* 炸酱面 */
+    "點\0"  /* 点 */
+    "點半鐘\0"  /* 点半钟 */
+    "點多鐘\0"  /* 点多钟 */
+    "點裡\0"  /* 点里 */
+    "點鐘\0"  /* 点钟 */
+    "煉\0"  /* 炼 */
+    "鍊冶\0"  /* 炼冶 */
+    "煉製\0"  /* 炼制 */
+    "鍊句\0"  /* 炼句 */
+    "鍊字\0"  /* 炼字 */
+    "鍊師\0"  /* 炼师 */
+    "鍊度\0"  /* 炼度 */
+    "鍊形\0"  /* 炼形 */
+    "鍊氣\0"  /* 炼气 */
+    "鍊汞\0"  /* 炼汞 */
+    "鍊石\0"  /* 炼石 */
+    "煉藥\0"  /* 炼药 */
+    "鍊貧\0"  /* 炼贫 */
+    "鍊金術\0"  /* 炼金术 */
+    "鍊鋼\0"  /* 炼钢 */
+    "熾\0"  /* 炽 */
+    "爍\0"  /* 烁 */
+    "爛\0"  /* 烂 */
+    "烴\0"  /* 烃 */
+    "烘製\0"  /* 烘制 */
+    "烘乾\0"  /* 烘干 */
+    "燭\0"  /* 烛 */
+    "煙\0"  /* 烟 */
+    "煙捲\0"  /* 烟卷 */
+    "烤乾\0"  /* 烤干 */
+    "烤晒\0"  /* 烤晒 */
+    "煩\0"  /* 烦 */
+    "燒\0"  /* 烧 */
+    "燒乾\0"  /* 烧干 */
+    "燁\0"  /* 烨 */
+    "燴\0"  /* 烩 */
+    "燙\0"  /* 烫 */
+    "燙一個髮\0"  /* 烫一个发 */
+    "燙一次髮\0"  /* 烫一次发 */
+    "燙個髮\0"  /* 烫个发 */
+    "燙髮\0"  /* 烫发 */
+    "燙完髮\0"  /* 烫完发 */
+    "燙次髮\0"  /* 烫次发 */
+    "燙麵\0"  /* 烫面 */
+    "燼\0"  /* 烬 */
+    "燼餘\0"  /* 烬余 */
+    "熱\0"  /* 热 */
+    "煥\0"  /* 焕 */
+    "燜\0"  /* 焖 */
+    "燾\0"  /* 焘 */
+    "焙乾\0"  /* 焙干 */
+    "無言不讎\0"  /* 無言不仇 */
+    "煎藥\0"  /* 煎药 */
+    "煎麵\0"  /* 煎面 */
+    "照入籤\0"  /* 照入签 */
+    "照準\0"  /* 照准 */
+    "照佔\0"  /* 照占 */
+    "煨乾\0"  /* 煨干 */
+    "煮麵\0"  /* 煮面 */
+    "熊杰\0"  /* 熊杰 */
+    "熬藥\0"  /* 熬药 */
+    "燎髮\0"  /* 燎发 */
+    "燕几\0"  /* 燕几 */
+    "燕遊\0"  /* 燕游 */
+    "爰定祥厤\0"  /* 爰定祥历 */
+    "愛\0"  /* 爱 */
+    "愛睏\0"  /* 爱困 */
+    "爺\0"  /* 爷 */
+    "爽蕩\0"  /* 爽荡 */
+    "片言隻語\0"  /* 片言只语 */
+    "牘\0"  /* 牍 */
+    "牙籤\0"  /* 牙签 */
+    "牛隻\0"  /* 牛只 */
+    "牛肉麵\0"  /* 牛肉面 */
+    "氂\0"  /* 牦 */
+    "物慾\0"  /* 物欲 */
+    "牽\0"  /* 牵 */
+    "牽一髮\0"  /* 牵一发 */
+    "牽繫\0"  /* 牵系 */
+    "特别致\0"  /* 特别致 */
+    "特製\0"  /* 特制 */
+    "特徵\0"  /* 特征 */
+    "特效藥\0"  /* 特效药 */
+    "犧\0"  /* 牺 */
+    "犢\0"  /* 犊 */
+    "狀\0"  /* 状 */
+    "獷\0"  /* 犷 */
+    "猶\0"  /* 犹 */
+    "猶如錶\0"  /* 犹如表 */
+    "猶如鐘\0"  /* 犹如钟 */
+    "狂佔\0"  /* 狂占 */
+    "狂併潮\0"  /* 狂并潮 */
+    "狄志杰\0"  /* 狄志杰 */
+    "狽\0"  /* 狈 */
+    "狐藉虎威\0"  /* 狐借虎威 */
+    "獰\0"  /* 狞 */
+    "獨\0"  /* 独 */
+    "獨佔\0"  /* 独占 */
+    "獨闢蹊徑\0"  /* 独辟蹊径 */
+    "狹\0"  /* 狭 */
+    "獅\0"  /* 狮 */
+    "獪\0"  /* 狯 */
+    "猙\0"  /* 狰 */
+    "獄\0"  /* 狱 */
+    "獄裡\0"  /* 狱里 */
+    "猻\0"  /* 狲 */
+    "獫\0"  /* 猃 */
+    "獵\0"  /* 猎 */
+    "獼\0"  /* 猕 */
+    "猛衝\0"  /* 猛冲 */
+    "猜三划五\0"  /* 猜三划五 */
+    "玀\0"  /* 猡 */
+    "豬\0"  /* 猪 */
+    "貓\0"  /* 猫 */
+    "蝟\0"  /* 猬 */
+    "獻\0"  /* 献 */
+    "獻醜\0"  /* 献丑 */
+    "獺\0"  /* 獭 */
+    "玉曆\0"  /* 玉历 */
+    "王餘魚\0"  /* 王余鱼 */
+    "王侯后\0"  /* 王侯后 */
+    "王后\0"  /* 王后 */
+    "王莊\0"  /* 王庄 */
+    "璣\0"  /* 玑 */
+    "瑪\0"  /* 玛 */
+    "瑋\0"  /* 玮 */
+    "環\0"  /* 环 */
+    "環遊\0"  /* 环游 */
+    "現\0"  /* 现 */
+    "璽\0"  /* 玺 */
+    "珍肴異饌\0"  /* 珍肴异馔 */
+    "琺\0"  /* 珐 */
+    "瓏\0"  /* 珑 */
+    "班裡\0"  /* 班里 */
+    "琿\0"  /* 珲 */
+    "球杆\0"  /* 球杆 */
+    "理一個髮\0"  /* 理一个发 */
+    "理一次髮\0"  /* 理一次发 */
+    "理個髮\0"  /* 理个发 */
+    "理髮\0"  /* 理发 */
+    "理完髮\0"  /* 理完发 */
+    "理次髮\0"  /* 理次发 */
+    "璉\0"  /* 琏 */
+    "瑣\0"  /* 琐 */
+    "琴鐘\0"  /* 琴钟 */
+    "瓊\0"  /* 琼 */
+    "瑞徵\0"  /* 瑞征 */
+    "瑤\0"  /* 瑶 */
+    "瑤籤\0"  /* 瑶签 */
+    "璦\0"  /* 瑷 */
+    "瓔\0"  /* 璎 */
+    "瓚\0"  /* 瓒 */
+    "甕安\0"  /* 瓮安 */
+    "甌\0"  /* 瓯 */
+    "瓷製\0"  /* 瓷制 */
+    "甄后\0"  /* 甄后 */
+    "甚麼\0"  /* 甚么 */
+    "甜水麵\0"  /* 甜水面 */
+    "甜麵醬\0"  /* 甜面酱 */
+    "生力麵\0"  /* 生力面 */
+    "生髮\0"  /* 生发 */
+    "生薑\0"  /* 生姜 */
+    "生物鐘\0"  /* 生物钟 */
+    "生鏽\0"  /* 生锈 */
+    "用藥\0"  /* 用药 */
+    "甩髮\0"  /* 甩发 */
+    "田莊\0"  /* 田庄 */
+    "田穀\0"  /* 田谷 */
+    "田裡\0"  /* 田里 */
+    "由表及裡\0"  /* 由表及里 */
+    "甲后路\0"  /* 甲后路 */
+    "電\0"  /* 电 */
+    "電衝\0"  /* 电冲 */
+    "電子錶\0"  /* 电子表 */
+    "電子鐘\0"  /* 电子钟 */
+    "電杆\0"  /* 电杆 */
+    "電波鐘\0"  /* 电波钟 */
+    "電線杆\0"  /* 电线杆 */
+    "電錶\0"  /* 电表 */
+    "電鐘\0"  /* 电钟 */
+    "男僕\0"  /* 男仆 */
+    "男用錶\0"  /* 男用表 */
+    "畫\0"  /* 画 */
+    "畫著\0"  /* 画着 */
+    "暢\0"  /* 畅 */
+    "暢遊\0"  /* 畅游 */
+    "留髮\0"  /* 留发 */
+    "疇\0"  /* 畴 */
+    "疏鬆\0"  /* 疏松 */
+    "疑兇\0"  /* 疑凶 */
+    "疑係\0"  /* 疑系 */
+    "癤\0"  /* 疖 */
+    "療\0"  /* 疗 */
+    "瘧\0"  /* 疟 */
+    "癘\0"  /* 疠 */
+    "瘍\0"  /* 疡 */
+    "癧\0"  /* 疬 */
+    "瘡\0"  /* 疮 */
+    "瘋\0"  /* 疯 */
+    "皰\0"  /* 疱 */
+    "疲睏\0"  /* 疲困 */
+    "痾\0"  /* 疴 */
+    "病餘\0"  /* 病余 */
+    "病徵\0"  /* 病征 */
+    "病癒\0"  /* 病愈 */
+    "癥候\0"  /* 症候 */
+    "癥狀\0"  /* 症状 */
+    "癥結\0"  /* 症结 */
+    "癰\0"  /* 痈 */
+    "痙\0"  /* 痉 */
+    "痊癒\0"  /* 痊愈 */
+    "癢\0"  /* 痒 */
+    "痒疹\0"  /* 痒疹 */
+    "痒痒\0"  /* 痒痒 */
+    "痕迹\0"  /* 痕迹 */
+    "癆\0"  /* 痨 */
+    "瘓\0"  /* 痪 */
+    "癇\0"  /* 痫 */
+    "癉\0"  /* 瘅 */
+    "瘞\0"  /* 瘗 */
+    "瘺\0"  /* 瘘 */
+    "癟\0"  /* 瘪 */
+    "癱\0"  /* 瘫 */
+    "癮\0"  /* 瘾 */
+    "癭\0"  /* 瘿 */
+    "癩\0"  /* 癞 */
+    "癬\0"  /* 癣 */
+    "癲\0"  /* 癫 */
+    "白兔擣藥\0"  /* 白兔擣药 */
+    "白淨面皮\0"  /* 白净面皮 */
+    "白髮\0"  /* 白发 */
+    "白乾\0"  /* 白干 */
+    "白朮\0"  /* 白术 */
+    "白樸\0"  /* 白朴 */
+    "白粉麵\0"  /* 白粉面 */
+    "白鬍\0"  /* 白胡 */
+    "白裡透紅\0"  /* 白里透红 */
+    "白黴\0"  /* 白霉 */
+    "百餘\0"  /* 百余 */
+    "百隻\0"  /* 百只 */
+    "百紮\0"  /* 百扎 */
+    "百拙千醜\0"  /* 百拙千丑 */
+    "百鍊\0"  /* 百炼 */
+    "百科裡\0"  /* 百科里 */
+    "百花曆\0"  /* 百花历 */
+    "百藥之長\0"  /* 百药之长 */
+    "百穀\0"  /* 百谷 */
+    "的剋制\0"  /* 的克制 */
+    "的鐘\0"  /* 的钟 */
+    "的鐘錶\0"  /* 的钟表 */
+    "的長髮\0"  /* 的长发 */
+    "皆準\0"  /* 皆准 */
+    "皆可作澱\0"  /* 皆可作淀 */
+    "皇曆\0"  /* 皇历 */
+    "皇后\0"  /* 皇后 */
+    "皇莊\0"  /* 皇庄 */
+    "皇極曆\0"  /* 皇极历 */
+    "皚\0"  /* 皑 */
+    "皓髮\0"  /* 皓发 */
+    "皮製\0"  /* 皮制 */
+    "皮鬆\0"  /* 皮松 */
+    "皮裡春秋\0"  /* 皮里春秋 */
+    "皮裡陽秋\0"  /* 皮里阳秋 */
+    "皺\0"  /* 皱 */
+    "皺彆\0"  /* 皱别 */
+    "皺摺\0"  /* 皱折 */
+    "皸\0"  /* 皲 */
+    "盆弔\0"  /* 盆吊 */
+    "盈餘\0"  /* 盈余 */
+    "盞\0"  /* 盏 */
+    "鹽\0"  /* 盐 */
+    "鹽餘\0"  /* 盐余 */
+    "鹽滷\0"  /* 盐卤 */
+    "鹽打怎麼鹹\0"  /* 盐打怎么咸 */
+    "監\0"  /* 监 */
+    "監製\0"  /* 监制 */
+    "盒裡\0"  /* 盒里 */
+    "蓋\0"  /* 盖 */
+    "盜\0"  /* 盗 */
+    "盜採\0"  /* 盗采 */
+    "盜鐘\0"  /* 盗钟 */
+    "盤\0"  /* 盘 */
+    "盤迴\0"  /* 盘回 */
+    "盤裡\0"  /* 盘里 */
+    "盛讚\0"  /* 盛赞 */
+    "盲幹\0"  /* 盲干 */
+    "直衝\0"  /* 直冲 */
+    "直接參与\0"  /* 直接参与 */
+    "相剋\0"  /* 相克 */
+    "相衝\0"  /* 相冲 */
+    "相併\0"  /* 相并 */
+    "相鬥\0"  /* 相斗 */
+    "看下錶\0"  /* 看下表 */
+    "看下鐘\0"  /* 看下钟 */
+    "看準\0"  /* 看准 */
+    "看著錶\0"  /* 看着表 */
+    "看著鐘\0"  /* 看着钟 */
+    "看著鐘錶\0"  /* 看着钟表 */
+    "看錶\0"  /* 看表 */
+    "看鐘\0"  /* 看钟 */
+    "真箇\0"  /* 真个 */
+    "真兇\0"  /* 真凶 */
+    "眥\0"  /* 眦 */
+    "眼帘\0"  /* 眼帘 */
+    "眼乾\0"  /* 眼干 */
+    "眼眶裡\0"  /* 眼眶里 */
+    "眼睛裡\0"  /* 眼睛里 */
+    "眼藥\0"  /* 眼药 */
+    "眼裡\0"  /* 眼里 */
+    "著書立說\0"  /* 着书立说 */
+    "著兒\0"  /* 着儿 */
+    "著剋制\0"  /* 着克制 */
+    "著錄\0"  /* 着录 */
+    "著色軟體\0"  /* 着色软体 */
+    "著重指出\0"  /* 着重指出 */
+    "睜\0"  /* 睁 */
+    "睞\0"  /* 睐 */
+    "瞼\0"  /* 睑 */
+    "睡遊病\0"  /* 睡游病 */
+    "睡著了\0"  /* 睡着了 */
+    "瞄準\0"  /* 瞄准 */
+    "瞅下錶\0"  /* 瞅下表 */
+    "瞅下鐘\0"  /* 瞅下钟 */
+    "瞞\0"  /* 瞒 */
+    "瞧著錶\0"  /* 瞧着表 */
+    "瞧著鐘\0"  /* 瞧着钟 */
+    "瞧著鐘錶\0"  /* 瞧着钟表 */
+    "矚\0"  /* 瞩 */
+    "矚託\0"  /* 瞩托 */
+    "瞳矇\0"  /* 瞳蒙 */
+    "矜莊\0"  /* 矜庄 */
+    "矯\0"  /* 矫 */
+    "短几\0"  /* 短几 */
+    "短髮\0"  /* 短发 */
+    "矮几\0"  /* 矮几 */
+    "石几\0"  /* 石几 */
+    "石樑\0"  /* 石梁 */
+    "石英錶\0"  /* 石英表 */
+    "石英鐘\0"  /* 石英钟 */
+    "石蓴\0"  /* 石莼 */
+    "石鐘乳\0"  /* 石钟乳 */
+    "磯\0"  /* 矶 */
+    "礬\0"  /* 矾 */
+    "礦\0"  /* 矿 */
+    "碭\0"  /* 砀 */
+    "碼\0"  /* 码 */
+    "碼錶\0"  /* 码表 */
+    "研製\0"  /* 研制 */
+    "磚\0"  /* 砖 */
+    "硨\0"  /* 砗 */
+    "硯\0"  /* 砚 */
+    "砰噹\0"  /* 砰当 */
+    "礪\0"  /* 砺 */
+    "礱\0"  /* 砻 */
+    "礱穀機\0"  /* 砻谷机 */
+    "礫\0"  /* 砾 */
+    "礎\0"  /* 础 */
+    "碩\0"  /* 硕 */
+    "硤\0"  /* 硖 */
+    "磽\0"  /* 硗 */
+    "磽确\0"  /* 硗确 */
+    "硬幹\0"  /* 硬干 */
+    "確\0"  /* 确 */
+    "确瘠\0"  /* 确瘠 */
+    "礙\0"  /* 碍 */
+    "碑誌\0"  /* 碑志 */
+    "磧\0"  /* 碛 */
+    "磣\0"  /* 碜 */
+    "碰鐘\0"  /* 碰钟 */
+    "鹼\0"  /* 碱 */
+    "磁製\0"  /* 磁制 */
+    "磨製\0"  /* 磨制 */
+    "磨鍊\0"  /* 磨炼 */
+    "磬鐘\0"  /* 磬钟 */
+    "示範\0"  /* 示范 */
+    "禮\0"  /* 礼 */
+    "禮讚\0"  /* 礼赞 */
+    "社裡\0"  /* 社里 */
+    "祝髮\0"  /* 祝发 */
+    "祝讚\0"  /* 祝赞 */
+    "神遊\0"  /* 神游 */
+    "神鵰\0"  /* 神雕 */
+    "禰\0"  /* 祢 */
+    "票莊\0"  /* 票庄 */
+    "祭弔\0"  /* 祭吊 */
+    "禎\0"  /* 祯 */
+    "禱\0"  /* 祷 */
+    "禍\0"  /* 祸 */
+    "稟\0"  /* 禀 */
+    "禁慾\0"  /* 禁欲 */
+    "禁藥\0"  /* 禁药 */
+    "祿\0"  /* 禄 */
+    "禪\0"  /* 禅 */
+    "離\0"  /* 离 */
+    "禾穀\0"  /* 禾谷 */
+    "秀髮\0"  /* 秀发 */
+    "私下裡\0"  /* 私下里 */
+    "私鬥\0"  /* 私斗 */
+    "私慾\0"  /* 私欲 */
+    "禿\0"  /* 秃 */
+    "禿髮\0"  /* 秃发 */
+    "禿妃之髮\0"  /* 秃妃之发 */
+    "稈\0"  /* 秆 */
+    "秋假裡\0"  /* 秋假里 */
+    "鞦韆\0"  /* 秋千 */
+    "秋髮\0"  /* 秋发 */
+    "秋天裡\0"  /* 秋天里 */
+    "秋日裡\0"  /* 秋日里 */
+    "秋遊\0"  /* 秋游 */
+    "秋陰入井幹\0"  /* 秋阴入井干 */
+    "種\0"  /* 种 */
+    "种師中\0"  /* 种师中 */
+    "种師道\0"  /* 种师道 */
+    "种放\0"  /* 种放 */
+    "種穀\0"  /* 种谷 */
+    "科範\0"  /* 科范 */
+    "秒錶\0"  /* 秒表 */
+    "秒鐘\0"  /* 秒钟 */
+    "秦莊襄王\0"  /* 秦庄襄王 */
+    "積\0"  /* 积 */
+    "積极參与\0"  /* 积极参与 */
+    "積极參加\0"  /* 积极参加 */
+    "積澱\0"  /* 积淀 */
+    "積穀\0"  /* 积谷 */
+    "積穀防饑\0"  /* 积谷防饥 */
+    "積鬱\0"  /* 积郁 */
+    "稱\0"  /* 称 */
+    "稱讚\0"  /* 称赞 */
+    "穢\0"  /* 秽 */
+    "稀鬆\0"  /* 稀松 */
+    "穭\0"  /* 稆 */
+    "稅\0"  /* 税 */
+    "穌\0"  /* 稣 */
+    "穩\0"  /* 稳 */
+    "穩佔\0"  /* 稳占 */
+    "穩紮\0"  /* 稳扎 */
+    "稻穀\0"  /* 稻谷 */
+    "稽徵\0"  /* 稽征 */
+    "穆罕默德曆\0"  /* 穆罕默德历 */
+    "穡\0"  /* 穑 */
+    "繐幃飄井幹\0"  /* 穗帏飘井干 */
+    "窮\0"  /* 穷 */
+    "窮髮\0"  /* 穷发 */
+    "窮追不捨\0"  /* 穷追不舍 */
+    "空中佈雷\0"  /* 空中布雷 */
+    "空餘\0"  /* 空余 */
+    "空投佈雷\0"  /* 空投布雷 */
+    "空蕩\0"  /* 空荡 */
+    "空蕩蕩\0"  /* 空荡荡 */
+    "空濛\0"  /* 空蒙 */
+    "空鐘\0"  /* 空钟 */
+    "竊\0"  /* 窃 */
+    "竊鐘掩耳\0"  /* 窃钟掩耳 */
+    "竅\0"  /* 窍 */
+    "窯\0"  /* 窑 */
+    "窒慾\0"  /* 窒欲 */
+    "窗檯\0"  /* 窗台 */
+    "窗帘\0"  /* 窗帘 */
+    "窗明几亮\0"  /* 窗明几亮 */
+    "窗明几淨\0"  /* 窗明几净 */
+    "竄\0"  /* 窜 */
+    "窩\0"  /* 窝 */
+    "窩裡\0"  /* 窝里 */
+    "窺\0"  /* 窥 */
+    "竇\0"  /* 窦 */
+    "窶\0"  /* 窭 */
+    "立后綜\0"  /* 立后综 */
+    "立範\0"  /* 立范 */
+    "豎\0"  /* 竖 */
+    "豎著\0"  /* 竖着 */
+    "站乾岸兒\0"  /* 站干岸儿 */
+    "競\0"  /* 竞 */
+    "競鬥\0"  /* 竞斗 */
+    "童僕\0"  /* 童仆 */
+    "端莊\0"  /* 端庄 */
+    "竹几\0"  /* 竹几 */
+    "竹製\0"  /* 竹制 */
+    "竹林之遊\0"  /* 竹林之游 */
+    "竹籤\0"  /* 竹签 */
+    "篤\0"  /* 笃 */
+    "筍\0"  /* 笋 */
+    "筍乾\0"  /* 笋干 */
+    "笑裡藏刀\0"  /* 笑里藏刀 */
+    "筆\0"  /* 笔 */
+    "筆禿墨乾\0"  /* 笔秃墨干 */
+    "筧\0"  /* 笕 */
+    "箋\0"  /* 笺 */
+    "籠\0"  /* 笼 */
+    "籩\0"  /* 笾 */
+    "築\0"  /* 筑 */
+    "筑前\0"  /* 筑前 */
+    "筑北\0"  /* 筑北 */
+    "筑後\0"  /* 筑后 */
+    "筑州\0"  /* 筑州 */
+    "筑後\0"  /* 筑後 */
+    "筑波\0"  /* 筑波 */
+    "筑紫\0"  /* 筑紫 */
+    "筑肥\0"  /* 筑肥 */
+    "筑西\0"  /* 筑西 */
+    "筑邦\0"  /* 筑邦 */
+    "筑陽\0"  /* 筑阳 */
+    "筑陽\0"  /* 筑陽 */
+    "答覆\0"  /* 答复 */
+    "篳\0"  /* 筚 */
+    "篩\0"  /* 筛 */
+    "箏\0"  /* 筝 */
+    "筵几\0"  /* 筵几 */
+    "籌\0"  /* 筹 */
+    "簽\0"  /* 签 */
+    "籤押\0"  /* 签押 */
+    "籤條\0"  /* 签条 */
+    "簽著\0"  /* 签着 */
+    "籤詩\0"  /* 签诗 */
+    "簡\0"  /* 简 */
+    "簡併\0"  /* 简并 */
+    "簡樸\0"  /* 简朴 */
+    "簡筑翎\0"  /* 简筑翎 */
+    "算準\0"  /* 算准 */
+    "算曆\0"  /* 算历 */
+    "算髮\0"  /* 算发 */
+    "管幹\0"  /* 管干 */
+    "簀\0"  /* 箦 */
+    "篋\0"  /* 箧 */
+    "籜\0"  /* 箨 */
+    "籮\0"  /* 箩 */
+    "簞\0"  /* 箪 */
+    "簫\0"  /* 箫 */
+    "簣\0"  /* 篑 */
+    "簍\0"  /* 篓 */
+    "籃\0"  /* 篮 */
+    "籬\0"  /* 篱 */
+    "籪\0"  /* 簖 */
+    "簡筑翎\0"  /* 簡筑翎 */
+    "簸蕩\0"  /* 簸荡 */
+    "籟\0"  /* 籁 */
+    "米穀\0"  /* 米谷 */
+    "糴\0"  /* 籴 */
+    "類\0"  /* 类 */
+    "秈\0"  /* 籼 */
+    "粉拳繡腿\0"  /* 粉拳绣腿 */
+    "粉籤子\0"  /* 粉签子 */
+    "粗製\0"  /* 粗制 */
+    "糶\0"  /* 粜 */
+    "糲\0"  /* 粝 */
+    "粵\0"  /* 粤 */
+    "糞\0"  /* 粪 */
+    "糞穢衊面\0"  /* 粪秽蔑面 */
+    "糧\0"  /* 粮 */
+    "精準\0"  /* 精准 */
+    "精製\0"  /* 精制 */
+    "精幹\0"  /* 精干 */
+    "精鬆\0"  /* 精松 */
+    "精鍊\0"  /* 精炼 */
+    "精緻\0"  /* 精致 */
+    "精闢\0"  /* 精辟 */
+    "糝\0"  /* 糁 */
+    "餱\0"  /* 糇 */
+    "糊裡糊塗\0"  /* 糊里糊涂 */
+    "糕乾\0"  /* 糕干 */
+    "繫上\0"  /* 系上 */
+    "繫世\0"  /* 系世 */
+    "係為\0"  /* 系为 */
+    "繫於\0"  /* 系于 */
+    "繫於一髮\0"  /* 系于一发 */
+    "系列裡\0"  /* 系列里 */
+    "繫到\0"  /* 系到 */
+    "繫囚\0"  /* 系囚 */
+    "繫心\0"  /* 系心 */
+    "繫念\0"  /* 系念 */
+    "繫懷\0"  /* 系怀 */
+    "繫戀\0"  /* 系恋 */
+    "係數\0"  /* 系数 */
+    "系著\0"  /* 系着 */
+    "繫緊\0"  /* 系紧 */
+    "繫纍\0"  /* 系累 */
+    "繫結\0"  /* 系结 */
+    "繫繩\0"  /* 系绳 */
+    "繫辭\0"  /* 系辞 */
+    "系裡\0"  /* 系里 */
+    "繫風捕影\0"  /* 系风捕影 */
+    "素髮\0"  /* 素发 */
+    "素樸\0"  /* 素朴 */
+    "素麵\0"  /* 素面 */
+    "索麵\0"  /* 索面 */
+    "緊\0"  /* 紧 */
+    "緊繃\0"  /* 紧绷 */
+    "緊繃著\0"  /* 紧绷着 */
+    "緊繃繃\0"  /* 紧绷绷 */
+    "緊緻\0"  /* 紧致 */
+    "緊追不捨\0"  /* 紧追不舍 */
+    "紫薑\0"  /* 紫姜 */
+    "纍囚\0"  /* 累囚 */
+    "纍堆\0"  /* 累堆 */
+    "纍瓦結繩\0"  /* 累瓦结绳 */
+    "纍紲\0"  /* 累绁 */
+    "纍臣\0"  /* 累臣 */
+    "縶\0"  /* 絷 */
+    "綑紮\0"  /* 綑扎 */
+    "經有云\0"  /* 經有云 */
+    "緝兇\0"  /* 緝凶 */
+    "繁複\0"  /* 繁复 */
+    "繁鐘\0"  /* 繁钟 */
+    "糾\0"  /* 纠 */
+    "紆\0"  /* 纡 */
+    "紆餘\0"  /* 纡余 */
+    "紆迴\0"  /* 纡回 */
+    "紆鬱\0"  /* 纡郁 */
+    "紅\0"  /* 红 */
+    "紅髮\0"  /* 红发 */
+    "紅繩繫足\0"  /* 红绳系足 */
+    "紅色長髮\0"  /* 红色长发 */
+    "紅鐘\0"  /* 红钟 */
+    "紂\0"  /* 纣 */
+    "纖\0"  /* 纤 */
+    "縴夫\0"  /* 纤夫 */
+    "縴手\0"  /* 纤手 */
+    "紇\0"  /* 纥 */
+    "約\0"  /* 约 */
+    "約佔\0"  /* 约占 */
+    "級\0"  /* 级 */
+    "紈\0"  /* 纨 */
+    "纊\0"  /* 纩 */
+    "紀\0"  /* 纪 */
+    "紀曆\0"  /* 纪历 */
+    "紉\0"  /* 纫 */
+    "緯\0"  /* 纬 */
+    "紜\0"  /* 纭 */
+    "純\0"  /* 纯 */
+    "純樸\0"  /* 纯朴 */
+    "紕\0"  /* 纰 */
+    "紗\0"  /* 纱 */
+    "綱\0"  /* 纲 */
+    "納\0"  /* 纳 */
+    "納徵\0"  /* 纳征 */
+    "縱\0"  /* 纵 */
+    "縱慾\0"  /* 纵欲 */
+    "綸\0"  /* 纶 */
+    "紛\0"  /* 纷 */
+    "紙\0"  /* 纸 */
+    "紙紮\0"  /* 纸扎 */
+    "紋\0"  /* 纹 */
+    "紡\0"  /* 纺 */
+    "紐\0"  /* 纽 */
+    "紓\0"  /* 纾 */
+    "線\0"  /* 线 */
+    "紺\0"  /* 绀 */
+    "紲\0"  /* 绁 */
+    "紱\0"  /* 绂 */
+    "練\0"  /* 练 */
+    "組\0"  /* 组 */
+    "組裡\0"  /* 组里 */
+    "紳\0"  /* 绅 */
+    "細\0"  /* 细 */
+    "細不容髮\0"  /* 细不容发 */
+    "細如髮\0"  /* 细如发 */
+    "細鍊\0"  /* 细炼 */
+    "細緻\0"  /* 细致 */
+    "織\0"  /* 织 */
+    "終\0"  /* 终 */
+    "縐\0"  /* 绉 */
+    "絆\0"  /* 绊 */
+    "紼\0"  /* 绋 */
+    "絀\0"  /* 绌 */
+    "紹\0"  /* 绍 */
+    "繹\0"  /* 绎 */
+    "經\0"  /* 经 */
+    "經有云\0"  /* 经有云 */
+    "紿\0"  /* 绐 */
+    "綁\0"  /* 绑 */
+    "綁紮\0"  /* 绑扎 */
+    "絨\0"  /* 绒 */
+    "結\0"  /* 结 */
+    "結夥\0"  /* 结伙 */
+    "結伴同遊\0"  /* 结伴同游 */
+    "結餘\0"  /* 结余 */
+    "結髮\0"  /* 结发 */
+    "結綵\0"  /* 结彩 */
+    "結紮\0"  /* 结扎 */
+    "繞\0"  /* 绕 */
+    "繞樑\0"  /* 绕梁 */
+    "絎\0"  /* 绗 */
+    "繪\0"  /* 绘 */
+    "繪製\0"  /* 绘制 */
+    "給\0"  /* 给 */
+    "絢\0"  /* 绚 */
+    "絳\0"  /* 绛 */
+    "絡\0"  /* 络 */
+    "絡腮鬍\0"  /* 络腮胡 */
+    "絕\0"  /* 绝 */
+    "絞\0"  /* 绞 */
+    "絞乾\0"  /* 绞干 */
+    "統\0"  /* 统 */
+    "綆\0"  /* 绠 */
+    "綃\0"  /* 绡 */
+    "絹\0"  /* 绢 */
+    "綉\0"  /* 绣 */
+    "繡像\0"  /* 绣像 */
+    "繡口\0"  /* 绣口 */
+    "繡得\0"  /* 绣得 */
+    "繡戶\0"  /* 绣户 */
+    "繡房\0"  /* 绣房 */
+    "繡毯\0"  /* 绣毯 */
+    "繡球\0"  /* 绣球 */
+    "繡的\0"  /* 绣的 */
+    "繡花\0"  /* 绣花 */
+    "繡衣\0"  /* 绣衣 */
+    "繡起\0"  /* 绣起 */
+    "繡閣\0"  /* 绣阁 */
+    "繡鞋\0"  /* 绣鞋 */
+    "綏\0"  /* 绥 */
+    "絛\0"  /* 绦 */
+    "繼\0"  /* 继 */
+    "綈\0"  /* 绨 */
+    "績\0"  /* 绩 */
+    "緒\0"  /* 绪 */
+    "緒餘\0"  /* 绪余 */
+    "綾\0"  /* 绫 */
+    "續\0"  /* 续 */
+    "綺\0"  /* 绮 */
+    "緋\0"  /* 绯 */
+    "綽\0"  /* 绰 */
+    "緄\0"  /* 绲 */
+    "繩\0"  /* 绳 */
+    "維\0"  /* 维 */
+    "維繫\0"  /* 维系 */
+    "綿\0"  /* 绵 */
+    "綬\0"  /* 绶 */
+    "繃住\0"  /* 绷住 */
+    "繃子\0"  /* 绷子 */
+    "繃帶\0"  /* 绷带 */
+    "繃開\0"  /* 绷开 */
+    "繃扒弔拷\0"  /* 绷扒吊拷 */
+    "繃著\0"  /* 绷着 */
+    "繃緊\0"  /* 绷紧 */
+    "繃臉\0"  /* 绷脸 */
+    "綢\0"  /* 绸 */
+    "綢緞莊\0"  /* 绸缎庄 */
+    "綹\0"  /* 绺 */
+    "綣\0"  /* 绻 */
+    "綜\0"  /* 综 */
+    "綻\0"  /* 绽 */
+    "綰\0"  /* 绾 */
+    "綰髮\0"  /* 绾发 */
+    "綠\0"  /* 绿 */
+    "綠髮\0"  /* 绿发 */
+    "綴\0"  /* 缀 */
+    "緇\0"  /* 缁 */
+    "緙\0"  /* 缂 */
+    "緗\0"  /* 缃 */
+    "緘\0"  /* 缄 */
+    "緬\0"  /* 缅 */
+    "纜\0"  /* 缆 */
+    "緹\0"  /* 缇 */
+    "緲\0"  /* 缈 */
+    "緝\0"  /* 缉 */
+    "緝兇\0"  /* 缉凶 */
+    "繢\0"  /* 缋 */
+    "緦\0"  /* 缌 */
+    "綞\0"  /* 缍 */
+    "緞\0"  /* 缎 */
+    "緶\0"  /* 缏 */
+    "緱\0"  /* 缑 */
+    "縋\0"  /* 缒 */
+    "緩\0"  /* 缓 */
+    "緩衝\0"  /* 缓冲 */
+    "緩徵\0"  /* 缓征 */
+    "締\0"  /* 缔 */
+    "縷\0"  /* 缕 */
+    "編\0"  /* 编 */
+    "編製\0"  /* 编制 */
+    "編髮\0"  /* 编发 */
+    "編採\0"  /* 编采 */
+    "編鐘\0"  /* 编钟 */
+    "緡\0"  /* 缗 */
+    "緣\0"  /* 缘 */
+    "縉\0"  /* 缙 */
+    "縛\0"  /* 缚 */
+    "縟\0"  /* 缛 */
+    "縝\0"  /* 缜 */
+    "縝緻\0"  /* 缜致 */
+    "縫\0"  /* 缝 */
+    "縫製\0"  /* 缝制 */
+    "縫裡\0"  /* 缝里 */
+    "縞\0"  /* 缟 */
+    "纏\0"  /* 缠 */
+    "纏鬥\0"  /* 缠斗 */
+    "縭\0"  /* 缡 */
+    "縊\0"  /* 缢 */
+    "縑\0"  /* 缣 */
+    "繽\0"  /* 缤 */
+    "縹\0"  /* 缥 */
+    "縵\0"  /* 缦 */
+    "縲\0"  /* 缧 */
+    "纓\0"  /* 缨 */
+    "縮\0"  /* 缩 */
+    "縮慄\0"  /* 缩栗 */
+    "繆\0"  /* 缪 */
+    "繅\0"  /* 缫 */
+    "纈\0"  /* 缬 */
+    "繚\0"  /* 缭 */
+    "繕\0"  /* 缮 */
+    "繒\0"  /* 缯 */
+    "韁\0"  /* 缰 */
+    "繾\0"  /* 缱 */
+    "繰\0"  /* 缲 */
+    "繯\0"  /* 缳 */
+    "繳\0"  /* 缴 */
+    "纘\0"  /* 缵 */
+    "罌\0"  /* 罂 */
+    "網\0"  /* 网 */
+    "網誌\0"  /* 网志 */
+    "網遊\0"  /* 网游 */
+    "網裡\0"  /* 网里 */
+    "羅\0"  /* 罗 */
+    "罰\0"  /* 罚 */
+    "罷\0"  /* 罢 */
+    "置言成範\0"  /* 置言成范 */
+    "羆\0"  /* 罴 */
+    "羈\0"  /* 羁 */
+    "羈繫\0"  /* 羁系 */
+    "美醜\0"  /* 美丑 */
+    "美崙\0"  /* 美仑 */
+    "美製\0"  /* 美制 */
+    "美佔\0"  /* 美占 */
+    "美髮\0"  /* 美发 */
+    "羥\0"  /* 羟 */
+    "羨\0"  /* 羡 */
+    "羨餘\0"  /* 羡余 */
+    "群醜\0"  /* 群丑 */
+    "翕闢\0"  /* 翕辟 */
+    "翹\0"  /* 翘 */
+    "翱遊\0"  /* 翱游 */
+    "翻鬆\0"  /* 翻松 */
+    "翻湧\0"  /* 翻涌 */
+    "老僕\0"  /* 老仆 */
+    "老薑\0"  /* 老姜 */
+    "老乾\0"  /* 老干 */
+    "老幹部\0"  /* 老干部 */
+    "老莊\0"  /* 老庄 */
+    "老闆\0"  /* 老板 */
+    "老爺鐘\0"  /* 老爷钟 */
+    "老懞\0"  /* 老蒙 */
+    "考徵\0"  /* 考征 */
+    "而剋制\0"  /* 而克制 */
+    "耍鬥\0"  /* 耍斗 */
+    "耕傭\0"  /* 耕佣 */
+    "耕穫\0"  /* 耕获 */
+    "耬\0"  /* 耧 */
+    "耳餘\0"  /* 耳余 */
+    "聳\0"  /* 耸 */
+    "恥\0"  /* 耻 */
+    "聶\0"  /* 聂 */
+    "聾\0"  /* 聋 */
+    "職\0"  /* 职 */
+    "聹\0"  /* 聍 */
+    "聯\0"  /* 联 */
+    "聯繫\0"  /* 联系 */
+    "聘僱\0"  /* 聘雇 */
+    "聵\0"  /* 聩 */
+    "聰\0"  /* 聪 */
+    "肅\0"  /* 肃 */
+    "肉絲麵\0"  /* 肉丝面 */
+    "肉乾\0"  /* 肉干 */
+    "肉鬆\0"  /* 肉松 */
+    "肉慾\0"  /* 肉欲 */
+    "肉羹麵\0"  /* 肉羹面 */
+    "肚裡\0"  /* 肚里 */
+    "肝鬱\0"  /* 肝郁 */
+    "腸\0"  /* 肠 */
+    "股慄\0"  /* 股栗 */
+    "膚\0"  /* 肤 */
+    "膚髮\0"  /* 肤发 */
+    "肥筑方言\0"  /* 肥筑方言 */
+    "骯\0"  /* 肮 */
+    "骯骯髒髒\0"  /* 肮肮脏脏 */
+    "骯髒\0"  /* 肮脏 */
+    "餚\0"  /* 肴 */
+    "肴饌\0"  /* 肴馔 */
+    "腎\0"  /* 肾 */
+    "腫\0"  /* 肿 */
+    "脹\0"  /* 胀 */
+    "脅\0"  /* 胁 */
+    "胃藥\0"  /* 胃药 */
+    "胃裡\0"  /* 胃里 */
+    "膽\0"  /* 胆 */
+    "背地裡\0"  /* 背地里 */
+    "胎髮\0"  /* 胎发 */
+    "勝\0"  /* 胜 */
+    "胜肽\0"  /* 胜肽 */
+    "胜鍵\0"  /* 胜键 */
+    "胡云\0"  /* 胡云 */
+    "衚衕\0"  /* 胡同 */
+    "鬍子\0"  /* 胡子 */
+    "胡樸安\0"  /* 胡朴安 */
+    "鬍梢\0"  /* 胡梢 */
+    "鬍渣\0"  /* 胡渣 */
+    "胡裡胡塗\0"  /* 胡里胡涂 */
+    "鬍鬚\0"  /* 胡须 */
+    "鬍髭\0"  /* 胡髭 */
+    "鬍髯\0"  /* 胡髯 */
+    "朧\0"  /* 胧 */
+    "臚\0"  /* 胪 */
+    "脛\0"  /* 胫 */
+    "膠\0"  /* 胶 */
+    "膠捲\0"  /* 胶卷 */
+    "能剋制\0"  /* 能克制 */
+    "能幹\0"  /* 能干 */
+    "脈\0"  /* 脉 */
+    "脈衝\0"  /* 脉冲 */
+    "脊樑\0"  /* 脊梁 */
+    "膾\0"  /* 脍 */
+    "臟\0"  /* 脏 */
+    "髒東西\0"  /* 脏东西 */
+    "髒亂\0"  /* 脏乱 */
+    "髒了\0"  /* 脏了 */
+    "髒兮兮\0"  /* 脏兮兮 */
+    "髒髮\0"  /* 脏发 */
+    "髒字\0"  /* 脏字 */
+    "髒得\0"  /* 脏得 */
+    "髒心\0"  /* 脏心 */
+    "髒水\0"  /* 脏水 */
+    "髒的\0"  /* 脏的 */
+    "髒詞\0"  /* 脏词 */
+    "髒話\0"  /* 脏话 */
+    "髒錢\0"  /* 脏钱 */
+    "臍\0"  /* 脐 */
+    "腦\0"  /* 脑 */
+    "腦子裡\0"  /* 脑子里 */
+    "腦幹\0"  /* 脑干 */
+    "膿\0"  /* 脓 */
+    "臠\0"  /* 脔 */
+    "腳\0"  /* 脚 */
+    "腳註\0"  /* 脚注 */
+    "腳鍊\0"  /* 脚炼 */
+    "脫\0"  /* 脱 */
+    "脫髮\0"  /* 脱发 */
+    "脫穀機\0"  /* 脱谷机 */
+    "腡\0"  /* 脶 */
+    "臉\0"  /* 脸 */
+    "臘\0"  /* 腊 */
+    "腊之以為餌\0"  /* 腊之以为饵 */
+    "腊味\0"  /* 腊味 */
+    "腊毒\0"  /* 腊毒 */
+    "腊筆\0"  /* 腊笔 */
+    "腐餘\0"  /* 腐余 */
+    "腐乾\0"  /* 腐干 */
+    "腕錶\0"  /* 腕表 */
+    "齶\0"  /* 腭 */
+    "腰裡\0"  /* 腰里 */
+    "膩\0"  /* 腻 */
+    "靦\0"  /* 腼 */
+    "膃\0"  /* 腽 */
+    "騰\0"  /* 腾 */
+    "騰衝\0"  /* 腾冲 */
+    "膏藥\0"  /* 膏药 */
+    "臏\0"  /* 膑 */
+    "膨鬆\0"  /* 膨松 */
+    "臣僕\0"  /* 臣仆 */
+    "臧穀亡羊\0"  /* 臧谷亡羊 */
+    "自製\0"  /* 自制 */
+    "自覺自愿\0"  /* 自觉自愿 */
+    "緻密\0"  /* 致密 */
+    "舂穀\0"  /* 舂谷 */
+    "輿\0"  /* 舆 */
+    "舌乾唇焦\0"  /* 舌干唇焦 */
+    "捨不得\0"  /* 舍不得 */
+    "捨出\0"  /* 舍出 */
+    "捨去\0"  /* 舍去 */
+    "捨命\0"  /* 舍命 */
+    "捨墮\0"  /* 舍堕 */
+    "捨安就危\0"  /* 舍安就危 */
+    "捨實\0"  /* 舍实 */
+    "捨己為人\0"  /* 舍己为人 */
+    "捨己為公\0"  /* 舍己为公 */
+    "捨己為國\0"  /* 舍己为国 */
+    "捨己從人\0"  /* 舍己从人 */
+    "捨己救人\0"  /* 舍己救人 */
+    "捨棄\0"  /* 舍弃 */
+    "捨得\0"  /* 舍得 */
+    "捨我其誰\0"  /* 舍我其谁 */
+    "捨本逐末\0"  /* 舍本逐末 */
+    "捨死忘生\0"  /* 舍死忘生 */
+    "捨生\0"  /* 舍生 */
+    "捨短取長\0"  /* 舍短取长 */
+    "捨身\0"  /* 舍身 */
+    "捨車保帥\0"  /* 舍车保帅 */
+    "捨近求遠\0"  /* 舍近求远 */
+    "舒捲\0"  /* 舒卷 */
+    "舞后\0"  /* 舞后 */
+    "艤\0"  /* 舣 */
+    "航海曆\0"  /* 航海历 */
+    "艦\0"  /* 舰 */
+    "艦隻\0"  /* 舰只 */
+    "艙\0"  /* 舱 */
+    "船隻\0"  /* 船只 */
+    "船鐘\0"  /* 船钟 */
+    "艫\0"  /* 舻 */
+    "良藥\0"  /* 良药 */
+    "艱\0"  /* 艰 */
+    "色慾\0"  /* 色欲 */
+    "艷\0"  /* 艳 */
+    "艷后\0"  /* 艳后 */
+    "艷后\0"  /* 艷后 */
+    "艸木丰丰\0"  /* 艸木丰丰 */
+    "藝\0"  /* 艺 */
+    "節\0"  /* 节 */
+    "節餘\0"  /* 节余 */
+    "節慾\0"  /* 节欲 */
+    "羋\0"  /* 芈 */
+    "芍藥\0"  /* 芍药 */
+    "薌\0"  /* 芗 */
+    "蕪\0"  /* 芜 */
+    "蘆\0"  /* 芦 */
+    "花捲\0"  /* 花卷 */
+    "花鬨\0"  /* 花哄 */
+    "花菴詞選\0"  /* 花庵词选 */
+    "花拳繡腿\0"  /* 花拳绣腿 */
+    "花盆裡\0"  /* 花盆里 */
+    "花藥\0"  /* 花药 */
+    "花鐘\0"  /* 花钟 */
+    "花馬弔嘴\0"  /* 花马吊嘴 */
+    "蓯\0"  /* 苁 */
+    "葦\0"  /* 苇 */
+    "藶\0"  /* 苈 */
+    "莧\0"  /* 苋 */
+    "萇\0"  /* 苌 */
+    "蒼\0"  /* 苍 */
+    "蒼髮\0"  /* 苍发 */
+    "蒼朮\0"  /* 苍术 */
+    "蒼鬱\0"  /* 苍郁 */
+    "苧\0"  /* 苎 */
+    "蘇\0"  /* 苏 */
+    "蘇崑\0"  /* 苏昆 */
+    "苑裡\0"  /* 苑里 */
+    "苦幹\0"  /* 苦干 */
+    "苦鬥\0"  /* 苦斗 */
+    "苦藥\0"  /* 苦药 */
+    "苦裡\0"  /* 苦里 */
+    "薴\0"  /* 苧 */
+    "英佔\0"  /* 英占 */
+    "蘋\0"  /* 苹 */
+    "苹縈\0"  /* 苹萦 */
+    "茂都澱\0"  /* 茂都淀 */
+    "範例\0"  /* 范例 */
+    "範圍\0"  /* 范围 */
+    "範字\0"  /* 范字 */
+    "範式\0"  /* 范式 */
+    "範性形變\0"  /* 范性形变 */
+    "範數\0"  /* 范数 */
+    "範文\0"  /* 范文 */
+    "範本\0"  /* 范本 */
+    "範疇\0"  /* 范畴 */
+    "範金\0"  /* 范金 */
+    "莖\0"  /* 茎 */
+    "莖幹\0"  /* 茎干 */
+    "蘢\0"  /* 茏 */
+    "蔦\0"  /* 茑 */
+    "塋\0"  /* 茔 */
+    "煢\0"  /* 茕 */
+    "繭\0"  /* 茧 */
+    "茶餘\0"  /* 茶余 */
+    "茶几\0"  /* 茶几 */
+    "茶莊\0"  /* 茶庄 */
+    "茶麵\0"  /* 茶面 */
+    "荊\0"  /* 荆 */
+    "草叢裡\0"  /* 草丛里 */
+    "草广\0"  /* 草广 */
+    "草荐\0"  /* 草荐 */
+    "草藥\0"  /* 草药 */
+    "薦\0"  /* 荐 */
+    "荐居\0"  /* 荐居 */
+    "荐臻\0"  /* 荐臻 */
+    "荐饑\0"  /* 荐饥 */
+    "莢\0"  /* 荚 */
+    "蕘\0"  /* 荛 */
+    "蓽\0"  /* 荜 */
+    "蕎\0"  /* 荞 */
+    "蕎麥麵\0"  /* 荞麦面 */
+    "薈\0"  /* 荟 */
+    "薺\0"  /* 荠 */
+    "盪\0"  /* 荡 */
+    "蕩產\0"  /* 荡产 */
+    "蕩女\0"  /* 荡女 */
+    "蕩婦\0"  /* 荡妇 */
+    "蕩寇\0"  /* 荡寇 */
+    "蕩平\0"  /* 荡平 */
+    "蕩來蕩去\0"  /* 荡来荡去 */
+    "蕩氣迴腸\0"  /* 荡气回肠 */
+    "蕩滌\0"  /* 荡涤 */
+    "蕩漾\0"  /* 荡漾 */
+    "蕩然\0"  /* 荡然 */
+    "蕩舟\0"  /* 荡舟 */
+    "蕩船\0"  /* 荡船 */
+    "蕩蕩\0"  /* 荡荡 */
+    "榮\0"  /* 荣 */
+    "葷\0"  /* 荤 */
+    "滎\0"  /* 荥 */
+    "犖\0"  /* 荦 */
+    "犖确\0"  /* 荦确 */
+    "熒\0"  /* 荧 */
+    "熒鬱\0"  /* 荧郁 */
+    "蕁\0"  /* 荨 */
+    "藎\0"  /* 荩 */
+    "蓀\0"  /* 荪 */
+    "蔭\0"  /* 荫 */
+    "葒\0"  /* 荭 */
+    "葯\0"  /* 药 */
+    "藥專\0"  /* 药专 */
+    "藥丸\0"  /* 药丸 */
+    "藥典\0"  /* 药典 */
+    "藥到命除\0"  /* 药到命除 */
+    "藥到病除\0"  /* 药到病除 */
+    "藥劑\0"  /* 药剂 */
+    "藥力\0"  /* 药力 */
+    "藥包\0"  /* 药包 */
+    "藥醫學系\0"  /* 药医学系 */
+    "藥單\0"  /* 药单 */
+    "藥廠\0"  /* 药厂 */
+    "藥名\0"  /* 药名 */
+    "藥味\0"  /* 药味 */
+    "藥品\0"  /* 药品 */
+    "藥商\0"  /* 药商 */
+    "藥頭\0"  /* 药头 */
+    "藥婆\0"  /* 药婆 */
+    "藥學\0"  /* 药学 */
+    "藥害\0"  /* 药害 */
+    "藥局\0"  /* 药局 */
+    "藥師\0"  /* 药师 */
+    "藥店\0"  /* 药店 */
+    "藥引\0"  /* 药引 */
+    "藥性\0"  /* 药性 */
+    "藥房\0"  /* 药房 */
+    "藥效\0"  /* 药效 */
+    "藥方\0"  /* 药方 */
+    "藥材\0"  /* 药材 */
+    "藥檢局\0"  /* 药检局 */
+    "藥棉\0"  /* 药棉 */
+    "藥水\0"  /* 药水 */
+    "藥油\0"  /* 药油 */
+    "藥液\0"  /* 药液 */
+    "藥渣\0"  /* 药渣 */
+    "藥片\0"  /* 药片 */
+    "藥物\0"  /* 药物 */
+    "藥王\0"  /* 药王 */
+    "藥理\0"  /* 药理 */
+    "藥瓶\0"  /* 药瓶 */
+    "藥用\0"  /* 药用 */
+    "藥皂\0"  /* 药皂 */
+    "藥盒\0"  /* 药盒 */
+    "藥石\0"  /* 药石 */
+    "藥科\0"  /* 药科 */
+    "藥籤\0"  /* 药签 */
+    "藥箱\0"  /* 药箱 */
+    "藥粉\0"  /* 药粉 */
+    "藥糖\0"  /* 药糖 */
+    "藥線\0"  /* 药线 */
+    "藥罐\0"  /* 药罐 */
+    "藥膏\0"  /* 药膏 */
+    "藥舖\0"  /* 药舖 */
+    "藥茶\0"  /* 药茶 */
+    "藥草\0"  /* 药草 */
+    "藥行\0"  /* 药行 */
+    "藥販\0"  /* 药贩 */
+    "藥費\0"  /* 药费 */
+    "藥酒\0"  /* 药酒 */
+    "藥量\0"  /* 药量 */
+    "藥針\0"  /* 药针 */
+    "藥鋪\0"  /* 药铺 */
+    "藥麵兒\0"  /* 药面儿 */
+    "藥餌\0"  /* 药饵 */
+    "荷花澱\0"  /* 荷花淀 */
+    "蒞\0"  /* 莅 */
+    "莜麵\0"  /* 莜面 */
+    "萊\0"  /* 莱 */
+    "蓮\0"  /* 莲 */
+    "蒔\0"  /* 莳 */
+    "萵\0"  /* 莴 */
+    "薟\0"  /* 莶 */
+    "獲\0"  /* 获 */
+    "獲匪其醜\0"  /* 获匪其丑 */
+    "蕕\0"  /* 莸 */
+    "瑩\0"  /* 莹 */
+    "鶯\0"  /* 莺 */
+    "莽蕩\0"  /* 莽荡 */
+    "菜乾\0"  /* 菜干 */
+    "菜肴\0"  /* 菜肴 */
+    "菠稜菜\0"  /* 菠棱菜 */
+    "菠蘿乾\0"  /* 菠萝干 */
+    "蘿\0"  /* 萝 */
+    "蘿蔔\0"  /* 萝卜 */
+    "蘿蔔乾\0"  /* 萝卜干 */
+    "螢\0"  /* 萤 */
+    "營\0"  /* 营 */
+    "營幹\0"  /* 营干 */
+    "縈\0"  /* 萦 */
+    "縈迴\0"  /* 萦回 */
+    "蕭\0"  /* 萧 */
+    "蕭蔘\0"  /* 萧参 */
+    "薩\0"  /* 萨 */
+    "落髮\0"  /* 落发 */
+    "落腮鬍\0"  /* 落腮胡 */
+    "葡佔\0"  /* 葡占 */
+    "葡萄乾\0"  /* 葡萄干 */
+    "董氏封髮\0"  /* 董氏封发 */
+    "蔥\0"  /* 葱 */
+    "蔥鬱\0"  /* 葱郁 */
+    "蕆\0"  /* 蒇 */
+    "蕢\0"  /* 蒉 */
+    "蔣\0"  /* 蒋 */
+    "蔞\0"  /* 蒌 */
+    "矇事\0"  /* 蒙事 */
+    "矇頭轉\0"  /* 蒙头转 */
+    "蒙莊\0"  /* 蒙庄 */
+    "懞懂\0"  /* 蒙懂 */
+    "矇昧無知\0"  /* 蒙昧无知 */
+    "濛鬆雨\0"  /* 蒙松雨 */
+    "蒙汗藥\0"  /* 蒙汗药 */
+    "濛汜\0"  /* 蒙汜 */
+    "矇混\0"  /* 蒙混 */
+    "懞直\0"  /* 蒙直 */
+    "矇著\0"  /* 蒙着 */
+    "矇瞍\0"  /* 蒙瞍 */
+    "矇聵\0"  /* 蒙聩 */
+    "朦朧\0"  /* 蒙胧 */
+    "懞懞懂懂\0"  /* 蒙蒙懂懂 */
+    "濛濛細雨\0"  /* 蒙蒙细雨 */
+    "濛霧\0"  /* 蒙雾 */
+    "矇騙\0"  /* 蒙骗 */
+    "濛鴻\0"  /* 蒙鸿 */
+    "蒜髮\0"  /* 蒜发 */
+    "蓄髮\0"  /* 蓄发 */
+    "蓄鬍\0"  /* 蓄胡 */
+    "蓄鬚\0"  /* 蓄须 */
+    "蓊鬱\0"  /* 蓊郁 */
+    "藍\0"  /* 蓝 */
+    "藍澱\0"  /* 蓝淀 */
+    "薊\0"  /* 蓟 */
+    "蘺\0"  /* 蓠 */
+    "蕷\0"  /* 蓣 */
+    "鎣\0"  /* 蓥 */
+    "驀\0"  /* 蓦 */
+    "蓬髮\0"  /* 蓬发 */
+    "蓬鬆\0"  /* 蓬松 */
+    "蓬蓬鬆鬆\0"  /* 蓬蓬松松 */
+    "虆\0"  /* 蔂 */
+    "薔\0"  /* 蔷 */
+    "蘞\0"  /* 蔹 */
+    "藺\0"  /* 蔺 */
+    "藹\0"  /* 蔼 */
+    "蘄\0"  /* 蕲 */
+    "蘊\0"  /* 蕴 */
+    "蘊含著\0"  /* 蕴含着 */
+    "蘊涵著\0"  /* 蕴涵着 */
+    "薄幹\0"  /* 薄干 */
+    "薄倖\0"  /* 薄幸 */
+    "薙髮\0"  /* 薙发 */
+    "薝蔔\0"  /* 薝卜 */
+    "藪\0"  /* 薮 */
+    "藏曆\0"  /* 藏历 */
+    "藏矇歌兒\0"  /* 藏蒙歌儿 */
+    "蘚\0"  /* 藓 */
+    "藤製\0"  /* 藤制 */
+    "櫱\0"  /* 蘖 */
+    "虎鬥\0"  /* 虎斗 */
+    "虎鬚\0"  /* 虎须 */
+    "虜\0"  /* 虏 */
+    "慮\0"  /* 虑 */
+    "虛\0"  /* 虚 */
+    "蟲\0"  /* 虫 */
+    "虫部\0"  /* 虫部 */
+    "虯\0"  /* 虬 */
+    "蟣\0"  /* 虮 */
+    "蟣蝨相弔\0"  /* 虮蝨相吊 */
+    "雖\0"  /* 虽 */
+    "蝦\0"  /* 虾 */
+    "蠆\0"  /* 虿 */
+    "蝕\0"  /* 蚀 */
+    "蟻\0"  /* 蚁 */
+    "蟻后\0"  /* 蚁后 */
+    "螞\0"  /* 蚂 */
+    "蚊動牛鬥\0"  /* 蚊动牛斗 */
+    "蠶\0"  /* 蚕 */
+    "蜆\0"  /* 蚬 */
+    "蛇髮女妖\0"  /* 蛇发女妖 */
+    "蠱\0"  /* 蛊 */
+    "蠣\0"  /* 蛎 */
+    "蟶\0"  /* 蛏 */
+    "蟶乾\0"  /* 蛏干 */
+    "蛔蟲藥\0"  /* 蛔虫药 */
+    "蠻\0"  /* 蛮 */
+    "蠻幹\0"  /* 蛮干 */
+    "蟄\0"  /* 蛰 */
+    "蛺\0"  /* 蛱 */
+    "蟯\0"  /* 蛲 */
+    "螄\0"  /* 蛳 */
+    "蠐\0"  /* 蛴 */
+    "蜂準\0"  /* 蜂准 */
+    "蜂后\0"  /* 蜂后 */
+    "蜂湧\0"  /* 蜂涌 */
+    "蛻\0"  /* 蜕 */
+    "蝸\0"  /* 蜗 */
+    "蜜裡調油\0"  /* 蜜里调油 */
+    "蠟\0"  /* 蜡 */
+    "蜡月\0"  /* 蜡月 */
+    "蜡祭\0"  /* 蜡祭 */
+    "蠅\0"  /* 蝇 */
+    "蟈\0"  /* 蝈 */
+    "蟬\0"  /* 蝉 */
+    "蠍\0"  /* 蝎 */
+    "蝎蝎螫螫\0"  /* 蝎蝎螫螫 */
+    "蝎譖\0"  /* 蝎谮 */
+    "螻\0"  /* 蝼 */
+    "蠑\0"  /* 蝾 */
+    "蟻后\0"  /* 蟻后 */
+    "蠁幹\0"  /* 蠁干 */
+    "血餘\0"  /* 血余 */
+    "血拚\0"  /* 血拼 */
+    "釁\0"  /* 衅 */
+    "釁鐘\0"  /* 衅钟 */
+    "行事曆\0"  /* 行事历 */
+    "行兇\0"  /* 行凶 */
+    "銜\0"  /* 衔 */
+    "衣繡晝行\0"  /* 衣绣昼行 */
+    "補\0"  /* 补 */
+    "補註\0"  /* 补注 */
+    "補藥\0"  /* 补药 */
+    "補血藥\0"  /* 补血药 */
+    "錶停\0"  /* 表停 */
+    "錶冠\0"  /* 表冠 */
+    "錶廠\0"  /* 表厂 */
+    "錶殼\0"  /* 表壳 */
+    "錶帶\0"  /* 表带 */
+    "錶店\0"  /* 表店 */
+    "表徵\0"  /* 表征 */
+    "錶快\0"  /* 表快 */
+    "錶慢\0"  /* 表慢 */
+    "錶板\0"  /* 表板 */
+    "錶王\0"  /* 表王 */
+    "錶的歷史\0"  /* 表的历史 */
+    "錶的嘀嗒\0"  /* 表的嘀嗒 */
+    "錶盤\0"  /* 表盘 */
+    "錶蒙子\0"  /* 表蒙子 */
+    "錶行\0"  /* 表行 */
+    "錶轉\0"  /* 表转 */
+    "錶速\0"  /* 表速 */
+    "表裡\0"  /* 表里 */
+    "錶針\0"  /* 表针 */
+    "錶鏈\0"  /* 表链 */
+    "襯\0"  /* 衬 */
+    "襯裡\0"  /* 衬里 */
+    "袞\0"  /* 衮 */
+    "襖\0"  /* 袄 */
+    "裊\0"  /* 袅 */
+    "袋錶\0"  /* 袋表 */
+    "袋裡\0"  /* 袋里 */
+    "袖裡\0"  /* 袖里 */
+    "襪\0"  /* 袜 */
+    "被髮佯狂\0"  /* 被发佯狂 */
+    "被髮入山\0"  /* 被发入山 */
+    "被髮左衽\0"  /* 被发左衽 */
+    "被髮纓冠\0"  /* 被发缨冠 */
+    "被髮陽狂\0"  /* 被发阳狂 */
+    "被複\0"  /* 被复 */
+    "被裡\0"  /* 被里 */
+    "襲\0"  /* 袭 */
+    "裁製\0"  /* 裁制 */
+    "裁併\0"  /* 裁并 */
+    "裝\0"  /* 装 */
+    "裝摺\0"  /* 装折 */
+    "襠\0"  /* 裆 */
+    "褳\0"  /* 裢 */
+    "襝\0"  /* 裣 */
+    "褲\0"  /* 裤 */
+    "褒讚\0"  /* 褒赞 */
+    "褸\0"  /* 褛 */
+    "襤\0"  /* 褴 */
+    "西佔\0"  /* 西占 */
+    "西曆\0"  /* 西历 */
+    "西周鐘\0"  /* 西周钟 */
+    "西嶽\0"  /* 西岳 */
+    "西晒\0"  /* 西晒 */
+    "西遊\0"  /* 西游 */
+    "西藥\0"  /* 西药 */
+    "要麼\0"  /* 要么 */
+    "要剋制\0"  /* 要克制 */
+    "要衝\0"  /* 要冲 */
+    "要佔\0"  /* 要占 */
+    "覆蓋著\0"  /* 覆盖着 */
+    "覆著\0"  /* 覆着 */
+    "見\0"  /* 见 */
+    "見稜見角\0"  /* 见棱见角 */
+    "見素抱樸\0"  /* 见素抱朴 */
+    "觀\0"  /* 观 */
+    "觀採\0"  /* 观采 */
+    "規\0"  /* 规 */
+    "規範\0"  /* 规范 */
+    "覓\0"  /* 觅 */
+    "視\0"  /* 视 */
+    "覘\0"  /* 觇 */
+    "覽\0"  /* 览 */
+    "覺\0"  /* 觉 */
+    "覬\0"  /* 觊 */
+    "覡\0"  /* 觋 */
+    "覿\0"  /* 觌 */
+    "覦\0"  /* 觎 */
+    "覯\0"  /* 觏 */
+    "覲\0"  /* 觐 */
+    "覷\0"  /* 觑 */
+    "角落裡\0"  /* 角落里 */
+    "觚稜\0"  /* 觚棱 */
+    "觴\0"  /* 觞 */
+    "解髮佯狂\0"  /* 解发佯狂 */
+    "解痛藥\0"  /* 解痛药 */
+    "解藥\0"  /* 解药 */
+    "解僱\0"  /* 解雇 */
+    "觸\0"  /* 触 */
+    "觸鬚\0"  /* 触须 */
+    "觶\0"  /* 觯 */
+    "言云\0"  /* 言云 */
+    "言大而夸\0"  /* 言大而夸 */
+    "言辯而确\0"  /* 言辩而确 */
+    "詩云\0"  /* 詩云 */
+    "譽\0"  /* 誉 */
+    "謄\0"  /* 誊 */
+    "語有云\0"  /* 語有云 */
+    "謷醜\0"  /* 謷丑 */
+    "警世鐘\0"  /* 警世钟 */
+    "警報鐘\0"  /* 警报钟 */
+    "警示鐘\0"  /* 警示钟 */
+    "警鐘\0"  /* 警钟 */
+    "計\0"  /* 计 */
+    "計時錶\0"  /* 计时表 */
+    "訂\0"  /* 订 */
+    "訂製\0"  /* 订制 */
+    "訃\0"  /* 讣 */
+    "認\0"  /* 认 */
+    "認準\0"  /* 认准 */
+    "譏\0"  /* 讥 */
+    "訐\0"  /* 讦 */
+    "訌\0"  /* 讧 */
+    "討\0"  /* 讨 */
+    "讓\0"  /* 让 */
+    "訕\0"  /* 讪 */
+    "訖\0"  /* 讫 */
+    "訓\0"  /* 训 */
+    "議\0"  /* 议 */
+    "訊\0"  /* 讯 */
+    "記\0"  /* 记 */
+    "講\0"  /* 讲 */
+    "諱\0"  /* 讳 */
+    "謳\0"  /* 讴 */
+    "詎\0"  /* 讵 */
+    "訝\0"  /* 讶 */
+    "訥\0"  /* 讷 */
+    "許\0"  /* 许 */
+    "許愿起經\0"  /* 许愿起经 */
+    "許虬\0"  /* 许虬 */
+    "訛\0"  /* 讹 */
+    "論\0"  /* 论 */
+    "訟\0"  /* 讼 */
+    "諷\0"  /* 讽 */
+    "設\0"  /* 设 */
+    "訪\0"  /* 访 */
+    "訣\0"  /* 诀 */
+    "證\0"  /* 证 */
+    "詁\0"  /* 诂 */
+    "訶\0"  /* 诃 */
+    "評\0"  /* 评 */
+    "評註\0"  /* 评注 */
+    "詛\0"  /* 诅 */
+    "識\0"  /* 识 */
+    "詐\0"  /* 诈 */
+    "訴\0"  /* 诉 */
+    "診\0"  /* 诊 */
+    "詆\0"  /* 诋 */
+    "謅\0"  /* 诌 */
+    "詞\0"  /* 词 */
+    "詞餘\0"  /* 词余 */
+    "詞幹\0"  /* 词干 */
+    "詞彙\0"  /* 词汇 */
+    "詘\0"  /* 诎 */
+    "詔\0"  /* 诏 */
+    "譯\0"  /* 译 */
+    "譯註\0"  /* 译注 */
+    "詒\0"  /* 诒 */
+    "誆\0"  /* 诓 */
+    "誄\0"  /* 诔 */
+    "誄讚\0"  /* 诔赞 */
+    "試\0"  /* 试 */
+    "試製\0"  /* 试制 */
+    "試藥\0"  /* 试药 */
+    "詿\0"  /* 诖 */
+    "詩\0"  /* 诗 */
+    "詩云\0"  /* 诗云 */
+    "詩餘\0"  /* 诗余 */
+    "詩讚\0"  /* 诗赞 */
+    "詩鐘\0"  /* 诗钟 */
+    "詰\0"  /* 诘 */
+    "詼\0"  /* 诙 */
+    "誠\0"  /* 诚 */
+    "誠徵\0"  /* 诚征 */
+    "誠樸\0"  /* 诚朴 */
+    "誅\0"  /* 诛 */
+    "詵\0"  /* 诜 */
+    "話\0"  /* 话 */
+    "話裡有話\0"  /* 话里有话 */
+    "誕\0"  /* 诞 */
+    "詬\0"  /* 诟 */
+    "詮\0"  /* 诠 */
+    "詭\0"  /* 诡 */
+    "詢\0"  /* 询 */
+    "詣\0"  /* 诣 */
+    "諍\0"  /* 诤 */
+    "該\0"  /* 该 */
+    "該鐘\0"  /* 该钟 */
+    "詳\0"  /* 详 */
+    "詳徵博引\0"  /* 详征博引 */
+    "詳註\0"  /* 详注 */
+    "詫\0"  /* 诧 */
+    "諢\0"  /* 诨 */
+    "詡\0"  /* 诩 */
+    "誡\0"  /* 诫 */
+    "誣\0"  /* 诬 */
+    "誣衊\0"  /* 诬蔑 */
+    "語\0"  /* 语 */
+    "語云\0"  /* 语云 */
+    "語有云\0"  /* 语有云 */
+    "語彙\0"  /* 语汇 */
+    "誚\0"  /* 诮 */
+    "誤\0"  /* 误 */
+    "誥\0"  /* 诰 */
+    "誘\0"  /* 诱 */
+    "誘姦\0"  /* 诱奸 */
+    "誨\0"  /* 诲 */
+    "誑\0"  /* 诳 */
+    "說\0"  /* 说 */
+    "說著\0"  /* 说着 */
+    "誦\0"  /* 诵 */
+    "誒\0"  /* 诶 */
+    "請\0"  /* 请 */
+    "請君入甕\0"  /* 请君入瓮 */
+    "請託\0"  /* 请托 */
+    "諸\0"  /* 诸 */
+    "諸餘\0"  /* 诸余 */
+    "諏\0"  /* 诹 */
+    "諾\0"  /* 诺 */
+    "讀\0"  /* 读 */
+    "諑\0"  /* 诼 */
+    "誹\0"  /* 诽 */
+    "課\0"  /* 课 */
+    "課餘\0"  /* 课余 */
+    "課徵\0"  /* 课征 */
+    "諉\0"  /* 诿 */
+    "諛\0"  /* 谀 */
+    "誰\0"  /* 谁 */
+    "誰幹的\0"  /* 谁干的 */
+    "諗\0"  /* 谂 */
+    "調\0"  /* 调 */
+    "調準\0"  /* 调准 */
+    "調製\0"  /* 调制 */
+    "調錶\0"  /* 调表 */
+    "諂\0"  /* 谄 */
+    "諒\0"  /* 谅 */
+    "諄\0"  /* 谆 */
+    "誶\0"  /* 谇 */
+    "談\0"  /* 谈 */
+    "談徵\0"  /* 谈征 */
+    "誼\0"  /* 谊 */
+    "謀\0"  /* 谋 */
+    "謀幹\0"  /* 谋干 */
+    "諶\0"  /* 谌 */
+    "諜\0"  /* 谍 */
+    "謊\0"  /* 谎 */
+    "諫\0"  /* 谏 */
+    "諧\0"  /* 谐 */
+    "謔\0"  /* 谑 */
+    "謁\0"  /* 谒 */
+    "謂\0"  /* 谓 */
+    "諤\0"  /* 谔 */
+    "諭\0"  /* 谕 */
+    "諼\0"  /* 谖 */
+    "讒\0"  /* 谗 */
+    "諮\0"  /* 谘 */
+    "諳\0"  /* 谙 */
+    "諺\0"  /* 谚 */
+    "諦\0"  /* 谛 */
+    "謎\0"  /* 谜 */
+    "諞\0"  /* 谝 */
+    "謨\0"  /* 谟 */
+    "讜\0"  /* 谠 */
+    "謖\0"  /* 谡 */
+    "謝\0"  /* 谢 */
+    "謝華后\0"  /* 谢华后 */
+    "謠\0"  /* 谣 */
+    "謗\0"  /* 谤 */
+    "謚\0"  /* 谥 */
+    "謙\0"  /* 谦 */
+    "謐\0"  /* 谧 */
+    "謹\0"  /* 谨 */
+    "謾\0"  /* 谩 */
+    "謫\0"  /* 谪 */
+    "譾\0"  /* 谫 */
+    "謬\0"  /* 谬 */
+    "謬讚\0"  /* 谬赞 */
+    "謬採虛聲\0"  /* 谬采虚声 */
+    "譚\0"  /* 谭 */
+    "譖\0"  /* 谮 */
+    "譙\0"  /* 谯 */
+    "讕\0"  /* 谰 */
+    "譜\0"  /* 谱 */
+    "譎\0"  /* 谲 */
+    "讞\0"  /* 谳 */
+    "譴\0"  /* 谴 */
+    "譫\0"  /* 谵 */
+    "讖\0"  /* 谶 */
+    "穀人\0"  /* 谷人 */
+    "穀倉\0"  /* 谷仓 */
+    "穀保家商\0"  /* 谷保家商 */
+    "穀圭\0"  /* 谷圭 */
+    "穀場\0"  /* 谷场 */
+    "穀殼\0"  /* 谷壳 */
+    "穀子\0"  /* 谷子 */
+    "穀日\0"  /* 谷日 */
+    "穀旦\0"  /* 谷旦 */
+    "穀梁\0"  /* 谷梁 */
+    "穀物\0"  /* 谷物 */
+    "穀皮\0"  /* 谷皮 */
+    "穀神\0"  /* 谷神 */
+    "穀米\0"  /* 谷米 */
+    "穀類\0"  /* 谷类 */
+    "穀粒\0"  /* 谷粒 */
+    "穀艙\0"  /* 谷舱 */
+    "穀苗\0"  /* 谷苗 */
+    "穀草\0"  /* 谷草 */
+    "穀穀\0"  /* 谷谷 */
+    "穀賤傷農\0"  /* 谷贱伤农 */
+    "穀貴餓農\0"  /* 谷贵饿农 */
+    "穀道\0"  /* 谷道 */
+    "穀雨\0"  /* 谷雨 */
+    "穀食\0"  /* 谷食 */
+    "豆乾\0"  /* 豆干 */
+    "象徵\0"  /* 象征 */
+    "象徵著\0"  /* 象征着 */
+    "買兇\0"  /* 買凶 */
+    "賈后\0"  /* 賈后 */
+    "賢后\0"  /* 賢后 */
+    "賸餘\0"  /* 賸余 */
+    "貝\0"  /* 贝 */
+    "貞\0"  /* 贞 */
+    "負\0"  /* 负 */
+    "負債纍纍\0"  /* 负债累累 */
+    "貢\0"  /* 贡 */
+    "財\0"  /* 财 */
+    "責\0"  /* 责 */
+    "賢\0"  /* 贤 */
+    "賢后\0"  /* 贤后 */
+    "敗\0"  /* 败 */
+    "賬\0"  /* 账 */
+    "貨\0"  /* 货 */
+    "質\0"  /* 质 */
+    "質樸\0"  /* 质朴 */
+    "販\0"  /* 贩 */
+    "貪\0"  /* 贪 */
+    "貪慾\0"  /* 贪欲 */
+    "貧\0"  /* 贫 */
+    "貶\0"  /* 贬 */
+    "購\0"  /* 购 */
+    "購買慾\0"  /* 购买欲 */
+    "購併\0"  /* 购并 */
+    "貯\0"  /* 贮 */
+    "貫\0"  /* 贯 */
+    "貳\0"  /* 贰 */
+    "賤\0"  /* 贱 */
+    "賁\0"  /* 贲 */
+    "貰\0"  /* 贳 */
+    "貼\0"  /* 贴 */
+    "貴\0"  /* 贵 */
+    "貴价\0"  /* 贵价 */
+    "貴幹\0"  /* 贵干 */
+    "貴徵\0"  /* 贵征 */
+    "貺\0"  /* 贶 */
+    "貸\0"  /* 贷 */
+    "貿\0"  /* 贸 */
+    "費\0"  /* 费 */
+    "費佔\0"  /* 费占 */
+    "賀\0"  /* 贺 */
+    "貽\0"  /* 贻 */
+    "貽範\0"  /* 贻范 */
+    "賊\0"  /* 贼 */
+    "贄\0"  /* 贽 */
+    "賈\0"  /* 贾 */
+    "賈后\0"  /* 贾后 */
+    "賄\0"  /* 贿 */
+    "貲\0"  /* 赀 */
+    "賃\0"  /* 赁 */
+    "賂\0"  /* 赂 */
+    "贓\0"  /* 赃 */
+    "資\0"  /* 资 */
+    "賅\0"  /* 赅 */
+    "贐\0"  /* 赆 */
+    "賕\0"  /* 赇 */
+    "賑\0"  /* 赈 */
+    "賑饑\0"  /* 赈饥 */
+    "賚\0"  /* 赉 */
+    "賒\0"  /* 赊 */
+    "賦\0"  /* 赋 */
+    "賭\0"  /* 赌 */
+    "賭檯\0"  /* 赌台 */
+    "賭后\0"  /* 赌后 */
+    "賭鬥\0"  /* 赌斗 */
+    "齎\0"  /* 赍 */
+    "贖\0"  /* 赎 */
+    "賞\0"  /* 赏 */
+    "賞讚\0"  /* 赏赞 */
+    "賜\0"  /* 赐 */
+    "賡\0"  /* 赓 */
+    "賠\0"  /* 赔 */
+    "賧\0"  /* 赕 */
+    "賴\0"  /* 赖 */
+    "贅\0"  /* 赘 */
+    "賻\0"  /* 赙 */
+    "賺\0"  /* 赚 */
+    "賽\0"  /* 赛 */
+    "賾\0"  /* 赜 */
+    "贗\0"  /* 赝 */
+    "贊\0"  /* 赞 */
+    "讚不絕口\0"  /* 赞不绝口 */
+    "讚樂\0"  /* 赞乐 */
+    "讚佩\0"  /* 赞佩 */
+    "讚歎\0"  /* 赞叹 */
+    "讚嘆不已\0"  /* 赞叹不已 */
+    "讚唄\0"  /* 赞呗 */
+    "讚揚\0"  /* 赞扬 */
+    "讚歌\0"  /* 赞歌 */
+    "讚美\0"  /* 赞美 */
+    "讚羨\0"  /* 赞羡 */
+    "讚譽\0"  /* 赞誉 */
+    "讚許\0"  /* 赞许 */
+    "讚詞\0"  /* 赞词 */
+    "讚賞\0"  /* 赞赏 */
+    "讚辭\0"  /* 赞辞 */
+    "讚頌\0"  /* 赞颂 */
+    "贈\0"  /* 赠 */
+    "贍\0"  /* 赡 */
+    "贏\0"  /* 赢 */
+    "贏餘\0"  /* 赢余 */
+    "贛\0"  /* 赣 */
+    "赤朮\0"  /* 赤术 */
+    "赤繩繫足\0"  /* 赤绳系足 */
+    "趙\0"  /* 赵 */
+    "趙威后\0"  /* 赵威后 */
+    "趙莊\0"  /* 赵庄 */
+    "趙惠后\0"  /* 赵惠后 */
+    "趙治勳\0"  /* 赵治勋 */
+    "趕\0"  /* 赶 */
+    "趕製\0"  /* 赶制 */
+    "趕麵棍\0"  /* 赶面棍 */
+    "起鬨\0"  /* 起哄 */
+    "起複\0"  /* 起复 */
+    "超級盃\0"  /* 超级杯 */
+    "趨\0"  /* 趋 */
+    "趲\0"  /* 趱 */
+    "趲幹\0"  /* 趱干 */
+    "躉\0"  /* 趸 */
+    "躍\0"  /* 跃 */
+    "蹌\0"  /* 跄 */
+    "跌扑\0"  /* 跌扑 */
+    "跌蕩\0"  /* 跌荡 */
+    "躒\0"  /* 跞 */
+    "路籤\0"  /* 路签 */
+    "跳樑小丑\0"  /* 跳梁小丑 */
+    "跳蕩\0"  /* 跳荡 */
+    "跳錶\0"  /* 跳表 */
+    "踐\0"  /* 践 */
+    "蹺\0"  /* 跷 */
+    "蹕\0"  /* 跸 */
+    "躚\0"  /* 跹 */
+    "躋\0"  /* 跻 */
+    "踴\0"  /* 踊 */
+    "躊\0"  /* 踌 */
+    "蹤\0"  /* 踪 */
+    "躓\0"  /* 踬 */
+    "躑\0"  /* 踯 */
+    "躡\0"  /* 蹑 */
+    "蹣\0"  /* 蹒 */
+    "躕\0"  /* 蹰 */
+    "躥\0"  /* 蹿 */
+    "躁鬱\0"  /* 躁郁 */
+    "躪\0"  /* 躏 */
+    "躦\0"  /* 躜 */
+    "軀\0"  /* 躯 */
+    "軀幹\0"  /* 躯干 */
+    "車\0"  /* 车 */
+    "車庫裡\0"  /* 车库里 */
+    "車站裡\0"  /* 车站里 */
+    "車裡\0"  /* 车里 */
+    "軋\0"  /* 轧 */
+    "軌\0"  /* 轨 */
+    "軌範\0"  /* 轨范 */
+    "軒\0"  /* 轩 */
+    "軒闢\0"  /* 轩辟 */
+    "軔\0"  /* 轫 */
+    "轉\0"  /* 转 */
+    "轉檯\0"  /* 转台 */
+    "轉託\0"  /* 转托 */
+    "轉鬥千里\0"  /* 转斗千里 */
+    "軛\0"  /* 轭 */
+    "輪\0"  /* 轮 */
+    "輪迴\0"  /* 轮回 */
+    "輪姦\0"  /* 轮奸 */
+    "軟\0"  /* 软 */
+    "轟\0"  /* 轰 */
+    "軻\0"  /* 轲 */
+    "轤\0"  /* 轳 */
+    "軸\0"  /* 轴 */
+    "軹\0"  /* 轵 */
+    "軼\0"  /* 轶 */
+    "軫\0"  /* 轸 */
+    "轢\0"  /* 轹 */
+    "軺\0"  /* 轺 */
+    "輕\0"  /* 轻 */
+    "輕鬆\0"  /* 轻松 */
+    "輕輕鬆鬆\0"  /* 轻轻松松 */
+    "軾\0"  /* 轼 */
+    "載\0"  /* 载 */
+    "輊\0"  /* 轾 */
+    "轎\0"  /* 轿 */
+    "輇\0"  /* 辁 */
+    "輅\0"  /* 辂 */
+    "較\0"  /* 较 */
+    "輒\0"  /* 辄 */
+    "輔\0"  /* 辅 */
+    "輛\0"  /* 辆 */
+    "輦\0"  /* 辇 */
+    "輩\0"  /* 辈 */
+    "輝\0"  /* 辉 */
+    "輥\0"  /* 辊 */
+    "輞\0"  /* 辋 */
+    "輟\0"  /* 辍 */
+    "輜\0"  /* 辎 */
+    "輳\0"  /* 辏 */
+    "輻\0"  /* 辐 */
+    "輯\0"  /* 辑 */
+    "輸\0"  /* 输 */
+    "轡\0"  /* 辔 */
+    "轅\0"  /* 辕 */
+    "轄\0"  /* 辖 */
+    "輾\0"  /* 辗 */
+    "轆\0"  /* 辘 */
+    "轍\0"  /* 辙 */
+    "轔\0"  /* 辚 */
+    "辭\0"  /* 辞 */
+    "辭彙\0"  /* 辞汇 */
+    "闢為\0"  /* 辟为 */
+    "闢佛\0"  /* 辟佛 */
+    "闢作\0"  /* 辟作 */
+    "闢劃\0"  /* 辟划 */
+    "闢土\0"  /* 辟土 */
+    "闢地\0"  /* 辟地 */
+    "闢室\0"  /* 辟室 */
+    "闢建\0"  /* 辟建 */
+    "闢田\0"  /* 辟田 */
+    "闢築\0"  /* 辟筑 */
+    "闢謠\0"  /* 辟谣 */
+    "辟穀\0"  /* 辟谷 */
+    "闢辟\0"  /* 辟辟 */
+    "闢邪以律\0"  /* 辟邪以律 */
+    "辯\0"  /* 辩 */
+    "辯鬥\0"  /* 辩斗 */
+    "辮\0"  /* 辫 */
+    "辮髮\0"  /* 辫发 */
+    "邊\0"  /* 边 */
+    "遼\0"  /* 辽 */
+    "遼瀋\0"  /* 辽沈 */
+    "達\0"  /* 达 */
+    "遷\0"  /* 迁 */
+    "迂迴\0"  /* 迂回 */
+    "過\0"  /* 过 */
+    "過杆\0"  /* 过杆 */
+    "過水麵\0"  /* 过水面 */
+    "邁\0"  /* 迈 */
+    "運\0"  /* 运 */
+    "近日無讎\0"  /* 近日無仇 */
+    "近日裡\0"  /* 近日里 */
+    "返樸\0"  /* 返朴 */
+    "還\0"  /* 还 */
+    "還衝\0"  /* 还冲 */
+    "還佔\0"  /* 还占 */
+    "還採\0"  /* 还采 */
+    "這\0"  /* 这 */
+    "這麼\0"  /* 这么 */
+    "這麼著\0"  /* 这么着 */
+    "這夥人\0"  /* 这伙人 */
+    "這隻\0"  /* 这只 */
+    "這只採\0"  /* 这只采 */
+    "這裡\0"  /* 这里 */
+    "這鐘\0"  /* 这钟 */
+    "進\0"  /* 进 */
+    "進佔\0"  /* 进占 */
+    "遠\0"  /* 远 */
+    "遠縣纔至\0"  /* 远县才至 */
+    "遠遊\0"  /* 远游 */
+    "違\0"  /* 违 */
+    "連\0"  /* 连 */
+    "連三併四\0"  /* 连三并四 */
+    "連佔\0"  /* 连占 */
+    "連莊\0"  /* 连庄 */
+    "連繫\0"  /* 连系 */
+    "連採\0"  /* 连采 */
+    "遲\0"  /* 迟 */
+    "迥然迴異\0"  /* 迥然回异 */
+    "邇\0"  /* 迩 */
+    "逕\0"  /* 迳 */
+    "迷幻藥\0"  /* 迷幻药 */
+    "迷藥\0"  /* 迷药 */
+    "迷濛\0"  /* 迷蒙 */
+    "迷魂藥\0"  /* 迷魂药 */
+    "跡\0"  /* 迹 */
+    "追兇\0"  /* 追凶 */
+    "退夥\0"  /* 退伙 */
+    "退燒藥\0"  /* 退烧药 */
+    "適\0"  /* 适 */
+    "逆鐘\0"  /* 逆钟 */
+    "選\0"  /* 选 */
+    "遜\0"  /* 逊 */
+    "逋髮\0"  /* 逋发 */
+    "逍遙遊\0"  /* 逍遥游 */
+    "透闢\0"  /* 透辟 */
+    "遞\0"  /* 递 */
+    "遞迴\0"  /* 递回 */
+    "通曆\0"  /* 通历 */
+    "通姦\0"  /* 通奸 */
+    "通莊\0"  /* 通庄 */
+    "通心麵\0"  /* 通心面 */
+    "逞兇鬥狠\0"  /* 逞凶斗狠 */
+    "逞兇鬥狠\0"  /* 逞凶鬥狠 */
+    "造鐘\0"  /* 造钟 */
+    "造鐘錶\0"  /* 造钟表 */
+    "邐\0"  /* 逦 */
+    "邏\0"  /* 逻 */
+    "逼併\0"  /* 逼并 */
+    "道範\0"  /* 道范 */
+    "遺\0"  /* 遗 */
+    "遺傳鐘\0"  /* 遗传钟 */
+    "遺範\0"  /* 遗范 */
+    "遺迹\0"  /* 遗迹 */
+    "遙\0"  /* 遥 */
+    "遨遊\0"  /* 遨游 */
+    "遮醜\0"  /* 遮丑 */
+    "避孕藥\0"  /* 避孕药 */
+    "邀天之倖\0"  /* 邀天之幸 */
+    "邋裡邋遢\0"  /* 邋里邋遢 */
+    "鄧\0"  /* 邓 */
+    "鄺\0"  /* 邝 */
+    "那麼\0"  /* 那么 */
+    "那麼著\0"  /* 那么着 */
+    "那捲\0"  /* 那卷 */
+    "那隻\0"  /* 那只 */
+    "那裡\0"  /* 那里 */
+    "鄔\0"  /* 邬 */
+    "郵\0"  /* 邮 */
+    "邱于庭\0"  /* 邱于庭 */
+    "鄒\0"  /* 邹 */
+    "鄴\0"  /* 邺 */
+    "鄰\0"  /* 邻 */
+    "鬱伊\0"  /* 郁伊 */
+    "鬱勃\0"  /* 郁勃 */
+    "鬱卒\0"  /* 郁卒 */
+    "鬱南\0"  /* 郁南 */
+    "鬱壘\0"  /* 郁垒 */
+    "鬱堙不偶\0"  /* 郁堙不偶 */
+    "鬱塞\0"  /* 郁塞 */
+    "鬱律\0"  /* 郁律 */
+    "鬱悒\0"  /* 郁悒 */
+    "鬱憤\0"  /* 郁愤 */
+    "鬱抑\0"  /* 郁抑 */
+    "鬱挹\0"  /* 郁挹 */
+    "郁樸\0"  /* 郁朴 */
+    "鬱林\0"  /* 郁林 */
+    "鬱氣\0"  /* 郁气 */
+    "鬱江\0"  /* 郁江 */
+    "鬱沉沉\0"  /* 郁沉沉 */
+    "鬱泱\0"  /* 郁泱 */
+    "鬱火\0"  /* 郁火 */
+    "鬱熱\0"  /* 郁热 */
+    "鬱燠\0"  /* 郁燠 */
+    "鬱症\0"  /* 郁症 */
+    "鬱積\0"  /* 郁积 */
+    "鬱紆\0"  /* 郁纡 */
+    "鬱結\0"  /* 郁结 */
+    "鬱蒸\0"  /* 郁蒸 */
+    "鬱蓊\0"  /* 郁蓊 */
+    "鬱血\0"  /* 郁血 */
+    "鬱邑\0"  /* 郁邑 */
+    "鬱郁\0"  /* 郁郁 */
+    "鬱鬱不樂\0"  /* 郁郁不乐 */
+    "鬱鬱不平\0"  /* 郁郁不平 */
+    "鬱鬱寡歡\0"  /* 郁郁寡欢 */
+    "鬱鬱而終\0"  /* 郁郁而终 */
+    "鬱鬱蔥蔥\0"  /* 郁郁葱葱 */
+    "鬱金\0"  /* 郁金 */
+    "鬱閉\0"  /* 郁闭 */
+    "鬱悶\0"  /* 郁闷 */
+    "鬱陶\0"  /* 郁陶 */
+    "鬱黑\0"  /* 郁黑 */
+    "郊遊\0"  /* 郊游 */
+    "郟\0"  /* 郏 */
+    "鄶\0"  /* 郐 */
+    "鄭\0"  /* 郑 */
+    "鄭凱云\0"  /* 郑凯云 */
+    "鄭莊公\0"  /* 郑庄公 */
+    "鄆\0"  /* 郓 */
+    "郘鐘\0"  /* 郘钟 */
+    "酈\0"  /* 郦 */
+    "鄖\0"  /* 郧 */
+    "郭后\0"  /* 郭后 */
+    "鄲\0"  /* 郸 */
+    "鄉愿\0"  /* 鄉愿 */
+    "鄭凱云\0"  /* 鄭凱云 */
+    "配製\0"  /* 配制 */
+    "配水幹管\0"  /* 配水干管 */
+    "配藥\0"  /* 配药 */
+    "酒罈\0"  /* 酒坛 */
+    "酒帘\0"  /* 酒帘 */
+    "酒麴\0"  /* 酒曲 */
+    "酒肴\0"  /* 酒肴 */
+    "酒藥\0"  /* 酒药 */
+    "醞\0"  /* 酝 */
+    "醞釀著\0"  /* 酝酿着 */
+    "酥鬆\0"  /* 酥松 */
+    "醬\0"  /* 酱 */
+    "釅\0"  /* 酽 */
+    "釃\0"  /* 酾 */
+    "釀\0"  /* 酿 */
+    "釀製\0"  /* 酿制 */
+    "醇樸\0"  /* 醇朴 */
+    "醋罈\0"  /* 醋坛 */
+    "採下\0"  /* 采下 */
+    "採為\0"  /* 采为 */
+    "採買\0"  /* 采买 */
+    "採伐\0"  /* 采伐 */
+    "採住\0"  /* 采住 */
+    "採信\0"  /* 采信 */
+    "採光\0"  /* 采光 */
+    "採到\0"  /* 采到 */
+    "採制\0"  /* 采制 */
+    "採辦\0"  /* 采办 */
+    "採區\0"  /* 采区 */
+    "採去\0"  /* 采去 */
+    "採取\0"  /* 采取 */
+    "採回\0"  /* 采回 */
+    "採在\0"  /* 采在 */
+    "採好\0"  /* 采好 */
+    "採錄\0"  /* 采录 */
+    "採得\0"  /* 采得 */
+    "採擇\0"  /* 采择 */
+    "採拾\0"  /* 采拾 */
+    "採挖\0"  /* 采挖 */
+    "採掘\0"  /* 采掘 */
+    "採摘\0"  /* 采摘 */
+    "採摭\0"  /* 采摭 */
+    "採擷\0"  /* 采撷 */
+    "採收\0"  /* 采收 */
+    "採料\0"  /* 采料 */
+    "採暖\0"  /* 采暖 */
+    "採樹種\0"  /* 采树种 */
+    "採樣\0"  /* 采样 */
+    "採桑\0"  /* 采桑 */
+    "採樵人\0"  /* 采樵人 */
+    "採氣\0"  /* 采气 */
+    "採油\0"  /* 采油 */
+    "採煤\0"  /* 采煤 */
+    "採獵\0"  /* 采猎 */
+    "採珠\0"  /* 采珠 */
+    "採生折割\0"  /* 采生折割 */
+    "採用\0"  /* 采用 */
+    "採的\0"  /* 采的 */
+    "採鹽\0"  /* 采盐 */
+    "採石\0"  /* 采石 */
+    "採礦\0"  /* 采矿 */
+    "採砂場\0"  /* 采砂场 */
+    "採種\0"  /* 采种 */
+    "採空區\0"  /* 采空区 */
+    "採空採穗\0"  /* 采空采穗 */
+    "採納\0"  /* 采納 */
+    "採納\0"  /* 采纳 */
+    "採給\0"  /* 采给 */
+    "採花\0"  /* 采花 */
+    "採芹人\0"  /* 采芹人 */
+    "採茶\0"  /* 采茶 */
+    "採藥\0"  /* 采药 */
+    "採蓮\0"  /* 采莲 */
+    "採獲\0"  /* 采获 */
+    "採菊\0"  /* 采菊 */
+    "採薇\0"  /* 采薇 */
+    "採薪\0"  /* 采薪 */
+    "採行\0"  /* 采行 */
+    "採補\0"  /* 采补 */
+    "採訪\0"  /* 采访 */
+    "採證\0"  /* 采证 */
+    "採購\0"  /* 采购 */
+    "採過\0"  /* 采过 */
+    "採運\0"  /* 采运 */
+    "採選\0"  /* 采选 */
+    "採金\0"  /* 采金 */
+    "採鐵\0"  /* 采铁 */
+    "採集\0"  /* 采集 */
+    "採風\0"  /* 采风 */
+    "採食\0"  /* 采食 */
+    "釉藥\0"  /* 釉药 */
+    "釋\0"  /* 释 */
+    "裡勾外連\0"  /* 里勾外连 */
+    "裡頭\0"  /* 里头 */
+    "裡層\0"  /* 里层 */
+    "裡屋\0"  /* 里屋 */
+    "裡布\0"  /* 里布 */
+    "裡帶\0"  /* 里带 */
+    "裡應外合\0"  /* 里应外合 */
+    "裡弦\0"  /* 里弦 */
+    "裏手\0"  /* 里手 */
+    "裏海\0"  /* 里海 */
+    "里程錶\0"  /* 里程表 */
+    "裡脊\0"  /* 里脊 */
+    "裡衣\0"  /* 里衣 */
+    "裡邊\0"  /* 里边 */
+    "裡通外國\0"  /* 里通外国 */
+    "裡通外敵\0"  /* 里通外敌 */
+    "裡間\0"  /* 里间 */
+    "裡面\0"  /* 里面 */
+    "重製\0"  /* 重制 */
+    "重複\0"  /* 重复 */
+    "重託\0"  /* 重托 */
+    "重摺\0"  /* 重折 */
+    "重遊\0"  /* 重游 */
+    "重羅麵\0"  /* 重罗面 */
+    "重鎚\0"  /* 重锤 */
+    "野薑\0"  /* 野姜 */
+    "野遊\0"  /* 野游 */
+    "金崙溪\0"  /* 金仑溪 */
+    "金髮\0"  /* 金发 */
+    "金色長髮\0"  /* 金色长发 */
+    "金範\0"  /* 金范 */
+    "金錶\0"  /* 金表 */
+    "金裝玉裡\0"  /* 金装玉里 */
+    "金鐘\0"  /* 金钟 */
+    "金馬崙道\0"  /* 金马仑道 */
+    "鑒\0"  /* 鉴 */
+    "鑾\0"  /* 銮 */
+    "鏨\0"  /* 錾 */
+    "鎮\0"  /* 鎭 */
+    "釓\0"  /* 钆 */
+    "釔\0"  /* 钇 */
+    "針\0"  /* 针 */
+    "釘\0"  /* 钉 */
+    "釘鎚\0"  /* 钉锤 */
+    "釗\0"  /* 钊 */
+    "釙\0"  /* 钋 */
+    "釕\0"  /* 钌 */
+    "釷\0"  /* 钍 */
+    "釧\0"  /* 钏 */
+    "釤\0"  /* 钐 */
+    "釩\0"  /* 钒 */
+    "釣\0"  /* 钓 */
+    "鍆\0"  /* 钔 */
+    "釹\0"  /* 钕 */
+    "釵\0"  /* 钗 */
+    "鈣\0"  /* 钙 */
+    "鈦\0"  /* 钛 */
+    "鉅\0"  /* 钜 */
+    "鈍\0"  /* 钝 */
+    "鈔\0"  /* 钞 */
+    "鍾\0"  /* 钟 */
+    "鐘上\0"  /* 钟上 */
+    "鐘下\0"  /* 钟下 */
+    "鐘不\0"  /* 钟不 */
+    "鐘乳洞\0"  /* 钟乳洞 */
+    "鐘乳石\0"  /* 钟乳石 */
+    "鐘體\0"  /* 钟体 */
+    "鐘停\0"  /* 钟停 */
+    "鐘關\0"  /* 钟关 */
+    "鐘匠\0"  /* 钟匠 */
+    "鐘發音\0"  /* 钟发音 */
+    "鐘口\0"  /* 钟口 */
+    "鐘響\0"  /* 钟响 */
+    "鐘在寺裡\0"  /* 钟在寺里 */
+    "鐘塔\0"  /* 钟塔 */
+    "鐘壁\0"  /* 钟壁 */
+    "鐘聲\0"  /* 钟声 */
+    "鐘太\0"  /* 钟太 */
+    "鐘頭\0"  /* 钟头 */
+    "鐘好\0"  /* 钟好 */
+    "鐘山\0"  /* 钟山 */
+    "鐘左右\0"  /* 钟左右 */
+    "鐘差\0"  /* 钟差 */
+    "鐘座\0"  /* 钟座 */
+    "鐘形\0"  /* 钟形 */
+    "鐘律\0"  /* 钟律 */
+    "鐘快\0"  /* 钟快 */
+    "鐘意\0"  /* 钟意 */
+    "鐘慢\0"  /* 钟慢 */
+    "鐘擺\0"  /* 钟摆 */
+    "鐘敲\0"  /* 钟敲 */
+    "鐘有\0"  /* 钟有 */
+    "鐘樓\0"  /* 钟楼 */
+    "鐘模\0"  /* 钟模 */
+    "鐘沒\0"  /* 钟没 */
+    "鐘漏\0"  /* 钟漏 */
+    "鐘點\0"  /* 钟点 */
+    "鐘王\0"  /* 钟王 */
+    "鐘琴\0"  /* 钟琴 */
+    "鐘的\0"  /* 钟的 */
+    "鐘盤\0"  /* 钟盘 */
+    "鐘相\0"  /* 钟相 */
+    "鐘磬\0"  /* 钟磬 */
+    "鐘紐\0"  /* 钟纽 */
+    "鐘罩\0"  /* 钟罩 */
+    "鐘腰\0"  /* 钟腰 */
+    "鐘螺\0"  /* 钟螺 */
+    "鐘行\0"  /* 钟行 */
+    "鐘錶\0"  /* 钟表 */
+    "鐘表面\0"  /* 钟表面 */
+    "鐘被\0"  /* 钟被 */
+    "鐘調\0"  /* 钟调 */
+    "鐘身\0"  /* 钟身 */
+    "鐘速\0"  /* 钟速 */
+    "鐘陳列\0"  /* 钟陈列 */
+    "鐘面\0"  /* 钟面 */
+    "鐘頂\0"  /* 钟顶 */
+    "鐘鳴\0"  /* 钟鸣 */
+    "鐘鼎\0"  /* 钟鼎 */
+    "鐘鼓\0"  /* 钟鼓 */
+    "鈉\0"  /* 钠 */
+    "鋇\0"  /* 钡 */
+    "鋼\0"  /* 钢 */
+    "鋼製\0"  /* 钢制 */
+    "鋼樑\0"  /* 钢梁 */
+    "鈑\0"  /* 钣 */
+    "鈐\0"  /* 钤 */
+    "鑰\0"  /* 钥 */
+    "欽\0"  /* 钦 */
+    "鈞\0"  /* 钧 */
+    "鎢\0"  /* 钨 */
+    "鉤\0"  /* 钩 */
+    "鈎心鬥角\0"  /* 钩心斗角 */
+    "鈧\0"  /* 钪 */
+    "鈁\0"  /* 钫 */
+    "鈥\0"  /* 钬 */
+    "鈄\0"  /* 钭 */
+    "鈕\0"  /* 钮 */
+    "鈀\0"  /* 钯 */
+    "鈺\0"  /* 钰 */
+    "錢\0"  /* 钱 */
+    "錢莊\0"  /* 钱庄 */
+    "錢範\0"  /* 钱范 */
+    "錢穀\0"  /* 钱谷 */
+    "鉦\0"  /* 钲 */
+    "鉗\0"  /* 钳 */
+    "鈷\0"  /* 钴 */
+    "缽\0"  /* 钵 */
+    "鈳\0"  /* 钶 */
+    "鈽\0"  /* 钸 */
+    "鈸\0"  /* 钹 */
+    "鉞\0"  /* 钺 */
+    "鑽\0"  /* 钻 */
+    "鉬\0"  /* 钼 */
+    "鉭\0"  /* 钽 */
+    "鉀\0"  /* 钾 */
+    "鈿\0"  /* 钿 */
+    "鈾\0"  /* 铀 */
+    "鐵\0"  /* 铁 */
+    "鐵杆\0"  /* 铁杆 */
+    "鐵鐘\0"  /* 铁钟 */
+    "鐵鏽\0"  /* 铁锈 */
+    "鐵鎚\0"  /* 铁锤 */
+    "鉑\0"  /* 铂 */
+    "鈴\0"  /* 铃 */
+    "鑠\0"  /* 铄 */
+    "鉛\0"  /* 铅 */
+    "鉚\0"  /* 铆 */
+    "鈰\0"  /* 铈 */
+    "鉉\0"  /* 铉 */
+    "鉈\0"  /* 铊 */
+    "鉍\0"  /* 铋 */
+    "鈮\0"  /* 铌 */
+    "鈹\0"  /* 铍 */
+    "鐸\0"  /* 铎 */
+    "銬\0"  /* 铐 */
+    "銠\0"  /* 铑 */
+    "鉺\0"  /* 铒 */
+    "銪\0"  /* 铕 */
+    "鋮\0"  /* 铖 */
+    "鋏\0"  /* 铗 */
+    "鐃\0"  /* 铙 */
+    "鐺\0"  /* 铛 */
+    "銅\0"  /* 铜 */
+    "銅製\0"  /* 铜制 */
+    "銅範\0"  /* 铜范 */
+    "銅鐘\0"  /* 铜钟 */
+    "鋁\0"  /* 铝 */
+    "鋁製\0"  /* 铝制 */
+    "銦\0"  /* 铟 */
+    "鎧\0"  /* 铠 */
+    "鍘\0"  /* 铡 */
+    "銖\0"  /* 铢 */
+    "銑\0"  /* 铣 */
+    "鋌\0"  /* 铤 */
+    "銩\0"  /* 铥 */
+    "鏵\0"  /* 铧 */
+    "銓\0"  /* 铨 */
+    "鎩\0"  /* 铩 */
+    "鉿\0"  /* 铪 */
+    "銚\0"  /* 铫 */
+    "鉻\0"  /* 铬 */
+    "銘\0"  /* 铭 */
+    "錚\0"  /* 铮 */
+    "銫\0"  /* 铯 */
+    "銫鐘\0"  /* 铯钟 */
+    "鉸\0"  /* 铰 */
+    "銥\0"  /* 铱 */
+    "鏟\0"  /* 铲 */
+    "剷出\0"  /* 铲出 */
+    "剷刈\0"  /* 铲刈 */
+    "剷頭\0"  /* 铲头 */
+    "剷平\0"  /* 铲平 */
+    "剷除\0"  /* 铲除 */
+    "銃\0"  /* 铳 */
+    "鐋\0"  /* 铴 */
+    "銨\0"  /* 铵 */
+    "銀\0"  /* 银 */
+    "銀髮\0"  /* 银发 */
+    "銀硃\0"  /* 银朱 */
+    "銣\0"  /* 铷 */
+    "鑄\0"  /* 铸 */
+    "鑄鐘\0"  /* 铸钟 */
+    "鐒\0"  /* 铹 */
+    "鋪\0"  /* 铺 */
+    "鋪錦列繡\0"  /* 铺锦列绣 */
+    "錸\0"  /* 铼 */
+    "鋱\0"  /* 铽 */
+    "鏈\0"  /* 链 */
+    "鏗\0"  /* 铿 */
+    "銷\0"  /* 销 */
+    "鎖\0"  /* 锁 */
+    "鋰\0"  /* 锂 */
+    "鋤\0"  /* 锄 */
+    "鍋\0"  /* 锅 */
+    "鍋莊\0"  /* 锅庄 */
+    "鋯\0"  /* 锆 */
+    "鋨\0"  /* 锇 */
+    "銹\0"  /* 锈 */
+    "鏽病\0"  /* 锈病 */
+    "鏽菌\0"  /* 锈菌 */
+    "鏽蝕\0"  /* 锈蚀 */
+    "銼\0"  /* 锉 */
+    "鋝\0"  /* 锊 */
+    "鋒\0"  /* 锋 */
+    "鋅\0"  /* 锌 */
+    "銳\0"  /* 锐 */
+    "銻\0"  /* 锑 */
+    "鋃\0"  /* 锒 */
+    "鋟\0"  /* 锓 */
+    "鋦\0"  /* 锔 */
+    "錒\0"  /* 锕 */
+    "錆\0"  /* 锖 */
+    "鍺\0"  /* 锗 */
+    "錯\0"  /* 错 */
+    "錨\0"  /* 锚 */
+    "錛\0"  /* 锛 */
+    "錁\0"  /* 锞 */
+    "錕\0"  /* 锟 */
+    "錫\0"  /* 锡 */
+    "錮\0"  /* 锢 */
+    "鑼\0"  /* 锣 */
+    "錘\0"  /* 锤 */
+    "鎚兒\0"  /* 锤儿 */
+    "鎚頭\0"  /* 锤头 */
+    "鎚子\0"  /* 锤子 */
+    "錘鍊\0"  /* 锤炼 */
+    "錐\0"  /* 锥 */
+    "錦\0"  /* 锦 */
+    "錦繡\0"  /* 锦绣 */
+    "杴\0"  /* 锨 */
+    "錈\0"  /* 锩 */
+    "錟\0"  /* 锬 */
+    "錠\0"  /* 锭 */
+    "鍵\0"  /* 键 */
+    "鋸\0"  /* 锯 */
+    "錳\0"  /* 锰 */
+    "錙\0"  /* 锱 */
+    "鍥\0"  /* 锲 */
+    "鍥而不捨\0"  /* 锲而不舍 */
+    "鍇\0"  /* 锴 */
+    "鏘\0"  /* 锵 */
+    "鍶\0"  /* 锶 */
+    "鍔\0"  /* 锷 */
+    "鍤\0"  /* 锸 */
+    "鍬\0"  /* 锹 */
+    "鍾\0"  /* 锺 */
+    "鍛\0"  /* 锻 */
+    "鍛鍊出\0"  /* 锻炼出 */
+    "鎪\0"  /* 锼 */
+    "鍰\0"  /* 锾 */
+    "鍍\0"  /* 镀 */
+    "鎂\0"  /* 镁 */
+    "鏤\0"  /* 镂 */
+    "鐨\0"  /* 镄 */
+    "鏌\0"  /* 镆 */
+    "鎮\0"  /* 镇 */
+    "鎘\0"  /* 镉 */
+    "鑷\0"  /* 镊 */
+    "鐫\0"  /* 镌 */
+    "鎳\0"  /* 镍 */
+    "鎦\0"  /* 镏 */
+    "鎬\0"  /* 镐 */
+    "鎊\0"  /* 镑 */
+    "鎰\0"  /* 镒 */
+    "鎵\0"  /* 镓 */
+    "鑌\0"  /* 镔 */
+    "鏢\0"  /* 镖 */
+    "鏜\0"  /* 镗 */
+    "鏝\0"  /* 镘 */
+    "鏍\0"  /* 镙 */
+    "鏞\0"  /* 镛 */
+    "鏡\0"  /* 镜 */
+    "鏑\0"  /* 镝 */
+    "鏃\0"  /* 镞 */
+    "鏇\0"  /* 镟 */
+    "鐔\0"  /* 镡 */
+    "钁\0"  /* 镢 */
+    "鐐\0"  /* 镣 */
+    "鏷\0"  /* 镤 */
+    "鐓\0"  /* 镦 */
+    "鑭\0"  /* 镧 */
+    "鐠\0"  /* 镨 */
+    "鏹\0"  /* 镪 */
+    "鐙\0"  /* 镫 */
+    "鑊\0"  /* 镬 */
+    "鐳\0"  /* 镭 */
+    "鐲\0"  /* 镯 */
+    "鐮\0"  /* 镰 */
+    "鎌倉\0"  /* 镰仓 */
+    "鐿\0"  /* 镱 */
+    "鑣\0"  /* 镳 */
+    "鑲\0"  /* 镶 */
+    "長\0"  /* 长 */
+    "長几\0"  /* 长几 */
+    "長曆\0"  /* 长历 */
+    "長生藥\0"  /* 长生药 */
+    "長鬍\0"  /* 长胡 */
+    "門\0"  /* 门 */
+    "門弔兒\0"  /* 门吊儿 */
+    "門帘\0"  /* 门帘 */
+    "門裡\0"  /* 门里 */
+    "閂\0"  /* 闩 */
+    "閃\0"  /* 闪 */
+    "閆\0"  /* 闫 */
+    "閉\0"  /* 闭 */
+    "問\0"  /* 问 */
+    "闖\0"  /* 闯 */
+    "闖鍊\0"  /* 闯炼 */
+    "闖蕩\0"  /* 闯荡 */
+    "閏\0"  /* 闰 */
+    "闈\0"  /* 闱 */
+    "閑\0"  /* 闲 */
+    "閒情逸緻\0"  /* 闲情逸致 */
+    "閒遊\0"  /* 闲游 */
+    "閒蕩\0"  /* 闲荡 */
+    "閎\0"  /* 闳 */
+    "間\0"  /* 间 */
+    "間不容髮\0"  /* 间不容发 */
+    "閔\0"  /* 闵 */
+    "閔採爾\0"  /* 闵采尔 */
+    "閌\0"  /* 闶 */
+    "悶\0"  /* 闷 */
+    "悶著頭兒幹\0"  /* 闷着头儿干 */
+    "閘\0"  /* 闸 */
+    "鬧\0"  /* 闹 */
+    "鬧著玩兒\0"  /* 闹着玩儿 */
+    "鬧錶\0"  /* 闹表 */
+    "鬧鐘\0"  /* 闹钟 */
+    "閨\0"  /* 闺 */
+    "閨範\0"  /* 闺范 */
+    "聞\0"  /* 闻 */
+    "闥\0"  /* 闼 */
+    "閩\0"  /* 闽 */
+    "閭\0"  /* 闾 */
+    "閥\0"  /* 阀 */
+    "閣\0"  /* 阁 */
+    "閡\0"  /* 阂 */
+    "閫\0"  /* 阃 */
+    "閫範\0"  /* 阃范 */
+    "鬮\0"  /* 阄 */
+    "閱\0"  /* 阅 */
+    "閬\0"  /* 阆 */
+    "閾\0"  /* 阈 */
+    "閹\0"  /* 阉 */
+    "閶\0"  /* 阊 */
+    "鬩\0"  /* 阋 */
+    "閿\0"  /* 阌 */
+    "閽\0"  /* 阍 */
+    "閻\0"  /* 阎 */
+    "閼\0"  /* 阏 */
+    "闡\0"  /* 阐 */
+    "闌\0"  /* 阑 */
+    "闃\0"  /* 阒 */
+    "闊\0"  /* 阔 */
+    "闋\0"  /* 阕 */
+    "闔\0"  /* 阖 */
+    "闐\0"  /* 阗 */
+    "闕\0"  /* 阙 */
+    "闞\0"  /* 阚 */
+    "隊\0"  /* 队 */
+    "防颱\0"  /* 防台 */
+    "防禦\0"  /* 防御 */
+    "防晒\0"  /* 防晒 */
+    "防水錶\0"  /* 防水表 */
+    "防範\0"  /* 防范 */
+    "防鏽\0"  /* 防锈 */
+    "陽\0"  /* 阳 */
+    "陽曆\0"  /* 阳历 */
+    "陽春麵\0"  /* 阳春面 */
+    "陰\0"  /* 阴 */
+    "陰曆\0"  /* 阴历 */
+    "陰乾\0"  /* 阴干 */
+    "陰溝裡翻船\0"  /* 阴沟里翻船 */
+    "陰鬱\0"  /* 阴郁 */
+    "陣\0"  /* 阵 */
+    "階\0"  /* 阶 */
+    "阿獃\0"  /* 阿呆 */
+    "附註\0"  /* 附注 */
+    "際\0"  /* 际 */
+    "陸\0"  /* 陆 */
+    "陸遊\0"  /* 陆游 */
+    "隴\0"  /* 陇 */
+    "陳\0"  /* 陈 */
+    "陳冲\0"  /* 陈冲 */
+    "陳有后\0"  /* 陈有后 */
+    "陳鍊\0"  /* 陈炼 */
+    "陘\0"  /* 陉 */
+    "降壓藥\0"  /* 降压药 */
+    "陝\0"  /* 陕 */
+    "除臭藥\0"  /* 除臭药 */
+    "隉\0"  /* 陧 */
+    "隕\0"  /* 陨 */
+    "險\0"  /* 险 */
+    "陪弔\0"  /* 陪吊 */
+    "陳冲\0"  /* 陳冲 */
+    "隆準\0"  /* 隆准 */
+    "隨\0"  /* 随 */
+    "隱\0"  /* 隐 */
+    "隱几\0"  /* 隐几 */
+    "隱佔\0"  /* 隐占 */
+    "隸\0"  /* 隶 */
+    "雋\0"  /* 隽 */
+    "難\0"  /* 难 */
+    "難捨\0"  /* 难舍 */
+    "雅緻\0"  /* 雅致 */
+    "雅範\0"  /* 雅范 */
+    "集遊法\0"  /* 集游法 */
+    "僱主\0"  /* 雇主 */
+    "僱人\0"  /* 雇人 */
+    "僱傭\0"  /* 雇佣 */
+    "僱農\0"  /* 雇农 */
+    "僱到\0"  /* 雇到 */
+    "僱員\0"  /* 雇员 */
+    "僱工\0"  /* 雇工 */
+    "僱用\0"  /* 雇用 */
+    "雛\0"  /* 雏 */
+    "鵰心雁爪\0"  /* 雕心雁爪 */
+    "鵰悍\0"  /* 雕悍 */
+    "雕樑畫棟\0"  /* 雕梁画栋 */
+    "鵰翎\0"  /* 雕翎 */
+    "鵰鶚\0"  /* 雕鹗 */
+    "讎\0"  /* 雠 */
+    "雪窗螢几\0"  /* 雪窗萤几 */
+    "雪裡\0"  /* 雪里 */
+    "靂\0"  /* 雳 */
+    "零餘\0"  /* 零余 */
+    "零隻\0"  /* 零只 */
+    "霧\0"  /* 雾 */
+    "霧裡\0"  /* 雾里 */
+    "霽\0"  /* 霁 */
+    "霽範\0"  /* 霁范 */
+    "震慄\0"  /* 震栗 */
+    "震蕩\0"  /* 震荡 */
+    "黴毒\0"  /* 霉毒 */
+    "黴素\0"  /* 霉素 */
+    "黴菌\0"  /* 霉菌 */
+    "黴黑\0"  /* 霉黑 */
+    "黴黧\0"  /* 霉黧 */
+    "靄\0"  /* 霭 */
+    "露醜\0"  /* 露丑 */
+    "霸佔\0"  /* 霸占 */
+    "青山一髮\0"  /* 青山一发 */
+    "青苹\0"  /* 青苹 */
+    "青黴\0"  /* 青霉 */
+    "靚\0"  /* 靓 */
+    "靜\0"  /* 静 */
+    "非佔不可\0"  /* 非占不可 */
+    "面臨著\0"  /* 面临着 */
+    "麵人兒\0"  /* 面人儿 */
+    "麵價\0"  /* 面价 */
+    "麵包\0"  /* 面包 */
+    "面包紮\0"  /* 面包扎 */
+    "面包著\0"  /* 面包着 */
+    "麵廠\0"  /* 面厂 */
+    "麵糰\0"  /* 面团 */
+    "麵坊\0"  /* 面坊 */
+    "麵坯兒\0"  /* 面坯儿 */
+    "麵塑\0"  /* 面塑 */
+    "麵店\0"  /* 面店 */
+    "麵攤\0"  /* 面摊 */
+    "面朝著\0"  /* 面朝着 */
+    "麵杖\0"  /* 面杖 */
+    "麵條\0"  /* 面条 */
+    "麵湯\0"  /* 面汤 */
+    "麵漿\0"  /* 面浆 */
+    "麵灰\0"  /* 面灰 */
+    "麵疙瘩\0"  /* 面疙瘩 */
+    "麵皮\0"  /* 面皮 */
+    "麵碼兒\0"  /* 面码儿 */
+    "麵筋\0"  /* 面筋 */
+    "麵粉\0"  /* 面粉 */
+    "麵糊\0"  /* 面糊 */
+    "麵線\0"  /* 面线 */
+    "麵缸\0"  /* 面缸 */
+    "麵茶\0"  /* 面茶 */
+    "麵食\0"  /* 面食 */
+    "面食麵\0"  /* 面食面 */
+    "麵餃\0"  /* 面饺 */
+    "麵餅\0"  /* 面饼 */
+    "麵館\0"  /* 面馆 */
+    "靨\0"  /* 靥 */
+    "鞋裡\0"  /* 鞋里 */
+    "韃\0"  /* 鞑 */
+    "鞣製\0"  /* 鞣制 */
+    "鞭辟入裡\0"  /* 鞭辟入里 */
+    "韉\0"  /* 鞯 */
+    "韝\0"  /* 鞲 */
+    "韋\0"  /* 韦 */
+    "韋莊\0"  /* 韦庄 */
+    "韌\0"  /* 韧 */
+    "韓\0"  /* 韩 */
+    "韓製\0"  /* 韩制 */
+    "韓國製\0"  /* 韩国制 */
+    "韙\0"  /* 韪 */
+    "韞\0"  /* 韫 */
+    "韜\0"  /* 韬 */
+    "音準\0"  /* 音准 */
+    "音聲如鐘\0"  /* 音声如钟 */
+    "韻\0"  /* 韵 */
+    "頁\0"  /* 页 */
+    "頂\0"  /* 顶 */
+    "頃\0"  /* 顷 */
+    "頇\0"  /* 顸 */
+    "項\0"  /* 项 */
+    "項莊\0"  /* 项庄 */
+    "順\0"  /* 顺 */
+    "順鐘向\0"  /* 顺钟向 */
+    "須\0"  /* 须 */
+    "鬚髮\0"  /* 须发 */
+    "鬚根\0"  /* 须根 */
+    "鬚毛\0"  /* 须毛 */
+    "鬚生\0"  /* 须生 */
+    "鬚眉\0"  /* 须眉 */
+    "鬚鬍\0"  /* 须胡 */
+    "鬚鬚\0"  /* 须须 */
+    "鬚鯊\0"  /* 须鲨 */
+    "鬚鯨\0"  /* 须鲸 */
+    "頊\0"  /* 顼 */
+    "頑\0"  /* 顽 */
+    "顧\0"  /* 顾 */
+    "頓\0"  /* 顿 */
+    "頎\0"  /* 颀 */
+    "頒\0"  /* 颁 */
+    "頌\0"  /* 颂 */
+    "頌繫\0"  /* 颂系 */
+    "頌讚\0"  /* 颂赞 */
+    "頏\0"  /* 颃 */
+    "預\0"  /* 预 */
+    "預製\0"  /* 预制 */
+    "顱\0"  /* 颅 */
+    "領\0"  /* 领 */
+    "領域裡\0"  /* 领域里 */
+    "領袖慾\0"  /* 领袖欲 */
+    "頗\0"  /* 颇 */
+    "頸\0"  /* 颈 */
+    "頡\0"  /* 颉 */
+    "頰\0"  /* 颊 */
+    "頰鬚\0"  /* 颊须 */
+    "頜\0"  /* 颌 */
+    "潁\0"  /* 颍 */
+    "頦\0"  /* 颏 */
+    "頤\0"  /* 颐 */
+    "頻\0"  /* 频 */
+    "頹\0"  /* 颓 */
+    "頷\0"  /* 颔 */
+    "穎\0"  /* 颖 */
+    "顆\0"  /* 颗 */
+    "題\0"  /* 题 */
+    "題籤\0"  /* 题签 */
+    "顎\0"  /* 颚 */
+    "顓\0"  /* 颛 */
+    "顏\0"  /* 颜 */
+    "顏範\0"  /* 颜范 */
+    "額\0"  /* 额 */
+    "額徵\0"  /* 额征 */
+    "額我略曆\0"  /* 额我略历 */
+    "顳\0"  /* 颞 */
+    "顢\0"  /* 颟 */
+    "顛\0"  /* 颠 */
+    "顛乾倒坤\0"  /* 颠干倒坤 */
+    "顙\0"  /* 颡 */
+    "顥\0"  /* 颢 */
+    "顫\0"  /* 颤 */
+    "顫慄\0"  /* 颤栗 */
+    "顰\0"  /* 颦 */
+    "顴\0"  /* 颧 */
+    "風\0"  /* 风 */
+    "風捲殘雲\0"  /* 风卷残云 */
+    "風后\0"  /* 风后 */
+    "風土誌\0"  /* 风土志 */
+    "風乾\0"  /* 风干 */
+    "風物誌\0"  /* 风物志 */
+    "風範\0"  /* 风范 */
+    "風起雲湧\0"  /* 风起云涌 */
+    "風裡\0"  /* 风里 */
+    "颮\0"  /* 飑 */
+    "颯\0"  /* 飒 */
+    "颶\0"  /* 飓 */
+    "颼\0"  /* 飕 */
+    "飄\0"  /* 飘 */
+    "飄遊\0"  /* 飘游 */
+    "飄蕩\0"  /* 飘荡 */
+    "飄飄蕩蕩\0"  /* 飘飘荡荡 */
+    "飆\0"  /* 飙 */
+    "飛\0"  /* 飞 */
+    "飛芻輓粟\0"  /* 飞刍挽粟 */
+    "飛紮\0"  /* 飞扎 */
+    "飛行鐘\0"  /* 飞行钟 */
+    "食慾\0"  /* 食欲 */
+    "食野之苹\0"  /* 食野之苹 */
+    "食麵\0"  /* 食面 */
+    "饗\0"  /* 飨 */
+    "饜\0"  /* 餍 */
+    "飢\0"  /* 饥 */
+    "饑寒\0"  /* 饥寒 */
+    "饑民\0"  /* 饥民 */
+    "饑渴\0"  /* 饥渴 */
+    "饑溺\0"  /* 饥溺 */
+    "饑荒\0"  /* 饥荒 */
+    "饑飽\0"  /* 饥饱 */
+    "饑饉\0"  /* 饥馑 */
+    "餳\0"  /* 饧 */
+    "飩\0"  /* 饨 */
+    "餼\0"  /* 饩 */
+    "飪\0"  /* 饪 */
+    "飫\0"  /* 饫 */
+    "飭\0"  /* 饬 */
+    "飯\0"  /* 饭 */
+    "飯後鐘\0"  /* 饭后钟 */
+    "飯糰\0"  /* 饭团 */
+    "飯莊\0"  /* 饭庄 */
+    "飲\0"  /* 饮 */
+    "餞\0"  /* 饯 */
+    "飾\0"  /* 饰 */
+    "飽\0"  /* 饱 */
+    "飼\0"  /* 饲 */
+    "飼餵\0"  /* 饲喂 */
+    "飴\0"  /* 饴 */
+    "餌\0"  /* 饵 */
+    "饒\0"  /* 饶 */
+    "餉\0"  /* 饷 */
+    "餃\0"  /* 饺 */
+    "餅\0"  /* 饼 */
+    "餅乾\0"  /* 饼干 */
+    "餑\0"  /* 饽 */
+    "餓\0"  /* 饿 */
+    "餘\0"  /* 馀 */
+    "餒\0"  /* 馁 */
+    "餛\0"  /* 馄 */
+    "餛飩麵\0"  /* 馄饨面 */
+    "餡\0"  /* 馅 */
+    "館\0"  /* 馆 */
+    "館穀\0"  /* 馆谷 */
+    "館裡\0"  /* 馆里 */
+    "饋\0"  /* 馈 */
+    "餿\0"  /* 馊 */
+    "饞\0"  /* 馋 */
+    "饃\0"  /* 馍 */
+    "餾\0"  /* 馏 */
+    "饈\0"  /* 馐 */
+    "饉\0"  /* 馑 */
+    "饅\0"  /* 馒 */
+    "饌\0"  /* 馔 */
+    "首隻\0"  /* 首只 */
+    "首當其衝\0"  /* 首当其冲 */
+    "香乾\0"  /* 香干 */
+    "馬\0"  /* 马 */
+    "馬乾\0"  /* 马干 */
+    "馬杆\0"  /* 马杆 */
+    "馬錶\0"  /* 马表 */
+    "馭\0"  /* 驭 */
+    "馱\0"  /* 驮 */
+    "馴\0"  /* 驯 */
+    "馳\0"  /* 驰 */
+    "驅\0"  /* 驱 */
+    "駁\0"  /* 驳 */
+    "驢\0"  /* 驴 */
+    "駔\0"  /* 驵 */
+    "駛\0"  /* 驶 */
+    "駟\0"  /* 驷 */
+    "駙\0"  /* 驸 */
+    "駒\0"  /* 驹 */
+    "騶\0"  /* 驺 */
+    "駐\0"  /* 驻 */
+    "駐紮\0"  /* 驻扎 */
+    "駝\0"  /* 驼 */
+    "駑\0"  /* 驽 */
+    "駕\0"  /* 驾 */
+    "驛\0"  /* 驿 */
+    "駘\0"  /* 骀 */
+    "駘蕩\0"  /* 骀荡 */
+    "驍\0"  /* 骁 */
+    "罵\0"  /* 骂 */
+    "罵著\0"  /* 骂着 */
+    "驕\0"  /* 骄 */
+    "驊\0"  /* 骅 */
+    "駱\0"  /* 骆 */
+    "駭\0"  /* 骇 */
+    "駢\0"  /* 骈 */
+    "驪\0"  /* 骊 */
+    "騁\0"  /* 骋 */
+    "驗\0"  /* 验 */
+    "駿\0"  /* 骏 */
+    "騏\0"  /* 骐 */
+    "騎\0"  /* 骑 */
+    "騍\0"  /* 骒 */
+    "騅\0"  /* 骓 */
+    "驂\0"  /* 骖 */
+    "騙\0"  /* 骗 */
+    "騭\0"  /* 骘 */
+    "騷\0"  /* 骚 */
+    "騖\0"  /* 骛 */
+    "驁\0"  /* 骜 */
+    "騮\0"  /* 骝 */
+    "騫\0"  /* 骞 */
+    "騸\0"  /* 骟 */
+    "驃\0"  /* 骠 */
+    "騾\0"  /* 骡 */
+    "驄\0"  /* 骢 */
+    "驏\0"  /* 骣 */
+    "驟\0"  /* 骤 */
+    "驥\0"  /* 骥 */
+    "驤\0"  /* 骧 */
+    "骨罈\0"  /* 骨坛 */
+    "骨子裡\0"  /* 骨子里 */
+    "骨幹\0"  /* 骨干 */
+    "骨灰罈\0"  /* 骨灰坛 */
+    "髏\0"  /* 髅 */
+    "髖\0"  /* 髋 */
+    "髕\0"  /* 髌 */
+    "高几\0"  /* 高几 */
+    "高幹\0"  /* 高干 */
+    "高清愿\0"  /* 高清愿 */
+    "髡髮\0"  /* 髡发 */
+    "髭鬍\0"  /* 髭胡 */
+    "髭鬚\0"  /* 髭须 */
+    "髯鬍\0"  /* 髯胡 */
+    "髼鬆\0"  /* 髼松 */
+    "鬅鬆\0"  /* 鬅松 */
+    "鬈髮\0"  /* 鬈发 */
+    "鬒髮\0"  /* 鬒发 */
+    "鬢\0"  /* 鬓 */
+    "鬢髮\0"  /* 鬓发 */
+    "魂牽夢繫\0"  /* 魂牵梦系 */
+    "魘\0"  /* 魇 */
+    "魎\0"  /* 魉 */
+    "魏徵\0"  /* 魏征 */
+    "魔杰座\0"  /* 魔杰座 */
+    "魔錶\0"  /* 魔表 */
+    "魚\0"  /* 鱼 */
+    "魚乾\0"  /* 鱼干 */
+    "魚鬆\0"  /* 鱼松 */
+    "魷\0"  /* 鱿 */
+    "魯\0"  /* 鲁 */
+    "魴\0"  /* 鲂 */
+    "鮃\0"  /* 鲆 */
+    "鯰\0"  /* 鲇 */
+    "鱸\0"  /* 鲈 */
+    "鮒\0"  /* 鲋 */
+    "鮑\0"  /* 鲍 */
+    "鱟\0"  /* 鲎 */
+    "鮐\0"  /* 鲐 */
+    "鮭\0"  /* 鲑 */
+    "鮚\0"  /* 鲒 */
+    "鮪\0"  /* 鲔 */
+    "鮞\0"  /* 鲕 */
+    "鱭\0"  /* 鲚 */
+    "鮫\0"  /* 鲛 */
+    "鮮\0"  /* 鲜 */
+    "鯗\0"  /* 鲞 */
+    "鱘\0"  /* 鲟 */
+    "鯁\0"  /* 鲠 */
+    "鱺\0"  /* 鲡 */
+    "鰱\0"  /* 鲢 */
+    "鰹\0"  /* 鲣 */
+    "鯉\0"  /* 鲤 */
+    "鰣\0"  /* 鲥 */
+    "鰷\0"  /* 鲦 */
+    "鯀\0"  /* 鲧 */
+    "鯊\0"  /* 鲨 */
+    "鯇\0"  /* 鲩 */
+    "鯽\0"  /* 鲫 */
+    "鯖\0"  /* 鲭 */
+    "鯪\0"  /* 鲮 */
+    "鯫\0"  /* 鲰 */
+    "鯡\0"  /* 鲱 */
+    "鯤\0"  /* 鲲 */
+    "鯧\0"  /* 鲳 */
+    "鯢\0"  /* 鲵 */
+    "鯰\0"  /* 鲶 */
+    "鯛\0"  /* 鲷 */
+    "鯨\0"  /* 鲸 */
+    "鯨鬚\0"  /* 鲸须 */
+    "鯔\0"  /* 鲻 */
+    "鰈\0"  /* 鲽 */
+    "鰓\0"  /* 鳃 */
+    "鱷\0"  /* 鳄 */
+    "鰍\0"  /* 鳅 */
+    "鰒\0"  /* 鳆 */
+    "鰉\0"  /* 鳇 */
+    "鰲\0"  /* 鳌 */
+    "鰭\0"  /* 鳍 */
+    "鰨\0"  /* 鳎 */
+    "鰥\0"  /* 鳏 */
+    "鰩\0"  /* 鳐 */
+    "鰳\0"  /* 鳓 */
+    "鰾\0"  /* 鳔 */
+    "鱈\0"  /* 鳕 */
+    "鱉\0"  /* 鳖 */
+    "鰻\0"  /* 鳗 */
+    "鱖\0"  /* 鳜 */
+    "鱔\0"  /* 鳝 */
+    "鱗\0"  /* 鳞 */
+    "鱒\0"  /* 鳟 */
+    "鱧\0"  /* 鳢 */
+    "鳥\0"  /* 鸟 */
+    "鳩\0"  /* 鸠 */
+    "鳩佔鵲巢\0"  /* 鸠占鹊巢 */
+    "雞\0"  /* 鸡 */
+    "雞絲麵\0"  /* 鸡丝面 */
+    "雞爭鵝鬥\0"  /* 鸡争鹅斗 */
+    "雞隻\0"  /* 鸡只 */
+    "雞吵鵝鬥\0"  /* 鸡吵鹅斗 */
+    "雞姦\0"  /* 鸡奸 */
+    "雞腿麵\0"  /* 鸡腿面 */
+    "雞蛋裡挑骨頭\0"  /* 鸡蛋里挑骨头 */
+    "鳶\0"  /* 鸢 */
+    "鳴\0"  /* 鸣 */
+    "鳴鐘\0"  /* 鸣钟 */
+    "鷗\0"  /* 鸥 */
+    "鴉\0"  /* 鸦 */
+    "鴇\0"  /* 鸨 */
+    "鴆\0"  /* 鸩 */
+    "鴣\0"  /* 鸪 */
+    "鶇\0"  /* 鸫 */
+    "鸕\0"  /* 鸬 */
+    "鴨\0"  /* 鸭 */
+    "鴦\0"  /* 鸯 */
+    "鴟\0"  /* 鸱 */
+    "鴝\0"  /* 鸲 */
+    "鴛\0"  /* 鸳 */
+    "鴕\0"  /* 鸵 */
+    "鷥\0"  /* 鸶 */
+    "鷙\0"  /* 鸷 */
+    "鴯\0"  /* 鸸 */
+    "鴰\0"  /* 鸹 */
+    "鵂\0"  /* 鸺 */
+    "鴿\0"  /* 鸽 */
+    "鸞\0"  /* 鸾 */
+    "鴻\0"  /* 鸿 */
+    "鴻案相莊\0"  /* 鸿案相庄 */
+    "鴻篇巨製\0"  /* 鸿篇巨制 */
+    "鴻範\0"  /* 鸿范 */
+    "鵓\0"  /* 鹁 */
+    "鸝\0"  /* 鹂 */
+    "鵑\0"  /* 鹃 */
+    "鵠\0"  /* 鹄 */
+    "鵠髮\0"  /* 鹄发 */
+    "鵝\0"  /* 鹅 */
+    "鵝準\0"  /* 鹅准 */
+    "鵒\0"  /* 鹆 */
+    "鷳\0"  /* 鹇 */
+    "鵜\0"  /* 鹈 */
+    "鵡\0"  /* 鹉 */
+    "鵲\0"  /* 鹊 */
+    "鵪\0"  /* 鹌 */
+    "鵯\0"  /* 鹎 */
+    "鵬\0"  /* 鹏 */
+    "鶉\0"  /* 鹑 */
+    "鶘\0"  /* 鹕 */
+    "鶚\0"  /* 鹗 */
+    "鶻\0"  /* 鹘 */
+    "鶿\0"  /* 鹚 */
+    "鶩\0"  /* 鹜 */
+    "鷂\0"  /* 鹞 */
+    "鶼\0"  /* 鹣 */
+    "鶴\0"  /* 鹤 */
+    "鶴髮\0"  /* 鹤发 */
+    "鶴弔\0"  /* 鹤吊 */
+    "鸚\0"  /* 鹦 */
+    "鷓\0"  /* 鹧 */
+    "鷚\0"  /* 鹨 */
+    "鷯\0"  /* 鹩 */
+    "鷦\0"  /* 鹪 */
+    "鷲\0"  /* 鹫 */
+    "鷸\0"  /* 鹬 */
+    "鷺\0"  /* 鹭 */
+    "鷹\0"  /* 鹰 */
+    "鹰鵰\0"  /* 鹰雕 */
+    "鸛\0"  /* 鹳 */
+    "鹺\0"  /* 鹾 */
+    "麥\0"  /* 麦 */
+    "麩\0"  /* 麸 */
+    "麻藥\0"  /* 麻药 */
+    "麻醬麵\0"  /* 麻酱面 */
+    "麻醉藥\0"  /* 麻醉药 */
+    "黃詩杰\0"  /* 黃詩杰 */
+    "黃鈺筑\0"  /* 黃鈺筑 */
+    "黃\0"  /* 黄 */
+    "黃曆\0"  /* 黄历 */
+    "黃髮\0"  /* 黄发 */
+    "黃乾黑瘦\0"  /* 黄干黑瘦 */
+    "黃麴毒素\0"  /* 黄曲毒素 */
+    "黃詩杰\0"  /* 黄诗杰 */
+    "黃鐘\0"  /* 黄钟 */
+    "黃鈺筑\0"  /* 黄钰筑 */
+    "黌\0"  /* 黉 */
+    "黑髮\0"  /* 黑发 */
+    "黑色長髮\0"  /* 黑色长发 */
+    "黷\0"  /* 黩 */
+    "黲\0"  /* 黪 */
+    "黽\0"  /* 黾 */
+    "黿\0"  /* 鼋 */
+    "鼉\0"  /* 鼍 */
+    "鼓裡\0"  /* 鼓里 */
+    "鞀\0"  /* 鼗 */
+    "鼠麴草\0"  /* 鼠曲草 */
+    "鼠藥\0"  /* 鼠药 */
+    "鼴\0"  /* 鼹 */
+    "鼻準\0"  /* 鼻准 */
+    "鼻樑\0"  /* 鼻梁 */
+    "齇\0"  /* 齄 */
+    "齊\0"  /* 齐 */
+    "齊莊\0"  /* 齐庄 */
+    "齊王捨牛\0"  /* 齐王舍牛 */
+    "齏\0"  /* 齑 */
+    "齒\0"  /* 齿 */
+    "齒危髮秀\0"  /* 齿危发秀 */
+    "齒髮\0"  /* 齿发 */
+    "齔\0"  /* 龀 */
+    "齟\0"  /* 龃 */
+    "齡\0"  /* 龄 */
+    "齙\0"  /* 龅 */
+    "齠\0"  /* 龆 */
+    "齜\0"  /* 龇 */
+    "齦\0"  /* 龈 */
+    "齬\0"  /* 龉 */
+    "齪\0"  /* 龊 */
+    "齲\0"  /* 龋 */
+    "齷\0"  /* 龌 */
+    "龍\0"  /* 龙 */
+    "龍捲\0"  /* 龙卷 */
+    "龍鬥虎傷\0"  /* 龙斗虎伤 */
+    "龍鬚\0"  /* 龙须 */
+    "龔\0"  /* 龚 */
+    "龕\0"  /* 龛 */
+    "龜\0"  /* 龟 */
+    ;
+
+static const SimpTradTrieNode simp_to_trad_trie[] = {
+    { 0, 0 }, { 1, 0 }, { -1058, 581 }, { -1664, 615 },
+    { -1668, 616 }, { -1835, 164 }, { -3747, 598 }, { -3980, 622 },
+    { -3984, 624 }, { -4002, 633 }, { -4006, 636 }, { -4076, 625 },
+    { -4301, 639 }, { -4389, 675 }, { -4536, 684 }, { -4618, 688 },
+    { -4622, 691 }, { -4626, 692 }, { -4670, 698 }, { -4674, 699 },
+    { -4678, 700 }, { -4693, 704 }, { -5593, 732 }, { -5648, 731 },
+    { -5652, 734 }, { -5667, 737 }, { -5671, 738 }, { -5675, 739 },
+    { -5679, 740 }, { -5683, 741 }, { -5687, 743 }, { -5736, 202 },
+    { -5740, 205 }, { -5744, 207 }, { -5748, 208 }, { -5752, 209 },
+    { -5937, 199 }, { -6001, 772 }, { -6018, 787 }, { -6022, 790 },
+    { -6026, 791 }, { -6030, 647 }, { -6034, 649 }, { -6038, 650 },
+    { -6042, 651 }, { -6145, 195 }, { -6283, 777 }, { -6287, 782 },
+    { -6475, 808 }, { -6551, 817 }, { -6555, 819 }, { -6577, 818 },
+    { -6606, 825 }, { -6610, 829 }, { -6738, 864 }, { -7114, 870 },
+    { -7132, 876 }, { -7450, 886 }, { -7454, 896 }, { -7583, 905 },
+    { -7587, 912 }, { -7640, 916 }, { -7914, 932 }, { -7972, 906 },
+    { -8221, 918 }, { -8274, 925 }, { -8355, 938 }, { -8625, 950 },
+    { -8663, 954 }, { -8667, 956 }, { -8671, 943 }, { -8675, 945 },
+    { -8714, 959 }, { -8718, 960 }, { -8845, 994 }, { -8884, 998 },
+    { -8888, 999 }, { -8910, 1014 }, { -8914, 1015 }, { -8935, 1028 },
+    { -9011, 1002 }, { -9087, 1040 }, { -9098, 1048 }, { -9102, 1060 },
+    { -9264, 1051 }, { -10427, 1088 }, { -10683, 1094 }, { -10698, 1095 },
+    { -10820, 1099 }, { -10824, 1101 }, { -10828, 1102 }, { -10832, 1103 },
+    { -10836, 1111 }, { -10899, 1124 }, { -10903, 1125 }, { -10907, 1128 },
+    { -10922, 1131 }, { -11507, 1135 }, { -11511, 1142 }, { -11928, 1167 },
+    { -11932, 1171 }, { -12708, 1184 }, { -12723, 1188 }, { -12741, 1200 },
+    { -12745, 1205 }, { -12762, 1209 }, { -12766, 1212 }, { -12770, 1217 },
+    { -12960, 1221 }, { -12964, 1223 }, { -12968, 1224 }, { -12972, 1226 },
+    { -12976, 1227 }, { -12991, 1229 }, { -12995, 1230 }, { -12999, 1232 },
+    { -13003, 1233 }, { -13092, 1237 }, { -13106, 1247 }, { -13110, 1249 },
+    { -13114, 1258 }, { -13405, 1280 }, { -13409, 1281 }, { -13413, 1282 },
+    { -13417, 1283 }, { -13421, 1284 }, { -13425, 1286 }, { -13429, 1288 },
+    { -13433, 1291 }, { -13437, 1292 }, { 1, 229 }, { 6060, 420 },
+    { 6618, 459 }, { 6665, 465 }, { 6691, 467 }, { -13441, 1294 },
+    { -13473, 827 }, { 309, 130 }, { 6660, 465 }, { -13477, 832 },
+    { 355, 187 }, { 851, 187 }, { 4682, 305 }, { 1798, 187 },
+    { 1501, 187 }, { 5933, 381 }, { 7923, 527 }, { 4917, 305 },
+    { 942, 187 }, { 3161, 268 }, { 1168, 240 }, { 4184, 290 },
+    { 957, 187 }, { 3167, 268 }, { 6056, 417 }, { 2551, 261 },
+    { 6057, 417 }, { 2937, 268 }, { 2809, 261 }, { 999, 236 },
+    { 2937, 269 }, { 1613, 187 }, { 4404, 289 }, { 377, 187 },
+    { 5, 187 }, { 799, 187 }, { 6059, 418 }, { 4406, 289 },
+    { 1006, 236 }, { 6790, 451 }, { 779, 187 }, { 889, 193 },
+    { 3416, 236 }, { 2786, 262 }, { 3734, 278 }, { 5490, 342 },
+    { 1129, 239 }, { 2387, 257 }, { 5907, 376 }, { 1010, 236 },
+    { 1027, 187 }, { 1038, 187 }, { 6689, 468 }, { 1135, 239 },
+    { 5615, 369 }, { 2500, 259 }, { 425, 230 }, { 3, 230 },
+    { 454, 230 }, { 491, 230 }, { 532, 230 }, { 566, 230 },
+    { 570, 230 }, { 38, 230 }, { 384, 187 }, { 45, 240 },
+    { 895, 193 }, { 6284, 416 }, { 2556, 262 }, { 36, 236 },
+    { 950, 193 }, { 6617, 458 }, { 31, 193 }, { 1507, 236 },
+    { 3457, 277 }, { 32, 193 }, { 6660, 464 }, { 33, 193 },
+    { 34, 193 }, { 35, 193 }, { 2621, 257 }, { 2742, 259 },
+    { 1906, 193 }, { 1417, 193 }, { 973, 193 }, { 2627, 257 },
+    { 2652, 257 }, { 2683, 257 }, { 5615, 369 }, { 2751, 259 },
+    { 6700, 471 }, { 5619, 370 }, { 3699, 277 }, { 3719, 277 },
+    { 3725, 277 }, { 6706, 472 }, { 2468, 257 }, { 2704, 257 },
+    { 5620, 370 }, { 1, 1 }, { 1, 1 }, { 107, 1 },
+    { 171, 1 }, { 234, 1 }, { 298, 1 }, { 362, 1 },
+    { 12, 231 }, { 599, 231 }, { 481, 231 }, { 1, 231 },
+    { 3, 231 }, { 631, 231 }, { 688, 231 }, { 740, 231 },
+    { 764, 231 }, { 814, 231 }, { 836, 231 }, { 615, 231 },
+    { 873, 231 }, { 907, 231 }, { 961, 231 }, { 981, 231 },
+    { 1036, 231 }, { 1076, 231 }, { 1093, 231 }, { 1134, 231 },
+    { 671, 231 }, { 42, 231 }, { 925, 231 }, { 39, 231 },
+    { 632, 231 }, { 1, 231 }, { 9, 231 }, { 1137, 231 },
+    { 503, 231 }, { 1177, 231 }, { 1210, 231 }, { 703, 231 },
+    { 3, 231 }, { 1, 231 }, { 354, 231 }, { 705, 231 },
+    { 1228, 231 }, { 1261, 231 }, { 852, 231 }, { 674, 231 },
+    { 831, 231 }, { 41, 231 }, { 3, 231 }, { 396, 231 },
+    { 424, 231 }, { 622, 231 }, { 1300, 231 }, { 1341, 231 },
+    { 1401, 231 }, { 1379, 231 }, { 1421, 231 }, { 1027, 231 },
+    { 427, 231 }, { 9, 231 }, { 4, 231 }, { 1426, 231 },
+    { 1484, 231 }, { 1059, 231 }, { 1522, 231 }, { 460, 231 },
+    { 1554, 231 }, { 1456, 231 }, { 1572, 231 }, { 1352, 231 },
+    { 1614, 232 }, { 1628, 232 }, { 1591, 232 }, { 1653, 232 },
+    { 1202, 232 }, { 1, 232 }, { 6893, 477 }, { 701, 232 },
+    { 1695, 232 }, { 1721, 232 }, { 1762, 232 }, { 1801, 232 },
+    { 1841, 232 }, { 1874, 232 }, { 1878, 232 }, { 1258, 232 },
+    { 1939, 232 }, { 1887, 232 }, { 1510, 232 }, { 552, 232 },
+    { 843, 232 }, { 1930, 232 }, { 1970, 232 }, { 1987, 232 },
+    { 1730, 232 }, { 2026, 232 }, { 756, 232 }, { 800, 232 },
+    { 2042, 232 }, { 2090, 232 }, { 2128, 232 }, { 1245, 232 },
+    { 2169, 232 }, { 2107, 232 }, { 1083, 232 }, { 1958, 232 },
+    { 2022, 232 }, { 493, 232 }, { 612, 232 }, { 496, 232 },
+    { 871, 232 }, { 711, 232 }, { 5, 232 }, { 7463, 500 },
+    { 975, 232 }, { 1185, 232 }, { 2186, 232 }, { 2212, 232 },
+    { 2061, 232 }, { 1401, 232 }, { 2235, 232 }, { 2248, 232 },
+    { 2056, 232 }, { 2310, 232 }, { 2331, 232 }, { 2342, 232 },
+    { 2384, 232 }, { 780, 232 }, { 841, 232 }, { 2396, 232 },
+    { 1013, 232 }, { 2432, 232 }, { 399, 232 }, { 440, 232 },
+    { 2399, 233 }, { 2457, 233 }, { 2466, 233 }, { 923, 233 },
+    { 527, 233 }, { 45, 233 }, { 78, 233 }, { 920, 233 },
+    { 2474, 233 }, { 612, 233 }, { 2492, 233 }, { 2530, 233 },
+    { 4, 233 }, { 1293, 233 }, { 1074, 233 }, { 1656, 233 },
+    { 347, 233 }, { 2, 233 }, { 690, 233 }, { 2539, 233 },
+    { 749, 233 }, { 2568, 233 }, { 2598, 233 }, { 2604, 233 },
+    { 1126, 233 }, { 1575, 233 }, { 2627, 233 }, { 755, 233 },
+    { 1125, 233 }, { 1332, 233 }, { 2627, 233 }, { 2200, 233 },
+    { 1488, 233 }, { 1153, 233 }, { 1007, 233 }, { 876, 233 },
+    { 2629, 233 }, { 1664, 233 }, { 2691, 233 }, { 1910, 233 },
+    { 1291, 233 }, { 2683, 233 }, { 1200, 233 }, { 1797, 233 },
+    { 2189, 233 }, { 2693, 233 }, { 972, 233 }, { 870, 233 },
+    { 1230, 233 }, { 2714, 233 }, { 1827, 233 }, { 1038, 233 },
+    { 13, 233 }, { 8, 233 }, { 8, 233 }, { 7469, 501 },
+    { 1, 233 }, { 2730, 233 }, { 2794, 233 }, { 2858, 233 },
+    { 1707, 233 }, { 1405, 233 }, { 1124, 233 }, { 2911, 234 },
+    { 2914, 234 }, { 2928, 234 }, { 2972, 234 }, { 2993, 234 },
+    { 2937, 234 }, { 484, 234 }, { 1253, 234 }, { 3016, 234 },
+    { 2290, 234 }, { 2522, 234 }, { 3055, 234 }, { 3075, 234 },
+    { 3100, 234 }, { 3116, 234 }, { 409, 234 }, { 3047, 234 },
+    { 543, 234 }, { 1357, 234 }, { 2524, 234 }, { 1394, 234 },
+    { 398, 234 }, { 1016, 234 }, { 470, 234 }, { 18, 234 },
+    { 3135, 234 }, { 2334, 234 }, { 3173, 234 }, { 2382, 234 },
+    { 2921, 234 }, { 7470, 503 }, { 13, 234 }, { 2, 234 },
+    { 3164, 234 }, { 2413, 234 }, { 2027, 234 }, { 597, 234 },
+    { 14, 234 }, { 3, 234 }, { 3225, 234 }, { 5, 234 },
+    { 12, 234 }, { 348, 234 }, { 7473, 505 }, { 36, 234 },
+    { 58, 234 }, { 3240, 234 }, { 3304, 234 }, { 3368, 234 },
+    { 571, 234 }, { 122, 234 }, { 678, 234 }, { 3395, 234 },
+    { 3459, 234 }, { 1513, 234 }, { 3493, 234 }, { 1909, 234 },
+    { 1376, 234 }, { 1478, 234 }, { 6925, 469 }, { 6926, 469 },
+    { 3515, 234 }, { 3578, 234 }, { 3621, 234 }, { 3655, 235 },
+    { 2217, 235 }, { 3660, 235 }, { 3706, 235 }, { 650, 235 },
+    { 3711, 235 }, { 519, 235 }, { 2932, 235 }, { -616, 568 },
+    { 162, 235 }, { 244, 235 }, { 2947, 270 }, { 266, 235 },
+    { 8195, 576 }, { 296, 235 }, { 5700, 380 }, { 6696, 469 },
+    { 3179, 270 }, { 3769, 235 }, { 3833, 235 }, { 3897, 235 },
+    { 3960, 235 }, { 2953, 270 }, { 3979, 235 }, { 4042, 235 },
+    { 3494, 235 }, { 1583, 235 }, { 3705, 235 }, { 3106, 235 },
+    { 1530, 235 }, { 2990, 235 }, { 3206, 235 }, { 2959, 270 },
+    { 4021, 235 }, { 4106, 235 }, { 3507, 235 }, { 4, 235 },
+    { 4109, 235 }, { 4173, 235 }, { 5931, 380 }, { 5932, 380 },
+    { 4155, 235 }, { 4219, 235 }, { 4252, 235 }, { 1662, 235 },
+    { 2152, 235 }, { 3505, 279 }, { 8087, 137 }, { 8134, 137 },
+    { 641, 235 }, { 4287, 235 }, { 4346, 235 }, { 3736, 279 },
+    { 8276, 610 }, { 3765, 279 }, { 5538, 362 }, { 4350, 235 },
+    { 4413, 235 }, { 902, 235 }, { 2620, 235 }, { 4427, 235 },
+    { 1262, 235 }, { 4462, 235 }, { 1671, 186 }, { -1047, 580 },
+    { 5772, 362 }, { 876, 186 }, { 4389, 288 }, { 4390, 288 },
+    { -1223, 593 }, { 2645, 186 }, { 3541, 280 }, { 1749, 186 },
+    { 1400, 186 }, { 1625, 186 }, { 6497, 442 }, { 2094, 186 },
+    { 499, 186 }, { 5542, 363 }, { 6498, 442 }, { 2817, 186 },
+    { 8277, 611 }, { 1261, 186 }, { 3771, 279 }, { 3543, 280 },
+    { 272, 186 }, { 6776, 448 }, { 4161, 288 }, { 6777, 448 },
+    { 555, 186 }, { 2, 186 }, { 718, 186 }, { 1381, 186 },
+    { 8249, 140 }, { 5543, 362 }, { 5777, 363 }, { 5778, 363 },
+    { 665, 186 }, { 1974, 188 }, { 2997, 186 }, { 757, 186 },
+    { 2418, 188 }, { 560, 186 }, { 425, 188 }, { 1074, 188 },
+    { 1779, 186 }, { 3986, 188 }, { 6, 188 }, { 2370, 186 },
+    { 3017, 188 }, { 4403, 288 }, { 3165, 186 }, { 2183, 188 },
+    { 625, 188 }, { 3547, 280 }, { 673, 186 }, { 8327, 163 },
+    { 3782, 280 }, { 839, 188 }, { 311, 186 }, { 339, 186 },
+    { 677, 186 }, { 968, 186 }, { 6556, 450 }, { 3, 186 },
+    { 4, 186 }, { 8294, 194 }, { 6784, 450 }, { 494, 188 },
+    { 784, 189 }, { 740, 188 }, { 7, 188 }, { 4497, 295 },
+    { 8, 188 }, { 11, 189 }, { 3111, 189 }, { 1894, 189 },
+    { 6366, 433 }, { 530, 188 }, { 6600, 433 }, { 4729, 295 },
+    { 5217, 337 }, { 9, 188 }, { 892, 189 }, { 6558, 450 },
+    { 10, 188 }, { 1183, 189 }, { 2817, 264 }, { 12, 189 },
+    { 3052, 264 }, { 2033, 188 }, { 770, 189 }, { 4500, 295 },
+    { 435, 189 }, { 1123, 189 }, { 1368, 188 }, { 41, 238 },
+    { 5225, 337 }, { 42, 238 }, { 43, 238 }, { 44, 238 },
+    { 5469, 339 }, { 6370, 433 }, { 1071, 238 }, { 7214, 497 },
+    { 5470, 339 }, { 5471, 339 }, { 8290, 594 }, { 7216, 497 },
+    { 1144, 238 }, { 1084, 238 }, { 1256, 189 }, { 2594, 264 },
+    { 1117, 189 }, { -1134, 588 }, { 8446, 644 }, { 2839, 264 },
+    { 484, 189 }, { 1086, 238 }, { 5608, 368 }, { 1938, 190 },
+    { 2597, 264 }, { -1588, 606 }, { 558, 189 }, { 13, 189 },
+    { 643, 190 }, { -1619, 612 }, { 683, 190 }, { 599, 189 },
+    { 2624, 264 }, { 4928, 319 }, { 5459, 337 }, { 1215, 189 },
+    { 14, 190 }, { 1225, 190 }, { 1712, 190 }, { 1521, 190 },
+    { 15, 190 }, { 2836, 264 }, { 2848, 264 }, { 16, 190 },
+    { 17, 190 }, { 1078, 190 }, { 4934, 319 }, { 5613, 368 },
+    { 5614, 368 }, { 1155, 190 }, { 18, 190 }, { 19, 190 },
+    { 20, 190 }, { 700, 191 }, { 5611, 368 }, { 1325, 190 },
+    { 21, 190 }, { 6509, 444 }, { 6891, 476 }, { 6509, 444 },
+    { 705, 191 }, { 710, 191 }, { 731, 191 }, { 5165, 319 },
+    { 857, 192 }, { 690, 190 }, { 1544, 191 }, { 4936, 319 },
+    { 747, 191 }, { 8453, 668 }, { -1062, 582 }, { 4937, 319 },
+    { 3511, 191 }, { 6743, 444 }, { 820, 191 }, { 806, 191 },
+    { 8370, 619 }, { 8390, 619 }, { 870, 192 }, { 1359, 191 },
+    { 910, 192 }, { 8193, 568 }, { 2348, 191 }, { 23, 192 },
+    { 22, 191 }, { 6892, 476 }, { 24, 192 }, { 1483, 237 },
+    { 1473, 192 }, { 25, 192 }, { 26, 192 }, { 27, 192 },
+    { 28, 192 }, { 29, 192 }, { 1016, 237 }, { 30, 192 },
+    { 6650, 463 }, { 5463, 338 }, { 808, 191 }, { 1692, 247 },
+    { 5464, 338 }, { 5466, 338 }, { 5467, 338 }, { 5872, 373 },
+    { 878, 192 }, { 6886, 463 }, { 1049, 237 }, { 1962, 247 },
+    { 1059, 237 }, { -1209, 591 }, { 815, 191 }, { 8352, 629 },
+    { 1191, 241 }, { 2524, 260 }, { 880, 192 }, { 1210, 241 },
+    { 8391, 629 }, { 1226, 241 }, { 1234, 241 }, { 3554, 281 },
+    { 1390, 241 }, { 1252, 241 }, { 2535, 260 }, { 1700, 241 },
+    { 37, 237 }, { 1275, 241 }, { 3554, 281 }, { 3561, 281 },
+    { 3796, 281 }, { 46, 241 }, { 6887, 463 }, { -1850, 170 },
+    { 1999, 247 }, { 5238, 338 }, { 47, 241 }, { 1063, 237 },
+    { 8142, 580 }, { 2777, 260 }, { 2919, 241 }, { 38, 237 },
+    { 7188, 495 }, { 3806, 281 }, { 39, 237 }, { 40, 237 },
+    { 8452, 674 }, { 3798, 281 }, { 8231, 593 }, { 5874, 373 },
+    { 5875, 373 }, { 2781, 260 }, { 5876, 373 }, { -1839, 165 },
+    { 1285, 241 }, { 2350, 256 }, { 1718, 247 }, { 2530, 241 },
+    { 1554, 241 }, { 2613, 241 }, { 1865, 247 }, { 2353, 256 },
+    { 48, 241 }, { 1312, 241 }, { 2869, 260 }, { 1911, 241 },
+    { 1627, 241 }, { 2548, 260 }, { 1320, 241 }, { 6894, 478 },
+    { 1323, 241 }, { 49, 241 }, { 51, 242 }, { 50, 241 },
+    { 1331, 241 }, { 1564, 241 }, { 1729, 242 }, { 3187, 275 },
+    { 7190, 495 }, { 52, 242 }, { 3428, 275 }, { 136, 256 },
+    { 8412, 679 }, { 53, 242 }, { 8066, 540 }, { 4488, 275 },
+    { 139, 256 }, { 8068, 540 }, { 2584, 256 }, { 2875, 267 },
+    { 2605, 256 }, { 5934, 382 }, { 4687, 307 }, { -3919, 609 },
+    { 1356, 242 }, { 6895, 478 }, { 1726, 242 }, { 2867, 267 },
+    { 1739, 242 }, { 2319, 242 }, { 2872, 267 }, { 4919, 307 },
+    { 4920, 307 }, { 2378, 256 }, { 4921, 307 }, { -1685, 141 },
+    { 2889, 267 }, { 1371, 242 }, { 1376, 242 }, { 8320, 604 },
+    { 3124, 267 }, { 3133, 267 }, { 3145, 267 }, { 8372, 604 },
+    { 3475, 275 }, { 1589, 242 }, { 2521, 256 }, { 6897, 478 },
+    { 54, 242 }, { 5705, 382 }, { 5936, 382 }, { 4178, 242 },
+    { 1664, 242 }, { 1872, 243 }, { 55, 242 }, { 1405, 242 },
+    { 1426, 242 }, { 8482, 676 }, { 5707, 382 }, { 3530, 243 },
+    { 56, 242 }, { 5479, 341 }, { 1807, 243 }, { 3146, 267 },
+    { 3834, 271 }, { 1433, 243 }, { 3200, 271 }, { 5958, 384 },
+    { 1762, 243 }, { 3638, 271 }, { 57, 243 }, { 5267, 326 },
+    { 3658, 271 }, { 5480, 341 }, { 2929, 267 }, { 2969, 271 },
+    { -4260, 634 }, { 4689, 307 }, { 8165, 588 }, { 5812, 391 },
+    { 58, 243 }, { 5488, 341 }, { 1456, 243 }, { 1602, 244 },
+    { 5489, 341 }, { 3633, 243 }, { 5038, 326 }, { 5725, 384 },
+    { 8226, 606 }, { 59, 243 }, { 63, 244 }, { 8293, 612 },
+    { 5039, 326 }, { 8273, 612 }, { 1503, 244 }, { 4394, 244 },
+    { 60, 243 }, { 8444, 678 }, { 1885, 243 }, { 5819, 391 },
+    { 61, 243 }, { 2279, 244 }, { 64, 244 }, { 1920, 244 },
+    { 1781, 244 }, { 8469, 713 }, { 6040, 391 }, { 2652, 243 },
+    { 5271, 326 }, { 65, 244 }, { 1468, 243 }, { 3596, 243 },
+    { 1812, 243 }, { 8468, 701 }, { 5959, 384 }, { 5488, 357 },
+    { 62, 243 }, { 5491, 357 }, { 1511, 244 }, { 8520, 708 },
+    { 3088, 244 }, { 5041, 326 }, { 66, 244 }, { 3102, 244 },
+    { 5493, 357 }, { 8477, 709 }, { -1759, 148 }, { 70, 245 },
+    { 5835, 391 }, { 71, 245 }, { 1858, 245 }, { 3997, 244 },
+    { 8231, 582 }, { 8157, 582 }, { 67, 244 }, { 1537, 244 },
+    { 1755, 244 }, { 1764, 245 }, { 68, 244 }, { 5498, 357 },
+    { 69, 244 }, { -1773, 152 }, { 5044, 327 }, { 72, 245 },
+    { 73, 245 }, { 3296, 276 }, { 8523, 710 }, { 1560, 245 },
+    { 3556, 276 }, { 3619, 276 }, { 3640, 276 }, { 3651, 276 },
+    { 3668, 276 }, { 8343, 621 }, { 8348, 621 }, { 5733, 357 },
+    { 5734, 357 }, { 5735, 358 }, { 1654, 246 }, { 5736, 358 },
+    { 5737, 358 }, { 5047, 327 }, { 8507, 716 }, { 5047, 327 },
+    { 1824, 245 }, { 5054, 327 }, { 1875, 245 }, { 3515, 274 },
+    { 1602, 245 }, { 1619, 245 }, { 8184, 591 }, { 3287, 274 },
+    { 3304, 274 }, { 3315, 274 }, { 5168, 320 }, { 5051, 327 },
+    { 2446, 246 }, { 1648, 245 }, { 74, 246 }, { 1916, 246 },
+    { 1653, 246 }, { 1844, 246 }, { 75, 246 }, { 76, 246 },
+    { 8448, 642 }, { 5505, 358 }, { 80, 248 }, { 3099, 274 },
+    { 8436, 642 }, { 1899, 246 }, { 3105, 274 }, { 2024, 248 },
+    { 1680, 246 }, { 3670, 276 }, { 3693, 276 }, { 8289, 170 },
+    { 3672, 276 }, { 8369, 620 }, { 77, 246 }, { 78, 246 },
+    { 2120, 246 }, { 1751, 248 }, { 8408, 620 }, { 4941, 320 },
+    { 5505, 358 }, { 6238, 411 }, { 3357, 274 }, { 3367, 274 },
+    { 3393, 274 }, { 1761, 248 }, { 4936, 320 }, { -1861, 180 },
+    { 79, 246 }, { 4946, 320 }, { 8329, 165 }, { 4947, 320 },
+    { 6007, 411 }, { 5242, 340 }, { 4947, 320 }, { 1800, 248 },
+    { 8573, 723 }, { 2495, 249 }, { -1872, 181 }, { 2887, 249 },
+    { 81, 248 }, { 8550, 746 }, { 5474, 340 }, { 1929, 249 },
+    { 1805, 248 }, { 8548, 758 }, { 1810, 249 }, { 5476, 340 },
+    { 82, 248 }, { 5477, 340 }, { 2382, 249 }, { 84, 249 },
+    { 8478, 722 }, { 5244, 340 }, { 8522, 722 }, { 6007, 411 },
+    { 3649, 258 }, { 2943, 249 }, { 2178, 249 }, { 2952, 249 },
+    { 83, 248 }, { 2506, 248 }, { 1847, 249 }, { 5893, 399 },
+    { 1822, 249 }, { 6127, 399 }, { 1822, 249 }, { 5894, 399 },
+    { 4167, 249 }, { 8234, 549 }, { 2193, 249 }, { 8323, 609 },
+    { 4402, 249 }, { 5836, 367 }, { 5837, 367 }, { 1829, 249 },
+    { 5838, 367 }, { 5609, 367 }, { -4630, 693 }, { 2363, 249 },
+    { 8248, 141 }, { 8296, 141 }, { 2475, 258 }, { 2477, 258 },
+    { 2002, 249 }, { 5607, 367 }, { 8503, 712 }, { 8236, 549 },
+    { 85, 249 }, { 1837, 249 }, { 8006, 549 }, { 4376, 249 },
+    { 2188, 250 }, { 2485, 258 }, { 86, 249 }, { 87, 250 },
+    { 4413, 250 }, { 5622, 371 }, { 5854, 371 }, { 88, 250 },
+    { 8558, 726 }, { 89, 250 }, { 90, 250 }, { 91, 250 },
+    { 5855, 371 }, { 8099, 557 }, { 8147, 557 }, { 8161, 557 },
+    { 8565, 752 }, { 2834, 258 }, { 5623, 371 }, { 92, 250 },
+    { 2209, 251 }, { 8573, 762 }, { 2272, 250 }, { 2722, 258 },
+    { 2731, 258 }, { -4361, 664 }, { 6234, 410 }, { 8574, 171 },
+    { 6235, 410 }, { 2009, 250 }, { 3637, 251 }, { 2087, 251 },
+    { 93, 250 }, { 94, 250 }, { 8442, 634 }, { 4419, 251 },
+    { 95, 250 }, { 8570, 196 }, { 2295, 250 }, { 96, 250 },
+    { 1886, 251 }, { 1903, 251 }, { 2425, 251 }, { 97, 251 },
+    { 2357, 250 }, { 5891, 398 }, { 5491, 344 }, { 8505, 728 },
+    { 5493, 344 }, { 8563, 728 }, { 98, 251 }, { 5494, 344 },
+    { 5523, 360 }, { 2106, 251 }, { 3586, 251 }, { 6236, 410 },
+    { 1983, 251 }, { 6548, 449 }, { 6237, 410 }, { 2003, 251 },
+    { 4407, 251 }, { 2390, 250 }, { 5266, 344 }, { -4653, 697 },
+    { 2014, 251 }, { 2147, 251 }, { 2287, 251 }, { 2048, 251 },
+    { 4300, 287 }, { 5527, 360 }, { 5266, 344 }, { 5529, 360 },
+    { 4425, 251 }, { 2448, 251 }, { 2480, 252 }, { 99, 251 },
+    { 4430, 252 }, { 2197, 252 }, { 6549, 449 }, { 100, 251 },
+    { 8298, 148 }, { 3153, 252 }, { 6552, 449 }, { 4436, 252 },
+    { 5893, 398 }, { 2055, 252 }, { 5761, 360 }, { 4445, 252 },
+    { 5888, 398 }, { 8587, 200 }, { 2246, 252 }, { -4290, 637 },
+    { 101, 252 }, { 5531, 360 }, { 2451, 252 }, { 8274, 152 },
+    { 102, 252 }, { 4314, 287 }, { 4611, 293 }, { 6783, 449 },
+    { 4316, 287 }, { 4323, 287 }, { 4325, 287 }, { 2059, 252 },
+    { 2062, 252 }, { 8244, 613 }, { 8247, 613 }, { 6048, 415 },
+    { 103, 252 }, { 6031, 415 }, { 8287, 613 }, { 8608, 214 },
+    { 4096, 287 }, { 104, 252 }, { 6280, 415 }, { 2102, 253 },
+    { 2080, 252 }, { 105, 252 }, { 6051, 415 }, { 4451, 253 },
+    { 106, 252 }, { 5192, 334 }, { 6053, 415 }, { 4132, 287 },
+    { 5684, 378 }, { 107, 252 }, { 4612, 293 }, { 5918, 378 },
+    { 5919, 378 }, { 108, 253 }, { 2163, 252 }, { 109, 253 },
+    { 110, 253 }, { -4540, 685 }, { 111, 253 }, { 112, 253 },
+    { 2385, 253 }, { 113, 253 }, { 114, 253 }, { 8557, 159 },
+    { 115, 253 }, { 116, 253 }, { 2131, 254 }, { 8562, 168 },
+    { 2190, 254 }, { 117, 254 }, { 4530, 293 }, { 4389, 293 },
+    { 4520, 293 }, { 8572, 179 }, { 4614, 293 }, { 2204, 254 },
+    { 4495, 293 }, { 2230, 253 }, { 8584, 742 }, { 118, 254 },
+    { 5686, 378 }, { 119, 254 }, { 5424, 334 }, { 4621, 293 },
+    { 5195, 334 }, { 5921, 378 }, { 5841, 392 }, { 6050, 392 },
+    { -4343, 662 }, { 8328, 180 }, { 120, 254 }, { 5196, 334 },
+    { 5196, 334 }, { -996, 573 }, { 2210, 254 }, { 2307, 255 },
+    { 2266, 255 }, { 2116, 253 }, { 2225, 254 }, { 2463, 255 },
+    { 8325, 181 }, { 2253, 254 }, { 6058, 392 }, { 6060, 392 },
+    { 5429, 334 }, { 2256, 254 }, { 6248, 426 }, { 2564, 263 },
+    { 2531, 255 }, { 6482, 426 }, { 4456, 254 }, { 8590, 754 },
+    { 121, 255 }, { 122, 255 }, { 123, 255 }, { 124, 255 },
+    { 125, 255 }, { 5999, 388 }, { 126, 255 }, { 5841, 392 },
+    { 127, 255 }, { 8641, 756 }, { 6000, 388 }, { 128, 255 },
+    { 129, 255 }, { 3664, 263 }, { 135, 255 }, { 6113, 397 },
+    { 4461, 263 }, { 8595, 783 }, { 6001, 388 }, { 5884, 397 },
+    { 2832, 263 }, { 8602, 654 }, { 6252, 426 }, { 8296, 595 },
+    { 8341, 595 }, { 2307, 255 }, { 8298, 595 }, { 8460, 693 },
+    { 2323, 255 }, { 6116, 397 }, { 6117, 397 }, { 3080, 263 },
+    { 6253, 426 }, { 8602, 661 }, { 3116, 263 }, { 2793, 263 },
+    { 5772, 388 }, { 5778, 388 }, { 2800, 263 }, { 2804, 263 },
+    { 8657, 669 }, { 2980, 265 }, { 2926, 265 }, { 2617, 265 },
+    { 2586, 263 }, { -4682, 703 }, { 5271, 345 }, { 2959, 263 },
+    { 2847, 263 }, { 2856, 265 }, { 5885, 397 }, { 6120, 397 },
+    { 2859, 265 }, { 3656, 265 }, { 2870, 265 }, { 2873, 265 },
+    { 2878, 265 }, { 2880, 265 }, { 2887, 265 }, { 4678, 304 },
+    { 5968, 406 }, { 2865, 266 }, { 2655, 265 }, { 2918, 266 },
+    { 2657, 265 }, { 2945, 266 }, { 4679, 304 }, { 8457, 664 },
+    { 5274, 345 }, { 5272, 345 }, { 2734, 266 }, { 6199, 406 },
+    { 5278, 345 }, { 8441, 645 }, { 5970, 406 }, { 2677, 265 },
+    { 8446, 645 }, { 2972, 266 }, { 8616, 176 }, { 6202, 406 },
+    { 6241, 412 }, { 3208, 272 }, { 4680, 304 }, { 4911, 304 },
+    { 3275, 272 }, { 8628, 183 }, { 5974, 406 }, { 4912, 304 },
+    { -4041, 646 }, { 4914, 304 }, { 4468, 272 }, { 5272, 345 },
+    { 3023, 272 }, { 5276, 345 }, { 5511, 345 }, { 8604, 660 },
+    { 5974, 406 }, { 3912, 266 }, { 8634, 660 }, { 2980, 272 },
+    { 3003, 266 }, { -1103, 583 }, { 3044, 266 }, { 3010, 272 },
+    { 3072, 266 }, { 3058, 272 }, { 5975, 406 }, { 8500, 697 },
+    { 3375, 272 }, { 3077, 266 }, { 5145, 331 }, { 3220, 273 },
+    { 3229, 273 }, { 5146, 331 }, { 4915, 304 }, { 8258, 552 },
+    { 4474, 272 }, { 3406, 273 }, { 3093, 272 }, { 3161, 272 },
+    { 8657, 150 }, { 3449, 273 }, { 5378, 331 }, { 4878, 315 },
+    { 2981, 272 }, { 3001, 273 }, { 5379, 331 }, { 8259, 552 },
+    { 8260, 552 }, { 3747, 272 }, { 6009, 412 }, { 6243, 412 },
+    { 3606, 273 }, { 4483, 272 }, { 3217, 272 }, { 3440, 272 },
+    { 8449, 637 }, { 6373, 434 }, { 6244, 412 }, { 6245, 412 },
+    { 4879, 315 }, { 6370, 434 }, { 8653, 760 }, { 5149, 331 },
+    { 6374, 434 }, { 5148, 331 }, { 5940, 404 }, { 3381, 273 },
+    { 4880, 315 }, { 4881, 315 }, { 3803, 282 }, { 5678, 377 },
+    { 4883, 315 }, { 5680, 377 }, { 6376, 434 }, { 5382, 331 },
+    { 3574, 282 }, { 6173, 404 }, { 3967, 282 }, { 5911, 377 },
+    { 8676, 763 }, { 3005, 273 }, { 3034, 273 }, { 5944, 404 },
+    { 8417, 683 }, { 8473, 683 }, { 4330, 273 }, { 3047, 273 },
+    { 5113, 315 }, { 5912, 377 }, { 5114, 315 }, { 3524, 273 },
+    { 3579, 282 }, { 3582, 282 }, { 8262, 552 }, { 3583, 282 },
+    { 8451, 685 }, { 3592, 282 }, { 4139, 282 }, { 3857, 282 },
+    { 8648, 765 }, { 3823, 282 }, { 3831, 282 }, { 8627, 766 },
+    { 3601, 282 }, { 5846, 393 }, { 5848, 393 }, { 3611, 282 },
+    { 5913, 377 }, { 5914, 377 }, { 5915, 377 }, { 3856, 282 },
+    { 3860, 282 }, { -5656, 736 }, { 3656, 283 }, { 6175, 404 },
+    { 3666, 283 }, { 3825, 283 }, { 5947, 404 }, { 6078, 393 },
+    { 5916, 377 }, { 3630, 282 }, { 3671, 283 }, { 4075, 282 },
+    { 4592, 299 }, { 8685, 769 }, { 3642, 282 }, { 4822, 299 },
+    { 3916, 283 }, { 8465, 662 }, { 4270, 282 }, { 3884, 282 },
+    { 8149, 573 }, { 6744, 445 }, { 8139, 573 }, { 6745, 445 },
+    { 4827, 299 }, { 6746, 445 }, { 6747, 445 }, { 3915, 283 },
+    { 5847, 393 }, { -1738, 144 }, { 6080, 393 }, { 4002, 283 },
+    { 4598, 299 }, { 8632, 773 }, { 4599, 299 }, { -5941, 203 },
+    { 3824, 285 }, { 3836, 285 }, { 4092, 285 }, { 6521, 445 },
+    { 5848, 393 }, { 4601, 299 }, { 6518, 445 }, { 8661, 800 },
+    { 3686, 283 }, { 4097, 285 }, { 4100, 285 }, { 4400, 285 },
+    { 4831, 299 }, { -4586, 687 }, { 7236, 484 }, { 7240, 484 },
+    { 4602, 299 }, { 6770, 447 }, { 3692, 283 }, { 4493, 283 },
+    { 3719, 283 }, { 3969, 283 }, { 4029, 283 }, { 3758, 284 },
+    { 5321, 349 }, { 4077, 283 }, { 3748, 284 }, { 6475, 425 },
+    { 4121, 284 }, { 5554, 349 }, { 4103, 285 }, { 5559, 349 },
+    { 3770, 284 }, { 4321, 285 }, { 8720, 809 }, { 4834, 299 },
+    { -4732, 714 }, { 4065, 284 }, { 4110, 285 }, { 3896, 284 },
+    { 6247, 425 }, { 8681, 814 }, { 4190, 284 }, { 4135, 286 },
+    { 4195, 286 }, { 7241, 484 }, { 4021, 284 }, { 3910, 285 },
+    { 8732, 816 }, { 4512, 285 }, { 8511, 703 }, { 4039, 284 },
+    { 4416, 291 }, { 8688, 820 }, { 5322, 349 }, { 5324, 349 },
+    { -6566, 821 }, { 6478, 425 }, { 5561, 349 }, { 6479, 425 },
+    { 7242, 484 }, { 4041, 284 }, { 6251, 425 }, { 4115, 285 },
+    { 4201, 286 }, { 4214, 286 }, { 4246, 286 }, { 4249, 286 },
+    { 4253, 286 }, { 4256, 286 }, { 6772, 447 }, { 4205, 284 },
+    { 6773, 447 }, { 6774, 447 }, { 4050, 284 }, { 6775, 447 },
+    { 4188, 291 }, { 8688, 840 }, { 4502, 284 }, { 5562, 349 },
+    { 4243, 291 }, { 8537, 727 }, { 8534, 727 }, { 4507, 284 },
+    { 4198, 291 }, { 4210, 291 }, { 4228, 291 }, { 4272, 286 },
+    { 4460, 291 }, { 8358, 646 }, { 8410, 646 }, { 4046, 286 },
+    { 8697, 853 }, { 4127, 286 }, { 4463, 291 }, { 4789, 297 },
+    { 4790, 297 }, { 4246, 291 }, { 4791, 297 }, { 4254, 291 },
+    { 7013, 485 }, { 8739, 854 }, { 4251, 291 }, { 8207, 583 },
+    { 8219, 583 }, { 4289, 286 }, { 4486, 292 }, { 4297, 292 },
+    { 4518, 292 }, { 6107, 396 }, { 4492, 292 }, { 4555, 297 },
+    { 8676, 768 }, { 4525, 292 }, { 7249, 485 }, { 4786, 297 },
+    { 8683, 768 }, { 4279, 292 }, { 4562, 297 }, { -6526, 812 },
+    { 4515, 292 }, { 4518, 292 }, { 4558, 297 }, { 8149, 564 },
+    { 8139, 564 }, { 8172, 564 }, { 4566, 297 }, { 7250, 485 },
+    { 8709, 871 }, { 4538, 292 }, { 6108, 396 }, { 6109, 396 },
+    { 6110, 396 }, { 4539, 292 }, { 4323, 292 }, { 5142, 318 },
+    { 4797, 297 }, { 4567, 297 }, { 4913, 318 }, { 6974, 481 },
+    { 8575, 213 }, { 8603, 213 }, { 8609, 213 }, { 4558, 292 },
+    { 4571, 292 }, { 7207, 481 }, { 7251, 485 }, { 4540, 294 },
+    { 5145, 318 }, { 4629, 294 }, { 4343, 292 }, { 4574, 292 },
+    { 8737, 872 }, { 5881, 396 }, { 4576, 292 }, { 6112, 396 },
+    { -7103, 868 }, { 4913, 318 }, { 8763, 881 }, { 4647, 294 },
+    { 4657, 294 }, { 4917, 318 }, { 4658, 294 }, { 4671, 294 },
+    { 4589, 292 }, { 4592, 292 }, { 4438, 294 }, { 4920, 318 },
+    { 4673, 294 }, { 7602, 520 }, { 7830, 520 }, { 4466, 294 },
+    { 4922, 318 }, { 4709, 294 }, { 4710, 294 }, { 4733, 296 },
+    { 7837, 520 }, { 4740, 296 }, { 4755, 296 }, { 4546, 296 },
+    { 8783, 898 }, { 7609, 520 }, { 4477, 294 }, { 7208, 481 },
+    { 5154, 318 }, { 7624, 520 }, { 5156, 318 }, { 5157, 318 },
+    { 7840, 520 }, { 5158, 318 }, { 7210, 481 }, { 8776, 926 },
+    { 4756, 296 }, { 4570, 298 }, { 4576, 298 }, { 8520, 736 },
+    { 4526, 296 }, { 4799, 298 }, { 4488, 294 }, { 4535, 296 },
+    { 5782, 389 }, { 4582, 298 }, { 5783, 389 }, { 5784, 389 },
+    { 4572, 298 }, { 8615, 735 }, { 8626, 735 }, { 4766, 296 },
+    { 8626, 735 }, { 4583, 298 }, { 7561, 517 }, { 4583, 298 },
+    { 4767, 296 }, { 6017, 389 }, { 4815, 298 }, { 5788, 389 },
+    { 4586, 298 }, { 4778, 296 }, { -6621, 842 }, { 7792, 517 },
+    { 7793, 517 }, { -6581, 822 }, { 4781, 296 }, { 8302, 144 },
+    { 8802, 910 }, { 4646, 302 }, { 4588, 298 }, { 8259, 144 },
+    { 4553, 296 }, { 8593, 203 }, { 4646, 302 }, { -6635, 844 },
+    { 4783, 296 }, { 4784, 296 }, { 8869, 934 }, { 4835, 300 },
+    { 4836, 300 }, { 4837, 300 }, { 4838, 300 }, { 4839, 300 },
+    { 4840, 300 }, { 4841, 300 }, { 5789, 389 }, { 8506, 687 },
+    { 4650, 302 }, { 6021, 389 }, { 6022, 389 }, { 8513, 687 },
+    { 4590, 298 }, { 4613, 300 }, { 4882, 302 }, { 4633, 301 },
+    { 4654, 302 }, { 4619, 300 }, { -7436, 884 }, { 4885, 302 },
+    { 4886, 302 }, { 4887, 302 }, { 7796, 517 }, { 4888, 302 },
+    { 4865, 301 }, { 8869, 951 }, { 4657, 302 }, { 4850, 300 },
+    { 4622, 300 }, { 7799, 517 }, { 7800, 517 }, { 4866, 301 },
+    { 4659, 302 }, { 8523, 714 }, { 4638, 301 }, { -1234, 596 },
+    { 4623, 300 }, { -8256, 920 }, { 4626, 300 }, { 8669, 804 },
+    { 8718, 804 }, { 4624, 300 }, { 4626, 300 }, { 4661, 303 },
+    { 5691, 379 }, { 4662, 303 }, { 8886, 963 }, { 5694, 379 },
+    { 4894, 303 }, { 6140, 401 }, { 5910, 401 }, { 8702, 821 },
+    { 7826, 535 }, { 6142, 401 }, { 6144, 401 }, { 7828, 535 },
+    { 5926, 379 }, { 5927, 379 }, { 4861, 300 }, { 4862, 300 },
+    { 4639, 301 }, { 4638, 301 }, { 4863, 300 }, { -7415, 878 },
+    { 4870, 301 }, { 7829, 535 }, { 8060, 535 }, { 4873, 301 },
+    { -7896, 928 }, { 4871, 301 }, { 4874, 301 }, { 4875, 301 },
+    { 4876, 301 }, { 4877, 301 }, { 4878, 301 }, { 8753, 861 },
+    { 8737, 861 }, { 4895, 303 }, { 4896, 303 }, { 4897, 303 },
+    { -8732, 980 }, { 4898, 303 }, { 4899, 303 }, { 4900, 303 },
+    { 4902, 303 }, { 4903, 303 }, { 4923, 308 }, { 8894, 984 },
+    { 8879, 899 }, { 4674, 303 }, { 4675, 303 }, { 4924, 308 },
+    { 8839, 899 }, { 5694, 379 }, { 6468, 424 }, { 4925, 308 },
+    { 4693, 308 }, { 4697, 308 }, { 8270, 161 }, { 8312, 161 },
+    { 8319, 161 }, { 5929, 379 }, { 8281, 161 }, { 4928, 308 },
+    { 4930, 308 }, { 8952, 985 }, { 4708, 309 }, { 4710, 309 },
+    { 6146, 401 }, { 6469, 424 }, { 8128, 565 }, { 5914, 401 },
+    { 8155, 565 }, { 8145, 565 }, { 8178, 565 }, { 6470, 424 },
+    { 8734, 812 }, { 4712, 309 }, { 6471, 424 }, { 4717, 309 },
+    { 4720, 309 }, { 5007, 324 }, { 4699, 308 }, { 4944, 309 },
+    { 4931, 308 }, { 4725, 309 }, { 6472, 424 }, { 4932, 308 },
+    { -7136, 869 }, { 5009, 324 }, { 4739, 309 }, { -8743, 982 },
+    { 4703, 308 }, { 4730, 309 }, { 5000, 324 }, { 4934, 308 },
+    { 4731, 309 }, { 8955, 993 }, { 6240, 424 }, { 8904, 974 },
+    { 5231, 324 }, { -7591, 914 }, { 8974, 996 }, { 4701, 308 },
+    { 6474, 424 }, { 4962, 309 }, { 5014, 324 }, { 4964, 309 },
+    { 4965, 309 }, { 4974, 309 }, { 4975, 309 }, { 8742, 868 },
+    { 5015, 324 }, { 4742, 309 }, { 4977, 309 }, { -8892, 1005 },
+    { 8094, 554 }, { 8150, 554 }, { 8142, 554 }, { 8144, 554 },
+    { 4749, 309 }, { 8139, 554 }, { -5756, 212 }, { 4749, 309 },
+    { 4748, 310 }, { 8926, 1008 }, { 4753, 310 }, { -6489, 811 },
+    { 4752, 310 }, { 4751, 309 }, { 4757, 310 }, { 4761, 310 },
+    { -8849, 995 }, { 4999, 310 }, { 5000, 310 }, { 5232, 324 },
+    { -8225, 919 }, { 5233, 324 }, { 5001, 310 }, { 5002, 310 },
+    { 5003, 310 }, { 5004, 310 }, { 8987, 747 }, { 5005, 310 },
+    { 5006, 310 }, { 6208, 407 }, { 8685, 771 }, { 8686, 771 },
+    { 4783, 311 }, { 8694, 771 }, { 4777, 310 }, { 5025, 311 },
+    { 4798, 311 }, { 6209, 407 }, { 4794, 311 }, { 4799, 311 },
+    { 4777, 310 }, { 8452, 686 }, { 8499, 686 }, { 5976, 407 },
+    { 4780, 310 }, { 8470, 686 }, { 6211, 407 }, { 6212, 407 },
+    { 4781, 310 }, { 4801, 311 }, { 4804, 311 }, { 8981, 802 },
+    { 4794, 310 }, { 4805, 311 }, { 4782, 310 }, { 4805, 311 },
+    { 8705, 842 }, { 6256, 414 }, { 4806, 311 }, { 8739, 822 },
+    { 8726, 822 }, { 5039, 311 }, { -8946, 755 }, { 6261, 414 },
+    { 5040, 311 }, { 5041, 311 }, { 6028, 414 }, { 5042, 311 },
+    { 5043, 311 }, { 5044, 311 }, { 5045, 311 }, { 5046, 311 },
+    { 5057, 312 }, { 8727, 844 }, { 4817, 311 }, { 4818, 311 },
+    { 4818, 311 }, { 6034, 414 }, { 8118, 563 }, { 8173, 563 },
+    { 8172, 563 }, { 8123, 563 }, { 4828, 312 }, { 8952, 1017 },
+    { 6213, 407 }, { 8925, 952 }, { 6214, 407 }, { 4830, 312 },
+    { 6215, 407 }, { 8913, 952 }, { 4820, 311 }, { 8977, 1025 },
+    { 4823, 311 }, { 4826, 311 }, { 8927, 953 }, { 8780, 884 },
+    { 5062, 312 }, { 5063, 312 }, { 8914, 953 }, { 5064, 312 },
+    { 5066, 312 }, { 5067, 312 }, { 5070, 312 }, { 5071, 312 },
+    { 5072, 312 }, { 5073, 312 }, { 5074, 312 }, { 5075, 312 },
+    { 8195, 596 }, { 4847, 313 }, { 8232, 596 }, { 8903, 920 },
+    { 4850, 313 }, { 8256, 596 }, { 8898, 920 }, { 6043, 414 },
+    { 4851, 313 }, { 4843, 312 }, { 4848, 313 }, { 4859, 314 },
+    { 5133, 317 }, { 5134, 317 }, { 5135, 317 }, { 5137, 317 },
+    { 5136, 317 }, { 4857, 314 }, { 5138, 317 }, { 8249, 143 },
+    { 8251, 143 }, { 8305, 143 }, { 8969, 1035 }, { 4846, 312 },
+    { 8298, 143 }, { 5083, 313 }, { 5084, 313 }, { 8949, 1044 },
+    { 5085, 313 }, { 5086, 313 }, { 5087, 313 }, { 5934, 403 },
+    { 9006, 1046 }, { 8745, 878 }, { 4860, 314 }, { 8843, 928 },
+    { 4862, 314 }, { 6166, 403 }, { 8835, 928 }, { 4864, 314 },
+    { 7226, 483 }, { 5093, 313 }, { 7230, 483 }, { 8979, 1064 },
+    { 8980, 1066 }, { 6167, 403 }, { 8939, 980 }, { 4909, 317 },
+    { 4854, 313 }, { 4857, 313 }, { 5097, 314 }, { 5099, 314 },
+    { 8996, 1075 }, { 4906, 317 }, { 5100, 314 }, { 5102, 314 },
+    { 4950, 321 }, { 5106, 314 }, { 9015, 1089 }, { 5107, 314 },
+    { 5116, 316 }, { 5118, 316 }, { 5121, 316 }, { 5181, 321 },
+    { 4910, 317 }, { 5122, 316 }, { 6168, 403 }, { 8933, 997 },
+    { 4949, 321 }, { 8972, 997 }, { 8986, 1062 }, { 4889, 316 },
+    { 7231, 483 }, { 9029, 1062 }, { 7233, 483 }, { 4893, 316 },
+    { 4953, 321 }, { 7234, 483 }, { 5184, 321 }, { 5430, 335 },
+    { 8922, 946 }, { 5431, 335 }, { 6169, 403 }, { 8936, 946 },
+    { 8908, 946 }, { 4955, 321 }, { 4958, 321 }, { 8939, 806 },
+    { 5202, 335 }, { 4957, 321 }, { 5937, 403 }, { 8952, 806 },
+    { 5941, 403 }, { 8710, 869 }, { 8758, 869 }, { 4958, 321 },
+    { 4892, 316 }, { 5203, 335 }, { 4966, 322 }, { 5190, 321 },
+    { 8939, 982 }, { 4961, 321 }, { 5198, 322 }, { 4963, 321 },
+    { 4895, 316 }, { 4900, 316 }, { 4961, 321 }, { 8826, 914 },
+    { 8803, 914 }, { 4986, 323 }, { 5199, 322 }, { 9165, 1132 },
+    { -8918, 1016 }, { 4987, 323 }, { 4971, 322 }, { 8383, 627 },
+    { 8429, 627 }, { 8413, 627 }, { 5131, 316 }, { 4989, 323 },
+    { 8422, 627 }, { 4899, 316 }, { 5203, 335 }, { 4986, 323 },
+    { 8973, 1005 }, { 5204, 335 }, { 9168, 1133 }, { 8538, 212 },
+    { 5211, 335 }, { 8571, 212 }, { 8569, 212 }, { 4991, 323 },
+    { 5206, 322 }, { 8679, 811 }, { 4974, 322 }, { 8689, 811 },
+    { 5209, 322 }, { 5205, 335 }, { 8973, 995 }, { 4980, 322 },
+    { 5223, 323 }, { 4978, 322 }, { 8850, 919 }, { 8899, 919 },
+    { 5437, 336 }, { 4994, 323 }, { 8882, 919 }, { 5227, 323 },
+    { 4984, 322 }, { 6646, 462 }, { 5017, 325 }, { 8973, 1043 },
+    { 4982, 322 }, { 6877, 462 }, { 6879, 462 }, { 8996, 1043 },
+    { 5208, 336 }, { 4996, 323 }, { 5251, 325 }, { 8455, 671 },
+    { 8437, 671 }, { 8460, 671 }, { 5228, 323 }, { 5229, 323 },
+    { 8500, 671 }, { 5253, 325 }, { 5252, 325 }, { 5255, 325 },
+    { 5259, 325 }, { 5260, 325 }, { -9299, 1058 }, { 5062, 328 },
+    { 5066, 328 }, { 5027, 325 }, { 5446, 336 }, { 5447, 336 },
+    { 5051, 328 }, { 5032, 325 }, { 5628, 352 }, { 5448, 336 },
+    { -10687, 1092 }, { 5398, 352 }, { 6880, 462 }, { 6881, 462 },
+    { 6882, 462 }, { -10285, 1070 }, { 8948, 755 }, { 5029, 325 },
+    { 5449, 336 }, { 5539, 348 }, { 5068, 328 }, { 5219, 336 },
+    { 5051, 328 }, { 5034, 325 }, { 5032, 325 }, { 5630, 352 },
+    { 8340, 589 }, { 8318, 589 }, { 8343, 589 }, { 8337, 589 },
+    { 5402, 352 }, { -10955, 1112 }, { 5540, 348 }, { 5071, 328 },
+    { 5397, 352 }, { 5059, 328 }, { 5060, 328 }, { 5069, 328 },
+    { 9137, 1148 }, { 5036, 325 }, { 5303, 328 }, { 5304, 329 },
+    { 5078, 328 }, { 5315, 329 }, { 5314, 329 }, { 5095, 328 },
+    { 5541, 348 }, { 5320, 329 }, { 5308, 348 }, { 5402, 352 },
+    { 8933, 780 }, { 5312, 328 }, { 8965, 780 }, { 5546, 348 },
+    { 9052, 1084 }, { 5097, 329 }, { 9014, 1084 }, { 5102, 329 },
+    { 5103, 329 }, { 9190, 1151 }, { 5172, 333 }, { 9051, 1121 },
+    { 5547, 348 }, { 5174, 333 }, { 5321, 348 }, { 9097, 1121 },
+    { 9206, 1156 }, { 5637, 352 }, { 5318, 348 }, { 5101, 329 },
+    { 5176, 333 }, { 5105, 329 }, { 5106, 329 }, { 5107, 329 },
+    { 5339, 329 }, { 5177, 333 }, { 8991, 1007 }, { 8990, 1007 },
+    { 5340, 329 }, { 8952, 1007 }, { 5354, 330 }, { 5341, 329 },
+    { 5342, 329 }, { 5355, 330 }, { 8352, 641 }, { 8401, 641 },
+    { 8373, 641 }, { 8409, 641 }, { 5113, 329 }, { 5344, 329 },
+    { 5408, 333 }, { 5409, 333 }, { 5410, 333 }, { 5412, 333 },
+    { 5413, 333 }, { 5414, 333 }, { 5415, 333 }, { 5416, 333 },
+    { 5417, 333 }, { 5418, 333 }, { 9209, 1159 }, { -8187, 917 },
+    { 5126, 330 }, { 5119, 329 }, { 5113, 329 }, { 7829, 536 },
+    { 9244, 1177 }, { 5127, 330 }, { 5129, 330 }, { 5361, 330 },
+    { 8062, 536 }, { 9265, 1195 }, { 8063, 536 }, { 5362, 330 },
+    { 5364, 330 }, { 9270, 1196 }, { 5365, 330 }, { -10911, 1130 },
+    { 7834, 536 }, { 5366, 330 }, { 5383, 332 }, { 5367, 330 },
+    { 5371, 330 }, { 7834, 536 }, { 5372, 330 }, { 5384, 332 },
+    { 5143, 330 }, { 5385, 332 }, { 5386, 332 }, { 5389, 332 },
+    { 5387, 332 }, { 5390, 332 }, { 5388, 332 }, { 5140, 330 },
+    { 5391, 332 }, { 5392, 332 }, { 9267, 1208 }, { 5394, 332 },
+    { 5512, 346 }, { 9166, 1123 }, { 9139, 1123 }, { -6652, 845 },
+    { 5395, 332 }, { 5166, 332 }, { 5513, 346 }, { 8136, 567 },
+    { 8189, 567 }, { 8184, 567 }, { 5514, 346 }, { 8182, 567 },
+    { 8197, 567 }, { 6094, 395 }, { 6095, 395 }, { 5169, 332 },
+    { 9335, 1207 }, { 5515, 346 }, { 5516, 346 }, { 6217, 408 },
+    { 9129, 1145 }, { 5284, 346 }, { 5988, 408 }, { 9182, 1145 },
+    { 9183, 1145 }, { 5518, 346 }, { 5523, 347 }, { 5524, 347 },
+    { 6219, 408 }, { 6220, 408 }, { 9373, 1265 }, { 6221, 408 },
+    { 5519, 346 }, { 5866, 395 }, { 8979, 1016 }, { 6098, 395 },
+    { 6099, 395 }, { 5400, 332 }, { 5296, 347 }, { 6101, 395 },
+    { 5297, 347 }, { -10926, 1136 }, { 5170, 332 }, { 5295, 347 },
+    { 5393, 332 }, { 9388, 1234 }, { 5530, 347 }, { -10380, 1079 },
+    { 5301, 347 }, { 7138, 492 }, { 5532, 347 }, { 5520, 346 },
+    { 5303, 347 }, { 7373, 492 }, { 5291, 346 }, { 5992, 408 },
+    { 5333, 350 }, { 5337, 350 }, { 5534, 347 }, { 6223, 408 },
+    { 9165, 1157 }, { 5872, 395 }, { 5288, 346 }, { 9174, 1157 },
+    { 6224, 408 }, { 5358, 351 }, { -9243, 1050 }, { 7377, 492 },
+    { 5305, 347 }, { -12980, 1228 }, { 7147, 492 }, { 6103, 395 },
+    { 6104, 395 }, { 5324, 350 }, { -10937, 1153 }, { 6105, 395 },
+    { 7150, 492 }, { 9326, 1222 }, { 5538, 347 }, { 5560, 350 },
+    { 9344, 1222 }, { 5572, 350 }, { 5360, 351 }, { 5566, 350 },
+    { 5577, 350 }, { 5578, 350 }, { 5579, 350 }, { 5580, 350 },
+    { 5360, 351 }, { 5581, 350 }, { 5582, 350 }, { 5592, 351 },
+    { 9012, 1058 }, { 7150, 492 }, { 5363, 351 }, { 5365, 351 },
+    { 8304, 603 }, { 8377, 603 }, { 8363, 603 }, { 5353, 350 },
+    { 8350, 603 }, { 5369, 351 }, { -1937, 592 }, { 5604, 351 },
+    { 9333, 1236 }, { 5354, 350 }, { 9079, 1092 }, { 5353, 350 },
+    { 9008, 1070 }, { -11482, 1134 }, { 5371, 351 }, { 5355, 350 },
+    { 5375, 351 }, { 9226, 1169 }, { 9215, 1169 }, { 5610, 351 },
+    { 5611, 351 }, { 5612, 351 }, { 9379, 1243 }, { 5613, 351 },
+    { 5614, 351 }, { 5620, 351 }, { 5622, 351 }, { 5627, 351 },
+    { 5408, 353 }, { 9074, 1112 }, { 5639, 353 }, { 9351, 1262 },
+    { 5642, 353 }, { 5643, 353 }, { 5644, 353 }, { 5646, 353 },
+    { -11917, 1165 }, { 5647, 353 }, { 5648, 353 }, { -12712, 1186 },
+    { 5649, 353 }, { 5650, 353 }, { 5651, 353 }, { 9360, 1266 },
+    { 5652, 353 }, { 5653, 353 }, { 5654, 353 }, { 5656, 353 },
+    { 9378, 1245 }, { 9357, 1245 }, { 5664, 354 }, { 6813, 453 },
+    { 6818, 453 }, { 6819, 453 }, { 6394, 436 }, { 6628, 436 },
+    { 5437, 354 }, { 6399, 436 }, { 6631, 436 }, { 5462, 355 },
+    { 5442, 354 }, { 6590, 453 }, { 6403, 436 }, { 6403, 436 },
+    { 9317, 1182 }, { 6635, 436 }, { 9287, 1182 }, { 9257, 1182 },
+    { 5426, 353 }, { 5429, 353 }, { 5467, 355 }, { 9340, 1269 },
+    { 6821, 453 }, { 5432, 353 }, { 9379, 1273 }, { 5676, 354 },
+    { 5464, 355 }, { 5677, 354 }, { 5678, 354 }, { 5679, 354 },
+    { 5680, 354 }, { 5681, 354 }, { 5437, 353 }, { 5682, 354 },
+    { 5683, 354 }, { 9362, 1264 }, { 5684, 354 }, { 5685, 354 },
+    { 5686, 354 }, { 5687, 354 }, { 9151, 1114 }, { 9068, 1114 },
+    { 5467, 355 }, { 9046, 1114 }, { -9106, 1061 }, { 6822, 453 },
+    { 8827, 917 }, { 8893, 917 }, { 5457, 354 }, { 5456, 354 },
+    { 8891, 917 }, { 6605, 455 }, { 5468, 355 }, { 5470, 355 },
+    { 5460, 354 }, { 9191, 1158 }, { 5472, 356 }, { 9245, 1158 },
+    { 5476, 355 }, { 9233, 1158 }, { 5479, 355 }, { 5709, 356 },
+    { 9057, 1130 }, { 5711, 356 }, { 5712, 356 }, { 5713, 356 },
+    { 5506, 359 }, { 5714, 356 }, { 5715, 356 }, { -13394, 1276 },
+    { 6837, 455 }, { 5716, 356 }, { 6838, 455 }, { 5717, 356 },
+    { 5718, 356 }, { 9388, 1263 }, { 9394, 1263 }, { 6605, 455 },
+    { 5546, 364 }, { 9414, 1305 }, { 5511, 359 }, { 5780, 364 },
+    { 6840, 455 }, { 5489, 356 }, { 6860, 461 }, { 6862, 461 },
+    { 5742, 359 }, { 8738, 845 }, { 8705, 845 }, { 5744, 359 },
+    { 8741, 845 }, { 6630, 461 }, { 5720, 356 }, { 5745, 359 },
+    { 9420, 1308 }, { 5746, 359 }, { 5748, 359 }, { 5749, 359 },
+    { 5491, 356 }, { 5750, 359 }, { 5752, 359 }, { 5753, 359 },
+    { 6632, 461 }, { 5754, 359 }, { 5755, 359 }, { 5763, 361 },
+    { 5764, 361 }, { 5497, 356 }, { 6873, 461 }, { 5566, 364 },
+    { 5765, 361 }, { 5781, 364 }, { 5766, 361 }, { 5782, 364 },
+    { 5550, 364 }, { 8526, 730 }, { 8539, 730 }, { 8539, 730 },
+    { 9410, 801 }, { 5792, 364 }, { 8541, 730 }, { 9370, 807 },
+    { -13481, 834 }, { 6644, 461 }, { 5806, 365 }, { 6875, 461 },
+    { 9100, 1136 }, { 5767, 361 }, { 5800, 364 }, { 5804, 364 },
+    { 5573, 365 }, { 9037, 1079 }, { 9032, 1079 }, { 5808, 365 },
+    { 5819, 366 }, { 5820, 366 }, { 5821, 366 }, { 8200, 599 },
+    { 8230, 599 }, { 8240, 599 }, { 8231, 599 }, { 8265, 599 },
+    { 5575, 365 }, { -13485, 836 }, { 5534, 361 }, { 5538, 361 },
+    { 5810, 365 }, { 9372, 849 }, { 5624, 372 }, { 8966, 1050 },
+    { 9008, 1050 }, { 5770, 361 }, { 5812, 365 }, { 5813, 365 },
+    { 5858, 372 }, { 9418, 177 }, { 9320, 1228 }, { 5593, 366 },
+    { 9060, 1153 }, { -13523, 210 }, { 5824, 366 }, { 5647, 374 },
+    { 9120, 1153 }, { 5648, 374 }, { 5827, 366 }, { -13527, 215 },
+    { 5627, 372 }, { 5879, 374 }, { 5634, 372 }, { 5595, 366 },
+    { 5584, 365 }, { 5828, 366 }, { 5829, 366 }, { 5830, 366 },
+    { 5831, 366 }, { 5650, 374 }, { 5832, 366 }, { 5835, 366 },
+    { 5833, 366 }, { 5865, 372 }, { 5582, 365 }, { 5817, 365 },
+    { 5635, 372 }, { -266, 561 }, { 5822, 365 }, { 5818, 365 },
+    { 8312, 592 }, { 8329, 592 }, { 8294, 592 }, { 5882, 374 },
+    { -13531, 216 }, { 6636, 437 }, { 9126, 1134 }, { 9121, 1134 },
+    { 5868, 372 }, { 6527, 446 }, { 9180, 1134 }, { 6637, 437 },
+    { 5639, 372 }, { 5871, 372 }, { 5892, 375 }, { 6525, 446 },
+    { 6405, 437 }, { 5885, 374 }, { 5886, 374 }, { 5887, 374 },
+    { 5888, 374 }, { 5889, 374 }, { 5890, 374 }, { 5891, 374 },
+    { 5708, 383 }, { 5893, 375 }, { 6639, 437 }, { 8912, 992 },
+    { 8967, 992 }, { 8965, 992 }, { 9177, 1165 }, { 6640, 437 },
+    { 5899, 375 }, { 9305, 1186 }, { 6762, 446 }, { -13535, 217 },
+    { 6763, 446 }, { 6764, 446 }, { 5670, 375 }, { 5672, 375 },
+    { 6765, 446 }, { 6641, 437 }, { 6766, 446 }, { 6767, 446 },
+    { 5902, 375 }, { 9413, 1267 }, { 5710, 383 }, { 9368, 1267 },
+    { 5710, 383 }, { 6538, 446 }, { 9374, 226 }, { 5713, 383 },
+    { 6412, 437 }, { 5903, 375 }, { 5904, 375 }, { 5905, 375 },
+    { -13546, 227 }, { 5906, 375 }, { 9403, 1082 }, { 9394, 1083 },
+    { 5709, 383 }, { 5716, 383 }, { 9214, 1166 }, { 9203, 1166 },
+    { 5729, 385 }, { 9216, 1166 }, { 5731, 385 }, { 9440, 1093 },
+    { 5718, 383 }, { 5716, 383 }, { 5720, 383 }, { 5962, 385 },
+    { 5964, 385 }, { 5953, 383 }, { -13700, 1115 }, { 5725, 383 },
+    { 8948, 1037 }, { 9003, 1037 }, { 9002, 1037 }, { 5956, 383 },
+    { 5965, 385 }, { 5966, 385 }, { 5967, 385 }, { -13704, 1116 },
+    { 5745, 386 }, { 9450, 185 }, { 5750, 386 }, { 5977, 386 },
+    { 5981, 386 }, { 5752, 386 }, { 5990, 387 }, { 8994, 1061 },
+    { 8983, 1061 }, { 5968, 385 }, { -13715, 211 }, { 5969, 385 },
+    { 5970, 385 }, { 5984, 386 }, { 5971, 385 }, { 5742, 385 },
+    { 5752, 386 }, { 5973, 385 }, { 9368, 862 }, { -13719, 219 },
+    { 8008, 550 }, { 8237, 550 }, { 9441, 761 }, { 9402, 862 },
+    { 5991, 387 }, { 5992, 387 }, { 8243, 550 }, { 8659, 803 },
+    { 8710, 803 }, { 8717, 803 }, { 5794, 390 }, { 8699, 803 },
+    { 5797, 390 }, { 9397, 1276 }, { 8014, 550 }, { 5987, 386 },
+    { 9463, 770 }, { 5988, 386 }, { 5989, 386 }, { 6027, 390 },
+    { 6028, 390 }, { 6030, 390 }, { 5795, 390 }, { 5993, 387 },
+    { 5994, 387 }, { -13750, 785 }, { 6031, 390 }, { 6032, 390 },
+    { 6033, 390 }, { -13754, 797 }, { 9460, 813 }, { 5801, 390 },
+    { 5852, 394 }, { 9407, 155 }, { -13800, 173 }, { 5899, 400 },
+    { 5899, 400 }, { 9423, 198 }, { 8245, 550 }, { 8246, 550 },
+    { 6131, 400 }, { -14221, 1315 }, { 9446, 1275 }, { 5996, 387 },
+    { 5997, 387 }, { 9463, 1275 }, { 5904, 400 }, { 6083, 394 },
+    { -14225, 1318 }, { 5855, 394 }, { 5856, 394 }, { 5906, 400 },
+    { -14229, 1319 }, { 6137, 400 }, { 5805, 390 }, { 5857, 394 },
+    { 5806, 390 }, { -13789, 158 }, { 6089, 394 }, { 8248, 550 },
+    { 5808, 390 }, { 6138, 400 }, { 6139, 400 }, { 6177, 405 },
+    { 9445, 1324 }, { -14289, 638 }, { 6092, 394 }, { 6093, 394 },
+    { 5918, 402 }, { 5920, 402 }, { 6228, 409 }, { 6150, 402 },
+    { 9513, 663 }, { 6179, 405 }, { 6152, 402 }, { 9520, 672 },
+    { 9516, 663 }, { 6182, 405 }, { 5959, 405 }, { 5923, 402 },
+    { -14135, 1300 }, { 6155, 402 }, { -13689, 1109 }, { 5961, 405 },
+    { -14409, 689 }, { 5923, 402 }, { 5925, 402 }, { -14338, 667 },
+    { 6193, 405 }, { 6194, 405 }, { 8672, 805 }, { 8728, 805 },
+    { 8727, 805 }, { 5995, 409 }, { 8689, 805 }, { -14271, 1328 },
+    { -14413, 690 }, { 6195, 405 }, { 6196, 405 }, { 9533, 1323 },
+    { 6015, 413 }, { 9470, 680 }, { 9522, 680 }, { 5996, 409 },
+    { -14459, 1329 }, { 6197, 405 }, { 5930, 402 }, { -14463, 1332 },
+    { 6227, 409 }, { 6229, 409 }, { 6230, 409 }, { 6231, 409 },
+    { 6232, 409 }, { 6233, 409 }, { 6018, 413 }, { 6161, 402 },
+    { 6164, 402 }, { -13758, 810 }, { -14505, 1334 }, { 6249, 413 },
+    { 6250, 413 }, { -14509, 1335 }, { 8110, 561 }, { 8161, 561 },
+    { 8154, 561 }, { 8127, 561 }, { -14513, 1336 }, { 6253, 413 },
+    { -14517, 1337 }, { 6162, 402 }, { 8816, 923 }, { 8860, 923 },
+    { 8854, 923 }, { 6254, 413 }, { 8797, 923 }, { -14521, 1338 },
+    { 9533, 1342 }, { 6255, 413 }, { 9533, 1344 }, { 6291, 421 },
+    { 6292, 421 }, { 6295, 421 }, { 6293, 421 }, { 6300, 421 },
+    { 6296, 421 }, { 6302, 421 }, { 6297, 421 }, { 6298, 421 },
+    { 6299, 421 }, { 6303, 421 }, { 6301, 421 }, { 6304, 421 },
+    { 6305, 421 }, { 6038, 413 }, { 6306, 421 }, { 6307, 421 },
+    { 6308, 421 }, { 6309, 421 }, { 6310, 421 }, { 9544, 1355 },
+    { 6312, 421 }, { 6313, 421 }, { 6314, 421 }, { 6315, 421 },
+    { 6316, 421 }, { 6317, 421 }, { -14570, 1343 }, { -6291, 786 },
+    { 6318, 421 }, { 6319, 421 }, { 6320, 421 }, { 6321, 422 },
+    { 6322, 422 }, { 6323, 422 }, { 6324, 422 }, { 6325, 422 },
+    { 6326, 422 }, { 6331, 422 }, { 6327, 422 }, { 6329, 422 },
+    { 6330, 422 }, { 6332, 422 }, { 6333, 422 }, { 6334, 422 },
+    { 6335, 422 }, { 6336, 422 }, { 6338, 422 }, { 6339, 422 },
+    { 6340, 422 }, { 6341, 422 }, { 6343, 422 }, { -9268, 1057 },
+    { 6345, 422 }, { -14574, 1345 }, { 6346, 422 }, { 6347, 422 },
+    { 6348, 422 }, { 6349, 422 }, { 6350, 422 }, { 6351, 422 },
+    { 6352, 422 }, { 6353, 422 }, { 6354, 422 }, { 6355, 422 },
+    { 6356, 422 }, { 6357, 422 }, { 6358, 422 }, { -14240, 1327 },
+    { 6359, 422 }, { 6361, 422 }, { 6362, 422 }, { 6363, 422 },
+    { 6364, 422 }, { 6365, 422 }, { 6366, 422 }, { 9541, 1350 },
+    { 6367, 422 }, { 6368, 422 }, { 6369, 422 }, { 6370, 422 },
+    { -14585, 1357 }, { 6371, 422 }, { 6372, 422 }, { 6373, 422 },
+    { 6374, 422 }, { 6375, 422 }, { 6183, 422 }, { 6376, 422 },
+    { -14417, 1321 }, { 6377, 422 }, { 6378, 422 }, { 6379, 422 },
+    { 6381, 422 }, { 6382, 422 }, { 6383, 422 }, { 6384, 423 },
+    { 6387, 423 }, { 6389, 423 }, { 6390, 423 }, { 6391, 423 },
+    { 6393, 423 }, { 6396, 423 }, { 6398, 423 }, { 6401, 423 },
+    { 6402, 423 }, { -1145, 590 }, { 6403, 423 }, { 6404, 423 },
+    { 6406, 423 }, { 6407, 423 }, { 6409, 423 }, { -14607, 1380 },
+    { 6410, 423 }, { 6417, 423 }, { 6418, 423 }, { 6419, 423 },
+    { 6420, 423 }, { 6421, 423 }, { 6422, 423 }, { 6423, 423 },
+    { 6424, 423 }, { 6425, 423 }, { 6426, 423 }, { 6427, 423 },
+    { 6429, 423 }, { -3751, 600 }, { 6430, 423 }, { 6434, 423 },
+    { 6432, 423 }, { 6435, 423 }, { 6436, 423 }, { 6437, 423 },
+    { 6438, 423 }, { 6440, 423 }, { 6441, 423 }, { 6442, 423 },
+    { 6444, 423 }, { 6445, 423 }, { 6446, 423 }, { 6452, 423 },
+    { 6453, 423 }, { 6454, 423 }, { 6461, 423 }, { 6462, 423 },
+    { 6463, 423 }, { 6464, 423 }, { 6465, 423 }, { 6466, 423 },
+    { 6467, 423 }, { 6258, 427 }, { 9459, 158 }, { 6255, 427 },
+    { -14611, 1382 }, { 6500, 428 }, { 8152, 571 }, { 8229, 571 },
+    { 8211, 571 }, { 8179, 571 }, { 8268, 571 }, { 8227, 571 },
+    { 6262, 427 }, { 6262, 427 }, { 6501, 428 }, { 6502, 428 },
+    { 6503, 428 }, { 6841, 456 }, { 6842, 456 }, { 6843, 456 },
+    { 6508, 429 }, { 6265, 427 }, { 9445, 1300 }, { 6504, 428 },
+    { 6844, 456 }, { 9408, 1109 }, { 6285, 429 }, { 6271, 428 },
+    { 7218, 498 }, { 9508, 667 }, { 7220, 498 }, { 7454, 498 },
+    { -14615, 1384 }, { 7225, 498 }, { 7230, 498 }, { 7235, 498 },
+    { 6585, 432 }, { -14619, 1389 }, { 7238, 498 }, { 6495, 427 },
+    { -14146, 1311 }, { 9507, 1328 }, { 6352, 432 }, { 6275, 429 },
+    { 6506, 428 }, { 6507, 428 }, { 6276, 429 }, { 6353, 432 },
+    { -8285, 936 }, { 6511, 429 }, { 6287, 429 }, { 6267, 427 },
+    { 9534, 1332 }, { 6519, 429 }, { 6288, 429 }, { 9536, 1341 },
+    { 6497, 427 }, { 9522, 843 }, { 9540, 1341 }, { 6499, 427 },
+    { 9457, 810 }, { 6536, 430 }, { 6538, 430 }, { 6523, 429 },
+    { 6308, 430 }, { 9541, 835 }, { 9553, 846 }, { 6539, 430 },
+    { 9544, 835 }, { 6524, 429 }, { 6845, 456 }, { 6587, 432 },
+    { 6846, 456 }, { 6314, 430 }, { 6359, 432 }, { 6315, 430 },
+    { 8951, 1039 }, { 9001, 1039 }, { 9006, 1039 }, { 6534, 429 },
+    { 6535, 429 }, { 8999, 1039 }, { 9526, 852 }, { 9555, 852 },
+    { -14727, 856 }, { 6595, 432 }, { 6596, 432 }, { 6597, 432 },
+    { 6598, 432 }, { 6547, 430 }, { 7608, 521 }, { 6557, 431 },
+    { 6327, 431 }, { -14731, 857 }, { 6319, 430 }, { 6562, 431 },
+    { 7843, 521 }, { 6565, 431 }, { 6566, 431 }, { 6570, 431 },
+    { 6551, 430 }, { 6567, 431 }, { 6568, 431 }, { 6552, 430 },
+    { 6554, 430 }, { -14735, 858 }, { -14739, 879 }, { 6376, 435 },
+    { 6575, 431 }, { 8686, 786 }, { 8709, 786 }, { 6610, 435 },
+    { 8652, 786 }, { 8691, 786 }, { 7614, 521 }, { 6555, 430 },
+    { 9492, 1322 }, { 6381, 435 }, { 6385, 435 }, { 9556, 890 },
+    { 9520, 1322 }, { -14757, 149 }, { 6326, 430 }, { 6389, 435 },
+    { 7612, 521 }, { -1473, 602 }, { 7847, 521 }, { -14761, 153 },
+    { 9510, 157 }, { 7848, 521 }, { 9553, 160 }, { 6578, 431 },
+    { 8966, 1057 }, { 8968, 1057 }, { 9017, 1057 }, { 6390, 435 },
+    { 6579, 431 }, { 9504, 502 }, { 6580, 431 }, { -14796, 508 },
+    { 6621, 435 }, { 8973, 1059 }, { 9005, 1059 }, { 8977, 1059 },
+    { 8989, 1059 }, { 6647, 438 }, { 9507, 513 }, { 6391, 435 },
+    { 9453, 1327 }, { 9499, 1327 }, { 9520, 523 }, { 6649, 438 },
+    { 6650, 438 }, { 6623, 435 }, { 6624, 435 }, { 6652, 438 },
+    { 6653, 438 }, { 6654, 438 }, { 6656, 438 }, { 6658, 438 },
+    { -14845, 882 }, { 6423, 438 }, { 6395, 435 }, { 9572, 891 },
+    { 6626, 435 }, { 6728, 443 }, { 6434, 439 }, { 6442, 439 },
+    { -14878, 1361 }, { 9470, 1321 }, { 9576, 1379 }, { 9577, 1404 },
+    { 6732, 443 }, { 6733, 443 }, { 6734, 443 }, { 6735, 443 },
+    { 6737, 443 }, { -16012, 1414 }, { 6677, 439 }, { 6678, 439 },
+    { -16027, 1391 }, { 6679, 439 }, { 6436, 438 }, { 6661, 438 },
+    { 6680, 439 }, { 6681, 439 }, { 8162, 590 }, { 8218, 590 },
+    { 8215, 590 }, { -16031, 1392 }, { 8204, 590 }, { 8171, 590 },
+    { 9672, 1405 }, { 6432, 438 }, { 9626, 1441 }, { 6685, 440 },
+    { 7819, 519 }, { 6508, 443 }, { 6457, 440 }, { 9534, 1383 },
+    { 9629, 1383 }, { 6664, 438 }, { 7587, 519 }, { 6682, 439 },
+    { 7590, 519 }, { 6689, 440 }, { 8339, 600 }, { 8357, 600 },
+    { 8303, 600 }, { 8369, 600 }, { 6715, 441 }, { 8328, 600 },
+    { 9522, 1372 }, { 9568, 1372 }, { 9584, 1372 }, { 6691, 440 },
+    { 6692, 440 }, { 6693, 440 }, { 6454, 439 }, { 6694, 440 },
+    { 6695, 440 }, { 6696, 440 }, { 6701, 440 }, { 9627, 1442 },
+    { 6697, 440 }, { 6698, 440 }, { 6702, 440 }, { 6704, 440 },
+    { 6705, 440 }, { 6706, 440 }, { 6709, 440 }, { 6710, 440 },
+    { 6711, 440 }, { 6482, 441 }, { 6712, 440 }, { -14882, 1364 },
+    { 6713, 440 }, { 9692, 1447 }, { 6570, 452 }, { 6791, 452 },
+    { 7825, 519 }, { 6792, 452 }, { 9504, 640 }, { 9485, 640 },
+    { 6481, 440 }, { 7597, 519 }, { 9513, 640 }, { -16265, 987 },
+    { 9600, 1385 }, { 9552, 1385 }, { 6793, 452 }, { 7599, 519 },
+    { 9602, 1385 }, { 6620, 460 }, { 6717, 441 }, { 6718, 441 },
+    { 6719, 441 }, { 6720, 441 }, { 6850, 460 }, { 6721, 441 },
+    { 6722, 441 }, { 6723, 441 }, { 6724, 441 }, { 6725, 441 },
+    { -16269, 988 }, { 6625, 460 }, { 6493, 441 }, { 6802, 452 },
+    { 6803, 452 }, { 6593, 454 }, { 6805, 452 }, { 9437, 1311 },
+    { 6824, 454 }, { 6852, 460 }, { 9488, 1311 }, { -16273, 989 },
+    { 6825, 454 }, { 6826, 454 }, { 8902, 936 }, { 8905, 936 },
+    { 8889, 936 }, { 8912, 936 }, { 6594, 454 }, { 9660, 1398 },
+    { 9590, 1398 }, { 6809, 452 }, { 6810, 452 }, { 6812, 452 },
+    { 6624, 460 }, { 9691, 1003 }, { 6857, 460 }, { 8862, 939 },
+    { 8921, 939 }, { 6638, 460 }, { 8893, 939 }, { 8920, 939 },
+    { 8898, 939 }, { 6858, 460 }, { 9695, 1006 }, { 6859, 460 },
+    { 8382, 626 }, { 8552, 626 }, { 8450, 626 }, { 8389, 626 },
+    { 8405, 626 }, { 9439, 1314 }, { 9504, 1314 }, { 9479, 1314 },
+    { 6829, 454 }, { 9464, 1314 }, { 6830, 454 }, { 6831, 454 },
+    { 6832, 454 }, { 6833, 454 }, { 6834, 454 }, { 6896, 466 },
+    { 6898, 466 }, { -16291, 1022 }, { 6900, 466 }, { 6899, 466 },
+    { 6901, 466 }, { 6902, 466 }, { 6903, 466 }, { 6904, 466 },
+    { 6905, 466 }, { 6906, 466 }, { 6908, 466 }, { -16295, 1023 },
+    { 6909, 466 }, { 6910, 466 }, { 6911, 466 }, { 6912, 466 },
+    { 6680, 466 }, { 7849, 522 }, { 7850, 522 }, { -15542, 1388 },
+    { 7859, 522 }, { 7860, 522 }, { 7861, 522 }, { 7862, 522 },
+    { 6683, 466 }, { -16078, 1427 }, { 9222, 1173 }, { 9288, 1173 },
+    { 6915, 466 }, { 9254, 1173 }, { 7633, 522 }, { 9278, 1173 },
+    { 7864, 522 }, { 6721, 466 }, { 9570, 1399 }, { 9647, 1399 },
+    { 6916, 466 }, { -16299, 1024 }, { 8220, 602 }, { 8279, 602 },
+    { 8279, 602 }, { 8248, 602 }, { 8274, 602 }, { 8281, 602 },
+    { 9561, 153 }, { 6917, 466 }, { 6941, 473 }, { 6948, 473 },
+    { 6949, 473 }, { 6950, 473 }, { 6956, 473 }, { 6957, 473 },
+    { 6959, 473 }, { 6960, 473 }, { 6961, 473 }, { 6962, 473 },
+    { 6966, 473 }, { 9561, 508 }, { 6967, 473 }, { 6968, 473 },
+    { 6969, 473 }, { 6970, 473 }, { 9700, 823 }, { 6971, 473 },
+    { 6972, 473 }, { 6973, 473 }, { 6974, 473 }, { 6975, 473 },
+    { 6976, 473 }, { 6978, 473 }, { 6979, 473 }, { 6980, 473 },
+    { -16310, 826 }, { 6981, 473 }, { 6982, 473 }, { 6983, 473 },
+    { 6984, 473 }, { 6985, 474 }, { 6986, 474 }, { 6987, 474 },
+    { 6988, 474 }, { 6989, 474 }, { 6990, 474 }, { 6991, 474 },
+    { -16016, 1415 }, { 6992, 474 }, { 6994, 474 }, { 6995, 474 },
+    { 6996, 474 }, { 6997, 474 }, { 6998, 474 }, { 6999, 474 },
+    { 7000, 474 }, { -16049, 1401 }, { 7001, 474 }, { 7002, 474 },
+    { 7003, 474 }, { 7004, 474 }, { 7005, 474 }, { 7006, 474 },
+    { 7010, 474 }, { 7009, 474 }, { 7011, 474 }, { 7015, 474 },
+    { 7012, 474 }, { 7013, 474 }, { 7014, 474 }, { 7016, 474 },
+    { 7017, 474 }, { 7018, 474 }, { 7019, 474 }, { 7020, 474 },
+    { 7021, 474 }, { 7022, 474 }, { 7023, 474 }, { 7024, 474 },
+    { 7025, 474 }, { 7026, 474 }, { 7027, 474 }, { -16434, 860 },
+    { 7028, 474 }, { 7029, 474 }, { 7030, 474 }, { 7031, 474 },
+    { 7032, 474 }, { 7033, 474 }, { 7034, 474 }, { 7035, 474 },
+    { 7037, 474 }, { 7039, 474 }, { 7040, 474 }, { 7041, 474 },
+    { 7042, 474 }, { 7045, 474 }, { 7043, 474 }, { 7044, 474 },
+    { 7046, 474 }, { 7047, 474 }, { 7049, 474 }, { 7050, 474 },
+    { 7051, 474 }, { 7052, 475 }, { 7053, 475 }, { 7054, 475 },
+    { 7055, 475 }, { 7057, 475 }, { 7058, 475 }, { 7060, 475 },
+    { 7061, 475 }, { 7062, 475 }, { 9525, 1364 }, { 7063, 475 },
+    { 7064, 475 }, { 7065, 475 }, { 7066, 475 }, { 7067, 475 },
+    { 7068, 475 }, { 7069, 475 }, { 7070, 475 }, { 7073, 475 },
+    { 7074, 475 }, { 7075, 475 }, { 7076, 475 }, { 7078, 475 },
+    { 7079, 475 }, { 7080, 475 }, { 7081, 475 }, { 7082, 475 },
+    { 7083, 475 }, { 7085, 475 }, { 7086, 475 }, { 9684, 961 },
+    { 7087, 475 }, { 7089, 475 }, { 7091, 475 }, { 7093, 475 },
+    { 7094, 475 }, { 7095, 475 }, { 7096, 475 }, { 7097, 475 },
+    { 7098, 475 }, { 7099, 475 }, { 7100, 475 }, { 7101, 475 },
+    { 7102, 475 }, { 7103, 475 }, { 7104, 475 }, { 7105, 475 },
+    { 7106, 475 }, { 7107, 475 }, { 7109, 475 }, { 7110, 475 },
+    { 7111, 475 }, { 7112, 475 }, { 7113, 475 }, { 7114, 475 },
+    { 6886, 475 }, { 7129, 479 }, { 7130, 479 }, { 7131, 479 },
+    { -16445, 964 }, { 7134, 479 }, { 7135, 479 }, { 7136, 479 },
+    { 7137, 479 }, { 7138, 479 }, { 7139, 479 }, { 7140, 479 },
+    { 7141, 479 }, { 7142, 479 }, { 7143, 479 }, { 7144, 479 },
+    { 7145, 479 }, { 7146, 479 }, { 7147, 479 }, { 7148, 479 },
+    { 7149, 479 }, { 7151, 479 }, { 7152, 479 }, { 7153, 479 },
+    { 7154, 479 }, { 7155, 479 }, { 7156, 479 }, { 7157, 479 },
+    { 7158, 479 }, { 7159, 479 }, { 7160, 479 }, { 7161, 479 },
+    { 7162, 479 }, { 7163, 479 }, { 7165, 479 }, { 7164, 479 },
+    { 7166, 480 }, { 7167, 480 }, { 7168, 480 }, { 7169, 480 },
+    { 7170, 480 }, { 7171, 480 }, { 7173, 480 }, { 7174, 480 },
+    { 7175, 480 }, { 7176, 480 }, { 7177, 480 }, { 7179, 480 },
+    { 7181, 480 }, { 7182, 480 }, { 7183, 480 }, { 7184, 480 },
+    { 7185, 480 }, { 9605, 1388 }, { -16067, 1412 }, { 7186, 480 },
+    { 7187, 480 }, { 7188, 480 }, { 7189, 480 }, { 9671, 1427 },
+    { 7190, 480 }, { 7191, 480 }, { 7192, 480 }, { 7193, 480 },
+    { 7194, 480 }, { 7195, 480 }, { 7196, 480 }, { -16449, 965 },
+    { 7197, 480 }, { 7198, 480 }, { 7202, 480 }, { 7199, 480 },
+    { 6969, 480 }, { 7212, 482 }, { 7213, 482 }, { 7546, 516 },
+    { 7778, 516 }, { 7779, 516 }, { 7780, 516 }, { 7781, 516 },
+    { 7782, 516 }, { -7465, 901 }, { 6983, 482 }, { 9623, 1397 },
+    { 7553, 516 }, { -10966, 1122 }, { -14849, 885 }, { 9617, 1397 },
+    { -16453, 966 }, { 7203, 480 }, { 7205, 480 }, { 6974, 480 },
+    { 7784, 516 }, { 8560, 172 }, { 8614, 172 }, { 8646, 172 },
+    { 8624, 172 }, { 8574, 172 }, { 7914, 526 }, { -16457, 967 },
+    { 7215, 482 }, { 7915, 526 }, { 7916, 526 }, { 7917, 526 },
+    { -14474, 1333 }, { 7918, 526 }, { -14860, 888 }, { 7552, 516 },
+    { 7919, 526 }, { 7920, 526 }, { 7786, 516 }, { 7787, 516 },
+    { 7788, 516 }, { 7559, 516 }, { 7924, 526 }, { 7691, 526 },
+    { -16461, 968 }, { 6985, 482 }, { -16465, 1009 }, { 9653, 1415 },
+    { -16480, 1012 }, { 6988, 482 }, { 7560, 516 }, { 7218, 482 },
+    { 7921, 526 }, { 7222, 482 }, { 7223, 482 }, { 7224, 482 },
+    { 9659, 1401 }, { 7225, 482 }, { 7252, 488 }, { 7253, 488 },
+    { 7256, 488 }, { 7258, 488 }, { 9664, 204 }, { 7260, 488 },
+    { 7263, 488 }, { 7265, 488 }, { 7266, 488 }, { 7267, 488 },
+    { 7268, 488 }, { -16469, 1010 }, { 7269, 488 }, { 7270, 488 },
+    { 7275, 488 }, { 7276, 488 }, { 7277, 488 }, { -16491, 222 },
+    { 7278, 488 }, { 7281, 488 }, { 7282, 488 }, { 7284, 488 },
+    { 7286, 488 }, { 7287, 488 }, { 7289, 488 }, { 7290, 488 },
+    { 7291, 489 }, { 7293, 489 }, { 7295, 489 }, { 7296, 489 },
+    { 7297, 489 }, { 7298, 489 }, { 7299, 489 }, { 7300, 489 },
+    { 7301, 489 }, { 7302, 489 }, { 7303, 489 }, { -16495, 223 },
+    { 7304, 489 }, { 7305, 489 }, { 7306, 489 }, { 7307, 489 },
+    { 7308, 489 }, { -16499, 224 }, { 7309, 489 }, { 7310, 489 },
+    { 7311, 489 }, { 7312, 489 }, { 7313, 489 }, { 7314, 489 },
+    { 7315, 489 }, { 7316, 489 }, { -16503, 174 }, { 9719, 537 },
+    { -16527, 543 }, { 7317, 489 }, { 7092, 489 }, { 8538, 720 },
+    { 8513, 720 }, { 8598, 720 }, { 8621, 720 }, { 8637, 720 },
+    { 8667, 720 }, { 8677, 720 }, { 9675, 983 }, { -15868, 1409 },
+    { 7318, 489 }, { 9669, 983 }, { 7320, 489 }, { 7329, 490 },
+    { 7100, 490 }, { 9642, 1451 }, { 9687, 1451 }, { 9679, 1451 },
+    { 9657, 1451 }, { 7331, 490 }, { 7332, 490 }, { 8741, 875 },
+    { 8810, 875 }, { 8816, 875 }, { 8821, 875 }, { 8732, 875 },
+    { 7319, 489 }, { -16531, 545 }, { 7333, 490 }, { 7103, 490 },
+    { 7327, 489 }, { 7328, 489 }, { 7104, 490 }, { -16535, 574 },
+    { 9671, 562 }, { 9671, 575 }, { 7338, 490 }, { 7340, 490 },
+    { 9669, 605 }, { 7341, 490 }, { 7345, 490 }, { 7339, 490 },
+    { 7348, 490 }, { 7342, 490 }, { -16560, 608 }, { 9679, 767 },
+    { 7124, 491 }, { 9682, 774 }, { 7354, 491 }, { 7111, 490 },
+    { 9731, 774 }, { 7151, 493 }, { 7121, 491 }, { 7344, 490 },
+    { 9729, 775 }, { 7357, 491 }, { 7358, 491 }, { 7129, 491 },
+    { -16611, 776 }, { 7126, 491 }, { -16626, 793 }, { 7129, 491 },
+    { 7148, 493 }, { 7346, 490 }, { 7363, 491 }, { -16630, 1430 },
+    { 9700, 1436 }, { 7117, 490 }, { -16615, 789 }, { 7349, 490 },
+    { 7383, 493 }, { 9733, 1452 }, { 7134, 491 }, { 7122, 490 },
+    { 9737, 1453 }, { 9747, 1455 }, { 7135, 491 }, { 9132, 1146 },
+    { 7132, 491 }, { 9165, 1146 }, { 7386, 493 }, { 9152, 1146 },
+    { 9173, 1146 }, { 9694, 1457 }, { 7368, 491 }, { -16777, 1461 },
+    { 7158, 493 }, { 8774, 927 }, { 8873, 927 }, { 8828, 927 },
+    { 8811, 927 }, { 8833, 927 }, { 8829, 927 }, { -16781, 1462 },
+    { 9709, 1464 }, { 7390, 493 }, { -14827, 880 }, { 7391, 493 },
+    { 7170, 494 }, { 9654, 1412 }, { 7164, 493 }, { 7568, 518 },
+    { 7571, 518 }, { 7574, 518 }, { 9705, 1467 }, { 7369, 491 },
+    { 7140, 491 }, { 7174, 494 }, { 7396, 493 }, { 7397, 493 },
+    { 7398, 493 }, { 7805, 518 }, { 7406, 494 }, { 7407, 494 },
+    { 7408, 494 }, { 7191, 496 }, { 7410, 494 }, { 7577, 518 },
+    { -16799, 1471 }, { -16766, 1459 }, { 7210, 496 }, { 7179, 494 },
+    { -16803, 1472 }, { 9707, 1481 }, { 8734, 901 }, { 8805, 901 },
+    { 8822, 901 }, { 8762, 901 }, { 7810, 518 }, { 8780, 901 },
+    { 9144, 1122 }, { 7423, 496 }, { 9156, 1122 }, { 9136, 1122 },
+    { 9566, 885 }, { 7414, 494 }, { 7415, 494 }, { 9758, 1486 },
+    { 7580, 518 }, { 7201, 496 }, { 9381, 1056 }, { 9435, 1056 },
+    { 7186, 494 }, { 9429, 1056 }, { 9383, 1056 }, { 9420, 1056 },
+    { -16908, 1491 }, { 7813, 518 }, { 9514, 1333 }, { 9766, 1474 },
+    { 7586, 518 }, { 7436, 496 }, { 9504, 1333 }, { 7418, 494 },
+    { 9567, 888 }, { 9414, 1293 }, { 9471, 1293 }, { 9471, 1293 },
+    { 7817, 518 }, { 9473, 1293 }, { 9453, 1293 }, { 9769, 1476 },
+    { 9718, 1482 }, { 7437, 496 }, { 7442, 496 }, { 7444, 496 },
+    { 7474, 509 }, { 7475, 509 }, { 7476, 509 }, { 7477, 509 },
+    { 7478, 509 }, { 7479, 509 }, { 7480, 509 }, { 7483, 509 },
+    { -14589, 1377 }, { 7485, 509 }, { 7487, 509 }, { -16964, 1499 },
+    { 7488, 509 }, { 7490, 509 }, { 7492, 509 }, { 7495, 509 },
+    { 9777, 1516 }, { 7497, 509 }, { 9770, 1526 }, { 7498, 509 },
+    { 9692, 1010 }, { 7499, 509 }, { 7500, 509 }, { 7501, 509 },
+    { 7502, 509 }, { 7503, 509 }, { 7504, 509 }, { 7505, 509 },
+    { 7508, 509 }, { 7506, 509 }, { 7507, 509 }, { 7509, 509 },
+    { 7510, 509 }, { 7511, 509 }, { 7512, 509 }, { 7513, 509 },
+    { 7514, 509 }, { 7516, 509 }, { 7518, 509 }, { 7519, 509 },
+    { 7520, 509 }, { 7521, 509 }, { 7522, 509 }, { 7523, 509 },
+    { 7524, 509 }, { 7525, 509 }, { 7526, 509 }, { 7527, 509 },
+    { 7528, 509 }, { 9771, 1528 }, { 7529, 509 }, { 7530, 509 },
+    { 7531, 509 }, { 7532, 509 }, { 7533, 509 }, { 7534, 509 },
+    { 7535, 509 }, { 7536, 509 }, { 7537, 510 }, { 7538, 510 },
+    { 7539, 510 }, { 7540, 510 }, { 7541, 510 }, { 7542, 510 },
+    { 7543, 510 }, { -17054, 1529 }, { 7544, 510 }, { 7545, 510 },
+    { 7546, 510 }, { 7547, 510 }, { 7551, 510 }, { 7552, 510 },
+    { 7553, 510 }, { 9644, 1409 }, { 7554, 510 }, { 7555, 510 },
+    { 7556, 510 }, { 9654, 1409 }, { 9767, 1534 }, { 7557, 510 },
+    { 7559, 510 }, { 7560, 510 }, { -2041, 597 }, { 7561, 510 },
+    { 9776, 1531 }, { 7563, 510 }, { 7564, 510 }, { 7565, 510 },
+    { 9764, 1531 }, { 7566, 510 }, { 7567, 510 }, { 7573, 510 },
+    { 7579, 510 }, { 7581, 510 }, { 7583, 510 }, { 7584, 510 },
+    { 9781, 1540 }, { 7585, 510 }, { 7586, 510 }, { 7587, 510 },
+    { 7588, 510 }, { 7589, 510 }, { 7590, 510 }, { 7591, 510 },
+    { 7592, 510 }, { 7594, 510 }, { 7595, 510 }, { 7596, 510 },
+    { 7597, 510 }, { 7598, 510 }, { 7599, 510 }, { 7600, 510 },
+    { 7603, 510 }, { 7601, 510 }, { 7604, 510 }, { 7605, 510 },
+    { 7607, 510 }, { -17208, 1554 }, { 7608, 510 }, { 7609, 510 },
+    { 7610, 510 }, { 7611, 510 }, { 7612, 511 }, { 7613, 511 },
+    { 7614, 511 }, { -17058, 1530 }, { 7615, 511 }, { 7616, 511 },
+    { 7617, 511 }, { 7618, 511 }, { 7619, 511 }, { 7620, 511 },
+    { 7621, 511 }, { 7622, 511 }, { 7623, 511 }, { -17212, 1559 },
+    { 9733, 789 }, { -17216, 1569 }, { 7624, 511 }, { 7625, 511 },
+    { 7626, 511 }, { 7627, 511 }, { 7628, 511 }, { 7629, 511 },
+    { 7630, 511 }, { 7631, 511 }, { -17244, 1582 }, { 7632, 511 },
+    { 7633, 511 }, { 7634, 511 }, { 9718, 1477 }, { 9771, 1477 },
+    { 7635, 511 }, { 7636, 511 }, { 9817, 1508 }, { 7637, 511 },
+    { 7639, 511 }, { 7640, 511 }, { 7641, 511 }, { 7642, 511 },
+    { 7643, 511 }, { 9515, 880 }, { 7644, 511 }, { 7645, 511 },
+    { 9543, 880 }, { 9826, 1509 }, { 7646, 511 }, { 7647, 511 },
+    { 7648, 511 }, { 7649, 511 }, { 7650, 511 }, { 7651, 511 },
+    { 7652, 511 }, { -17069, 1533 }, { 7653, 511 }, { 7654, 511 },
+    { 7655, 511 }, { 7656, 511 }, { 7658, 511 }, { 7659, 511 },
+    { 7660, 511 }, { 7661, 511 }, { 7662, 511 }, { 9702, 1459 },
+    { 7663, 511 }, { 7664, 512 }, { 7665, 512 }, { 7666, 512 },
+    { -17488, 1510 }, { 7667, 512 }, { 9755, 1472 }, { 7668, 512 },
+    { 7669, 512 }, { -17492, 1517 }, { 7670, 512 }, { 7671, 512 },
+    { -17496, 1518 }, { 7672, 512 }, { 7673, 512 }, { -17524, 1538 },
+    { 7675, 512 }, { 7676, 512 }, { 7677, 512 }, { 7678, 512 },
+    { 7679, 512 }, { 7680, 512 }, { -17552, 1546 }, { 7681, 512 },
+    { 7682, 512 }, { 7683, 512 }, { 7684, 512 }, { -17658, 1571 },
+    { 7685, 512 }, { 7686, 512 }, { 7687, 512 }, { 7688, 512 },
+    { 7689, 512 }, { -17104, 1536 }, { 7690, 512 }, { 7691, 512 },
+    { 7692, 512 }, { 7693, 512 }, { 9790, 1547 }, { 7694, 512 },
+    { 7695, 512 }, { 7696, 512 }, { 9797, 1547 }, { 7697, 512 },
+    { 7698, 512 }, { 7699, 512 }, { 7700, 512 }, { -17662, 1551 },
+    { 7701, 512 }, { 7702, 512 }, { 7703, 512 }, { -16735, 1458 },
+    { 7704, 512 }, { 9825, 1555 }, { 9518, 1377 }, { 7705, 512 },
+    { 9828, 1555 }, { 9493, 1377 }, { 9779, 1488 }, { 9749, 1488 },
+    { 7707, 514 }, { 7708, 514 }, { 7709, 514 }, { 7710, 514 },
+    { 7706, 512 }, { 7712, 514 }, { 7713, 514 }, { 7714, 514 },
+    { 7715, 514 }, { 7716, 514 }, { 7717, 514 }, { 7718, 514 },
+    { 7720, 514 }, { 7719, 514 }, { 7721, 514 }, { 7722, 514 },
+    { 7723, 514 }, { 7724, 514 }, { 7726, 514 }, { 7725, 514 },
+    { 7727, 514 }, { 7728, 514 }, { 7729, 514 }, { 7730, 515 },
+    { 7731, 515 }, { 7740, 515 }, { 7741, 515 }, { 7742, 515 },
+    { 7744, 515 }, { 7745, 515 }, { -6742, 867 }, { 7746, 515 },
+    { 7747, 515 }, { 7748, 515 }, { 7749, 515 }, { 7750, 515 },
+    { 7751, 515 }, { 7752, 515 }, { 7754, 515 }, { 7755, 515 },
+    { 7757, 515 }, { 7758, 515 }, { -17194, 1550 }, { 7759, 515 },
+    { 7760, 515 }, { 7761, 515 }, { 7762, 515 }, { -17679, 1552 },
+    { 7763, 515 }, { 7764, 515 }, { 9697, 1438 }, { 9720, 1438 },
+    { 9746, 1438 }, { -17683, 1572 }, { 7765, 515 }, { 7865, 524 },
+    { 7866, 524 }, { 7867, 524 }, { 7868, 524 }, { 7869, 524 },
+    { 7870, 524 }, { 7876, 524 }, { 7872, 524 }, { 7874, 524 },
+    { 7877, 524 }, { 7878, 524 }, { -17687, 1573 }, { 8308, 597 },
+    { 8375, 597 }, { 8439, 597 }, { 8466, 597 }, { 8497, 597 },
+    { 8530, 597 }, { 7537, 515 }, { 7766, 515 }, { 7773, 515 },
+    { 7774, 515 }, { 7775, 515 }, { 8871, 947 }, { 8939, 947 },
+    { 8918, 947 }, { 8937, 947 }, { 8923, 947 }, { 8950, 947 },
+    { 9769, 1503 }, { 9739, 1503 }, { 7546, 515 }, { 7879, 525 },
+    { 7880, 525 }, { 7881, 525 }, { 7882, 525 }, { 7886, 525 },
+    { 7883, 525 }, { 7887, 525 }, { 7884, 525 }, { 7888, 525 },
+    { 7889, 525 }, { 7890, 525 }, { -17691, 1574 }, { 7891, 525 },
+    { 7892, 525 }, { -17695, 1575 }, { 7894, 525 }, { 7895, 525 },
+    { 7896, 525 }, { -17699, 1576 }, { 7897, 525 }, { 7898, 525 },
+    { -17703, 1577 }, { 7899, 525 }, { 7900, 525 }, { 7901, 525 },
+    { 9734, 1530 }, { 7902, 525 }, { 7903, 525 }, { 7904, 525 },
+    { 7905, 525 }, { 7906, 525 }, { 7907, 525 }, { 7908, 525 },
+    { 7909, 525 }, { 7910, 525 }, { -16877, 1490 }, { 7911, 525 },
+    { -17707, 1595 }, { 7912, 525 }, { 7913, 525 }, { 7928, 528 },
+    { 9797, 1599 }, { 7926, 528 }, { 7927, 528 }, { 7929, 528 },
+    { 7930, 528 }, { 7932, 528 }, { 7933, 528 }, { 7934, 528 },
+    { 7935, 528 }, { 7940, 528 }, { 7942, 528 }, { 7943, 528 },
+    { 7944, 528 }, { -17732, 1613 }, { 7945, 528 }, { 7951, 528 },
+    { 7952, 528 }, { 7955, 528 }, { 9739, 1545 }, { 9793, 1545 },
+    { 7960, 528 }, { 9753, 1545 }, { 7961, 528 }, { 7962, 528 },
+    { -17736, 1160 }, { 7963, 528 }, { 7964, 529 }, { 7965, 529 },
+    { 9708, 1483 }, { 9761, 1483 }, { 7966, 529 }, { 7967, 529 },
+    { 7968, 529 }, { 9762, 1483 }, { 7969, 529 }, { 9762, 1533 },
+    { 7970, 529 }, { 7971, 529 }, { -17740, 1189 }, { 7972, 529 },
+    { -17744, 1192 }, { 7973, 529 }, { 7975, 529 }, { 7976, 529 },
+    { 7977, 529 }, { -17535, 1541 }, { 7978, 529 }, { -17748, 1193 },
+    { 7749, 529 }, { -17752, 1194 }, { 9823, 1204 }, { 7750, 529 },
+    { 7981, 532 }, { 7982, 532 }, { 7983, 532 }, { 7984, 532 },
+    { 7985, 532 }, { 7986, 532 }, { 9823, 1538 }, { 7987, 532 },
+    { 7988, 532 }, { 7989, 532 }, { 7990, 532 }, { 7991, 532 },
+    { 7992, 532 }, { 7993, 532 }, { 7994, 532 }, { 7995, 532 },
+    { 7998, 532 }, { 7999, 532 }, { 8000, 532 }, { 8001, 532 },
+    { 8002, 533 }, { 8005, 533 }, { 8006, 533 }, { 9783, 1536 },
+    { 8008, 533 }, { 8009, 533 }, { 8014, 533 }, { 8015, 533 },
+    { 8016, 533 }, { 9798, 1601 }, { 8017, 533 }, { 8018, 533 },
+    { 8019, 533 }, { 9791, 1601 }, { 9801, 1215 }, { 8020, 533 },
+    { 8021, 533 }, { 8022, 533 }, { 8024, 533 }, { 8025, 533 },
+    { 9844, 1551 }, { 9743, 1458 }, { 8026, 533 }, { 8027, 533 },
+    { 8028, 533 }, { 9751, 1458 }, { 8029, 533 }, { 8030, 533 },
+    { 8031, 533 }, { 8032, 533 }, { 8034, 533 }, { 8035, 533 },
+    { 8036, 533 }, { 8037, 533 }, { 8038, 533 }, { 8039, 533 },
+    { 8040, 533 }, { 8041, 533 }, { 8044, 534 }, { 8042, 533 },
+    { 7813, 533 }, { -17770, 558 }, { -17774, 559 }, { 9796, 578 },
+    { 8046, 534 }, { 8047, 534 }, { -7983, 911 }, { 9039, 1068 },
+    { 8984, 1068 }, { 9049, 1068 }, { 9081, 1068 }, { 9059, 1068 },
+    { 9093, 1068 }, { 9107, 1068 }, { -10299, 1072 }, { -17785, 601 },
+    { -17789, 162 }, { 7818, 534 }, { -17793, 167 }, { 8705, 867 },
+    { 8762, 867 }, { 8781, 867 }, { 8779, 867 }, { 8725, 867 },
+    { 8780, 867 }, { -10702, 1096 }, { 7820, 534 }, { 9819, 151 },
+    { -17804, 1560 }, { 8069, 541 }, { 8070, 541 }, { -11025, 1127 },
+    { 9799, 1550 }, { 9808, 1584 }, { 8071, 541 }, { 8072, 541 },
+    { 8073, 541 }, { -11856, 1164 }, { 7820, 534 }, { 8074, 541 },
+    { 7822, 534 }, { 8075, 541 }, { 8076, 541 }, { 9854, 1592 },
+    { 8077, 541 }, { 8078, 541 }, { 8080, 541 }, { 9801, 1579 },
+    { 8081, 541 }, { 8082, 541 }, { 9795, 1579 }, { 9802, 1579 },
+    { 9856, 1593 }, { 7825, 534 }, { 8083, 541 }, { 8084, 541 },
+    { 8085, 541 }, { -12480, 1179 }, { 8086, 541 }, { 8087, 541 },
+    { 8088, 541 }, { 8090, 541 }, { 8091, 541 }, { 8092, 541 },
+    { 8093, 541 }, { 8094, 541 }, { 8095, 541 }, { 8096, 541 },
+    { 8097, 541 }, { 8098, 541 }, { 9850, 1594 }, { 8100, 541 },
+    { -17863, 1596 }, { 8101, 541 }, { 8102, 541 }, { -17867, 1602 },
+    { 8103, 541 }, { 8105, 541 }, { 8111, 541 }, { 8112, 541 },
+    { -14893, 1370 }, { 8115, 541 }, { 8118, 541 }, { 8119, 541 },
+    { 8121, 541 }, { 9830, 1588 }, { 9802, 1588 }, { 8122, 541 },
+    { 9852, 1605 }, { 8123, 541 }, { 8125, 542 }, { 8126, 542 },
+    { 8127, 542 }, { 8128, 542 }, { 8129, 542 }, { -15905, 1413 },
+    { 9818, 1607 }, { 9860, 1610 }, { -17895, 1614 }, { 8130, 542 },
+    { 8131, 542 }, { 8132, 542 }, { 8134, 542 }, { 8139, 542 },
+    { -18010, 1618 }, { -17002, 1527 }, { 8140, 542 }, { 8141, 542 },
+    { 8143, 542 }, { 8145, 542 }, { 8149, 542 }, { 9711, 1490 },
+    { 9727, 1490 }, { 9745, 1490 }, { -17248, 1586 }, { 8151, 542 },
+    { 8156, 542 }, { 8160, 542 }, { 8163, 542 }, { -17366, 1591 },
+    { 9816, 1625 }, { 8165, 542 }, { 8166, 547 }, { 8167, 547 },
+    { 8169, 547 }, { 8168, 547 }, { 8170, 547 }, { -18038, 1628 },
+    { 8171, 547 }, { 8172, 547 }, { -18042, 1629 }, { 8173, 547 },
+    { 8175, 547 }, { 8176, 547 }, { 8177, 547 }, { 8178, 547 },
+    { 8179, 547 }, { -18014, 1621 }, { 8180, 547 }, { 9855, 1615 },
+    { 8181, 547 }, { 8182, 547 }, { 8183, 547 }, { 9862, 1615 },
+    { 8184, 547 }, { 8185, 547 }, { 8186, 547 }, { 8187, 547 },
+    { 8188, 547 }, { 8189, 547 }, { -18046, 1637 }, { -18064, 1641 },
+    { 8190, 547 }, { 8192, 547 }, { 8193, 547 }, { 8194, 548 },
+    { 8195, 548 }, { 8196, 548 }, { 8197, 548 }, { 8198, 548 },
+    { 8199, 548 }, { 8203, 548 }, { 8204, 548 }, { 8205, 548 },
+    { 8206, 548 }, { 9862, 1642 }, { 8207, 548 }, { 9800, 1541 },
+    { 8208, 548 }, { 8209, 548 }, { -18078, 1651 }, { 8210, 548 },
+    { 9654, 1446 }, { 9686, 1446 }, { 9683, 1446 }, { 8213, 548 },
+    { 9692, 1446 }, { 8215, 548 }, { 8216, 548 }, { 8249, 551 },
+    { 8217, 548 }, { 8250, 551 }, { 8218, 548 }, { -18102, 1652 },
+    { 8219, 548 }, { 9867, 1658 }, { -18113, 1659 }, { 8017, 551 },
+    { -18124, 1662 }, { 8220, 548 }, { 8221, 548 }, { 8252, 551 },
+    { 8222, 548 }, { 8223, 548 }, { 8224, 548 }, { 8225, 548 },
+    { 8227, 548 }, { 8228, 548 }, { 8229, 548 }, { 8230, 548 },
+    { 8022, 551 }, { -18128, 1672 }, { 8231, 548 }, { 8261, 553 },
+    { -18132, 1673 }, { 8232, 548 }, { 8263, 553 }, { 8264, 553 },
+    { 8265, 553 }, { 8266, 553 }, { 8267, 553 }, { 8268, 553 },
+    { 8269, 553 }, { 8270, 553 }, { 8271, 553 }, { 8272, 553 },
+    { 8233, 548 }, { 9022, 1091 }, { 9147, 1091 }, { 9141, 1091 },
+    { 9071, 1091 }, { 9145, 1091 }, { 9136, 1091 }, { -18136, 1190 },
+    { -18140, 1218 }, { 8254, 551 }, { -19818, 1242 }, { 8026, 551 },
+    { 8273, 553 }, { 8274, 553 }, { 8275, 553 }, { 9879, 1239 },
+    { 9836, 1239 }, { -20154, 1251 }, { 8276, 553 }, { 8816, 911 },
+    { 8889, 911 }, { 8862, 911 }, { 8856, 911 }, { 8896, 911 },
+    { 8813, 911 }, { -20345, 1657 }, { 9784, 1519 }, { 9796, 1519 },
+    { 9050, 1072 }, { 9021, 1072 }, { 9824, 1519 }, { 9099, 1072 },
+    { 9019, 1072 }, { 9226, 1152 }, { 9204, 1152 }, { 9186, 1152 },
+    { 9183, 1152 }, { 9210, 1152 }, { 9030, 1096 }, { 9161, 1096 },
+    { 9114, 1096 }, { 9080, 1096 }, { 9041, 1096 }, { -20363, 1667 },
+    { 9124, 1127 }, { 9199, 1127 }, { 9193, 1127 }, { 9235, 1127 },
+    { 9216, 1127 }, { 9263, 1127 }, { 9172, 1164 }, { 9234, 1164 },
+    { 9229, 1164 }, { -20367, 1668 }, { -20371, 1670 }, { 9202, 1164 },
+    { 9226, 1168 }, { 9240, 1168 }, { 9241, 1168 }, { 9261, 1168 },
+    { 9269, 1168 }, { 9242, 1175 }, { 9297, 1175 }, { 9326, 1175 },
+    { 9274, 1175 }, { 9309, 1175 }, { 9306, 1175 }, { -20375, 1671 },
+    { 9945, 1674 }, { -20410, 1676 }, { 9230, 1179 }, { 9324, 1179 },
+    { 9255, 1179 }, { 9310, 1179 }, { 9327, 1179 }, { 9311, 1179 },
+    { 9309, 1211 }, { 9351, 1211 }, { 9385, 1211 }, { 9355, 1211 },
+    { 9373, 1211 }, { 9362, 1211 }, { 9390, 1278 }, { 9401, 1278 },
+    { 9393, 1278 }, { 9407, 1278 }, { 9381, 1278 }, { 9478, 1296 },
+    { 9462, 1296 }, { 9473, 1296 }, { 9487, 1296 }, { 9498, 1296 },
+    { 9917, 1679 }, { 9520, 1370 }, { 9581, 1370 }, { 9571, 1370 },
+    { 9594, 1370 }, { 9584, 1370 }, { 9601, 1370 }, { 9551, 1396 },
+    { 9634, 1396 }, { 9644, 1396 }, { 9616, 1396 }, { 9617, 1396 },
+    { 9638, 1396 }, { -20428, 1681 }, { -20432, 1682 }, { 9963, 1690 },
+    { 9611, 1413 }, { 9657, 1413 }, { 9619, 1413 }, { 9669, 1413 },
+    { 9669, 1413 }, { 9654, 831 }, { 9924, 1706 }, { 9696, 831 },
+    { 9702, 831 }, { 9713, 831 }, { 9675, 831 }, { 9779, 1527 },
+    { 9777, 1527 }, { 9967, 1244 }, { 9755, 1527 }, { 9967, 623 },
+    { 9856, 1244 }, { -20464, 631 }, { 9972, 643 }, { 9749, 1586 },
+    { 9803, 1586 }, { -20475, 1683 }, { 9775, 1586 }, { 9807, 1586 },
+    { 9770, 1586 }, { 9812, 1591 }, { 9797, 1591 }, { 9770, 1591 },
+    { -20521, 1685 }, { 9818, 1591 }, { 9788, 1557 }, { 9807, 1557 },
+    { 9777, 1557 }, { 9830, 1557 }, { 9837, 1557 }, { 9812, 1616 },
+    { 9813, 1616 }, { 9831, 1240 }, { 9882, 1240 }, { 9824, 1616 },
+    { 9872, 1616 }, { 9849, 1240 }, { 9901, 1240 }, { -20525, 1686 },
+    { -20577, 1700 }, { 9993, 1704 }, { 9862, 1621 }, { 9826, 1238 },
+    { 9885, 1238 }, { 9939, 1238 }, { 9997, 1238 }, { 10050, 1238 },
+    { 10091, 1238 }, { 10002, 1707 }, { -20595, 1715 }, { -20632, 1720 },
+    { 9832, 1637 }, { 9876, 1655 }, { 10087, 1655 }, { 9943, 1655 },
+    { 9915, 1655 }, { 9929, 1655 }, { 9960, 1655 }, { 9952, 1687 },
+    { 9952, 1687 }, { 9981, 1687 }, { -20673, 1725 }, { 10007, 1687 },
+    { 9970, 1687 }, { -20677, 1730 }, { 9975, 1736 }, { -20691, 1740 },
+    { -20722, 1741 }, { 10055, 1619 }, { -20841, 1623 }, { 10015, 1630 },
+    { 9864, 1651 }, { -20747, 1603 }, { -20765, 1604 }, { -20797, 1606 },
+    { 10014, 1626 }, { 10064, 1626 }, { 10090, 1626 }, { 10076, 1626 },
+    { 10063, 1634 }, { -20928, 1644 }, { 10035, 1645 }, { -21334, 1705 },
+    { 10050, 1701 }, { 10064, 1701 }, { 10086, 1712 }, { 9820, 1659 },
+    { 10081, 1701 }, { 10072, 1702 }, { 10139, 1702 }, { 10142, 1702 },
+    { 10116, 1702 }, { 10157, 1702 }, { 10146, 1702 }, { 10034, 1709 },
+    { 10103, 1709 }, { 10055, 1717 }, { 10114, 1719 }, { -21389, 1722 },
+    { 10119, 1724 }, { 10072, 1734 }, { 10090, 1734 }, { 10117, 1734 },
+    { 10130, 1756 }, { 10084, 1484 }, { -22606, 1487 }, { 10155, 1484 },
+    { 10114, 1484 }, { 10153, 1484 }, { 10161, 1484 }, { -22610, 1496 },
+    { 10150, 1504 }, { 10113, 1506 }, { 10117, 1513 }, { -22676, 1520 },
+    { 10173, 1524 }, { 10164, 1506 }, { -22711, 1543 }, { -22715, 1743 },
+    { -22740, 1744 }, { -22744, 1745 }, { -22748, 1746 }, { -22752, 1747 },
+    { -22756, 1748 }, { -22760, 1749 }, { 10129, 1757 }, { 9859, 1242 },
+    { 10066, 1242 }, { 9927, 1242 }, { 9917, 1242 }, { 9914, 1242 },
+    { 9885, 1242 }, { 10172, 1761 }, { -22794, 1771 }, { 9858, 1251 },
+    { 10151, 1772 }, { 10184, 1780 }, { 9920, 1251 }, { 9926, 1251 },
+    { 10130, 1782 }, { 10149, 1782 }, { 10187, 1785 }, { 9927, 1657 },
+    { 10193, 1786 }, { -22858, 1802 }, { -22862, 1803 }, { -22866, 1806 },
+    { 10166, 1759 }, { -22877, 1768 }, { -22894, 1775 }, { 10150, 1778 },
+    { 10153, 1804 }, { 10204, 1805 }, { -22945, 1808 }, { -22987, 1813 },
+    { 10164, 1804 }, { -22956, 1811 }, { -22991, 1814 }, { -22995, 1815 },
+    { -22999, 1816 }, { -23003, 1817 }, { -23007, 1818 }, { 10208, 1733 },
+    { 10219, 1738 }, { 10221, 1752 }, { -23052, 1758 }, { 10211, 1752 },
+    { 10220, 1760 }, { -23066, 1763 }, { -23070, 1764 }, { -23098, 1765 },
+    { -23102, 1767 }, { 10184, 1770 }, { 10200, 1776 }, { 10228, 1770 },
+    { 10189, 1787 }, { 10206, 1789 }, { -23141, 1792 }, { -23159, 1821 },
+    { -23163, 1822 }, { -23167, 1823 }, { -23171, 1825 }, { -23175, 1826 },
+    { -23179, 1827 }, { 9939, 1671 }, { -23183, 1828 }, { -23187, 1829 },
+    { 10232, 1833 }, { 9918, 1671 }, { 10206, 1834 }, { 9956, 1676 },
+    { 10223, 1339 }, { 10235, 1346 }, { 10236, 1362 }, { -23262, 1363 },
+    { -23266, 1367 }, { 10212, 1346 }, { -23270, 1369 }, { -23274, 1394 },
+    { 10238, 142 }, { -23308, 147 }, { 10217, 838 }, { -23319, 847 },
+    { -23323, 848 }, { -23327, 850 }, { 10237, 893 }, { -23345, 1830 },
+    { -23349, 1835 }, { -23353, 1839 }, { 10239, 1840 }, { 10248, 1841 },
+    { -23394, 1847 }, { 10241, 1866 }, { -23398, 1848 }, { -23436, 1868 },
+    { -23447, 1871 }, { 10243, 1876 }, { -23471, 1879 }, { 10253, 1887 },
+    { 10226, 1876 }, { 10203, 1850 }, { 10249, 1850 }, { 10254, 1850 },
+    { 9963, 1682 }, { 10253, 1851 }, { 10260, 1861 }, { 10257, 1861 },
+    { -23752, 1867 }, { 10235, 1861 }, { 10262, 1861 }, { 10265, 1863 },
+    { 10227, 1863 }, { 10218, 1864 }, { 10248, 1864 }, { 10268, 1864 },
+    { 10226, 1864 }, { 10276, 1864 }, { 10260, 1864 }, { 10283, 1869 },
+    { 10280, 1869 }, { 10254, 1869 }, { 10250, 1869 }, { 10270, 1869 },
+    { 10261, 1877 }, { 10247, 1880 }, { -24120, 1889 }, { 9978, 1683 },
+    { -24124, 1891 }, { -24128, 1892 }, { 9974, 1683 }, { 9983, 1683 },
+    { 10249, 1874 }, { 10297, 1874 }, { 10282, 1874 }, { 10295, 1874 },
+    { 10281, 1874 }, { 10264, 1874 }, { -24132, 1893 }, { -24143, 1894 },
+    { 10291, 1897 }, { -24154, 1898 }, { 10263, 1904 }, { 10289, 1907 },
+    { 10308, 1907 }, { 10318, 1913 }, { 10328, 1908 }, { 10295, 1910 },
+    { 10312, 1910 }, { 10323, 1912 }, { 10322, 1910 }, { 10275, 1914 },
+    { 9999, 1686 }, { 10313, 1914 }, { 10332, 1914 }, { 10341, 1915 },
+    { 10337, 1915 }, { 10325, 1915 }, { 10314, 1915 }, { 9972, 1715 },
+    { 10009, 1715 }, { 9983, 1720 }, { 9970, 1720 }, { -24346, 1917 },
+    { -24350, 1918 }, { -24354, 1922 }, { -24358, 1923 }, { -24362, 1924 },
+    { -24366, 1925 }, { -24377, 1927 }, { -24388, 1928 }, { 10338, 1934 },
+    { 10314, 1934 }, { 10302, 1940 }, { 10296, 1944 }, { 10303, 1948 },
+    { 10348, 1954 }, { 9989, 1740 }, { 10032, 1741 }, { 10020, 1740 },
+    { 10025, 1740 }, { 10346, 1932 }, { 9978, 1603 }, { 9989, 1603 },
+    { 10046, 1604 }, { 10050, 1606 }, { 10022, 1604 }, { 10035, 1606 },
+    { 10356, 1952 }, { -24489, 1935 }, { 10317, 1952 }, { 10309, 1936 },
+    { 10337, 1938 }, { 10370, 1939 }, { 10347, 1939 }, { 10319, 1939 },
+    { 10352, 1949 }, { 10350, 1939 }, { 10366, 1950 }, { 10376, 1953 },
+    { 10357, 1955 }, { 10378, 1958 }, { 10349, 1950 }, { -24626, 1961 },
+    { -24630, 1964 }, { -24634, 1965 }, { -24638, 1967 }, { -24642, 1968 },
+    { -24646, 1969 }, { -24657, 1970 }, { -24668, 1971 }, { 10376, 1974 },
+    { 10335, 1975 }, { 10380, 1976 }, { 10381, 1990 }, { 10373, 1990 },
+    { 10376, 1990 }, { 10397, 1990 }, { 10349, 1992 }, { 10344, 1993 },
+    { 10394, 1993 }, { -24802, 1972 }, { 10370, 1993 }, { 10385, 1982 },
+    { 10373, 1987 }, { 10388, 1987 }, { -24907, 1996 }, { -24911, 1997 },
+    { -24915, 1999 }, { 10174, 1520 }, { -24919, 2000 }, { -24923, 2001 },
+    { 10150, 1743 }, { 10177, 1743 }, { -24927, 2002 }, { -24931, 2003 },
+    { -24935, 2004 }, { -24939, 2005 }, { -24943, 2006 }, { -24947, 2007 },
+    { 10399, 2017 }, { 10386, 2031 }, { 10406, 2009 }, { 10413, 2031 },
+    { 10402, 2012 }, { 10358, 2016 }, { 10392, 2018 }, { -25059, 2033 },
+    { -25077, 2034 }, { -25081, 2036 }, { -25085, 2037 }, { -25117, 2038 },
+    { 10401, 2056 }, { 10430, 2057 }, { 10402, 2019 }, { 10392, 2025 },
+    { 10391, 2042 }, { -25134, 2049 }, { 10408, 2044 }, { 10435, 2047 },
+    { 10199, 1768 }, { -25232, 2058 }, { 10182, 1775 }, { -25236, 2059 },
+    { -25240, 2062 }, { 10205, 1808 }, { -25244, 2063 }, { 10152, 1811 },
+    { 10194, 1811 }, { 10190, 1811 }, { -25248, 2065 }, { -25252, 2067 },
+    { 10395, 1403 }, { 10426, 1420 }, { 10385, 1428 }, { 10428, 1429 },
+    { 10391, 1432 }, { -25321, 1448 }, { -25325, 1450 }, { 10439, 1429 },
+    { -25329, 2068 }, { 10192, 1764 }, { -25333, 2069 }, { 10220, 1764 },
+    { 10210, 1764 }, { -25337, 2070 }, { -25341, 2073 }, { 10419, 2079 },
+    { 10427, 2083 }, { 10449, 2104 }, { 10431, 2112 }, { 10182, 1792 },
+    { 10218, 1792 }, { 10395, 2113 }, { 10399, 2113 }, { -25396, 2126 },
+    { 10444, 2129 }, { -25407, 2020 }, { -25418, 2021 }, { -25422, 2022 },
+    { -25457, 2024 }, { -25433, 2023 }, { -25461, 2026 }, { 10435, 2055 },
+    { 10458, 2061 }, { 10431, 2072 }, { -25499, 1643 }, { 10452, 1646 },
+    { 10449, 2072 }, { -25510, 1656 }, { 10215, 1394 }, { 10436, 1665 },
+    { 10244, 1394 }, { 10454, 1669 }, { 10416, 1675 }, { 10453, 1669 },
+    { 10215, 850 }, { 10452, 1680 }, { -25565, 1692 }, { 10189, 1839 },
+    { -25569, 1694 }, { -25573, 1695 }, { -25577, 1697 }, { 10244, 1839 },
+    { 10218, 1848 }, { 10233, 1848 }, { 10446, 681 }, { 10415, 694 },
+    { 10209, 1868 }, { -25598, 711 }, { 10463, 715 }, { 10422, 719 },
+    { -25633, 990 }, { 10469, 1026 }, { 10467, 719 }, { 10424, 1019 },
+    { 10453, 1019 }, { 10220, 1867 }, { 10276, 1867 }, { 10275, 1867 },
+    { 10422, 1029 }, { 10472, 1031 }, { 10457, 1034 }, { 10430, 2064 },
+    { 10474, 1034 }, { -25713, 2071 }, { 10477, 2076 }, { 10446, 2084 },
+    { -25754, 2086 }, { 10437, 2093 }, { 10481, 2084 }, { 10435, 2094 },
+    { 10469, 2097 }, { 10486, 2103 }, { -25793, 2107 }, { 10483, 2094 },
+    { 10493, 2109 }, { 10489, 2111 }, { 10492, 2114 }, { 10485, 2109 },
+    { 10444, 2106 }, { 10507, 2106 }, { -25904, 2110 }, { -25908, 2118 },
+    { 10452, 2122 }, { 10509, 2122 }, { 10532, 2122 }, { 10521, 2122 },
+    { 10581, 2122 }, { 10552, 2122 }, { -26497, 2140 }, { 10306, 1893 },
+    { 10484, 2142 }, { -26514, 2144 }, { 10501, 2147 }, { 10504, 2147 },
+    { 10487, 2149 }, { 10454, 2156 }, { 10511, 2156 }, { 10513, 2160 },
+    { 10458, 2117 }, { 10471, 2117 }, { 10467, 2121 }, { 10508, 2127 },
+    { 10522, 2131 }, { 10468, 2127 }, { 10505, 2139 }, { -26668, 2148 },
+    { 10578, 2153 }, { 10518, 2153 }, { 10505, 2165 }, { -26782, 2155 },
+    { -26838, 2170 }, { -26859, 2171 }, { 10593, 1878 }, { -26979, 1884 },
+    { -27057, 1919 }, { -27061, 1921 }, { 10337, 1925 }, { 10336, 1927 },
+    { 10504, 1865 }, { 10558, 1865 }, { 10555, 1865 }, { 10524, 1873 },
+    { 10591, 1865 }, { 10561, 1873 }, { 10583, 1873 }, { 10590, 1873 },
+    { 10585, 1890 }, { 10604, 1896 }, { 10581, 1896 }, { 10538, 1890 },
+    { 10593, 1896 }, { 10572, 1896 }, { 10600, 2158 }, { -27092, 2166 },
+    { -27177, 2174 }, { -27103, 2173 }, { 10306, 1935 }, { -27181, 2175 },
+    { 10355, 1935 }, { 10338, 1935 }, { 10316, 1935 }, { -27185, 2176 },
+    { -27209, 2177 }, { 10604, 2181 }, { 10609, 2185 }, { 10607, 2195 },
+    { 10620, 2201 }, { 10620, 2202 }, { 10572, 2217 }, { -27258, 887 },
+    { 10629, 902 }, { 10603, 908 }, { 10610, 908 }, { -27306, 924 },
+    { 10622, 937 }, { 10631, 908 }, { 10331, 1969 }, { 10617, 958 },
+    { 10586, 977 }, { 10597, 979 }, { 10342, 1970 }, { 10628, 979 },
+    { 10634, 979 }, { 10650, 979 }, { 10627, 991 }, { 10591, 981 },
+    { 10652, 2184 }, { 10652, 2200 }, { 10607, 981 }, { 10389, 1972 },
+    { 10636, 981 }, { 10620, 2213 }, { 10345, 1972 }, { 10390, 1972 },
+    { 10642, 2179 }, { 10667, 2214 }, { 10641, 2179 }, { 10603, 2180 },
+    { 10656, 2180 }, { 10658, 2180 }, { 10650, 2198 }, { 10620, 2215 },
+    { 10640, 2198 }, { 10671, 2211 }, { 10647, 2211 }, { -27726, 2218 },
+    { -27998, 2219 }, { 10655, 2211 }, { 10382, 2007 }, { 10625, 2220 },
+    { 10665, 2220 }, { 10677, 2220 }, { 10671, 2220 }, { 10679, 2220 },
+    { -27967, 2229 }, { 10365, 2033 }, { -28043, 2222 }, { -28012, 2221 },
+    { 10409, 2037 }, { 10394, 2033 }, { 10380, 2037 }, { 10413, 2037 },
+    { -28047, 2225 }, { 10383, 2038 }, { 10370, 2049 }, { 10372, 2049 },
+    { 10626, 2223 }, { 10680, 2223 }, { 10680, 2223 }, { 10689, 2223 },
+    { 10650, 2223 }, { 10694, 2223 }, { 10645, 2233 }, { 10709, 2233 },
+    { 10653, 2235 }, { 10666, 2236 }, { 10714, 2247 }, { 10671, 2249 },
+    { 10706, 2250 }, { 10706, 2236 }, { 10693, 2251 }, { -28149, 2252 },
+    { -28160, 2256 }, { -28171, 2259 }, { -28185, 2260 }, { 10675, 2266 },
+    { -28203, 2267 }, { 10717, 2282 }, { 10735, 2282 }, { 10704, 2266 },
+    { 10682, 2281 }, { 10740, 2281 }, { 10740, 2281 }, { 10699, 2281 },
+    { 10738, 2281 }, { 10739, 2281 }, { -28496, 2258 }, { -28500, 2261 },
+    { 10707, 2280 }, { 10715, 2285 }, { 10701, 2286 }, { 10706, 2286 },
+    { 10738, 2280 }, { -28564, 2287 }, { -28568, 2291 }, { 10451, 2020 },
+    { -28572, 2292 }, { -28583, 2294 }, { -28587, 2297 }, { -28591, 2299 },
+    { 10445, 2023 }, { 10443, 2022 }, { 10450, 2023 }, { -28595, 2300 },
+    { -28599, 2302 }, { 10709, 2304 }, { 10749, 2311 }, { 10755, 1390 },
+    { 10758, 1393 }, { 10728, 1393 }, { -28641, 1402 }, { -28673, 1406 },
+    { 10745, 1423 }, { 10733, 1425 }, { -28694, 1435 }, { -28698, 2298 },
+    { -28702, 2303 }, { -28706, 2305 }, { -28752, 2306 }, { -28770, 2308 },
+    { -28785, 2310 }, { -28756, 2307 }, { -28774, 2309 }, { -28789, 2312 },
+    { -28793, 2313 }, { -28918, 2360 }, { -28804, 2315 }, { -28822, 2320 },
+    { 10789, 2321 }, { 10764, 2321 }, { 10738, 2331 }, { 10791, 2331 },
+    { -28867, 2353 }, { 10780, 2358 }, { 10780, 2238 }, { 10793, 2358 },
+    { 10799, 2358 }, { 10780, 2241 }, { 10803, 2248 }, { 10754, 2253 },
+    { -28960, 2268 }, { -28964, 2269 }, { -28968, 2270 }, { 10426, 2071 },
+    { -28979, 2271 }, { -28983, 2272 }, { -28987, 2273 }, { -28998, 2274 },
+    { -29002, 2275 }, { -29006, 2276 }, { -29010, 2277 }, { 10443, 2107 },
+    { 10455, 2107 }, { 10758, 1213 }, { 10440, 2107 }, { 10784, 1213 },
+    { -29028, 1250 }, { 10762, 1252 }, { 10814, 1259 }, { 10799, 1260 },
+    { 10771, 1260 }, { -29074, 1272 }, { -29078, 2087 }, { -29082, 2089 },
+    { 10815, 2096 }, { 10779, 2105 }, { 10797, 2130 }, { 10796, 2133 },
+    { 10803, 2145 }, { -29224, 2152 }, { 10821, 2164 }, { 10497, 2144 },
+    { 10766, 2136 }, { 10813, 2136 }, { 10798, 2136 }, { 10805, 2136 },
+    { 10792, 2136 }, { 10814, 2136 }, { -29235, 2182 }, { -29239, 2183 },
+    { -29243, 2187 }, { -29247, 2196 }, { 10808, 2199 }, { 10812, 632 },
+    { 10475, 2148 }, { 10476, 2148 }, { 10517, 2148 }, { 10782, 648 },
+    { 10526, 2148 }, { 10534, 2155 }, { 10496, 2155 }, { -29307, 682 },
+    { 10540, 2155 }, { 10537, 2155 }, { 10553, 2170 }, { -29311, 745 },
+    { -29315, 748 }, { 10575, 1921 }, { -29319, 749 }, { -29323, 750 },
+    { 10784, 781 }, { -29334, 652 }, { -29338, 656 }, { -29342, 657 },
+    { 10834, 1033 }, { 10808, 1033 }, { -29367, 1042 }, { 10832, 1033 },
+    { -29405, 1047 }, { -29409, 1049 }, { 10840, 1053 }, { -29420, 877 },
+    { -29424, 889 }, { 10601, 2166 }, { 10555, 2173 }, { 10589, 2173 },
+    { 10611, 2173 }, { 10614, 2173 }, { 10585, 2173 }, { 10561, 2173 },
+    { -29428, 897 }, { -29432, 900 }, { -29436, 175 }, { -29440, 1138 },
+    { 10613, 2176 }, { -29444, 1140 }, { -29448, 1143 }, { 10790, 1154 },
+    { 10817, 1154 }, { 10825, 1154 }, { 10853, 1154 }, { 10838, 1162 },
+    { 10829, 1154 }, { 10841, 1326 }, { 10838, 1349 }, { 10847, 1371 },
+    { 10842, 1348 }, { 10841, 1326 }, { 10838, 1348 }, { 10831, 1348 },
+    { 10851, 1352 }, { 10846, 1352 }, { 10863, 1373 }, { -29631, 1374 },
+    { -29635, 2316 }, { -29639, 2322 }, { -29643, 2326 }, { -29661, 2333 },
+    { -29665, 2334 }, { 10825, 2337 }, { -29676, 2341 }, { -29680, 2348 },
+    { -29684, 2367 }, { 10819, 2370 }, { 10858, 2378 }, { -29721, 2342 },
+    { -29738, 2343 }, { 10823, 2354 }, { 10865, 2354 }, { 10868, 2356 },
+    { 10871, 2359 }, { 10870, 2354 }, { -29777, 2362 }, { 10844, 2364 },
+    { -29794, 2366 }, { 10871, 2368 }, { -29819, 2374 }, { 10873, 2384 },
+    { 10630, 2218 }, { 10679, 2219 }, { -29837, 2394 }, { -29841, 2197 },
+    { -29845, 2210 }, { -29856, 2224 }, { 10887, 2226 }, { 10665, 2229 },
+    { 10641, 2229 }, { 10689, 2221 }, { -29867, 2231 }, { -29871, 2240 },
+    { 10880, 2246 }, { 10677, 2221 }, { 10662, 2225 }, { 10884, 2242 },
+    { 10869, 2242 }, { 10864, 1532 }, { -29955, 1537 }, { 10886, 2242 },
+    { 10898, 1562 }, { 10886, 1563 }, { 10919, 2389 }, { -30015, 1539 },
+    { -30195, 2395 }, { -30046, 1566 }, { -30081, 1587 }, { 10901, 2372 },
+    { 10870, 2372 }, { 10890, 2372 }, { -30267, 2399 }, { 10918, 2372 },
+    { 10867, 2373 }, { 10671, 2252 }, { 10694, 2256 }, { 10921, 2373 },
+    { -30199, 2397 }, { 10674, 2267 }, { 10696, 2267 }, { 10704, 2259 },
+    { 10728, 2267 }, { -30271, 2400 }, { -30282, 2401 }, { -30286, 2402 },
+    { -30290, 2403 }, { -30294, 2405 }, { -30298, 2406 }, { 10882, 2415 },
+    { 10932, 2423 }, { 10912, 2421 }, { 10879, 2427 }, { 10926, 2415 },
+    { 10906, 2421 }, { 10894, 2381 }, { 10926, 2398 }, { 10884, 2404 },
+    { -30365, 2407 }, { 10933, 2410 }, { 10706, 2292 }, { 10930, 2411 },
+    { 10911, 2411 }, { 10915, 2410 }, { 10891, 2417 }, { 10945, 2417 },
+    { 10928, 2417 }, { 10935, 2417 }, { 10950, 2417 }, { 10928, 2417 },
+    { -30507, 2419 }, { 10956, 2426 }, { 10913, 2428 }, { 10719, 1402 },
+    { 10762, 1402 }, { 10747, 1402 }, { -30548, 2431 }, { -30552, 2432 },
+    { -30556, 2433 }, { -30560, 2435 }, { -30564, 2436 }, { 10774, 2305 },
+    { 10753, 2305 }, { 10738, 2305 }, { 10777, 2305 }, { 10770, 2307 },
+    { -30575, 2437 }, { 10753, 2309 }, { -30579, 2438 }, { 10760, 2313 },
+    { 10733, 2315 }, { 10758, 2315 }, { 10762, 2320 }, { -30602, 2439 },
+    { -30606, 2186 }, { 10908, 2189 }, { -30617, 2203 }, { 10953, 2212 },
+    { 10954, 2208 }, { 10789, 2353 }, { 10968, 2208 }, { 10960, 2227 },
+    { 10974, 2227 }, { -30739, 2245 }, { 10911, 2440 }, { -30757, 2442 },
+    { 10755, 2270 }, { 10962, 2440 }, { -30761, 2444 }, { -30772, 2445 },
+    { -30776, 2446 }, { 10779, 2273 }, { -30780, 2447 }, { -30784, 2449 },
+    { -30788, 2450 }, { -30792, 2452 }, { -30796, 2453 }, { -30800, 2454 },
+    { -30804, 2456 }, { -30822, 2457 }, { -30826, 2458 }, { 10760, 1250 },
+    { -30837, 2459 }, { 10930, 2480 }, { 10811, 1250 }, { 10971, 2480 },
+    { 10929, 2481 }, { 10970, 2481 }, { 10974, 2481 }, { 10959, 2485 },
+    { -30932, 2462 }, { 10977, 2485 }, { 10937, 2494 }, { 10937, 2494 },
+    { 10938, 2494 }, { 10999, 2468 }, { 11001, 2468 }, { 10950, 2472 },
+    { 11014, 2472 }, { 10987, 2472 }, { 10994, 2472 }, { 10971, 2472 },
+    { -31237, 2487 }, { -31241, 2489 }, { -31245, 2490 }, { -31249, 2491 },
+    { -31253, 2492 }, { -31257, 2493 }, { -31261, 2495 }, { -31265, 2496 },
+    { -31269, 2498 }, { -31273, 2499 }, { -31277, 2500 }, { -31281, 2501 },
+    { 10990, 2510 }, { 11000, 2511 }, { 10965, 2516 }, { 10966, 2471 },
+    { 11014, 2471 }, { 10976, 2471 }, { 10996, 2471 }, { 11001, 2471 },
+    { 10980, 2482 }, { 11030, 2488 }, { 11015, 2504 }, { 11001, 2514 },
+    { 11026, 2504 }, { 11034, 2514 }, { 11046, 2515 }, { 11005, 2518 },
+    { 10839, 1042 }, { 10817, 1042 }, { 11001, 2520 }, { 10995, 2520 },
+    { 10994, 2522 }, { -31497, 2523 }, { 11025, 2522 }, { -31514, 2525 },
+    { -31518, 2526 }, { -31522, 2527 }, { -31526, 2529 }, { -31530, 2530 },
+    { -31534, 2533 }, { -31538, 2535 }, { -31542, 2536 }, { 11051, 2545 },
+    { -31553, 2554 }, { 11050, 2560 }, { 11062, 931 }, { 11030, 933 },
+    { 11012, 940 }, { 10792, 1143 }, { 11008, 2569 }, { 11066, 2569 },
+    { 11053, 2569 }, { 11067, 2569 }, { 11075, 2569 }, { 11078, 2569 },
+    { 11083, 955 }, { -31993, 971 }, { -31997, 972 }, { -32001, 973 },
+    { -32005, 975 }, { -32009, 976 }, { 11069, 1001 }, { 11061, 1020 },
+    { 11088, 2528 }, { 11092, 2542 }, { -32041, 2548 }, { 10810, 2326 },
+    { -32045, 2551 }, { -32049, 2555 }, { -32053, 2557 }, { 10870, 2326 },
+    { -32057, 2558 }, { -32087, 2559 }, { -32091, 2561 }, { 10852, 2367 },
+    { -32095, 2562 }, { -32099, 2563 }, { -32103, 2565 }, { -32107, 2566 },
+    { 11086, 1144 }, { 10859, 2342 }, { 11061, 1161 }, { 11096, 1161 },
+    { 11090, 1163 }, { -32160, 1178 }, { 11048, 1185 }, { -32171, 2567 },
+    { -32175, 2568 }, { -32186, 2572 }, { -32190, 2574 }, { -32194, 2589 },
+    { 11109, 2606 }, { 11063, 2607 }, { -32245, 2613 }, { 11101, 546 },
+    { -32256, 556 }, { 11109, 585 }, { 10886, 2210 }, { 11113, 569 },
+    { 11112, 585 }, { -32281, 586 }, { -32285, 587 }, { 11114, 2540 },
+    { -32296, 2543 }, { -32341, 2573 }, { -32345, 2575 }, { 11118, 2576 },
+    { 10888, 1537 }, { 10887, 1537 }, { 10853, 1537 }, { 10840, 1537 },
+    { 10876, 1537 }, { 10844, 1539 }, { 10851, 1566 }, { 10885, 1566 },
+    { -32366, 2581 }, { 10862, 1587 }, { 10901, 1566 }, { 10886, 1566 },
+    { 11073, 2571 }, { 11121, 2571 }, { 11088, 2571 }, { 11122, 2571 },
+    { -32377, 2590 }, { 10869, 2397 }, { 10921, 2397 }, { 10919, 2397 },
+    { -32381, 2591 }, { 10917, 2397 }, { -32385, 2586 }, { 11109, 2592 },
+    { -32396, 2595 }, { 11110, 2604 }, { -32407, 2608 }, { 10928, 2400 },
+    { -32418, 2614 }, { -32422, 2615 }, { 11133, 2632 }, { 11129, 2642 },
+    { 11138, 2642 }, { -32450, 2643 }, { -32593, 2647 }, { -32597, 2596 },
+    { -32601, 2597 }, { -32605, 2598 }, { -32488, 2646 }, { 11145, 2619 },
+    { -32623, 2622 }, { 11101, 2631 }, { 11134, 2631 }, { -32627, 2626 },
+    { -32652, 2633 }, { -32656, 2634 }, { -32667, 2635 }, { -32671, 2636 },
+    { -32675, 2638 }, { -32760, 2640 }, { 10920, 2419 }, { -32749, 2639 },
+    { -32764, 1073 }, { -32768, 1074 }, { -32772, 1076 }, { 11111, 1077 },
+    { 11129, 1085 }, { 11157, 670 }, { 11142, 670 }, { 11167, 695 },
+    { 11116, 696 }, { 11146, 702 }, { 11147, 184 }, { 10949, 2436 },
+    { 11164, 218 }, { 11163, 221 }, { 11172, 228 }, { 11125, 228 },
+    { 11136, 1097 }, { 10907, 2438 }, { -32896, 1098 }, { -32907, 1104 },
+    { 11171, 1110 }, { 11146, 2610 }, { -32931, 2616 }, { 11142, 2628 },
+    { 10919, 2203 }, { 10957, 2203 }, { 10963, 2203 }, { 10964, 2203 },
+    { 11173, 2630 }, { -32959, 2641 }, { 11147, 2644 }, { 11187, 2630 },
+    { -32970, 2656 }, { 11187, 2660 }, { 11176, 2660 }, { -33025, 2661 },
+    { -33029, 751 }, { 10921, 2444 }, { -33033, 795 }, { -33037, 796 },
+    { -33041, 798 }, { 11187, 2623 }, { 11140, 2625 }, { -33092, 2629 },
+    { 11204, 2637 }, { 10923, 2456 }, { -33109, 2651 }, { 10952, 2456 },
+    { 10967, 2458 }, { -33113, 2665 }, { -33137, 2666 }, { -33141, 2667 },
+    { -33145, 2668 }, { -33149, 2669 }, { -33153, 2670 }, { -33164, 2671 },
+    { -33168, 2662 }, { -33172, 2673 }, { 10978, 2462 }, { 10977, 2462 },
+    { 10970, 2462 }, { 10989, 2462 }, { 11004, 2462 }, { -33176, 2680 },
+    { 11202, 2686 }, { 11153, 2687 }, { -33200, 2692 }, { -33204, 2701 },
+    { -33208, 2702 }, { -33212, 2703 }, { -33216, 2705 }, { -33227, 178 },
+    { 11197, 1431 }, { 11151, 1433 }, { 11198, 1433 }, { -33272, 1439 },
+    { -33276, 1449 }, { -33280, 1468 }, { -33284, 1469 }, { -33295, 1470 },
+    { -33299, 1480 }, { 11214, 1216 }, { -33316, 1219 }, { -33320, 1220 },
+    { 11210, 1248 }, { -33331, 1253 }, { 11189, 1788 }, { 11163, 1791 },
+    { 11205, 1791 }, { 11177, 1791 }, { -33405, 1800 }, { -33409, 1801 },
+    { 11204, 1837 }, { -33420, 1845 }, { 11161, 506 }, { -33431, 530 },
+    { -33442, 531 }, { -33446, 145 }, { -33450, 837 }, { 11179, 865 },
+    { -33461, 866 }, { 11218, 874 }, { 11211, 2672 }, { 11171, 2694 },
+    { 11000, 2523 }, { 11181, 2696 }, { 11221, 2708 }, { 11221, 2699 },
+    { 11201, 2696 }, { 11223, 2699 }, { 11220, 2709 }, { 11213, 2699 },
+    { 11179, 2716 }, { 11207, 2717 }, { 11225, 2718 }, { 11190, 2716 },
+    { 11232, 2716 }, { -33605, 2721 }, { 11189, 2723 }, { 11239, 903 },
+    { -33694, 2727 }, { 11230, 2723 }, { -33705, 883 }, { -33723, 930 },
+    { 11226, 2712 }, { 11250, 2714 }, { -33748, 2719 }, { 11207, 2714 },
+    { -33752, 2720 }, { -33756, 2728 }, { -33760, 2729 }, { -33764, 2730 },
+    { -33768, 2741 }, { -33772, 2743 }, { -33776, 2744 }, { -33780, 2746 },
+    { 11232, 2747 }, { -33791, 2749 }, { 11200, 2732 }, { 11200, 2732 },
+    { 11259, 2732 }, { -33837, 2735 }, { 11059, 2558 }, { 11085, 2558 },
+    { 11264, 2734 }, { -33841, 2736 }, { 11256, 2734 }, { 11263, 2737 },
+    { -33852, 2745 }, { 11207, 2748 }, { 11043, 2566 }, { -33877, 2767 },
+    { -33881, 2769 }, { -33885, 2770 }, { -33889, 2738 }, { -33893, 2756 },
+    { -33897, 2757 }, { -33901, 2775 }, { -33905, 2776 }, { 11054, 2568 },
+    { -33909, 2795 }, { -33913, 2796 }, { 11109, 2589 }, { -33917, 1285 },
+    { -33921, 1290 }, { -33925, 1298 }, { 11267, 1316 }, { 11243, 1316 },
+    { 11223, 1316 }, { 11272, 1316 }, { 11269, 1316 }, { 11216, 1317 },
+    { 11263, 1317 }, { 11274, 1317 }, { 11277, 1317 }, { 11274, 1317 },
+    { 11275, 1708 }, { 11281, 1710 }, { 11276, 1711 }, { 11261, 1711 },
+    { 11268, 1708 }, { -34189, 1721 }, { 11278, 1723 }, { 11286, 1750 },
+    { 11266, 1750 }, { -34240, 1753 }, { -34258, 1754 }, { 11291, 1750 },
+    { 11285, 2762 }, { 11124, 2581 }, { 11241, 2764 }, { -34276, 2771 },
+    { -34280, 2772 }, { 11300, 2774 }, { -34314, 2773 }, { -34332, 2778 },
+    { -34336, 2779 }, { -34354, 2780 }, { 11258, 2783 }, { 11255, 2806 },
+    { 11307, 2808 }, { 11300, 2808 }, { 11312, 2812 }, { 11298, 2812 },
+    { -34522, 922 }, { 11265, 895 }, { 11316, 895 }, { 11127, 2608 },
+    { 11296, 895 }, { 11293, 895 }, { 11309, 895 }, { 11131, 2643 },
+    { 11272, 915 }, { 11322, 915 }, { -34637, 1255 }, { 11138, 2643 },
+    { 11140, 2646 }, { 11101, 2646 }, { 11116, 2646 }, { 11138, 2646 },
+    { 11145, 2646 }, { 11141, 2626 }, { -34641, 1270 }, { 11103, 2634 },
+    { -34645, 1271 }, { 11105, 2638 }, { 11147, 2638 }, { 11120, 2638 },
+    { 11105, 2639 }, { 11274, 944 }, { 11136, 2638 }, { 11304, 944 },
+    { 11322, 944 }, { 11329, 944 }, { 11280, 1254 }, { 11334, 1254 },
+    { 11286, 1287 }, { 11314, 1287 }, { 11331, 1254 }, { 11334, 1254 },
+    { 11337, 1465 }, { 11289, 1466 }, { -34696, 1479 }, { 11317, 1500 },
+    { -34733, 1502 }, { 11330, 1512 }, { 11291, 2784 }, { -34758, 2799 },
+    { 11156, 1098 }, { 11343, 2801 }, { 11344, 2802 }, { 11345, 2807 },
+    { 11319, 2807 }, { -34834, 2810 }, { 11343, 2807 }, { 11337, 2807 },
+    { -34838, 2818 }, { -34842, 2819 }, { -34846, 2329 }, { -34850, 2330 },
+    { 11351, 2349 }, { 11136, 2656 }, { -34868, 2351 }, { -34872, 2352 },
+    { 11143, 2656 }, { -34876, 2355 }, { 11299, 2377 }, { -34887, 2387 },
+    { -34891, 2388 }, { -34905, 2391 }, { 11161, 798 }, { -34909, 1617 },
+    { -34913, 1638 }, { -34917, 1639 }, { -34921, 1640 }, { 11306, 1661 },
+    { -34939, 1663 }, { -34950, 1295 }, { 11302, 1299 }, { 11192, 2665 },
+    { -34961, 1309 }, { -34965, 1310 }, { 11144, 2665 }, { 11348, 1330 },
+    { -34976, 1331 }, { 11359, 1137 }, { 11353, 1180 }, { 11360, 1176 },
+    { 11200, 2670 }, { 11368, 1176 }, { 11360, 1063 }, { -35015, 1065 },
+    { 11367, 1067 }, { 11360, 2787 }, { 11321, 2788 }, { -35061, 2792 },
+    { 11323, 2787 }, { 11351, 2788 }, { 11321, 2798 }, { 11154, 2705 },
+    { 11364, 2803 }, { -35079, 2805 }, { -35083, 2813 }, { -35087, 2814 },
+    { -35091, 1793 }, { 11337, 1794 }, { -35109, 1797 }, { 11369, 1794 },
+    { -35113, 1798 }, { 11159, 1469 }, { -35117, 1852 }, { 11335, 1855 },
+    { 11369, 2820 }, { 11329, 2821 }, { -35159, 2823 }, { 11364, 2821 },
+    { -35183, 2826 }, { 11387, 2831 }, { 11366, 2831 }, { -35254, 2833 },
+    { 11382, 2837 }, { 11366, 2831 }, { 11363, 2838 }, { 11379, 2838 },
+    { 11340, 2858 }, { -35326, 2867 }, { -35401, 2881 }, { 11179, 530 },
+    { -35390, 2868 }, { 11376, 2039 }, { -35412, 2045 }, { -35416, 2053 },
+    { -35420, 2074 }, { -35424, 2090 }, { 11361, 2098 }, { 11349, 2100 },
+    { 11351, 1426 }, { -35472, 1437 }, { 11357, 1443 }, { -35492, 1475 },
+    { 11360, 1478 }, { -35580, 2815 }, { 11407, 1478 }, { -35597, 2825 },
+    { 11407, 1478 }, { 11400, 1478 }, { -35601, 2829 }, { 11236, 2721 },
+    { 11214, 2721 }, { 11187, 2721 }, { 11213, 2721 }, { 11229, 2721 },
+    { 11223, 2727 }, { 11197, 883 }, { 11382, 2830 }, { 11412, 2835 },
+    { 11404, 2835 }, { -35652, 2840 }, { -35656, 2841 }, { -35667, 2849 },
+    { -35671, 2850 }, { -35675, 2857 }, { 11414, 1340 }, { -35696, 1351 },
+    { 11376, 1354 }, { 11419, 1340 }, { -35720, 1359 }, { 11376, 1366 },
+    { 11378, 1376 }, { 11430, 1386 }, { 11409, 1386 }, { 11395, 1386 },
+    { -35779, 1929 }, { -35783, 1937 }, { 11435, 1943 }, { -35807, 1946 },
+    { -35824, 1947 }, { -35828, 1984 }, { -35832, 1986 }, { -35836, 1988 },
+    { 11246, 2745 }, { -35840, 2335 }, { 11414, 2338 }, { -35935, 2344 },
+    { -35939, 2345 }, { -35943, 2347 }, { 11445, 2371 }, { -35954, 2375 },
+    { -35958, 2380 }, { 11452, 2845 }, { 11403, 2855 }, { -36046, 2860 },
+    { -35990, 2822 }, { -36050, 2861 }, { -36054, 2862 }, { -36058, 2863 },
+    { -36062, 2864 }, { -36066, 2865 }, { -36070, 1118 }, { -36074, 1120 },
+    { -36078, 1147 }, { -36082, 1150 }, { -36086, 1021 }, { 11416, 1032 },
+    { 11449, 1055 }, { -36107, 1360 }, { 11415, 1410 }, { -36118, 1411 },
+    { -36122, 1418 }, { -36126, 1419 }, { 11453, 2852 }, { 11420, 2852 },
+    { 11461, 2866 }, { -36160, 2871 }, { -36164, 2872 }, { 11291, 1753 },
+    { 11290, 1753 }, { -36168, 2879 }, { -36172, 2885 }, { -36189, 2889 },
+    { -36242, 1957 }, { 11242, 2772 }, { 11291, 2772 }, { 11296, 2772 },
+    { 11298, 2773 }, { -36246, 1963 }, { 11472, 1966 }, { 11282, 2780 },
+    { 11423, 1977 }, { 11465, 1201 }, { 11301, 2779 }, { 11303, 2780 },
+    { 11467, 2905 }, { 11447, 2905 }, { 11475, 2905 }, { 11471, 2905 },
+    { 11426, 2015 }, { 11473, 2015 }, { 11485, 2015 }, { 11458, 2015 },
+    { 11426, 2015 }, { 11484, 2015 }, { 11474, 1199 }, { 11464, 1199 },
+    { -36460, 1206 }, { 11459, 1210 }, { 11464, 1199 }, { 11472, 1214 },
+    { -36559, 197 }, { 11482, 1214 }, { 11495, 1214 }, { 11494, 154 },
+    { 11477, 156 }, { 11500, 166 }, { 11472, 131 }, { -36601, 2891 },
+    { -36605, 2892 }, { -36674, 2894 }, { 11491, 131 }, { -36630, 2893 },
+    { -36696, 2896 }, { -36711, 2898 }, { -36715, 2899 }, { -36719, 2900 },
+    { -36678, 2895 }, { -36734, 2902 }, { -36700, 2897 }, { -36723, 2901 },
+    { -36738, 2903 }, { -36742, 2904 }, { -36746, 2906 }, { -36757, 2907 },
+    { -36761, 2908 }, { -36765, 2909 }, { -36769, 2910 }, { 11338, 1502 },
+    { -36780, 2912 }, { -36791, 2913 }, { -36795, 2914 }, { -36799, 2915 },
+    { -36810, 2916 }, { -36814, 2917 }, { -36818, 2920 }, { -36822, 2921 },
+    { -36826, 2922 }, { -36830, 2923 }, { -36834, 2924 }, { -36838, 2925 },
+    { -36842, 2926 }, { -36846, 2927 }, { -36857, 2928 }, { -36902, 2930 },
+    { 11323, 2330 }, { -36906, 2931 }, { -36910, 2932 }, { -36861, 2929 },
+    { -36914, 2933 }, { -36918, 2934 }, { -36922, 2935 }, { -36926, 2936 },
+    { -36930, 2937 }, { 11313, 2388 }, { -36934, 2938 }, { -36948, 2939 },
+    { -36952, 2940 }, { -36963, 2941 }, { 11329, 1640 }, { -36967, 2942 },
+    { 11340, 1663 }, { -37019, 2944 }, { -37030, 2946 }, { -37034, 2947 },
+    { -37045, 2948 }, { -37049, 2949 }, { -37053, 2950 }, { -37057, 2951 },
+    { -37071, 2952 }, { -37075, 2953 }, { -37086, 2954 }, { -37090, 2955 },
+    { -37094, 2956 }, { -37098, 2957 }, { -37102, 2958 }, { -37197, 2960 },
+    { 11320, 1065 }, { -37201, 2961 }, { -37205, 2962 }, { -37209, 2963 },
+    { -37213, 2964 }, { -37217, 2965 }, { -37228, 2966 }, { -37232, 2968 },
+    { -37236, 2969 }, { -37240, 2970 }, { -37244, 2971 }, { -37248, 2973 },
+    { -37252, 2974 }, { -37256, 2975 }, { -37267, 2976 }, { -37271, 2977 },
+    { -37337, 2979 }, { -37351, 2981 }, { -37355, 2982 }, { -37359, 2983 },
+    { 11372, 2823 }, { -37363, 2984 }, { -37367, 2985 }, { -37378, 2986 },
+    { -37389, 2987 }, { 11335, 2833 }, { 11372, 2833 }, { -37393, 2988 },
+    { 11345, 2833 }, { -37397, 2989 }, { -37401, 2990 }, { -37405, 2991 },
+    { 11369, 2867 }, { -37409, 2992 }, { 11353, 2867 }, { 11400, 2867 },
+    { -37413, 2993 }, { 11351, 2868 }, { -37417, 2994 }, { 11393, 2090 },
+    { 11398, 2090 }, { -37421, 2995 }, { -37425, 2996 }, { -37436, 2998 },
+    { -37440, 2999 }, { 11399, 1475 }, { -37444, 3000 }, { -37448, 3001 },
+    { 11352, 1475 }, { -37452, 3002 }, { -37456, 3004 }, { 11401, 2815 },
+    { 11494, 2978 }, { 11511, 2978 }, { 11549, 2978 }, { 11532, 2978 },
+    { 11558, 2978 }, { -37460, 3005 }, { -37464, 3006 }, { -37482, 3007 },
+    { -37486, 3008 }, { -37490, 3009 }, { -37522, 3010 }, { -37526, 3011 },
+    { -37530, 3012 }, { -37534, 3013 }, { -37538, 3014 }, { -37542, 3015 },
+    { 11422, 2841 }, { -37553, 3016 }, { -37571, 3018 }, { 11403, 1351 },
+    { -37586, 3020 }, { 11412, 1359 }, { -37575, 3019 }, { -37590, 3021 },
+    { -37594, 3022 }, { -37598, 3023 }, { -37602, 3024 }, { 11384, 1937 },
+    { -37606, 3025 }, { -37610, 3026 }, { -37614, 3027 }, { 11404, 1946 },
+    { -37618, 3028 }, { -37629, 3029 }, { -37633, 3030 }, { 11435, 2335 },
+    { 11394, 2335 }, { 11394, 2335 }, { 11446, 2335 }, { 11447, 2335 },
+    { -37637, 3031 }, { -37641, 3032 }, { -37645, 3033 }, { 11444, 2380 },
+    { 11424, 2380 }, { 11408, 2380 }, { 11399, 2822 }, { 11429, 2822 },
+    { 11413, 2822 }, { -37649, 3034 }, { -37653, 3035 }, { -37657, 3036 },
+    { -37661, 3037 }, { -37665, 3038 }, { -37669, 3039 }, { -37673, 3040 },
+    { -37677, 1838 }, { -37681, 1853 }, { -37706, 1859 }, { -37710, 1862 },
+    { -37714, 1870 }, { 11543, 1882 }, { -37731, 1888 }, { -37735, 1535 },
+    { 11532, 1548 }, { 11581, 1548 }, { -37781, 1565 }, { -37785, 1567 },
+    { 11537, 1570 }, { 11533, 1274 }, { -37810, 1277 }, { 11541, 1302 },
+    { 11569, 1312 }, { 11542, 3043 }, { 11431, 2885 }, { 11540, 3041 },
+    { 11561, 3041 }, { 11572, 3041 }, { 11594, 3041 }, { 11585, 3041 },
+    { 11600, 3052 }, { 11585, 3053 }, { 11547, 3061 }, { -37935, 3079 },
+    { 11549, 3091 }, { -37946, 3096 }, { 11595, 3061 }, { -37950, 3099 },
+    { -37954, 3045 }, { -37958, 3054 }, { -37962, 3055 }, { -37966, 3056 },
+    { -37970, 3063 }, { 11585, 3067 }, { -37988, 3084 }, { -37992, 3085 },
+    { -37996, 3060 }, { 11610, 3083 }, { 11617, 3086 }, { -38055, 3089 },
+    { 11436, 1206 }, { 11489, 1206 }, { 11557, 3066 }, { 11557, 3066 },
+    { 11586, 3066 }, { 11554, 3066 }, { 11589, 3090 }, { -38066, 3093 },
+    { 11580, 3094 }, { 11450, 2892 }, { 11485, 2892 }, { -38090, 3103 },
+    { -38114, 3109 }, { 11499, 2893 }, { 11510, 2892 }, { 11456, 2893 },
+    { 11507, 2893 }, { 11500, 2893 }, { 11484, 2895 }, { 11512, 2895 },
+    { 11509, 2897 }, { 11509, 2901 }, { -38125, 3119 }, { -38129, 3120 },
+    { -38133, 3101 }, { 11497, 2906 }, { -38137, 3102 }, { -38155, 3107 },
+    { 11464, 2910 }, { 11616, 3104 }, { 11624, 3104 }, { 11483, 2912 },
+    { 11604, 3113 }, { 11618, 3115 }, { 11519, 2915 }, { -38176, 3129 },
+    { 11578, 3134 }, { 11621, 3134 }, { 11611, 3134 }, { -38273, 3140 },
+    { -38277, 3143 }, { 11631, 3134 }, { -38281, 3144 }, { -38285, 3155 },
+    { 11636, 3162 }, { -38313, 3131 }, { 11609, 3132 }, { 11522, 2927 },
+    { 11474, 2929 }, { 11493, 2929 }, { -38331, 3135 }, { 11530, 2929 },
+    { 11527, 2929 }, { -38335, 3137 }, { -38436, 3138 }, { -38461, 3141 },
+    { -38465, 3142 }, { 11507, 2938 }, { -38440, 3139 }, { 11528, 2940 },
+    { 11478, 2942 }, { 11525, 2942 }, { 11533, 2942 }, { -38469, 3148 },
+    { 11509, 2944 }, { 11536, 2947 }, { -38487, 3171 }, { -38508, 3176 },
+    { -38512, 3178 }, { 11602, 3082 }, { 11611, 3082 }, { 11489, 2953 },
+    { 11540, 2951 }, { -38516, 3076 }, { 11636, 3087 }, { -38578, 3111 },
+    { 11544, 2958 }, { 11540, 2958 }, { 11534, 2958 }, { 11539, 2958 },
+    { 11527, 2958 }, { 11663, 3114 }, { 11492, 2965 }, { -38589, 3125 },
+    { -38593, 3126 }, { -38597, 3127 }, { -38601, 3128 }, { 11659, 628 },
+    { -38619, 630 }, { 11644, 653 }, { 11616, 1417 }, { 11628, 1421 },
+    { 11669, 1424 }, { 11503, 2975 }, { 11632, 1434 }, { 11639, 1424 },
+    { 11503, 2979 }, { 11632, 3147 }, { -38684, 3151 }, { 11624, 3157 },
+    { 11549, 2985 }, { 11550, 2986 }, { 11626, 3158 }, { 11678, 3158 },
+    { 11675, 3158 }, { 11666, 3158 }, { 11633, 3158 }, { 11674, 3163 },
+    { 11672, 3175 }, { -38944, 3180 }, { 11636, 3187 }, { -38958, 3193 },
+    { -38969, 3194 }, { 11683, 3202 }, { -38987, 3204 }, { 11687, 2466 },
+    { -38998, 2467 }, { 11681, 3202 }, { 11660, 2469 }, { -39009, 2470 },
+    { 11559, 2996 }, { 11690, 2474 }, { 11679, 2475 }, { -39040, 2477 },
+    { -39044, 2653 }, { -39062, 2659 }, { 11698, 2664 }, { -39073, 2674 },
+    { -39077, 2679 }, { -39081, 2689 }, { 11699, 2700 }, { 11702, 2700 },
+    { 11687, 2700 }, { 11702, 2700 }, { 11698, 2700 }, { -39162, 3185 },
+    { 11562, 3006 }, { -39166, 3191 }, { -39170, 3192 }, { 11561, 3009 },
+    { -39174, 3195 }, { -39178, 3196 }, { -39182, 3197 }, { 11563, 3009 },
+    { -39207, 3198 }, { 11716, 3201 }, { -39211, 3199 }, { 11566, 3016 },
+    { 11566, 3015 }, { -39257, 3223 }, { 11716, 3233 }, { 11568, 3016 },
+    { -39268, 3241 }, { 11555, 3019 }, { 11668, 3222 }, { 11704, 3222 },
+    { 11728, 3206 }, { 11714, 3222 }, { 11721, 3222 }, { 11670, 3207 },
+    { 11707, 3207 }, { 11737, 3207 }, { 11714, 3207 }, { 11546, 3028 },
+    { 11729, 3207 }, { -39365, 3218 }, { -39376, 3219 }, { -39380, 3221 },
+    { -39384, 3224 }, { -39388, 3225 }, { -39392, 3243 }, { 11681, 3258 },
+    { 11736, 3258 }, { -39424, 3235 }, { 11689, 3238 }, { 11689, 3238 },
+    { 11715, 3258 }, { -39459, 3245 }, { 11734, 3238 }, { -39484, 3255 },
+    { -39488, 3256 }, { -39492, 3257 }, { -39496, 3259 }, { -39510, 3260 },
+    { -39514, 3261 }, { -39625, 3264 }, { -39629, 3265 }, { 11516, 1853 },
+    { 11524, 1853 }, { -39518, 3262 }, { -39633, 3266 }, { 11575, 1853 },
+    { -39637, 3267 }, { -39648, 3268 }, { -39659, 3269 }, { 11534, 1535 },
+    { 11529, 1567 }, { -39663, 3270 }, { -39667, 3271 }, { -39671, 3272 },
+    { -39675, 3274 }, { -39679, 3276 }, { 11759, 3284 }, { -40158, 3250 },
+    { 11741, 3273 }, { -40169, 3294 }, { -40173, 3295 }, { -40177, 3296 },
+    { -40181, 3297 }, { -40185, 3299 }, { -40189, 3300 }, { -40206, 3301 },
+    { -40210, 3302 }, { -40214, 3303 }, { 11763, 3306 }, { 11722, 566 },
+    { -40259, 3205 }, { 11747, 570 }, { 11778, 566 }, { 11767, 570 },
+    { -40280, 3212 }, { -40284, 3213 }, { -40295, 3214 }, { -40306, 3215 },
+    { 11560, 3063 }, { -40317, 3216 }, { 11775, 3237 }, { 11792, 705 },
+    { 11759, 707 }, { 11798, 3237 }, { 11790, 705 }, { -40368, 721 },
+    { -40379, 1493 }, { -40383, 1495 }, { -40387, 1497 }, { -40391, 1498 },
+    { 11797, 1514 }, { 11607, 3093 }, { 11752, 1511 }, { 11775, 1511 },
+    { 11818, 1511 }, { 11791, 1511 }, { 11813, 1511 }, { 11823, 1511 },
+    { 11624, 3103 }, { 11819, 2657 }, { 11589, 3109 }, { 11837, 2663 },
+    { 11832, 2657 }, { 11805, 2657 }, { -40590, 2682 }, { -40601, 2684 },
+    { -40605, 2685 }, { -40609, 2688 }, { -40613, 2690 }, { -40617, 2691 },
+    { 11831, 2697 }, { 11819, 2697 }, { -40648, 1525 }, { 11833, 2697 },
+    { -40652, 1578 }, { -40656, 1580 }, { -40660, 1581 }, { -40664, 1583 },
+    { -40668, 577 }, { -40672, 579 }, { 11802, 1149 }, { 11846, 1170 },
+    { 11632, 3129 }, { 11615, 3129 }, { 11849, 1174 }, { -40724, 1191 },
+    { -40748, 618 }, { 11627, 3155 }, { 11852, 614 }, { 11636, 3131 },
+    { 11861, 635 }, { 11850, 614 }, { -40759, 169 }, { -40777, 3279 },
+    { -40781, 3281 }, { -40785, 3290 }, { 11590, 3137 }, { 11639, 3137 },
+    { 11601, 3137 }, { 11624, 3137 }, { 11604, 3137 }, { 11634, 3137 },
+    { 11608, 3139 }, { 11850, 3278 }, { -40789, 3307 }, { -40800, 3308 },
+    { 11841, 3278 }, { -40804, 3310 }, { 11604, 3148 }, { 11654, 3148 },
+    { 11642, 3171 }, { -40821, 3325 }, { -40825, 3326 }, { 11610, 3171 },
+    { -40829, 3327 }, { -40833, 2463 }, { 11602, 3076 }, { 11643, 3076 },
+    { 11614, 3076 }, { 11618, 3076 }, { -40837, 2464 }, { -40848, 2465 },
+    { 11870, 2473 }, { -40865, 2484 }, { -40869, 2507 }, { 11866, 3309 },
+    { -40886, 3312 }, { -40890, 3316 }, { -40894, 3317 }, { 11859, 3322 },
+    { 11665, 3128 }, { -40915, 3348 }, { -40926, 3350 }, { -40930, 3351 },
+    { -40934, 3352 }, { -40938, 3353 }, { -40942, 3354 }, { 11880, 2513 },
+    { 11832, 2513 }, { -40967, 2532 }, { -40971, 2534 }, { 11881, 2539 },
+    { -40988, 2544 }, { -41006, 3057 }, { -41010, 3058 }, { -41014, 3059 },
+    { -41018, 3064 }, { -41042, 3110 }, { -41046, 3112 }, { 11881, 201 },
+    { 11841, 132 }, { 11838, 3293 }, { -41078, 3298 }, { 11889, 3293 },
+    { -41106, 3313 }, { 11675, 3193 }, { 11845, 3305 }, { 11897, 3305 },
+    { 11847, 3328 }, { -41123, 3330 }, { -41313, 3337 }, { -41324, 3339 },
+    { -41328, 2546 }, { 11689, 2470 }, { -41332, 2547 }, { 11884, 2553 },
+    { 11911, 2553 }, { 11647, 2653 }, { 11912, 2564 }, { 11665, 2653 },
+    { 11908, 3333 }, { 11905, 3333 }, { 11897, 3333 }, { 11897, 3333 },
+    { 11913, 3333 }, { -41357, 2570 }, { 11906, 2585 }, { -41440, 2587 },
+    { 11918, 2157 }, { -41458, 2161 }, { 11918, 2585 }, { -41469, 2162 },
+    { -41473, 2190 }, { -41477, 2191 }, { -41481, 2192 }, { 11876, 744 },
+    { 11702, 3197 }, { 11691, 3197 }, { -41492, 753 }, { -41496, 778 },
+    { 11718, 3197 }, { 11698, 3199 }, { 11922, 206 }, { 11912, 206 },
+    { 11917, 138 }, { 11920, 206 }, { 11881, 133 }, { 11935, 133 },
+    { -41600, 3355 }, { 11714, 3241 }, { -41630, 3356 }, { -41652, 3359 },
+    { -41641, 3358 }, { -41656, 3360 }, { -41660, 3361 }, { -41664, 3362 },
+    { -41668, 3363 }, { -41672, 3364 }, { -41676, 3365 }, { 11684, 3218 },
+    { -41680, 3366 }, { -41684, 3368 }, { -41688, 3369 }, { -41692, 3370 },
+    { -41696, 3371 }, { 11935, 3372 }, { 11917, 3380 }, { -41717, 3384 },
+    { -41758, 3392 }, { -41769, 3401 }, { 11904, 182 }, { 11699, 3245 },
+    { 11901, 134 }, { 11924, 134 }, { 11742, 3245 }, { 11713, 3245 },
+    { 11899, 134 }, { -41813, 486 }, { -41817, 487 }, { 11935, 507 },
+    { 11693, 3259 }, { 11909, 220 }, { 11695, 3262 }, { 11717, 3262 },
+    { 11727, 3262 }, { 11756, 3262 }, { 11753, 3262 }, { 11911, 225 },
+    { 11729, 3267 }, { 11959, 225 }, { 11937, 225 }, { 11760, 3268 },
+    { 11956, 225 }, { -41875, 3402 }, { 11712, 3276 }, { 11783, 3276 },
+    { 11801, 3276 }, { 11844, 3276 }, { 11765, 3276 }, { 11808, 3276 },
+    { -41889, 3403 }, { -41900, 3404 }, { -41904, 3405 }, { 11938, 3389 },
+    { 11760, 3300 }, { 11931, 3389 }, { 11942, 3389 }, { 11929, 3389 },
+    { -41915, 3406 }, { -41919, 3407 }, { 11771, 3205 }, { -41923, 3408 },
+    { -41927, 3409 }, { -41931, 3410 }, { -41935, 3411 }, { 11728, 3213 },
+    { 11759, 3214 }, { 11774, 3215 }, { -41939, 3412 }, { -41943, 3414 },
+    { -41947, 3415 }, { -41951, 3416 }, { -41955, 3417 }, { -41959, 3419 },
+    { -41963, 3420 }, { -41967, 3421 }, { -41971, 3422 }, { -41975, 3423 },
+    { -41979, 3424 }, { 11805, 721 }, { -41983, 3425 }, { -42007, 3426 },
+    { -42011, 3427 }, { -42015, 3429 }, { -42019, 3430 }, { -42023, 3431 },
+    { -42027, 3432 }, { -42031, 3433 }, { -42035, 3434 }, { -42039, 3435 },
+    { -42043, 3436 }, { -42047, 3437 }, { -42058, 3438 }, { -42062, 3439 },
+    { -42066, 3441 }, { 11789, 2682 }, { -42070, 3442 }, { -42074, 3443 },
+    { -42078, 3444 }, { -42082, 3445 }, { -42086, 3446 }, { -42111, 3447 },
+    { -42115, 3448 }, { -42119, 3450 }, { -42130, 3451 }, { -42134, 3452 },
+    { -42138, 3453 }, { -42149, 3454 }, { -42167, 3455 }, { 11838, 579 },
+    { 11802, 579 }, { -42203, 3457 }, { -42171, 3456 }, { -42207, 3458 },
+    { -42229, 3460 }, { -42233, 3461 }, { -42237, 3462 }, { -42211, 3459 },
+    { -42254, 3463 }, { -42258, 3464 }, { -42262, 3465 }, { -42266, 3466 },
+    { -42270, 3467 }, { -42274, 3468 }, { -42278, 3469 }, { -42282, 3470 },
+    { -42293, 3471 }, { -42317, 3472 }, { -42321, 3473 }, { -42325, 3474 },
+    { -42329, 3476 }, { -42333, 3477 }, { -42344, 3478 }, { -42372, 3479 },
+    { -42376, 3480 }, { -42380, 3481 }, { -42384, 3482 }, { -42395, 3483 },
+    { 11873, 3307 }, { -42399, 3484 }, { 11848, 3310 }, { -42403, 3485 },
+    { -42414, 3486 }, { -42418, 3487 }, { -42422, 3488 }, { -42457, 3490 },
+    { -42461, 3491 }, { -42446, 3489 }, { -42465, 3492 }, { -42469, 3493 },
+    { 11862, 2464 }, { -42473, 3494 }, { -42477, 3495 }, { -42495, 3496 },
+    { -42499, 3497 }, { -42503, 3498 }, { -42517, 3499 }, { -42521, 3500 },
+    { 11825, 3317 }, { -42546, 3501 }, { -42550, 3502 }, { 11828, 3348 },
+    { -42554, 3503 }, { -42558, 3504 }, { -42562, 3505 }, { -42573, 3507 },
+    { -42577, 3508 }, { -42588, 3509 }, { -42592, 3510 }, { -42596, 3511 },
+    { -42600, 3512 }, { -42604, 3513 }, { -42608, 3514 }, { 11863, 2544 },
+    { 11855, 2544 }, { -42612, 3515 }, { -42616, 3516 }, { -42620, 3517 },
+    { -42624, 3518 }, { 11864, 3064 }, { -42628, 3519 }, { -42632, 3520 },
+    { -42636, 3521 }, { -42640, 3522 }, { -42644, 3523 }, { -42648, 3524 },
+    { 11883, 3298 }, { -42652, 3525 }, { -42656, 3526 }, { -42660, 3528 },
+    { 11856, 3330 }, { -42664, 3529 }, { 11895, 3330 }, { -42668, 3530 },
+    { 11909, 3337 }, { -42672, 3531 }, { -42686, 3532 }, { -42690, 3533 },
+    { -42694, 3534 }, { -42698, 3535 }, { -42702, 3536 }, { -42706, 3537 },
+    { -42710, 3538 }, { -42714, 3539 }, { -42718, 3540 }, { -42722, 3541 },
+    { -42746, 3542 }, { -42750, 3543 }, { -42754, 3544 }, { -42758, 3545 },
+    { 11917, 2161 }, { -42762, 3546 }, { -42766, 3547 }, { -42770, 3548 },
+    { -42774, 3549 }, { -42778, 3550 }, { -42782, 3551 }, { 11960, 3552 },
+    { 11992, 3552 }, { 11998, 3552 }, { 12015, 3552 }, { 12018, 3552 },
+    { 12024, 3552 }, { 11971, 706 }, { 11968, 733 }, { 12026, 306 },
+    { 12018, 815 }, { 12019, 841 }, { 11975, 863 }, { 11910, 3355 },
+    { 11895, 3355 }, { -43031, 3553 }, { -43035, 3554 }, { -43039, 3555 },
+    { 11942, 3356 }, { 11938, 3358 }, { -43056, 3557 }, { -43060, 3558 },
+    { -43064, 3559 }, { -43068, 3560 }, { -43079, 3561 }, { -43083, 3562 },
+    { -43087, 3563 }, { -43091, 3564 }, { -43102, 3565 }, { -43106, 3566 },
+    { -43117, 3567 }, { -43121, 3568 }, { -43125, 3569 }, { -43146, 3570 },
+    { -43150, 3571 }, { -43154, 3572 }, { 11924, 3392 }, { -43158, 3573 },
+    { -43162, 3574 }, { -43166, 3575 }, { -43170, 3576 }, { -43174, 3577 },
+    { -43199, 3578 }, { -43203, 3579 }, { -43207, 3580 }, { -43211, 3581 },
+    { -43222, 3582 }, { -43226, 3583 }, { -43237, 3584 }, { -43241, 3585 },
+    { -43256, 3587 }, { -43245, 3586 }, { -43260, 3588 }, { -43264, 3589 },
+    { -43268, 3590 }, { -43272, 3591 }, { -43276, 3592 }, { -43280, 3593 },
+    { 11953, 3402 }, { -43284, 3594 }, { -43288, 3595 }, { -43292, 3596 },
+    { -43303, 3597 }, { -43307, 3598 }, { 11969, 3403 }, { -43311, 3599 },
+    { 11971, 3405 }, { -43315, 3600 }, { -43340, 3601 }, { -43344, 3602 },
+    { -43348, 3603 }, { -43359, 3604 }, { -43363, 3607 }, { -43367, 3608 },
+    { -43371, 3609 }, { -43375, 3610 }, { -43379, 3612 }, { -43383, 3613 },
+    { -43387, 3614 }, { -43391, 3615 }, { -43395, 3616 }, { -43399, 3617 },
+    { -43403, 3618 }, { -43531, 3620 }, { -43535, 3621 }, { -43550, 3623 },
+    { 12047, 3624 }, { 12017, 3624 }, { -43539, 3622 }, { -43574, 3641 },
+    { 12063, 3643 }, { -43615, 3642 }, { 12025, 1647 }, { -43660, 1653 },
+    { -43664, 1691 }, { 11975, 3425 }, { -43675, 1698 }, { 11955, 3425 },
+    { -43679, 3625 }, { -43683, 3626 }, { 12076, 3634 }, { -43701, 3652 },
+    { 12073, 3634 }, { 12042, 3669 }, { -43739, 3675 }, { 12054, 3673 },
+    { 11930, 3437 }, { 12077, 3673 }, { -43743, 3677 }, { -43747, 3678 },
+    { -43751, 3679 }, { -43755, 3681 }, { -43759, 2048 }, { 11921, 3446 },
+    { 11926, 3446 }, { 11935, 3446 }, { -43763, 2050 }, { -43767, 2080 },
+    { 11934, 3450 }, { -43771, 2082 }, { -43775, 2085 }, { 11979, 3454 },
+    { -43779, 1522 }, { 11933, 3453 }, { 11975, 3454 }, { 11931, 3456 },
+    { -43783, 1523 }, { -43787, 1553 }, { -43791, 1568 }, { 11937, 3456 },
+    { 11973, 3456 }, { 11931, 3459 }, { 11966, 3459 }, { 12088, 1608 },
+    { 11988, 3462 }, { -43802, 1622 }, { -43806, 1635 }, { -43810, 1654 },
+    { -43821, 3682 }, { -43852, 3683 }, { 11935, 3471 }, { 11947, 3471 },
+    { -43856, 3684 }, { 11978, 3470 }, { -43867, 3685 }, { 11942, 3478 },
+    { -43878, 3687 }, { 11973, 3478 }, { 11979, 3477 }, { -43882, 3688 },
+    { 11965, 3482 }, { -43913, 3689 }, { -43917, 3690 }, { -43935, 3691 },
+    { -43939, 3692 }, { -43943, 3694 }, { -43947, 3695 }, { 11974, 3485 },
+    { 11988, 3488 }, { 11996, 3488 }, { 11945, 3489 }, { -43951, 3696 },
+    { -43955, 3697 }, { -43959, 3698 }, { -43963, 3700 }, { 11946, 3495 },
+    { 11946, 3495 }, { -43967, 3701 }, { -43971, 3702 }, { 11952, 3498 },
+    { -43975, 3703 }, { 12003, 3500 }, { -43999, 3704 }, { -44003, 3705 },
+    { 11979, 3500 }, { -44007, 3706 }, { -44011, 3707 }, { -44015, 3708 },
+    { 11951, 3505 }, { -44019, 3709 }, { 11957, 3508 }, { -44023, 3710 },
+    { -44027, 3711 }, { -44031, 3712 }, { -44035, 3713 }, { -44039, 3714 },
+    { -44043, 3715 }, { -44047, 3716 }, { -44051, 3717 }, { -44055, 3718 },
+    { -44059, 3720 }, { -44063, 3721 }, { -44067, 3722 }, { -44071, 3723 },
+    { -44075, 3724 }, { -44079, 3726 }, { -44083, 3727 }, { -44087, 3728 },
+    { -44091, 3729 }, { -44095, 3730 }, { -44099, 3731 }, { -44103, 3732 },
+    { -44107, 3733 }, { -44111, 3737 }, { -44226, 3748 }, { -44248, 3764 },
+    { -44237, 3750 }, { 12051, 3738 }, { 12100, 3738 }, { 12002, 3531 },
+    { 12089, 3738 }, { 12068, 3738 }, { 12109, 3738 }, { -44252, 3768 },
+    { -44263, 3769 }, { -44267, 3751 }, { 12092, 3752 }, { -44278, 3757 },
+    { -44299, 3758 }, { -44303, 3766 }, { 12098, 3767 }, { 12094, 3770 },
+    { 11963, 3541 }, { 12010, 3541 }, { -44337, 3774 }, { -44459, 3779 },
+    { -44362, 3775 }, { -44424, 3777 }, { -44508, 3781 }, { 12138, 3787 },
+    { -44525, 3791 }, { -44435, 3778 }, { -44529, 3801 }, { 12087, 3805 },
+    { -44463, 3780 }, { -44567, 3807 }, { 12132, 3805 }, { 12102, 3805 },
+    { 12141, 3811 }, { 12089, 3784 }, { -44595, 3786 }, { 12134, 3790 },
+    { 12148, 3784 }, { -44606, 3793 }, { -44610, 3794 }, { 12138, 3795 },
+    { 12153, 3797 }, { 12038, 3555 }, { 12093, 3799 }, { -44638, 3802 },
+    { 12143, 3810 }, { 12151, 3814 }, { 12142, 3816 }, { 12023, 3560 },
+    { -44723, 3822 }, { -44727, 3843 }, { 12104, 3844 }, { 12150, 2365 },
+    { 12012, 3564 }, { -44745, 2369 }, { 11998, 3566 }, { 11986, 3569 },
+    { 11987, 3569 }, { -44773, 2383 }, { 12109, 2386 }, { 12110, 2392 },
+    { 12122, 2409 }, { 12132, 3789 }, { 12162, 3800 }, { -44827, 3808 },
+    { 11986, 3577 }, { 11991, 3577 }, { -44831, 3818 }, { 12113, 3824 },
+    { 12158, 3824 }, { 12033, 3581 }, { -44873, 3833 }, { -44877, 3835 },
+    { 12165, 3824 }, { 12116, 3838 }, { 12035, 3583 }, { 12033, 3586 },
+    { -44891, 3846 }, { -44895, 3847 }, { -44899, 3848 }, { 12115, 3836 },
+    { 12165, 3836 }, { 12175, 3836 }, { 12181, 3836 }, { 12174, 3836 },
+    { 12187, 3836 }, { 12125, 3845 }, { -45229, 3850 }, { -45233, 3851 },
+    { -45237, 3852 }, { 12013, 3596 }, { -45261, 3854 }, { 12039, 3600 },
+    { 12034, 3600 }, { 12173, 3859 }, { -45272, 3873 }, { -45276, 3874 },
+    { 12180, 3880 }, { 12004, 3603 }, { -45287, 3891 }, { 12195, 788 },
+    { 12193, 824 }, { 12194, 3853 }, { 12160, 3853 }, { -45370, 3869 },
+    { 12196, 3853 }, { 12006, 3618 }, { 12043, 3618 }, { 12052, 3618 },
+    { 12006, 3618 }, { 12027, 3618 }, { 12037, 3618 }, { 12011, 3622 },
+    { 12187, 3877 }, { 12037, 3641 }, { 12075, 3641 }, { 12071, 3642 },
+    { -45391, 3889 }, { -45395, 3901 }, { 12027, 1691 }, { 12052, 3642 },
+    { 12182, 3858 }, { 12186, 3858 }, { -45399, 3902 }, { 12215, 3858 },
+    { -45403, 3903 }, { 12191, 655 }, { 12192, 659 }, { 12173, 3068 },
+    { 12237, 3068 }, { 12255, 3068 }, { 12281, 3068 }, { 12304, 3068 },
+    { 12241, 3068 }, { 12209, 3070 }, { -45966, 3071 }, { 12274, 3073 },
+    { 12226, 3073 }, { 12191, 3073 }, { 12228, 3073 }, { 12255, 3073 },
+    { 12235, 3074 }, { 12244, 3074 }, { 12183, 3074 }, { -46266, 343 },
+    { 12230, 3074 }, { 12217, 3075 }, { 12201, 3075 }, { 12199, 3078 },
+    { 12244, 3078 }, { -46270, 419 }, { -46274, 457 }, { 12271, 3078 },
+    { 12274, 3078 }, { -46278, 470 }, { -46282, 3904 }, { -46286, 3905 },
+    { -46290, 3906 }, { -46294, 3907 }, { -46305, 3908 }, { -46309, 3909 },
+    { -46313, 3910 }, { 12035, 1654 }, { 12035, 3682 }, { -46317, 3911 },
+    { 12051, 3682 }, { -46321, 3913 }, { 12089, 3682 }, { -46325, 3914 },
+    { -46329, 3916 }, { 12086, 3684 }, { -46333, 3917 }, { 12038, 3685 },
+    { -46337, 3918 }, { 12086, 3688 }, { 12093, 3688 }, { -46341, 3919 },
+    { 12076, 3690 }, { -46345, 3921 }, { -46349, 3923 }, { -46353, 3925 },
+    { -46357, 3926 }, { -46361, 3927 }, { -46365, 3928 }, { -46369, 3929 },
+    { -46810, 3930 }, { -46814, 3931 }, { -46836, 3933 }, { -46840, 3934 },
+    { -46818, 3932 }, { -46844, 3935 }, { -46848, 3936 }, { -46852, 3937 },
+    { -46856, 3938 }, { -46860, 3939 }, { -46877, 3940 }, { 12075, 3703 },
+    { -46881, 3941 }, { 12044, 3703 }, { -46885, 3942 }, { -46889, 3943 },
+    { -46893, 3944 }, { -46897, 3945 }, { -46901, 3946 }, { -46905, 3947 },
+    { -46930, 3948 }, { -46934, 3949 }, { -46938, 3950 }, { -46942, 3951 },
+    { -46946, 3952 }, { -46950, 3954 }, { -46954, 3955 }, { -46958, 3956 },
+    { -46962, 3957 }, { -46966, 3958 }, { -46970, 3959 }, { -46974, 3960 },
+    { -46978, 3961 }, { -46982, 3962 }, { -46986, 3963 }, { -47018, 3964 },
+    { -47022, 3965 }, { -47026, 3966 }, { -47030, 3967 }, { -47034, 3968 },
+    { -47038, 3970 }, { -47042, 3971 }, { -47046, 3972 }, { -47050, 3973 },
+    { 12057, 3737 }, { 12092, 3748 }, { 12102, 3750 }, { -47054, 3974 },
+    { -47058, 3975 }, { -47062, 3976 }, { -47066, 3978 }, { -47070, 3979 },
+    { -47074, 3980 }, { -47078, 3983 }, { 12068, 3768 }, { -47082, 3984 },
+    { -47086, 3985 }, { -47090, 3987 }, { 12091, 3757 }, { -47094, 3989 },
+    { -47098, 3990 }, { -47123, 3991 }, { -47134, 3993 }, { -47138, 3994 },
+    { 12118, 3774 }, { 12069, 3775 }, { 12112, 3775 }, { 12120, 3777 },
+    { 12116, 3774 }, { -47142, 3995 }, { 12125, 3775 }, { 12121, 3778 },
+    { 12080, 3778 }, { 12081, 3780 }, { 12125, 3780 }, { -47146, 3996 },
+    { 12089, 3780 }, { -47150, 3997 }, { 12134, 3780 }, { -47154, 3998 },
+    { -47158, 3999 }, { -47162, 4001 }, { -47166, 4002 }, { -47170, 4003 },
+    { -47174, 4004 }, { -47178, 4005 }, { -47182, 4006 }, { -47186, 4007 },
+    { -47190, 4008 }, { 12129, 3802 }, { -47194, 4009 }, { -47205, 4010 },
+    { -47209, 4011 }, { -47213, 4012 }, { -47252, 4013 }, { -47256, 4014 },
+    { -47260, 4015 }, { -47282, 4017 }, { 12103, 2369 }, { -47264, 4016 },
+    { -47286, 4018 }, { -47297, 4019 }, { 12152, 2369 }, { -47301, 4020 },
+    { -47318, 4022 }, { -47322, 4023 }, { -47326, 4024 }, { -47330, 4025 },
+    { -47334, 4026 }, { -47338, 4027 }, { -47342, 4028 }, { -47346, 4030 },
+    { -47350, 4031 }, { -47361, 4032 }, { -47365, 4033 }, { -47369, 4034 },
+    { -47394, 4035 }, { -47398, 4036 }, { -47402, 4037 }, { -47406, 4038 },
+    { -47410, 4042 }, { -47414, 4043 }, { -47418, 4044 }, { -47422, 4045 },
+    { -47426, 4046 }, { -47430, 4047 }, { -47434, 4048 }, { -47438, 4049 },
+    { -47442, 4051 }, { -47446, 4052 }, { -47450, 4053 }, { -47454, 4056 },
+    { -47458, 4057 }, { -47462, 4059 }, { 12179, 3852 }, { -47466, 4060 },
+    { -47470, 4061 }, { -47474, 4062 }, { -47506, 4063 }, { -47510, 4064 },
+    { -47521, 4066 }, { -47525, 4067 }, { -47529, 4070 }, { -47533, 4071 },
+    { -47537, 4072 }, { -47541, 4073 }, { -47545, 4074 }, { -47549, 4075 },
+    { -47553, 4076 }, { -47570, 4078 }, { -47574, 4079 }, { -47578, 4080 },
+    { -47582, 4081 }, { 12209, 3869 }, { -47586, 4082 }, { -47590, 4083 },
+    { -47594, 4084 }, { -47598, 4085 }, { -47612, 4086 }, { -47616, 4088 },
+    { -47620, 4089 }, { -47624, 4090 }, { -47628, 4091 }, { -47632, 4093 },
+    { -47636, 4095 }, { -47640, 4096 }, { -47644, 4098 }, { -47648, 4099 },
+    { -47652, 4101 }, { -47656, 4102 }, { 12210, 3903 }, { -47660, 4104 },
+    { -47664, 4105 }, { -47668, 4106 }, { -47672, 4107 }, { -47676, 4108 },
+    { -47680, 4109 }, { -47684, 4111 }, { -47688, 4112 }, { -47692, 4113 },
+    { -47696, 4114 }, { -47700, 4116 }, { -47704, 4117 }, { -47708, 4118 },
+    { -47712, 4119 }, { -47716, 4120 }, { -47720, 4122 }, { -47724, 4123 },
+    { -47728, 4124 }, { -47732, 4125 }, { -47736, 4127 }, { -47740, 4128 },
+    { -47744, 4129 }, { -47748, 4131 }, { -47752, 4132 }, { -47756, 4133 },
+    { -47760, 4134 }, { -47764, 4136 }, { -47768, 4137 }, { -47779, 4138 },
+    { -47783, 4140 }, { -47787, 4143 }, { -47791, 4152 }, { -47826, 4148 },
+    { -47854, 4149 }, { -47858, 4150 }, { -47862, 4151 }, { 12242, 3907 },
+    { -47866, 4153 }, { -47870, 4154 }, { -47874, 4155 }, { -47892, 4156 },
+    { -47896, 4157 }, { -47900, 4158 }, { -47931, 4159 }, { -47952, 4161 },
+    { -47935, 4160 }, { -47966, 4162 }, { -47970, 4163 }, { -47990, 4164 },
+    { -47994, 4165 }, { -48036, 4167 }, { -48025, 4166 }, { -48040, 4168 },
+    { -48044, 4169 }, { -48048, 4170 }, { -48052, 4171 }, { -48056, 4172 },
+    { 12268, 3929 }, { 12326, 3929 }, { 12343, 3929 }, { 12380, 3929 },
+    { 12344, 3929 }, { 12366, 3929 }, { 12255, 3932 }, { 12236, 3932 },
+    { -48060, 4173 }, { -48064, 4174 }, { -48075, 4175 }, { 12219, 3939 },
+    { -48079, 4176 }, { -48083, 4177 }, { -48087, 4179 }, { -48091, 4180 },
+    { -48095, 4181 }, { -48099, 4182 }, { -48103, 4183 }, { -48107, 4184 },
+    { -48111, 4185 }, { 12231, 3947 }, { -48115, 4186 }, { -48119, 4187 },
+    { 12309, 3947 }, { -48123, 4188 }, { -48127, 4189 }, { -48131, 4191 },
+    { -48135, 4192 }, { -48139, 4193 }, { -48143, 4194 }, { -48147, 4196 },
+    { -48151, 4197 }, { -48155, 4202 }, { -48204, 4222 }, { 12408, 4221 },
+    { 12399, 4221 }, { 12262, 3963 }, { 12413, 4221 }, { 12407, 4221 },
+    { 12291, 3963 }, { -48225, 4223 }, { -48266, 4224 }, { -48270, 4225 },
+    { 12417, 4234 }, { 12384, 3627 }, { -48288, 3628 }, { -48292, 3629 },
+    { -48303, 3630 }, { -48307, 3631 }, { -48335, 3632 }, { 12428, 3636 },
+    { -48349, 3644 }, { 12436, 3659 }, { -48363, 3662 }, { -48367, 3663 },
+    { -48371, 3664 }, { 12428, 3665 }, { 12439, 3674 }, { 12439, 1718 },
+    { -48396, 1727 }, { -48400, 1728 }, { 12286, 3990 }, { 12320, 3991 },
+    { -48418, 1766 }, { 12285, 3990 }, { 12284, 3990 }, { -48422, 1773 },
+    { -48426, 1774 }, { 12443, 3839 }, { 12395, 3840 }, { 12400, 3841 },
+    { 12451, 3841 }, { -48517, 3849 }, { 12432, 3841 }, { 12390, 3855 },
+    { 12458, 3855 }, { 12400, 3855 }, { -48568, 3866 }, { 12407, 3855 },
+    { 12423, 3876 }, { -48592, 3885 }, { 12459, 3876 }, { 12406, 3888 },
+    { 12454, 3888 }, { -48610, 3896 }, { 12441, 3242 }, { -48621, 3236 },
+    { 12462, 3242 }, { 12429, 3244 }, { 12425, 3244 }, { 12463, 3244 },
+    { 12420, 3244 }, { -48681, 3280 }, { 12424, 3285 }, { 12361, 4012 },
+    { 12317, 4009 }, { 12468, 3291 }, { -48726, 1678 }, { 12311, 4012 },
+    { 12433, 1677 }, { 12327, 4016 }, { 12315, 4016 }, { 12472, 1677 },
+    { 12456, 1677 }, { -48730, 1684 }, { 12326, 4018 }, { 12472, 1689 },
+    { -49005, 1696 }, { 12326, 4020 }, { 12493, 3130 }, { -49016, 3136 },
+    { 12493, 3154 }, { 12440, 3164 }, { 12294, 4031 }, { -49040, 3166 },
+    { -49044, 3169 }, { -49048, 3373 }, { -49059, 3374 }, { 12330, 4034 },
+    { 12350, 4034 }, { 12430, 1693 }, { 12481, 1693 }, { 12470, 1693 },
+    { 12490, 1693 }, { 12478, 1693 }, { 12459, 1693 }, { -49063, 3376 },
+    { -49084, 3377 }, { -49088, 3378 }, { -49092, 3379 }, { 12497, 3386 },
+    { -49116, 3388 }, { -49120, 4203 }, { -49124, 4204 }, { -49128, 4205 },
+    { -49132, 4206 }, { -49136, 4207 }, { -49147, 4208 }, { 12368, 4062 },
+    { -49228, 4210 }, { 12353, 4062 }, { -49232, 4211 }, { 12299, 4064 },
+    { -49161, 4209 }, { -49236, 4212 }, { -49240, 4213 }, { -49244, 4235 },
+    { -49248, 4236 }, { -49252, 4237 }, { -49270, 4238 }, { -49285, 4240 },
+    { -49313, 4242 }, { 12370, 4076 }, { -49274, 4239 }, { -49289, 4241 },
+    { -49317, 4243 }, { -49321, 4244 }, { -49325, 4245 }, { -49336, 4247 },
+    { -49340, 4248 }, { 12371, 4085 }, { -49344, 4250 }, { -49348, 4251 },
+    { -49352, 4252 }, { -49356, 4254 }, { -49360, 4255 }, { -49364, 4257 },
+    { -49368, 4258 }, { -49372, 4259 }, { -49383, 4261 }, { -49387, 4262 },
+    { -49391, 4263 }, { -49402, 4264 }, { -49426, 4265 }, { -49430, 4266 },
+    { -49434, 4267 }, { -49451, 4268 }, { -49455, 4269 }, { -49459, 4271 },
+    { -49470, 4273 }, { -49474, 4274 }, { -49478, 3650 }, { -49556, 3653 },
+    { -49560, 3654 }, { -49564, 3655 }, { -49568, 3657 }, { -49572, 3660 },
+    { -49603, 3661 }, { -49668, 3676 }, { 12512, 3667 }, { -49672, 146 },
+    { -49607, 3666 }, { 12550, 3667 }, { -49729, 4277 }, { -49733, 4278 },
+    { -49676, 4275 }, { -49737, 4279 }, { -49741, 4280 }, { 12320, 4137 },
+    { -49745, 4281 }, { -49749, 4282 }, { -49753, 4283 }, { -49781, 4284 },
+    { 12391, 4152 }, { 12374, 4148 }, { 12365, 4152 }, { 12383, 4152 },
+    { -49785, 4285 }, { 12393, 4148 }, { -49789, 4286 }, { -49793, 4287 },
+    { -49797, 4288 }, { -49808, 4290 }, { 12399, 4155 }, { 12395, 4155 },
+    { 12406, 4158 }, { 12355, 4160 }, { 12397, 4158 }, { -49812, 4291 },
+    { -49816, 4292 }, { 12405, 4161 }, { 12385, 4163 }, { -49820, 4293 },
+    { 12387, 4165 }, { 12384, 4165 }, { 12401, 4165 }, { 12408, 4166 },
+    { -49824, 4296 }, { -49828, 4298 }, { -49839, 4299 }, { -49843, 4301 },
+    { -49847, 4302 }, { -49851, 4303 }, { -49855, 4306 }, { -49869, 4307 },
+    { -49873, 4308 }, { -49891, 4310 }, { -49895, 4312 }, { -49899, 4313 },
+    { -49903, 4315 }, { -49907, 4317 }, { 12409, 4174 }, { -49911, 4318 },
+    { -49915, 4319 }, { -49919, 4320 }, { -49923, 4322 }, { 12557, 4324 },
+    { 12516, 4327 }, { -49954, 4328 }, { -49979, 4329 }, { -49983, 4330 },
+    { -49987, 4331 }, { -49991, 4332 }, { -49995, 4333 }, { -49999, 4335 },
+    { -50003, 4336 }, { -50007, 4337 }, { -50011, 4338 }, { -50015, 4339 },
+    { -50019, 4340 }, { -50023, 4341 }, { -50027, 4342 }, { -50031, 4343 },
+    { 12414, 4222 }, { 12405, 4222 }, { -50042, 4344 }, { -50046, 4345 },
+    { -50050, 4346 }, { -50054, 4347 }, { -50058, 4348 }, { 12417, 4223 },
+    { 12382, 4223 }, { -50069, 4349 }, { -50073, 4350 }, { 12430, 4223 },
+    { -50084, 4352 }, { -50088, 4353 }, { 12380, 3629 }, { 12431, 3631 },
+    { 12411, 3631 }, { 12438, 3631 }, { -50092, 4354 }, { -50096, 4355 },
+    { -50100, 4356 }, { -50104, 4358 }, { -50108, 4359 }, { -50112, 4360 },
+    { -50116, 4363 }, { -50120, 4364 }, { -50124, 4365 }, { 12441, 1728 },
+    { -50128, 4366 }, { -50132, 4367 }, { -50136, 4370 }, { -50140, 4371 },
+    { -50144, 4372 }, { -50148, 4374 }, { -50152, 4375 }, { -50156, 4376 },
+    { -50160, 4377 }, { 12441, 1774 }, { -50164, 4378 }, { -50168, 4379 },
+    { -50172, 4380 }, { -50176, 4381 }, { -50180, 4382 }, { -50184, 4383 },
+    { -50188, 4384 }, { -50192, 4385 }, { -50196, 4387 }, { 12553, 4388 },
+    { -50234, 4386 }, { 12582, 4388 }, { -50238, 4392 }, { -50242, 4393 },
+    { 12577, 4405 }, { 12529, 4405 }, { 12573, 4414 }, { 12464, 3896 },
+    { 12460, 3236 }, { 12586, 4426 }, { 12557, 4426 }, { 12588, 4428 },
+    { 12563, 4441 }, { 12564, 1796 }, { 12579, 1799 }, { 12580, 1809 },
+    { -50326, 1810 }, { 12588, 2283 }, { -50350, 2288 }, { -50354, 2290 },
+    { 12537, 2296 }, { 12571, 2301 }, { -50382, 830 }, { 12568, 2301 },
+    { -50400, 833 }, { -50404, 4417 }, { -50408, 4418 }, { -50412, 4422 },
+    { -50416, 4423 }, { -50420, 4424 }, { -50424, 4427 }, { -50428, 4429 },
+    { -50432, 4430 }, { -50436, 4432 }, { -50440, 4433 }, { 12445, 3373 },
+    { -50444, 4434 }, { -50448, 4436 }, { -50452, 4437 }, { -50456, 4442 },
+    { -50460, 4443 }, { -50464, 4444 }, { -50468, 4446 }, { -50472, 4447 },
+    { -50476, 4448 }, { 12497, 3376 }, { -50480, 4449 }, { -50484, 4450 },
+    { -50488, 4451 }, { -50492, 4452 }, { -50496, 4453 }, { -50500, 4454 },
+    { -50504, 4455 }, { -50508, 4456 }, { -50512, 4457 }, { 12449, 4207 },
+    { -50516, 4459 }, { -50520, 4461 }, { -50524, 4462 }, { -50528, 4464 },
+    { 12491, 4208 }, { -50532, 4465 }, { 12496, 4209 }, { 12481, 4209 },
+    { 12497, 4209 }, { 12512, 4209 }, { 12487, 4209 }, { -50536, 4466 },
+    { -50540, 4467 }, { 12467, 4237 }, { 12468, 4237 }, { -50544, 4469 },
+    { 12518, 4239 }, { 12496, 4241 }, { -50548, 4470 }, { -50552, 4471 },
+    { 12495, 4241 }, { -50556, 4472 }, { -50567, 4475 }, { -50571, 4477 },
+    { 12497, 4245 }, { -50575, 4478 }, { -50579, 4479 }, { -50583, 4480 },
+    { -50587, 4481 }, { -50591, 4482 }, { -50595, 4487 }, { -50599, 4488 },
+    { -50603, 4489 }, { 12486, 4259 }, { -50607, 4490 }, { 12472, 4264 },
+    { 12528, 4264 }, { 12521, 4263 }, { 12481, 4267 }, { -50611, 4491 },
+    { -50615, 4494 }, { -50619, 4495 }, { 12510, 4271 }, { -50623, 4496 },
+    { 12530, 3650 }, { -50627, 4497 }, { 12535, 3650 }, { 12533, 3650 },
+    { 12540, 3650 }, { -50631, 4498 }, { 12493, 3660 }, { -50635, 4503 },
+    { 12538, 3660 }, { 12517, 3660 }, { 12545, 3666 }, { 12545, 3666 },
+    { -50639, 4504 }, { 12522, 3666 }, { 12512, 4275 }, { 12512, 4275 },
+    { -50643, 4505 }, { 12548, 4275 }, { 12525, 4275 }, { -50647, 4506 },
+    { 12548, 4283 }, { -50651, 4509 }, { -50655, 4510 }, { -50659, 4511 },
+    { -50759, 4513 }, { -50676, 4512 }, { -50763, 4514 }, { -50774, 4516 },
+    { -50778, 4517 }, { -50782, 4519 }, { 12543, 4288 }, { -50786, 4520 },
+    { -50790, 4521 }, { -50794, 4522 }, { -50798, 4523 }, { -50802, 4524 },
+    { -50806, 4526 }, { -50810, 4528 }, { -50814, 4529 }, { -50818, 4530 },
+    { -50822, 4532 }, { -50826, 4533 }, { -50830, 4534 }, { -50834, 4535 },
+    { -50838, 4536 }, { -50842, 4537 }, { -50846, 4540 }, { 12509, 4298 },
+    { -50850, 4541 }, { -50854, 4542 }, { -50891, 4543 }, { -50895, 4544 },
+    { -50899, 4545 }, { -50903, 4546 }, { -50914, 4547 }, { -50925, 4548 },
+    { 12530, 4306 }, { 12521, 4308 }, { 12564, 4308 }, { -50929, 4549 },
+    { -50933, 4550 }, { -50937, 4551 }, { -50941, 4552 }, { -50945, 4554 },
+    { -50949, 4556 }, { -50953, 4557 }, { -50957, 4559 }, { 12517, 4328 },
+    { 12547, 4328 }, { -50961, 4563 }, { 12544, 4328 }, { -50965, 4565 },
+    { -50969, 4566 }, { -50973, 4568 }, { -50977, 4570 }, { -50981, 4572 },
+    { -50985, 4577 }, { -50989, 4578 }, { -51007, 4580 }, { -51011, 4581 },
+    { -51015, 4582 }, { -51019, 4583 }, { 12569, 4343 }, { -51023, 4584 },
+    { -51027, 4585 }, { -51031, 4586 }, { -51035, 4587 }, { -51039, 4590 },
+    { -51050, 4593 }, { -51054, 4604 }, { -51058, 1069 }, { 12567, 4348 },
+    { -51062, 1087 }, { -51113, 2753 }, { 12552, 4350 }, { 12610, 1090 },
+    { 12619, 1090 }, { 12585, 2752 }, { 12619, 2752 }, { -51184, 2758 },
+    { 12621, 2766 }, { -51208, 2790 }, { -51212, 2791 }, { 12628, 2766 },
+    { -51216, 2811 }, { -51220, 4567 }, { -51224, 4569 }, { 12631, 4575 },
+    { -51235, 4579 }, { 12612, 4588 }, { -51256, 4613 }, { 12627, 4588 },
+    { 12634, 4615 }, { 12608, 4615 }, { -51274, 1395 }, { -51278, 1407 },
+    { -51302, 1408 }, { -51330, 4591 }, { -51306, 1454 }, { -51334, 4594 },
+    { -51338, 4595 }, { -51342, 4596 }, { -51346, 4597 }, { -51350, 4598 },
+    { -51354, 4599 }, { -51358, 4600 }, { -51362, 4601 }, { -51366, 4602 },
+    { -51370, 4603 }, { -51374, 4616 }, { -51405, 4617 }, { -51409, 4618 },
+    { -51413, 4622 }, { 12625, 538 }, { 12609, 539 }, { 12610, 1900 },
+    { 12651, 1902 }, { 12644, 1900 }, { 12626, 1903 }, { 12629, 1900 },
+    { 12630, 1900 }, { 12606, 1901 }, { 12651, 1901 }, { 12640, 1901 },
+    { 12664, 1905 }, { 12645, 1105 }, { 12581, 1810 }, { 12630, 1106 },
+    { 12667, 2876 }, { 12668, 1107 }, { 12642, 1901 }, { 12650, 1901 },
+    { 12545, 830 }, { 12574, 830 }, { 12657, 1901 }, { 12661, 1107 },
+    { 12651, 2874 }, { 12623, 2877 }, { 12646, 2874 }, { 12649, 1902 },
+    { 12672, 2875 }, { 12637, 2875 }, { 12659, 2876 }, { 12614, 1901 },
+    { 12661, 1978 }, { 12681, 1979 }, { 12677, 1980 }, { 12661, 1981 },
+    { 12692, 1631 }, { 12632, 1632 }, { 12648, 1633 }, { 12622, 1901 },
+    { 12680, 1854 }, { 12646, 1979 }, { 12697, 1856 }, { 12637, 1857 },
+    { 12653, 1858 }, { 12685, 2323 }, { 12686, 2325 }, { 12692, 2324 },
+    { 12665, 2327 }, { 12698, 2324 }, { 12688, 2328 }, { 12707, 729 },
+    { 12694, 3049 }, { 12723, 1492 }, { 12747, 1494 }, { 12673, 2324 },
+    { 12743, 784 }, { 12708, 2328 }, { 12696, 2324 }, { 12688, 2325 },
+    { 12614, 1901 }, { 12702, 3046 }, { 12676, 1979 }, { 12709, 3046 },
+    { 12739, 3048 }, { 12687, 3048 }, { 12716, 949 }, { 12679, 3046 },
+    { 12719, 1611 }, { 12753, 504 }, { 12708, 2328 }, { 12628, 2875 },
+    { 12634, 1633 }, { 12735, 1612 }, { 12760, 894 }, { 12757, 1611 },
+    { 12754, 3226 }, { 12768, 3228 }, { 12639, 1858 }, { 12571, 4472 },
+    { 12754, 3051 }, { 12691, 3049 }, { 12769, 3230 }, { 12658, 2327 },
+    { 12752, 3231 }, { 12686, 2328 }, { 12738, 3227 }, { 12679, 3047 },
+    { 12689, 1979 }, { 12689, 2324 }, { 12719, 948 }, { 12712, 3047 },
+    { 12699, 3048 }, { 12741, 3048 }, { 12703, 3047 }, { 12768, 986 },
+    { 12689, 3048 }, { 12676, 3047 }, { 12714, 3047 }, { 12658, 2324 },
+    { 12692, 3047 }, { 12730, 948 }, { 12755, 794 }, { 12702, 3051 },
+    { 12742, 2008 }, { 12751, 3051 }, { 12724, 504 }, { 12740, 3227 },
+    { 12749, 2010 }, { 12687, 3048 }, { 12681, 3047 }, { 12727, 3048 },
+    { 12775, 2599 }, { 12782, 2600 }, { 12702, 3048 }, { 12788, 2601 },
+    { 12777, 2013 }, { 12682, 3047 }, { 12679, 3047 }, { 12681, 3047 },
+    { 12728, 3047 }, { 12592, 4511 }, { 12551, 4512 }, { 12596, 4512 },
+    { 12685, 3047 }, { 12697, 3050 }, { 12603, 4512 }, { 12759, 2013 },
+    { 12595, 4514 }, { 12734, 2602 }, { 12722, 3047 }, { 12750, 2603 },
+    { 12756, 3394 }, { 12743, 2600 }, { 12720, 948 }, { 12800, 3396 },
+    { 12799, 3395 }, { 12686, 3047 }, { 12778, 3397 }, { 12753, 3398 },
+    { 12752, 904 }, { 12803, 3399 }, { 12766, 544 }, { 12767, 572 },
+    { 12721, 3047 }, { 12777, 3395 }, { 12739, 3050 }, { 12753, 3395 },
+    { 12581, 4542 }, { 12568, 4542 }, { 12604, 4542 }, { 12602, 4546 },
+    { 12612, 4547 }, { 12809, 907 }, { 12743, 3050 }, { 12816, 909 },
+    { 12812, 1197 }, { 12769, 1198 }, { 12789, 1202 }, { 12813, 584 },
+    { 12816, 1080 }, { 12756, 3050 }, { 12791, 1081 }, { 12800, 2027 },
+    { 12799, 3396 }, { 12758, 3399 }, { 12825, 2028 }, { 12803, 2029 },
+    { 12746, 3050 }, { 12797, 2032 }, { 12812, 1731 }, { 12739, 3395 },
+    { 12782, 3396 }, { 12698, 3050 }, { 12805, 1735 }, { 12605, 4578 },
+    { 12791, 1172 }, { 12781, 1187 }, { 12746, 3395 }, { 12811, 1842 },
+    { 12793, 1843 }, { 12822, 1844 }, { 12782, 1846 }, { 12729, 3050 },
+    { 12809, 1842 }, { 12827, 607 }, { 12776, 1030 }, { 12778, 1011 },
+    { 12787, 1257 }, { 12595, 4590 }, { 12766, 3395 }, { 12614, 2753 },
+    { 12604, 2753 }, { 12825, 1268 }, { 12585, 2753 }, { 12617, 2753 },
+    { 12811, 617 }, { 12839, 1268 }, { 12834, 2204 }, { 12819, 2205 },
+    { 12793, 2206 }, { 12811, 2207 }, { 12842, 2648 }, { 12837, 2648 },
+    { 12828, 2649 }, { 12818, 2650 }, { 12796, 658 }, { 12820, 1081 },
+    { 12837, 1303 }, { 12814, 1304 }, { 12830, 1303 }, { 12803, 1306 },
+    { 12954, 3248 }, { 12585, 1407 }, { 12956, 3251 }, { 12630, 1407 },
+    { 12632, 1454 }, { 12841, 4215 }, { 12991, 2412 }, { 12845, 4215 },
+    { 12859, 4215 }, { 12835, 4215 }, { 12838, 4215 }, { 12984, 3247 },
+    { 12954, 3249 }, { 13007, 2414 }, { 12959, 3249 }, { 12633, 4616 },
+    { 12626, 4616 }, { 12855, 4216 }, { 12974, 855 }, { 12616, 4616 },
+    { 13013, 859 }, { 12856, 4216 }, { 12855, 4216 }, { 12857, 4216 },
+    { 13010, 2416 }, { 12959, 2413 }, { 13012, 1071 }, { 12852, 4216 },
+    { 12849, 4216 }, { 12840, 4216 }, { 13023, 724 }, { 12863, 4216 },
+    { 12868, 4216 }, { 12976, 2413 }, { 12866, 4216 }, { 12878, 4216 },
+    { 12945, 3246 }, { 12990, 3246 }, { 12988, 3246 }, { 12968, 2416 },
+    { 13004, 725 }, { 12985, 3246 }, { 13013, 969 }, { 12819, 4216 },
+    { 12870, 4216 }, { 12868, 4216 }, { 12989, 3247 }, { 13027, 970 },
+    { 12879, 4216 }, { 13015, 759 }, { 13002, 764 }, { 13017, 2262 },
+    { 12847, 4216 }, { 12878, 4216 }, { 13006, 3249 }, { 12871, 4216 },
+    { 12864, 4216 }, { 13033, 2263 }, { 12986, 2264 }, { 12996, 2265 },
+    { 13013, 1597 }, { 12880, 4216 }, { 12837, 4216 }, { 12873, 4216 },
+    { 12884, 4216 }, { 12853, 4216 }, { 12997, 1598 }, { 13032, 1013 },
+    { 12968, 2413 }, { 13003, 1018 }, { 13046, 3343 }, { 12997, 3344 },
+    { 12898, 4216 }, { 12845, 4216 }, { 12851, 4216 }, { 12872, 4216 },
+    { 12895, 4216 }, { 12894, 4216 }, { 12912, 4216 }, { 12892, 4216 },
+    { 12887, 4217 }, { 12984, 3340 }, { 13037, 3340 }, { 13052, 2123 },
+    { 12981, 3340 }, { 12905, 4217 }, { 13029, 2125 }, { 12973, 725 },
+    { 12901, 4217 }, { 13039, 2128 }, { 13053, 1126 }, { 13045, 2124 },
+    { 12873, 4217 }, { 13055, 1416 }, { 13057, 1000 }, { 13038, 1004 },
+    { 13046, 666 }, { 13041, 3342 }, { 13057, 1353 }, { 13028, 2125 },
+    { 13025, 1356 }, { 12906, 4217 }, { 12910, 4217 }, { 13064, 1347 },
+    { 12909, 4217 }, { 12885, 4217 }, { 13006, 2124 }, { 13029, 717 },
+    { 12923, 4217 }, { 12890, 4217 }, { 12885, 4217 }, { 13046, 792 },
+    { 12912, 4217 }, { 12924, 4218 }, { 13057, 828 }, { 12888, 4218 },
+    { 12894, 4218 }, { 12911, 4217 }, { 13070, 1489 }, { 13052, 1444 },
+    { 12929, 4217 }, { 12943, 4218 }, { 13026, 1445 }, { 13038, 2169 },
+    { 12897, 4217 }, { 12898, 4217 }, { 13063, 2168 }, { 12905, 4218 },
+    { 12878, 4217 }, { 12929, 4217 }, { 13056, 873 }, { 12905, 4217 },
+    { 12929, 4217 }, { 12900, 4217 }, { 12916, 4217 }, { 13017, 3342 },
+    { 13056, 2168 }, { 12921, 4217 }, { 12939, 4219 }, { 13034, 1489 },
+    { 12912, 4217 }, { 13084, 2172 }, { 12943, 4217 }, { 12912, 4217 },
+    { 13086, 2172 }, { 12953, 4218 }, { 12958, 4218 }, { 13088, 913 },
+    { 13034, 1456 }, { 12927, 4219 }, { 12948, 4218 }, { 12930, 4219 },
+    { 13053, 2167 }, { 13068, 1941 }, { 13068, 2167 }, { 13081, 1942 },
+    { 13081, 1942 }, { 13061, 1945 }, { 12923, 4219 }, { 12929, 4218 },
+    { 13063, 1751 }, { 13086, 1755 }, { 13086, 1307 }, { 13086, 1751 },
+    { 13079, 1387 }, { 13054, 1558 }, { 13046, 921 }, { 13086, 929 },
+    { 13098, 935 }, { 12948, 4218 }, { 13045, 941 }, { 12937, 4219 },
+    { 12966, 4220 }, { 13092, 962 }, { 12926, 4220 }, { 12911, 4219 },
+    { 13104, 1777 }, { 13060, 978 }, { 12976, 4220 }, { 13102, 3739 },
+    { 13177, 1052 }, { 13170, 1054 }, { 12950, 4219 }, { 13199, 1589 },
+    { 13198, 1590 }, { 13165, 2578 }, { 12938, 4219 }, { 13202, 2579 },
+    { 12948, 4219 }, { 13204, 2582 }, { 12972, 4219 }, { 12949, 4219 },
+    { 12972, 4219 }, { 13170, 1041 }, { 13169, 1045 }, { 12966, 4220 },
+    { 12999, 3341 }, { 12970, 4219 }, { 12965, 4220 }, { 12984, 4220 },
+    { 12970, 4220 }, { 12956, 4219 }, { 12982, 4220 }, { 13218, 1086 },
+    { 13047, 1751 }, { 12954, 4220 }, { 12981, 4220 }, { 13171, 1100 },
+    { 13197, 1139 }, { 13031, 3341 }, { 13110, 3740 }, { 13082, 3740 },
+    { 13103, 3740 }, { 13203, 1141 }, { 13089, 3740 }, { 12949, 4220 },
+    { 12996, 4220 }, { 13093, 3740 }, { 13172, 1703 }, { 13197, 1108 },
+    { 12989, 3341 }, { 13196, 1036 }, { 12948, 4220 }, { 13167, 2577 },
+    { 13175, 2577 }, { 13156, 2577 }, { 13209, 2577 }, { 13184, 1113 },
+    { 13200, 1119 }, { 13005, 3341 }, { 12978, 4220 }, { 13042, 3341 },
+    { 13033, 3341 }, { 13202, 1036 }, { 13018, 3341 }, { 13182, 2578 },
+    { 13192, 1129 }, { 13210, 1181 }, { 13229, 2135 }, { 13104, 3741 },
+    { 13184, 2137 }, { 13049, 3341 }, { 13111, 3741 }, { 13191, 2138 },
+    { 13113, 3741 }, { 13190, 1648 }, { 13179, 1649 }, { 13121, 3741 },
+    { 13075, 3741 }, { 13099, 3741 }, { 13120, 3741 }, { 13148, 1036 },
+    { 13128, 3741 }, { 13207, 1650 }, { 12997, 3341 }, { 13191, 1203 },
+    { 13079, 3741 }, { 13187, 1231 }, { 13118, 3741 }, { 13226, 1235 },
+    { 13207, 3645 }, { 13108, 3741 }, { 13117, 3742 }, { 13176, 1108 },
+    { 13091, 3742 }, { 13204, 3646 }, { 13106, 3741 }, { 13086, 3741 },
+    { 13249, 3649 }, { 13198, 1241 }, { 13242, 1737 }, { 13239, 1713 },
+    { 13205, 1036 }, { 13095, 3741 }, { 13089, 3741 }, { 13116, 3741 },
+    { 13233, 1714 }, { 13115, 3741 }, { 13115, 3741 }, { 13141, 3741 },
+    { 13211, 1716 }, { 13162, 3743 }, { 13209, 1246 }, { 13100, 3742 },
+    { 13127, 3741 }, { 13201, 3648 }, { 13135, 3742 }, { 13128, 3742 },
+    { 13145, 3742 }, { 13256, 1279 }, { 13207, 1289 }, { 13108, 3742 },
+    { 13230, 1297 }, { 13158, 3743 }, { 13251, 3648 }, { 13151, 3742 },
+    { 13236, 3647 }, { 13138, 3741 }, { 13141, 3743 }, { 13107, 3741 },
+    { 13210, 1301 }, { 13209, 1375 }, { 13239, 3646 }, { 13238, 1378 },
+    { 13254, 1313 }, { 13256, 1320 }, { 13095, 3742 }, { 13122, 3742 },
+    { 13157, 3742 }, { 13145, 3742 }, { 13144, 3742 }, { 13196, 3648 },
+    { 13129, 3742 }, { 13134, 3742 }, { 13164, 3744 }, { 13190, 3647 },
+    { 13263, 1358 }, { 13214, 1365 }, { 13128, 3742 }, { 13234, 1400 },
+    { 13160, 3743 }, { 13137, 3744 }, { 13225, 1422 }, { 13137, 3745 },
+    { 13219, 1440 }, { 13175, 3745 }, { 13237, 1460 }, { 13177, 3744 },
+    { 13128, 3743 }, { 13250, 1463 }, { 13244, 1620 }, { 13270, 1624 },
+    { 13213, 3647 }, { 13226, 1485 }, { 13225, 1930 }, { 13286, 1505 },
+    { 13246, 1931 }, { 13133, 3743 }, { 13118, 3743 }, { 13135, 3743 },
+    { 13145, 3743 }, { 13143, 3745 }, { 13286, 3149 }, { 13161, 3744 },
+    { 13261, 1289 }, { 13138, 3745 }, { 13187, 3745 }, { 13165, 3744 },
+    { 13238, 1933 }, { 13145, 3745 }, { 13290, 3150 }, { 13251, 1931 },
+    { 13168, 3745 }, { 13185, 3745 }, { 13126, 3744 }, { 13252, 1931 },
+    { 13264, 3152 }, { 13282, 1933 }, { 13123, 3744 }, { 13244, 1515 },
+    { 13151, 3744 }, { 13270, 2759 }, { 13267, 1930 }, { 13247, 3149 },
+    { 13287, 3153 }, { 13236, 3153 }, { 13254, 2760 }, { 13284, 2761 },
+    { 13266, 2763 }, { 13294, 1783 }, { 13180, 3744 }, { 13276, 1783 },
+    { 13225, 1931 }, { 13296, 1784 }, { 13279, 2842 }, { 13255, 2843 },
+    { 13248, 2843 }, { 13294, 2844 }, { 13254, 2846 }, { 13298, 1542 },
+    { 13292, 2141 }, { 13253, 2143 }, { 13261, 1860 }, { 13290, 1549 },
+    { 13265, 2843 }, { 13313, 1556 }, { 13263, 1561 }, { 13268, 1795 },
+    { 13265, 1959 }, { 13299, 1960 }, { 13298, 1585 }, { 13301, 1956 },
+    { 13294, 1973 }, { 13320, 2549 }, { 13311, 2550 }, { 13282, 2552 },
+    { 13274, 2760 }, { 13323, 1600 }, { 13306, 1609 }, { 13317, 1959 },
+    { 13288, 1819 }, { 13297, 1820 }, { 13326, 4407 }, { 13320, 4408 },
+    { 13371, 4411 }, { 13357, 1895 }, { 13325, 1636 }, { 13348, 1660 },
+    { 13328, 4408 }, { 13308, 4408 }, { 13283, 4408 }, { 13295, 4408 },
+    { 13358, 2101 }, { 13317, 4408 }, { 13367, 2102 }, { 13383, 2041 },
+    { 13253, 1784 }, { 13334, 4408 }, { 13311, 4408 }, { 13318, 4411 },
+    { 13385, 3763 }, { 13366, 3763 }, { 13393, 1666 }, { 13382, 1995 },
+    { 13310, 4410 }, { 13377, 3763 }, { 13360, 1688 }, { 13336, 4411 },
+    { 13360, 4412 }, { 13369, 4411 }, { 13292, 1819 }, { 13411, 3862 },
+    { 13321, 4408 }, { 13302, 4408 }, { 13279, 1820 }, { 13347, 4408 },
+    { 13345, 4409 }, { 13323, 2549 }, { 13376, 3759 }, { 13309, 4408 },
+    { 13325, 4409 }, { 13366, 4412 }, { 13360, 3759 }, { 13321, 4409 },
+    { 13376, 3759 }, { 13359, 3759 }, { 13323, 4412 }, { 13308, 4410 },
+    { 13378, 3865 }, { 13366, 4410 }, { 13398, 3867 }, { 13358, 4409 },
+    { 13316, 4410 }, { 13423, 3863 }, { 13413, 2116 }, { 13327, 3760 },
+    { 13365, 4412 }, { 13340, 3760 }, { 13321, 4408 }, { 13386, 3760 },
+    { 13358, 4410 }, { 13382, 3863 }, { 13369, 4410 }, { 13418, 2886 },
+    { 13350, 3762 }, { 13438, 2882 }, { 13349, 4408 }, { 13402, 2115 },
+    { 13371, 3761 }, { 13430, 1699 }, { 13357, 3761 }, { 13445, 3825 },
+    { 13417, 3828 }, { 13326, 4409 }, { 13429, 2115 }, { 13320, 4409 },
+    { 13340, 3760 }, { 13453, 3827 }, { 13308, 4410 }, { 13356, 3761 },
+    { 13351, 3761 }, { 13375, 3761 }, { 13399, 2882 }, { 13426, 2115 },
+    { 13469, 3829 }, { 13363, 4409 }, { 13425, 3864 }, { 13390, 3760 },
+    { 13404, 3762 }, { 13357, 3762 }, { 13436, 3830 }, { 13409, 3863 },
+    { 13405, 3864 }, { 13456, 2043 }, { 13444, 2046 }, { 13364, 3762 },
+    { 13420, 3864 }, { 13372, 3760 }, { 13449, 1836 }, { 13424, 3864 },
+    { 13429, 2882 }, { 13371, 3864 }, { 13391, 2883 }, { 13433, 2883 },
+    { 13457, 1732 }, { 13406, 2884 }, { 13422, 2884 }, { 13429, 2884 },
+    { 13348, 3760 }, { 13362, 3760 }, { 13436, 2883 }, { 13386, 3760 },
+    { 13391, 2882 }, { 13483, 4623 }, { 13441, 4625 }, { 13478, 4623 },
+    { 13483, 4628 }, { 13440, 2884 }, { 13400, 3826 }, { 13426, 2882 },
+    { 13349, 3762 }, { 13362, 3762 }, { 13402, 2884 }, { 13425, 3826 },
+    { 13426, 3826 }, { 13413, 3827 }, { 13501, 4626 }, { 13434, 3826 },
+    { 13433, 1832 }, { 13458, 2508 }, { 13448, 2883 }, { 13407, 2883 },
+    { 13458, 4625 }, { 13468, 1832 }, { 13442, 2883 }, { 13430, 4624 },
+    { 13457, 4625 }, { 13428, 4624 }, { 13439, 4624 }, { 13499, 2509 },
+    { 13448, 4624 }, { 13409, 2883 }, { 13455, 2512 }, { 13479, 4626 },
+    { 13430, 4624 }, { 13446, 4627 }, { 13497, 4627 }, { 13441, 2883 },
+    { 13462, 2150 }, { 13501, 2151 }, { 13508, 2154 }, { 13446, 4625 },
+    { 13462, 2011 }, { 13462, 2014 }, { 13468, 1742 }, { 13477, 3319 },
+    { 13451, 1832 }, { 13500, 3319 }, { 13484, 3318 }, { 13525, 3320 },
+    { 13474, 3321 }, { 13523, 3331 }, { 13512, 3332 }, { 13533, 3334 },
+    { 13501, 3335 }, { 13463, 1832 }, { 13494, 3336 }, { 13535, 4228 },
+    { 13480, 4226 }, { 13532, 1769 }, { 13493, 4627 }, { 13485, 4226 },
+    { 13539, 1989 }, { 13512, 4226 }, { 13523, 3336 }, { 13474, 4624 },
+    { 13472, 3332 }, { 13514, 4230 }, { 13554, 2088 }, { 13558, 1985 },
+    { 13539, 2091 }, { 13515, 4227 }, { 13514, 2092 }, { 13557, 1994 },
+    { 13541, 1998 }, { 13572, 1790 }, { 13495, 4227 }, { 13547, 4229 },
+    { 13523, 2054 }, { 13542, 4227 }, { 13458, 4627 }, { 13531, 4231 },
+    { 13468, 4624 }, { 13531, 2108 }, { 13504, 3319 }, { 13523, 4227 },
+    { 13554, 1831 }, { 13522, 4230 }, { 13526, 1849 }, { 13545, 4227 },
+    { 13500, 4627 }, { 13516, 3318 }, { 13543, 1985 }, { 13463, 3318 },
+    { 13570, 1881 }, { 13540, 4229 }, { 13533, 1883 }, { 13485, 4227 },
+    { 13564, 1849 }, { 13533, 4231 }, { 13531, 4228 }, { 13576, 2675 },
+    { 13547, 4228 }, { 13575, 2676 }, { 13487, 3335 }, { 13497, 3321 },
+    { 13541, 4227 }, { 13527, 2677 }, { 13546, 4229 }, { 13545, 2146 },
+    { 13524, 4231 }, { 13555, 4231 }, { 13538, 1886 }, { 13496, 4229 },
+    { 13509, 3332 }, { 13551, 2075 }, { 13545, 2077 }, { 13560, 2132 },
+    { 13569, 1909 }, { 13537, 4229 }, { 13568, 2350 }, { 13595, 1926 },
+    { 13565, 2194 }, { 13592, 2228 }, { 13547, 2230 }, { 13553, 1951 },
+    { 13504, 4229 }, { 13551, 2095 }, { 13601, 2099 }, { 13598, 2254 },
+    { 13592, 2255 }, { 13552, 2257 }, { 13526, 4227 }, { 13599, 2095 },
+    { 13549, 1983 }, { 13579, 1991 }, { 13598, 2030 }, { 13562, 2035 },
+    { 13566, 2739 }, { 13580, 2740 }, { 13590, 2724 }, { 13558, 2725 },
+    { 13604, 2726 }, { 13594, 3116 }, { 13541, 1849 }, { 13586, 2677 },
+    { 13608, 3118 }, { 13578, 3117 }, { 13584, 3121 }, { 13575, 2725 },
+    { 13600, 2159 }, { 13575, 2163 }, { 13585, 2040 }, { 13591, 2611 },
+    { 13612, 2612 }, { 13616, 3172 }, { 13581, 3173 }, { 13613, 3174 },
+    { 13559, 1991 }, { 13591, 3117 }, { 13627, 2408 }, { 13574, 2159 },
+    { 13590, 3181 }, { 13605, 3182 }, { 13582, 3183 }, { 13622, 3184 },
+    { 13633, 2078 }, { 13634, 2081 }, { 13625, 2051 }, { 13639, 2052 },
+    { 13637, 4395 }, { 13645, 4396 }, { 13617, 4396 }, { 13651, 4396 },
+    { 13704, 2424 }, { 13623, 4396 }, { 13636, 4396 }, { 13587, 4396 },
+    { 13649, 4396 }, { 13728, 4636 }, { 13601, 2254 }, { 13631, 4397 },
+    { 13593, 3182 }, { 13708, 2060 }, { 13751, 2593 }, { 13652, 4397 },
+    { 13586, 3182 }, { 13735, 2594 }, { 13658, 4397 }, { 13700, 4632 },
+    { 13630, 4397 }, { 13713, 2232 }, { 13643, 4397 }, { 13673, 4397 },
+    { 13657, 4397 }, { 13650, 4397 }, { 13655, 4397 }, { 13721, 2234 },
+    { 13704, 4632 }, { 13612, 4397 }, { 13704, 4633 }, { 13756, 4633 },
+    { 13755, 2066 }, { 13632, 4397 }, { 13718, 4399 }, { 13757, 4608 },
+    { 13730, 4636 }, { 13650, 4397 }, { 13654, 4397 }, { 13736, 4633 },
+    { 13687, 4399 }, { 13753, 4605 }, { 13630, 4398 }, { 13764, 2422 },
+    { 13756, 4605 }, { 13668, 4399 }, { 13674, 4397 }, { 13617, 4397 },
+    { 13767, 4642 }, { 13731, 4399 }, { 13775, 4645 }, { 13786, 4646 },
+    { 13768, 4645 }, { 13791, 2505 }, { 13716, 4400 }, { 13647, 4398 },
+    { 13690, 4398 }, { 13810, 2239 }, { 13667, 4397 }, { 13680, 4397 },
+    { 13681, 4399 }, { 13687, 4400 }, { 13750, 4635 }, { 13649, 4398 },
+    { 13659, 4398 }, { 13724, 4400 }, { 13677, 4397 }, { 13634, 4397 },
+    { 13676, 4397 }, { 13726, 4401 }, { 13699, 4398 }, { 13707, 4400 },
+    { 13665, 4397 }, { 13673, 4398 }, { 13788, 2503 }, { 13732, 4635 },
+    { 13796, 2243 }, { 13771, 4608 }, { 13670, 4399 }, { 13803, 2524 },
+    { 13676, 4399 }, { 13718, 4399 }, { 13722, 4399 }, { 13806, 2588 },
+    { 13807, 2620 }, { 13819, 2503 }, { 13684, 4398 }, { 13750, 4635 },
+    { 13819, 2624 }, { 13698, 4398 }, { 13734, 4608 }, { 13678, 4400 },
+    { 13750, 4608 }, { 13701, 4398 }, { 13795, 2441 }, { 13692, 4401 },
+    { 13764, 4644 }, { 13795, 4610 }, { 13776, 4644 }, { 13776, 4645 },
+    { 13723, 4401 }, { 13690, 4398 }, { 13742, 4401 }, { 13770, 4644 },
+    { 13673, 4398 }, { 13704, 4401 }, { 13725, 4401 }, { 13738, 4400 },
+    { 13738, 4400 }, { 13707, 4401 }, { 13767, 4607 }, { 13728, 4401 },
+    { 13709, 4606 }, { 13737, 4606 }, { 13780, 4609 }, { 13809, 3868 },
+    { 13741, 4610 }, { 13737, 4400 }, { 13735, 4606 }, { 13762, 2502 },
+    { 13806, 3870 }, { 13738, 4609 }, { 13717, 4606 }, { 13760, 4606 },
+    { 13814, 3871 }, { 13814, 2502 }, { 13794, 4644 }, { 13803, 4643 },
+    { 13786, 2318 }, { 13734, 4607 }, { 13741, 4610 }, { 13748, 4607 },
+    { 13787, 4610 }, { 13786, 2317 }, { 13879, 2119 }, { 13716, 4606 },
+    { 13748, 4606 }, { 13757, 4643 }, { 13869, 2134 }, { 13747, 4643 },
+    { 13773, 4609 }, { 13829, 4648 }, { 13789, 4648 }, { 13877, 2654 },
+    { 13894, 2655 }, { 13881, 2658 }, { 13724, 4607 }, { 13848, 2336 },
+    { 13842, 2339 }, { 13760, 4607 }, { 13864, 3815 }, { 13888, 2340 },
+    { 13877, 3820 }, { 13847, 3817 }, { 13852, 3817 }, { 13876, 3819 },
+    { 13722, 4606 }, { 13858, 3817 }, { 13796, 2502 }, { 13748, 4609 },
+    { 13878, 2216 }, { 13798, 4643 }, { 13870, 2340 }, { 13824, 2317 },
+    { 13757, 4606 }, { 13832, 4649 }, { 13849, 4650 }, { 13745, 4609 },
+    { 13774, 4643 }, { 13879, 2237 }, { 13749, 4643 }, { 13779, 4606 },
+    { 13800, 4649 }, { 13788, 4649 }, { 13904, 4638 }, { 13856, 4639 },
+    { 13850, 3819 }, { 13838, 4649 }, { 13912, 4641 }, { 13838, 4652 },
+    { 13821, 4652 }, { 13850, 4652 }, { 13874, 2244 }, { 13795, 4650 },
+    { 13917, 4640 }, { 13885, 2376 }, { 13802, 4650 }, { 13884, 2379 },
+    { 13895, 2278 }, { 13919, 4654 }, { 13834, 4649 }, { 13890, 4656 },
+    { 13849, 4652 }, { 13861, 4637 }, { 13885, 4659 }, { 13853, 4652 },
+    { 13789, 4649 }, { 13908, 2517 }, { 13788, 4649 }, { 13832, 4649 },
+    { 13880, 4637 }, { 13914, 2678 }, { 13875, 4640 }, { 13837, 4650 },
+    { 13805, 4650 }, { 13846, 4652 }, { 13810, 4651 }, { 13879, 2519 },
+    { 13922, 2517 }, { 13838, 4649 }, { 13879, 4655 }, { 13898, 2710 },
+    { 13897, 2521 }, { 13938, 2711 }, { 13861, 4650 }, { 13800, 4649 },
+    { 13813, 4649 }, { 13802, 4649 }, { 13849, 4649 }, { 13844, 4649 },
+    { 13840, 4649 }, { 13830, 4651 }, { 13924, 2519 }, { 13895, 2521 },
+    { 13886, 2713 }, { 13866, 4651 }, { 13914, 4660 }, { 13822, 4651 },
+    { 13902, 2244 }, { 13916, 2521 }, { 13880, 4661 }, { 13944, 4662 },
+    { 13890, 4637 }, { 13870, 4652 }, { 13867, 4651 }, { 13898, 4663 },
+    { 13890, 2429 }, { 13935, 4664 }, { 13919, 2430 }, { 13838, 4652 },
+    { 13811, 4651 }, { 13808, 4651 }, { 13874, 4653 }, { 13926, 3382 },
+    { 13956, 3385 }, { 13820, 4653 }, { 13950, 3387 }, { 13954, 4674 },
+    { 13865, 4637 }, { 13879, 4653 }, { 13923, 4664 }, { 13864, 4653 },
+    { 13858, 4653 }, { 13854, 4653 }, { 13822, 4651 }, { 13853, 4651 },
+    { 13946, 3383 }, { 13856, 4651 }, { 13911, 4655 }, { 13919, 4665 },
+    { 13921, 4665 }, { 13841, 4653 }, { 13897, 4666 }, { 13947, 3383 },
+    { 13984, 4668 }, { 13974, 2284 }, { 13976, 2284 }, { 13831, 4653 },
+    { 13872, 4653 }, { 13956, 4676 }, { 13983, 4669 }, { 13906, 4666 },
+    { 13940, 4668 }, { 13940, 4666 }, { 13963, 4669 }, { 13942, 4669 },
+    { 13991, 4669 }, { 14024, 2478 }, { 13962, 4666 }, { 14007, 4679 },
+    { 13955, 4666 }, { 13984, 2479 }, { 14012, 2681 }, { 13973, 2289 },
+    { 13911, 4663 }, { 13964, 4670 }, { 13907, 4666 }, { 13972, 2293 },
+    { 13983, 4677 }, { 13966, 2314 }, { 13950, 4670 }, { 13971, 4675 },
+    { 13924, 4667 }, { 13930, 4668 }, { 13914, 4666 }, { 13935, 4666 },
+    { 13938, 4667 }, { 13981, 4675 }, { 13919, 4667 }, { 13973, 4667 },
+    { 13988, 4675 }, { 13989, 4670 }, { 14013, 2393 }, { 13939, 4666 },
+    { 13935, 4666 }, { 13959, 4667 }, { 13900, 3383 }, { 13927, 3383 },
+    { 13999, 2396 }, { 13971, 4667 }, { 13956, 4667 }, { 13959, 4677 },
+    { 14019, 2332 }, { 13975, 4675 }, { 13932, 4666 }, { 13974, 4679 },
+    { 13974, 4667 }, { 13979, 4669 }, { 13979, 4669 }, { 13922, 4666 },
+    { 13944, 4667 }, { 13993, 4678 }, { 13936, 4669 }, { 14004, 4675 },
+    { 13962, 4670 }, { 13961, 2476 }, { 13984, 4680 }, { 13999, 4678 },
+    { 14024, 4680 }, { 14030, 4681 }, { 14040, 4685 }, { 13999, 4675 },
+    { 13923, 4667 }, { 13952, 4677 }, { 14023, 2618 }, { 13966, 4667 },
+    { 14002, 2476 }, { 14002, 4678 }, { 14032, 4684 }, { 13993, 4683 },
+    { 14023, 2476 }, { 13998, 4684 }, { 13958, 4675 }, { 13971, 4675 },
+    { 13981, 2393 }, { 14046, 4683 }, { 14000, 4682 }, { 14009, 2461 },
+    { 13985, 4681 }, { 13989, 4682 }, { 14058, 2346 }, { 14026, 4683 },
+    { 14001, 4682 }, { 14048, 2460 }, { 14049, 2361 }, { 14041, 2460 },
+    { 14061, 2420 }, { 14022, 4681 }, { 14042, 2434 }, { 14030, 2443 },
+    { 14037, 2455 }, { 14039, 4683 }, { 14047, 2483 }, { 14006, 2486 },
+    { 14032, 4686 }, { 14084, 2537 }, { 14042, 4688 }, { 14034, 2538 },
+    { 14018, 4686 }, { 14014, 4686 }, { 14079, 4689 }, { 14018, 4687 },
+    { 14089, 2497 }, { 14082, 2695 }, { 14002, 2461 }, { 14019, 4686 },
+    { 14069, 2765 }, { 14060, 4690 }, { 13985, 4682 }, { 14041, 4686 },
+    { 14081, 4688 }, { 14022, 4684 }, { 14089, 2541 }, { 14061, 4689 },
+    { 14057, 2693 }, { 14087, 2556 }, { 14005, 2361 }, { 14093, 2580 },
+    { 14054, 2583 }, { 14049, 2609 }, { 14081, 2750 }, { 14032, 4690 },
+    { 14073, 2755 }, { 14102, 2617 }, { 14023, 4682 }, { 14079, 4689 },
+    { 14090, 2698 }, { 14052, 2460 }, { 14048, 4690 }, { 14059, 3878 },
+    { 14105, 3878 }, { 14053, 3879 }, { 14072, 3881 }, { 14027, 4688 },
+    { 14050, 4688 }, { 14014, 4682 }, { 14096, 2693 }, { 14110, 3882 },
+    { 14090, 2706 }, { 14035, 4686 }, { 14024, 4687 }, { 14041, 4687 },
+    { 14075, 2707 }, { 14051, 4686 }, { 14016, 4687 }, { 14024, 4687 },
+    { 14087, 3883 }, { 14047, 4687 }, { 14070, 3883 }, { 14059, 4687 },
+    { 14122, 2715 }, { 14109, 3065 }, { 14068, 3883 }, { 14052, 4687 },
+    { 14081, 2733 }, { 14111, 2754 }, { 14078, 2768 }, { 14108, 3100 },
+    { 14121, 2782 }, { 14072, 2785 }, { 14061, 3883 }, { 14121, 3042 },
+    { 14082, 2789 }, { 14059, 3879 }, { 14129, 2794 }, { 14124, 2797 },
+    { 14115, 3893 }, { 14089, 3883 }, { 14118, 3883 }, { 14083, 3894 },
+    { 14136, 3894 }, { 14130, 3895 }, { 14132, 3897 }, { 14112, 3898 },
+    { 14138, 4691 }, { 14147, 4692 }, { 14144, 4692 }, { 14101, 3894 },
+    { 14111, 4693 }, { 14090, 3881 }, { 14131, 4694 }, { 14159, 3062 },
+    { 14106, 3881 }, { 14142, 4691 }, { 14120, 3311 }, { 14132, 4691 },
+    { 14165, 3314 }, { 14163, 3345 }, { 14137, 4691 }, { 14150, 4695 },
+    { 14106, 4695 }, { 14131, 4694 }, { 14158, 3347 }, { 14159, 4693 },
+    { 14173, 3349 }, { 14141, 3346 }, { 14163, 4695 }, { 14143, 4691 },
+    { 14182, 2816 }, { 14125, 4695 }, { 14119, 3346 }, { 14173, 3188 },
+    { 14076, 2768 }, { 14178, 3188 }, { 14180, 3189 }, { 14175, 3081 },
+    { 14155, 4692 }, { 14136, 3081 }, { 14157, 3282 }, { 14101, 4692 },
+    { 14190, 3283 }, { 14180, 3286 }, { 14139, 2824 }, { 14121, 4695 },
+    { 14182, 2828 }, { 14181, 3069 }, { 14185, 2827 }, { 14180, 2853 },
+    { 14187, 2854 }, { 14187, 3209 }, { 14122, 4695 }, { 14200, 3156 },
+    { 14103, 4693 }, { 14140, 4693 }, { 14160, 4695 }, { 14112, 4694 },
+    { 14167, 2854 }, { 14142, 4693 }, { 14142, 4691 }, { 14173, 3160 },
+    { 14119, 4691 }, { 14193, 2851 }, { 14154, 3092 }, { 14119, 4694 },
+    { 14180, 3886 }, { 14179, 3890 }, { 14207, 2888 }, { 14178, 2890 },
+    { 14211, 2911 }, { 14123, 4694 }, { 14174, 3282 }, { 14199, 3156 },
+    { 14196, 3095 }, { 14211, 3098 }, { 14212, 2967 }, { 14203, 4142 },
+    { 14186, 4145 }, { 14208, 3105 }, { 14184, 3108 }, { 14169, 3097 },
+    { 14192, 3886 }, { 14210, 3106 }, { 14190, 3122 }, { 14212, 3123 },
+    { 14219, 3159 }, { 14213, 3400 }, { 14228, 3168 }, { 14182, 3170 },
+    { 14207, 3177 }, { 14219, 3413 }, { 14201, 3186 }, { 14225, 3190 },
+    { 14178, 4065 }, { 14201, 4068 }, { 14224, 3872 }, { 14225, 3892 },
+    { 14237, 3203 }, { 14199, 3506 }, { 14208, 4697 }, { 14200, 4697 },
+    { 14212, 4697 }, { 14283, 3252 }, { 14230, 4697 }, { 14295, 3253 },
+    { 14211, 4697 }, { 14252, 3210 }, { 14197, 2854 }, { 14242, 4698 },
+    { 14221, 4698 }, { 14186, 4698 }, { 14242, 4698 }, { 14291, 3239 },
+    { 14301, 3239 }, { 14216, 4699 }, { 14232, 4701 }, { 14202, 4698 },
+    { 14285, 3239 }, { 14234, 4698 }, { 14244, 4698 }, { 14229, 4698 },
+    { 14222, 4699 }, { 14265, 4699 }, { 14283, 4702 }, { 14231, 4699 },
+    { 14213, 4699 }, { 14262, 3253 }, { 14305, 3288 }, { 14270, 4699 },
+    { 14267, 3254 }, { 14259, 3289 }, { 14304, 3292 }, { 14306, 3605 },
+    { 14293, 4703 }, { 14337, 3324 }, { 14176, 3159 }, { 14224, 4700 },
+    { 14240, 4699 }, { 14253, 4698 }, { 14242, 4698 }, { 14254, 4699 },
+    { 14244, 4702 }, { 14237, 4698 }, { 14232, 4700 }, { 14219, 4700 },
+    { 14216, 4699 }, { 14275, 4699 }, { 14290, 4702 }, { 14236, 4698 },
+    { 14227, 4698 }, { 14204, 4698 }, { 14339, 3390 }, { 14238, 4701 },
+    { 14281, 4701 }, { 14247, 4702 }, { 14267, 4700 }, { 14298, 3211 },
+    { 14261, 3240 }, { 14249, 3210 }, { 14260, 4701 }, { 14211, 4698 },
+    { 14324, 4706 }, { 14249, 3254 }, { 14248, 4698 }, { 14280, 3240 },
+    { 14284, 4706 }, { 14271, 3240 }, { 14299, 4707 }, { 14284, 4701 },
+    { 14242, 4701 }, { 14313, 4704 }, { 14278, 4704 }, { 14320, 4707 },
+    { 14315, 4704 }, { 14218, 4700 }, { 14267, 4705 }, { 14301, 4705 },
+    { 14317, 3391 }, { 14305, 4708 }, { 14334, 4707 }, { 14301, 4708 },
+    { 14332, 3977 }, { 14291, 4706 }, { 14339, 3981 }, { 14343, 4713 },
+    { 14333, 3391 }, { 14311, 4704 }, { 14327, 3323 }, { 14336, 4714 },
+    { 14291, 4712 }, { 14312, 4705 }, { 14295, 4712 }, { 14305, 4707 },
+    { 14277, 4705 }, { 14284, 4705 }, { 14313, 4716 }, { 14333, 3323 },
+    { 14342, 3671 }, { 14326, 3323 }, { 14306, 4715 }, { 14304, 4715 },
+    { 14349, 3635 }, { 14310, 3639 }, { 14345, 3680 }, { 14345, 3232 },
+    { 14323, 3837 }, { 14339, 3611 }, { 14366, 3234 }, { 14368, 3263 },
+    { 14338, 3234 }, { 14293, 3323 }, { 14373, 4561 }, { 14332, 4560 },
+    { 14273, 4704 }, { 14369, 4560 }, { 14330, 4713 }, { 14342, 4564 },
+    { 14320, 4562 }, { 14322, 4713 }, { 14374, 3277 }, { 14370, 3753 },
+    { 14288, 3977 }, { 14373, 4560 }, { 14369, 3755 }, { 14331, 3756 },
+    { 14301, 4713 }, { 14382, 3754 }, { 14366, 3746 }, { 14358, 3749 },
+    { 14382, 3329 }, { 14350, 3338 }, { 14374, 3418 }, { 14370, 4717 },
+    { 14399, 4720 }, { 14351, 4722 }, { 14407, 4721 }, { 14341, 3754 },
+    { 14379, 4561 }, { 14333, 4716 }, { 14292, 3323 }, { 14393, 4719 },
+    { 14364, 3527 }, { 14354, 4719 }, { 14408, 3924 }, { 14334, 4716 },
+    { 14409, 3686 }, { 14359, 4719 }, { 14355, 4721 }, { 14362, 3735 },
+    { 14362, 3772 }, { 14363, 3773 }, { 14401, 4719 }, { 14395, 3776 },
+    { 14416, 3785 }, { 14401, 4721 }, { 14336, 3754 }, { 14408, 4722 },
+    { 14347, 4561 }, { 14410, 3783 }, { 14405, 3783 }, { 14412, 3788 },
+    { 14401, 3792 }, { 14414, 4040 }, { 14338, 4561 }, { 14377, 4562 },
+    { 14391, 4719 }, { 14341, 3754 }, { 14404, 4719 }, { 14402, 3804 },
+    { 14420, 4198 }, { 14397, 4199 }, { 14416, 4200 }, { 14391, 3809 },
+    { 14426, 3812 }, { 14420, 3821 }, { 14385, 4720 }, { 14429, 3813 },
+    { 14382, 3813 }, { 14356, 3735 }, { 14432, 4369 }, { 14429, 4373 },
+    { 14392, 4087 }, { 14439, 3832 }, { 14388, 3842 }, { 14433, 4094 },
+    { 14390, 3861 }, { 14430, 4304 }, { 14385, 3812 }, { 14396, 4305 },
+    { 14442, 4304 }, { 14424, 4304 }, { 14441, 4309 }, { 14451, 3875 },
+    { 14401, 4304 }, { 14430, 4499 }, { 14395, 4500 }, { 14395, 4501 },
+    { 14434, 3887 }, { 14407, 3899 }, { 14453, 4054 }, { 14455, 4055 },
+    { 14437, 3900 }, { 14456, 4146 }, { 14441, 4147 }, { 14433, 4232 },
+    { 14416, 4233 }, { 14460, 3920 }, { 14451, 3922 }, { 14463, 4723 },
+    { 14446, 4724 }, { 14431, 4726 }, { 14441, 3953 }, { 14417, 4260 },
+    { 14440, 4311 }, { 14461, 3988 }, { 14442, 3992 }, { 14456, 3982 },
+    { 14430, 3812 }, { 14446, 4351 }, { 14465, 4000 }, { 14474, 4294 },
+    { 14456, 4294 }, { 14450, 4295 }, { 14435, 4369 }, { 14434, 4297 },
+    { 14454, 4126 }, { 14480, 4130 }, { 14444, 4420 }, { 14478, 4435 },
+    { 14487, 4438 }, { 14441, 4295 }, { 14479, 4439 }, { 14479, 4731 },
+    { 14452, 4732 }, { 14467, 4734 }, { 14493, 4734 }, { 14465, 4735 },
+    { 14500, 4736 }, { 14478, 4739 }, { 14496, 4737 }, { 14481, 4741 },
+    { 14448, 4305 }, { 14468, 4738 }, { 14463, 4738 }, { 14478, 4737 },
+    { 14473, 4295 }, { 14502, 4058 }, { 14498, 4741 }, { 14471, 4736 },
+    { 14459, 4737 }, { 14482, 4069 }, { 14500, 4630 }, { 14516, 4631 },
+    { 14506, 4634 }, { 14495, 4334 }, { 14458, 4555 }, { 14507, 4141 },
+    { 14510, 4144 }, { 14475, 4734 }, { 14494, 4734 }, { 14472, 4742 },
+    { 14520, 4744 }, { 14483, 4742 }, { 14525, 4743 }, { 14478, 4743 },
+    { 14484, 4745 }, { 14520, 4746 }, { 14471, 4368 }, { 14521, 4742 },
+    { 14484, 4276 }, { 14485, 4357 }, { 14518, 4361 }, { 14508, 4326 },
+    { 14494, 4362 }, { 14489, 4732 }, { 14477, 4391 }, { 14492, 4415 },
+    { 14486, 4735 }, { 14487, 4421 }, { 14513, 4473 }, { 14488, 4474 },
+    { 14498, 4743 }, { 14446, 4737 }, { 14493, 4431 }, { 14496, 4440 },
+    { 14492, 4732 }, { 14541, 4458 }, { 14517, 4476 }, { 14531, 4484 },
+    { 14540, 4485 }, { 14521, 4527 }, { 14542, 4531 }, { 14541, 4747 },
+    { 14552, 4748 }, { 14502, 4751 }, { 14539, 4752 }, { 14557, 4758 },
+    { 14465, 4737 }, { 14514, 4508 }, { 14546, 4768 }, { 14550, 4553 },
+    { 14548, 4788 }, { 14512, 4573 }, { 14533, 4803 }, { 14559, 4759 },
+    { 14563, 4759 }, { 14568, 4759 }, { 14573, 4759 }, { 14759, 4619 },
+    { 14757, 4620 }, { 14560, 4768 }, { 14512, 4760 }, { 14732, 4749 },
+    { 14529, 4760 }, { 14576, 4760 }, { 14565, 4760 }, { 14543, 4760 },
+    { 14552, 4760 }, { 14763, 4750 }, { 14715, 4753 }, { 14543, 4760 },
+    { 14504, 4752 }, { 14538, 4760 }, { 14577, 4760 }, { 14570, 4760 },
+    { 14578, 4760 }, { 14575, 4760 }, { 14548, 4760 }, { 14561, 4760 },
+    { 14498, 4458 }, { 14759, 4754 }, { 14572, 4760 }, { 14760, 4848 },
+    { 14589, 4760 }, { 14574, 4760 }, { 14599, 4760 }, { 14595, 4760 },
+    { 14772, 4843 }, { 14752, 4847 }, { 14734, 4843 }, { 14745, 4846 },
+    { 14787, 4728 }, { 14803, 4851 }, { 14554, 4760 }, { 14557, 4760 },
+    { 14603, 4760 }, { 14604, 4760 }, { 14589, 4760 }, { 14565, 4788 },
+    { 14758, 4848 }, { 14792, 4854 }, { 14766, 4855 }, { 14599, 4760 },
+    { 14604, 4760 }, { 14797, 4769 }, { 14611, 4760 }, { 14605, 4760 },
+    { 14768, 4772 }, { 14800, 4905 }, { 14814, 4773 }, { 14748, 4845 },
+    { 14596, 4761 }, { 14570, 4760 }, { 14820, 4859 }, { 14573, 4760 },
+    { 14817, 4859 }, { 14817, 4901 }, { 14612, 4760 }, { 14609, 4760 },
+    { 14607, 4760 }, { 14623, 4761 }, { 14613, 4761 }, { 14747, 4845 },
+    { 14759, 4771 }, { 14820, 4672 }, { 14629, 4761 }, { 14737, 4845 },
+    { 14757, 4772 }, { 14772, 4846 }, { 14638, 4761 }, { 14603, 4761 },
+    { 14597, 4761 }, { 14778, 4845 }, { 14621, 4761 }, { 14599, 4761 },
+    { 14823, 4907 }, { 14771, 4771 }, { 14627, 4761 }, { 14749, 4847 },
+    { 14808, 4774 }, { 14634, 4761 }, { 14624, 4761 }, { 14601, 4761 },
+    { 14621, 4761 }, { 14786, 4725 }, { 14650, 4761 }, { 14786, 4696 },
+    { 14727, 4846 }, { 14774, 4773 }, { 14750, 4847 }, { 14774, 4846 },
+    { 14823, 4940 }, { 14786, 4845 }, { 14807, 4711 }, { 14835, 4718 },
+    { 14826, 4727 }, { 14597, 4761 }, { 14789, 4774 }, { 14835, 4730 },
+    { 14798, 4966 }, { 14625, 4761 }, { 14628, 4761 }, { 14840, 4967 },
+    { 14639, 4761 }, { 14663, 4761 }, { 14624, 4761 }, { 14832, 4963 },
+    { 14634, 4761 }, { 14605, 4761 }, { 14839, 4963 }, { 14623, 4762 },
+    { 14663, 4761 }, { 14627, 4762 }, { 14828, 4901 }, { 14798, 4774 },
+    { 14629, 4762 }, { 14637, 4762 }, { 14628, 4762 }, { 14668, 4762 },
+    { 14835, 4988 }, { 14832, 4775 }, { 14800, 4776 }, { 14789, 4777 },
+    { 14837, 4779 }, { 14777, 4725 }, { 14673, 4762 }, { 14793, 4780 },
+    { 14831, 4757 }, { 14849, 4765 }, { 14657, 4762 }, { 14642, 4762 },
+    { 14650, 4762 }, { 14848, 4996 }, { 14652, 4762 }, { 14656, 4762 },
+    { 14688, 4762 }, { 14746, 4725 }, { 14633, 4762 }, { 14695, 4762 },
+    { 14654, 4762 }, { 14848, 4995 }, { 14842, 4995 }, { 14819, 4998 },
+    { 14854, 4782 }, { 14811, 4997 }, { 14637, 4762 }, { 14848, 5013 },
+    { 14833, 5015 }, { 14815, 4966 }, { 14636, 4762 }, { 14819, 5016 },
+    { 14845, 5018 }, { 14843, 4963 }, { 14683, 4762 }, { 14692, 4762 },
+    { 14824, 4997 }, { 14640, 4762 }, { 14835, 5014 }, { 14817, 5019 },
+    { 14694, 4762 }, { 14697, 4762 }, { 14658, 4762 }, { 14690, 4763 },
+    { 14875, 5022 }, { 14706, 4763 }, { 14866, 5020 }, { 14710, 4763 },
+    { 14657, 4762 }, { 14705, 4762 }, { 14651, 4762 }, { 14822, 5021 },
+    { 14676, 4762 }, { 14669, 4763 }, { 14699, 4763 }, { 14681, 4763 },
+    { 14713, 4763 }, { 14877, 5023 }, { 14695, 4763 }, { 14688, 4763 },
+    { 14818, 5020 }, { 14857, 4785 }, { 14812, 5014 }, { 14842, 4792 },
+    { 14737, 4844 }, { 14684, 4763 }, { 14875, 4787 }, { 14727, 4844 },
+    { 14707, 4763 }, { 14749, 4844 }, { 14718, 4763 }, { 14863, 4793 },
+    { 14876, 4796 }, { 14855, 4798 }, { 14760, 4844 }, { 14770, 4844 },
+    { 14729, 4763 }, { 14830, 4795 }, { 14728, 4763 }, { 14879, 4800 },
+    { 14856, 4801 }, { 14882, 4804 }, { 14819, 5014 }, { 14925, 4811 },
+    { 14678, 4764 }, { 14722, 4764 }, { 14780, 4770 }, { 14704, 4764 },
+    { 14693, 4763 }, { 14704, 4764 }, { 14734, 4764 }, { 14735, 4764 },
+    { 14871, 4794 }, { 14941, 4802 }, { 14822, 4793 }, { 14703, 4763 },
+    { 14678, 4763 }, { 14785, 4770 }, { 14687, 4763 }, { 14881, 4794 },
+    { 14855, 5020 }, { 14735, 4763 }, { 14853, 4795 }, { 14889, 4812 },
+    { 14755, 4844 }, { 14898, 4813 }, { 14712, 4763 }, { 14765, 4770 },
+    { 14684, 4764 }, { 14830, 4785 }, { 14745, 4764 }, { 14697, 4764 },
+    { 14740, 4764 }, { 14720, 4764 }, { 14750, 4844 }, { 14768, 4770 },
+    { 14925, 4814 }, { 14939, 4816 }, { 14722, 4764 }, { 14868, 4808 },
+    { 14762, 4844 }, { 14713, 4764 }, { 14753, 4764 }, { 14837, 4805 },
+    { 14860, 4805 }, { 14796, 4770 }, { 14779, 4770 }, { 14905, 4817 },
+    { 14864, 4805 }, { 14883, 4808 }, { 14945, 4818 }, { 14941, 4819 },
+    { 14873, 4806 }, { 14702, 4764 }, { 14735, 4764 }, { 14873, 4807 },
+    { 14922, 4820 }, { 14893, 4806 }, { 14930, 4821 }, { 14928, 4810 },
+    { 14852, 4806 }, { 14822, 4794 }, { 14830, 4794 }, { 14870, 4806 },
+    { 14903, 4807 }, { 14870, 4806 }, { 14890, 4807 }, { 14892, 4806 },
+    { 14891, 4806 }, { 14910, 4808 }, { 14891, 4806 }, { 14903, 4809 },
+    { 14893, 4823 }, { 14895, 4812 }, { 14905, 4808 }, { 14864, 4807 },
+    { 14911, 4807 }, { 14913, 4807 }, { 14898, 4824 }, { 14925, 4825 },
+    { 14872, 4806 }, { 14947, 4826 }, { 14961, 4828 }, { 14912, 4829 },
+    { 14955, 4833 }, { 14934, 4828 }, { 14933, 4810 }, { 14865, 4806 },
+    { 14907, 4808 }, { 14962, 4830 }, { 14968, 5065 }, { 14959, 4832 },
+    { 14921, 4832 }, { 14884, 4806 }, { 14926, 4810 }, { 14897, 4826 },
+    { 14935, 5068 }, { 14964, 5069 }, { 14881, 4806 }, { 14970, 4842 },
+    { 14962, 4849 }, { 14929, 4810 }, { 14978, 4852 }, { 14931, 4853 },
+    { 14919, 4807 }, { 14981, 4856 }, { 14933, 4857 }, { 14972, 4858 },
+    { 14946, 5069 }, { 14984, 4860 }, { 14856, 4806 }, { 14963, 4864 },
+    { 14892, 4806 }, { 14976, 5096 }, { 14891, 4806 }, { 14957, 5098 },
+    { 14883, 4809 }, { 14895, 4809 }, { 14927, 4809 }, { 14898, 4809 },
+    { 14974, 4867 }, { 14958, 4828 }, { 14887, 4809 }, { 14963, 4828 },
+    { 14954, 4868 }, { 14936, 4872 }, { 14979, 4869 }, { 14969, 5101 },
+    { 14991, 5103 }, { 14972, 5104 }, { 14944, 5105 }, { 14895, 4809 },
+    { 14903, 4809 }, { 14878, 4809 }, { 14950, 4879 }, { 14997, 4880 },
+    { 14967, 4881 }, { 14968, 4883 }, { 14991, 4884 }, { 15002, 5117 },
+    { 15002, 5119 }, { 14974, 5120 }, { 14989, 4889 }, { 14924, 4832 },
+    { 15006, 4891 }, { 14985, 4890 }, { 14959, 4892 }, { 14958, 4893 },
+    { 14981, 5127 }, { 14981, 5128 }, { 15002, 4904 }, { 14991, 4906 },
+    { 15007, 4908 }, { 15005, 4909 }, { 14985, 4913 }, { 15002, 4910 },
+    { 14969, 5146 }, { 15010, 5148 }, { 15011, 4916 }, { 14962, 4918 },
+    { 15002, 5152 }, { 14985, 4909 }, { 15023, 4922 }, { 14986, 5155 },
+    { 15016, 5159 }, { 14982, 4926 }, { 15019, 4927 }, { 14990, 5160 },
+    { 15009, 5161 }, { 15017, 4929 }, { 14980, 5164 }, { 15019, 4933 },
+    { 14997, 4936 }, { 15026, 4935 }, { 15022, 4937 }, { 15008, 4938 },
+    { 15017, 4939 }, { 15011, 4941 }, { 15010, 5161 }, { 15009, 4942 },
+    { 15021, 4943 }, { 15007, 4945 }, { 15036, 4946 }, { 15038, 4947 },
+    { 14979, 4909 }, { 15017, 4948 }, { 15025, 4947 }, { 15044, 4949 },
+    { 15010, 4950 }, { 15045, 4951 }, { 14944, 4881 }, { 15024, 4952 },
+    { 15068, 4954 }, { 15038, 4953 }, { 15042, 5173 }, { 15027, 5174 },
+    { 15080, 4957 }, { 15053, 5175 }, { 14996, 4950 }, { 14984, 4943 },
+    { 15043, 5175 }, { 15053, 4959 }, { 15103, 4973 }, { 15016, 4955 },
+    { 15018, 4956 }, { 15028, 4953 }, { 15018, 4942 }, { 15028, 4950 },
+    { 15019, 4950 }, { 15042, 4955 }, { 15070, 4960 }, { 15027, 4958 },
+    { 15036, 4955 }, { 15005, 4951 }, { 15025, 4969 }, { 15056, 4956 },
+    { 15093, 4970 }, { 15022, 4950 }, { 15036, 4958 }, { 15037, 4968 },
+    { 15080, 4968 }, { 15063, 4968 }, { 15077, 4961 }, { 15067, 4969 },
+    { 15009, 4953 }, { 15054, 4969 }, { 15079, 4969 }, { 15032, 4969 },
+    { 15080, 4969 }, { 15061, 4970 }, { 15038, 4971 }, { 15096, 4971 },
+    { 15078, 5207 }, { 15078, 4976 }, { 15103, 4972 }, { 15001, 4947 },
+    { 15059, 4953 }, { 15088, 4978 }, { 15101, 4979 }, { 15065, 4981 },
+    { 15029, 4947 }, { 15091, 4972 }, { 15013, 4953 }, { 15092, 4980 },
+    { 15119, 4982 }, { 15065, 4983 }, { 15056, 4969 }, { 15099, 4984 },
+    { 15076, 4986 }, { 15077, 4985 }, { 15092, 4987 }, { 15114, 4989 },
+    { 15062, 4972 }, { 15027, 4955 }, { 15069, 4971 }, { 15060, 4969 },
+    { 15076, 4972 }, { 15101, 4972 }, { 15080, 4990 }, { 15127, 4992 },
+    { 15078, 4991 }, { 15116, 4993 }, { 15116, 4994 }, { 15110, 5234 },
+    { 15126, 5235 }, { 15119, 5008 }, { 15127, 5007 }, { 15115, 5009 },
+    { 15090, 4969 }, { 15097, 4991 }, { 15122, 4991 }, { 15115, 5010 },
+    { 15078, 4980 }, { 15099, 5011 }, { 15106, 5024 }, { 15089, 5026 },
+    { 15135, 5012 }, { 15122, 5017 }, { 15134, 5254 }, { 15150, 5256 },
+    { 15156, 5257 }, { 15126, 5258 }, { 15133, 5027 }, { 15100, 5028 },
+    { 15088, 4992 }, { 15084, 4993 }, { 15131, 4992 }, { 15093, 5007 },
+    { 15149, 5029 }, { 15155, 5030 }, { 15126, 5031 }, { 15116, 4991 },
+    { 15129, 5033 }, { 15112, 5032 }, { 15148, 5034 }, { 15107, 5038 },
+    { 15084, 4993 }, { 15124, 5035 }, { 15116, 5036 }, { 15116, 4991 },
+    { 15145, 5037 }, { 15120, 5274 }, { 15075, 4991 }, { 15116, 5278 },
+    { 15155, 5047 }, { 15123, 5048 }, { 15128, 5049 }, { 15123, 5050 },
+    { 15154, 5051 }, { 15148, 5052 }, { 15180, 5053 }, { 15115, 5050 },
+    { 15175, 5054 }, { 15173, 5055 }, { 15179, 5056 }, { 15134, 5058 },
+    { 15181, 5287 }, { 15133, 5287 }, { 15169, 5053 }, { 15155, 5290 },
+    { 15173, 5059 }, { 15163, 5291 }, { 15158, 5060 }, { 15175, 5061 },
+    { 15193, 5306 }, { 15167, 5076 }, { 15151, 5077 }, { 15183, 5079 },
+    { 15192, 5078 }, { 15127, 5287 }, { 15191, 5080 }, { 15119, 5051 },
+    { 15161, 5291 }, { 15178, 5081 }, { 15178, 5082 }, { 15163, 5313 },
+    { 15180, 5317 }, { 15198, 5316 }, { 15156, 5318 }, { 15172, 5319 },
+    { 15160, 5321 }, { 15204, 5322 }, { 15172, 5323 }, { 15189, 5088 },
+    { 15190, 5077 }, { 15164, 5089 }, { 15197, 5090 }, { 15186, 5091 },
+    { 15151, 5052 }, { 15165, 5092 }, { 15228, 5094 }, { 15224, 5095 },
+    { 15154, 5080 }, { 15216, 5108 }, { 15217, 5109 }, { 15185, 5110 },
+    { 15219, 5111 }, { 15207, 5095 }, { 15185, 5287 }, { 15230, 5115 },
+    { 15222, 5112 }, { 15207, 5123 }, { 15219, 5124 }, { 15150, 5287 },
+    { 15197, 5125 }, { 15139, 5287 }, { 15221, 5126 }, { 15175, 5079 },
+    { 15220, 5129 }, { 15196, 5130 }, { 15200, 5132 }, { 15230, 5108 },
+    { 15194, 5363 }, { 15194, 5079 }, { 15218, 5369 }, { 15243, 5368 },
+    { 15218, 5370 }, { 15226, 5139 }, { 15246, 5140 }, { 15205, 5141 },
+    { 15224, 5144 }, { 15246, 5143 }, { 15198, 5147 }, { 15255, 5149 },
+    { 15228, 5151 }, { 15179, 5115 }, { 15207, 5150 }, { 15239, 5153 },
+    { 15229, 5162 }, { 15236, 5163 }, { 15207, 5151 }, { 15248, 5166 },
+    { 15216, 5167 }, { 15220, 5170 }, { 15218, 5171 }, { 15263, 5172 },
+    { 15215, 5169 }, { 15270, 5176 }, { 15240, 5177 }, { 15211, 5178 },
+    { 15241, 5180 }, { 15265, 5179 }, { 15215, 5411 }, { 15231, 5182 },
+    { 15241, 5183 }, { 15250, 5180 }, { 15277, 5186 }, { 15231, 5185 },
+    { 15258, 5187 }, { 15251, 5191 }, { 15233, 5188 }, { 15225, 5189 },
+    { 15273, 5419 }, { 15265, 5420 }, { 15247, 5422 }, { 15273, 5192 },
+    { 15260, 5195 }, { 15275, 5193 }, { 15247, 5194 }, { 15294, 5196 },
+    { 15267, 5197 }, { 15287, 5200 }, { 15281, 5201 }, { 15292, 5200 },
+    { 15344, 5208 }, { 15349, 5439 }, { 15355, 5211 }, { 15349, 5212 },
+    { 15361, 5210 }, { 15308, 5213 }, { 15296, 5201 }, { 15340, 5214 },
+    { 15276, 5201 }, { 15377, 5216 }, { 15361, 5215 }, { 15339, 5217 },
+    { 15324, 5218 }, { 15273, 5201 }, { 15296, 5201 }, { 15329, 5215 },
+    { 15362, 5221 }, { 15302, 5201 }, { 15372, 5220 }, { 15322, 5203 },
+    { 15333, 5203 }, { 15303, 5203 }, { 15255, 5201 }, { 15379, 5222 },
+    { 15351, 5219 }, { 15361, 5452 }, { 15261, 5201 }, { 15386, 5453 },
+    { 15343, 5456 }, { 15303, 5202 }, { 15301, 5202 }, { 15321, 5202 },
+    { 15377, 5225 }, { 15267, 5201 }, { 15259, 5201 }, { 15274, 5203 },
+    { 15289, 5193 }, { 15390, 5457 }, { 15277, 5203 }, { 15341, 5203 },
+    { 15387, 5454 }, { 15341, 5458 }, { 15351, 5460 }, { 15317, 5202 },
+    { 15369, 5461 }, { 15300, 5201 }, { 15264, 5202 }, { 15271, 5202 },
+    { 15364, 5210 }, { 15341, 5203 }, { 15288, 5202 }, { 15351, 5226 },
+    { 15387, 5236 }, { 15274, 5201 }, { 15332, 5219 }, { 15302, 5201 },
+    { 15366, 5237 }, { 15368, 5454 }, { 15311, 5201 }, { 15275, 5201 },
+    { 15371, 5462 }, { 15315, 5201 }, { 15359, 5460 }, { 15350, 5214 },
+    { 15307, 5205 }, { 15351, 5462 }, { 15290, 5202 }, { 15277, 5202 },
+    { 15317, 5205 }, { 15310, 5202 }, { 15331, 5204 }, { 15357, 5238 },
+    { 15310, 5202 }, { 15316, 5204 }, { 15319, 5204 }, { 15410, 5239 },
+    { 15346, 5205 }, { 15366, 5241 }, { 15298, 5204 }, { 15299, 5204 },
+    { 15359, 5224 }, { 15386, 5224 }, { 15297, 5204 }, { 15343, 5204 },
+    { 15412, 5242 }, { 15388, 5240 }, { 15404, 5243 }, { 15406, 5230 },
+    { 15412, 5244 }, { 15371, 5247 }, { 15301, 5205 }, { 15394, 5240 },
+    { 15390, 5241 }, { 15385, 5246 }, { 15413, 5245 }, { 15377, 5248 },
+    { 15357, 5237 }, { 15330, 5205 }, { 15352, 5205 }, { 15400, 5249 },
+    { 15368, 5465 }, { 15342, 5204 }, { 15394, 5250 }, { 15421, 5481 },
+    { 15393, 5482 }, { 15368, 5483 }, { 15403, 5485 }, { 15401, 5486 },
+    { 15416, 5484 }, { 15421, 5487 }, { 15382, 5492 }, { 15410, 5261 },
+    { 15377, 5224 }, { 15425, 5262 }, { 15412, 5263 }, { 15400, 5264 },
+    { 15393, 5265 }, { 15325, 5204 }, { 15396, 5266 }, { 15440, 5268 },
+    { 15400, 5269 }, { 15426, 5270 }, { 15382, 5486 }, { 15300, 5204 },
+    { 15321, 5204 }, { 15415, 5484 }, { 15367, 5246 }, { 15439, 5273 },
+    { 15407, 5240 }, { 15380, 5245 }, { 15391, 5224 }, { 15436, 5275 },
+    { 15425, 5272 }, { 15438, 5276 }, { 15432, 5277 }, { 15381, 5483 },
+    { 15435, 5272 }, { 15426, 5279 }, { 15447, 5280 }, { 15460, 5283 },
+    { 15443, 5281 }, { 15405, 5286 }, { 15422, 5485 }, { 15437, 5288 },
+    { 15417, 5282 }, { 15464, 5292 }, { 15468, 5294 }, { 15438, 5280 },
+    { 15461, 5297 }, { 15419, 5270 }, { 15461, 5295 }, { 15467, 5295 },
+    { 15469, 5296 }, { 15449, 5295 }, { 15435, 5284 }, { 15469, 5298 },
+    { 15458, 5279 }, { 15414, 5281 }, { 15484, 5300 }, { 15454, 5285 },
+    { 15459, 5296 }, { 15432, 5301 }, { 15459, 5305 }, { 15402, 5492 },
+    { 15430, 5281 }, { 15482, 5302 }, { 15441, 5289 }, { 15456, 5281 },
+    { 15433, 5301 }, { 15445, 5293 }, { 15488, 5302 }, { 15492, 5299 },
+    { 15458, 5536 }, { 15478, 5307 }, { 15489, 5308 }, { 15442, 5309 },
+    { 15494, 5310 }, { 15455, 5311 }, { 15461, 5324 }, { 15458, 5297 },
+    { 15487, 5326 }, { 15446, 5296 }, { 15432, 5297 }, { 15482, 5325 },
+    { 15423, 5280 }, { 15462, 5328 }, { 15460, 5327 }, { 15494, 5329 },
+    { 15478, 5543 }, { 15492, 5544 }, { 15507, 5329 }, { 15478, 5328 },
+    { 15500, 5310 }, { 15485, 5537 }, { 15521, 5545 }, { 15497, 5549 },
+    { 15516, 5550 }, { 15503, 5330 }, { 15499, 5331 }, { 15485, 5332 },
+    { 15520, 5333 }, { 15493, 5329 }, { 15526, 5337 }, { 15538, 5334 },
+    { 15483, 5310 }, { 15463, 5327 }, { 15529, 5335 }, { 15477, 5296 },
+    { 15512, 5329 }, { 15492, 5326 }, { 15524, 5336 }, { 15536, 5338 },
+    { 15491, 5308 }, { 15533, 5333 }, { 15471, 5325 }, { 15480, 5325 },
+    { 15485, 5311 }, { 15493, 5569 }, { 15470, 5310 }, { 15531, 5570 },
+    { 15540, 5575 }, { 15496, 5343 }, { 15513, 5347 }, { 15510, 5573 },
+    { 15480, 5329 }, { 15548, 5574 }, { 15493, 5576 }, { 15551, 5348 },
+    { 15552, 5353 }, { 15546, 5348 }, { 15484, 5327 }, { 15568, 5352 },
+    { 15458, 5325 }, { 15524, 5329 }, { 15550, 5349 }, { 15580, 5345 },
+    { 15553, 5350 }, { 15548, 5346 }, { 15551, 5350 }, { 15514, 5349 },
+    { 15531, 5351 }, { 15507, 5545 }, { 15567, 5356 }, { 15554, 5350 },
+    { 15520, 5349 }, { 15552, 5360 }, { 15574, 5358 }, { 15554, 5351 },
+    { 15553, 5351 }, { 15568, 5357 }, { 15530, 5350 }, { 15547, 5349 },
+    { 15538, 5359 }, { 15585, 5594 }, { 15564, 5352 }, { 15540, 5373 },
+    { 15560, 5374 }, { 15526, 5349 }, { 15504, 5350 }, { 15550, 5375 },
+    { 15547, 5350 }, { 15535, 5357 }, { 15576, 5376 }, { 15531, 5377 },
+    { 15585, 5607 }, { 15519, 5353 }, { 15548, 5608 }, { 15547, 5609 },
+    { 15598, 5380 }, { 15582, 5381 }, { 15595, 5615 }, { 15597, 5616 },
+    { 15543, 5617 }, { 15554, 5618 }, { 15590, 5619 }, { 15497, 5349 },
+    { 15607, 5621 }, { 15548, 5350 }, { 15603, 5623 }, { 15560, 5624 },
+    { 15521, 5352 }, { 15610, 5625 }, { 15523, 5350 }, { 15590, 5626 },
+    { 15552, 5396 }, { 15591, 5397 }, { 15608, 5398 }, { 15610, 5399 },
+    { 15530, 5352 }, { 15559, 5349 }, { 15615, 5633 }, { 15596, 5401 },
+    { 15517, 5349 }, { 15564, 5616 }, { 15617, 5403 }, { 15609, 5404 },
+    { 15581, 5608 }, { 15616, 5402 }, { 15617, 5405 }, { 15592, 5406 },
+    { 15576, 5407 }, { 15577, 5640 }, { 15627, 5645 }, { 15619, 5421 },
+    { 15581, 5423 }, { 15575, 5655 }, { 15619, 5406 }, { 15620, 5658 },
+    { 15583, 5425 }, { 15584, 5426 }, { 15612, 5427 }, { 15577, 5428 },
+    { 15583, 5432 }, { 15622, 5433 }, { 15587, 5434 }, { 15617, 5435 },
+    { 15622, 5440 }, { 15594, 5441 }, { 15596, 5442 }, { 15588, 5443 },
+    { 15633, 5444 }, { 15638, 5436 }, { 15597, 5442 }, { 15615, 5445 },
+    { 15625, 5445 }, { 15638, 5438 }, { 15579, 5615 }, { 15621, 5450 },
+    { 15652, 5451 }, { 15654, 5455 }, { 15609, 5468 }, { 15606, 5472 },
+    { 15612, 5473 }, { 15659, 5475 }, { 15613, 5704 }, { 15659, 5705 },
+    { 15660, 5478 }, { 15612, 5725 }, { 15633, 5495 }, { 15639, 5443 },
+    { 15665, 5705 }, { 15653, 5496 }, { 15645, 5497 }, { 15631, 5498 },
+    { 15647, 5500 }, { 15651, 5499 }, { 15663, 5501 }, { 15627, 5441 },
+    { 15647, 5505 }, { 15628, 5504 }, { 15653, 5506 }, { 15642, 5441 },
+    { 15586, 5443 }, { 15681, 5507 }, { 15621, 5443 }, { 15642, 5502 },
+    { 15669, 5508 }, { 15661, 5509 }, { 15662, 5503 }, { 15674, 5510 },
+    { 15662, 5743 }, { 15636, 5747 }, { 15634, 5517 }, { 15667, 5751 },
+    { 15683, 5521 }, { 15661, 5522 }, { 15662, 5757 }, { 15618, 5497 },
+    { 15677, 5525 }, { 15618, 5496 }, { 15681, 5526 }, { 15693, 5529 },
+    { 15655, 5527 }, { 15651, 5528 }, { 15693, 5531 }, { 15683, 5533 },
+    { 15679, 5535 }, { 15687, 5535 }, { 15704, 5774 }, { 15705, 5542 },
+    { 15701, 5551 }, { 15676, 5552 }, { 15698, 5555 }, { 15705, 5548 },
+    { 15676, 5553 }, { 15705, 5784 }, { 15679, 5785 }, { 15672, 5552 },
+    { 15695, 5786 }, { 15686, 5533 }, { 15663, 5704 }, { 15704, 5787 },
+    { 15716, 5788 }, { 15686, 5789 }, { 15712, 5556 }, { 15708, 5557 },
+    { 15715, 5790 }, { 15665, 5785 }, { 15652, 5553 }, { 15674, 5533 },
+    { 15717, 5786 }, { 15693, 5791 }, { 15698, 5786 }, { 15681, 5794 },
+    { 15695, 5795 }, { 15718, 5793 }, { 15722, 5563 }, { 15682, 5564 },
+    { 15738, 5565 }, { 15684, 5564 }, { 15738, 5567 }, { 15741, 5568 },
+    { 15681, 5564 }, { 15741, 5571 }, { 15737, 5564 }, { 15731, 5558 },
+    { 15733, 5801 }, { 15739, 5802 }, { 15723, 5803 }, { 15702, 5805 },
+    { 15749, 5811 }, { 15700, 5583 }, { 15740, 5587 }, { 15730, 5585 },
+    { 15720, 5588 }, { 15747, 5584 }, { 15709, 5586 }, { 15707, 5589 },
+    { 15726, 5590 }, { 15703, 5591 }, { 15706, 5593 }, { 15689, 5567 },
+    { 15689, 5548 }, { 15727, 5597 }, { 15745, 5595 }, { 15714, 5596 },
+    { 15754, 5598 }, { 15777, 5603 }, { 15748, 5598 }, { 15683, 5563 },
+    { 15754, 5599 }, { 15755, 5600 }, { 15714, 5803 }, { 15747, 5602 },
+    { 15740, 5601 }, { 15703, 5563 }, { 15757, 5601 }, { 15776, 5834 },
+    { 15779, 5605 }, { 15763, 5600 }, { 15761, 5606 }, { 15735, 5847 },
+    { 15760, 5853 }, { 15728, 5629 }, { 15731, 5860 }, { 15743, 5861 },
+    { 15738, 5862 }, { 15744, 5863 }, { 15777, 5632 }, { 15735, 5634 },
+    { 15766, 5631 }, { 15795, 5635 }, { 15800, 5638 }, { 15797, 5636 },
+    { 15769, 5641 }, { 15803, 5873 }, { 15729, 5834 }, { 15696, 5802 },
+    { 15762, 5881 }, { 15753, 5883 }, { 15718, 5599 }, { 15789, 5884 },
+    { 15766, 5657 }, { 15775, 5659 }, { 15753, 5660 }, { 15758, 5661 },
+    { 15778, 5662 }, { 15750, 5663 }, { 15739, 5602 }, { 15780, 5665 },
+    { 15742, 5599 }, { 15769, 5636 }, { 15804, 5666 }, { 15765, 5667 },
+    { 15754, 5668 }, { 15727, 5602 }, { 15759, 5602 }, { 15809, 5895 },
+    { 15827, 5896 }, { 15813, 5894 }, { 15824, 5669 }, { 15783, 5897 },
+    { 15776, 5670 }, { 15799, 5898 }, { 15735, 5861 }, { 15830, 5671 },
+    { 15782, 5894 }, { 15799, 5674 }, { 15770, 5861 }, { 15816, 5898 },
+    { 15753, 5861 }, { 15785, 5861 }, { 15773, 5894 }, { 15780, 5894 },
+    { 15796, 5688 }, { 15808, 5673 }, { 15803, 5894 }, { 15826, 5689 },
+    { 15804, 5672 }, { 15744, 5861 }, { 15784, 5672 }, { 15802, 5690 },
+    { 15850, 5691 }, { 15793, 5675 }, { 15780, 5898 }, { 15831, 5692 },
+    { 15793, 5634 }, { 15764, 5895 }, { 15815, 5896 }, { 15827, 5672 },
+    { 15856, 5693 }, { 15768, 5896 }, { 15774, 5897 }, { 15822, 5675 },
+    { 15810, 5694 }, { 15808, 5894 }, { 15792, 5897 }, { 15837, 5673 },
+    { 15790, 5895 }, { 15824, 5695 }, { 15836, 5696 }, { 15859, 5697 },
+    { 15814, 5698 }, { 15839, 5700 }, { 15815, 5699 }, { 15849, 5694 },
+    { 15833, 5701 }, { 15807, 5702 }, { 15841, 5695 }, { 15819, 5706 },
+    { 15859, 5707 }, { 15856, 5708 }, { 15819, 5710 }, { 15836, 5703 },
+    { 15822, 5940 }, { 15777, 5898 }, { 15824, 5719 }, { 15821, 5721 },
+    { 15851, 5728 }, { 15774, 5898 }, { 15879, 5728 }, { 15884, 5728 },
+    { 15806, 5692 }, { 15847, 5726 }, { 15861, 5726 }, { 15872, 5726 },
+    { 15854, 5726 }, { 15828, 5726 }, { 15909, 5722 }, { 15849, 5726 },
+    { 15830, 5727 }, { 15829, 5727 }, { 15886, 5724 }, { 15881, 5727 },
+    { 15839, 5728 }, { 15845, 5727 }, { 15866, 5728 }, { 15889, 5731 },
+    { 15887, 5729 }, { 15880, 5727 }, { 15861, 5729 }, { 15875, 5723 },
+    { 15849, 5730 }, { 15900, 5730 }, { 15891, 5728 }, { 15924, 5732 },
+    { 15901, 5738 }, { 15875, 5730 }, { 15888, 5723 }, { 15893, 5739 },
+    { 15927, 5740 }, { 15898, 5741 }, { 15842, 5727 }, { 15857, 5729 },
+    { 15879, 5978 }, { 15872, 5979 }, { 15931, 5986 }, { 15892, 5731 },
+    { 15901, 5756 }, { 15884, 5759 }, { 15882, 5728 }, { 15878, 5760 },
+    { 15849, 5728 }, { 15884, 5762 }, { 15845, 5729 }, { 15923, 5995 },
+    { 15894, 5729 }, { 15897, 5730 }, { 15883, 5758 }, { 15905, 5758 },
+    { 15872, 5727 }, { 15855, 5727 }, { 15927, 5998 }, { 15903, 5730 },
+    { 15841, 5727 }, { 15932, 5768 }, { 15933, 5769 }, { 15913, 5758 },
+    { 15921, 5771 }, { 15901, 5731 }, { 15864, 5730 }, { 15861, 5730 },
+    { 15917, 5731 }, { 15899, 5773 }, { 15915, 5776 }, { 15916, 5775 },
+    { 15903, 5779 }, { 15911, 5730 }, { 15886, 5727 }, { 15897, 5796 },
+    { 15872, 5730 }, { 15892, 5797 }, { 15891, 5798 }, { 15909, 5798 },
+    { 15908, 5799 }, { 15931, 5783 }, { 15910, 6025 }, { 15926, 5807 },
+    { 15927, 5809 }, { 15915, 6043 }, { 15909, 5814 }, { 15917, 5815 },
+    { 15916, 5816 }, { 15956, 6047 }, { 15956, 6051 }, { 15916, 6052 },
+    { 15928, 6054 }, { 15917, 6052 }, { 15957, 6053 }, { 15948, 6053 },
+    { 15933, 6055 }, { 15965, 6056 }, { 15930, 5823 }, { 15931, 6057 },
+    { 15935, 6052 }, { 15938, 6051 }, { 15891, 5998 }, { 15937, 5825 },
+    { 15970, 5826 }, { 15939, 6059 }, { 15990, 6061 }, { 15974, 6062 },
+    { 15949, 6056 }, { 15960, 6063 }, { 15960, 6066 }, { 15970, 6064 },
+    { 15941, 6047 }, { 15946, 5839 }, { 15997, 5840 }, { 15951, 5841 },
+    { 15965, 5842 }, { 15963, 5843 }, { 15953, 5844 }, { 15995, 5843 },
+    { 15970, 5845 }, { 15957, 5846 }, { 15959, 5848 }, { 15990, 5849 },
+    { 15976, 5850 }, { 15970, 5843 }, { 15953, 5851 }, { 15984, 5852 },
+    { 15963, 6084 }, { 15979, 5856 }, { 15950, 6052 }, { 16013, 5857 },
+    { 15952, 5859 }, { 15973, 5864 }, { 16007, 5867 }, { 15938, 6055 },
+    { 15967, 5866 }, { 16018, 6097 }, { 15980, 6062 }, { 15960, 6100 },
+    { 15977, 5869 }, { 15966, 6052 }, { 16014, 5870 }, { 15937, 6052 },
+    { 16021, 6106 }, { 15992, 5877 }, { 15942, 6052 }, { 15935, 5823 },
+    { 16003, 5878 }, { 15996, 5880 }, { 15996, 6115 }, { 15998, 6118 },
+    { 16018, 6124 }, { 15983, 5900 }, { 16025, 5901 }, { 16018, 6135 },
+    { 16030, 5908 }, { 16012, 5909 }, { 15991, 5909 }, { 16025, 5910 },
+    { 15985, 6145 }, { 15990, 5917 }, { 16031, 5920 }, { 16038, 5922 },
+    { 16045, 5923 }, { 16029, 5924 }, { 16015, 5925 }, { 16018, 5928 },
+    { 16049, 5930 }, { 15989, 6163 }, { 16043, 5935 }, { 15999, 5937 },
+    { 16040, 5938 }, { 16047, 5939 }, { 16004, 5941 }, { 16023, 5944 },
+    { 16031, 5943 }, { 16020, 5945 }, { 16054, 5947 }, { 16016, 5942 },
+    { 16047, 5946 }, { 16042, 5943 }, { 16061, 5948 }, { 16011, 5951 },
+    { 16055, 5952 }, { 16028, 5949 }, { 16055, 5950 }, { 16020, 6183 },
+    { 16066, 6184 }, { 15971, 5877 }, { 16011, 6185 }, { 16035, 6186 },
+    { 16045, 6187 }, { 16071, 5954 }, { 16020, 5869 }, { 16038, 5957 },
+    { 16035, 5924 }, { 16079, 6188 }, { 16024, 6189 }, { 16064, 5955 },
+    { 16020, 5960 }, { 16036, 5910 }, { 16029, 5961 }, { 16025, 5963 },
+    { 16037, 5972 }, { 16032, 5943 }, { 16061, 5974 }, { 16087, 5975 },
+    { 16081, 5976 }, { 16065, 5980 }, { 16039, 6184 }, { 16037, 5982 },
+    { 16085, 5983 }, { 16037, 6216 }, { 16077, 6216 }, { 16039, 5985 },
+    { 16054, 6003 }, { 16077, 6002 }, { 16093, 6004 }, { 16098, 6002 },
+    { 16070, 6005 }, { 16092, 6006 }, { 16082, 6007 }, { 16066, 6008 },
+    { 16051, 6010 }, { 16105, 6012 }, { 16055, 6183 }, { 16082, 6002 },
+    { 16095, 6009 }, { 16064, 6011 }, { 16085, 6009 }, { 16086, 6016 },
+    { 16067, 6011 }, { 16113, 6013 }, { 16055, 6016 }, { 16115, 6014 },
+    { 16123, 6015 }, { 16108, 6014 }, { 16108, 6018 }, { 16072, 6019 },
+    { 16065, 6020 }, { 16073, 6013 }, { 16096, 6006 }, { 16116, 6023 },
+    { 16086, 6251 }, { 16106, 6252 }, { 16121, 6024 }, { 16107, 6026 },
+    { 16108, 6257 }, { 16098, 6258 }, { 16116, 6259 }, { 16082, 6260 },
+    { 16125, 6029 }, { 16131, 6266 }, { 16110, 6263 }, { 16129, 6267 },
+    { 16112, 6034 }, { 16093, 6035 }, { 16094, 6036 }, { 16108, 6037 },
+    { 16073, 5982 }, { 16095, 6010 }, { 16135, 6038 }, { 16097, 6038 },
+    { 16108, 6266 }, { 16126, 6039 }, { 16139, 6041 }, { 16060, 6011 },
+    { 16145, 6042 }, { 16050, 6002 }, { 16152, 6044 }, { 16113, 6045 },
+    { 16123, 6046 }, { 16113, 6048 }, { 16102, 6049 }, { 16133, 6065 },
+    { 16108, 6065 }, { 16105, 6067 }, { 16133, 6067 }, { 16119, 6014 },
+    { 16114, 6068 }, { 16150, 6069 }, { 16125, 6070 }, { 16101, 6071 },
+    { 16154, 6071 }, { 16117, 6074 }, { 16155, 6075 }, { 16113, 6072 },
+    { 16170, 6073 }, { 16165, 6076 }, { 16161, 6077 }, { 16173, 6079 },
+    { 16150, 6311 }, { 16150, 6081 }, { 16172, 6082 }, { 16145, 6085 },
+    { 16147, 6086 }, { 16148, 6087 }, { 16180, 6088 }, { 16133, 6090 },
+    { 16153, 6091 }, { 16145, 6328 }, { 16123, 6090 }, { 16161, 6085 },
+    { 16132, 6096 }, { 16168, 6102 }, { 16133, 6337 }, { 16143, 6342 },
+    { 16140, 6111 }, { 16159, 6344 }, { 16169, 6114 }, { 16162, 6119 },
+    { 16140, 6121 }, { 16141, 6123 }, { 16094, 6038 }, { 16136, 6125 },
+    { 16166, 6122 }, { 16195, 6126 }, { 16169, 6360 }, { 16188, 6128 },
+    { 16184, 6129 }, { 16172, 6132 }, { 16147, 6130 }, { 16183, 6133 },
+    { 16201, 6134 }, { 16196, 6136 }, { 16157, 6141 }, { 16161, 6143 },
+    { 16154, 6147 }, { 16193, 6148 }, { 16200, 6149 }, { 16189, 6151 },
+    { 16197, 6380 }, { 16209, 6153 }, { 16183, 6154 }, { 16170, 6157 },
+    { 16215, 6385 }, { 16162, 6386 }, { 16170, 6388 }, { 16223, 6156 },
+    { 16145, 6071 }, { 16187, 6158 }, { 16197, 6159 }, { 16225, 6160 },
+    { 16229, 6392 }, { 16214, 6153 }, { 16177, 6394 }, { 16201, 6153 },
+    { 16232, 6395 }, { 16204, 6397 }, { 16173, 6165 }, { 16204, 6399 },
+    { 16223, 6400 }, { 16163, 6151 }, { 16183, 6170 }, { 16212, 6380 },
+    { 16238, 6171 }, { 16219, 6172 }, { 16226, 6174 }, { 16225, 6405 },
+    { 16182, 6408 }, { 16199, 6176 }, { 16225, 6178 }, { 16218, 6181 },
+    { 16219, 6411 }, { 16214, 6180 }, { 16220, 6176 }, { 16165, 6154 },
+    { 16178, 6153 }, { 16231, 6392 }, { 16223, 6180 }, { 16201, 6190 },
+    { 16204, 6191 }, { 16240, 6192 }, { 16243, 6428 }, { 16242, 6198 },
+    { 16254, 6201 }, { 16258, 6431 }, { 16209, 6200 }, { 16237, 6433 },
+    { 16255, 6203 }, { 16258, 6204 }, { 16231, 6205 }, { 16210, 6205 },
+    { 16242, 6206 }, { 16204, 6207 }, { 16217, 6439 }, { 16256, 6210 },
+    { 16266, 6443 }, { 16257, 6447 }, { 16241, 6448 }, { 16233, 6449 },
+    { 16248, 6447 }, { 16240, 6450 }, { 16241, 6451 }, { 16269, 6218 },
+    { 16258, 6447 }, { 16251, 6222 }, { 16286, 6456 }, { 16224, 6455 },
+    { 16264, 6457 }, { 16234, 6458 }, { 16237, 6459 }, { 16273, 6460 },
+    { 16285, 6225 }, { 16244, 6226 }, { 16278, 6239 }, { 16263, 6240 },
+    { 16242, 6242 }, { 16247, 6246 }, { 16237, 6247 }, { 16286, 6225 },
+    { 16276, 6225 }, { 16229, 6191 }, { 16246, 6248 }, { 16240, 6486 },
+    { 16229, 6451 }, { 16220, 6451 }, { 16252, 6455 }, { 16296, 6268 },
+    { 16249, 6268 }, { 16243, 6269 }, { 16246, 6270 }, { 16255, 6271 },
+    { 16297, 6262 }, { 16260, 6264 }, { 16290, 6273 }, { 16301, 6272 },
+    { 16215, 6450 }, { 16298, 6272 }, { 16316, 6274 }, { 16306, 6274 },
+    { 16319, 6275 }, { 16292, 6276 }, { 16309, 6278 }, { 16243, 6447 },
+    { 16312, 6277 }, { 16275, 6279 }, { 16295, 6282 }, { 16296, 6265 },
+    { 16276, 6512 }, { 16280, 6513 }, { 16262, 6447 }, { 16306, 6281 },
+    { 16309, 6283 }, { 16288, 6273 }, { 16299, 6285 }, { 16305, 6286 },
+    { 16327, 6287 }, { 16330, 6283 }, { 16333, 6288 }, { 16270, 6274 },
+    { 16289, 6289 }, { 16331, 6290 }, { 16314, 6294 }, { 16281, 6275 },
+    { 16321, 6521 }, { 16317, 6522 }, { 16347, 6526 }, { 16332, 6525 },
+    { 16299, 6527 }, { 16301, 6528 }, { 16302, 6275 }, { 16321, 6529 },
+    { 16311, 6277 }, { 16311, 6530 }, { 16344, 6531 }, { 16324, 6532 },
+    { 16351, 6533 }, { 16254, 6268 }, { 16306, 6537 }, { 16359, 6540 },
+    { 16311, 6543 }, { 16348, 6546 }, { 16351, 6559 }, { 16351, 6560 },
+    { 16364, 6561 }, { 16307, 6563 }, { 16277, 6271 }, { 16316, 6564 },
+    { 16360, 6569 }, { 16312, 6273 }, { 16356, 6571 }, { 16346, 6572 },
+    { 16347, 6572 }, { 16356, 6573 }, { 16338, 6285 }, { 16361, 6574 },
+    { 16375, 6576 }, { 16323, 6577 }, { 16332, 6584 }, { 16329, 6583 },
+    { 16365, 6588 }, { 16328, 6589 }, { 16338, 6591 }, { 16382, 6590 },
+    { 16389, 6592 }, { 16272, 6513 }, { 16368, 6594 }, { 16335, 6605 },
+    { 16380, 6412 }, { 16380, 6413 }, { 16381, 6592 }, { 16382, 6414 },
+    { 16346, 6588 }, { 16382, 6590 }, { 16401, 6415 }, { 16347, 6416 },
+    { 16390, 6608 }, { 16388, 6612 }, { 16389, 6613 }, { 16353, 6632 },
+    { 16359, 6413 }, { 16358, 6648 }, { 16356, 6651 }, { 16405, 6655 },
+    { 16399, 6413 }, { 16353, 6591 }, { 16362, 6660 }, { 16361, 6659 },
+    { 16404, 6663 }, { 16394, 6651 }, { 16394, 6665 }, { 16395, 6675 },
+    { 16396, 6699 }, { 16364, 6700 }, { 16382, 6655 }, { 16409, 6703 },
+    { 16422, 6473 }, { 16363, 6415 }, { 16364, 6707 }, { 16333, 6573 },
+    { 16337, 6589 }, { 16407, 6476 }, { 16372, 6477 }, { 16404, 6708 },
+    { 16408, 6476 }, { 16334, 6591 }, { 16413, 6480 }, { 16395, 6477 },
+    { 16400, 6481 }, { 16411, 6477 }, { 16376, 6483 }, { 16371, 6484 },
+    { 16429, 6487 }, { 16408, 6488 }, { 16376, 6489 }, { 16385, 6490 },
+    { 16416, 6491 }, { 16441, 6485 }, { 16432, 6492 }, { 16359, 6588 },
+    { 16421, 6493 }, { 16410, 6494 }, { 16391, 6498 }, { 16422, 6496 },
+    { 16389, 6736 }, { 16442, 6505 }, { 16421, 6514 }, { 16401, 6515 },
+    { 16390, 6516 }, { 16397, 6517 }, { 16443, 6509 }, { 16387, 6488 },
+    { 16434, 6488 }, { 16455, 6510 }, { 16434, 6518 }, { 16441, 6749 },
+    { 16422, 6484 }, { 16408, 6648 }, { 16442, 6520 }, { 16414, 6756 },
+    { 16442, 6758 }, { 16446, 6756 }, { 16416, 6541 }, { 16403, 6516 },
+    { 16452, 6542 }, { 16417, 6544 }, { 16449, 6545 }, { 16406, 6780 },
+    { 16422, 6781 }, { 16452, 6548 }, { 16458, 6549 }, { 16463, 6553 },
+    { 16420, 6550 }, { 16423, 6785 }, { 16469, 6556 }, { 16432, 6787 },
+    { 16482, 6558 }, { 16441, 6795 }, { 16439, 6550 }, { 16456, 6794 },
+    { 16436, 6794 }, { 16480, 6794 }, { 16440, 6796 }, { 16489, 6797 },
+    { 16481, 6798 }, { 16446, 6799 }, { 16480, 6800 }, { 16471, 6795 },
+    { 16458, 6806 }, { 16439, 6807 }, { 16483, 6808 }, { 16446, 6811 },
+    { 16491, 6814 }, { 16452, 6815 }, { 16486, 6816 }, { 16485, 6817 },
+    { 16481, 6581 }, { 16417, 6553 }, { 16447, 6800 }, { 16455, 6549 },
+    { 16439, 6550 }, { 16457, 6582 }, { 16468, 6586 }, { 16497, 6593 },
+    { 16461, 6828 }, { 16465, 6599 }, { 16451, 6601 }, { 16432, 6553 },
+    { 16508, 6602 }, { 16460, 6603 }, { 16462, 6604 }, { 16508, 6607 },
+    { 16512, 6606 }, { 16464, 6609 }, { 16470, 6611 }, { 16508, 6614 },
+    { 16513, 6616 }, { 16466, 6795 }, { 16464, 6615 }, { 16502, 6617 },
+    { 16483, 6619 }, { 16525, 6620 }, { 16485, 6622 }, { 16499, 6853 },
+    { 16492, 6618 }, { 16464, 6615 }, { 16431, 6556 }, { 16498, 6618 },
+    { 16463, 6615 }, { 16520, 6618 }, { 16489, 6617 }, { 16500, 6625 },
+    { 16512, 6629 }, { 16497, 6627 }, { 16467, 6795 }, { 16488, 6795 },
+    { 16487, 6616 }, { 16495, 6630 }, { 16532, 6861 }, { 16534, 6633 },
+    { 16509, 6634 }, { 16525, 6865 }, { 16501, 6867 }, { 16504, 6615 },
+    { 16505, 6638 }, { 16498, 6642 }, { 16505, 6643 }, { 16551, 6644 },
+    { 16511, 6645 }, { 16528, 6646 }, { 16544, 6884 }, { 16550, 6642 },
+    { 16515, 6885 }, { 16473, 6616 }, { 16562, 6888 }, { 16558, 6889 },
+    { 16553, 6657 }, { 16517, 6615 }, { 16516, 6666 }, { 16544, 6667 },
+    { 16521, 6669 }, { 16557, 6670 }, { 16538, 6662 }, { 16533, 6897 },
+    { 16511, 6668 }, { 16562, 6671 }, { 16478, 6615 }, { 16522, 6672 },
+    { 16529, 6674 }, { 16565, 6676 }, { 16538, 6673 }, { 16525, 6615 },
+    { 16516, 6646 }, { 16506, 6615 }, { 16533, 6907 }, { 16559, 6683 },
+    { 16553, 6684 }, { 16553, 6688 }, { 16561, 6686 }, { 16526, 6687 },
+    { 16574, 6690 }, { 16586, 6919 }, { 16533, 6922 }, { 16556, 6923 },
+    { 16556, 6928 }, { 16552, 6672 }, { 16556, 6930 }, { 16545, 6931 },
+    { 16590, 6931 }, { 16563, 6932 }, { 16502, 6642 }, { 16530, 6673 },
+    { 16572, 6673 }, { 16550, 6933 }, { 16574, 6934 }, { 16561, 6936 },
+    { 16607, 6939 }, { 16591, 6931 }, { 16536, 6673 }, { 16573, 6934 },
+    { 16561, 6672 }, { 16590, 6942 }, { 16622, 6714 }, { 16638, 6716 },
+    { 16643, 6946 }, { 16631, 6952 }, { 16637, 6946 }, { 16548, 6931 },
+    { 16581, 6932 }, { 16641, 6726 }, { 16606, 6946 }, { 16652, 6946 },
+    { 16626, 6727 }, { 16625, 6730 }, { 16566, 6932 }, { 16629, 6729 },
+    { 16651, 6731 }, { 16653, 6958 }, { 16632, 6963 }, { 16653, 6964 },
+    { 16541, 6932 }, { 16554, 6943 }, { 16682, 6965 }, { 16668, 6738 },
+    { 16563, 6943 }, { 16610, 6943 }, { 16586, 6943 }, { 16582, 6684 },
+    { 16609, 6943 }, { 16594, 6943 }, { 16614, 6943 }, { 16650, 6946 },
+    { 16604, 6943 }, { 16567, 6943 }, { 16591, 6944 }, { 16618, 6943 },
+    { 16640, 6741 }, { 16614, 6943 }, { 16655, 6739 }, { 16684, 6742 },
+    { 16674, 6740 }, { 16689, 6977 }, { 16569, 6944 }, { 16680, 6750 },
+    { 16640, 6751 }, { 16692, 6748 }, { 16646, 6947 }, { 16662, 6754 },
+    { 16650, 6947 }, { 16665, 6754 }, { 16622, 6946 }, { 16647, 6753 },
+    { 16570, 6943 }, { 16700, 6753 }, { 16688, 6753 }, { 16625, 6944 },
+    { 16577, 6944 }, { 16617, 6943 }, { 16692, 6752 }, { 16658, 6947 },
+    { 16609, 6947 }, { 16586, 6943 }, { 16574, 6943 }, { 16619, 6944 },
+    { 16680, 6754 }, { 16626, 6943 }, { 16689, 6751 }, { 16693, 6757 },
+    { 16678, 6760 }, { 16636, 6944 }, { 16635, 6947 }, { 16653, 6761 },
+    { 16619, 6943 }, { 16712, 6759 }, { 16605, 6943 }, { 16656, 6752 },
+    { 16608, 6943 }, { 16714, 6993 }, { 16617, 6947 }, { 16698, 6768 },
+    { 16634, 6752 }, { 16654, 6769 }, { 16585, 6944 }, { 16644, 6755 },
+    { 16581, 6944 }, { 16673, 6771 }, { 16634, 6945 }, { 16675, 7007 },
+    { 16589, 6944 }, { 16666, 7008 }, { 16605, 6944 }, { 16631, 6945 },
+    { 16670, 6778 }, { 16637, 6945 }, { 16704, 6779 }, { 16694, 6782 },
+    { 16590, 6945 }, { 16607, 6945 }, { 16684, 6755 }, { 16717, 6786 },
+    { 16674, 6752 }, { 16699, 6789 }, { 16671, 6788 }, { 16646, 6945 },
+    { 16631, 6945 }, { 16704, 6801 }, { 16643, 6752 }, { 16669, 6804 },
+    { 16599, 6945 }, { 16689, 7036 }, { 16690, 7038 }, { 16717, 7048 },
+    { 16645, 6755 }, { 16692, 6820 }, { 16716, 6823 }, { 16684, 7056 },
+    { 16634, 6945 }, { 16692, 6827 }, { 16686, 7059 }, { 16727, 6836 },
+    { 16731, 6835 }, { 16728, 6839 }, { 16590, 6945 }, { 16604, 6945 },
+    { 16733, 7071 }, { 16697, 7072 }, { 16729, 7077 }, { 16645, 6945 },
+    { 16633, 6945 }, { 16724, 6835 }, { 16731, 6847 }, { 16696, 6848 },
+    { 16722, 6849 }, { 16688, 6851 }, { 16718, 7084 }, { 16593, 6945 },
+    { 16739, 6854 }, { 16697, 6855 }, { 16641, 6945 }, { 16717, 6856 },
+    { 16713, 7088 }, { 16707, 7090 }, { 16728, 6868 }, { 16730, 6869 },
+    { 16755, 6870 }, { 16698, 7077 }, { 16741, 6872 }, { 16725, 6868 },
+    { 16744, 6871 }, { 16764, 7092 }, { 16737, 6863 }, { 16766, 6864 },
+    { 16767, 6866 }, { 16761, 6872 }, { 16763, 6874 }, { 16756, 6868 },
+    { 16763, 6870 }, { 16744, 6870 }, { 16770, 6878 }, { 16729, 6876 },
+    { 16761, 7108 }, { 16755, 7090 }, { 16756, 6883 }, { 16758, 6871 },
+    { 16766, 6872 }, { 16713, 6872 }, { 16746, 6893 }, { 16702, 6869 },
+    { 16755, 6890 }, { 16782, 6890 }, { 16773, 6891 }, { 16786, 6894 },
+    { 16749, 6890 }, { 16784, 6895 }, { 16746, 6895 }, { 16768, 6874 },
+    { 16708, 6868 }, { 16776, 6892 }, { 16751, 7127 }, { 16799, 6892 },
+    { 16769, 7128 }, { 16765, 6895 }, { 16795, 7132 }, { 16800, 7133 },
+    { 16743, 6913 }, { 16756, 6914 }, { 16789, 6951 }, { 16780, 6953 },
+    { 16761, 6954 }, { 16802, 6955 }, { 16751, 7150 }, { 16727, 6871 },
+    { 16794, 6920 }, { 16773, 6921 }, { 16772, 6924 }, { 16797, 6918 },
+    { 16806, 6927 }, { 16722, 6868 }, { 16799, 6929 }, { 16738, 6868 },
+    { 16795, 6935 }, { 16736, 6891 }, { 16781, 6937 }, { 16761, 6868 },
+    { 16720, 6868 }, { 16739, 6890 }, { 16761, 6938 }, { 16789, 6940 },
+    { 16730, 6876 }, { 16767, 7172 }, { 16768, 7178 }, { 16817, 7180 },
+    { 16761, 7209 }, { 16781, 7211 }, { 16786, 7220 }, { 16802, 7227 },
+    { 16778, 7228 }, { 16822, 7229 }, { 16790, 7232 }, { 16801, 7237 },
+    { 16778, 7235 }, { 16786, 7238 }, { 16817, 7239 }, { 16806, 7243 },
+    { 16806, 7244 }, { 16810, 7239 }, { 16837, 7245 }, { 16787, 7246 },
+    { 16828, 7248 }, { 16810, 7257 }, { 16841, 7254 }, { 16803, 7255 },
+    { 16827, 7262 }, { 16828, 7259 }, { 16837, 7261 }, { 16792, 7264 },
+    { 16849, 7271 }, { 16823, 7272 }, { 16827, 7273 }, { 16827, 7274 },
+    { 16828, 7279 }, { 16853, 7280 }, { 16805, 7283 }, { 16850, 7285 },
+    { 16803, 7285 }, { 16818, 7288 }, { 16858, 7292 }, { 16810, 7294 },
+    { 16847, 7323 }, { 16832, 7336 }, { 16856, 7337 }, { 16806, 7115 },
+    { 16846, 7115 }, { 16822, 7116 }, { 16833, 7117 }, { 16840, 7261 },
+    { 16837, 7115 }, { 16832, 7118 }, { 16866, 7120 }, { 16829, 7119 },
+    { 16817, 7116 }, { 16839, 7121 }, { 16856, 7119 }, { 16889, 7122 },
+    { 16872, 7119 }, { 16871, 7117 }, { 16837, 7123 }, { 16878, 7124 },
+    { 16879, 7125 }, { 16869, 7126 }, { 16853, 7116 }, { 16837, 7361 },
+    { 16882, 7367 }, { 16845, 7372 }, { 16828, 7118 }, { 16848, 7374 },
+    { 16851, 7375 }, { 16846, 7376 }, { 16846, 7384 }, { 16872, 7389 },
+    { 16902, 7394 }, { 16852, 7385 }, { 16892, 7395 }, { 16870, 7409 },
+    { 16846, 7120 }, { 16845, 7118 }, { 16902, 7385 }, { 16860, 7411 },
+    { 16895, 7411 }, { 16887, 7412 }, { 16881, 7417 }, { 16858, 7426 },
+    { 16857, 7120 }, { 16893, 7426 }, { 16873, 7427 }, { 16899, 7425 },
+    { 16897, 7425 }, { 16825, 7118 }, { 16859, 7118 }, { 16827, 7119 },
+    { 16873, 7425 }, { 16905, 7428 }, { 16911, 7429 }, { 16834, 7119 },
+    { 16923, 7430 }, { 16901, 7431 }, { 16865, 7429 }, { 16909, 7429 },
+    { 16880, 7200 }, { 16877, 7201 }, { 16928, 7433 }, { 16899, 7434 },
+    { 16879, 7435 }, { 16908, 7429 }, { 16900, 7439 }, { 16931, 7204 },
+    { 16898, 7206 }, { 16889, 7438 }, { 16923, 7214 }, { 16908, 7216 },
+    { 16880, 7217 }, { 16942, 7219 }, { 16894, 7429 }, { 16911, 7221 },
+    { 16945, 7247 }, { 16897, 7481 }, { 16929, 7482 }, { 16924, 7484 },
+    { 16926, 7433 }, { 16938, 7486 }, { 16906, 7427 }, { 16948, 7489 },
+    { 16923, 7204 }, { 16921, 7491 }, { 16905, 7493 }, { 16930, 7494 },
+    { 16926, 7496 }, { 16896, 7515 }, { 16900, 7517 }, { 16953, 7548 },
+    { 16903, 7321 }, { 16946, 7322 }, { 16920, 7324 }, { 16905, 7221 },
+    { 16930, 7326 }, { 16935, 7321 }, { 16901, 7496 }, { 16950, 7549 },
+    { 16932, 7494 }, { 16935, 7325 }, { 16957, 7550 }, { 16967, 7558 },
+    { 16946, 7330 }, { 16971, 7562 }, { 16942, 7334 }, { 16928, 7335 },
+    { 16977, 7572 }, { 16931, 7568 }, { 16873, 7434 }, { 16977, 7569 },
+    { 16945, 7570 }, { 16934, 7322 }, { 16961, 7569 }, { 16940, 7325 },
+    { 16951, 7568 }, { 16976, 7574 }, { 16959, 7571 }, { 16952, 7324 },
+    { 16929, 7575 }, { 16937, 7576 }, { 16985, 7577 }, { 16963, 7578 },
+    { 16926, 7562 }, { 16938, 7580 }, { 16991, 7582 }, { 16945, 7343 },
+    { 16958, 7574 }, { 16941, 7347 }, { 16954, 7350 }, { 16930, 7322 },
+    { 17001, 7351 }, { 16950, 7352 }, { 16980, 7353 }, { 16977, 7350 },
+    { 16967, 7356 }, { 16976, 7355 }, { 16991, 7359 }, { 16972, 7360 },
+    { 16979, 7362 }, { 16981, 7593 }, { 17006, 7364 }, { 16962, 7365 },
+    { 16909, 7322 }, { 16986, 7366 }, { 16964, 7370 }, { 17016, 7371 },
+    { 16988, 7602 }, { 17018, 7606 }, { 16967, 7378 }, { 17007, 7379 },
+    { 17004, 7380 }, { 16985, 7381 }, { 17015, 7382 }, { 17020, 7387 },
+    { 16974, 7388 }, { 17019, 7392 }, { 16988, 7388 }, { 17018, 7393 },
+    { 17023, 7399 }, { 17031, 7400 }, { 17023, 7401 }, { 17017, 7400 },
+    { 17006, 7401 }, { 16957, 7364 }, { 17011, 7405 }, { 17008, 7402 },
+    { 16992, 7578 }, { 17007, 7402 }, { 17026, 7401 }, { 17021, 7638 },
+    { 16987, 7401 }, { 17021, 7402 }, { 17044, 7404 }, { 17061, 7404 },
+    { 17039, 7413 }, { 17002, 7403 }, { 17049, 7403 }, { 17046, 7404 },
+    { 17018, 7400 }, { 17057, 7416 }, { 17012, 7400 }, { 17008, 7400 },
+    { 17009, 7419 }, { 17024, 7420 }, { 17010, 7364 }, { 17021, 7421 },
+    { 16993, 7401 }, { 17047, 7402 }, { 17023, 7401 }, { 17012, 7364 },
+    { 17060, 7403 }, { 17024, 7422 }, { 17030, 7424 }, { 17019, 7404 },
+    { 17051, 7440 }, { 17011, 7404 }, { 17030, 7441 }, { 17020, 7657 },
+    { 16965, 7606 }, { 17022, 7432 }, { 17029, 7443 }, { 17031, 7674 },
+    { 17034, 7445 }, { 17008, 7402 }, { 17060, 7446 }, { 17108, 7453 },
+    { 17027, 7401 }, { 17017, 7401 }, { 17040, 7401 }, { 17001, 7401 },
+    { 17028, 7400 }, { 17035, 7443 }, { 17077, 7447 }, { 17041, 7447 },
+    { 17154, 7457 }, { 17156, 7458 }, { 17074, 7447 }, { 17076, 7447 },
+    { 17152, 7456 }, { 17059, 7447 }, { 17065, 7638 }, { 17055, 7440 },
+    { 17023, 7402 }, { 17038, 7402 }, { 17140, 7452 }, { 17084, 7448 },
+    { 17121, 7460 }, { 17158, 7462 }, { 17046, 7448 }, { 17049, 7404 },
+    { 17065, 7448 }, { 17133, 7452 }, { 17038, 7448 }, { 17146, 7464 },
+    { 17038, 7448 }, { 17076, 7448 }, { 17154, 7461 }, { 17155, 7461 },
+    { 17146, 7459 }, { 17155, 7465 }, { 17128, 7466 }, { 17168, 7467 },
+    { 17169, 7468 }, { 17151, 7452 }, { 17132, 7458 }, { 17157, 7711 },
+    { 17194, 7738 }, { 17069, 7448 }, { 17061, 7448 }, { 17064, 7449 },
+    { 17084, 7449 }, { 17147, 7452 }, { 17083, 7449 }, { 17248, 7739 },
+    { 17164, 7460 }, { 17084, 7449 }, { 17054, 7449 }, { 17041, 7448 },
+    { 17056, 7449 }, { 17140, 7452 }, { 17086, 7449 }, { 17121, 7459 },
+    { 17109, 7456 }, { 17137, 7471 }, { 17090, 7449 }, { 17247, 7743 },
+    { 17185, 7471 }, { 17140, 7459 }, { 17094, 7455 }, { 17082, 7450 },
+    { 17096, 7449 }, { 17097, 7449 }, { 17247, 7753 }, { 17113, 7458 },
+    { 17250, 7769 }, { 17160, 7472 }, { 17105, 7450 }, { 17205, 7794 },
+    { 17062, 7449 }, { 17088, 7450 }, { 17257, 7797 }, { 17082, 7448 },
+    { 17081, 7448 }, { 17124, 7461 }, { 17090, 7450 }, { 17230, 7798 },
+    { 17096, 7449 }, { 17149, 7471 }, { 17060, 7449 }, { 17185, 7471 },
+    { 17118, 7450 }, { 17107, 7450 }, { 17226, 7772 }, { 17106, 7455 },
+    { 17250, 7772 }, { 17073, 7450 }, { 17123, 7450 }, { 17085, 7451 },
+    { 17148, 7472 }, { 17083, 7451 }, { 17091, 7451 }, { 17089, 7451 },
+    { 17130, 7451 }, { 17114, 7450 }, { 17250, 7756 }, { 17070, 7450 },
+    { 17158, 7455 }, { 17185, 7732 }, { 17146, 7732 }, { 17134, 7451 },
+    { 17172, 7733 }, { 17208, 7795 }, { 17180, 7732 }, { 17156, 7455 },
+    { 17150, 7733 }, { 17141, 7455 }, { 17118, 7450 }, { 17124, 7455 },
+    { 17232, 7828 }, { 17234, 7831 }, { 17131, 7451 }, { 17170, 7733 },
+    { 17081, 7450 }, { 17108, 7450 }, { 17186, 7733 }, { 17254, 7833 },
+    { 17223, 7834 }, { 17242, 7838 }, { 17191, 7733 }, { 17236, 7841 },
+    { 17201, 7734 }, { 17183, 7734 }, { 17188, 7736 }, { 17082, 7451 },
+    { 17145, 7451 }, { 17271, 7846 }, { 17271, 7851 }, { 17165, 7733 },
+    { 17222, 7873 }, { 17102, 7451 }, { 17200, 7756 }, { 17248, 7875 },
+    { 17186, 7733 }, { 17214, 7734 }, { 17206, 7733 }, { 17166, 7733 },
+    { 17148, 7733 }, { 17172, 7734 }, { 17265, 7852 }, { 17211, 7737 },
+    { 17141, 7451 }, { 17207, 7827 }, { 17259, 7827 }, { 17272, 7885 },
+    { 17214, 7734 }, { 17216, 7871 }, { 17225, 7893 }, { 17179, 7736 },
+    { 17161, 7733 }, { 17278, 7852 }, { 17226, 7736 }, { 17196, 7736 },
+    { 17268, 7931 }, { 17164, 7734 }, { 17173, 7733 }, { 17171, 7735 },
+    { 17192, 7734 }, { 17173, 7733 }, { 17259, 7938 }, { 17258, 7939 },
+    { 17179, 7733 }, { 17203, 7733 }, { 17172, 7733 }, { 17282, 7937 },
+    { 17235, 7737 }, { 17237, 7736 }, { 17193, 7734 }, { 17218, 7735 },
+    { 17210, 7737 }, { 17178, 7735 }, { 17216, 7827 }, { 17256, 7936 },
+    { 17191, 7737 }, { 17282, 7941 }, { 17235, 7946 }, { 17198, 7736 },
+    { 17212, 7734 }, { 17228, 7871 }, { 17283, 7936 }, { 17227, 7735 },
+    { 17208, 7735 }, { 17263, 7947 }, { 17292, 7948 }, { 17266, 7950 },
+    { 17287, 7949 }, { 17294, 7953 }, { 17265, 7871 }, { 17302, 7954 },
+    { 17189, 7735 }, { 17303, 7956 }, { 17264, 7957 }, { 17218, 7827 },
+    { 17274, 7958 }, { 17303, 7959 }, { 17304, 7974 }, { 17211, 7737 },
+    { 17260, 7767 }, { 17292, 7768 }, { 17309, 7770 }, { 17233, 7737 },
+    { 17305, 7771 }, { 17308, 7996 }, { 17278, 7997 }, { 17269, 7937 },
+    { 17310, 8003 }, { 17287, 8004 }, { 17318, 8007 }, { 17314, 7776 },
+    { 17281, 7777 }, { 17266, 8010 }, { 17273, 8011 }, { 17173, 7735 },
+    { 17315, 8012 }, { 17265, 8013 }, { 17194, 7735 }, { 17315, 7783 },
+    { 17282, 7785 }, { 17318, 7789 }, { 17279, 7790 }, { 17324, 7791 },
+    { 17259, 7768 }, { 17299, 8023 }, { 17320, 8033 }, { 17282, 7801 },
+    { 17280, 7802 }, { 17304, 7806 }, { 17342, 7807 }, { 17300, 8023 },
+    { 17332, 7801 }, { 17278, 7803 }, { 17312, 7804 }, { 17280, 7803 },
+    { 17293, 7804 }, { 17333, 7808 }, { 17304, 7803 }, { 17242, 7948 },
+    { 17334, 7809 }, { 17326, 7811 }, { 17327, 7812 }, { 17339, 7814 },
+    { 17327, 7815 }, { 17318, 7804 }, { 17311, 7816 }, { 17276, 7767 },
+    { 17342, 8051 }, { 17352, 8052 }, { 17333, 7818 }, { 17267, 8003 },
+    { 17324, 7820 }, { 17340, 7821 }, { 17327, 7822 }, { 17348, 7823 },
+    { 17344, 7824 }, { 17345, 7826 }, { 17331, 7829 }, { 17315, 7832 },
+    { 17308, 7835 }, { 17357, 7836 }, { 17335, 7839 }, { 17316, 7853 },
+    { 17367, 7855 }, { 17311, 7853 }, { 17315, 7853 }, { 17339, 7857 },
+    { 17334, 7856 }, { 17346, 7808 }, { 17366, 7854 }, { 17363, 7858 },
+    { 17370, 7854 }, { 17337, 7858 }, { 17390, 7858 }, { 17349, 7855 },
+    { 17357, 7855 }, { 17386, 7842 }, { 17345, 7844 }, { 17369, 7845 },
+    { 17397, 8079 }, { 17398, 7863 }, { 17348, 8089 }, { 17306, 7804 },
+    { 17402, 8099 }, { 17339, 7854 }, { 17376, 8104 }, { 17364, 7854 },
+    { 17391, 8106 }, { 17359, 7856 }, { 17352, 8107 }, { 17358, 7854 },
+    { 17381, 8109 }, { 17339, 7856 }, { 17381, 8108 }, { 17358, 8113 },
+    { 17344, 7855 }, { 17356, 8110 }, { 17388, 8114 }, { 17385, 7856 },
+    { 17375, 7855 }, { 17342, 8089 }, { 17404, 8108 }, { 17365, 8116 },
+    { 17389, 8117 }, { 17383, 8107 }, { 17399, 8120 }, { 17363, 8124 },
+    { 17361, 8133 }, { 17357, 7863 }, { 17421, 8137 }, { 17424, 8135 },
+    { 17376, 7856 }, { 17409, 8136 }, { 17376, 8110 }, { 17377, 8138 },
+    { 17353, 7854 }, { 17379, 7856 }, { 17379, 7856 }, { 17405, 8142 },
+    { 17374, 8144 }, { 17393, 8146 }, { 17432, 8147 }, { 17416, 8144 },
+    { 17425, 8148 }, { 17328, 7856 }, { 17382, 8150 }, { 17336, 7856 },
+    { 17406, 8152 }, { 17416, 8153 }, { 17428, 8154 }, { 17428, 8155 },
+    { 17431, 8157 }, { 17394, 7922 }, { 17431, 7925 }, { 17400, 8144 },
+    { 17429, 8158 }, { 17431, 8159 }, { 17433, 8161 }, { 17403, 8162 },
+    { 17436, 8162 }, { 17440, 8164 }, { 17455, 8174 }, { 17408, 8191 },
+    { 17419, 8200 }, { 17397, 8159 }, { 17405, 8201 }, { 17392, 8159 },
+    { 17449, 8202 }, { 17420, 7979 }, { 17414, 7980 }, { 17415, 8211 },
+    { 17421, 8164 }, { 17460, 8212 }, { 17427, 8214 }, { 17454, 8226 },
+    { 17412, 7925 }, { 17436, 8235 }, { 17470, 8238 }, { 17444, 8043 },
+    { 17426, 8045 }, { 17443, 8048 }, { 17472, 8049 }, { 17381, 8147 },
+    { 17383, 8144 }, { 17461, 8050 }, { 17446, 8053 }, { 17421, 8054 },
+    { 17448, 8055 }, { 17420, 8056 }, { 17421, 8057 }, { 17467, 8058 },
+    { 17468, 8059 }, { 17469, 8290 }, { 17434, 8061 }, { 17456, 8043 },
+    { 17487, 8064 }, { 17441, 8065 }, { 17450, 8067 }, { 17441, 8296 },
+    { 17430, 8297 }, { 17434, 8355 }, { 17462, 8397 }, { 17452, 8164 },
+    { 17466, 8398 }, { 17437, 8402 }, { 17487, 8398 }, { 17423, 8043 },
+    { 17455, 8399 }, { 17445, 8399 }, { 17471, 8404 }, { 17495, 8424 },
+    { 17497, 8425 }, { 17502, 8426 }, { 17489, 8427 }, { 17444, 7979 },
+    { 17501, 8428 }, { 17491, 8451 }, { 17499, 8451 }, { 17489, 8465 },
+    { 17464, 8239 }, { 17463, 8240 }, { 17504, 8240 }, { 17473, 8241 },
+    { 17457, 8242 }, { 17510, 8467 }, { 17500, 8467 }, { 17490, 8402 },
+    { 17469, 8468 }, { 17497, 8470 }, { 17443, 8399 }, { 17426, 8048 },
+    { 17490, 8471 }, { 17505, 8244 }, { 17473, 8247 }, { 17512, 8251 },
+    { 17475, 8253 }, { 17479, 8255 }, { 17521, 8256 }, { 17527, 8257 },
+    { 17525, 8489 }, { 17519, 8491 }, { 17482, 8492 }, { 17478, 8503 },
+    { 17515, 8492 }, { 17511, 8504 }, { 17476, 8507 }, { 17665, 8277 },
+    { 17666, 8278 }, { 17438, 8279 }, { 17440, 8281 }, { 17670, 8283 },
+    { 17671, 8284 }, { 17672, 8285 }, { 17673, 8286 }, { 17675, 8287 },
+    { 17447, 8294 }, { 17679, 8295 }, { 17447, 8298 }, { 17447, 8307 },
+    { 17448, 8315 }, { 17455, 8336 }, { 17686, 8280 }, { 17455, 8303 },
+    { 17458, 8282 }, { 17685, 8336 }, { 17455, 8288 }, { 17690, 8289 },
+    { 17468, 8467 }, { 17691, 8291 }, { 17462, 8293 }, { 17449, 8315 },
+    { 17693, 8299 }, { 17694, 8300 }, { 17695, 8302 }, { 17696, 8304 },
+    { 17697, 8305 }, { 17468, 8347 }, { 17699, 8292 }, { 17700, 8306 },
+    { 17446, 8287 }, { 17678, 8294 }, { 17470, 8301 }, { 17702, 8308 },
+    { 17703, 8309 }, { 17704, 8317 }, { 17705, 8338 }, { 17477, 8364 },
+    { 17707, 8310 }, { 17478, 8311 }, { 17709, 8312 }, { 17710, 8313 },
+    { 17711, 8314 }, { 17478, 8348 }, { 17480, 8316 }, { 17714, 8318 },
+    { 17715, 8319 }, { 17716, 8320 }, { 17483, 8354 }, { 17718, 8321 },
+    { 17489, 8323 }, { 17720, 8325 }, { 17721, 8331 }, { 17722, 8334 },
+    { 17490, 8365 }, { 17724, 8375 }, { 17444, 8286 }, { 17725, 8322 },
+    { 17726, 8335 }, { 17494, 8324 }, { 17728, 8359 }, { 17499, 8326 },
+    { 17730, 8333 }, { 17497, 8346 }, { 17502, 8361 }, { 17503, 8327 },
+    { 17734, 8337 }, { 17736, 8339 }, { 17739, 8343 }, { 17509, 8363 },
+    { 17737, 8339 }, { 17511, 8367 }, { 17743, 8370 }, { 17744, 8373 },
+    { 17745, 8374 }, { 17746, 8376 }, { 17747, 8386 }, { 17748, 8393 },
+    { 17518, 8394 }, { 17751, 8395 }, { 17522, 8395 }, { 17750, 8394 },
+    { 17753, 8396 }, { 17754, 8400 }, { 17521, 8406 }, { 17525, 8413 },
+    { 17757, 8420 }, { 17758, 8340 }, { 17759, 8341 }, { 17760, 8368 },
+    { 17761, 8369 }, { 17762, 8372 }, { 17505, 8337 }, { 17763, 8385 },
+    { 17764, 8387 }, { 17766, 8390 }, { 17767, 8328 }, { 17768, 8357 },
+    { 17742, 8367 }, { 17536, 8387 }, { 17769, 8401 }, { 17770, 8422 },
+    { 17771, 8430 }, { 17772, 8437 }, { 17773, 8444 }, { 17544, 8449 },
+    { 17777, 8459 }, { 17779, 8356 }, { 17780, 8379 }, { 17781, 8381 },
+    { 17782, 8329 }, { 17549, 8330 }, { 17553, 8345 }, { 17551, 8382 },
+    { 17738, 8339 }, { 17786, 8332 }, { 17555, 8366 }, { 17555, 8377 },
+    { 17790, 8410 }, { 17791, 8342 }, { 17792, 8344 }, { 17793, 8351 },
+    { 17774, 8444 }, { 17564, 8349 }, { 17795, 8350 }, { 17778, 8459 },
+    { 17796, 8352 }, { 17797, 8362 }, { 17567, 8383 }, { 17799, 8353 },
+    { 17570, 8358 }, { 17570, 8360 }, { 17572, 8371 }, { 17803, 8378 },
+    { 17574, 8380 }, { 17809, 8384 }, { 17810, 8392 }, { 17811, 8403 },
+    { 17775, 8444 }, { 17812, 8388 }, { 17579, 8389 }, { 17814, 8409 },
+    { 17581, 8391 }, { 17816, 8405 }, { 17817, 8407 }, { 17818, 8408 },
+    { 17819, 8412 }, { 17820, 8421 }, { 17821, 8423 }, { 17822, 8447 },
+    { 17823, 8454 }, { 17824, 8466 }, { 17825, 8411 }, { 17826, 8440 },
+    { 17598, 8448 }, { 17828, 8414 }, { 17829, 8415 }, { 17830, 8417 },
+    { 17831, 8441 }, { 17602, 8416 }, { 17834, 8418 }, { 17835, 8419 },
+    { 17836, 8429 }, { 17837, 8431 }, { 17832, 8441 }, { 17838, 8432 },
+    { 17839, 8433 }, { 17609, 8434 }, { 17611, 8435 }, { 17842, 8436 },
+    { 17843, 8438 }, { 17844, 8483 }, { 17845, 8439 }, { 17846, 8442 },
+    { 17847, 8443 }, { 17848, 8445 }, { 17849, 8446 }, { 17616, 8450 },
+    { 17617, 8452 }, { 17852, 8453 }, { 17624, 8455 }, { 17854, 8460 },
+    { 17855, 8456 }, { 17856, 8457 }, { 17857, 8458 }, { 17628, 8461 },
+    { 17859, 8462 }, { 17860, 8463 }, { 17861, 8464 }, { 17862, 8469 },
+    { 17863, 8473 }, { 17634, 8472 }, { 17635, 8474 }, { 17866, 8475 },
+    { 17867, 8476 }, { 17637, 8477 }, { 17638, 8478 }, { 17639, 8479 },
+    { 17871, 8480 }, { 17641, 8481 }, { 17873, 8482 }, { 17874, 8484 },
+    { 17875, 8486 }, { 17876, 8485 }, { 17643, 8487 }, { 17878, 8493 },
+    { 17880, 8495 }, { 17651, 8496 }, { 17654, 8497 }, { 17647, 8495 },
+    { 17656, 8498 }, { 17659, 8505 }, { 17659, 8509 }, { 17656, 8497 },
+    { 17661, 8509 }, { 17663, 8510 }, { 17668, 8511 }, { 17899, 8515 },
+    { 17670, 8516 }, { 17674, 8517 }, { 17652, 8496 }, { 17674, 8519 },
+    { 17675, 8519 }, { 17895, 8510 }, { 17909, 8520 }, { 17681, 8522 },
+    { 17680, 8523 }, { 17681, 8531 }, { 17682, 8532 }, { 17896, 8510 },
+    { 17914, 8533 }, { 17916, 8536 }, { 17689, 8541 }, { 17687, 8540 },
+    { 17667, 8510 }, { 17689, 8540 }, { 17658, 8498 }, { 17920, 8543 },
+    { 17698, 8550 }, { 17921, 8544 }, { 17669, 8511 }, { 17915, 8533 },
+    { 17922, 8544 }, { 17694, 8549 }, { 17929, 8551 }, { 17879, 8493 },
+    { 17701, 8552 }, { 17695, 8549 }, { 17704, 8552 }, { 17936, 8553 },
+    { 17937, 8560 }, { 17704, 8552 }, { 17710, 8561 }, { 17708, 8562 },
+    { 17713, 8563 }, { 17710, 8561 }, { 17653, 8496 }, { 17714, 8564 },
+    { 17675, 8519 }, { 17946, 8565 }, { 17947, 8566 }, { 17679, 8519 },
+    { 17720, 8567 }, { 17952, 8568 }, { 17722, 8576 }, { 17696, 8549 },
+    { 17721, 8573 }, { 17957, 8580 }, { 17958, 8589 }, { 17959, 8590 },
+    { 17730, 8592 }, { 17718, 8567 }, { 17734, 8593 }, { 17736, 8596 },
+    { 17738, 8597 }, { 17969, 8598 }, { 17739, 8600 }, { 17974, 8605 },
+    { 17975, 8608 }, { 17977, 8612 }, { 17748, 8613 }, { 17749, 8616 },
+    { 17939, 8560 }, { 17697, 8549 }, { 17966, 8593 }, { 17748, 8617 },
+    { 17983, 8619 }, { 17985, 8620 }, { 17757, 8621 }, { 17717, 8566 },
+    { 17989, 8622 }, { 17955, 8573 }, { 17760, 8625 }, { 17758, 8628 },
+    { 17992, 8630 }, { 17995, 8631 }, { 17764, 8601 }, { 17767, 8603 },
+    { 17768, 8604 }, { 17768, 8609 }, { 18002, 8615 }, { 18003, 8633 },
+    { 17988, 8621 }, { 17733, 8592 }, { 17730, 8590 }, { 17773, 8634 },
+    { 17774, 8638 }, { 17748, 8617 }, { 17774, 8647 }, { 17778, 8657 },
+    { 17778, 8626 }, { 17778, 8637 }, { 17780, 8639 }, { 17754, 8619 },
+    { 17718, 8566 }, { 17778, 8646 }, { 17742, 8600 }, { 18013, 8659 },
+    { 17756, 8620 }, { 17973, 8600 }, { 17777, 8639 }, { 17782, 8663 },
+    { 18015, 8670 }, { 18016, 8674 }, { 17786, 8676 }, { 18017, 8674 },
+    { 17762, 8630 }, { 18019, 8678 }, { 18021, 8679 }, { 18022, 8680 },
+    { 18023, 8685 }, { 17795, 8689 }, { 17794, 8660 }, { 17745, 8608 },
+    { 17797, 8662 }, { 17798, 8666 }, { 18030, 8683 }, { 17800, 8686 },
+    { 18032, 8687 }, { 18033, 8688 }, { 17804, 8690 }, { 17806, 8693 },
+    { 17807, 8694 }, { 18041, 8703 }, { 17811, 8704 }, { 17796, 8660 },
+    { 17812, 8710 }, { 17800, 8688 }, { 17790, 8678 }, { 17816, 8718 },
+    { 18047, 8524 }, { 18048, 8525 }, { 18049, 8526 }, { 18050, 8529 },
+    { 17819, 8499 }, { 17809, 8694 }, { 18052, 8534 }, { 18053, 8488 },
+    { 18040, 8694 }, { 18054, 8500 }, { 18055, 8502 }, { 17827, 8542 },
+    { 18057, 8490 }, { 18058, 8494 }, { 18059, 8513 }, { 18060, 8521 },
+    { 18061, 8556 }, { 17805, 8690 }, { 18062, 8501 }, { 17831, 8512 },
+    { 18064, 8527 }, { 17834, 8506 }, { 18066, 8508 }, { 17837, 8514 },
+    { 18068, 8518 }, { 18069, 8528 }, { 18070, 8575 }, { 18071, 8530 },
+    { 17843, 8535 }, { 18073, 8537 }, { 18074, 8538 }, { 18075, 8539 },
+    { 18076, 8545 }, { 18077, 8546 }, { 17848, 8547 }, { 18079, 8548 },
+    { 18080, 8554 }, { 18081, 8555 }, { 17848, 8557 }, { 18083, 8569 },
+    { 18084, 8570 }, { 18086, 8572 }, { 18087, 8684 }, { 18088, 8697 },
+    { 17858, 8708 }, { 18090, 8717 }, { 18091, 8719 }, { 18092, 8720 },
+    { 18085, 8570 }, { 18093, 8722 }, { 18094, 8729 }, { 18096, 8742 },
+    { 18097, 8585 }, { 18098, 8623 }, { 18099, 8558 }, { 17868, 8559 },
+    { 18101, 8571 }, { 18102, 8579 }, { 18103, 8594 }, { 18104, 8574 },
+    { 18105, 8587 }, { 18106, 8577 }, { 17877, 8578 }, { 18095, 8729 },
+    { 18108, 8581 }, { 17879, 8582 }, { 18110, 8583 }, { 18111, 8584 },
+    { 18112, 8586 }, { 18113, 8588 }, { 18114, 8606 }, { 18115, 8627 },
+    { 17886, 8591 }, { 18117, 8595 }, { 18118, 8599 }, { 17886, 8602 },
+    { 18121, 8607 }, { 18122, 8610 }, { 17892, 8640 }, { 17893, 8642 },
+    { 17894, 8614 }, { 17892, 8624 }, { 17897, 8611 }, { 17897, 8629 },
+    { 18129, 8632 }, { 18130, 8618 }, { 18131, 8635 }, { 18132, 8636 },
+    { 18133, 8641 }, { 18135, 8643 }, { 18136, 8644 }, { 18137, 8645 },
+    { 18138, 8648 }, { 18139, 8651 }, { 18140, 8692 }, { 18141, 8649 },
+    { 17913, 8650 }, { 17911, 8652 }, { 18144, 8653 }, { 18145, 8654 },
+    { 18146, 8655 }, { 18147, 8656 }, { 18148, 8658 }, { 18149, 8661 },
+    { 18150, 8664 }, { 18151, 8665 }, { 18152, 8667 }, { 18153, 8698 },
+    { 18158, 8699 }, { 18163, 8702 }, { 18154, 8698 }, { 18159, 8700 },
+    { 18160, 8700 }, { 18164, 8705 }, { 18165, 8727 }, { 18166, 8730 },
+    { 18155, 8698 }, { 18134, 8641 }, { 18156, 8698 }, { 18167, 8732 },
+    { 18161, 8700 }, { 18172, 8735 }, { 18175, 8736 }, { 18176, 8737 },
+    { 18177, 8738 }, { 18173, 8735 }, { 18178, 8740 }, { 18179, 8744 },
+    { 18180, 8746 }, { 18181, 8749 }, { 18182, 8754 }, { 18183, 8755 },
+    { 18184, 8761 }, { 18157, 8698 }, { 18185, 8762 }, { 18186, 8763 },
+    { 18168, 8732 }, { 18187, 8765 }, { 18188, 8766 }, { 18189, 8767 },
+    { 18190, 8772 }, { 18193, 8785 }, { 18194, 8787 }, { 18195, 8750 },
+    { 18196, 8752 }, { 18197, 8771 }, { 18198, 8774 }, { 18200, 8775 },
+    { 18191, 8772 }, { 18201, 8776 }, { 18202, 8779 }, { 18204, 8783 },
+    { 18203, 8779 }, { 18169, 8732 }, { 18206, 8794 }, { 18170, 8732 },
+    { 18207, 8795 }, { 18208, 8796 }, { 18162, 8700 }, { 18174, 8735 },
+    { 18209, 8797 }, { 18210, 8798 }, { 18171, 8732 }, { 18211, 8800 },
+    { 18199, 8774 }, { 18212, 8801 }, { 18214, 8806 }, { 18215, 8769 },
+    { 18218, 8781 }, { 18219, 8786 }, { 18220, 8808 }, { 18221, 8816 },
+    { 18222, 8825 }, { 18223, 8826 }, { 18224, 8827 }, { 18225, 8828 },
+    { 18226, 8802 }, { 18227, 8809 }, { 18228, 8815 }, { 18229, 8831 },
+    { 18230, 8835 }, { 18231, 8842 }, { 18232, 8846 }, { 18233, 8848 },
+    { 18236, 8811 }, { 18192, 8772 }, { 18234, 8858 }, { 18237, 8813 },
+    { 18238, 8829 }, { 18240, 8833 }, { 18239, 8829 }, { 18241, 8834 },
+    { 18213, 8801 }, { 18243, 8837 }, { 18245, 8840 }, { 18244, 8837 },
+    { 18246, 8841 }, { 18017, 8668 }, { 18249, 8669 }, { 18250, 8709 },
+    { 18017, 8721 }, { 18020, 8739 }, { 18205, 8783 }, { 18216, 8769 },
+    { 18217, 8769 }, { 18235, 8858 }, { 18253, 8760 }, { 18024, 8671 },
+    { 18025, 8672 }, { 18027, 8711 }, { 18257, 8712 }, { 18258, 8713 },
+    { 18259, 8714 }, { 18247, 8841 }, { 18242, 8834 }, { 18260, 8673 },
+    { 18261, 8723 }, { 18263, 8675 }, { 18264, 8677 }, { 18265, 8681 },
+    { 18035, 8682 }, { 18267, 8691 }, { 18268, 8695 }, { 18040, 8696 },
+    { 18270, 8701 }, { 18271, 8706 }, { 18272, 8707 }, { 18273, 8751 },
+    { 18274, 8715 }, { 18275, 8716 }, { 18045, 8724 }, { 18277, 8725 },
+    { 18278, 8726 }, { 18279, 8728 }, { 18051, 8731 }, { 18050, 8733 },
+    { 18282, 8734 }, { 18053, 8741 }, { 18285, 8743 }, { 18056, 8745 },
+    { 18287, 8747 }, { 18288, 8748 }, { 18289, 8753 }, { 18060, 8790 },
+    { 18291, 8784 }, { 18292, 8803 }, { 18293, 8820 }, { 18294, 8773 },
+    { 18295, 8782 }, { 18067, 8799 }, { 18297, 8756 }, { 18298, 8757 },
+    { 18299, 8758 }, { 18300, 8759 }, { 18301, 8764 }, { 18302, 8768 },
+    { 18303, 8770 }, { 18304, 8777 }, { 18305, 8778 }, { 18306, 8832 },
+    { 18078, 8780 }, { 18308, 8788 }, { 18309, 8789 }, { 18079, 8791 },
+    { 18082, 8792 }, { 18082, 8793 }, { 18313, 8804 }, { 18314, 8805 },
+    { 18085, 8807 }, { 18317, 8810 }, { 18318, 8812 }, { 18319, 8814 },
+    { 18320, 8817 }, { 18321, 8818 }, { 18322, 8819 }, { 18090, 8821 },
+    { 18095, 8822 }, { 18325, 8850 }, { 18326, 8824 }, { 18327, 8839 },
+    { 18328, 8843 }, { 18329, 8860 }, { 18330, 8836 }, { 18331, 8845 },
+    { 18332, 8823 }, { 18333, 8830 }, { 18104, 8851 }, { 18102, 8838 },
+    { 18336, 8844 }, { 18337, 8852 }, { 18338, 8853 }, { 18339, 8847 },
+    { 18340, 8849 }, { 18341, 8854 }, { 18109, 8884 }, { 18343, 8855 },
+    { 18344, 8856 }, { 18345, 8857 }, { 18347, 8859 }, { 18348, 8861 },
+    { 18350, 8904 }, { 18351, 8862 }, { 18352, 8863 }, { 18353, 8864 },
+    { 18354, 8872 }, { 18355, 8865 }, { 18356, 8866 }, { 18127, 8867 },
+    { 18129, 8868 }, { 18359, 8869 }, { 18360, 8870 }, { 18112, 8857 },
+    { 18361, 8871 }, { 18362, 8873 }, { 18363, 8874 }, { 18364, 8875 },
+    { 18365, 8876 }, { 18349, 8861 }, { 18366, 8887 }, { 18367, 8877 },
+    { 18368, 8878 }, { 18139, 8879 }, { 18140, 8880 }, { 18371, 8881 },
+    { 18372, 8925 }, { 18143, 8882 }, { 18374, 8883 }, { 18375, 8885 },
+    { 18376, 8886 }, { 18143, 8888 }, { 18144, 8918 }, { 18145, 8889 },
+    { 18380, 8922 }, { 18381, 8890 }, { 18382, 8890 }, { 18383, 8891 },
+    { 18384, 8896 }, { 18385, 8897 }, { 18387, 8898 }, { 18388, 8898 },
+    { 18389, 8899 }, { 18391, 8901 }, { 18394, 8905 }, { 18396, 8906 },
+    { 18163, 8920 }, { 18398, 8921 }, { 18399, 8923 }, { 18400, 8927 },
+    { 18171, 8946 }, { 18403, 8954 }, { 18390, 8899 }, { 18404, 8924 },
+    { 18405, 8928 }, { 18406, 8931 }, { 18392, 8901 }, { 18407, 8939 },
+    { 18386, 8897 }, { 18409, 8961 }, { 18167, 8927 }, { 18410, 8963 },
+    { 18411, 8973 }, { 18412, 8912 }, { 18413, 8935 }, { 18414, 8937 },
+    { 18393, 8901 }, { 18415, 8940 }, { 18416, 8948 }, { 18417, 8950 },
+    { 18418, 8966 }, { 18419, 8892 }, { 18420, 8907 }, { 18421, 8915 },
+    { 18424, 8916 }, { 18422, 8917 }, { 18425, 8929 }, { 18426, 8934 },
+    { 18427, 8944 }, { 18428, 8893 }, { 18429, 8894 }, { 18430, 8895 },
+    { 18431, 8900 }, { 18432, 8902 }, { 18203, 8926 }, { 18435, 8930 },
+    { 18436, 8932 }, { 18437, 8933 }, { 18204, 8926 }, { 18438, 8943 },
+    { 18206, 8945 }, { 18210, 8947 }, { 18395, 8905 }, { 18212, 8964 },
+    { 18408, 8939 }, { 18423, 8917 }, { 18443, 8975 }, { 18446, 8985 },
+    { 18217, 8996 }, { 18448, 8997 }, { 18449, 8999 }, { 18450, 8956 },
+    { 18452, 8958 }, { 18223, 8967 }, { 18454, 8968 }, { 18455, 8969 },
+    { 18458, 8952 }, { 18459, 8976 }, { 18460, 8977 }, { 18461, 8983 },
+    { 18441, 8947 }, { 18462, 9008 }, { 18463, 9009 }, { 18464, 8908 },
+    { 18465, 8909 }, { 18236, 8913 }, { 18467, 8903 }, { 18238, 8910 },
+    { 18236, 8911 }, { 18470, 8914 }, { 18471, 8919 }, { 18456, 8969 },
+    { 18241, 8941 }, { 18478, 8949 }, { 18479, 8979 }, { 18480, 8974 },
+    { 18481, 8980 }, { 18482, 8984 }, { 18483, 8987 }, { 18484, 8989 },
+    { 18485, 8936 }, { 18257, 8938 }, { 18487, 8955 }, { 18219, 8956 },
+    { 18488, 8962 }, { 18490, 8971 }, { 18491, 8942 }, { 18492, 8953 },
+    { 18493, 8970 }, { 18472, 8919 }, { 18494, 8988 }, { 18444, 8975 },
+    { 18265, 9000 }, { 18496, 9007 }, { 18497, 8990 }, { 18498, 8991 },
+    { 18499, 8998 }, { 18500, 9018 }, { 18501, 9019 }, { 18502, 9022 },
+    { 18503, 9029 }, { 18504, 9035 }, { 18507, 8993 }, { 18508, 8994 },
+    { 18474, 8941 }, { 18509, 8995 }, { 18510, 9005 }, { 18511, 9010 },
+    { 18512, 8951 }, { 18279, 8957 }, { 18489, 8962 }, { 18514, 8959 },
+    { 18515, 9006 }, { 18516, 9011 }, { 18505, 9035 }, { 18285, 9012 },
+    { 18284, 9015 }, { 18519, 8965 }, { 18520, 9013 }, { 18291, 8960 },
+    { 18290, 8972 }, { 18523, 8978 }, { 18525, 8981 }, { 18476, 8941 },
+    { 18526, 8982 }, { 18294, 9016 }, { 18296, 9044 }, { 18294, 9021 },
+    { 18297, 9053 }, { 18532, 8986 }, { 18477, 8941 }, { 18533, 8992 },
+    { 18303, 9001 }, { 18538, 9003 }, { 18539, 9023 }, { 18540, 9025 },
+    { 18541, 9026 }, { 18542, 9028 }, { 18543, 9032 }, { 18544, 9063 },
+    { 18314, 9080 }, { 18546, 9002 }, { 18535, 9001 }, { 18536, 9001 },
+    { 18317, 9020 }, { 18306, 9001 }, { 18548, 9024 }, { 18549, 9039 },
+    { 18506, 9035 }, { 18529, 9021 }, { 18550, 9014 }, { 18551, 9031 },
+    { 18552, 9033 }, { 18553, 9034 }, { 18554, 9058 }, { 18555, 9078 },
+    { 18557, 9088 }, { 18326, 9004 }, { 18329, 9017 }, { 18331, 9027 },
+    { 18332, 9030 }, { 18563, 9036 }, { 18556, 9078 }, { 18335, 9037 },
+    { 18565, 9038 }, { 18566, 9040 }, { 18567, 9041 }, { 18568, 9042 },
+    { 18338, 9046 }, { 18570, 9089 }, { 18571, 9091 }, { 18572, 9043 },
+    { 18573, 9045 }, { 18574, 9082 }, { 18575, 9047 }, { 18576, 9048 },
+    { 18558, 9088 }, { 18577, 9103 }, { 18578, 9049 }, { 18579, 9050 },
+    { 18580, 9064 }, { 18581, 9112 }, { 18582, 9051 }, { 18583, 9052 },
+    { 18584, 9102 }, { 18586, 9054 }, { 18587, 9062 }, { 18588, 9056 },
+    { 18589, 9059 }, { 18590, 9061 }, { 18592, 9069 }, { 18585, 9102 },
+    { 18593, 9074 }, { 18595, 9077 }, { 18596, 9083 }, { 18597, 9087 },
+    { 18598, 9095 }, { 18599, 9104 }, { 18600, 9130 }, { 18594, 9074 },
+    { 18601, 9055 }, { 18602, 9098 }, { 18603, 9100 }, { 18604, 9075 },
+    { 18605, 9075 }, { 18606, 9093 }, { 18607, 9106 }, { 18608, 9111 },
+    { 18609, 9117 }, { 18610, 9124 }, { 18611, 9065 }, { 18612, 9085 },
+    { 18613, 9079 }, { 18614, 9097 }, { 18616, 9108 }, { 18617, 9109 },
+    { 18618, 9057 }, { 18385, 9067 }, { 18386, 9090 }, { 18621, 9060 },
+    { 18622, 9066 }, { 18623, 9068 }, { 18624, 9070 }, { 18625, 9071 },
+    { 18626, 9072 }, { 18394, 9073 }, { 18628, 9076 }, { 18629, 9081 },
+    { 18630, 9084 }, { 18401, 9086 }, { 18632, 9096 }, { 18633, 9142 },
+    { 18634, 9092 }, { 18404, 9094 }, { 18407, 9099 }, { 18407, 9101 },
+    { 18638, 9105 }, { 18409, 9143 }, { 18410, 9107 }, { 18641, 9110 },
+    { 18642, 9113 }, { 18643, 9114 }, { 18644, 9115 }, { 18645, 9116 },
+    { 18416, 9118 }, { 18647, 9119 }, { 18648, 9120 }, { 18649, 9121 },
+    { 18650, 9122 }, { 18651, 9123 }, { 18652, 9125 }, { 18422, 9131 },
+    { 18421, 9126 }, { 18655, 9127 }, { 18656, 9178 }, { 18657, 9128 },
+    { 18658, 9129 }, { 18659, 9132 }, { 18428, 9133 }, { 18661, 9156 },
+    { 18663, 9134 }, { 18664, 9135 }, { 18665, 9136 }, { 18432, 9137 },
+    { 18667, 9138 }, { 18668, 9139 }, { 18669, 9147 }, { 18670, 9140 },
+    { 18671, 9141 }, { 18672, 9145 }, { 18441, 9157 }, { 18674, 9144 },
+    { 18446, 9146 }, { 18676, 9148 }, { 18677, 9159 }, { 18678, 9149 },
+    { 18679, 9150 }, { 18446, 9151 }, { 18681, 9152 }, { 18682, 9153 },
+    { 18683, 9154 }, { 18452, 9155 }, { 18685, 9158 }, { 18452, 9160 },
+    { 18455, 9161 }, { 18454, 9180 }, { 18690, 9184 }, { 18691, 9162 },
+    { 18692, 9163 }, { 18693, 9164 }, { 18694, 9165 }, { 18465, 9166 },
+    { 18696, 9167 }, { 18697, 9168 }, { 18698, 9169 }, { 18713, 9170 },
+    { 18720, 9173 }, { 18699, 9169 }, { 18721, 9174 }, { 18493, 9175 },
+    { 18722, 9174 }, { 18700, 9169 }, { 18724, 9176 }, { 18701, 9169 },
+    { 18468, 9169 }, { 18703, 9169 }, { 18714, 9171 }, { 18474, 9169 },
+    { 18492, 9179 }, { 18726, 9183 }, { 18727, 9183 }, { 18733, 9188 },
+    { 18715, 9171 }, { 18731, 9186 }, { 18734, 9188 }, { 18735, 9190 },
+    { 18473, 9169 }, { 18742, 9192 }, { 18746, 9194 }, { 18518, 9197 },
+    { 18716, 9171 }, { 18744, 9193 }, { 18706, 9169 }, { 18736, 9191 },
+    { 18748, 9201 }, { 18737, 9191 }, { 18749, 9205 }, { 18757, 9215 },
+    { 18534, 9234 }, { 18527, 9227 }, { 18708, 9169 }, { 18758, 9226 },
+    { 18738, 9191 }, { 18759, 9226 }, { 18535, 9235 }, { 18766, 9236 },
+    { 18709, 9169 }, { 18768, 9240 }, { 18770, 9210 }, { 18710, 9169 },
+    { 18762, 9227 }, { 18728, 9183 }, { 18771, 9223 }, { 18751, 9206 },
+    { 18729, 9183 }, { 18739, 9191 }, { 18730, 9183 }, { 18745, 9193 },
+    { 18772, 9224 }, { 18754, 9214 }, { 18544, 9231 }, { 18752, 9206 },
+    { 18711, 9169 }, { 18712, 9169 }, { 18740, 9191 }, { 18732, 9186 },
+    { 18774, 9232 }, { 18775, 9238 }, { 18488, 9171 }, { 18776, 9241 },
+    { 18520, 9205 }, { 18753, 9206 }, { 18755, 9214 }, { 18718, 9171 },
+    { 18767, 9236 }, { 18743, 9192 }, { 18777, 9254 }, { 18778, 9257 },
+    { 18779, 9257 }, { 18769, 9240 }, { 18741, 9191 }, { 18780, 9261 },
+    { 18781, 9269 }, { 18782, 9272 }, { 18783, 9202 }, { 18756, 9214 },
+    { 18784, 9208 }, { 18760, 9226 }, { 18763, 9227 }, { 18785, 9213 },
+    { 18786, 9217 }, { 18787, 9228 }, { 18788, 9246 }, { 18789, 9248 },
+    { 18790, 9249 }, { 18791, 9250 }, { 18792, 9222 }, { 18563, 9229 },
+    { 18794, 9233 }, { 18796, 9239 }, { 18797, 9259 }, { 18567, 9275 },
+    { 18567, 9276 }, { 18801, 9285 }, { 18802, 9237 }, { 18803, 9263 },
+    { 18804, 9268 }, { 18805, 9270 }, { 18806, 9273 }, { 18807, 9274 },
+    { 18808, 9277 }, { 18578, 9279 }, { 18581, 9172 }, { 18811, 9187 },
+    { 18812, 9196 }, { 18813, 9198 }, { 18814, 9199 }, { 18815, 9207 },
+    { 18816, 9230 }, { 18817, 9243 }, { 18818, 9255 }, { 18819, 9177 },
+    { 18820, 9204 }, { 18821, 9181 }, { 18592, 9182 }, { 18589, 9185 },
+    { 18824, 9189 }, { 18593, 9195 }, { 18594, 9200 }, { 18827, 9209 },
+    { 18828, 9212 }, { 18829, 9280 }, { 18795, 9233 }, { 18830, 9281 },
+    { 18831, 9286 }, { 18832, 9290 }, { 18833, 9291 }, { 18834, 9303 },
+    { 18601, 9304 }, { 18836, 9324 }, { 18837, 9332 }, { 18605, 9339 },
+    { 18839, 9278 }, { 18840, 9297 }, { 18841, 9299 }, { 18842, 9314 },
+    { 18843, 9317 }, { 18844, 9203 }, { 18845, 9245 }, { 18846, 9258 },
+    { 18847, 9260 }, { 18848, 9282 }, { 18799, 9275 }, { 18850, 9289 },
+    { 18851, 9308 }, { 18852, 9327 }, { 18854, 9335 }, { 18855, 9265 },
+    { 18624, 9284 }, { 18857, 9298 }, { 18858, 9300 }, { 18617, 9282 },
+    { 18853, 9327 }, { 18859, 9211 }, { 18860, 9216 }, { 18861, 9295 },
+    { 18628, 9305 }, { 18863, 9307 }, { 18864, 9329 }, { 18865, 9336 },
+    { 18866, 9338 }, { 18867, 9264 }, { 18868, 9266 }, { 18869, 9271 },
+    { 18870, 9294 }, { 18642, 9218 }, { 18872, 9220 }, { 18873, 9267 },
+    { 18874, 9219 }, { 18875, 9287 }, { 18876, 9293 }, { 18877, 9326 },
+    { 18878, 9242 }, { 18879, 9253 }, { 18880, 9221 }, { 18647, 9225 },
+    { 18882, 9244 }, { 18883, 9247 }, { 18884, 9251 }, { 18885, 9252 },
+    { 18886, 9256 }, { 18887, 9262 }, { 18888, 9283 }, { 18657, 9288 },
+    { 18890, 9292 }, { 18891, 9301 }, { 18892, 9331 }, { 18893, 9296 },
+    { 18664, 9309 }, { 18898, 9310 }, { 18669, 9333 }, { 18900, 9340 },
+    { 18901, 9341 }, { 18902, 9345 }, { 18903, 9358 }, { 18904, 9364 },
+    { 18905, 9366 }, { 18906, 9367 }, { 18907, 9377 }, { 18674, 9383 },
+    { 18909, 9384 }, { 18910, 9385 }, { 18911, 9386 }, { 18912, 9387 },
+    { 18913, 9388 }, { 18915, 9334 }, { 18916, 9351 }, { 18896, 9309 },
+    { 18917, 9354 }, { 18685, 9371 }, { 18684, 9388 }, { 18919, 9372 },
+    { 18920, 9382 }, { 18921, 9374 }, { 18922, 9389 }, { 18923, 9393 },
+    { 18694, 9395 }, { 18925, 9402 }, { 18926, 9408 }, { 18927, 9409 },
+    { 18928, 9422 }, { 18929, 9423 }, { 18930, 9425 }, { 18931, 9347 },
+    { 18932, 9348 }, { 18933, 9349 }, { 18934, 9360 }, { 18935, 9363 },
+    { 18936, 9373 }, { 18707, 9401 }, { 18938, 9407 }, { 18939, 9410 },
+    { 18941, 9413 }, { 18942, 9417 }, { 18943, 9419 }, { 18944, 9420 },
+    { 18664, 9309 }, { 18945, 9421 }, { 18946, 9429 }, { 18947, 9435 },
+    { 18948, 9436 }, { 18949, 9302 }, { 18950, 9306 }, { 18951, 9311 },
+    { 18952, 9312 }, { 18953, 9313 }, { 18940, 9410 }, { 18954, 9315 },
+    { 18726, 9316 }, { 18956, 9319 }, { 18957, 9330 }, { 18729, 9318 },
+    { 18730, 9321 }, { 18960, 9322 }, { 18731, 9325 }, { 18733, 9323 },
+    { 18963, 9344 }, { 18964, 9320 }, { 18965, 9328 }, { 18966, 9337 },
+    { 18967, 9361 }, { 18968, 9368 }, { 18969, 9400 }, { 18970, 9416 },
+    { 18737, 9342 }, { 18972, 9343 }, { 18741, 9352 }, { 18974, 9370 },
+    { 18975, 9346 }, { 18746, 9350 }, { 18977, 9396 }, { 18748, 9353 },
+    { 18749, 9355 }, { 18980, 9365 }, { 18981, 9376 }, { 18982, 9375 },
+    { 18983, 9390 }, { 18984, 9380 }, { 18985, 9391 }, { 18986, 9397 },
+    { 18758, 9356 }, { 18761, 9357 }, { 18759, 9378 }, { 18760, 9426 },
+    { 18763, 9359 }, { 18994, 9362 }, { 18996, 9369 }, { 18995, 9362 },
+    { 18997, 9379 }, { 18998, 9381 }, { 18999, 9392 }, { 19000, 9394 },
+    { 18771, 9398 }, { 18773, 9399 }, { 19003, 9403 }, { 18770, 9452 },
+    { 18776, 9405 }, { 18772, 9418 }, { 18775, 9404 }, { 19010, 9406 },
+    { 19011, 9411 }, { 19012, 9424 }, { 19013, 9431 }, { 19014, 9474 },
+    { 19015, 9475 }, { 19016, 9412 }, { 19017, 9414 }, { 19018, 9427 },
+    { 19019, 9428 }, { 18786, 9430 }, { 19021, 9439 }, { 19022, 9441 },
+    { 19024, 9446 }, { 19025, 9448 }, { 19027, 9454 }, { 19028, 9462 },
+    { 19029, 9463 }, { 19030, 9471 }, { 19031, 9472 }, { 19033, 9482 },
+    { 19034, 9487 }, { 19035, 9460 }, { 19036, 9464 }, { 19037, 9466 },
+    { 19038, 9467 }, { 19023, 9441 }, { 19039, 9473 }, { 19040, 9477 },
+    { 19041, 9478 }, { 19042, 9484 }, { 19043, 9488 }, { 19044, 9500 },
+    { 19045, 9503 }, { 19046, 9432 }, { 19047, 9440 }, { 19048, 9461 },
+    { 19032, 9472 }, { 18819, 9438 }, { 18820, 9442 }, { 18820, 9443 },
+    { 18822, 9444 }, { 19053, 9485 }, { 19055, 9486 }, { 18823, 9490 },
+    { 19057, 9453 }, { 19058, 9458 }, { 19059, 9469 }, { 19060, 9492 },
+    { 19061, 9433 }, { 19026, 9448 }, { 19062, 9434 }, { 19063, 9415 },
+    { 19064, 9459 }, { 18832, 9465 }, { 18836, 9468 }, { 19068, 9481 },
+    { 19069, 9491 }, { 18837, 9499 }, { 18838, 9510 }, { 19072, 9511 },
+    { 18842, 9437 }, { 19054, 9485 }, { 18843, 9456 }, { 19076, 9479 },
+    { 19077, 9501 }, { 19078, 9489 }, { 19079, 9495 }, { 19080, 9505 },
+    { 19081, 9447 }, { 18852, 9483 }, { 19084, 9493 }, { 19085, 9504 },
+    { 19086, 9508 }, { 19087, 9445 }, { 19088, 9449 }, { 19089, 9450 },
+    { 19090, 9451 }, { 19091, 9455 }, { 18861, 9457 }, { 19093, 9470 },
+    { 19094, 9512 }, { 19095, 9476 }, { 19096, 9480 }, { 18868, 9494 },
+    { 19098, 9496 }, { 19100, 9497 }, { 19101, 9516 }, { 19102, 9525 },
+    { 19103, 9514 }, { 19104, 9517 }, { 18875, 9520 }, { 19106, 9546 },
+    { 19107, 9562 }, { 19108, 9573 }, { 19109, 9507 }, { 19110, 9513 },
+    { 19111, 9519 }, { 19112, 9529 }, { 19113, 9506 }, { 18881, 9509 },
+    { 19115, 9549 }, { 18886, 9498 }, { 19117, 9502 }, { 19118, 9521 },
+    { 19119, 9523 }, { 18888, 9565 }, { 18891, 9515 }, { 19123, 9542 },
+    { 19124, 9518 }, { 18895, 9522 }, { 19126, 9554 }, { 19127, 9524 },
+    { 18894, 9526 }, { 19129, 9527 }, { 18900, 9528 }, { 19131, 9530 },
+    { 18899, 9531 }, { 19133, 9532 }, { 19134, 9536 }, { 19135, 9537 },
+    { 18905, 9543 }, { 19137, 9547 }, { 19138, 9577 }, { 19139, 9581 },
+    { 19140, 9539 }, { 19141, 9578 }, { 19142, 9579 }, { 19143, 9582 },
+    { 19144, 9583 }, { 19145, 9585 }, { 19146, 9587 }, { 19099, 9496 },
+    { 19147, 9591 }, { 18915, 9534 }, { 19149, 9548 }, { 19150, 9571 },
+    { 19151, 9572 }, { 19152, 9538 }, { 19153, 9551 }, { 19154, 9563 },
+    { 19155, 9545 }, { 19156, 9559 }, { 18924, 9566 }, { 19158, 9533 },
+    { 19159, 9535 }, { 19160, 9540 }, { 19161, 9552 }, { 19162, 9574 },
+    { 19163, 9541 }, { 19164, 9544 }, { 19165, 9550 }, { 19166, 9553 },
+    { 19167, 9555 }, { 19168, 9556 }, { 19169, 9557 }, { 19170, 9558 },
+    { 18938, 9560 }, { 19172, 9561 }, { 19173, 9564 }, { 19174, 9567 },
+    { 19175, 9568 }, { 19176, 9569 }, { 19177, 9601 }, { 19178, 9570 },
+    { 19179, 9617 }, { 19180, 9620 }, { 19181, 9575 }, { 19182, 9584 },
+    { 19183, 9586 }, { 19184, 9590 }, { 19185, 9598 }, { 19186, 9605 },
+    { 19188, 9606 }, { 18956, 9576 }, { 19191, 9580 }, { 19192, 9588 },
+    { 19193, 9589 }, { 19194, 9592 }, { 18963, 9593 }, { 19196, 9594 },
+    { 19198, 9640 }, { 19199, 9595 }, { 19200, 9596 }, { 19187, 9605 },
+    { 18970, 9597 }, { 19202, 9599 }, { 19203, 9600 }, { 18971, 9602 },
+    { 19205, 9603 }, { 19206, 9604 }, { 19207, 9607 }, { 18978, 9608 },
+    { 19209, 9615 }, { 19210, 9609 }, { 18982, 9610 }, { 18979, 9611 },
+    { 18981, 9612 }, { 19215, 9621 }, { 19216, 9623 }, { 19217, 9626 },
+    { 19218, 9635 }, { 19219, 9666 }, { 18990, 9668 }, { 19221, 9613 },
+    { 19222, 9614 }, { 19223, 9644 }, { 19224, 9647 }, { 19225, 9616 },
+    { 19226, 9631 }, { 18993, 9660 }, { 19228, 9661 }, { 19229, 9665 },
+    { 19230, 9618 }, { 19231, 9629 }, { 19232, 9663 }, { 19233, 9671 },
+    { 19234, 9677 }, { 19004, 9627 }, { 19236, 9628 }, { 19237, 9634 },
+    { 19238, 9637 }, { 19006, 9651 }, { 19240, 9658 }, { 19241, 9662 },
+    { 19242, 9619 }, { 19014, 9622 }, { 19244, 9624 }, { 19245, 9625 },
+    { 19246, 9633 }, { 19018, 9638 }, { 19248, 9630 }, { 19249, 9632 },
+    { 19251, 9636 }, { 19021, 9639 }, { 19253, 9641 }, { 19254, 9642 },
+    { 19255, 9643 }, { 19256, 9645 }, { 19257, 9646 }, { 19024, 9678 },
+    { 19259, 9648 }, { 19260, 9649 }, { 19261, 9650 }, { 19262, 9652 },
+    { 19263, 9653 }, { 19034, 9654 }, { 19035, 9655 }, { 19036, 9656 },
+    { 19267, 9664 }, { 19038, 9714 }, { 19272, 9657 }, { 19039, 9659 },
+    { 19274, 9679 }, { 19275, 9667 }, { 19276, 9669 }, { 19277, 9670 },
+    { 19046, 9672 }, { 19279, 9688 }, { 19280, 9673 }, { 19281, 9674 },
+    { 19282, 9675 }, { 19283, 9676 }, { 19284, 9680 }, { 19285, 9681 },
+    { 19286, 9682 }, { 19287, 9683 }, { 19288, 9684 }, { 19059, 9685 },
+    { 19060, 9686 }, { 19271, 9714 }, { 19061, 9687 }, { 19293, 9689 },
+    { 19062, 9690 }, { 19063, 9691 }, { 19296, 9692 }, { 19297, 9742 },
+    { 19065, 9693 }, { 19299, 9694 }, { 19300, 9695 }, { 19301, 9696 },
+    { 19302, 9697 }, { 19303, 9698 }, { 19073, 9699 }, { 19305, 9700 },
+    { 19306, 9701 }, { 19307, 9702 }, { 19308, 9703 }, { 19309, 9704 },
+    { 19310, 9705 }, { 19311, 9706 }, { 19080, 9707 }, { 19083, 9708 },
+    { 19315, 9710 }, { 19316, 9712 }, { 19083, 9715 }, { 19318, 9716 },
+    { 19089, 9717 }, { 19090, 9718 }, { 19082, 9708 }, { 19326, 9723 },
+    { 19327, 9725 }, { 19331, 9726 }, { 19333, 9727 }, { 19334, 9745 },
+    { 19336, 9746 }, { 19337, 9749 }, { 19332, 9726 }, { 19098, 9725 },
+    { 19104, 9755 }, { 19339, 9756 }, { 19109, 9757 }, { 19107, 9767 },
+    { 19342, 9770 }, { 19343, 9721 }, { 19322, 9718 }, { 19344, 9728 },
+    { 19345, 9729 }, { 19346, 9731 }, { 19347, 9732 }, { 19348, 9735 },
+    { 19329, 9725 }, { 19319, 9716 }, { 19349, 9744 }, { 19350, 9747 },
+    { 19118, 9752 }, { 19353, 9753 }, { 19355, 9743 }, { 19356, 9750 },
+    { 19357, 9751 }, { 19358, 9762 }, { 19359, 9781 }, { 19360, 9722 },
+    { 19324, 9718 }, { 19361, 9759 }, { 19362, 9760 }, { 19354, 9753 },
+    { 19367, 9766 }, { 19330, 9725 }, { 19134, 9775 }, { 19369, 9776 },
+    { 19363, 9760 }, { 19370, 9730 }, { 19371, 9748 }, { 19364, 9760 },
+    { 19372, 9754 }, { 19325, 9718 }, { 19146, 9709 }, { 19373, 9761 },
+    { 19335, 9745 }, { 19374, 9761 }, { 19377, 9711 }, { 19365, 9760 },
+    { 19144, 9733 }, { 19145, 9736 }, { 19380, 9769 }, { 19381, 9713 },
+    { 19153, 9765 }, { 19384, 9719 }, { 19385, 9720 }, { 19386, 9724 },
+    { 19387, 9764 }, { 19388, 9771 }, { 19389, 9773 }, { 19157, 9734 },
+    { 19391, 9737 }, { 19392, 9738 }, { 19163, 9739 }, { 19394, 9740 },
+    { 19395, 9777 }, { 19396, 9778 }, { 19397, 9780 }, { 19165, 9793 },
+    { 19400, 9820 }, { 19170, 9782 }, { 19172, 9783 }, { 19173, 9797 },
+    { 19404, 9800 }, { 19171, 9801 }, { 19176, 9768 }, { 19177, 9772 },
+    { 19174, 9789 }, { 19409, 9774 }, { 19180, 9779 }, { 19177, 9786 },
+    { 19412, 9799 }, { 19413, 9785 }, { 19414, 9787 }, { 19185, 9794 },
+    { 19416, 9803 }, { 19417, 9805 }, { 19189, 9817 }, { 19187, 9846 },
+    { 19366, 9760 }, { 19190, 9741 }, { 19421, 9758 }, { 19192, 9784 },
+    { 19423, 9792 }, { 19425, 9763 }, { 19426, 9788 }, { 19197, 9828 },
+    { 19428, 9790 }, { 19429, 9796 }, { 19430, 9798 }, { 19431, 9791 },
+    { 19167, 9780 }, { 19201, 9822 }, { 19434, 9825 }, { 19435, 9832 },
+    { 19436, 9795 }, { 19438, 9806 }, { 19439, 9807 }, { 19440, 9802 },
+    { 19441, 9845 }, { 19442, 9851 }, { 19443, 9804 }, { 19444, 9808 },
+    { 19445, 9809 }, { 19446, 9810 }, { 19447, 9811 }, { 19448, 9812 },
+    { 19449, 9813 }, { 19450, 9814 }, { 19451, 9816 }, { 19452, 9815 },
+    { 19453, 9819 }, { 19454, 9821 }, { 19455, 9829 }, { 19456, 9818 },
+    { 19457, 9844 }, { 19458, 9864 }, { 19459, 9870 }, { 19460, 9824 },
+    { 19461, 9871 }, { 19462, 9823 }, { 19233, 9826 }, { 19203, 9822 },
+    { 19464, 9827 }, { 19465, 9833 }, { 19466, 9843 }, { 19238, 9862 },
+    { 19468, 9873 }, { 19469, 9830 }, { 19470, 9831 }, { 19241, 9834 },
+    { 19243, 9835 }, { 19473, 9836 }, { 19474, 9837 }, { 19475, 9838 },
+    { 19476, 9839 }, { 19246, 9847 }, { 19245, 9849 }, { 19479, 9853 },
+    { 19480, 9858 }, { 19481, 9872 }, { 19482, 9874 }, { 19484, 9840 },
+    { 19485, 9882 }, { 19253, 9842 }, { 19487, 9854 }, { 19488, 9861 },
+    { 19489, 9841 }, { 19490, 9863 }, { 19491, 9848 }, { 19492, 9850 },
+    { 19493, 9852 }, { 19494, 9855 }, { 19261, 9885 }, { 19496, 9856 },
+    { 19497, 9857 }, { 19498, 9859 }, { 19270, 9865 }, { 19500, 9866 },
+    { 19501, 9860 }, { 19269, 9867 }, { 19503, 9868 }, { 19504, 9869 },
+    { 19275, 9875 }, { 19272, 9876 }, { 19274, 9877 }, { 19275, 9878 },
+    { 19275, 9879 }, { 19510, 9880 }, { 19282, 9894 }, { 19512, 9924 },
+    { 19513, 9883 }, { 19514, 9884 }, { 19516, 9881 }, { 19517, 9886 },
+    { 19518, 9930 }, { 19483, 9874 }, { 19289, 9887 }, { 19520, 9888 },
+    { 19521, 9889 }, { 19522, 9890 }, { 19523, 9891 }, { 19524, 9892 },
+    { 19525, 9893 }, { 19526, 9896 }, { 19527, 9897 }, { 19528, 9900 },
+    { 19529, 9895 }, { 19530, 9948 }, { 19531, 9898 }, { 19532, 9899 },
+    { 19533, 9901 }, { 19303, 9902 }, { 19535, 9903 }, { 19536, 9904 },
+    { 19537, 9905 }, { 19538, 9906 }, { 19539, 9907 }, { 19540, 9908 },
+    { 19307, 9909 }, { 19542, 9910 }, { 19543, 9911 }, { 19544, 9912 },
+    { 19545, 9913 }, { 19316, 9914 }, { 19547, 9915 }, { 19548, 9916 },
+    { 19549, 9917 }, { 19550, 9918 }, { 19551, 9919 }, { 19552, 9920 },
+    { 19553, 9921 }, { 19320, 9922 }, { 19555, 9923 }, { 19556, 9925 },
+    { 19557, 9926 }, { 19558, 9927 }, { 19330, 9928 }, { 19561, 9929 },
+    { 19562, 9937 }, { 19329, 9952 }, { 19330, 9931 }, { 19565, 9932 },
+    { 19566, 9933 }, { 19337, 9934 }, { 19338, 9935 }, { 19569, 9936 },
+    { 19570, 9938 }, { 19339, 9939 }, { 19572, 9940 }, { 19344, 9981 },
+    { 19345, 9992 }, { 19575, 9941 }, { 19576, 9942 }, { 19345, 9965 },
+    { 19346, 9966 }, { 19579, 9943 }, { 19580, 9984 }, { 19349, 9944 },
+    { 19582, 9955 }, { 19583, 9946 }, { 19585, 9951 }, { 19353, 9956 },
+    { 19587, 9989 }, { 19588, 10004 }, { 19589, 9949 }, { 19590, 9950 },
+    { 19591, 9945 }, { 19592, 9947 }, { 19363, 9954 }, { 19594, 9953 },
+    { 19365, 9957 }, { 19362, 9958 }, { 19597, 9959 }, { 19598, 9960 },
+    { 19599, 9961 }, { 19370, 9962 }, { 19601, 9963 }, { 19602, 9964 },
+    { 19603, 9967 }, { 19370, 9969 }, { 19605, 9975 }, { 19606, 9970 },
+    { 19607, 9971 }, { 19374, 9988 }, { 19559, 9927 }, { 19376, 9968 },
+    { 19610, 9972 }, { 19611, 9973 }, { 19381, 9973 }, { 19384, 9974 },
+    { 19614, 9976 }, { 19615, 9977 }, { 19616, 9978 }, { 19617, 9979 },
+    { 19618, 9980 }, { 19619, 9982 }, { 19620, 9983 }, { 19621, 9985 },
+    { 19622, 9986 }, { 19623, 9987 }, { 19624, 9990 }, { 19395, 9991 },
+    { 19626, 9993 }, { 19627, 10036 }, { 19628, 9994 }, { 19353, 9946 },
+    { 19399, 9995 }, { 19630, 9996 }, { 19631, 9997 }, { 19632, 9998 },
+    { 19633, 9999 }, { 19634, 10000 }, { 19635, 10001 }, { 19636, 10002 },
+    { 19407, 10028 }, { 19638, 10003 }, { 19411, 10005 }, { 19643, 10006 },
+    { 19644, 10017 }, { 19415, 10007 }, { 19417, 10008 }, { 19647, 10055 },
+    { 19648, 10009 }, { 19649, 10010 }, { 19650, 10011 }, { 19421, 10011 },
+    { 19656, 10012 }, { 19423, 10011 }, { 19436, 10014 }, { 19658, 10013 },
+    { 19666, 10018 }, { 19669, 10021 }, { 19667, 10020 }, { 19671, 10022 },
+    { 19659, 10013 }, { 19443, 10023 }, { 19676, 10027 }, { 19674, 10024 },
+    { 19657, 10012 }, { 19668, 10020 }, { 19670, 10021 }, { 19677, 10029 },
+    { 19447, 10030 }, { 19653, 10011 }, { 19660, 10013 }, { 19684, 10032 },
+    { 19682, 10031 }, { 19680, 10030 }, { 19678, 10029 }, { 19683, 10031 },
+    { 19661, 10013 }, { 19687, 10033 }, { 19690, 10034 }, { 19691, 10035 },
+    { 19693, 10038 }, { 19681, 10030 }, { 19655, 10011 }, { 19675, 10024 },
+    { 19694, 10040 }, { 19466, 10041 }, { 19465, 10042 }, { 19701, 10050 },
+    { 19662, 10013 }, { 19702, 10051 }, { 19472, 10051 }, { 19469, 10043 },
+    { 19704, 10052 }, { 19688, 10033 }, { 19708, 10054 }, { 19706, 10053 },
+    { 19709, 10059 }, { 19711, 10060 }, { 19713, 10062 }, { 19663, 10013 },
+    { 19484, 10063 }, { 19689, 10033 }, { 19692, 10035 }, { 19716, 10069 },
+    { 19717, 10071 }, { 19440, 10022 }, { 19699, 10043 }, { 19664, 10013 },
+    { 19718, 10074 }, { 19720, 10075 }, { 19685, 10032 }, { 19721, 10076 },
+    { 19700, 10043 }, { 19707, 10053 }, { 19722, 10068 }, { 19710, 10059 },
+    { 19723, 10068 }, { 19724, 10077 }, { 19726, 10078 }, { 19727, 10082 },
+    { 19686, 10032 }, { 19499, 10086 }, { 19731, 10087 }, { 19491, 10077 },
+    { 19719, 10074 }, { 19502, 10088 }, { 19501, 10086 }, { 19734, 10090 },
+    { 19697, 10042 }, { 19735, 10091 }, { 19736, 10094 }, { 19737, 10097 },
+    { 19507, 10097 }, { 19740, 10098 }, { 19742, 10099 }, { 19743, 10100 },
+    { 19744, 10102 }, { 19745, 10113 }, { 19746, 10117 }, { 19712, 10060 },
+    { 19747, 10118 }, { 19705, 10052 }, { 19748, 10118 }, { 19749, 10120 },
+    { 19728, 10082 }, { 19751, 10121 }, { 19753, 10122 }, { 19755, 10124 },
+    { 19714, 10062 }, { 19757, 10125 }, { 19758, 10128 }, { 19527, 10127 },
+    { 19741, 10098 }, { 19760, 10129 }, { 19761, 10132 }, { 19763, 10133 },
+    { 19768, 10135 }, { 19538, 10142 }, { 19752, 10121 }, { 19762, 10132 },
+    { 19774, 10147 }, { 19754, 10122 }, { 19739, 10097 }, { 19535, 10134 },
+    { 19541, 10146 }, { 19765, 10134 }, { 19766, 10134 }, { 19756, 10124 },
+    { 19775, 10148 }, { 19541, 10146 }, { 19767, 10134 }, { 19776, 10150 },
+    { 19779, 10151 }, { 19783, 10152 }, { 19784, 10154 }, { 19777, 10150 },
+    { 19785, 10155 }, { 19554, 10156 }, { 19787, 10162 }, { 19750, 10120 },
+    { 19788, 10166 }, { 19789, 10170 }, { 19790, 10171 }, { 19559, 10173 },
+    { 19792, 10176 }, { 19794, 10177 }, { 19772, 10146 }, { 19563, 10178 },
+    { 19797, 10184 }, { 19799, 10185 }, { 19803, 10186 }, { 19773, 10146 },
+    { 19567, 10185 }, { 19574, 10188 }, { 19805, 10179 }, { 19778, 10150 },
+    { 19574, 10181 }, { 19809, 10183 }, { 19552, 10151 }, { 19810, 10189 },
+    { 19811, 10190 }, { 19798, 10184 }, { 19579, 10191 }, { 19814, 10192 },
+    { 19815, 10194 }, { 19801, 10185 }, { 19584, 10195 }, { 19818, 10201 },
+    { 19819, 10204 }, { 19820, 10206 }, { 19590, 10212 }, { 19823, 10214 },
+    { 19824, 10224 }, { 19825, 10231 }, { 19596, 10232 }, { 19828, 10234 },
+    { 19579, 10191 }, { 19829, 10237 }, { 19601, 10242 }, { 19831, 10220 },
+    { 19807, 10181 }, { 19793, 10176 }, { 19832, 10221 }, { 19826, 10231 },
+    { 19808, 10181 }, { 19834, 10223 }, { 19837, 10226 }, { 19835, 10225 },
+    { 19610, 10244 }, { 19838, 10227 }, { 19817, 10195 }, { 19839, 10227 },
+    { 19841, 10246 }, { 19842, 10247 }, { 19614, 10248 }, { 19844, 10249 },
+    { 19846, 10254 }, { 19795, 10177 }, { 19605, 10225 }, { 19847, 10257 },
+    { 19848, 10258 }, { 19802, 10185 }, { 19615, 10249 }, { 19850, 10269 },
+    { 19851, 10270 }, { 19822, 10212 }, { 19852, 10015 }, { 19623, 10016 },
+    { 19620, 10019 }, { 19849, 10258 }, { 19855, 10025 }, { 19856, 10026 },
+    { 19857, 10037 }, { 19629, 10044 }, { 19860, 10046 }, { 19861, 10200 },
+    { 19863, 10203 }, { 19864, 10205 }, { 19636, 10210 }, { 19871, 10211 },
+    { 19642, 10240 }, { 19875, 10250 }, { 19876, 10256 }, { 19877, 10067 },
+    { 19872, 10211 }, { 19645, 10079 }, { 19649, 10083 }, { 19880, 10089 },
+    { 19881, 10109 }, { 19882, 10047 }, { 19883, 10085 }, { 19884, 10104 },
+    { 19886, 10107 }, { 19865, 10210 }, { 19657, 10045 }, { 19888, 10095 },
+    { 19889, 10106 }, { 19890, 10039 }, { 19862, 10200 }, { 19891, 10056 },
+    { 19892, 10101 }, { 19873, 10211 }, { 19893, 10141 }, { 19894, 10153 },
+    { 19662, 10048 }, { 19896, 10049 }, { 19897, 10057 }, { 19898, 10058 },
+    { 19899, 10061 }, { 19902, 10222 }, { 19903, 10233 }, { 19906, 10243 },
+    { 19673, 10251 }, { 19908, 10261 }, { 19909, 10262 }, { 19911, 10080 },
+    { 19913, 10093 }, { 19914, 10064 }, { 19915, 10084 }, { 19683, 10066 },
+    { 19917, 10105 }, { 19918, 10096 }, { 19919, 10096 }, { 19912, 10080 },
+    { 19920, 10114 }, { 19921, 10131 }, { 19904, 10233 }, { 19922, 10070 },
+    { 19923, 10072 }, { 19694, 10073 }, { 19925, 10130 }, { 19630, 10044 },
+    { 19926, 10065 }, { 19927, 10081 }, { 19910, 10262 }, { 19900, 10061 },
+    { 19928, 10092 }, { 19929, 10103 }, { 19930, 10108 }, { 19931, 10110 },
+    { 19932, 10111 }, { 19933, 10112 }, { 19934, 10115 }, { 19935, 10123 },
+    { 19936, 10126 }, { 19937, 10169 }, { 19938, 10116 }, { 19939, 10165 },
+    { 19940, 10119 }, { 19941, 10136 }, { 19942, 10137 }, { 19943, 10138 },
+    { 19944, 10139 }, { 19945, 10140 }, { 19716, 10143 }, { 19948, 10144 },
+    { 19949, 10145 }, { 19901, 10061 }, { 19721, 10157 }, { 19722, 10158 },
+    { 19952, 10149 }, { 19719, 10161 }, { 19955, 10172 }, { 19956, 10159 },
+    { 19728, 10160 }, { 19728, 10163 }, { 19729, 10164 }, { 19960, 10167 },
+    { 19961, 10174 }, { 19962, 10198 }, { 19963, 10218 }, { 19964, 10168 },
+    { 19965, 10175 }, { 19966, 10182 }, { 19967, 10196 }, { 19968, 10236 },
+    { 19969, 10180 }, { 19970, 10187 }, { 19971, 10193 }, { 19742, 10197 },
+    { 19741, 10245 }, { 19974, 10199 }, { 19975, 10207 }, { 19976, 10230 },
+    { 19746, 10228 }, { 19978, 10235 }, { 19979, 10277 }, { 19980, 10278 },
+    { 19981, 10213 }, { 19982, 10238 }, { 19752, 10202 }, { 19984, 10208 },
+    { 19755, 10209 }, { 19986, 10215 }, { 19755, 10216 }, { 19988, 10217 },
+    { 19989, 10259 }, { 19990, 10260 }, { 19991, 10264 }, { 19992, 10268 },
+    { 19993, 10273 }, { 19995, 10276 }, { 19996, 10279 }, { 19997, 10281 },
+    { 19998, 10283 }, { 19768, 10284 }, { 20004, 10286 }, { 20002, 10284 },
+    { 20005, 10296 }, { 20006, 10303 }, { 19999, 10283 }, { 20007, 10309 },
+    { 20008, 10314 }, { 20009, 10326 }, { 20010, 10328 }, { 20011, 10330 },
+    { 20012, 10271 }, { 20014, 10280 }, { 20015, 10282 }, { 20017, 10291 },
+    { 20018, 10292 }, { 20019, 10293 }, { 20020, 10320 }, { 20021, 10255 },
+    { 20022, 10265 }, { 20023, 10285 }, { 20025, 10290 }, { 20026, 10304 },
+    { 20027, 10287 }, { 20028, 10332 }, { 20029, 10333 }, { 20030, 10334 },
+    { 20031, 10335 }, { 20032, 10338 }, { 20033, 10347 }, { 20034, 10348 },
+    { 20035, 10349 }, { 20000, 10283 }, { 20036, 10275 }, { 20003, 10284 },
+    { 20038, 10302 }, { 19809, 10310 }, { 20040, 10317 }, { 20041, 10219 },
+    { 20042, 10239 }, { 20037, 10275 }, { 20043, 10289 }, { 19994, 10273 },
+    { 19814, 10229 }, { 20045, 10241 }, { 19814, 10252 }, { 19817, 10253 },
+    { 20048, 10263 }, { 20049, 10266 }, { 20051, 10267 }, { 20052, 10272 },
+    { 20053, 10274 }, { 20054, 10288 }, { 19826, 10294 }, { 20061, 10295 },
+    { 20063, 10297 }, { 19834, 10311 }, { 20065, 10298 }, { 20066, 10301 },
+    { 20050, 10266 }, { 20067, 10337 }, { 20068, 10339 }, { 20069, 10299 },
+    { 20070, 10300 }, { 20071, 10305 }, { 20072, 10306 }, { 19843, 10307 },
+    { 20074, 10308 }, { 20062, 10295 }, { 20024, 10285 }, { 20075, 10359 },
+    { 20076, 10312 }, { 20077, 10313 }, { 20078, 10324 }, { 20079, 10315 },
+    { 19850, 10316 }, { 19850, 10318 }, { 19849, 10319 }, { 20083, 10321 },
+    { 20084, 10322 }, { 19854, 10323 }, { 20086, 10325 }, { 20087, 10327 },
+    { 19859, 10329 }, { 20089, 10331 }, { 19861, 10336 }, { 19859, 10340 },
+    { 20092, 10341 }, { 20093, 10342 }, { 20094, 10343 }, { 20095, 10344 },
+    { 20096, 10345 }, { 19868, 10346 }, { 20098, 10350 }, { 20099, 10351 },
+    { 19867, 10352 }, { 20101, 10406 }, { 20103, 10353 }, { 19874, 10354 },
+    { 20105, 10355 }, { 19875, 10356 }, { 20107, 10357 }, { 20108, 10358 },
+    { 20109, 10360 }, { 20110, 10361 }, { 20111, 10362 }, { 20112, 10363 },
+    { 20113, 10364 }, { 20114, 10365 }, { 19885, 10366 }, { 20116, 10367 },
+    { 20117, 10368 }, { 19888, 10369 }, { 20119, 10377 }, { 19890, 10400 },
+    { 20121, 10370 }, { 19889, 10371 }, { 20123, 10372 }, { 19893, 10373 },
+    { 19894, 10374 }, { 20126, 10375 }, { 20127, 10376 }, { 20128, 10378 },
+    { 19899, 10379 }, { 20130, 10380 }, { 20131, 10381 }, { 19902, 10382 },
+    { 19902, 10383 }, { 20134, 10384 }, { 20135, 10394 }, { 20136, 10385 },
+    { 20137, 10386 }, { 19908, 10387 }, { 20139, 10388 }, { 20140, 10389 },
+    { 20141, 10390 }, { 20142, 10391 }, { 20143, 10392 }, { 19911, 10393 },
+    { 19914, 10395 }, { 19915, 10422 }, { 20147, 10396 }, { 20148, 10415 },
+    { 20149, 10397 }, { 20150, 10398 }, { 19921, 10399 }, { 20152, 10402 },
+    { 20153, 10451 }, { 19925, 10456 }, { 20155, 10401 }, { 20156, 10403 },
+    { 20157, 10403 }, { 20158, 10404 }, { 20159, 10414 }, { 20160, 10423 },
+    { 20161, 10424 }, { 19932, 10433 }, { 20163, 10405 }, { 20164, 10429 },
+    { 20165, 10407 }, { 20166, 10409 }, { 20167, 10421 }, { 20168, 10440 },
+    { 20169, 10452 }, { 20170, 10458 }, { 20171, 10408 }, { 19941, 10410 },
+    { 20173, 10411 }, { 20174, 10413 }, { 20175, 10416 }, { 19946, 10419 },
+    { 19943, 10425 }, { 20178, 10428 }, { 20179, 10469 }, { 20181, 10420 },
+    { 20182, 10431 }, { 19949, 10412 }, { 20180, 10469 }, { 20184, 10427 },
+    { 19955, 10434 }, { 20186, 10417 }, { 20187, 10435 }, { 20189, 10436 },
+    { 20193, 10437 }, { 19963, 10430 }, { 20195, 10439 }, { 19963, 10441 },
+    { 20190, 10436 }, { 20197, 10442 }, { 20198, 10443 }, { 20199, 10444 },
+    { 20200, 10462 }, { 20201, 10471 }, { 20202, 10484 }, { 20203, 10432 },
+    { 20204, 10445 }, { 20205, 10446 }, { 20206, 10447 }, { 20207, 10470 },
+    { 20208, 10450 }, { 20209, 10457 }, { 20210, 10468 }, { 20211, 10472 },
+    { 20214, 10418 }, { 20212, 10473 }, { 19984, 10426 }, { 20216, 10438 },
+    { 20217, 10448 }, { 20218, 10449 }, { 19989, 10453 }, { 20220, 10454 },
+    { 20221, 10459 }, { 20191, 10436 }, { 20213, 10473 }, { 20222, 10488 },
+    { 20223, 10455 }, { 20224, 10460 }, { 20225, 10461 }, { 20226, 10463 },
+    { 20227, 10464 }, { 20228, 10465 }, { 20229, 10466 }, { 19997, 10467 },
+    { 20231, 10474 }, { 20232, 10476 }, { 20233, 10485 }, { 20234, 10486 },
+    { 20235, 10507 }, { 20236, 10515 }, { 20237, 10518 }, { 20238, 10475 },
+    { 20239, 10500 }, { 20240, 10502 }, { 20241, 10477 }, { 20192, 10436 },
+    { 20242, 10501 }, { 20243, 10512 }, { 20244, 10478 }, { 20245, 10479 },
+    { 20246, 10480 }, { 20247, 10482 }, { 20017, 10503 }, { 20015, 10481 },
+    { 20019, 10483 }, { 20251, 10487 }, { 20252, 10489 }, { 20021, 10490 },
+    { 20254, 10491 }, { 20255, 10492 }, { 20025, 10493 }, { 20023, 10494 },
+    { 20024, 10495 }, { 20259, 10496 }, { 20028, 10497 }, { 20261, 10498 },
+    { 20262, 10499 }, { 20032, 10504 }, { 20264, 10505 }, { 20265, 10506 },
+    { 20266, 10508 }, { 20267, 10509 }, { 20268, 10510 }, { 20269, 10511 },
+    { 20270, 10513 }, { 20271, 10514 }, { 20272, 10516 }, { 20273, 10517 },
+    { 20274, 10519 }, { 20275, 10520 }, { 20276, 10521 }, { 20277, 10522 },
+    { 20278, 10523 }, { 20279, 10527 }, { 20280, 10524 }, { 20281, 10547 },
+    { 20052, 10525 }, { 20283, 10564 }, { 20054, 10526 }, { 20285, 10534 },
+    { 20286, 10528 }, { 20054, 10529 }, { 20289, 10530 }, { 20061, 10531 },
+    { 20291, 10532 }, { 20292, 10533 }, { 20293, 10545 }, { 20294, 10574 },
+    { 20296, 10579 }, { 20298, 10581 }, { 20299, 10535 }, { 20301, 10537 },
+    { 20303, 10548 }, { 20304, 10536 }, { 20074, 10538 }, { 20306, 10539 },
+    { 20307, 10540 }, { 20308, 10541 }, { 20309, 10542 }, { 20310, 10560 },
+    { 20312, 10543 }, { 20302, 10537 }, { 20314, 10583 }, { 20318, 10544 },
+    { 20316, 10589 }, { 20319, 10546 }, { 20295, 10574 }, { 20320, 10568 },
+    { 20321, 10549 }, { 20093, 10550 }, { 20323, 10551 }, { 20324, 10552 },
+    { 20325, 10553 }, { 20315, 10583 }, { 20317, 10589 }, { 20327, 10554 },
+    { 20328, 10555 }, { 20099, 10556 }, { 20330, 10557 }, { 20098, 10558 },
+    { 20332, 10559 }, { 20333, 10561 }, { 20334, 10562 }, { 20101, 10563 },
+    { 20336, 10565 }, { 20104, 10566 }, { 20108, 10567 }, { 20313, 10543 },
+    { 20339, 10573 }, { 20110, 10569 }, { 20111, 10587 }, { 20342, 10570 },
+    { 20343, 10571 }, { 20344, 10572 }, { 20345, 10575 }, { 20346, 10601 },
+    { 20347, 10576 }, { 20326, 10553 }, { 20348, 10577 }, { 20349, 10578 },
+    { 20119, 10580 }, { 20351, 10582 }, { 20352, 10584 }, { 20119, 10585 },
+    { 20354, 10586 }, { 20355, 10588 }, { 20356, 10590 }, { 20124, 10591 },
+    { 20358, 10592 }, { 20126, 10593 }, { 20360, 10594 }, { 20361, 10595 },
+    { 20362, 10596 }, { 20363, 10597 }, { 20364, 10598 }, { 20135, 10599 },
+    { 20366, 10600 }, { 20137, 10606 }, { 20368, 10602 }, { 20369, 10603 },
+    { 20371, 10604 }, { 20138, 10605 }, { 20373, 10607 }, { 20374, 10608 },
+    { 20375, 10609 }, { 20376, 10610 }, { 20377, 10611 }, { 20378, 10612 },
+    { 20379, 10613 }, { 20381, 10614 }, { 20382, 10615 }, { 20383, 10616 },
+    { 20153, 10621 }, { 20151, 10617 }, { 20157, 10618 }, { 20388, 10619 },
+    { 20155, 10620 }, { 20390, 10622 }, { 20391, 10623 }, { 20386, 10617 },
+    { 20392, 10624 }, { 20393, 10625 }, { 20394, 10626 }, { 20395, 10627 },
+    { 20163, 10628 }, { 20163, 10629 }, { 20168, 10630 }, { 20399, 10631 },
+    { 20400, 10632 }, { 20169, 10633 }, { 20404, 10676 }, { 20405, 10634 },
+    { 20175, 10635 }, { 20176, 10636 }, { 20408, 10637 }, { 20412, 10639 },
+    { 20414, 10638 }, { 20177, 10637 }, { 20413, 10639 }, { 20185, 10646 },
+    { 20417, 10648 }, { 20422, 10654 }, { 20419, 10653 }, { 20423, 10657 },
+    { 20424, 10662 }, { 20420, 10653 }, { 20196, 10666 }, { 20426, 10673 },
+    { 20427, 10674 }, { 20428, 10685 }, { 20429, 10693 }, { 20200, 10695 },
+    { 20431, 10698 }, { 20433, 10699 }, { 20402, 10633 }, { 20202, 10701 },
+    { 20436, 10669 }, { 20437, 10670 }, { 20439, 10671 }, { 20442, 10686 },
+    { 20443, 10687 }, { 20440, 10683 }, { 20213, 10690 }, { 20418, 10648 },
+    { 20191, 10653 }, { 20445, 10706 }, { 20446, 10707 }, { 20447, 10709 },
+    { 20448, 10712 }, { 20432, 10698 }, { 20222, 10660 }, { 20449, 10659 },
+    { 20454, 10661 }, { 20222, 10675 }, { 20456, 10678 }, { 20435, 10701 },
+    { 20185, 10646 }, { 20441, 10683 }, { 20457, 10679 }, { 20227, 10689 },
+    { 20225, 10710 }, { 20460, 10713 }, { 20461, 10714 }, { 20462, 10718 },
+    { 20219, 10659 }, { 20411, 10637 }, { 20451, 10659 }, { 20463, 10719 },
+    { 20464, 10722 }, { 20465, 10723 }, { 20233, 10741 }, { 20467, 10757 },
+    { 20468, 10763 }, { 20469, 10764 }, { 20239, 10704 }, { 20207, 10670 },
+    { 20240, 10708 }, { 20473, 10716 }, { 20474, 10730 }, { 20471, 10704 },
+    { 20475, 10737 }, { 20243, 10738 }, { 20249, 10640 }, { 20479, 10641 },
+    { 20480, 10644 }, { 20481, 10688 }, { 20482, 10642 }, { 20254, 10643 },
+    { 20250, 10645 }, { 20485, 10647 }, { 20486, 10703 }, { 20487, 10650 },
+    { 20476, 10737 }, { 20488, 10655 }, { 20453, 10660 }, { 20259, 10649 },
+    { 20490, 10651 }, { 20491, 10652 }, { 20492, 10664 }, { 20260, 10694 },
+    { 20262, 10656 }, { 20495, 10658 }, { 20496, 10663 }, { 20497, 10665 },
+    { 20269, 10667 }, { 20268, 10680 }, { 20270, 10697 }, { 20271, 10668 },
+    { 20502, 10720 }, { 20503, 10721 }, { 20270, 10752 }, { 20275, 10770 },
+    { 20507, 10672 }, { 20508, 10677 }, { 20509, 10681 }, { 20510, 10682 },
+    { 20511, 10702 }, { 20512, 10684 }, { 20513, 10691 }, { 20514, 10700 },
+    { 20281, 10705 }, { 20516, 10692 }, { 20517, 10696 }, { 20518, 10736 },
+    { 20519, 10711 }, { 20520, 10725 }, { 20521, 10731 }, { 20522, 10768 },
+    { 20523, 10715 }, { 20294, 10717 }, { 20295, 10732 }, { 20506, 10770 },
+    { 20526, 10724 }, { 20527, 10726 }, { 20298, 10727 }, { 20529, 10728 },
+    { 20297, 10729 }, { 20297, 10734 }, { 20298, 10769 }, { 20299, 10733 },
+    { 20534, 10766 }, { 20535, 10735 }, { 20305, 10739 }, { 20304, 10740 },
+    { 20539, 10742 }, { 20540, 10743 }, { 20541, 10744 }, { 20542, 10745 },
+    { 20543, 10775 }, { 20544, 10748 }, { 20545, 10765 }, { 20546, 10746 },
+    { 20547, 10782 }, { 20548, 10747 }, { 20549, 10762 }, { 20550, 10749 },
+    { 20318, 10750 }, { 20319, 10803 }, { 20553, 10751 }, { 20554, 10753 },
+    { 20555, 10754 }, { 20326, 10755 }, { 20557, 10756 }, { 20558, 10758 },
+    { 20325, 10759 }, { 20326, 10760 }, { 20561, 10761 }, { 20328, 10789 },
+    { 20563, 10767 }, { 20333, 10772 }, { 20565, 10776 }, { 20566, 10771 },
+    { 20567, 10773 }, { 20568, 10774 }, { 20569, 10777 }, { 20339, 10796 },
+    { 20571, 10778 }, { 20572, 10787 }, { 20573, 10824 }, { 20344, 10780 },
+    { 20575, 10797 }, { 20576, 10804 }, { 20577, 10807 }, { 20344, 10779 },
+    { 20579, 10781 }, { 20580, 10783 }, { 20581, 10784 }, { 20582, 10785 },
+    { 20353, 10786 }, { 20355, 10790 }, { 20585, 10791 }, { 20586, 10793 },
+    { 20587, 10792 }, { 20358, 10800 }, { 20357, 10821 }, { 20591, 10847 },
+    { 20359, 10788 }, { 20363, 10819 }, { 20363, 10822 }, { 20595, 10794 },
+    { 20364, 10795 }, { 20364, 10798 }, { 20599, 10799 }, { 20369, 10801 },
+    { 20601, 10808 }, { 20602, 10805 }, { 20605, 10810 }, { 20606, 10802 },
+    { 20607, 10806 }, { 20608, 10809 }, { 20609, 10811 }, { 20610, 10812 },
+    { 20378, 10813 }, { 20380, 10814 }, { 20384, 10852 }, { 20373, 10805 },
+    { 20614, 10815 }, { 20385, 10816 }, { 20589, 10800 }, { 20616, 10832 },
+    { 20617, 10844 }, { 20385, 10858 }, { 20619, 10817 }, { 20620, 10856 },
+    { 20390, 10818 }, { 20622, 10823 }, { 20623, 10854 }, { 20624, 10855 },
+    { 20396, 10872 }, { 20626, 10820 }, { 20627, 10849 }, { 20628, 10826 },
+    { 20629, 10845 }, { 20630, 10870 }, { 20631, 10825 }, { 20632, 10831 },
+    { 20633, 10827 }, { 20634, 10830 }, { 20635, 10830 }, { 20636, 10841 },
+    { 20637, 10848 }, { 20638, 10864 }, { 20639, 10873 }, { 20407, 10828 },
+    { 20642, 10829 }, { 20410, 10833 }, { 20410, 10834 }, { 20645, 10881 },
+    { 20646, 10835 }, { 20647, 10836 }, { 20417, 10837 }, { 20418, 10838 },
+    { 20650, 10839 }, { 20417, 10840 }, { 20652, 10853 }, { 20653, 10842 },
+    { 20424, 10843 }, { 20424, 10846 }, { 20656, 10850 }, { 20657, 10851 },
+    { 20658, 10857 }, { 20659, 10859 }, { 20428, 10860 }, { 20661, 10861 },
+    { 20662, 10862 }, { 20663, 10863 }, { 20434, 10865 }, { 20665, 10866 },
+    { 20437, 10867 }, { 20668, 10869 }, { 20436, 10874 }, { 20671, 10879 },
+    { 20673, 10884 }, { 20674, 10891 }, { 20675, 10897 }, { 20676, 10915 },
+    { 20677, 10929 }, { 20679, 10932 }, { 20680, 10876 }, { 20681, 10878 },
+    { 20682, 10883 }, { 20672, 10879 }, { 20683, 10890 }, { 20684, 10898 },
+    { 20685, 10900 }, { 20686, 10917 }, { 20687, 10922 }, { 20688, 10880 },
+    { 20689, 10887 }, { 20690, 10888 }, { 20669, 10869 }, { 20691, 10871 },
+    { 20693, 10894 }, { 20694, 10920 }, { 20695, 10928 }, { 20696, 10868 },
+    { 20697, 10905 }, { 20465, 10875 }, { 20699, 10877 }, { 20470, 10882 },
+    { 20701, 10885 }, { 20472, 10889 }, { 20703, 10901 }, { 20678, 10929 },
+    { 20474, 10886 }, { 20705, 10892 }, { 20706, 10893 }, { 20707, 10895 },
+    { 20708, 10896 }, { 20709, 10899 }, { 20710, 10902 }, { 20481, 10903 },
+    { 20712, 10904 }, { 20713, 10906 }, { 20714, 10936 }, { 20715, 10907 },
+    { 20716, 10908 }, { 20487, 10909 }, { 20718, 10910 }, { 20719, 10966 },
+    { 20720, 10911 }, { 20721, 10933 }, { 20722, 10912 }, { 20723, 10913 },
+    { 20494, 10914 }, { 20725, 10916 }, { 20726, 10918 }, { 20727, 10919 },
+    { 20728, 10921 }, { 20497, 10923 }, { 20730, 10924 }, { 20731, 10925 },
+    { 20732, 10926 }, { 20733, 10927 }, { 20692, 10871 }, { 20734, 10930 },
+    { 20735, 10931 }, { 20736, 10934 }, { 20507, 10935 }, { 20508, 10937 },
+    { 20739, 10938 }, { 20740, 10939 }, { 20742, 10946 }, { 20743, 10940 },
+    { 20744, 10941 }, { 20747, 10942 }, { 20748, 10943 }, { 20749, 10944 },
+    { 20750, 10945 }, { 20751, 10947 }, { 20752, 10948 }, { 20753, 10949 },
+    { 20754, 10950 }, { 20755, 10951 }, { 20756, 10952 }, { 20523, 10953 },
+    { 20758, 10954 }, { 20525, 10955 }, { 20760, 10956 }, { 20761, 10957 },
+    { 20762, 10987 }, { 20763, 10991 }, { 20764, 10958 }, { 20765, 10962 },
+    { 20766, 10959 }, { 20535, 10979 }, { 20768, 10992 }, { 20769, 10994 },
+    { 20770, 10960 }, { 20771, 10963 }, { 20772, 10964 }, { 20539, 10961 },
+    { 20774, 10965 }, { 20545, 10967 }, { 20544, 10968 }, { 20545, 10969 },
+    { 20778, 10970 }, { 20780, 10971 }, { 20781, 10972 }, { 20782, 10973 },
+    { 20783, 10974 }, { 20553, 11030 }, { 20785, 10975 }, { 20786, 10980 },
+    { 20787, 10976 }, { 20788, 10977 }, { 20558, 10978 }, { 20556, 10981 },
+    { 20791, 11009 }, { 20792, 10982 }, { 20793, 11007 }, { 20794, 10983 },
+    { 20795, 10984 }, { 20796, 10985 }, { 20797, 10986 }, { 20798, 10988 },
+    { 20566, 10989 }, { 20567, 10990 }, { 20568, 10993 }, { 20572, 10995 },
+    { 20803, 10996 }, { 20804, 10997 }, { 20805, 10998 }, { 20575, 10999 },
+    { 20807, 11000 }, { 20808, 11001 }, { 20810, 11002 }, { 20811, 11003 },
+    { 20580, 11004 }, { 20580, 11005 }, { 20585, 11006 }, { 20815, 11008 },
+    { 20816, 11010 }, { 20817, 11011 }, { 20818, 11012 }, { 20819, 11013 },
+    { 20590, 11014 }, { 20821, 11015 }, { 20822, 11029 }, { 20824, 11039 },
+    { 20825, 11016 }, { 20826, 11017 }, { 20827, 11018 }, { 20828, 11019 },
+    { 20829, 11020 }, { 20599, 11021 }, { 20600, 11027 }, { 20832, 11022 },
+    { 20833, 11023 }, { 20605, 11072 }, { 20604, 11024 }, { 20836, 11038 },
+    { 20837, 11025 }, { 20838, 11026 }, { 20839, 11037 }, { 20840, 11028 },
+    { 20841, 11040 }, { 20842, 11042 }, { 20843, 11031 }, { 20844, 11032 },
+    { 20613, 11033 }, { 20846, 11034 }, { 20847, 11035 }, { 20614, 11036 },
+    { 20849, 11041 }, { 20850, 11043 }, { 20851, 11044 }, { 20852, 11045 },
+    { 20621, 11046 }, { 20622, 11079 }, { 20855, 11085 }, { 20856, 11047 },
+    { 20857, 11049 }, { 20858, 11052 }, { 20859, 11054 }, { 20860, 11048 },
+    { 20861, 11050 }, { 20862, 11071 }, { 20863, 11051 }, { 20864, 11053 },
+    { 20634, 11055 }, { 20636, 11056 }, { 20867, 11057 }, { 20868, 11107 },
+    { 20636, 11058 }, { 20640, 11082 }, { 20871, 11059 }, { 20872, 11060 },
+    { 20873, 11061 }, { 20874, 11062 }, { 20875, 11063 }, { 20876, 11064 },
+    { 20877, 11065 }, { 20878, 11066 }, { 20879, 11067 }, { 20880, 11068 },
+    { 20881, 11069 }, { 20882, 11070 }, { 20883, 11073 }, { 20651, 11074 },
+    { 20652, 11075 }, { 20886, 11076 }, { 20887, 11078 }, { 20888, 11080 },
+    { 20889, 11110 }, { 20890, 11120 }, { 20891, 11081 }, { 20892, 11089 },
+    { 20663, 11084 }, { 20894, 11086 }, { 20895, 11083 }, { 20896, 11118 },
+    { 20897, 11125 }, { 20898, 11126 }, { 20899, 11077 }, { 20669, 11087 },
+    { 20901, 11106 }, { 20902, 11088 }, { 20669, 11090 }, { 20904, 11091 },
+    { 20674, 11092 }, { 20906, 11093 }, { 20907, 11094 }, { 20908, 11095 },
+    { 20909, 11134 }, { 20910, 11138 }, { 20911, 11140 }, { 20912, 11141 },
+    { 20913, 11149 }, { 20914, 11096 }, { 20915, 11097 }, { 20916, 11098 },
+    { 20917, 11099 }, { 20918, 11156 }, { 20690, 11100 }, { 20920, 11101 },
+    { 20921, 11103 }, { 20922, 11121 }, { 20923, 11102 }, { 20924, 11104 },
+    { 20925, 11105 }, { 20926, 11108 }, { 20927, 11109 }, { 20928, 11111 },
+    { 20696, 11112 }, { 20930, 11113 }, { 20931, 11114 }, { 20699, 11115 },
+    { 20933, 11116 }, { 20934, 11117 }, { 20935, 11119 }, { 20706, 11122 },
+    { 20937, 11123 }, { 20708, 11124 }, { 20709, 11129 }, { 20940, 11136 },
+    { 20711, 11142 }, { 20712, 11142 }, { 20711, 11143 }, { 20944, 11146 },
+    { 20713, 11165 }, { 20715, 11127 }, { 20716, 11157 }, { 20717, 11168 },
+    { 20949, 11128 }, { 20718, 11158 }, { 20721, 11161 }, { 20952, 11131 },
+    { 20721, 11162 }, { 20722, 11166 }, { 20725, 11133 }, { 20726, 11139 },
+    { 20726, 11154 }, { 20728, 11185 }, { 20726, 11189 }, { 20728, 11130 },
+    { 20729, 11132 }, { 20963, 11135 }, { 20964, 11148 }, { 20965, 11150 },
+    { 20727, 11154 }, { 20966, 11159 }, { 20967, 11145 }, { 20968, 11167 },
+    { 20969, 11137 }, { 20970, 11153 }, { 20971, 11163 }, { 20739, 11144 },
+    { 20973, 11147 }, { 20974, 11151 }, { 20746, 11152 }, { 20744, 11155 },
+    { 20977, 11192 }, { 20978, 11160 }, { 20979, 11164 }, { 20980, 11175 },
+    { 20749, 11169 }, { 20753, 11178 }, { 20753, 11170 }, { 20984, 11171 },
+    { 20985, 11172 }, { 20753, 11173 }, { 20987, 11174 }, { 20988, 11176 },
+    { 20989, 11177 }, { 20761, 11179 }, { 20757, 11180 }, { 20992, 11181 },
+    { 20993, 11182 }, { 20763, 11183 }, { 20765, 11184 }, { 20996, 11186 },
+    { 20997, 11187 }, { 20998, 11193 }, { 20999, 11194 }, { 21000, 11195 },
+    { 21002, 11196 }, { 21003, 11197 }, { 21004, 11199 }, { 21005, 11200 },
+    { 21006, 11201 }, { 20776, 11203 }, { 21008, 11205 }, { 21009, 11209 },
+    { 21010, 11222 }, { 21011, 11240 }, { 21013, 11241 }, { 20783, 11244 },
+    { 20785, 11258 }, { 21017, 11188 }, { 21014, 11241 }, { 21018, 11190 },
+    { 20789, 11191 }, { 21020, 11204 }, { 21021, 11206 }, { 20792, 11214 },
+    { 21023, 11230 }, { 21024, 11232 }, { 21025, 11208 }, { 21026, 11210 },
+    { 20793, 11223 }, { 21028, 11234 }, { 21029, 11236 }, { 21030, 11212 },
+    { 21031, 11213 }, { 21033, 11217 }, { 21034, 11237 }, { 21012, 11240 },
+    { 21036, 11243 }, { 21037, 11250 }, { 21038, 11251 }, { 21041, 11260 },
+    { 21039, 11257 }, { 21042, 11207 }, { 21043, 11227 }, { 20814, 11249 },
+    { 21045, 11252 }, { 21035, 11237 }, { 21046, 11198 }, { 21047, 11211 },
+    { 21048, 11218 }, { 20817, 11202 }, { 21050, 11215 }, { 21051, 11216 },
+    { 21052, 11219 }, { 21053, 11220 }, { 21054, 11221 }, { 21001, 11195 },
+    { 20824, 11224 }, { 20823, 11225 }, { 21057, 11226 }, { 21058, 11228 },
+    { 21059, 11238 }, { 21060, 11239 }, { 21061, 11247 }, { 21062, 11229 },
+    { 21063, 11231 }, { 21064, 11233 }, { 21065, 11235 }, { 20833, 11242 },
+    { 20834, 11286 }, { 21069, 11245 }, { 21070, 11246 }, { 21071, 11248 },
+    { 21072, 11253 }, { 21073, 11254 }, { 21074, 11255 }, { 21075, 11256 },
+    { 21076, 11259 }, { 21077, 11261 }, { 21078, 11262 }, { 20849, 11263 },
+    { 21080, 11264 }, { 21081, 11265 }, { 21082, 11266 }, { 21032, 11213 },
+    { 21040, 11257 }, { 21083, 11267 }, { 21084, 11268 }, { 21085, 11269 },
+    { 21086, 11270 }, { 21087, 11271 }, { 20854, 11272 }, { 20855, 11273 },
+    { 20856, 11296 }, { 21091, 11274 }, { 21092, 11285 }, { 21093, 11275 },
+    { 21094, 11277 }, { 21095, 11284 }, { 21096, 11314 }, { 21097, 11325 },
+    { 21098, 11327 }, { 21100, 11330 }, { 21101, 11278 }, { 21102, 11279 },
+    { 21103, 11276 }, { 21104, 11280 }, { 21105, 11319 }, { 20875, 11281 },
+    { 21107, 11292 }, { 21108, 11282 }, { 21109, 11331 }, { 21110, 11283 },
+    { 21111, 11287 }, { 21112, 11288 }, { 21113, 11289 }, { 20885, 11290 },
+    { 21117, 11291 }, { 20888, 11322 }, { 20889, 11293 }, { 21120, 11294 },
+    { 21121, 11295 }, { 21122, 11297 }, { 20894, 11298 }, { 21124, 11299 },
+    { 21125, 11300 }, { 20894, 11301 }, { 21127, 11303 }, { 21128, 11309 },
+    { 21129, 11302 }, { 21130, 11304 }, { 21131, 11305 }, { 21132, 11306 },
+    { 21133, 11307 }, { 21134, 11308 }, { 21135, 11310 }, { 20904, 11311 },
+    { 21137, 11312 }, { 21138, 11313 }, { 20909, 11315 }, { 21140, 11316 },
+    { 21141, 11317 }, { 20908, 11318 }, { 21143, 11320 }, { 20914, 11321 },
+    { 21145, 11323 }, { 20913, 11324 }, { 21148, 11378 }, { 20916, 11326 },
+    { 20917, 11328 }, { 21152, 11329 }, { 20922, 11373 }, { 20923, 11332 },
+    { 20922, 11333 }, { 21156, 11334 }, { 20924, 11335 }, { 21158, 11336 },
+    { 21147, 11324 }, { 20885, 11290 }, { 21159, 11337 }, { 20930, 11338 },
+    { 21161, 11339 }, { 21162, 11340 }, { 20929, 11341 }, { 20934, 11342 },
+    { 21165, 11343 }, { 21166, 11385 }, { 21167, 11344 }, { 20938, 11345 },
+    { 21169, 11346 }, { 21170, 11347 }, { 20942, 11348 }, { 21174, 11349 },
+    { 20945, 11380 }, { 20946, 11350 }, { 21177, 11351 }, { 21178, 11352 },
+    { 21179, 11353 }, { 21180, 11354 }, { 21181, 11355 }, { 21182, 11356 },
+    { 21183, 11357 }, { 20950, 11358 }, { 20951, 11359 }, { 20952, 11360 },
+    { 21187, 11365 }, { 21188, 11389 }, { 20955, 11361 }, { 21190, 11362 },
+    { 21191, 11363 }, { 21192, 11364 }, { 21193, 11366 }, { 21194, 11367 },
+    { 21195, 11368 }, { 20966, 11369 }, { 20964, 11370 }, { 21198, 11371 },
+    { 20966, 11410 }, { 21201, 11372 }, { 20968, 11394 }, { 20972, 11374 },
+    { 21204, 11375 }, { 21205, 11376 }, { 21206, 11377 }, { 20974, 11379 },
+    { 21208, 11381 }, { 21209, 11382 }, { 21210, 11383 }, { 21211, 11384 },
+    { 21212, 11386 }, { 21213, 11387 }, { 21214, 11388 }, { 21215, 11390 },
+    { 20942, 11348 }, { 21216, 11391 }, { 21217, 11392 }, { 21218, 11393 },
+    { 21219, 11395 }, { 21220, 11444 }, { 21221, 11396 }, { 21222, 11397 },
+    { 21223, 11398 }, { 21224, 11399 }, { 20994, 11401 }, { 20992, 11403 },
+    { 21227, 11411 }, { 21228, 11453 }, { 21229, 11400 }, { 20997, 11402 },
+    { 21232, 11404 }, { 20999, 11405 }, { 21234, 11426 }, { 21230, 11400 },
+    { 21235, 11406 }, { 21236, 11407 }, { 21237, 11412 }, { 21008, 11414 },
+    { 21239, 11408 }, { 21006, 11445 }, { 21011, 11413 }, { 21013, 11416 },
+    { 21243, 11451 }, { 21014, 11409 }, { 21245, 11415 }, { 21016, 11418 },
+    { 21247, 11417 }, { 21019, 11425 }, { 21249, 11419 }, { 21250, 11421 },
+    { 21251, 11463 }, { 21022, 11420 }, { 21253, 11422 }, { 21254, 11423 },
+    { 21255, 11424 }, { 21025, 11427 }, { 21257, 11428 }, { 21258, 11429 },
+    { 21260, 11430 }, { 21261, 11431 }, { 21263, 11432 }, { 21264, 11433 },
+    { 21034, 11434 }, { 21266, 11435 }, { 21267, 11436 }, { 21268, 11437 },
+    { 21269, 11448 }, { 21270, 11438 }, { 21271, 11439 }, { 21272, 11440 },
+    { 21273, 11441 }, { 21274, 11442 }, { 21045, 11443 }, { 21276, 11446 },
+    { 21277, 11447 }, { 21278, 11498 }, { 21279, 11449 }, { 21047, 11450 },
+    { 21282, 11452 }, { 21050, 11454 }, { 21285, 11455 }, { 21286, 11456 },
+    { 21287, 11457 }, { 21288, 11458 }, { 21289, 11459 }, { 21290, 11460 },
+    { 21057, 11461 }, { 21058, 11462 }, { 21293, 11464 }, { 21294, 11465 },
+    { 21063, 11466 }, { 21296, 11467 }, { 21067, 11468 }, { 21298, 11524 },
+    { 21066, 11469 }, { 21069, 11470 }, { 21069, 11471 }, { 21073, 11472 },
+    { 21303, 11473 }, { 21071, 11474 }, { 21073, 11475 }, { 21308, 11476 },
+    { 21309, 11477 }, { 21310, 11478 }, { 21311, 11479 }, { 21312, 11487 },
+    { 21313, 11480 }, { 21315, 11481 }, { 21316, 11482 }, { 21084, 11483 },
+    { 21319, 11486 }, { 21091, 11484 }, { 21321, 11485 }, { 21322, 11488 },
+    { 21323, 11489 }, { 21093, 11490 }, { 21325, 11491 }, { 21326, 11492 },
+    { 21327, 11493 }, { 21328, 11494 }, { 21329, 11495 }, { 21330, 11496 },
+    { 21331, 11497 }, { 21332, 11499 }, { 21333, 11500 }, { 21334, 11501 },
+    { 21335, 11502 }, { 21336, 11503 }, { 21337, 11504 }, { 21338, 11505 },
+    { 21339, 11506 }, { 21340, 11507 }, { 21341, 11508 }, { 21342, 11509 },
+    { 21343, 11510 }, { 21344, 11511 }, { 21345, 11512 }, { 21346, 11513 },
+    { 21113, 11514 }, { 21348, 11515 }, { 21349, 11537 }, { 21350, 11516 },
+    { 21122, 11539 }, { 21118, 11517 }, { 21353, 11529 }, { 21354, 11531 },
+    { 21121, 11552 }, { 21122, 11518 }, { 21357, 11551 }, { 21128, 11519 },
+    { 21130, 11520 }, { 21360, 11521 }, { 21361, 11522 }, { 21362, 11523 },
+    { 21363, 11525 }, { 21365, 11526 }, { 21133, 11527 }, { 21137, 11528 },
+    { 21368, 11553 }, { 21369, 11530 }, { 21370, 11532 }, { 21371, 11533 },
+    { 21372, 11534 }, { 21373, 11535 }, { 21374, 11536 }, { 21375, 11538 },
+    { 21376, 11540 }, { 21143, 11541 }, { 21144, 11542 }, { 21379, 11543 },
+    { 21151, 11544 }, { 21151, 11545 }, { 21382, 11550 }, { 21153, 11546 },
+    { 21384, 11549 }, { 21385, 11554 }, { 21386, 11547 }, { 21156, 11548 },
+    { 21388, 11555 }, { 21389, 11556 }, { 21390, 11597 }, { 21161, 11557 },
+    { 21392, 11558 }, { 21161, 11559 }, { 21394, 11560 }, { 21395, 11561 },
+    { 21166, 11562 }, { 21397, 11563 }, { 21398, 11564 }, { 21399, 11565 },
+    { 21400, 11566 }, { 21401, 11567 }, { 21173, 11568 }, { 21403, 11569 },
+    { 21404, 11570 }, { 21172, 11571 }, { 21176, 11572 }, { 21407, 11573 },
+    { 21408, 11576 }, { 21409, 11580 }, { 21410, 11619 }, { 21411, 11626 },
+    { 21412, 11574 }, { 21413, 11575 }, { 21414, 11577 }, { 21415, 11612 },
+    { 21416, 11578 }, { 21417, 11600 }, { 21418, 11601 }, { 21419, 11579 },
+    { 21420, 11581 }, { 21421, 11583 }, { 21422, 11602 }, { 21423, 11582 },
+    { 21424, 11584 }, { 21425, 11585 }, { 21426, 11586 }, { 21195, 11587 },
+    { 21428, 11588 }, { 21429, 11595 }, { 21430, 11596 }, { 21431, 11589 },
+    { 21200, 11590 }, { 21433, 11591 }, { 21434, 11592 }, { 21203, 11593 },
+    { 21206, 11594 }, { 21437, 11598 }, { 21205, 11599 }, { 21439, 11603 },
+    { 21440, 11604 }, { 21441, 11653 }, { 21442, 11605 }, { 21443, 11606 },
+    { 21444, 11607 }, { 21445, 11662 }, { 21214, 11608 }, { 21447, 11609 },
+    { 21448, 11611 }, { 21451, 11613 }, { 21218, 11610 }, { 21454, 11629 },
+    { 21455, 11665 }, { 21457, 11614 }, { 21458, 11615 }, { 21459, 11635 },
+    { 21460, 11616 }, { 21461, 11639 }, { 21463, 11646 }, { 21465, 11617 },
+    { 21449, 11611 }, { 21466, 11620 }, { 21236, 11648 }, { 21468, 11618 },
+    { 21469, 11621 }, { 21462, 11639 }, { 21470, 11622 }, { 21471, 11623 },
+    { 21472, 11624 }, { 21473, 11625 }, { 21245, 11681 }, { 21475, 11627 },
+    { 21476, 11628 }, { 21477, 11633 }, { 21247, 11630 }, { 21453, 11610 },
+    { 21480, 11670 }, { 21481, 11631 }, { 21482, 11632 }, { 21254, 11634 },
+    { 21484, 11636 }, { 21485, 11637 }, { 21486, 11638 }, { 21487, 11640 },
+    { 21488, 11641 }, { 21489, 11642 }, { 21490, 11643 }, { 21259, 11644 },
+    { 21258, 11645 }, { 21493, 11647 }, { 21464, 11646 }, { 21494, 11649 },
+    { 21495, 11650 }, { 21496, 11651 }, { 21497, 11652 }, { 21498, 11654 },
+    { 21450, 11611 }, { 21499, 11655 }, { 21500, 11656 }, { 21501, 11657 },
+    { 21502, 11658 }, { 21273, 11659 }, { 21456, 11665 }, { 21274, 11660 },
+    { 21505, 11661 }, { 21506, 11663 }, { 21278, 11664 }, { 21508, 11666 },
+    { 21509, 11667 }, { 21511, 11668 }, { 21512, 11669 }, { 21513, 11715 },
+    { 21514, 11671 }, { 21515, 11672 }, { 21516, 11673 }, { 21284, 11674 },
+    { 21518, 11675 }, { 21519, 11676 }, { 21520, 11688 }, { 21521, 11735 },
+    { 21522, 11677 }, { 21524, 11716 }, { 21525, 11679 }, { 21526, 11689 },
+    { 21527, 11678 }, { 21528, 11701 }, { 21529, 11721 }, { 21530, 11680 },
+    { 21523, 11677 }, { 21531, 11686 }, { 21532, 11682 }, { 21533, 11683 },
+    { 21534, 11684 }, { 21535, 11685 }, { 21536, 11696 }, { 21280, 11667 },
+    { 21537, 11700 }, { 21308, 11687 }, { 21539, 11690 }, { 21540, 11713 },
+    { 21541, 11691 }, { 21312, 11692 }, { 21543, 11693 }, { 21544, 11694 },
+    { 21545, 11695 }, { 21546, 11697 }, { 21547, 11753 }, { 21548, 11698 },
+    { 21549, 11705 }, { 21550, 11699 }, { 21551, 11710 }, { 21552, 11702 },
+    { 21553, 11703 }, { 21554, 11704 }, { 21555, 11706 }, { 21556, 11707 },
+    { 21557, 11708 }, { 21558, 11709 }, { 21559, 11711 }, { 21329, 11712 },
+    { 21561, 11714 }, { 21562, 11717 }, { 21563, 11720 }, { 21564, 11718 },
+    { 21565, 11723 }, { 21566, 11725 }, { 21567, 11719 }, { 21568, 11722 },
+    { 21569, 11724 }, { 21570, 11726 }, { 21571, 11727 }, { 21572, 11752 },
+    { 21573, 11728 }, { 21574, 11729 }, { 21575, 11747 }, { 21576, 11748 },
+    { 21577, 11730 }, { 21344, 11731 }, { 21579, 11732 }, { 21580, 11733 },
+    { 21351, 11734 }, { 21582, 11736 }, { 21583, 11737 }, { 21584, 11738 },
+    { 21585, 11739 }, { 21586, 11740 }, { 21587, 11741 }, { 21354, 11742 },
+    { 21589, 11743 }, { 21590, 11744 }, { 21591, 11759 }, { 21358, 11745 },
+    { 21593, 11746 }, { 21594, 11749 }, { 21595, 11750 }, { 21596, 11751 },
+    { 21366, 11754 }, { 21365, 11755 }, { 21599, 11757 }, { 21600, 11756 },
+    { 21601, 11758 }, { 21602, 11760 }, { 21370, 11761 }, { 21605, 11762 },
+    { 21606, 11763 }, { 21607, 11764 }, { 21608, 11765 }, { 21609, 11766 },
+    { 21610, 11795 }, { 21381, 11768 }, { 21612, 11774 }, { 21613, 11796 },
+    { 21381, 11767 }, { 21615, 11793 }, { 21616, 11803 }, { 21619, 11769 },
+    { 21618, 11803 }, { 21390, 11770 }, { 21621, 11822 }, { 21622, 11771 },
+    { 21623, 11772 }, { 21391, 11775 }, { 21625, 11776 }, { 21626, 11777 },
+    { 21397, 11773 }, { 21628, 11783 }, { 21629, 11813 }, { 21630, 11830 },
+    { 21631, 11831 }, { 21632, 11778 }, { 21633, 11779 }, { 21634, 11780 },
+    { 21636, 11781 }, { 21403, 11782 }, { 21638, 11794 }, { 21639, 11784 },
+    { 21640, 11785 }, { 21641, 11786 }, { 21411, 11787 }, { 21414, 11788 },
+    { 21644, 11789 }, { 21645, 11790 }, { 21646, 11791 }, { 21647, 11792 },
+    { 21648, 11797 }, { 21649, 11798 }, { 21650, 11799 }, { 21635, 11780 },
+    { 21651, 11800 }, { 21652, 11801 }, { 21653, 11802 }, { 21654, 11804 },
+    { 21426, 11805 }, { 21656, 11806 }, { 21424, 11807 }, { 21658, 11808 },
+    { 21659, 11809 }, { 21430, 11810 }, { 21431, 11811 }, { 21662, 11814 },
+    { 21663, 11821 }, { 21664, 11824 }, { 21665, 11839 }, { 21436, 11853 },
+    { 21439, 11862 }, { 21669, 11867 }, { 21671, 11869 }, { 21442, 11812 },
+    { 21439, 11832 }, { 21444, 11849 }, { 21675, 11815 }, { 21446, 11826 },
+    { 21677, 11820 }, { 21449, 11823 }, { 21448, 11825 }, { 21681, 11816 },
+    { 21682, 11817 }, { 21453, 11818 }, { 21684, 11819 }, { 21685, 11827 },
+    { 21686, 11828 }, { 21687, 11829 }, { 21688, 11833 }, { 21689, 11834 },
+    { 21667, 11853 }, { 21690, 11835 }, { 21462, 11836 }, { 21692, 11837 },
+    { 21693, 11838 }, { 21694, 11840 }, { 21695, 11841 }, { 21696, 11847 },
+    { 21464, 11886 }, { 21466, 11842 }, { 21465, 11843 }, { 21700, 11844 },
+    { 21701, 11845 }, { 21472, 11868 }, { 21703, 11846 }, { 21705, 11848 },
+    { 21706, 11850 }, { 21707, 11851 }, { 21708, 11852 }, { 21709, 11854 },
+    { 21710, 11855 }, { 21711, 11856 }, { 21712, 11857 }, { 21713, 11858 },
+    { 21714, 11859 }, { 21484, 11860 }, { 21716, 11861 }, { 21717, 11863 },
+    { 21718, 11881 }, { 21719, 11896 }, { 21490, 11866 }, { 21721, 11887 },
+    { 21722, 11888 }, { 21723, 11894 }, { 21724, 11864 }, { 21725, 11865 },
+    { 21726, 11870 }, { 21727, 11871 }, { 21728, 11872 }, { 21729, 11923 },
+    { 21730, 11873 }, { 21497, 11874 }, { 21732, 11875 }, { 21733, 11876 },
+    { 21735, 11877 }, { 21736, 11878 }, { 21737, 11879 }, { 21504, 11880 },
+    { 21739, 11882 }, { 21740, 11883 }, { 21741, 11884 }, { 21742, 11893 },
+    { 21743, 11903 }, { 21511, 11885 }, { 21515, 11904 }, { 21746, 11910 },
+    { 21747, 11916 }, { 21748, 11889 }, { 21749, 11890 }, { 21751, 11895 },
+    { 21752, 11891 }, { 21753, 11892 }, { 21754, 11897 }, { 21756, 11917 },
+    { 21527, 11920 }, { 21758, 11921 }, { 21760, 11922 }, { 21761, 11924 },
+    { 21763, 11925 }, { 21764, 11926 }, { 21765, 11928 }, { 21766, 11929 },
+    { 21767, 11931 }, { 21768, 11933 }, { 21734, 11876 }, { 21769, 11948 },
+    { 21770, 11953 }, { 21771, 11957 }, { 21772, 11958 }, { 21773, 11961 },
+    { 21774, 11968 }, { 21775, 11970 }, { 21776, 11972 }, { 21777, 11930 },
+    { 21750, 11890 }, { 21778, 11938 }, { 21779, 11951 }, { 21780, 11952 },
+    { 21781, 11959 }, { 21552, 11965 }, { 21784, 11978 }, { 21785, 11980 },
+    { 21786, 11984 }, { 21787, 11986 }, { 21788, 11982 }, { 21790, 11987 },
+    { 21791, 11989 }, { 21792, 11992 }, { 21783, 11965 }, { 21755, 11897 },
+    { 21793, 11993 }, { 21794, 11999 }, { 21795, 12000 }, { 21796, 12004 },
+    { 21797, 12012 }, { 21798, 12018 }, { 21799, 12019 }, { 21800, 12023 },
+    { 21801, 12024 }, { 21802, 12031 }, { 21803, 12034 }, { 21804, 11900 },
+    { 21805, 11902 }, { 21806, 11906 }, { 21807, 11907 }, { 21808, 11927 },
+    { 21810, 11946 }, { 21812, 11942 }, { 21813, 11944 }, { 21814, 11955 },
+    { 21815, 11956 }, { 21532, 11924 }, { 21586, 11966 }, { 21817, 11974 },
+    { 21587, 11898 }, { 21819, 11899 }, { 21590, 11901 }, { 21821, 11905 },
+    { 21789, 11982 }, { 21822, 11908 }, { 21823, 11909 }, { 21591, 11911 },
+    { 21811, 11946 }, { 21595, 11912 }, { 21826, 11913 }, { 21827, 11914 },
+    { 21828, 11915 }, { 21829, 11918 }, { 21830, 11919 }, { 21598, 11932 },
+    { 21832, 11934 }, { 21603, 11935 }, { 21604, 11936 }, { 21835, 11937 },
+    { 21836, 11939 }, { 21604, 11940 }, { 21838, 11962 }, { 21839, 11954 },
+    { 21609, 11971 }, { 21607, 11976 }, { 21609, 11996 }, { 21844, 12002 },
+    { 21845, 11947 }, { 21846, 11949 }, { 21847, 11950 }, { 21843, 11996 },
+    { 21848, 11943 }, { 21849, 11945 }, { 21619, 11960 }, { 21852, 11979 },
+    { 21853, 11994 }, { 21854, 12008 }, { 21855, 11941 }, { 21856, 11963 },
+    { 21857, 11964 }, { 21858, 11967 }, { 21859, 11969 }, { 21860, 11973 },
+    { 21861, 11975 }, { 21862, 11977 }, { 21632, 11981 }, { 21632, 11983 },
+    { 21633, 11985 }, { 21866, 11988 }, { 21868, 11990 }, { 21869, 11991 },
+    { 21870, 11995 }, { 21640, 11997 }, { 21872, 11998 }, { 21867, 11988 },
+    { 21873, 12001 }, { 21874, 12003 }, { 21875, 12005 }, { 21644, 12006 },
+    { 21877, 12007 }, { 21646, 12009 }, { 21649, 12010 }, { 21880, 12011 },
+    { 21648, 12013 }, { 21882, 12014 }, { 21883, 12016 }, { 21884, 12025 },
+    { 21885, 12015 }, { 21653, 12017 }, { 21887, 12020 }, { 21888, 12021 },
+    { 21656, 12022 }, { 21890, 12041 }, { 21891, 12026 }, { 21892, 12027 },
+    { 21893, 12028 }, { 21894, 12029 }, { 21895, 12030 }, { 21666, 12032 },
+    { 21897, 12033 }, { 21667, 12035 }, { 21899, 12036 }, { 21900, 12037 },
+    { 21668, 12057 }, { 21902, 12038 }, { 21903, 12043 }, { 21904, 12051 },
+    { 21905, 12072 }, { 21906, 12093 }, { 21907, 12095 }, { 21908, 12099 },
+    { 21909, 12100 }, { 21910, 12039 }, { 21911, 12063 }, { 21912, 12040 },
+    { 21683, 12052 }, { 21914, 12053 }, { 21685, 12044 }, { 21916, 12059 },
+    { 21917, 12087 }, { 21918, 12042 }, { 21919, 12049 }, { 21920, 12060 },
+    { 21921, 12061 }, { 21922, 12045 }, { 21923, 12046 }, { 21924, 12047 },
+    { 21925, 12048 }, { 21697, 12050 }, { 21928, 12071 }, { 21930, 12054 },
+    { 21932, 12055 }, { 21933, 12104 }, { 21934, 12056 }, { 21935, 12058 },
+    { 21936, 12064 }, { 21937, 12065 }, { 21704, 12068 }, { 21939, 12101 },
+    { 21940, 12066 }, { 21941, 12097 }, { 21942, 12062 }, { 21943, 12067 },
+    { 21714, 12069 }, { 21945, 12070 }, { 21946, 12077 }, { 21715, 12073 },
+    { 21948, 12075 }, { 21716, 12074 }, { 21719, 12076 }, { 21951, 12078 },
+    { 21952, 12079 }, { 21719, 12080 }, { 21954, 12081 }, { 21726, 12082 },
+    { 21723, 12083 }, { 21957, 12084 }, { 21958, 12085 }, { 21959, 12086 },
+    { 21960, 12088 }, { 21728, 12089 }, { 21729, 12090 }, { 21963, 12091 },
+    { 21735, 12092 }, { 21965, 12094 }, { 21732, 12096 }, { 21733, 12098 },
+    { 21734, 12102 }, { 21969, 12103 }, { 21737, 12105 }, { 21971, 12106 },
+    { 21972, 12107 }, { 21740, 12108 }, { 21974, 12109 }, { 21975, 12110 },
+    { 21976, 12111 }, { 21977, 12112 }, { 21978, 12113 }, { 21979, 12114 },
+    { 21980, 12115 }, { 21981, 12116 }, { 21982, 12117 }, { 21983, 12118 },
+    { 21984, 12121 }, { 21985, 12119 }, { 21986, 12120 }, { 21987, 12122 },
+    { 21988, 12123 }, { 21758, 12124 }, { 21990, 12125 }, { 21761, 12126 },
+    { 21992, 12127 }, { 21993, 12128 }, { 21994, 12129 }, { 21766, 12130 },
+    { 21996, 12151 }, { 21997, 12131 }, { 21998, 12132 }, { 21769, 12133 },
+    { 22000, 12134 }, { 22001, 12135 }, { 22002, 12136 }, { 22003, 12137 },
+    { 21772, 12138 }, { 22005, 12139 }, { 22006, 12140 }, { 22007, 12141 },
+    { 22008, 12142 }, { 22009, 12143 }, { 21780, 12144 }, { 22011, 12145 },
+    { 21779, 12146 }, { 22013, 12147 }, { 22014, 12148 }, { 21785, 12152 },
+    { 22016, 12149 }, { 22018, 12156 }, { 22019, 12166 }, { 22020, 12150 },
+    { 22021, 12150 }, { 22022, 12161 }, { 22023, 12153 }, { 22024, 12170 },
+    { 22025, 12181 }, { 22026, 12193 }, { 22028, 12194 }, { 22029, 12155 },
+    { 22030, 12158 }, { 22017, 12149 }, { 22031, 12160 }, { 22032, 12195 },
+    { 21804, 12199 }, { 22027, 12193 }, { 22035, 12154 }, { 22036, 12180 },
+    { 21800, 12199 }, { 22037, 12188 }, { 22038, 12157 }, { 22039, 12159 },
+    { 22040, 12162 }, { 22041, 12163 }, { 22042, 12164 }, { 22043, 12165 },
+    { 21812, 12167 }, { 22045, 12168 }, { 22046, 12169 }, { 22047, 12171 },
+    { 21817, 12172 }, { 22049, 12173 }, { 22050, 12174 }, { 22051, 12177 },
+    { 22052, 12182 }, { 22053, 12175 }, { 22054, 12176 }, { 22055, 12178 },
+    { 22057, 12179 }, { 22058, 12183 }, { 22059, 12184 }, { 22060, 12185 },
+    { 22061, 12186 }, { 21830, 12191 }, { 22063, 12192 }, { 22064, 12196 },
+    { 22065, 12187 }, { 22066, 12189 }, { 22067, 12190 }, { 22068, 12226 },
+    { 22069, 12197 }, { 22071, 12198 }, { 22072, 12202 }, { 22073, 12203 },
+    { 22074, 12209 }, { 22075, 12218 }, { 22076, 12200 }, { 22077, 12201 },
+    { 22078, 12204 }, { 21847, 12205 }, { 21850, 12206 }, { 22081, 12224 },
+    { 21852, 12207 }, { 21853, 12254 }, { 22084, 12208 }, { 21854, 12210 },
+    { 22086, 12211 }, { 22087, 12228 }, { 21857, 12212 }, { 22070, 12197 },
+    { 22089, 12213 }, { 22090, 12214 }, { 22091, 12215 }, { 22092, 12216 },
+    { 21863, 12217 }, { 22094, 12219 }, { 22095, 12239 }, { 22096, 12220 },
+    { 22097, 12221 }, { 21864, 12222 }, { 21865, 12223 }, { 22100, 12225 },
+    { 22101, 12227 }, { 22102, 12229 }, { 22103, 12230 }, { 22104, 12231 },
+    { 21875, 12244 }, { 22106, 12232 }, { 22107, 12242 }, { 22108, 12233 },
+    { 21878, 12234 }, { 22110, 12235 }, { 22111, 12236 }, { 22112, 12241 },
+    { 22113, 12241 }, { 22114, 12237 }, { 22115, 12257 }, { 22117, 12275 },
+    { 22118, 12288 }, { 22119, 12238 }, { 22120, 12263 }, { 22121, 12245 },
+    { 22123, 12259 }, { 21895, 12240 }, { 22125, 12243 }, { 22126, 12246 },
+    { 22127, 12247 }, { 22128, 12248 }, { 22129, 12249 }, { 21896, 12268 },
+    { 21899, 12250 }, { 22132, 12251 }, { 22134, 12253 }, { 22116, 12257 },
+    { 22135, 12260 }, { 22136, 12252 }, { 22137, 12255 }, { 21909, 12258 },
+    { 22139, 12256 }, { 22140, 12261 }, { 22141, 12272 }, { 22122, 12245 },
+    { 22142, 12262 }, { 21912, 12264 }, { 22144, 12265 }, { 21915, 12266 },
+    { 22146, 12267 }, { 22147, 12312 }, { 22148, 12269 }, { 22149, 12270 },
+    { 21920, 12271 }, { 21918, 12273 }, { 22152, 12274 }, { 22153, 12279 },
+    { 21921, 12276 }, { 22155, 12277 }, { 22156, 12278 }, { 21924, 12280 },
+    { 22158, 12281 }, { 22159, 12282 }, { 21929, 12283 }, { 22161, 12284 },
+    { 22162, 12285 }, { 22163, 12286 }, { 22164, 12309 }, { 22165, 12330 },
+    { 21932, 12335 }, { 21936, 12287 }, { 22168, 12289 }, { 22169, 12290 },
+    { 22171, 12291 }, { 21938, 12292 }, { 22173, 12293 }, { 22174, 12344 },
+    { 22175, 12294 }, { 22176, 12295 }, { 21944, 12296 }, { 21949, 12297 },
+    { 21945, 12298 }, { 22180, 12299 }, { 22181, 12300 }, { 22182, 12302 },
+    { 22183, 12301 }, { 21954, 12303 }, { 22185, 12304 }, { 22186, 12305 },
+    { 22187, 12307 }, { 22189, 12324 }, { 21961, 12326 }, { 22191, 12327 },
+    { 22192, 12356 }, { 22188, 12307 }, { 22193, 12306 }, { 22194, 12308 },
+    { 22195, 12314 }, { 22196, 12316 }, { 22197, 12332 }, { 22198, 12334 },
+    { 22199, 12352 }, { 22200, 12353 }, { 21970, 12354 }, { 22202, 12355 },
+    { 22203, 12311 }, { 22204, 12313 }, { 22205, 12317 }, { 22206, 12333 },
+    { 22207, 12349 }, { 22208, 12368 }, { 22209, 12369 }, { 22210, 12321 },
+    { 22211, 12322 }, { 22212, 12336 }, { 22213, 12318 }, { 22214, 12319 },
+    { 22215, 12323 }, { 22216, 12339 }, { 22218, 12341 }, { 22219, 12375 },
+    { 22220, 12310 }, { 21992, 12315 }, { 21992, 12366 }, { 22223, 12320 },
+    { 22224, 12325 }, { 22225, 12328 }, { 21997, 12329 }, { 22217, 12339 },
+    { 22227, 12331 }, { 21998, 12337 }, { 22229, 12338 }, { 22230, 12340 },
+    { 22231, 12367 }, { 22232, 12342 }, { 22233, 12346 }, { 22234, 12357 },
+    { 22003, 12343 }, { 22236, 12345 }, { 22237, 12347 }, { 22238, 12348 },
+    { 22239, 12350 }, { 22240, 12358 }, { 22242, 12359 }, { 22243, 12362 },
+    { 22244, 12363 }, { 22245, 12365 }, { 22246, 12371 }, { 22247, 12374 },
+    { 22249, 12376 }, { 22250, 12378 }, { 22251, 12380 }, { 22252, 12381 },
+    { 22253, 12393 }, { 22248, 12374 }, { 22254, 12394 }, { 22255, 12403 },
+    { 22256, 12427 }, { 22257, 12428 }, { 22258, 12395 }, { 22260, 12396 },
+    { 22261, 12398 }, { 22262, 12401 }, { 22264, 12402 }, { 22265, 12404 },
+    { 22266, 12406 }, { 22267, 12410 }, { 22036, 12416 }, { 22270, 12417 },
+    { 22043, 12424 }, { 22273, 12432 }, { 22274, 12434 }, { 22275, 12415 },
+    { 22276, 12422 }, { 22277, 12425 }, { 22047, 12430 }, { 22280, 12436 },
+    { 22281, 12437 }, { 22282, 12441 }, { 22054, 12442 }, { 22259, 12395 },
+    { 22285, 12449 }, { 22056, 12451 }, { 22263, 12401 }, { 22279, 12430 },
+    { 22287, 12462 }, { 22288, 12468 }, { 22289, 12469 }, { 22291, 12443 },
+    { 22241, 12358 }, { 22283, 12441 }, { 22293, 12445 }, { 22295, 12446 },
+    { 22296, 12447 }, { 22298, 12448 }, { 22299, 12455 }, { 22063, 12443 },
+    { 22301, 12466 }, { 22297, 12447 }, { 22303, 12479 }, { 22304, 12480 },
+    { 22305, 12485 }, { 22306, 12496 }, { 22308, 12370 }, { 22309, 12377 },
+    { 22269, 12416 }, { 22310, 12389 }, { 22311, 12397 }, { 22312, 12405 },
+    { 22314, 12351 }, { 22085, 12414 }, { 22307, 12496 }, { 22316, 12439 },
+    { 22319, 12459 }, { 22317, 12452 }, { 22091, 12461 }, { 22322, 12463 },
+    { 22323, 12364 }, { 22324, 12408 }, { 22092, 12360 }, { 22326, 12361 },
+    { 22327, 12390 }, { 22302, 12466 }, { 22318, 12452 }, { 22328, 12419 },
+    { 22313, 12405 }, { 22099, 12384 }, { 22330, 12407 }, { 22331, 12413 },
+    { 22332, 12372 }, { 22300, 12455 }, { 22333, 12400 }, { 22334, 12382 },
+    { 22335, 12383 }, { 22336, 12429 }, { 22103, 12373 }, { 22338, 12379 },
+    { 22339, 12385 }, { 22340, 12386 }, { 22110, 12387 }, { 22342, 12388 },
+    { 22109, 12409 }, { 22344, 12412 }, { 22345, 12433 }, { 22114, 12435 },
+    { 22347, 12421 }, { 22119, 12444 }, { 22349, 12391 }, { 22320, 12459 },
+    { 22350, 12453 }, { 22351, 12453 }, { 22122, 12454 }, { 22352, 12453 },
+    { 22355, 12458 }, { 22356, 12456 }, { 22357, 12460 }, { 22358, 12467 },
+    { 22125, 12470 }, { 22361, 12474 }, { 22132, 12483 }, { 22363, 12488 },
+    { 22364, 12490 }, { 22366, 12491 }, { 22368, 12492 }, { 22370, 12504 },
+    { 22141, 12510 }, { 22374, 12513 }, { 22375, 12516 }, { 22376, 12517 },
+    { 22377, 12518 }, { 22378, 12476 }, { 22379, 12477 }, { 22367, 12491 },
+    { 22372, 12510 }, { 22380, 12489 }, { 22360, 12470 }, { 22381, 12493 },
+    { 22382, 12500 }, { 22383, 12509 }, { 22384, 12512 }, { 22385, 12522 },
+    { 22386, 12532 }, { 22387, 12511 }, { 22388, 12523 }, { 22389, 12525 },
+    { 22390, 12535 }, { 22391, 12536 }, { 22393, 12544 }, { 22394, 12567 },
+    { 22395, 12570 }, { 22396, 12478 }, { 22397, 12503 }, { 22398, 12506 },
+    { 22400, 12507 }, { 22402, 12521 }, { 22403, 12531 }, { 22404, 12495 },
+    { 22175, 12520 }, { 22406, 12524 }, { 22407, 12528 }, { 22408, 12551 },
+    { 22409, 12555 }, { 22411, 12392 }, { 22413, 12399 }, { 22183, 12411 },
+    { 22415, 12418 }, { 22410, 12555 }, { 22416, 12450 }, { 22365, 12490 },
+    { 22417, 12486 }, { 22418, 12420 }, { 22419, 12438 }, { 22420, 12440 },
+    { 22422, 12423 }, { 22423, 12426 }, { 22424, 12431 }, { 22425, 12457 },
+    { 22426, 12464 }, { 22392, 12536 }, { 22427, 12497 }, { 22399, 12506 },
+    { 22428, 12498 }, { 22429, 12526 }, { 22430, 12547 }, { 22431, 12465 },
+    { 22432, 12471 }, { 22433, 12472 }, { 22434, 12473 }, { 22205, 12475 },
+    { 22436, 12481 }, { 22437, 12482 }, { 22438, 12494 }, { 22439, 12505 },
+    { 22440, 12501 }, { 22441, 12533 }, { 22442, 12542 }, { 22445, 12484 },
+    { 22446, 12487 }, { 22219, 12499 }, { 22219, 12502 }, { 22421, 12440 },
+    { 22450, 12508 }, { 22451, 12527 }, { 22452, 12534 }, { 22220, 12514 },
+    { 22454, 12515 }, { 22225, 12519 }, { 22456, 12559 }, { 22457, 12529 },
+    { 22458, 12530 }, { 22459, 12537 }, { 22226, 12538 }, { 22461, 12591 },
+    { 22462, 12539 }, { 22233, 12540 }, { 22234, 12541 }, { 22235, 12543 },
+    { 22234, 12545 }, { 22467, 12546 }, { 22468, 12548 }, { 22469, 12549 },
+    { 22470, 12550 }, { 22471, 12552 }, { 22472, 12599 }, { 22473, 12553 },
+    { 22241, 12576 }, { 22475, 12554 }, { 22476, 12556 }, { 22477, 12557 },
+    { 22244, 12558 }, { 22479, 12560 }, { 22480, 12603 }, { 22247, 12561 },
+    { 22482, 12562 }, { 22483, 12563 }, { 22484, 12564 }, { 22485, 12565 },
+    { 22486, 12566 }, { 22257, 12568 }, { 22488, 12569 }, { 22256, 12571 },
+    { 22257, 12572 }, { 22491, 12573 }, { 22492, 12574 }, { 22493, 12575 },
+    { 22494, 12577 }, { 22495, 12583 }, { 22496, 12578 }, { 22497, 12579 },
+    { 22498, 12584 }, { 22268, 12580 }, { 22500, 12585 }, { 22501, 12587 },
+    { 22502, 12590 }, { 22503, 12586 }, { 22504, 12588 }, { 22505, 12597 },
+    { 22506, 12635 }, { 22507, 12581 }, { 22274, 12582 }, { 22509, 12589 },
+    { 22278, 12621 }, { 22511, 12592 }, { 22512, 12593 }, { 22280, 12594 },
+    { 22514, 12595 }, { 22515, 12596 }, { 22516, 12598 }, { 22517, 12600 },
+    { 22518, 12601 }, { 22519, 12602 }, { 22520, 12604 }, { 22521, 12605 },
+    { 22522, 12606 }, { 22523, 12607 }, { 22524, 12608 }, { 22526, 12609 },
+    { 22527, 12610 }, { 22299, 12611 }, { 22529, 12612 }, { 22530, 12613 },
+    { 22302, 12614 }, { 22300, 12615 }, { 22303, 12617 }, { 22534, 12618 },
+    { 22535, 12622 }, { 22536, 12624 }, { 22537, 12637 }, { 22538, 12639 },
+    { 22540, 12643 }, { 22541, 12668 }, { 22542, 12616 }, { 22311, 12627 },
+    { 22544, 12628 }, { 22546, 12648 }, { 22547, 12652 }, { 22548, 12620 },
+    { 22525, 12608 }, { 22317, 12641 }, { 22550, 12645 }, { 22321, 12651 },
+    { 22552, 12664 }, { 22553, 12669 }, { 22554, 12670 }, { 22545, 12628 },
+    { 22555, 12677 }, { 22556, 12679 }, { 22557, 12619 }, { 22558, 12623 },
+    { 22559, 12625 }, { 22561, 12626 }, { 22560, 12625 }, { 22562, 12629 },
+    { 22563, 12630 }, { 22334, 12631 }, { 22565, 12632 }, { 22566, 12634 },
+    { 22337, 12653 }, { 22568, 12633 }, { 22339, 12661 }, { 22570, 12636 },
+    { 22341, 12638 }, { 22572, 12640 }, { 22573, 12642 }, { 22574, 12657 },
+    { 22309, 12639 }, { 22575, 12646 }, { 22576, 12654 }, { 22577, 12644 },
+    { 22578, 12649 }, { 22579, 12666 }, { 22581, 12647 }, { 22582, 12650 },
+    { 22583, 12655 }, { 22350, 12656 }, { 22354, 12658 }, { 22586, 12659 },
+    { 22587, 12660 }, { 22588, 12662 }, { 22589, 12663 }, { 22358, 12665 },
+    { 22361, 12667 }, { 22592, 12671 }, { 22362, 12672 }, { 22594, 12675 },
+    { 22365, 12687 }, { 22580, 12666 }, { 22596, 12716 }, { 22367, 12673 },
+    { 22598, 12674 }, { 22370, 12715 }, { 22600, 12676 }, { 22601, 12678 },
+    { 22602, 12680 }, { 22370, 12681 }, { 22373, 12682 }, { 22605, 12683 },
+    { 22372, 12684 }, { 22607, 12685 }, { 22379, 12686 }, { 22609, 12708 },
+    { 22610, 12688 }, { 22611, 12689 }, { 22612, 12697 }, { 22613, 12699 },
+    { 22614, 12690 }, { 22615, 12691 }, { 22616, 12692 }, { 22383, 12693 },
+    { 22618, 12704 }, { 22619, 12735 }, { 22620, 12694 }, { 22621, 12695 },
+    { 22388, 12696 }, { 22623, 12698 }, { 22624, 12700 }, { 22625, 12701 },
+    { 22396, 12747 }, { 22627, 12702 }, { 22628, 12703 }, { 22629, 12705 },
+    { 22630, 12706 }, { 22631, 12707 }, { 22632, 12709 }, { 22634, 12710 },
+    { 22635, 12711 }, { 22402, 12727 }, { 22637, 12739 }, { 22408, 12712 },
+    { 22639, 12713 }, { 22640, 12763 }, { 22410, 12714 }, { 22642, 12717 },
+    { 22643, 12718 }, { 22644, 12719 }, { 22645, 12720 }, { 22646, 12721 },
+    { 22647, 12722 }, { 22648, 12723 }, { 22649, 12724 }, { 22650, 12725 },
+    { 22420, 12726 }, { 22652, 12728 }, { 22423, 12729 }, { 22654, 12730 },
+    { 22655, 12731 }, { 22656, 12732 }, { 22657, 12733 }, { 22424, 12734 },
+    { 22425, 12736 }, { 22426, 12738 }, { 22661, 12740 }, { 22428, 12741 },
+    { 22663, 12762 }, { 22430, 12737 }, { 22431, 12759 }, { 22666, 12742 },
+    { 22435, 12743 }, { 22438, 12744 }, { 22669, 12745 }, { 22670, 12746 },
+    { 22671, 12748 }, { 22672, 12749 }, { 22673, 12750 }, { 22674, 12751 },
+    { 22675, 12752 }, { 22442, 12753 }, { 22444, 12754 }, { 22447, 12755 },
+    { 22447, 12756 }, { 22680, 12757 }, { 22681, 12758 }, { 22448, 12800 },
+    { 22452, 12760 }, { 22453, 12761 }, { 22685, 12764 }, { 22687, 12765 },
+    { 22454, 12766 }, { 22689, 12767 }, { 22457, 12768 }, { 22691, 12769 },
+    { 22692, 12770 }, { 22693, 12771 }, { 22694, 12772 }, { 22462, 12773 },
+    { 22466, 12774 }, { 22697, 12776 }, { 22698, 12775 }, { 22466, 12777 },
+    { 22700, 12778 }, { -1, 12779 }, { -8, 12780 }, { 22454, 12764 },
+    { 22565, 12781 }, { 22517, 12782 }, { -38, 12783 }, { -45, 12784 },
+    { -52, 12785 }, { -59, 12786 }, { 22529, 12838 }, { -76, 12787 },
+    { 22539, 12812 }, { 22563, 12788 }, { -106, 12813 }, { -113, 12789 },
+    { 22577, 12790 }, { 22571, 12791 }, { 22561, 12792 }, { 22559, 12803 },
+    { 22523, 12793 }, { -179, 12797 }, { -186, 12794 }, { 22557, 12795 },
+    { 22578, 12796 }, { 22555, 12798 }, { -232, 12799 }, { -239, 12801 },
+    { 22580, 12802 }, { -259, 12804 }, { -270, 12805 }, { -277, 12806 },
+    { -284, 12807 }, { -291, 12808 }, { 22572, 12809 }, { -311, 12810 },
+    { -318, 12811 }, { 22572, 12814 }, { -338, 12815 }, { -345, 12816 },
+    { -352, 12817 }, { -359, 12818 }, { 22532, 12819 }, { -379, 12820 },
+    { 22575, 12821 }, { -396, 12822 }, { -403, 12823 }, { -410, 12824 },
+    { 22572, 12825 }, { 22536, 12826 }, { -437, 12827 }, { -444, 12828 },
+    { -451, 12829 }, { 22574, 12830 }, { -468, 12831 }, { 22585, 12832 },
+    { -485, 12833 }, { -492, 12834 }, { -499, 12835 }, { 22594, 12836 },
+    { -519, 12837 }, { -539, 12839 }, { -546, 12840 }, { 22596, 12841 },
+    { -566, 12842 }, { 22581, 12843 }, { -586, 12844 }, { 22580, 12845 },
+    { 22542, 12846 }, { 22592, 12847 }, { -630, 12848 }, { 22565, 12874 },
+    { -647, 12849 }, { -654, 12852 }, { -661, 12896 }, { -668, 12850 },
+    { 22602, 12851 }, { 22594, 12853 }, { -695, 12880 }, { -702, 12854 },
+    { -709, 12855 }, { -716, 12856 }, { -723, 12857 }, { -730, 12858 },
+    { -737, 12859 }, { 22604, 12860 }, { -757, 12863 }, { -764, 12861 },
+    { 22601, 12862 }, { -781, 12864 }, { -788, 12865 }, { 22550, 12866 },
+    { 22607, 12867 }, { -815, 12868 }, { -822, 12869 }, { -829, 12870 },
+    { -836, 12871 }, { -843, 12872 }, { -850, 12873 }, { -857, 12875 },
+    { -864, 12876 }, { 22550, 12881 }, { -881, 12877 }, { -888, 12878 },
+    { -895, 12879 }, { -902, 12882 }, { -909, 12883 }, { -916, 12884 },
+    { -923, 12885 }, { -930, 12886 }, { -937, 12904 }, { -944, 12920 },
+    { 22589, 12887 }, { -961, 12888 }, { -968, 12907 }, { -975, 12889 },
+    { -982, 12890 }, { -989, 12891 }, { -1000, 12892 }, { 22603, 12893 },
+    { 22582, 12894 }, { 22595, 12895 }, { -1051, 12897 }, { 22605, 12894 },
+    { 22577, 12898 }, { 22597, 12899 }, { -1089, 12900 }, { -1096, 12901 },
+    { -1107, 12902 }, { -1114, 12903 }, { 22601, 12905 }, { -1138, 12906 },
+    { -1149, 12908 }, { -1156, 12909 }, { 22592, 12910 }, { -1176, 12911 },
+    { 22613, 12912 }, { 22597, 12913 }, { 22614, 12914 }, { -1227, 12915 },
+    { 22607, 12916 }, { 22568, 12916 }, { 22609, 12916 }, { 22578, 12916 },
+    { 22583, 12916 }, { -1394, 12917 }, { -1401, 12918 }, { -1408, 12919 },
+    { -1425, 12921 }, { 22611, 12922 }, { -1442, 12923 }, { 22623, 12924 },
+    { -1459, 12925 }, { -1466, 12926 }, { -1477, 12927 }, { -1484, 12928 },
+    { -1491, 12929 }, { -1498, 12930 }, { -1505, 12931 }, { -1512, 12932 },
+    { -1519, 12933 }, { -1526, 12934 }, { -1533, 12935 }, { 22576, 12936 },
+    { -1553, 12937 }, { -1560, 12938 }, { -1567, 12939 }, { -1574, 12940 },
+    { -1581, 12946 }, { 22611, 12941 }, { -1605, 12942 }, { -1612, 12943 },
+    { -1623, 12944 }, { -1630, 12945 }, { -1637, 12947 }, { -1644, 12948 },
+    { 22607, 12949 }, { 22587, 12950 }, { -1689, 12951 }, { -1696, 12952 },
+    { -1703, 12953 }, { -1710, 12954 }, { -1717, 12955 }, { -1724, 12956 },
+    { -1731, 12957 }, { -1742, 12958 }, { 22607, 12959 }, { 22621, 12960 },
+    { -1777, 12961 }, { 22583, 12962 }, { -1797, 12963 }, { -1804, 12964 },
+    { -1811, 12965 }, { -1818, 12966 }, { 22633, 12967 }, { -1843, 12968 },
+    { -1854, 12969 }, { -1865, 12970 }, { -1876, 12971 }, { -1883, 12972 },
+    { 22628, 12973 }, { 22635, 12974 }, { -1910, 12975 }, { -1917, 12976 },
+    { 22633, 12977 }, { 22624, 12978 }, { 22625, 12979 }, { -1980, 12980 },
+    { 22626, 12981 }, { -2000, 12982 }, { -2007, 12983 }, { -2014, 12984 },
+    { -2021, 12985 }, { 22631, 12986 }, { -2045, 12987 }, { -2052, 13027 },
+    { -2059, 12988 }, { 22593, 12991 }, { 22600, 12989 }, { 22589, 13002 },
+    { 22631, 13038 }, { 22603, 12990 }, { 22628, 12995 }, { 22629, 12992 },
+    { 22644, 13018 }, { 22630, 12993 }, { 22637, 12994 }, { 22654, 12996 },
+    { 22597, 12994 }, { 22660, 12994 }, { 22608, 12997 }, { -2219, 13005 },
+    { -2226, 13011 }, { 22653, 13016 }, { 22631, 12998 }, { -2283, 12999 },
+    { 22637, 13022 }, { 22607, 12998 }, { 22664, 13022 }, { 22647, 13000 },
+    { 22668, 13001 }, { 22623, 13003 }, { 22667, 13004 }, { 22673, 13040 },
+    { 22618, 13043 }, { -2360, 13006 }, { 22619, 13007 }, { 22627, 13008 },
+    { 22648, 13009 }, { 22645, 13010 }, { -2427, 13012 }, { -2434, 13023 },
+    { -2441, 13013 }, { 22637, 13015 }, { 22626, 13017 }, { 22629, 13014 },
+    { -2520, 13019 }, { -2527, 13021 }, { -2534, 13024 }, { 22624, 13017 },
+    { 22675, 13025 }, { 22684, 13029 }, { 22627, 13047 }, { 22628, 13065 },
+    { 22660, 13020 }, { -2591, 13026 }, { 22633, 13028 }, { 22693, 13028 },
+    { 22693, 13028 }, { 22634, 13030 }, { 22649, 13033 }, { 22668, 13033 },
+    { -2681, 13031 }, { -2688, 13032 }, { 22694, 13033 }, { -2695, 13064 },
+    { 22696, 13034 }, { 22652, 13037 }, { 22677, 13035 }, { 22644, 13034 },
+    { 22654, 13036 }, { 22677, 13039 }, { -2762, 13041 }, { -2769, 13042 },
+    { 22645, 13071 }, { 22656, 13096 }, { 22664, 13044 }, { 22710, 13053 },
+    { -2829, 13045 }, { 22539, 12837 }, { 22680, 13048 }, { -2846, 13073 },
+    { 22652, 13046 }, { -2873, 13049 }, { -2880, 13050 }, { -2887, 13051 },
+    { 22682, 13086 }, { 22664, 13052 }, { 22662, 13085 }, { 22654, 13086 },
+    { 22716, 13086 }, { 22683, 13054 }, { -2973, 13066 }, { 22670, 13055 },
+    { 22673, 13056 }, { -3000, 13057 }, { 22671, 13058 }, { 22664, 13098 },
+    { 22724, 13098 }, { -3037, 13101 }, { -3044, 13059 }, { -3051, 13060 },
+    { 22665, 13115 }, { -3068, 13061 }, { 22715, 13062 }, { 22705, 13062 },
+    { 22679, 13063 }, { 22677, 13067 }, { 22704, 13089 }, { -3135, 13068 },
+    { 22685, 13095 }, { -3152, 13069 }, { 22722, 13100 }, { 22696, 13070 },
+    { -3189, 13084 }, { -3196, 13072 }, { 22732, 13074 }, { 22685, 13075 },
+    { -3233, 13076 }, { 22714, 13074 }, { 22732, 13108 }, { -3250, 13077 },
+    { 22726, 13078 }, { 22692, 13079 }, { 22711, 13079 }, { 22710, 13080 },
+    { 22703, 13081 }, { 22737, 13079 }, { -3320, 13082 }, { -3327, 13083 },
+    { 22726, 13087 }, { 22740, 13088 }, { 22710, 13090 }, { 22692, 13091 },
+    { 22710, 13092 }, { 22724, 13093 }, { 22748, 13094 }, { 22727, 13102 },
+    { 22728, 13097 }, { -3424, 13099 }, { 22694, 13103 }, { -3441, 13104 },
+    { -3448, 13105 }, { -3455, 13107 }, { 22750, 13106 }, { -3472, 13109 },
+    { 22711, 13130 }, { -3489, 13110 }, { -3496, 13111 }, { -3503, 13112 },
+    { 22700, 13113 }, { 22710, 13114 }, { 22761, 13127 }, { 22749, 13116 },
+    { 22718, 13117 }, { 22708, 13116 }, { -3570, 13118 }, { 22758, 13119 },
+    { -3587, 13120 }, { -3604, 13121 }, { 22745, 13129 }, { 22747, 13122 },
+    { 22748, 13149 }, { 22751, 13123 }, { 22752, 13124 }, { 22722, 13137 },
+    { -3683, 13140 }, { -3690, 13125 }, { 22749, 13126 }, { 22742, 13128 },
+    { 22595, 12919 }, { 22769, 13128 }, { 22740, 13131 }, { -3755, 13132 },
+    { -3762, 13133 }, { -3769, 13134 }, { -3776, 13135 }, { 22753, 13136 },
+    { -3796, 13138 }, { -3803, 13139 }, { -3810, 13141 }, { -3817, 13142 },
+    { 22723, 13143 }, { -3837, 13144 }, { -3844, 13145 }, { -3851, 13146 },
+    { -3858, 13147 }, { -3865, 13148 }, { -3872, 13150 }, { 22760, 13151 },
+    { -3892, 13152 }, { 22764, 13153 }, { -3912, 13154 }, { 22734, 13155 },
+    { -3939, 13156 }, { -3946, 13157 }, { -3953, 13158 }, { -3960, 13159 },
+    { 22725, 13160 }, { -3988, 13161 }, { -3995, 13162 }, { -4010, 13163 },
+    { -4017, 13164 }, { -4024, 13165 }, { 22721, 13166 }, { -4045, 13167 },
+    { -4052, 13168 }, { -4059, 13169 }, { 22756, 13170 }, { -4080, 13171 },
+    { -4087, 13172 }, { -4094, 13180 }, { -4101, 13173 }, { -4108, 13174 },
+    { -4115, 13175 }, { 22786, 13176 }, { -4135, 13177 }, { -4142, 13178 },
+    { -4149, 13179 }, { -4156, 13181 }, { -4163, 13182 }, { -4170, 13195 },
+    { -4177, 13183 }, { -4184, 13184 }, { -4191, 13185 }, { -4198, 13186 },
+    { 22726, 13187 }, { -4218, 13188 }, { -4225, 13189 }, { -4232, 13190 },
+    { -4239, 13191 }, { -4246, 13192 }, { -4253, 13193 }, { 22780, 13194 },
+    { -4294, 13196 }, { 22781, 13197 }, { -4315, 13198 }, { -4322, 13199 },
+    { -4329, 13200 }, { -4336, 13201 }, { -4347, 13202 }, { -4354, 13203 },
+    { 22782, 13204 }, { -4375, 13205 }, { -4382, 13206 }, { 22758, 13207 },
+    { 22774, 13207 }, { -4413, 13208 }, { -4420, 13209 }, { 22793, 13210 },
+    { 22737, 13211 }, { 22746, 13212 }, { 22768, 13213 }, { 22793, 13214 },
+    { 22770, 13215 }, { -4515, 13216 }, { -4522, 13217 }, { -4529, 13218 },
+    { -4544, 13219 }, { -4551, 13220 }, { -4558, 13249 }, { -4565, 13221 },
+    { -4572, 13222 }, { -4579, 13223 }, { -4590, 13224 }, { -4597, 13225 },
+    { -4604, 13226 }, { -4611, 13227 }, { 22742, 13228 }, { 22749, 13229 },
+    { -4686, 13230 }, { -4697, 13231 }, { -4704, 13232 }, { -4711, 13233 },
+    { -4718, 13234 }, { -4725, 13235 }, { -4736, 13236 }, { -4743, 13237 },
+    { -4750, 13238 }, { -4757, 13239 }, { -4764, 13242 }, { -4771, 13248 },
+    { -4778, 13250 }, { -4785, 13265 }, { -4792, 13240 }, { -4799, 13243 },
+    { -4806, 13244 }, { -4813, 13252 }, { -4820, 13290 }, { -4827, 13241 },
+    { -4834, 13245 }, { -4841, 13246 }, { -4848, 13247 }, { -4855, 13251 },
+    { -4862, 13268 }, { -4869, 13285 }, { -4876, 13287 }, { -4883, 13294 },
+    { -4890, 13253 }, { -4897, 13257 }, { -4904, 13291 }, { -4911, 13254 },
+    { -4918, 13255 }, { -4925, 13256 }, { -4932, 13258 }, { -4939, 13259 },
+    { -4946, 13260 }, { -4953, 13261 }, { -4960, 13262 }, { -4967, 13263 },
+    { -4974, 13264 }, { -4981, 13266 }, { -4988, 13267 }, { -4995, 13269 },
+    { -5002, 13270 }, { -5009, 13271 }, { -5016, 13272 }, { -5023, 13280 },
+    { -5030, 13317 }, { -5037, 13273 }, { -5044, 13274 }, { -5051, 13275 },
+    { -5058, 13276 }, { -5065, 13277 }, { -5072, 13278 }, { -5079, 13296 },
+    { -5086, 13279 }, { -5093, 13281 }, { -5100, 13282 }, { -5107, 13284 },
+    { -5114, 13283 }, { -5121, 13334 }, { -5128, 13286 }, { -5135, 13288 },
+    { -5142, 13289 }, { -5149, 13292 }, { -5156, 13293 }, { -5163, 13295 },
+    { -5170, 13297 }, { -5190, 13324 }, { -5197, 13298 }, { -5204, 13299 },
+    { -5211, 13335 }, { -5218, 13336 }, { -5225, 13300 }, { -5232, 13301 },
+    { -5239, 13302 }, { -5246, 13303 }, { -5253, 13304 }, { -5260, 13305 },
+    { -5267, 13306 }, { -5274, 13307 }, { -5281, 13308 }, { -5288, 13309 },
+    { -5295, 13310 }, { -5302, 13311 }, { -5309, 13312 }, { -5316, 13313 },
+    { -5323, 13314 }, { -5330, 13315 }, { -5337, 13318 }, { -5344, 13337 },
+    { -5351, 13316 }, { -5358, 13319 }, { -5365, 13320 }, { -5372, 13322 },
+    { -5379, 13321 }, { -5386, 13323 }, { -5393, 13346 }, { -5400, 13325 },
+    { -5420, 13327 }, { -5427, 13326 }, { -5434, 13328 }, { -5441, 13345 },
+    { 22769, 13329 }, { -5461, 13330 }, { -5468, 13331 }, { 22798, 13332 },
+    { 22796, 13333 }, { -5498, 13338 }, { 22799, 13339 }, { 22763, 13340 },
+    { 22748, 13341 }, { -5544, 13342 }, { -5551, 13343 }, { -5558, 13344 },
+    { -5565, 13347 }, { -5572, 13348 }, { 22751, 13120 }, { -5579, 13349 },
+    { -5586, 13350 }, { -5597, 13351 }, { 22788, 13352 }, { -5614, 13353 },
+    { -5621, 13354 }, { 22755, 13355 }, { -5641, 13356 }, { -5660, 13357 },
+    { -5691, 13358 }, { -5698, 13359 }, { -5705, 13360 }, { -5712, 13361 },
+    { 22781, 13362 }, { -5729, 13363 }, { -5760, 13364 }, { -5767, 13365 },
+    { 22756, 13366 }, { 22777, 13367 }, { -5807, 13368 }, { 22808, 13369 },
+    { 22757, 13367 }, { -5824, 13370 }, { 22772, 13371 }, { -5844, 13372 },
+    { -5851, 13373 }, { -5858, 13374 }, { 22813, 13375 }, { -5875, 13376 },
+    { -5882, 13377 }, { -5889, 13378 }, { -5896, 13379 }, { -5903, 13380 },
+    { 22760, 13381 }, { -5923, 13382 }, { -5930, 13383 }, { -5945, 13384 },
+    { -5952, 13385 }, { -5959, 13386 }, { -5966, 13387 }, { -5973, 13388 },
+    { -5980, 13389 }, { -5987, 13390 }, { -5994, 13391 }, { 22764, 13392 },
+    { -6046, 13393 }, { -6053, 13394 }, { 22799, 13395 }, { 22764, 13396 },
+    { 22821, 13397 }, { -6105, 13398 }, { -6112, 13399 }, { 22810, 13400 },
+    { 22805, 13400 }, { -6149, 13401 }, { -6156, 13402 }, { -6163, 13403 },
+    { -6170, 13404 }, { -6177, 13405 }, { -6184, 13406 }, { 22819, 13407 },
+    { 22771, 13408 }, { -6227, 13409 }, { -6234, 13410 }, { -6241, 13411 },
+    { -6248, 13412 }, { -6255, 13413 }, { -6262, 13414 }, { -6269, 13415 },
+    { -6276, 13416 }, { -6295, 13417 }, { 22780, 13418 }, { 22818, 13419 },
+    { -6322, 13420 }, { -6329, 13421 }, { -6336, 13422 }, { -6343, 13423 },
+    { -6350, 13424 }, { -6357, 13425 }, { 22827, 13426 }, { -6374, 13427 },
+    { -6381, 13428 }, { -6388, 13429 }, { 22802, 13443 }, { -6405, 13430 },
+    { -6412, 13431 }, { -6419, 13449 }, { -6426, 13432 }, { -6433, 13433 },
+    { -6440, 13434 }, { -6447, 13435 }, { -6454, 13436 }, { -6461, 13437 },
+    { -6468, 13438 }, { 22818, 13439 }, { 22777, 13440 }, { -6509, 13441 },
+    { -6530, 13442 }, { -6537, 13444 }, { -6544, 13445 }, { -6559, 13446 },
+    { -6570, 13447 }, { -6585, 13448 }, { -6592, 13450 }, { -6599, 13451 },
+    { -6614, 13452 }, { 22820, 13453 }, { 22831, 13454 }, { -6656, 13455 },
+    { -6663, 13456 }, { 22823, 13457 }, { -6680, 13458 }, { -6687, 13459 },
+    { -6694, 13460 }, { 22778, 13461 }, { 22832, 13462 }, { 22833, 13463 },
+    { -6731, 13464 }, { -6746, 13465 }, { -6753, 13466 }, { -6760, 13467 },
+    { -6767, 13468 }, { -6774, 13469 }, { -6794, 13488 }, { -6801, 13470 },
+    { -6808, 13471 }, { -6815, 13472 }, { -6822, 13482 }, { -6829, 13473 },
+    { -6836, 13486 }, { -6843, 13496 }, { -6850, 13474 }, { -6857, 13522 },
+    { -6864, 13475 }, { 22817, 13476 }, { -6884, 13477 }, { -6891, 13478 },
+    { -6898, 13479 }, { 22819, 13490 }, { 22826, 13480 }, { -6928, 13481 },
+    { -6935, 13483 }, { -6942, 13484 }, { -6949, 13485 }, { -6956, 13487 },
+    { -6963, 13524 }, { -6970, 13489 }, { -6977, 13491 }, { -6984, 13492 },
+    { -6991, 13493 }, { -6998, 13494 }, { -7005, 13495 }, { -7012, 13497 },
+    { -7019, 13498 }, { -7026, 13499 }, { -7033, 13500 }, { -7040, 13501 },
+    { -7047, 13502 }, { -7054, 13503 }, { -7061, 13505 }, { -7068, 13525 },
+    { -7075, 13504 }, { -7082, 13506 }, { -7089, 13507 }, { -7096, 13508 },
+    { -7107, 13509 }, { -7118, 13510 }, { -7125, 13511 }, { -7140, 13512 },
+    { -7147, 13513 }, { 22829, 13514 }, { 22839, 13518 }, { -7174, 13515 },
+    { -7181, 13516 }, { -7188, 13517 }, { -7195, 13519 }, { 22794, 13520 },
+    { 22803, 13521 }, { -7222, 13540 }, { 22801, 13523 }, { -7239, 13526 },
+    { -7246, 13571 }, { 22789, 13297 }, { -7253, 13527 }, { 22836, 13528 },
+    { -7270, 13529 }, { -7277, 13530 }, { -7284, 13531 }, { 22822, 13563 },
+    { -7301, 13532 }, { 22812, 13533 }, { -7328, 13534 }, { -7335, 13535 },
+    { -7342, 13551 }, { 22850, 13533 }, { -7349, 13536 }, { -7356, 13537 },
+    { -7363, 13538 }, { -7370, 13539 }, { -7377, 13541 }, { -7384, 13542 },
+    { -7391, 13543 }, { -7398, 13544 }, { 22798, 13545 }, { -7419, 13546 },
+    { 22847, 13547 }, { 22843, 13548 }, { -7458, 13549 }, { -7469, 13550 },
+    { -7476, 13569 }, { 22815, 13552 }, { -7496, 13584 }, { 22744, 13325 },
+    { -7503, 13603 }, { -7510, 13610 }, { -7517, 13553 }, { -7524, 13554 },
+    { -7531, 13555 }, { -7538, 13556 }, { -7545, 13557 }, { -7552, 13558 },
+    { -7559, 13559 }, { -7566, 13560 }, { 22802, 13561 }, { -7595, 13562 },
+    { -7612, 13564 }, { -7619, 13590 }, { -7626, 13565 }, { -7633, 13566 },
+    { -7644, 13567 }, { -7651, 13568 }, { -7658, 13570 }, { 22805, 13572 },
+    { -7675, 13573 }, { -7682, 13574 }, { -7689, 13575 }, { -7696, 13576 },
+    { -7703, 13577 }, { -7710, 13578 }, { -7717, 13579 }, { -7724, 13580 },
+    { -7731, 13581 }, { -7738, 13594 }, { -7745, 13628 }, { -7752, 13582 },
+    { -7759, 13583 }, { -7766, 13585 }, { -7773, 13586 }, { -7780, 13587 },
+    { -7787, 13588 }, { 22854, 13589 }, { -7804, 13591 }, { -7811, 13592 },
+    { -7818, 13593 }, { 22842, 13595 }, { 22863, 13596 }, { -7845, 13597 },
+    { -7852, 13598 }, { 22803, 13599 }, { 22839, 13600 }, { -7889, 13601 },
+    { 22826, 13599 }, { -7900, 13602 }, { -7907, 13604 }, { 22860, 13605 },
+    { 22850, 13607 }, { -7938, 13629 }, { 22851, 13606 }, { 22852, 13608 },
+    { -7965, 13609 }, { -7976, 13611 }, { 22838, 13612 }, { -7997, 13622 },
+    { -8004, 13623 }, { 22843, 13625 }, { -8021, 13613 }, { -8028, 13614 },
+    { -8035, 13615 }, { -8042, 13616 }, { -8049, 13617 }, { -8056, 13618 },
+    { -8063, 13619 }, { 22844, 13620 }, { -8080, 13621 }, { 22866, 13624 },
+    { -8100, 13626 }, { -8107, 13627 }, { -8114, 13630 }, { -8121, 13631 },
+    { -8128, 13632 }, { -8135, 13633 }, { -8142, 13634 }, { -8149, 13635 },
+    { -8156, 13642 }, { -8163, 13636 }, { -8170, 13656 }, { 22867, 13637 },
+    { 22876, 13638 }, { 22819, 13639 }, { 22862, 13640 }, { -8229, 13641 },
+    { 22823, 13643 }, { -8249, 13644 }, { -8260, 13645 }, { -8267, 13646 },
+    { -8278, 13647 }, { 22832, 13648 }, { -8299, 13649 }, { -8306, 13650 },
+    { -8313, 13651 }, { -8320, 13652 }, { -8327, 13653 }, { -8334, 13654 },
+    { -8341, 13655 }, { -8348, 13657 }, { -8359, 13658 }, { -8366, 13659 },
+    { -8373, 13660 }, { -8380, 13661 }, { -8387, 13662 }, { -8394, 13663 },
+    { -8401, 13664 }, { -8408, 13671 }, { -8415, 13665 }, { -8422, 13666 },
+    { -8429, 13667 }, { -8436, 13668 }, { -8443, 13669 }, { 22805, 13441 },
+    { -8450, 13670 }, { -8457, 13672 }, { -8464, 13679 }, { -8471, 13673 },
+    { -8478, 13674 }, { -8485, 13675 }, { -8492, 13676 }, { -8499, 13677 },
+    { -8506, 13678 }, { -8513, 13680 }, { -8520, 13681 }, { -8527, 13682 },
+    { -8534, 13683 }, { -8541, 13684 }, { -8548, 13685 }, { -8555, 13686 },
+    { -8562, 13687 }, { -8569, 13688 }, { -8576, 13689 }, { -8583, 13690 },
+    { -8590, 13691 }, { -8597, 13692 }, { -8604, 13693 }, { 22826, 13469 },
+    { -8611, 13694 }, { -8618, 13695 }, { -8629, 13696 }, { 22863, 13697 },
+    { 22864, 13698 }, { -8656, 13699 }, { -8679, 13700 }, { -8686, 13701 },
+    { -8693, 13702 }, { -8700, 13703 }, { -8707, 13704 }, { 22831, 13705 },
+    { -8736, 13706 }, { -8747, 13707 }, { -8754, 13708 }, { 22869, 13709 },
+    { -8771, 13710 }, { -8778, 13711 }, { -8785, 13712 }, { 22885, 13713 },
+    { 22830, 13714 }, { 22879, 13715 }, { -8825, 13716 }, { 22883, 13717 },
+    { 22874, 13718 }, { -8863, 13719 }, { -8870, 13720 }, { -8877, 13721 },
+    { -8896, 13722 }, { -8903, 13723 }, { 22855, 13724 }, { -8939, 13725 },
+    { -8950, 13726 }, { -8957, 13727 }, { -8964, 13728 }, { -8971, 13729 },
+    { -8978, 13730 }, { 22869, 13731 }, { 22879, 13732 }, { -9015, 13733 },
+    { -9022, 13734 }, { -9029, 13735 }, { -9036, 13736 }, { -9043, 13737 },
+    { 22835, 13738 }, { -9073, 13739 }, { 22875, 13738 }, { -9080, 13740 },
+    { -9091, 13741 }, { -9110, 13742 }, { 22888, 13743 }, { -9127, 13744 },
+    { -9134, 13745 }, { -9141, 13746 }, { -9148, 13747 }, { -9155, 13748 },
+    { -9162, 13749 }, { 22871, 13750 }, { -9195, 13751 }, { 22841, 13752 },
+    { -9215, 13753 }, { -9222, 13754 }, { -9229, 13755 }, { -9236, 13756 },
+    { 22880, 13757 }, { -9257, 13758 }, { -9272, 13759 }, { -9279, 13760 },
+    { 22888, 13761 }, { -9303, 13762 }, { 22882, 13763 }, { 22843, 13764 },
+    { 22903, 13765 }, { 22883, 13764 }, { -9353, 13766 }, { -9360, 13767 },
+    { -9367, 13768 }, { -9374, 13769 }, { -9381, 13770 }, { 22888, 13771 },
+    { -9398, 13772 }, { -9405, 13773 }, { -9412, 13774 }, { -9419, 13777 },
+    { -9426, 13781 }, { -9433, 13783 }, { 22870, 13784 }, { -9450, 13785 },
+    { 22893, 13787 }, { 22887, 13796 }, { -9487, 13802 }, { 22853, 13787 },
+    { -9494, 13810 }, { -9501, 13816 }, { -9508, 13819 }, { -9515, 13832 },
+    { -9522, 13833 }, { -9529, 13775 }, { -9536, 13786 }, { -9543, 13792 },
+    { -9550, 13800 }, { 22847, 13838 }, { -9570, 13843 }, { 22830, 13562 },
+    { -9577, 13776 }, { -9584, 13778 }, { -9591, 13780 }, { 22864, 13779 },
+    { -9627, 13782 }, { 22850, 13788 }, { -9644, 13789 }, { -9651, 13790 },
+    { -9658, 13821 }, { -9665, 13824 }, { -9672, 13826 }, { -9679, 13793 },
+    { -9686, 13835 }, { -9693, 13791 }, { -9700, 13794 }, { -9707, 13795 },
+    { -9714, 13803 }, { -9721, 13805 }, { -9728, 13812 }, { -9735, 13825 },
+    { -9742, 13834 }, { -9749, 13850 }, { -9756, 13797 }, { -9763, 13845 },
+    { -9770, 13801 }, { -9777, 13827 }, { -9784, 13798 }, { 22855, 13799 },
+    { -9801, 13804 }, { -9808, 13806 }, { 22907, 13840 }, { -9825, 13823 },
+    { -9832, 13831 }, { -9839, 13841 }, { -9846, 13829 }, { -9853, 13842 },
+    { -9860, 13855 }, { -9867, 13807 }, { -9874, 13811 }, { -9881, 13813 },
+    { -9888, 13857 }, { 22911, 13809 }, { -9905, 13820 }, { -9912, 13858 },
+    { 22887, 13808 }, { 22887, 13814 }, { -9939, 13815 }, { -9946, 13844 },
+    { -9953, 13817 }, { -9960, 13849 }, { -9967, 13818 }, { -9974, 13822 },
+    { -9981, 13828 }, { 22856, 13830 }, { -9998, 13836 }, { -10005, 13837 },
+    { -10022, 13839 }, { -10029, 13846 }, { -10036, 13847 }, { -10043, 13848 },
+    { -10050, 13851 }, { -10057, 13852 }, { -10064, 13853 }, { -10071, 13854 },
+    { -10078, 13856 }, { -10085, 13859 }, { -10092, 13860 }, { -10099, 13861 },
+    { -10106, 13862 }, { -10113, 13863 }, { -10120, 13864 }, { -10127, 13865 },
+    { -10134, 13866 }, { 22883, 13867 }, { -10161, 13868 }, { -10168, 13902 },
+    { -10175, 13869 }, { -10182, 13870 }, { 22862, 13871 }, { -10199, 13922 },
+    { 22858, 13872 }, { -10216, 13873 }, { -10223, 13874 }, { -10230, 13875 },
+    { -10237, 13876 }, { -10244, 13877 }, { -10251, 13878 }, { -10258, 13879 },
+    { -10265, 13880 }, { 22892, 13881 }, { 22863, 13882 }, { -10303, 13883 },
+    { -10310, 13884 }, { -10317, 13885 }, { -10324, 13886 }, { -10331, 13887 },
+    { -10338, 13888 }, { -10345, 13889 }, { -10352, 13890 }, { -10359, 13891 },
+    { -10366, 13892 }, { -10373, 13893 }, { 22866, 13894 }, { 22907, 13895 },
+    { -10407, 13896 }, { 22867, 13897 }, { 22896, 13898 }, { -10444, 13899 },
+    { -10451, 13900 }, { -10458, 13901 }, { -10465, 13903 }, { -10472, 13904 },
+    { -10479, 13905 }, { -10486, 13906 }, { -10493, 13907 }, { 22921, 13908 },
+    { -10513, 13909 }, { -10520, 13910 }, { 22914, 13911 }, { -10537, 13912 },
+    { -10544, 13913 }, { -10551, 13914 }, { -10558, 13915 }, { -10565, 13916 },
+    { -10572, 13917 }, { -10579, 13918 }, { -10586, 13919 }, { -10593, 13920 },
+    { -10600, 13921 }, { 22903, 13931 }, { -10617, 13923 }, { -10624, 13924 },
+    { -10631, 13925 }, { -10638, 13932 }, { -10645, 13926 }, { -10652, 13927 },
+    { 22905, 13928 }, { -10669, 13929 }, { -10676, 13930 }, { -10691, 13933 },
+    { -10706, 13934 }, { -10713, 13935 }, { 22926, 13936 }, { -10730, 13937 },
+    { -10737, 13938 }, { -10744, 13939 }, { -10751, 13940 }, { -10758, 13941 },
+    { -10765, 13942 }, { -10772, 13943 }, { -10779, 13944 }, { 22877, 13945 },
+    { -10799, 13946 }, { -10806, 13947 }, { -10813, 13948 }, { -10840, 13949 },
+    { -10847, 13950 }, { -10854, 13951 }, { -10861, 13952 }, { -10868, 13953 },
+    { -10875, 13954 }, { 22917, 13955 }, { -10892, 13956 }, { -10915, 13957 },
+    { -10930, 13958 }, { -10941, 13959 }, { -10948, 13960 }, { -10959, 13961 },
+    { -10970, 13962 }, { 22887, 13963 }, { -10987, 13964 }, { -10994, 13965 },
+    { -11001, 13966 }, { -11018, 13967 }, { 22932, 13968 }, { 22927, 13968 },
+    { -11055, 13987 }, { 22907, 14016 }, { -11078, 13969 }, { 22926, 13970 },
+    { -11098, 13971 }, { -11105, 13972 }, { -11112, 13973 }, { -11119, 13974 },
+    { -11126, 13975 }, { -11133, 13976 }, { -11140, 13977 }, { -11147, 13978 },
+    { 22914, 13979 }, { -11167, 13980 }, { -11174, 13981 }, { -11181, 13982 },
+    { -11188, 13983 }, { -11195, 13984 }, { 22930, 13990 }, { -11215, 13985 },
+    { -11222, 13986 }, { -11229, 13988 }, { 22931, 13989 }, { -11246, 13991 },
+    { -11253, 13992 }, { -11260, 13993 }, { -11267, 13994 }, { -11274, 13995 },
+    { 22882, 13996 }, { -11294, 13997 }, { -11301, 13998 }, { -11308, 13999 },
+    { -11315, 14000 }, { -11322, 14001 }, { -11329, 14002 }, { -11336, 14003 },
+    { -11343, 14004 }, { -11350, 14005 }, { -11357, 14006 }, { -11364, 14007 },
+    { -11371, 14008 }, { 22940, 14009 }, { -11391, 14010 }, { -11398, 14011 },
+    { -11405, 14026 }, { -11412, 14012 }, { -11419, 14013 }, { -11426, 14014 },
+    { -11433, 14015 }, { -11440, 14017 }, { -11447, 14018 }, { -11454, 14019 },
+    { -11461, 14020 }, { -11468, 14021 }, { -11475, 14022 }, { -11486, 14023 },
+    { -11493, 14024 }, { -11500, 14025 }, { -11515, 14027 }, { 22890, 14028 },
+    { -11535, 14029 }, { -11542, 14030 }, { 22890, 14031 }, { 22891, 14032 },
+    { -11569, 14033 }, { 22932, 14034 }, { 22893, 14035 }, { -11596, 14036 },
+    { -11603, 14037 }, { -11620, 14038 }, { -11627, 14039 }, { -11634, 14040 },
+    { -11641, 14041 }, { -11648, 14042 }, { -11655, 14043 }, { 22952, 14044 },
+    { -11675, 14045 }, { 22945, 14046 }, { -11695, 14047 }, { -11702, 14048 },
+    { 22894, 14049 }, { -11722, 14050 }, { 22951, 14051 }, { 22942, 14052 },
+    { -11755, 14053 }, { -11762, 14054 }, { -11769, 14055 }, { -11776, 14056 },
+    { -11783, 14057 }, { -11790, 14058 }, { -11797, 14059 }, { 22901, 14060 },
+    { 22944, 14060 }, { 22920, 14060 }, { 22903, 14061 }, { 22947, 14062 },
+    { 22923, 14063 }, { 22905, 14064 }, { -11903, 14065 }, { -11910, 14067 },
+    { -11921, 14066 }, { -11936, 14068 }, { -11943, 14069 }, { -11950, 14070 },
+    { -11957, 14071 }, { 22958, 14072 }, { 22911, 14073 }, { -11990, 14074 },
+    { 22939, 14075 }, { 22958, 14077 }, { 22874, 13837 }, { 22960, 14076 },
+    { 22962, 14076 }, { 22954, 14078 }, { -12053, 14079 }, { -12060, 14080 },
+    { -12067, 14081 }, { -12074, 14082 }, { -12081, 14083 }, { -12088, 14084 },
+    { -12095, 14085 }, { -12102, 14086 }, { -12109, 14087 }, { -12116, 14088 },
+    { 22970, 14089 }, { -12136, 14090 }, { -12143, 14091 }, { -12150, 14105 },
+    { -12157, 14092 }, { -12164, 14093 }, { -12171, 14129 }, { -12178, 14094 },
+    { -12185, 14095 }, { -12192, 14096 }, { -12199, 14097 }, { -12206, 14098 },
+    { -12213, 14116 }, { -12220, 14099 }, { -12227, 14100 }, { -12234, 14101 },
+    { -12241, 14102 }, { -12248, 14103 }, { -12268, 14104 }, { -12285, 14106 },
+    { -12292, 14107 }, { -12299, 14108 }, { -12306, 14109 }, { -12313, 14110 },
+    { -12320, 14111 }, { -12327, 14112 }, { -12334, 14113 }, { -12341, 14114 },
+    { -12348, 14115 }, { 22940, 14117 }, { 22973, 14118 }, { 22960, 14119 },
+    { 22934, 14120 }, { -12404, 14121 }, { -12411, 14141 }, { -12418, 14122 },
+    { 22917, 14123 }, { -12438, 14124 }, { -12445, 14125 }, { -12452, 14126 },
+    { -12459, 14127 }, { -12466, 14128 }, { -12473, 14130 }, { -12484, 14131 },
+    { -12491, 14132 }, { 22948, 14133 }, { 22924, 14134 }, { 22959, 14134 },
+    { -12534, 14135 }, { -12541, 14136 }, { 22929, 14137 }, { 22930, 14138 },
+    { -12568, 14139 }, { 22929, 14140 }, { 22986, 14140 }, { 22945, 14142 },
+    { -12605, 14143 }, { -12612, 14144 }, { -12619, 14145 }, { -12626, 14146 },
+    { -12633, 14147 }, { -12640, 14148 }, { 22931, 14149 }, { 22966, 14149 },
+    { -12673, 14150 }, { -12680, 14151 }, { -12687, 14152 }, { -12694, 14153 },
+    { -12701, 14154 }, { -12716, 14155 }, { -12727, 14156 }, { -12734, 14157 },
+    { 22983, 14158 }, { -12774, 14159 }, { -12781, 14160 }, { -12788, 14161 },
+    { -12795, 14162 }, { 22934, 14163 }, { -12815, 14164 }, { -12822, 14211 },
+    { -12829, 14165 }, { -12836, 14166 }, { -12843, 14167 }, { -12850, 14168 },
+    { -12857, 14169 }, { 22976, 14170 }, { -12874, 14171 }, { -12881, 14172 },
+    { -12888, 14173 }, { -12895, 14174 }, { -12902, 14175 }, { -12909, 14176 },
+    { -12916, 14177 }, { -12923, 14178 }, { 22987, 14179 }, { -12940, 14180 },
+    { 22978, 14181 }, { -12984, 14182 }, { -13007, 14183 }, { -13014, 14184 },
+    { 22982, 14185 }, { 22997, 14186 }, { 22929, 13966 }, { -13041, 14187 },
+    { -13061, 14188 }, { 22991, 14189 }, { -13078, 14190 }, { -13085, 14191 },
+    { 22982, 14192 }, { -13118, 14193 }, { 22984, 14194 }, { -13138, 14195 },
+    { 22989, 14196 }, { -13155, 14197 }, { -13162, 14198 }, { -13169, 14199 },
+    { 22948, 14200 }, { -13189, 14201 }, { -13196, 14202 }, { -13203, 14203 },
+    { -13210, 14204 }, { -13217, 14205 }, { -13224, 14206 }, { -13231, 14207 },
+    { -13238, 14208 }, { -13245, 14209 }, { -13252, 14210 }, { -13259, 14212 },
+    { 23002, 14213 }, { -13276, 14214 }, { -13283, 14215 }, { -13290, 14216 },
+    { -13297, 14217 }, { -13304, 14218 }, { -13321, 14219 }, { -13328, 14220 },
+    { -13335, 14221 }, { 22979, 14222 }, { -13352, 14223 }, { -13359, 14224 },
+    { -13366, 14225 }, { -13373, 14226 }, { -13380, 14227 }, { -13387, 14228 },
+    { -13398, 14229 }, { -13445, 14230 }, { -13452, 14231 }, { -13459, 14232 },
+    { -13466, 14233 }, { -13489, 14234 }, { -13496, 14235 }, { 23000, 14236 },
+    { -13516, 14237 }, { -13539, 14238 }, { -13550, 14239 }, { -13557, 14240 },
+    { -13564, 14241 }, { -13571, 14242 }, { -13578, 14243 }, { -13585, 14244 },
+    { -13592, 14245 }, { -13599, 14246 }, { -13606, 14247 }, { -13613, 14248 },
+    { -13620, 14249 }, { -13627, 14250 }, { -13634, 14251 }, { -13641, 14263 },
+    { -13648, 14252 }, { 22975, 14253 }, { 22991, 14253 }, { -13675, 14254 },
+    { -13682, 14255 }, { -13693, 14256 }, { -13708, 14257 }, { 22984, 14258 },
+    { -13736, 14259 }, { 22919, 14037 }, { -13743, 14260 }, { -13762, 14261 },
+    { -13769, 14262 }, { 23003, 14264 }, { -13793, 14265 }, { -13804, 14266 },
+    { 23001, 14267 }, { -13824, 14268 }, { -13831, 14269 }, { -13838, 14270 },
+    { 23000, 14271 }, { -13868, 14272 }, { -13875, 14273 }, { 22957, 14274 },
+    { 23011, 14274 }, { 22999, 14275 }, { 22955, 14276 }, { -13931, 14277 },
+    { -13938, 14278 }, { -13945, 14279 }, { -13952, 14280 }, { -13959, 14281 },
+    { 22983, 14282 }, { -13976, 14283 }, { -13983, 14284 }, { -13990, 14285 },
+    { -13997, 14286 }, { -14004, 14287 }, { -14011, 14288 }, { 23002, 14289 },
+    { -14028, 14290 }, { -14035, 14291 }, { -14042, 14292 }, { -14049, 14293 },
+    { -14056, 14294 }, { -14063, 14295 }, { -14070, 14296 }, { 23021, 14297 },
+    { -14087, 14298 }, { -14094, 14299 }, { -14101, 14300 }, { 23009, 14301 },
+    { -14121, 14302 }, { -14128, 14303 }, { -14139, 14304 }, { 22963, 14305 },
+    { -14160, 14306 }, { -14167, 14307 }, { -14174, 14308 }, { 22967, 14309 },
+    { -14207, 14310 }, { -14214, 14311 }, { 23015, 14309 }, { -14233, 14312 },
+    { 22993, 14313 }, { -14257, 14314 }, { -14264, 14315 }, { -14275, 14316 },
+    { -14282, 14317 }, { -14293, 14318 }, { 23020, 14319 }, { -14310, 14320 },
+    { -14317, 14321 }, { -14324, 14322 }, { -14331, 14323 }, { -14342, 14324 },
+    { 23020, 14325 }, { 22967, 14326 }, { 23022, 14327 }, { -14382, 14328 },
+    { 23017, 14329 }, { 22915, 14103 }, { 22946, 14104 }, { -14402, 14349 },
+    { -14421, 14330 }, { 23014, 14331 }, { -14438, 14332 }, { -14445, 14333 },
+    { -14452, 14334 }, { -14467, 14335 }, { 22972, 14336 }, { -14491, 14337 },
+    { -14498, 14338 }, { -14525, 14339 }, { -14532, 14340 }, { -14549, 14341 },
+    { -14556, 14342 }, { -14563, 14343 }, { -14578, 14344 }, { -14593, 14345 },
+    { -14600, 14346 }, { 23021, 14347 }, { 23031, 14348 }, { 22991, 14350 },
+    { 23027, 14347 }, { -14682, 14351 }, { 23003, 14352 }, { 23004, 14353 },
+    { -14743, 14354 }, { -14750, 14355 }, { 23028, 14356 }, { -14775, 14357 },
+    { -14782, 14358 }, { -14789, 14359 }, { -14800, 14360 }, { -14807, 14361 },
+    { 23014, 14362 }, { -14831, 14363 }, { -14838, 14364 }, { -14853, 14365 },
+    { -14864, 14366 }, { -14871, 14367 }, { -14886, 14368 }, { -14897, 14369 },
+    { 23028, 14370 }, { 22987, 14371 }, { 23020, 14378 }, { -14940, 14372 },
+    { -14947, 14373 }, { 23015, 14374 }, { -14964, 14375 }, { -14971, 14401 },
+    { 23026, 14376 }, { 23027, 14377 }, { -15018, 14394 }, { 23010, 14377 },
+    { -15025, 14412 }, { -15032, 14425 }, { -15039, 14379 }, { -15046, 14380 },
+    { 23043, 14387 }, { -15066, 14400 }, { -15073, 14417 }, { -15080, 14381 },
+    { -15087, 14386 }, { -15094, 14382 }, { -15101, 14383 }, { -15108, 14428 },
+    { -15115, 14384 }, { -15122, 14385 }, { 23031, 14388 }, { -15139, 14389 },
+    { 23031, 14390 }, { 23024, 14391 }, { -15166, 14392 }, { -15173, 14393 },
+    { -15180, 14395 }, { -15187, 14396 }, { -15194, 14397 }, { -15201, 14398 },
+    { -15208, 14399 }, { -15215, 14402 }, { -15222, 14403 }, { 23044, 14404 },
+    { 22942, 14187 }, { -15245, 14405 }, { -15252, 14415 }, { -15259, 14406 },
+    { -15266, 14407 }, { -15273, 14408 }, { -15280, 14409 }, { -15287, 14410 },
+    { -15294, 14411 }, { -15301, 14413 }, { -15308, 14414 }, { -15315, 14420 },
+    { -15322, 14423 }, { -15329, 14431 }, { -15336, 14472 }, { -15343, 14416 },
+    { 23024, 14418 }, { -15360, 14419 }, { -15367, 14421 }, { -15374, 14422 },
+    { -15381, 14424 }, { -15388, 14427 }, { -15395, 14429 }, { 22999, 14426 },
+    { 23036, 14426 }, { -15422, 14430 }, { 23052, 14432 }, { 23053, 14433 },
+    { -15449, 14434 }, { -15456, 14435 }, { 23005, 14436 }, { 22948, 14218 },
+    { -15476, 14437 }, { -15483, 14438 }, { -15490, 14439 }, { -15497, 14440 },
+    { -15504, 14441 }, { -15511, 14442 }, { 23029, 14443 }, { -15528, 14444 },
+    { -15535, 14445 }, { 23055, 14446 }, { -15556, 14447 }, { -15563, 14448 },
+    { -15570, 14449 }, { -15577, 14450 }, { 23054, 14484 }, { 23047, 14451 },
+    { -15604, 14452 }, { 23012, 14453 }, { 23063, 14454 }, { 23054, 14455 },
+    { -15644, 14456 }, { 23051, 14457 }, { 23062, 14458 }, { 23014, 14459 },
+    { 23054, 14460 }, { -15697, 14461 }, { 23059, 14462 }, { 23045, 14463 },
+    { -15727, 14464 }, { -15734, 14465 }, { -15741, 14466 }, { 23047, 14467 },
+    { -15761, 14468 }, { -15768, 14469 }, { 23020, 14470 }, { 23068, 14471 },
+    { 23064, 14473 }, { -15837, 14474 }, { 23066, 14475 }, { -15854, 14476 },
+    { 23061, 14473 }, { -15861, 14477 }, { -15872, 14478 }, { 23065, 14479 },
+    { -15898, 14480 }, { -15909, 14481 }, { -15916, 14482 }, { -15923, 14483 },
+    { 23060, 14485 }, { 23078, 14515 }, { -15956, 14486 }, { -15963, 14487 },
+    { -15970, 14488 }, { 22951, 14270 }, { -15977, 14489 }, { -15984, 14490 },
+    { -15991, 14491 }, { -15998, 14492 }, { -16005, 14493 }, { -16020, 14494 },
+    { -16035, 14495 }, { -16042, 14496 }, { -16053, 14497 }, { -16060, 14498 },
+    { -16071, 14499 }, { -16082, 14500 }, { -16089, 14501 }, { -16096, 14502 },
+    { -16103, 14503 }, { -16110, 14504 }, { -16117, 14505 }, { -16124, 14506 },
+    { -16131, 14507 }, { -16138, 14508 }, { -16145, 14509 }, { -16152, 14510 },
+    { -16159, 14511 }, { -16166, 14512 }, { -16173, 14513 }, { 23076, 14514 },
+    { -16190, 14516 }, { -16197, 14517 }, { -16204, 14518 }, { 23025, 14519 },
+    { -16221, 14520 }, { -16228, 14521 }, { -16235, 14522 }, { 23029, 14523 },
+    { 23027, 14524 }, { -16277, 14525 }, { -16284, 14526 }, { -16303, 14527 },
+    { -16314, 14528 }, { 23059, 14529 }, { 23089, 14530 }, { -16347, 14531 },
+    { -16354, 14532 }, { -16361, 14533 }, { -16368, 14534 }, { -16375, 14569 },
+    { -16382, 14535 }, { -16389, 14536 }, { 23028, 14537 }, { -16406, 14538 },
+    { -16413, 14539 }, { -16420, 14540 }, { -16427, 14541 }, { -16438, 14542 },
+    { -16473, 14543 }, { -16484, 14544 }, { -16507, 14545 }, { 23090, 14546 },
+    { -16539, 14547 }, { -16546, 14548 }, { -16553, 14549 }, { 23036, 14550 },
+    { -16577, 14551 }, { -16584, 14552 }, { 23060, 14553 }, { -16604, 14554 },
+    { -16619, 14555 }, { 23031, 14556 }, { 23076, 14557 }, { 23083, 14558 },
+    { 23084, 14559 }, { 23080, 14560 }, { -16687, 14561 }, { 23043, 14562 },
+    { -16707, 14563 }, { -16714, 14564 }, { -16721, 14565 }, { 23021, 14340 },
+    { -16728, 14566 }, { -16739, 14567 }, { -16746, 14568 }, { 23054, 14570 },
+    { -16770, 14571 }, { -16785, 14572 }, { -16792, 14573 }, { -16807, 14574 },
+    { -16814, 14575 }, { -16821, 14576 }, { -16828, 14577 }, { -16835, 14578 },
+    { -16842, 14579 }, { -16849, 14580 }, { -16856, 14581 }, { -16863, 14582 },
+    { -16870, 14583 }, { -16881, 14584 }, { 23072, 14585 }, { -16901, 14586 },
+    { -16912, 14587 }, { -16919, 14588 }, { -16926, 14589 }, { -16933, 14590 },
+    { -16940, 14591 }, { 23095, 14592 }, { -16957, 14593 }, { -16968, 14594 },
+    { -16975, 14595 }, { -16982, 14596 }, { 23090, 14597 }, { -17006, 14598 },
+    { -17033, 14599 }, { -17040, 14600 }, { -17047, 14601 }, { -17062, 14602 },
+    { -17073, 14603 }, { -17080, 14604 }, { 23099, 14605 }, { -17097, 14606 },
+    { -17108, 14607 }, { -17115, 14608 }, { -17122, 14609 }, { -17129, 14658 },
+    { 23062, 14610 }, { -17146, 14611 }, { -17153, 14612 }, { 23090, 14613 },
+    { 23081, 14614 }, { -17180, 14615 }, { -17187, 14616 }, { 23098, 14617 },
+    { 23104, 14618 }, { -17230, 14619 }, { -17237, 14620 }, { 23061, 14621 },
+    { -17265, 14622 }, { 23053, 14623 }, { 23054, 14624 }, { -17295, 14625 },
+    { -17302, 14626 }, { 23066, 14627 }, { 23067, 14628 }, { -17335, 14629 },
+    { -17342, 14630 }, { 23097, 14631 }, { -17359, 14632 }, { -17370, 14633 },
+    { 23110, 14679 }, { -17390, 14634 }, { 23117, 14635 }, { -17407, 14636 },
+    { -17414, 14637 }, { -17421, 14638 }, { -17428, 14639 }, { -17435, 14640 },
+    { -17442, 14641 }, { 23116, 14642 }, { -17462, 14643 }, { 23086, 14644 },
+    { 23116, 14645 }, { -17510, 14646 }, { -17517, 14647 }, { -17528, 14648 },
+    { 23076, 14649 }, { -17556, 14650 }, { -17563, 14651 }, { -17570, 14652 },
+    { 23107, 14653 }, { -17590, 14654 }, { -17597, 14655 }, { -17604, 14656 },
+    { 23119, 14657 }, { 23124, 14659 }, { -17631, 14660 }, { -17638, 14661 },
+    { 23080, 14662 }, { 23071, 14663 }, { -17711, 14664 }, { -17718, 14665 },
+    { -17725, 14666 }, { -17756, 14667 }, { -17763, 14668 }, { -17778, 14669 },
+    { -17797, 14670 }, { -17808, 14671 }, { -17815, 14672 }, { -17822, 14673 },
+    { -17829, 14674 }, { 23115, 14675 }, { -17849, 14676 }, { -17856, 14677 },
+    { -17871, 14678 }, { 23074, 14680 }, { -17888, 14681 }, { -17899, 14682 },
+    { -17906, 14683 }, { -17913, 14684 }, { -17920, 14685 }, { -17927, 14686 },
+    { -17947, 14687 }, { 23085, 14688 }, { -18018, 14689 }, { 23108, 14688 },
+    { 23127, 14688 }, { 23137, 14688 }, { 23109, 14690 }, { -18050, 14691 },
+    { -18057, 14692 }, { 23124, 14693 }, { 23077, 14694 }, { -18095, 14695 },
+    { -18106, 14696 }, { -18117, 14697 }, { -18144, 14698 }, { 23127, 14699 },
+    { 23084, 14701 }, { -18181, 14717 }, { 23135, 14701 }, { -18188, 14730 },
+    { -18205, 14700 }, { -18212, 14712 }, { -18219, 14703 }, { -18226, 14708 },
+    { -18233, 14718 }, { -18240, 14724 }, { -18247, 14736 }, { -18254, 14747 },
+    { -18261, 14755 }, { 23088, 14702 }, { -18278, 14704 }, { -18285, 14706 },
+    { -18292, 14713 }, { -18299, 14705 }, { -18306, 14714 }, { -18313, 14707 },
+    { 23137, 14753 }, { 23138, 14709 }, { -18340, 14711 }, { -18347, 14731 },
+    { -18367, 14710 }, { -18374, 14715 }, { -18381, 14722 }, { 23120, 14716 },
+    { -18404, 14721 }, { -18411, 14729 }, { -18418, 14720 }, { -18425, 14723 },
+    { -18432, 14719 }, { -18439, 14758 }, { -18446, 14768 }, { -18453, 14725 },
+    { -18460, 14741 }, { -18467, 14749 }, { -18474, 14726 }, { -18481, 14727 },
+    { -18488, 14750 }, { -18495, 14728 }, { -18502, 14732 }, { 23091, 14733 },
+    { 23099, 14734 }, { -18532, 14776 }, { 23094, 14739 }, { -18549, 14754 },
+    { -18556, 14760 }, { -18563, 14735 }, { -18570, 14737 }, { 23144, 14738 },
+    { -18587, 14740 }, { -18594, 14789 }, { -18601, 14743 }, { -18608, 14761 },
+    { -18615, 14742 }, { -18622, 14744 }, { -18629, 14763 }, { -18636, 14745 },
+    { -18643, 14787 }, { -18650, 14746 }, { -18657, 14796 }, { 23113, 14748 },
+    { -18674, 14751 }, { -18681, 14752 }, { -18701, 14756 }, { -18708, 14772 },
+    { -18715, 14757 }, { -18722, 14759 }, { -18729, 14762 }, { -18736, 14764 },
+    { -18753, 14765 }, { 23130, 14771 }, { -18770, 14766 }, { -18777, 14767 },
+    { -18784, 14792 }, { 23143, 14769 }, { 23103, 14774 }, { -18811, 14770 },
+    { 23151, 14773 }, { 23141, 14773 }, { -18838, 14775 }, { -18845, 14777 },
+    { -18852, 14778 }, { -18859, 14779 }, { 23112, 14780 }, { -18876, 14810 },
+    { -18883, 14781 }, { -18890, 14800 }, { -18897, 14782 }, { -18904, 14783 },
+    { -18911, 14784 }, { -18918, 14785 }, { -18925, 14786 }, { -18932, 14788 },
+    { -18939, 14790 }, { -18946, 14791 }, { -18953, 14827 }, { -18960, 14793 },
+    { -18967, 14806 }, { -18974, 14794 }, { -18981, 14809 }, { -18988, 14795 },
+    { -18995, 14815 }, { -19002, 14797 }, { -19009, 14798 }, { 23136, 14799 },
+    { -19026, 14801 }, { -19033, 14802 }, { -19040, 14807 }, { -19047, 14803 },
+    { 23107, 14811 }, { -19067, 14813 }, { -19074, 14814 }, { -19081, 14818 },
+    { -19088, 14804 }, { 23109, 14805 }, { 23109, 14812 }, { 23152, 14817 },
+    { -19138, 14834 }, { -19145, 14839 }, { -19152, 14808 }, { -19159, 14816 },
+    { -19166, 14819 }, { -19173, 14823 }, { -19180, 14843 }, { -19187, 14820 },
+    { 23071, 14598 }, { 23087, 14598 }, { 23164, 14846 }, { -19204, 14821 },
+    { -19224, 14822 }, { -19231, 14824 }, { 23143, 14825 }, { -19258, 14826 },
+    { -19265, 14828 }, { -19272, 14829 }, { -19279, 14830 }, { 23163, 14831 },
+    { -19296, 14832 }, { -19303, 14869 }, { -19310, 14833 }, { -19317, 14885 },
+    { 23170, 14835 }, { -19334, 14836 }, { -19341, 14849 }, { -19348, 14837 },
+    { 23171, 14840 }, { -19365, 14853 }, { -19372, 14889 }, { -19379, 14838 },
+    { 23170, 14841 }, { -19399, 14842 }, { 23167, 14844 }, { -19416, 14868 },
+    { -19423, 14872 }, { -19430, 14845 }, { -19437, 14847 }, { -19444, 14848 },
+    { 23172, 14850 }, { 23160, 14864 }, { -19471, 14851 }, { -19478, 14852 },
+    { 23159, 14854 }, { -19495, 14878 }, { -19502, 14855 }, { -19509, 14856 },
+    { -19516, 14857 }, { 23127, 14858 }, { -19533, 14893 }, { -19540, 14859 },
+    { -19547, 14860 }, { -19554, 14861 }, { -19561, 14871 }, { 23152, 14862 },
+    { -19578, 14863 }, { -19585, 14865 }, { 23126, 14866 }, { -19618, 14867 },
+    { -19625, 14870 }, { 23144, 14866 }, { -19632, 14873 }, { -19639, 14875 },
+    { 23137, 14886 }, { -19656, 14874 }, { -19663, 14877 }, { -19670, 14879 },
+    { 23148, 14876 }, { -19687, 14880 }, { -19694, 14881 }, { 23129, 14882 },
+    { -19711, 14883 }, { 23170, 14890 }, { -19728, 14884 }, { -19735, 14887 },
+    { -19742, 14888 }, { -19749, 14897 }, { -19756, 14891 }, { -19763, 14892 },
+    { -19770, 14894 }, { 23130, 14895 }, { 23182, 14896 }, { -19797, 14898 },
+    { -19804, 14899 }, { -19811, 14900 }, { 23134, 14901 }, { 23135, 14959 },
+    { -19861, 14902 }, { -19868, 14903 }, { -19875, 14926 }, { -19882, 14904 },
+    { -19889, 14905 }, { -19948, 14921 }, { 23162, 14906 }, { 23153, 14906 },
+    { 23171, 14906 }, { 23076, 14686 }, { 23188, 14906 }, { -19955, 14907 },
+    { -19962, 14912 }, { -19969, 14929 }, { 23169, 14908 }, { -19996, 14909 },
+    { -20003, 14910 }, { -20010, 14911 }, { 23199, 14913 }, { 23195, 14914 },
+    { -20043, 14915 }, { -20050, 14916 }, { -20057, 14917 }, { -20064, 14918 },
+    { -20071, 14919 }, { 23108, 14730 }, { -20078, 14920 }, { 23156, 14922 },
+    { -20095, 14923 }, { -20102, 14924 }, { -20109, 14925 }, { -20116, 14927 },
+    { -20123, 14928 }, { -20130, 14930 }, { -20137, 14931 }, { 23199, 14932 },
+    { -20158, 14933 }, { -20165, 14934 }, { -20172, 14935 }, { -20179, 14936 },
+    { -20186, 14963 }, { -20193, 14985 }, { -20200, 14937 }, { -20207, 14938 },
+    { -20214, 14954 }, { 23142, 14731 }, { -20221, 14939 }, { 23170, 14940 },
+    { -20241, 14941 }, { -20248, 14942 }, { -20255, 14962 }, { -20262, 14943 },
+    { -20269, 14951 }, { -20276, 14944 }, { -20283, 14945 }, { -20290, 14946 },
+    { 23150, 14947 }, { -20310, 14948 }, { -20317, 14949 }, { -20324, 14950 },
+    { -20331, 14952 }, { -20338, 14953 }, { -20349, 14955 }, { -20356, 14956 },
+    { 23197, 14957 }, { -20389, 14958 }, { -20396, 14960 }, { -20403, 14961 },
+    { -20414, 14964 }, { -20421, 14965 }, { -20436, 14966 }, { -20443, 14967 },
+    { -20450, 14968 }, { -20457, 14969 }, { -20468, 14970 }, { -20479, 14971 },
+    { -20486, 14972 }, { -20493, 14973 }, { -20500, 14974 }, { -20507, 14975 },
+    { -20514, 14976 }, { -20529, 14977 }, { -20536, 14978 }, { -20543, 14979 },
+    { -20550, 14980 }, { -20557, 14981 }, { 23190, 14982 }, { 23148, 14752 },
+    { -20581, 14983 }, { -20588, 14984 }, { 23151, 14986 }, { 23150, 14987 },
+    { -20625, 14988 }, { 23208, 14989 }, { 23106, 14764 }, { -20649, 14990 },
+    { -20656, 14991 }, { 23155, 14992 }, { 23197, 14993 }, { 23198, 14994 },
+    { -20715, 14995 }, { -20726, 14996 }, { -20733, 14997 }, { -20740, 14998 },
+    { -20751, 14999 }, { -20758, 15000 }, { -20769, 15001 }, { -20776, 15002 },
+    { -20783, 15003 }, { -20790, 15004 }, { -20801, 15005 }, { -20808, 15006 },
+    { 23153, 15007 }, { 23188, 15008 }, { -20845, 15009 }, { -20852, 15010 },
+    { -20859, 15011 }, { 23179, 15012 }, { -20876, 15013 }, { -20883, 15014 },
+    { -20890, 15015 }, { -20897, 15016 }, { -20904, 15017 }, { 23192, 15018 },
+    { -20921, 15019 }, { 23213, 15020 }, { -20945, 15021 }, { 23215, 15022 },
+    { -20965, 15023 }, { -20972, 15024 }, { -20979, 15025 }, { -20986, 15026 },
+    { -20993, 15027 }, { -21000, 15028 }, { -21007, 15075 }, { -21014, 15029 },
+    { -21021, 15030 }, { -21028, 15031 }, { -21035, 15032 }, { -21042, 15038 },
+    { -21049, 15065 }, { 23168, 15033 }, { -21069, 15035 }, { -21076, 15067 },
+    { -21083, 15034 }, { -21090, 15036 }, { -21097, 15037 }, { -21104, 15039 },
+    { -21111, 15040 }, { -21118, 15041 }, { -21125, 15042 }, { -21132, 15043 },
+    { -21139, 15044 }, { 23168, 14821 }, { -21146, 15045 }, { -21153, 15046 },
+    { 23170, 14824 }, { -21160, 15047 }, { -21167, 15048 }, { -21174, 15049 },
+    { -21181, 15050 }, { -21188, 15051 }, { -21195, 15052 }, { -21202, 15053 },
+    { -21209, 15102 }, { -21216, 15054 }, { -21223, 15055 }, { -21230, 15056 },
+    { -21237, 15057 }, { -21244, 15058 }, { -21251, 15059 }, { -21258, 15060 },
+    { -21265, 15061 }, { -21272, 15062 }, { -21279, 15063 }, { -21286, 15064 },
+    { -21293, 15066 }, { -21300, 15073 }, { -21307, 15068 }, { 23206, 15069 },
+    { -21327, 15070 }, { -21338, 15071 }, { -21345, 15072 }, { -21352, 15074 },
+    { 23159, 15076 }, { -21369, 15077 }, { 23182, 15078 }, { 23216, 15079 },
+    { -21403, 15080 }, { -21410, 15081 }, { -21417, 15092 }, { -21424, 15082 },
+    { -21431, 15083 }, { -21438, 15084 }, { -21445, 15085 }, { 23169, 15086 },
+    { 23230, 15086 }, { 23278, 15086 }, { 23236, 15086 }, { 23252, 15086 },
+    { 23309, 15086 }, { -22562, 15087 }, { -22569, 15101 }, { -22576, 15088 },
+    { 23218, 15089 }, { -22614, 15090 }, { -22621, 15091 }, { -22628, 15093 },
+    { -22635, 15094 }, { -22642, 15095 }, { -22649, 15096 }, { -22669, 15097 },
+    { -22680, 15098 }, { 23230, 15099 }, { -22697, 15100 }, { -22704, 15103 },
+    { -22719, 15104 }, { -22726, 15105 }, { -22733, 15106 }, { -22764, 15107 },
+    { 23240, 15108 }, { 23196, 15109 }, { 23251, 15110 }, { -22824, 15111 },
+    { -22831, 15112 }, { 23253, 15113 }, { -22851, 15114 }, { -22870, 15115 },
+    { 23199, 15116 }, { -22898, 15117 }, { 23210, 15118 }, { 23211, 15119 },
+    { -22931, 15120 }, { -22938, 15121 }, { -22949, 15122 }, { -22960, 15123 },
+    { -22967, 15124 }, { 23215, 15125 }, { -23011, 15126 }, { -23018, 15127 },
+    { 23261, 15128 }, { -23038, 15129 }, { 23140, 14929 }, { -23045, 15130 },
+    { 23273, 15131 }, { -23074, 15132 }, { 23248, 15133 }, { -23091, 15134 },
+    { -23106, 15135 }, { -23113, 15136 }, { -23120, 15137 }, { -23127, 15138 },
+    { -23134, 15139 }, { -23145, 15140 }, { -23152, 15141 }, { 23276, 15142 },
+    { -23201, 15143 }, { -23208, 15144 }, { 23280, 15145 }, { -23225, 15146 },
+    { 23282, 15147 }, { -23245, 15148 }, { 23280, 15149 }, { -23278, 15150 },
+    { 23295, 15151 }, { 23292, 15152 }, { -23312, 15153 }, { -23331, 15154 },
+    { -23338, 15155 }, { 23266, 15156 }, { -23370, 15157 }, { -23377, 15158 },
+    { 23299, 15159 }, { 23288, 15160 }, { -23415, 15161 }, { -23422, 15162 },
+    { -23429, 15163 }, { -23440, 15164 }, { 23295, 15165 }, { -23464, 15166 },
+    { -23475, 15167 }, { -23482, 15168 }, { -23499, 15169 }, { -23506, 15170 },
+    { 23265, 15171 }, { 23267, 15172 }, { 23268, 15173 }, { -23555, 15174 },
+    { -23562, 15175 }, { -23569, 15176 }, { -23576, 15177 }, { 23312, 15178 },
+    { -23603, 15179 }, { -23610, 15180 }, { 23265, 15181 }, { -23630, 15182 },
+    { -23637, 15183 }, { -23644, 15184 }, { -23651, 15185 }, { -23658, 15186 },
+    { -23665, 15187 }, { -23672, 15188 }, { 23277, 15189 }, { -23689, 15190 },
+    { -23696, 15191 }, { -23703, 15192 }, { -23710, 15193 }, { -23717, 15194 },
+    { -23724, 15195 }, { -23731, 15196 }, { -23738, 15197 }, { -23745, 15198 },
+    { 23302, 15199 }, { -23769, 15200 }, { -23786, 15201 }, { -23793, 15202 },
+    { 23316, 15203 }, { 23318, 15204 }, { -23823, 15205 }, { -23830, 15206 },
+    { -23847, 15210 }, { -23854, 15207 }, { -23861, 15208 }, { 23323, 15209 },
+    { -23878, 15211 }, { 23284, 15212 }, { -23898, 15213 }, { -23905, 15214 },
+    { 23181, 14991 }, { -23912, 15215 }, { -23919, 15220 }, { -23926, 15245 },
+    { -23933, 15267 }, { -23940, 15216 }, { 23334, 15217 }, { -23957, 15218 },
+    { 23299, 15219 }, { -23977, 15221 }, { -23984, 15222 }, { -23991, 15223 },
+    { -23998, 15224 }, { -24005, 15225 }, { -24012, 15226 }, { -24019, 15227 },
+    { -24026, 15228 }, { -24033, 15229 }, { -24040, 15230 }, { -24047, 15231 },
+    { -24054, 15232 }, { -24061, 15233 }, { -24068, 15234 }, { -24075, 15235 },
+    { -24082, 15237 }, { -24089, 15246 }, { -24096, 15236 }, { 23312, 15238 },
+    { -24113, 15239 }, { -24136, 15240 }, { -24147, 15241 }, { 23321, 15242 },
+    { -24168, 15243 }, { -24175, 15244 }, { -24182, 15247 }, { -24189, 15248 },
+    { -24196, 15249 }, { -24203, 15250 }, { -24210, 15251 }, { -24217, 15252 },
+    { -24224, 15253 }, { -24231, 15254 }, { 23336, 15255 }, { -24248, 15256 },
+    { -24255, 15257 }, { -24262, 15258 }, { -24269, 15259 }, { -24276, 15260 },
+    { -24283, 15261 }, { -24290, 15262 }, { -24297, 15263 }, { -24304, 15264 },
+    { -24311, 15265 }, { -24318, 15266 }, { -24325, 15268 }, { -24332, 15269 },
+    { -24339, 15270 }, { -24370, 15271 }, { -24381, 15272 }, { -24392, 15273 },
+    { 23329, 15274 }, { 23344, 15275 }, { 23353, 15276 }, { -24438, 15277 },
+    { -24445, 15278 }, { 23309, 15279 }, { -24462, 15280 }, { -24469, 15281 },
+    { 23332, 15282 }, { 23327, 15283 }, { 23328, 15284 }, { -24513, 15285 },
+    { 23329, 15286 }, { -24530, 15287 }, { -24537, 15288 }, { 23337, 15289 },
+    { -24563, 15290 }, { -24570, 15291 }, { -24577, 15292 }, { -24584, 15293 },
+    { -24591, 15294 }, { -24598, 15295 }, { -24605, 15296 }, { -24612, 15297 },
+    { -24619, 15298 }, { -24650, 15299 }, { -24661, 15300 }, { -24672, 15301 },
+    { -24679, 15302 }, { -24686, 15303 }, { -24693, 15304 }, { -24700, 15305 },
+    { -24707, 15306 }, { -24714, 15307 }, { 23312, 15308 }, { -24734, 15309 },
+    { 23344, 15310 }, { -24751, 15311 }, { -24758, 15312 }, { 23329, 15313 },
+    { 23345, 15313 }, { -24785, 15314 }, { 23305, 15315 }, { -24806, 15316 },
+    { -24813, 15317 }, { -24820, 15318 }, { -24827, 15319 }, { -24834, 15338 },
+    { -24841, 15320 }, { 23203, 15088 }, { -24848, 15321 }, { -24855, 15322 },
+    { 23233, 15096 }, { -24862, 15323 }, { -24869, 15333 }, { -24876, 15324 },
+    { -24883, 15325 }, { 23331, 15326 }, { -24900, 15327 }, { -24951, 15328 },
+    { -24958, 15329 }, { -24965, 15330 }, { -24972, 15331 }, { 23210, 15107 },
+    { -24979, 15332 }, { -24986, 15359 }, { -24993, 15334 }, { -25000, 15345 },
+    { -25007, 15336 }, { -25014, 15346 }, { -25021, 15335 }, { -25028, 15337 },
+    { -25035, 15339 }, { -25042, 15340 }, { 23308, 15341 }, { -25063, 15342 },
+    { -25070, 15343 }, { -25089, 15344 }, { -25096, 15369 }, { -25103, 15347 },
+    { -25110, 15348 }, { 23353, 15349 }, { -25138, 15350 }, { 23370, 15351 },
+    { -25164, 15352 }, { -25171, 15353 }, { -25178, 15354 }, { 23342, 15355 },
+    { -25195, 15356 }, { 23325, 15357 }, { 23366, 15358 }, { -25225, 15360 },
+    { 23317, 15361 }, { 23359, 15362 }, { -25279, 15363 }, { -25286, 15364 },
+    { -25293, 15365 }, { -25300, 15366 }, { -25307, 15367 }, { -25314, 15368 },
+    { -25345, 15370 }, { -25352, 15371 }, { 23365, 15372 }, { -25372, 15373 },
+    { -25379, 15374 }, { 23358, 15375 }, { -25400, 15376 }, { -25411, 15377 },
+    { -25426, 15378 }, { 23365, 15379 }, { -25450, 15380 }, { 23365, 15381 },
+    { -25478, 15382 }, { -25485, 15383 }, { -25492, 15384 }, { -25503, 15385 },
+    { -25514, 15386 }, { 23365, 15387 }, { -25531, 15388 }, { 23375, 15389 },
+    { -25551, 15390 }, { -25558, 15391 }, { 23254, 15168 }, { -25581, 15392 },
+    { 23364, 15393 }, { -25602, 15394 }, { -25609, 15395 }, { -25626, 15396 },
+    { -25637, 15397 }, { -25644, 15398 }, { -25651, 15399 }, { -25658, 15400 },
+    { 23310, 15177 }, { -25665, 15401 }, { -25672, 15402 }, { -25679, 15403 },
+    { 23372, 15404 }, { 23378, 15405 }, { -25706, 15411 }, { 23370, 15406 },
+    { -25730, 15407 }, { 23369, 15408 }, { -25747, 15409 }, { -25758, 15410 },
+    { -25765, 15412 }, { -25772, 15413 }, { -25779, 15414 }, { -25786, 15415 },
+    { 23363, 15416 }, { 23371, 15417 }, { 23333, 15418 }, { -25833, 15419 },
+    { -25840, 15420 }, { 23371, 15421 }, { -25860, 15446 }, { 23318, 15200 },
+    { -25867, 15422 }, { -25874, 15423 }, { 23368, 15424 }, { 23342, 15425 },
+    { -25912, 15426 }, { 23320, 15206 }, { 23331, 15429 }, { -25929, 15477 },
+    { -25936, 15427 }, { -25943, 15430 }, { -25950, 15428 }, { 23350, 15431 },
+    { 23348, 15468 }, { -25977, 15432 }, { -25984, 15455 }, { -25991, 15434 },
+    { -25998, 15437 }, { 23393, 15456 }, { -26025, 15433 }, { -26032, 15435 },
+    { -26039, 15436 }, { 23342, 15438 }, { -26056, 15439 }, { -26063, 15440 },
+    { -26070, 15441 }, { -26077, 15442 }, { 23354, 15443 }, { -26094, 15444 },
+    { -26101, 15461 }, { -26108, 15445 }, { 23372, 15447 }, { -26125, 15467 },
+    { -26132, 15448 }, { -26139, 15449 }, { 23381, 15487 }, { -26156, 15450 },
+    { -26163, 15453 }, { -26170, 15469 }, { -26177, 15451 }, { -26184, 15452 },
+    { 23380, 15454 }, { -26204, 15457 }, { -26211, 15458 }, { -26218, 15459 },
+    { -26225, 15460 }, { -26232, 15463 }, { 23392, 15476 }, { -26265, 15478 },
+    { 23389, 15462 }, { -26282, 15506 }, { -26289, 15464 }, { 23392, 15465 },
+    { -26306, 15466 }, { -26313, 15470 }, { 23397, 15471 }, { 23388, 15472 },
+    { -26359, 15473 }, { -26366, 15474 }, { -26373, 15475 }, { -26380, 15479 },
+    { -26387, 15480 }, { -26394, 15481 }, { 23377, 15482 }, { -26411, 15483 },
+    { -26418, 15484 }, { -26425, 15485 }, { 23361, 15486 }, { -26442, 15491 },
+    { 23352, 15488 }, { -26459, 15489 }, { -26466, 15490 }, { -26473, 15492 },
+    { -26480, 15504 }, { 23354, 15493 }, { 23356, 15494 }, { -26518, 15495 },
+    { -26525, 15496 }, { -26532, 15497 }, { -26539, 15498 }, { 23357, 15499 },
+    { 23386, 15500 }, { -26569, 15501 }, { -26576, 15502 }, { -26583, 15503 },
+    { -26590, 15505 }, { 23403, 15507 }, { -26610, 15508 }, { -26617, 15509 },
+    { -26624, 15510 }, { 23356, 15511 }, { 23389, 15512 }, { -26654, 15513 },
+    { -26661, 15514 }, { -26672, 15515 }, { 23363, 15516 }, { 23383, 15517 },
+    { 23416, 15518 }, { 23407, 15519 }, { -26731, 15520 }, { -26738, 15521 },
+    { 23416, 15522 }, { 23410, 15523 }, { -26768, 15543 }, { -26775, 15524 },
+    { -26786, 15525 }, { -26793, 15526 }, { -26800, 15527 }, { -26807, 15528 },
+    { -26814, 15529 }, { -26831, 15530 }, { -26842, 15531 }, { 23419, 15532 },
+    { -26863, 15533 }, { -26880, 15534 }, { -26887, 15535 }, { -26894, 15536 },
+    { -26901, 15537 }, { -26908, 15538 }, { -26915, 15539 }, { -26922, 15540 },
+    { 23368, 15541 }, { 23422, 15542 }, { -26955, 15544 }, { -26962, 15545 },
+    { 23422, 15546 }, { -26983, 15547 }, { 23398, 15548 }, { 23425, 15549 },
+    { 23426, 15550 }, { 23427, 15551 }, { -27030, 15552 }, { -27037, 15553 },
+    { 23413, 15554 }, { 23403, 15555 }, { 23419, 15555 }, { -27085, 15556 },
+    { -27096, 15557 }, { -27107, 15558 }, { -27114, 15559 }, { -27121, 15560 },
+    { -27128, 15561 }, { -27135, 15562 }, { -27142, 15563 }, { -27149, 15564 },
+    { -27156, 15565 }, { -27163, 15566 }, { -27170, 15567 }, { 23426, 15568 },
+    { 23427, 15569 }, { -27213, 15570 }, { -27220, 15571 }, { -27227, 15572 },
+    { 23435, 15573 }, { -27244, 15574 }, { -27251, 15575 }, { 23435, 15576 },
+    { 23436, 15577 }, { -27282, 15578 }, { 23437, 15579 }, { -27299, 15580 },
+    { 23405, 15581 }, { -27323, 15582 }, { -27330, 15583 }, { -27337, 15584 },
+    { -27344, 15585 }, { -27351, 15586 }, { 23437, 15587 }, { -27368, 15588 },
+    { -27375, 15589 }, { -27382, 15590 }, { 23412, 15591 }, { -27399, 15592 },
+    { -27406, 15593 }, { -27413, 15594 }, { 23422, 15595 }, { -27433, 15596 },
+    { -27440, 15597 }, { -27447, 15598 }, { -27454, 15599 }, { 23435, 15600 },
+    { 23393, 15601 }, { -27490, 15602 }, { -27497, 15603 }, { -27504, 15604 },
+    { 23415, 15605 }, { -27527, 15630 }, { 23400, 15606 }, { -27554, 15607 },
+    { 23421, 15608 }, { 23400, 15609 }, { 23428, 15610 }, { -27594, 15611 },
+    { 23426, 15612 }, { 23425, 15613 }, { 23441, 15613 }, { -27644, 15614 },
+    { 23452, 15615 }, { -27664, 15616 }, { -27671, 15617 }, { 23404, 15627 },
+    { 23376, 15395 }, { -27691, 15618 }, { -27698, 15619 }, { -27705, 15620 },
+    { -27712, 15621 }, { -27719, 15622 }, { -27730, 15623 }, { 23429, 15624 },
+    { 23437, 15625 }, { 23403, 15626 }, { -27770, 15628 }, { 23419, 15629 },
+    { -27790, 15631 }, { -27797, 15632 }, { 23457, 15633 }, { -27814, 15634 },
+    { -27821, 15635 }, { 23445, 15636 }, { -27838, 15637 }, { -27845, 15638 },
+    { -27852, 15639 }, { 23409, 15640 }, { -27869, 15641 }, { -27876, 15642 },
+    { -27883, 15643 }, { -27890, 15644 }, { -27897, 15645 }, { -27904, 15646 },
+    { -27911, 15647 }, { -27918, 15648 }, { -27925, 15649 }, { -27932, 15650 },
+    { -27939, 15651 }, { -27946, 15652 }, { -27953, 15653 }, { -27960, 15654 },
+    { 23436, 15655 }, { 23452, 15655 }, { -27991, 15656 }, { 23458, 15657 },
+    { 23443, 15658 }, { -28029, 15659 }, { -28036, 15660 }, { -28051, 15661 },
+    { 23444, 15662 }, { 23445, 15663 }, { -28078, 15664 }, { 23468, 15665 },
+    { -28095, 15666 }, { -28102, 15667 }, { 23413, 15668 }, { 23454, 15669 },
+    { -28135, 15670 }, { -28142, 15671 }, { -28153, 15672 }, { -28164, 15673 },
+    { 23433, 15674 }, { -28189, 15675 }, { -28196, 15676 }, { -28207, 15677 },
+    { 23431, 15678 }, { -28246, 15679 }, { 23472, 15678 }, { 23466, 15680 },
+    { -28266, 15681 }, { -28273, 15702 }, { 23451, 15682 }, { -28290, 15683 },
+    { -28297, 15693 }, { -28304, 15684 }, { -28311, 15685 }, { -28318, 15686 },
+    { -28325, 15687 }, { -28332, 15688 }, { -28339, 15715 }, { -28346, 15689 },
+    { -28353, 15690 }, { -28360, 15691 }, { -28367, 15692 }, { -28374, 15694 },
+    { -28381, 15695 }, { -28388, 15696 }, { -28395, 15697 }, { -28402, 15698 },
+    { -28409, 15699 }, { -28416, 15700 }, { -28423, 15701 }, { -28430, 15703 },
+    { -28437, 15746 }, { -28444, 15704 }, { -28451, 15705 }, { -28458, 15706 },
+    { -28465, 15707 }, { -28472, 15708 }, { 23479, 15709 }, { -28489, 15710 },
+    { 23434, 15711 }, { -28514, 15712 }, { 23428, 15713 }, { -28531, 15714 },
+    { 23424, 15716 }, { -28557, 15717 }, { -28576, 15718 }, { -28603, 15719 },
+    { -28610, 15720 }, { -28617, 15721 }, { -28624, 15722 }, { 23471, 15723 },
+    { -28645, 15724 }, { -28652, 15725 }, { -28659, 15726 }, { -28666, 15727 },
+    { -28677, 15728 }, { 23426, 15729 }, { -28710, 15730 }, { -28717, 15731 },
+    { -28724, 15732 }, { -28731, 15733 }, { -28738, 15734 }, { -28745, 15735 },
+    { 23434, 15736 }, { -28778, 15737 }, { -28797, 15738 }, { -28808, 15739 },
+    { -28815, 15740 }, { 23464, 15741 }, { -28839, 15742 }, { -28846, 15743 },
+    { -28853, 15744 }, { -28860, 15745 }, { -28871, 15747 }, { -28878, 15748 },
+    { -28885, 15749 }, { 23477, 15750 }, { 23436, 15751 }, { -28932, 15752 },
+    { -28939, 15753 }, { 23449, 15750 }, { -28946, 15754 }, { -28953, 15755 },
+    { -28972, 15756 }, { 23392, 15529 }, { 23378, 15533 }, { -28991, 15757 },
+    { -29014, 15758 }, { -29021, 15759 }, { -29032, 15760 }, { -29039, 15761 },
+    { -29046, 15762 }, { -29053, 15763 }, { -29060, 15764 }, { -29067, 15765 },
+    { -29086, 15766 }, { 23465, 15767 }, { -29103, 15768 }, { 23488, 15769 },
+    { -29120, 15770 }, { -29127, 15771 }, { -29134, 15772 }, { -29141, 15773 },
+    { -29148, 15774 }, { -29155, 15775 }, { -29162, 15776 }, { 23471, 15777 },
+    { -29179, 15778 }, { -29186, 15779 }, { -29193, 15780 }, { -29200, 15781 },
+    { -29207, 15782 }, { 23490, 15783 }, { -29228, 15784 }, { 23441, 15785 },
+    { 23454, 15786 }, { 23486, 15787 }, { -29327, 15788 }, { 23478, 15787 },
+    { -29346, 15789 }, { -29353, 15790 }, { -29360, 15791 }, { -29371, 15792 },
+    { 23476, 15793 }, { -29391, 15794 }, { -29398, 15795 }, { -29413, 15796 },
+    { -29452, 15797 }, { 23478, 15798 }, { 23478, 15799 }, { -29485, 15800 },
+    { -29492, 15801 }, { -29499, 15802 }, { -29506, 15803 }, { -29513, 15804 },
+    { -29520, 15805 }, { -29527, 15806 }, { -29534, 15807 }, { 23492, 15808 },
+    { 23493, 15809 }, { 23494, 15810 }, { 23493, 15811 }, { -29584, 15812 },
+    { -29591, 15813 }, { -29598, 15814 }, { 23460, 15815 }, { -29647, 15816 },
+    { -29654, 15817 }, { 23510, 15815 }, { -29669, 15818 }, { -29688, 15819 },
+    { 23502, 15820 }, { 23505, 15821 }, { 23457, 15822 }, { -29742, 15823 },
+    { -29749, 15824 }, { -29756, 15825 }, { -29763, 15826 }, { -29770, 15827 },
+    { 23466, 15828 }, { -29798, 15829 }, { -29805, 15830 }, { 23445, 15630 },
+    { -29812, 15831 }, { -29823, 15832 }, { -29830, 15833 }, { -29849, 15834 },
+    { -29860, 15835 }, { -29875, 15836 }, { 23515, 15837 }, { 23467, 15838 },
+    { -29911, 15839 }, { -29918, 15840 }, { 23461, 15841 }, { 23474, 15842 },
+    { -29948, 15843 }, { -29959, 15844 }, { -29966, 15845 }, { -29973, 15846 },
+    { -29980, 15847 }, { -29987, 15848 }, { -29994, 15849 }, { -30001, 15850 },
+    { -30008, 15851 }, { 23494, 15852 }, { -30032, 15853 }, { -30039, 15854 },
+    { 23491, 15855 }, { -30060, 15856 }, { -30067, 15857 }, { -30074, 15858 },
+    { -30085, 15859 }, { 23463, 15860 }, { 23464, 15861 }, { -30112, 15862 },
+    { -30119, 15863 }, { -30126, 15864 }, { -30133, 15865 }, { -30140, 15866 },
+    { -30147, 15867 }, { -30154, 15868 }, { -30161, 15869 }, { -30168, 15870 },
+    { -30175, 15871 }, { 23468, 15872 }, { 23467, 15873 }, { -30213, 15874 },
+    { -30220, 15875 }, { 23519, 15876 }, { 23470, 15877 }, { -30260, 15878 },
+    { -30275, 15879 }, { -30302, 15880 }, { -30309, 15881 }, { -30316, 15882 },
+    { -30323, 15883 }, { -30330, 15884 }, { -30337, 15885 }, { -30344, 15886 },
+    { -30351, 15887 }, { -30358, 15888 }, { -30369, 15889 }, { -30376, 15890 },
+    { 23505, 15891 }, { 23514, 15892 }, { -30403, 15893 }, { -30410, 15894 },
+    { -30417, 15895 }, { -30424, 15896 }, { -30431, 15897 }, { -30438, 15898 },
+    { -30445, 15899 }, { 23490, 15900 }, { -30465, 15901 }, { -30472, 15902 },
+    { -30479, 15903 }, { -30486, 15904 }, { -30493, 15905 }, { -30500, 15906 },
+    { 23480, 15907 }, { -30524, 15908 }, { -30531, 15909 }, { 23514, 15910 },
+    { -30568, 15911 }, { 23473, 15912 }, { -30610, 15913 }, { -30621, 15914 },
+    { -30628, 15915 }, { -30635, 15916 }, { -30642, 15917 }, { -30649, 15918 },
+    { -30656, 15919 }, { -30663, 15920 }, { -30670, 15921 }, { -30677, 15922 },
+    { -30684, 15923 }, { -30691, 15924 }, { -30698, 15925 }, { 23478, 15926 },
+    { -30718, 15927 }, { -30725, 15928 }, { -30732, 15929 }, { -30743, 15930 },
+    { -30750, 15931 }, { -30765, 15932 }, { -30808, 15933 }, { -30815, 15934 },
+    { -30830, 15935 }, { 23522, 15936 }, { -30854, 15937 }, { -30861, 15938 },
+    { 23503, 15939 }, { -30878, 15940 }, { -30885, 15941 }, { -30892, 15942 },
+    { 23481, 15943 }, { -30912, 15944 }, { 23482, 15945 }, { 23501, 15946 },
+    { -30946, 15947 }, { 23529, 15948 }, { 23530, 15949 }, { 23515, 15950 },
+    { -30983, 15951 }, { 23526, 15952 }, { 23543, 15953 }, { 23498, 15954 },
+    { 23499, 15955 }, { -31040, 15956 }, { 23543, 15957 }, { 23536, 15958 },
+    { -31067, 15959 }, { 23530, 15960 }, { 23531, 15961 }, { 23495, 15962 },
+    { 23534, 15963 }, { 23526, 15964 }, { 23527, 15972 }, { 23512, 15965 },
+    { 23539, 15966 }, { 23545, 15967 }, { 23546, 15968 }, { -31174, 15969 },
+    { -31181, 15970 }, { -31188, 15971 }, { -31195, 15973 }, { -31202, 15974 },
+    { -31209, 15975 }, { -31216, 15976 }, { -31223, 15977 }, { -31230, 15978 },
+    { 23527, 15979 }, { -31295, 15980 }, { -31302, 15981 }, { 23505, 15982 },
+    { 23553, 15983 }, { -31338, 15984 }, { -31345, 15985 }, { -31352, 15986 },
+    { -31359, 15987 }, { 23554, 15988 }, { 23507, 15989 }, { 23537, 15990 },
+    { -31399, 15991 }, { -31406, 15992 }, { 23548, 15993 }, { -31423, 15994 },
+    { -31430, 15995 }, { -31437, 15996 }, { 23506, 15997 }, { 23561, 15998 },
+    { -31470, 15999 }, { -31477, 16000 }, { 23557, 16001 }, { 23520, 16002 },
+    { -31546, 16003 }, { -31557, 16004 }, { -31564, 16005 }, { -31571, 16006 },
+    { -31578, 16007 }, { -31585, 16059 }, { -31592, 16008 }, { -31599, 16009 },
+    { -31606, 16010 }, { -31613, 16011 }, { -31620, 16012 }, { 23543, 16013 },
+    { -31640, 16014 }, { -31647, 16015 }, { -31654, 16016 }, { -31661, 16017 },
+    { -31668, 16039 }, { -31675, 16018 }, { -31682, 16022 }, { 23558, 16019 },
+    { 23545, 16020 }, { -31715, 16021 }, { -31722, 16023 }, { 23537, 16024 },
+    { -31742, 16025 }, { -31749, 16026 }, { 23562, 16027 }, { -31769, 16028 },
+    { -31776, 16029 }, { -31783, 16030 }, { -31790, 16031 }, { 23534, 16032 },
+    { -31810, 16033 }, { -31817, 16034 }, { -31824, 16035 }, { -31831, 16036 },
+    { -31838, 16087 }, { -31845, 16037 }, { -31865, 16038 }, { -31872, 16049 },
+    { -31879, 16040 }, { -31886, 16041 }, { -31893, 16042 }, { -31900, 16044 },
+    { -31907, 16088 }, { -31914, 16043 }, { -31921, 16045 }, { -31928, 16046 },
+    { 23573, 16047 }, { -31945, 16048 }, { -31952, 16050 }, { -31959, 16051 },
+    { -31966, 16052 }, { 23559, 16053 }, { -31986, 16054 }, { -32013, 16055 },
+    { -32020, 16056 }, { -32027, 16057 }, { -32034, 16058 }, { 23528, 16060 },
+    { 23574, 16061 }, { -32111, 16062 }, { -32118, 16063 }, { -32125, 16064 },
+    { -32132, 16065 }, { -32139, 16066 }, { -32146, 16067 }, { -32153, 16068 },
+    { -32164, 16069 }, { -32179, 16070 }, { 23535, 16071 }, { 23550, 16072 },
+    { 23566, 16072 }, { -32231, 16073 }, { -32238, 16074 }, { -32249, 16075 },
+    { -32260, 16076 }, { -32267, 16077 }, { -32274, 16078 }, { -32289, 16079 },
+    { -32300, 16080 }, { -32307, 16081 }, { -32314, 16082 }, { 23529, 16083 },
+    { -32334, 16084 }, { -32349, 16085 }, { -32370, 16086 }, { -32389, 16089 },
+    { -32400, 16090 }, { -32411, 16091 }, { -32426, 16092 }, { -32433, 16093 },
+    { 23558, 16094 }, { 23570, 16095 }, { 23571, 16096 }, { -32474, 16097 },
+    { -32481, 16098 }, { -32492, 16099 }, { -32499, 16100 }, { -32506, 16101 },
+    { -32513, 16102 }, { -32520, 16103 }, { -32527, 16104 }, { 23475, 15875 },
+    { -32534, 16105 }, { -32541, 16106 }, { -32548, 16107 }, { -32555, 16108 },
+    { -32562, 16109 }, { -32569, 16110 }, { 23562, 16111 }, { -32586, 16112 },
+    { -32609, 16113 }, { -32616, 16114 }, { -32631, 16115 }, { -32638, 16116 },
+    { -32645, 16117 }, { -32660, 16118 }, { 23535, 16119 }, { 23578, 16161 },
+    { 23548, 16119 }, { -32715, 16120 }, { 23579, 16121 }, { 23580, 16122 },
+    { -32742, 16123 }, { -32753, 16124 }, { -32776, 16125 }, { 23540, 16126 },
+    { -32796, 16127 }, { -32803, 16128 }, { 23552, 16129 }, { -32820, 16130 },
+    { -32827, 16131 }, { -32834, 16132 }, { -32841, 16133 }, { -32848, 16134 },
+    { -32855, 16135 }, { -32862, 16136 }, { -32869, 16137 }, { -32876, 16138 },
+    { 23561, 16139 }, { -32900, 16140 }, { -32911, 16141 }, { 23584, 16142 },
+    { -32935, 16143 }, { -32942, 16144 }, { 23571, 16145 }, { -32963, 16146 },
+    { 23586, 16147 }, { -32984, 16148 }, { 23595, 16149 }, { -33001, 16160 },
+    { -33008, 16150 }, { 23590, 16151 }, { 23571, 16152 }, { 23587, 16152 },
+    { -33065, 16153 }, { 23545, 16154 }, { 23578, 16155 }, { 23583, 16156 },
+    { -33117, 16157 }, { 23552, 16158 }, { -33157, 16159 }, { -33180, 16162 },
+    { 23602, 16163 }, { -33220, 16164 }, { -33231, 16165 }, { 23562, 16166 },
+    { 23596, 16167 }, { -33258, 16168 }, { -33265, 16169 }, { -33288, 16170 },
+    { 23553, 16171 }, { -33324, 16172 }, { -33335, 16173 }, { 23558, 16174 },
+    { 23601, 16216 }, { 23571, 16174 }, { -33378, 16175 }, { 23602, 16176 },
+    { 23603, 16177 }, { -33413, 16178 }, { -33424, 16179 }, { -33435, 16180 },
+    { -33454, 16181 }, { -33465, 16182 }, { -33472, 16183 }, { -33479, 16184 },
+    { 23590, 16185 }, { 23615, 16186 }, { 23592, 16187 }, { -33516, 16188 },
+    { -33523, 16189 }, { 23604, 16190 }, { -33540, 16191 }, { -33547, 16192 },
+    { -33554, 16193 }, { -33561, 16194 }, { -33568, 16195 }, { -33575, 16196 },
+    { 23608, 16197 }, { 23569, 16198 }, { -33609, 16199 }, { 23592, 16200 },
+    { 23608, 16200 }, { -33636, 16201 }, { 23609, 16202 }, { 23599, 16203 },
+    { -33663, 16204 }, { -33670, 16205 }, { -33677, 16206 }, { 23596, 16207 },
+    { -33698, 16208 }, { -33709, 16209 }, { -33716, 16210 }, { -33727, 16211 },
+    { -33734, 16212 }, { -33741, 16213 }, { -33784, 16214 }, { -33795, 16215 },
+    { -33802, 16217 }, { -33809, 16218 }, { -33816, 16219 }, { -33823, 16220 },
+    { -33830, 16221 }, { -33845, 16222 }, { -33856, 16223 }, { -33863, 16224 },
+    { -33870, 16225 }, { 23611, 16226 }, { 23602, 16227 }, { -33955, 16228 },
+    { -33962, 16229 }, { -33969, 16230 }, { -33976, 16235 }, { 23603, 16231 },
+    { -33993, 16232 }, { 23633, 16233 }, { -34013, 16234 }, { -34020, 16236 },
+    { -34027, 16237 }, { -34034, 16238 }, { 23621, 16239 }, { -34054, 16240 },
+    { 23628, 16241 }, { 23622, 16242 }, { 23580, 16243 }, { -34094, 16244 },
+    { 23630, 16245 }, { -34111, 16246 }, { 23625, 16247 }, { -34138, 16248 },
+    { 23580, 16249 }, { -34158, 16250 }, { -34165, 16251 }, { -34172, 16252 },
+    { 23628, 16253 }, { -34193, 16254 }, { -34200, 16255 }, { -34207, 16256 },
+    { 23619, 16257 }, { -34244, 16258 }, { -34251, 16259 }, { 23620, 16257 },
+    { -34262, 16260 }, { -34269, 16261 }, { 23521, 16037 }, { -34284, 16262 },
+    { -34291, 16263 }, { 23645, 16264 }, { -34318, 16265 }, { -34325, 16266 },
+    { -34340, 16267 }, { -34347, 16268 }, { -34358, 16269 }, { -34365, 16270 },
+    { -34372, 16271 }, { -34379, 16272 }, { -34386, 16273 }, { 23631, 16274 },
+    { -34406, 16275 }, { -34413, 16276 }, { -34420, 16277 }, { -34427, 16278 },
+    { 23614, 16279 }, { 23630, 16279 }, { -34454, 16280 }, { 23616, 16281 },
+    { 23632, 16281 }, { -34494, 16282 }, { -34501, 16283 }, { -34508, 16284 },
+    { -34515, 16285 }, { -34526, 16286 }, { -34533, 16287 }, { 23644, 16288 },
+    { 23645, 16289 }, { -34560, 16290 }, { -34567, 16291 }, { 23610, 16292 },
+    { -34587, 16293 }, { 23646, 16294 }, { -34604, 16295 }, { 23594, 16296 },
+    { 23644, 16297 }, { 23634, 16298 }, { 23600, 16299 }, { -34669, 16300 },
+    { 23626, 16301 }, { 23642, 16301 }, { 23628, 16302 }, { 23644, 16302 },
+    { -34737, 16303 }, { -34744, 16304 }, { -34751, 16305 }, { -34762, 16306 },
+    { -34769, 16307 }, { -34776, 16308 }, { 23568, 16085 }, { -34783, 16309 },
+    { -34790, 16310 }, { 23630, 16311 }, { 23646, 16311 }, { -34817, 16312 },
+    { 23608, 16313 }, { -34854, 16314 }, { -34861, 16315 }, { -34880, 16316 },
+    { 23638, 16317 }, { -34925, 16318 }, { -34932, 16319 }, { -34943, 16320 },
+    { -34954, 16321 }, { -34969, 16322 }, { -34980, 16323 }, { -34987, 16324 },
+    { -34994, 16325 }, { -35001, 16326 }, { -35008, 16327 }, { -35019, 16328 },
+    { -35026, 16329 }, { -35033, 16330 }, { -35040, 16331 }, { -35047, 16332 },
+    { -35054, 16333 }, { -35065, 16334 }, { -35072, 16335 }, { -35095, 16336 },
+    { -35102, 16337 }, { -35121, 16338 }, { -35128, 16339 }, { 23660, 16340 },
+    { -35145, 16341 }, { -35152, 16342 }, { -35163, 16343 }, { 23611, 16344 },
+    { 23662, 16345 }, { -35197, 16346 }, { -35204, 16347 }, { 23663, 16348 },
+    { 23664, 16349 }, { -35231, 16350 }, { 23667, 16351 }, { 23617, 16352 },
+    { -35278, 16353 }, { -35285, 16354 }, { -35292, 16355 }, { -35299, 16356 },
+    { 23673, 16352 }, { -35306, 16357 }, { 23638, 16358 }, { 23661, 16359 },
+    { -35356, 16360 }, { -35363, 16361 }, { -35383, 16362 }, { -35394, 16363 },
+    { -35405, 16364 }, { -35428, 16365 }, { -35435, 16366 }, { -35442, 16367 },
+    { -35449, 16368 }, { 23619, 16369 }, { 23644, 16370 }, { -35496, 16371 },
+    { 23624, 16372 }, { 23625, 16373 }, { -35529, 16374 }, { 23626, 16375 },
+    { -35549, 16376 }, { -35566, 16377 }, { -35573, 16378 }, { 23670, 16379 },
+    { -35605, 16380 }, { -35612, 16381 }, { -35619, 16382 }, { 23678, 16383 },
+    { -35660, 16384 }, { 23627, 16385 }, { -35689, 16386 }, { -35700, 16387 },
+    { 23637, 16388 }, { -35724, 16389 }, { -35731, 16390 }, { -35738, 16391 },
+    { -35745, 16392 }, { -35752, 16393 }, { 23631, 16394 }, { -35772, 16395 },
+    { -35787, 16396 }, { 23666, 16397 }, { 23656, 16398 }, { -35844, 16399 },
+    { -35851, 16400 }, { -35858, 16401 }, { -35865, 16402 }, { -35872, 16403 },
+    { -35879, 16404 }, { -35886, 16405 }, { -35893, 16406 }, { -35900, 16407 },
+    { -35907, 16408 }, { -35914, 16409 }, { -35921, 16410 }, { -35928, 16411 },
+    { -35947, 16412 }, { -35962, 16413 }, { -35969, 16414 }, { -35976, 16415 },
+    { -35983, 16416 }, { -35994, 16417 }, { -36001, 16418 }, { 23628, 16419 },
+    { -36018, 16420 }, { -36025, 16421 }, { -36032, 16422 }, { -36039, 16423 },
+    { 23629, 16424 }, { -36100, 16425 }, { -36111, 16426 }, { 23634, 16427 },
+    { 23649, 16428 }, { -36153, 16429 }, { 23675, 16430 }, { -36193, 16431 },
+    { -36200, 16432 }, { -36207, 16433 }, { -36214, 16434 }, { -36221, 16435 },
+    { -36228, 16436 }, { -36235, 16437 }, { 23645, 16438 }, { -36263, 16439 },
+    { -36270, 16440 }, { -36277, 16452 }, { -36284, 16488 }, { -36291, 16441 },
+    { 23691, 16442 }, { -36321, 16467 }, { -36328, 16443 }, { -36335, 16444 },
+    { -36342, 16494 }, { -36349, 16445 }, { -36356, 16446 }, { -36363, 16447 },
+    { -36370, 16448 }, { -36377, 16449 }, { -36384, 16457 }, { -36391, 16450 },
+    { -36398, 16482 }, { -36405, 16451 }, { -36412, 16453 }, { 23686, 16454 },
+    { -36432, 16455 }, { -36439, 16456 }, { -36446, 16458 }, { -36453, 16459 },
+    { -36464, 16460 }, { -36491, 16461 }, { 23645, 16462 }, { -36511, 16463 },
+    { -36518, 16464 }, { -36525, 16465 }, { 23606, 16246 }, { 23643, 16466 },
+    { -36545, 16468 }, { -36552, 16469 }, { -36563, 16470 }, { 23645, 16471 },
+    { -36580, 16472 }, { -36587, 16473 }, { -36594, 16474 }, { -36609, 16475 },
+    { -36616, 16476 }, { -36623, 16477 }, { -36634, 16478 }, { 23653, 16479 },
+    { 23684, 16480 }, { -36667, 16481 }, { -36682, 16483 }, { -36689, 16484 },
+    { -36704, 16485 }, { -36727, 16486 }, { -36750, 16487 }, { -36773, 16489 },
+    { -36784, 16490 }, { -36803, 16491 }, { -36850, 16492 }, { 23660, 16493 },
+    { 23692, 16495 }, { -36888, 16496 }, { -36895, 16497 }, { 23650, 16498 },
+    { -36956, 16499 }, { -36971, 16500 }, { 23693, 16527 }, { -36991, 16501 },
+    { -36998, 16502 }, { -37005, 16503 }, { -37012, 16504 }, { -37023, 16505 },
+    { -37038, 16506 }, { 23707, 16507 }, { -37079, 16508 }, { -37106, 16509 },
+    { -37113, 16510 }, { -37120, 16511 }, { -37127, 16512 }, { -37134, 16520 },
+    { -37141, 16513 }, { -37148, 16514 }, { -37155, 16515 }, { -37162, 16516 },
+    { -37169, 16517 }, { -37176, 16518 }, { -37183, 16519 }, { -37190, 16521 },
+    { -37221, 16522 }, { -37260, 16523 }, { -37275, 16524 }, { -37282, 16525 },
+    { -37289, 16526 }, { -37296, 16528 }, { 23695, 16529 }, { -37316, 16530 },
+    { -37323, 16531 }, { -37330, 16532 }, { 23654, 16533 }, { -37371, 16534 },
+    { -37382, 16535 }, { -37429, 16536 }, { -37468, 16537 }, { -37475, 16538 },
+    { -37494, 16539 }, { -37501, 16540 }, { -37508, 16541 }, { -37515, 16542 },
+    { -37546, 16543 }, { -37557, 16544 }, { -37564, 16545 }, { -37579, 16546 },
+    { -37622, 16547 }, { -37685, 16548 }, { -37692, 16549 }, { -37699, 16550 },
+    { 23705, 16551 }, { -37739, 16552 }, { -37746, 16553 }, { -37753, 16554 },
+    { -37760, 16555 }, { -37767, 16556 }, { -37774, 16557 }, { -37789, 16558 },
+    { -37796, 16559 }, { -37803, 16560 }, { -37814, 16561 }, { -37821, 16562 },
+    { -37828, 16563 }, { -37835, 16564 }, { -37842, 16565 }, { -37849, 16566 },
+    { -37866, 16567 }, { -37873, 16568 }, { 23697, 16569 }, { -37890, 16570 },
+    { -37897, 16571 }, { 23708, 16572 }, { -37914, 16573 }, { -37921, 16574 },
+    { -37928, 16575 }, { -37939, 16576 }, { -37974, 16577 }, { -37981, 16578 },
+    { 23688, 16579 }, { -38010, 16580 }, { -38017, 16581 }, { -38024, 16582 },
+    { 23689, 16583 }, { -38041, 16584 }, { -38048, 16585 }, { -38059, 16586 },
+    { -38070, 16587 }, { 23697, 16588 }, { 23716, 16589 }, { -38107, 16590 },
+    { -38118, 16591 }, { -38141, 16592 }, { -38148, 16593 }, { 23653, 16361 },
+    { 23714, 16594 }, { -38169, 16595 }, { -38180, 16596 }, { -38187, 16597 },
+    { -38194, 16598 }, { -38201, 16599 }, { -38208, 16600 }, { 23676, 16601 },
+    { -38225, 16602 }, { -38232, 16603 }, { 23720, 16604 }, { -38252, 16605 },
+    { -38259, 16606 }, { 23670, 16376 }, { -38266, 16608 }, { -38289, 16607 },
+    { 23716, 16609 }, { -38306, 16610 }, { -38317, 16611 }, { -38324, 16612 },
+    { 23688, 16613 }, { -38349, 16614 }, { -38356, 16615 }, { 23721, 16616 },
+    { -38373, 16617 }, { -38380, 16618 }, { -38387, 16619 }, { -38394, 16620 },
+    { -38401, 16621 }, { -38408, 16622 }, { -38415, 16623 }, { -38422, 16639 },
+    { -38429, 16624 }, { 23720, 16625 }, { -38454, 16626 }, { -38473, 16627 },
+    { -38480, 16628 }, { -38491, 16629 }, { 23700, 16630 }, { 23670, 16631 },
+    { -38536, 16632 }, { -38543, 16633 }, { -38550, 16634 }, { -38557, 16635 },
+    { -38564, 16636 }, { -38571, 16637 }, { -38582, 16638 }, { -38605, 16640 },
+    { -38612, 16641 }, { -38623, 16642 }, { -38630, 16643 }, { 23673, 16644 },
+    { -38650, 16645 }, { 23725, 16646 }, { -38670, 16647 }, { -38677, 16648 },
+    { 23713, 16649 }, { 23672, 16650 }, { -38711, 16651 }, { -38718, 16652 },
+    { -38725, 16653 }, { -38732, 16654 }, { 23687, 16655 }, { -38752, 16676 },
+    { 23680, 16656 }, { -38824, 16657 }, { 23716, 16656 }, { -38831, 16658 },
+    { 23733, 16659 }, { 23740, 16660 }, { 23678, 16661 }, { -38877, 16662 },
+    { 23727, 16663 }, { -38897, 16664 }, { 23680, 16665 }, { 23695, 16666 },
+    { 23641, 16441 }, { -38930, 16667 }, { -38937, 16668 }, { 23731, 16669 },
+    { -38962, 16670 }, { -38973, 16671 }, { -38980, 16672 }, { -38991, 16673 },
+    { -39002, 16674 }, { -39013, 16675 }, { -39020, 16677 }, { 23690, 16678 },
+    { -39048, 16679 }, { -39055, 16680 }, { -39066, 16681 }, { -39085, 16682 },
+    { -39092, 16683 }, { 23700, 16684 }, { 23689, 16685 }, { 23742, 16686 },
+    { -39135, 16687 }, { -39142, 16688 }, { 23734, 16689 }, { -39186, 16690 },
+    { 23671, 16460 }, { -39193, 16691 }, { -39200, 16692 }, { -39215, 16693 },
+    { -39222, 16694 }, { -39229, 16695 }, { -39236, 16696 }, { -39243, 16697 },
+    { -39250, 16698 }, { -39261, 16699 }, { -39272, 16700 }, { 23696, 16701 },
+    { -39289, 16702 }, { -39296, 16703 }, { -39303, 16704 }, { -39310, 16705 },
+    { 23691, 16706 }, { -39330, 16707 }, { -39337, 16708 }, { -39344, 16709 },
+    { -39351, 16710 }, { -39358, 16711 }, { -39369, 16712 }, { -39396, 16713 },
+    { -39403, 16714 }, { -39410, 16715 }, { -39417, 16716 }, { 23746, 16717 },
+    { -39438, 16718 }, { -39445, 16719 }, { -39452, 16750 }, { -39463, 16720 },
+    { -39470, 16721 }, { -39477, 16722 }, { 23725, 16723 }, { -39522, 16724 },
+    { -39529, 16725 }, { -39536, 16726 }, { -39543, 16727 }, { -39550, 16728 },
+    { 23742, 16729 }, { 23729, 16730 }, { -39583, 16731 }, { -39590, 16732 },
+    { -39597, 16733 }, { -39604, 16734 }, { -39611, 16760 }, { -39618, 16735 },
+    { -39641, 16736 }, { -39652, 16737 }, { -39683, 16738 }, { -39690, 16775 },
+    { -39697, 16739 }, { 23740, 16740 }, { -39730, 16741 }, { 23735, 16740 },
+    { -39737, 16742 }, { -39744, 16743 }, { 23714, 16797 }, { -39764, 16744 },
+    { -39771, 16745 }, { -39778, 16746 }, { -39785, 16747 }, { -39792, 16748 },
+    { -39799, 16749 }, { -39806, 16751 }, { -39813, 16752 }, { -39820, 16753 },
+    { -39827, 16754 }, { -39834, 16755 }, { -39841, 16756 }, { -39848, 16757 },
+    { -39855, 16758 }, { -39862, 16759 }, { -39869, 16761 }, { -39876, 16762 },
+    { -39883, 16763 }, { -39890, 16764 }, { 23711, 16765 }, { -39907, 16774 },
+    { -39914, 16766 }, { -39921, 16767 }, { -39928, 16768 }, { -39935, 16769 },
+    { -39942, 16770 }, { -39949, 16804 }, { -39956, 16771 }, { -39963, 16772 },
+    { -39970, 16773 }, { -39977, 16776 }, { -39984, 16777 }, { -39991, 16778 },
+    { -39998, 16779 }, { -40005, 16780 }, { -40012, 16781 }, { -40019, 16782 },
+    { -40026, 16783 }, { -40033, 16784 }, { -40040, 16785 }, { -40047, 16786 },
+    { -40054, 16787 }, { -40061, 16788 }, { -40068, 16789 }, { -40075, 16790 },
+    { -40082, 16791 }, { 23711, 16566 }, { -40089, 16792 }, { -40096, 16808 },
+    { -40103, 16793 }, { -40110, 16794 }, { -40117, 16795 }, { -40124, 16796 },
+    { 23757, 16798 }, { -40141, 16799 }, { 23707, 16800 }, { -40162, 16801 },
+    { 23758, 16802 }, { -40218, 16803 }, { -40225, 16805 }, { -40232, 16806 },
+    { 23749, 16807 }, { 23708, 16809 }, { -40263, 16810 }, { -40288, 16811 },
+    { -40299, 16812 }, { -40310, 16813 }, { -40321, 16814 }, { 23764, 16815 },
+    { -40338, 16816 }, { 23711, 16817 }, { 23721, 16818 }, { -40372, 16819 },
+    { -40395, 16820 }, { 23709, 16821 }, { -40412, 16822 }, { -40419, 16823 },
+    { 23748, 16824 }, { 23745, 16825 }, { 23760, 16826 }, { -40459, 16831 },
+    { -40466, 16827 }, { -40473, 16828 }, { -40480, 16829 }, { -40487, 16830 },
+    { -40494, 16832 }, { -40501, 16833 }, { 23767, 16834 }, { 23716, 16834 },
+    { -40534, 16835 }, { -40541, 16836 }, { -40548, 16837 }, { -40555, 16838 },
+    { -40562, 16839 }, { -40569, 16840 }, { -40576, 16841 }, { -40583, 16842 },
+    { -40594, 16843 }, { -40621, 16844 }, { -40628, 16845 }, { 23747, 16846 },
+    { 23748, 16847 }, { 23749, 16848 }, { -40696, 16849 }, { -40703, 16855 },
+    { -40710, 16850 }, { -40717, 16851 }, { -40728, 16852 }, { 23734, 16853 },
+    { -40752, 16854 }, { -40763, 16856 }, { -40770, 16857 }, { -40793, 16858 },
+    { 23753, 16859 }, { -40841, 16860 }, { 23772, 16861 }, { 23745, 16862 },
+    { -40898, 16863 }, { 23770, 16864 }, { -40919, 16865 }, { -40946, 16866 },
+    { -40953, 16867 }, { -40960, 16868 }, { 23736, 16869 }, { -40992, 16870 },
+    { -40999, 16871 }, { 23755, 16872 }, { -41035, 16873 }, { -41050, 16874 },
+    { -41057, 16875 }, { -41064, 16876 }, { -41071, 16877 }, { -41082, 16878 },
+    { 23772, 16879 }, { -41099, 16880 }, { 23763, 16881 }, { -41127, 16882 },
+    { -41134, 16883 }, { 23775, 16884 }, { -41151, 16885 }, { -41158, 16886 },
+    { -41165, 16887 }, { -41172, 16888 }, { -41179, 16889 }, { -41186, 16890 },
+    { -41193, 16891 }, { -41200, 16892 }, { -41207, 16893 }, { -41214, 16894 },
+    { -41221, 16895 }, { 23775, 16896 }, { -41254, 16897 }, { 23745, 16898 },
+    { -41271, 16899 }, { -41278, 16900 }, { -41285, 16901 }, { -41292, 16902 },
+    { -41299, 16903 }, { -41306, 16904 }, { -41317, 16905 }, { -41336, 16906 },
+    { -41343, 16907 }, { -41350, 16908 }, { 23730, 16909 }, { 23787, 16909 },
+    { -41426, 16910 }, { 23733, 16909 }, { -41433, 16911 }, { 23770, 16909 },
+    { -41444, 16912 }, { -41451, 16913 }, { -41462, 16914 }, { -41485, 16915 },
+    { -41500, 16916 }, { -41507, 16917 }, { 23777, 16918 }, { -41524, 16919 },
+    { -41531, 16920 }, { -41538, 16921 }, { -41545, 16922 }, { -41552, 16923 },
+    { 23788, 16924 }, { -41569, 16925 }, { -41576, 16926 }, { 23768, 16927 },
+    { -41593, 16928 }, { 23759, 16929 }, { 23790, 16930 }, { -41634, 16931 },
+    { -41645, 16932 }, { 23794, 16933 }, { -41710, 16934 }, { 23741, 16935 },
+    { 23790, 16936 }, { -41744, 16937 }, { -41751, 16938 }, { -41762, 16939 },
+    { -41773, 16940 }, { 23804, 16941 }, { 23805, 16942 }, { -41806, 16943 },
+    { 23748, 16944 }, { -41831, 16945 }, { 23789, 16946 }, { 23790, 16947 },
+    { 23791, 16948 }, { -41868, 16949 }, { 23777, 16950 }, { -41893, 16951 },
+    { -41908, 16952 }, { 23758, 16953 }, { -42000, 16954 }, { -42051, 16955 },
+    { -42090, 16956 }, { -42097, 16957 }, { -42104, 16958 }, { -42123, 16959 },
+    { -42142, 16960 }, { -42153, 16961 }, { -42160, 16962 }, { -42175, 16963 },
+    { -42182, 16964 }, { -42189, 16965 }, { -42196, 16966 }, { -42215, 16967 },
+    { -42222, 16968 }, { 23784, 16969 }, { -42286, 16970 }, { 23800, 16971 },
+    { -42310, 16972 }, { -42337, 16973 }, { -42348, 16974 }, { 23756, 16975 },
+    { -42365, 16976 }, { -42388, 16977 }, { -42407, 16978 }, { 23810, 16979 },
+    { -42439, 16980 }, { -42450, 16981 }, { -42481, 16982 }, { -42488, 16983 },
+    { 23790, 16984 }, { -42525, 16985 }, { -42532, 16986 }, { -42539, 16987 },
+    { -42566, 16988 }, { -42581, 16989 }, { 23801, 16990 }, { -42726, 16991 },
+    { 23793, 16992 }, { -42786, 16993 }, { -42793, 16994 }, { 23773, 16995 },
+    { -42813, 16996 }, { -42820, 17009 }, { -42827, 16997 }, { -42834, 16998 },
+    { -42841, 16999 }, { -42848, 17000 }, { -42855, 17001 }, { -42862, 17002 },
+    { -42869, 17003 }, { -42876, 17004 }, { -42883, 17005 }, { -42890, 17013 },
+    { -42897, 17006 }, { -42904, 17007 }, { -42911, 17008 }, { -42918, 17010 },
+    { -42925, 17011 }, { 23760, 17012 }, { 23784, 17016 }, { -42958, 17014 },
+    { -42965, 17015 }, { -42972, 17017 }, { -42979, 17018 }, { -42986, 17019 },
+    { -43003, 17020 }, { -43010, 17021 }, { -43017, 17022 }, { -43024, 17023 },
+    { 23771, 17024 }, { -43072, 17025 }, { -43095, 17026 }, { -43110, 17027 },
+    { 23780, 17028 }, { -43139, 17029 }, { -43178, 17030 }, { -43185, 17031 },
+    { -43192, 17032 }, { -43215, 17033 }, { -43230, 17034 }, { -43249, 17035 },
+    { 23709, 16810 }, { -43296, 17036 }, { -43319, 17037 }, { -43326, 17038 },
+    { -43333, 17039 }, { -43352, 17040 }, { 23766, 17041 }, { -43420, 17042 },
+    { -43427, 17043 }, { -43434, 17044 }, { -43454, 17045 }, { -43461, 17046 },
+    { -43468, 17047 }, { -43475, 17048 }, { -43482, 17067 }, { -43489, 17049 },
+    { -43496, 17050 }, { -43503, 17051 }, { -43510, 17052 }, { -43517, 17053 },
+    { -43524, 17054 }, { -43543, 17055 }, { -43554, 17056 }, { 23776, 17057 },
+    { 23812, 17058 }, { -43588, 17059 }, { 23813, 17060 }, { 23819, 17061 },
+    { -43619, 17062 }, { 23796, 17063 }, { -43636, 17064 }, { -43643, 17065 },
+    { 23803, 17066 }, { -43668, 17068 }, { -43687, 17069 }, { -43694, 17070 },
+    { -43705, 17071 }, { 23785, 17072 }, { -43725, 17073 }, { -43732, 17074 },
+    { -43795, 17075 }, { -43814, 17076 }, { 23827, 17077 }, { 23828, 17078 },
+    { -43845, 17079 }, { -43860, 17080 }, { -43871, 17081 }, { -43886, 17082 },
+    { -43893, 17083 }, { 23823, 17084 }, { -43921, 17085 }, { -43928, 17086 },
+    { -43979, 17087 }, { 23808, 17088 }, { -44115, 17089 }, { -44122, 17090 },
+    { -44129, 17091 }, { -44136, 17092 }, { -44143, 17093 }, { -44150, 17094 },
+    { -44157, 17111 }, { -44164, 17095 }, { -44171, 17096 }, { -44178, 17097 },
+    { -44185, 17098 }, { -44192, 17099 }, { -44199, 17119 }, { -44206, 17100 },
+    { 23779, 17101 }, { -44230, 17102 }, { -44241, 17103 }, { -44256, 17104 },
+    { -44271, 17105 }, { -44282, 17106 }, { 23810, 17107 }, { 23836, 17108 },
+    { -44330, 17109 }, { 23834, 17108 }, { -44341, 17110 }, { -44348, 17112 },
+    { -44355, 17113 }, { -44366, 17114 }, { 23786, 17115 }, { -44393, 17116 },
+    { -44410, 17117 }, { -44417, 17118 }, { -44428, 17120 }, { 23837, 17121 },
+    { -44452, 17122 }, { 23790, 17123 }, { -44480, 17124 }, { -44487, 17125 },
+    { -44494, 17126 }, { -44501, 17127 }, { 23821, 17128 }, { 23836, 17129 },
+    { -44543, 17130 }, { -44550, 17131 }, { 23837, 17132 }, { -44571, 17133 },
+    { -44578, 17134 }, { 23838, 17135 }, { -44599, 17136 }, { -44614, 17137 },
+    { 23796, 17138 }, { -44631, 17139 }, { -44642, 17140 }, { -44649, 17141 },
+    { -44656, 17142 }, { -44663, 17143 }, { 23824, 17144 }, { 23832, 17145 },
+    { -44706, 17146 }, { -44731, 17147 }, { 23811, 17145 }, { -44738, 17148 },
+    { 23839, 17149 }, { -44759, 17150 }, { -44766, 17151 }, { -44777, 17152 },
+    { -44784, 17153 }, { 23845, 17154 }, { 23802, 17155 }, { 23858, 17156 },
+    { -44835, 17157 }, { -44852, 17158 }, { -44859, 17159 }, { -44866, 17160 },
+    { 23804, 17161 }, { -44903, 17162 }, { -44910, 17163 }, { -44917, 17164 },
+    { -44924, 17169 }, { -44931, 17165 }, { 23807, 17166 }, { -44951, 17167 },
+    { -44958, 17168 }, { -44965, 17170 }, { -44972, 17171 }, { -44979, 17172 },
+    { -44986, 17173 }, { -44993, 17174 }, { -45000, 17175 }, { -45007, 17176 },
+    { -45014, 17177 }, { 23814, 17178 }, { -45031, 17179 }, { -45038, 17180 },
+    { -45045, 17181 }, { -45052, 17182 }, { -45059, 17183 }, { -45066, 17184 },
+    { -45073, 17185 }, { -45080, 17186 }, { -45087, 17187 }, { -45094, 17188 },
+    { -45101, 17189 }, { -45108, 17190 }, { -45115, 17191 }, { -45187, 17192 },
+    { -45194, 17193 }, { -45201, 17203 }, { -45208, 17194 }, { -45215, 17195 },
+    { -45222, 17196 }, { 23810, 17197 }, { 23864, 17198 }, { -45265, 17199 },
+    { -45280, 17200 }, { -45291, 17201 }, { 23812, 17202 }, { -45308, 17204 },
+    { 23814, 17205 }, { -45328, 17206 }, { -45335, 17207 }, { -45342, 17208 },
+    { -45349, 17209 }, { -45356, 17210 }, { -45363, 17211 }, { 23843, 17212 },
+    { -45384, 17213 }, { -45407, 17214 }, { -45414, 17215 }, { -45421, 17216 },
+    { -45428, 17217 }, { -45435, 17264 }, { -45442, 17218 }, { -45449, 17219 },
+    { -45456, 17220 }, { -45463, 17221 }, { -45470, 17222 }, { -45477, 17223 },
+    { -45484, 17229 }, { -45491, 17224 }, { -45498, 17225 }, { -45505, 17226 },
+    { -45512, 17227 }, { -45519, 17228 }, { -45526, 17230 }, { -45533, 17231 },
+    { -45540, 17232 }, { -45547, 17233 }, { -45554, 17234 }, { -45561, 17255 },
+    { -45568, 17235 }, { -45575, 17236 }, { -45582, 17237 }, { -45589, 17258 },
+    { -45596, 17238 }, { -45603, 17239 }, { -45610, 17240 }, { -45617, 17241 },
+    { 23834, 17242 }, { -45634, 17280 }, { -45641, 17243 }, { 23793, 17019 },
+    { 23816, 17244 }, { -45658, 17245 }, { -45665, 17246 }, { -45672, 17247 },
+    { -45679, 17248 }, { -45686, 17249 }, { 23865, 17250 }, { -45706, 17259 },
+    { -45713, 17251 }, { -45720, 17252 }, { -45727, 17253 }, { -45734, 17265 },
+    { 23848, 17254 }, { -45751, 17256 }, { 23865, 17257 }, { -45781, 17260 },
+    { -45788, 17261 }, { -45795, 17262 }, { 23871, 17257 }, { -45802, 17263 },
+    { 23821, 17271 }, { -45819, 17266 }, { 23770, 17044 }, { -45826, 17267 },
+    { -45833, 17268 }, { -45840, 17273 }, { -45847, 17269 }, { -45854, 17270 },
+    { -45861, 17305 }, { -45868, 17272 }, { -45875, 17297 }, { -45882, 17274 },
+    { -45889, 17275 }, { -45896, 17276 }, { -45903, 17277 }, { -45910, 17286 },
+    { -45917, 17278 }, { -45924, 17279 }, { -45931, 17281 }, { -45938, 17282 },
+    { -45945, 17283 }, { -45952, 17300 }, { -45959, 17284 }, { 23844, 17285 },
+    { -45983, 17287 }, { -45990, 17289 }, { -45997, 17298 }, { -46004, 17288 },
+    { -46011, 17323 }, { 23845, 17290 }, { -46031, 17291 }, { -46038, 17292 },
+    { -46045, 17293 }, { 23849, 17294 }, { -46062, 17295 }, { -46069, 17296 },
+    { -46076, 17299 }, { 23847, 17301 }, { -46109, 17302 }, { -46116, 17303 },
+    { -46123, 17304 }, { -46130, 17306 }, { -46137, 17307 }, { -46144, 17308 },
+    { -46151, 17309 }, { 23856, 17310 }, { -46168, 17311 }, { -46175, 17312 },
+    { -46182, 17313 }, { 23828, 17314 }, { -46199, 17315 }, { 23866, 17316 },
+    { -46219, 17317 }, { -46226, 17318 }, { 23874, 17319 }, { -46246, 17320 },
+    { 23830, 17321 }, { -46298, 17322 }, { -46373, 17324 }, { -46380, 17325 },
+    { -46387, 17327 }, { 23838, 17326 }, { 23860, 17326 }, { -46414, 17328 },
+    { -46421, 17329 }, { -46428, 17330 }, { -46435, 17331 }, { 23861, 17332 },
+    { -46452, 17350 }, { -46459, 17333 }, { 23846, 17334 }, { -46479, 17335 },
+    { -46486, 17336 }, { -46493, 17383 }, { -46500, 17337 }, { -46507, 17347 },
+    { -46514, 17338 }, { 23814, 17114 }, { -46521, 17339 }, { 23879, 17340 },
+    { -46538, 17348 }, { 23838, 17116 }, { -46545, 17341 }, { -46552, 17342 },
+    { -46559, 17343 }, { -46566, 17344 }, { -46573, 17345 }, { -46580, 17346 },
+    { -46587, 17349 }, { -46594, 17351 }, { -46601, 17352 }, { -46608, 17353 },
+    { -46615, 17354 }, { -46622, 17355 }, { -46629, 17356 }, { -46636, 17357 },
+    { -46643, 17358 }, { -46650, 17359 }, { -46657, 17360 }, { -46664, 17361 },
+    { -46671, 17393 }, { -46678, 17362 }, { -46685, 17363 }, { -46692, 17364 },
+    { -46699, 17365 }, { -46706, 17366 }, { -46713, 17367 }, { -46720, 17395 },
+    { -46737, 17368 }, { 23823, 17146 }, { -46744, 17369 }, { -46751, 17370 },
+    { -46758, 17371 }, { 23888, 17372 }, { -46775, 17373 }, { -46782, 17374 },
+    { -46789, 17375 }, { -46796, 17376 }, { -46803, 17381 }, { -46822, 17377 },
+    { 23832, 17157 }, { -46829, 17378 }, { 23875, 17379 }, { -46909, 17380 },
+    { -46916, 17382 }, { -46923, 17384 }, { -46990, 17385 }, { -46997, 17386 },
+    { -47004, 17387 }, { -47011, 17415 }, { -47102, 17388 }, { -47109, 17389 },
+    { -47116, 17390 }, { -47127, 17391 }, { -47198, 17392 }, { -47217, 17394 },
+    { -47224, 17396 }, { -47231, 17397 }, { -47238, 17398 }, { -47245, 17399 },
+    { -47268, 17400 }, { -47275, 17401 }, { -47290, 17402 }, { 23890, 17403 },
+    { -47354, 17404 }, { -47373, 17405 }, { -47380, 17406 }, { -47387, 17407 },
+    { -47478, 17408 }, { -47485, 17409 }, { -47492, 17410 }, { 23809, 17191 },
+    { 23819, 17191 }, { -47499, 17411 }, { -47514, 17412 }, { 23867, 17191 },
+    { 23843, 17413 }, { 23893, 17414 }, { -47772, 17416 }, { -47795, 17417 },
+    { -47802, 17418 }, { 23888, 17419 }, { -47819, 17420 }, { 23898, 17421 },
+    { -47840, 17422 }, { -47847, 17423 }, { -47878, 17424 }, { -47885, 17425 },
+    { 23903, 17426 }, { -47917, 17427 }, { -47924, 17428 }, { 23858, 17429 },
+    { 23857, 17430 }, { 23870, 17431 }, { 23893, 17432 }, { -48011, 17433 },
+    { -48018, 17434 }, { -48029, 17435 }, { -48068, 17436 }, { -48159, 17437 },
+    { -48166, 17438 }, { -48173, 17439 }, { 23875, 17440 }, { -48190, 17441 },
+    { -48197, 17442 }, { -48208, 17443 }, { 23880, 17444 }, { -48229, 17445 },
+    { -48236, 17446 }, { 23903, 17447 }, { -48259, 17448 }, { -48274, 17449 },
+    { -48281, 17450 }, { -48296, 17451 }, { -48311, 17452 }, { 23895, 17453 },
+    { -48328, 17454 }, { 23899, 17455 }, { 23900, 17456 }, { -48375, 17457 },
+    { -48382, 17458 }, { -48389, 17459 }, { -48404, 17460 }, { -48411, 17461 },
+    { -48430, 17462 }, { -48437, 17463 }, { -48444, 17464 }, { 23863, 17465 },
+    { -48461, 17466 }, { -48468, 17467 }, { -48475, 17468 }, { -48482, 17469 },
+    { -48489, 17470 }, { -48496, 17471 }, { -48503, 17472 }, { -48510, 17473 },
+    { 23888, 17474 }, { -48534, 17475 }, { 23896, 17476 }, { -48554, 17477 },
+    { -48561, 17478 }, { 23901, 17479 }, { -48585, 17480 }, { -48596, 17481 },
+    { -48603, 17482 }, { -48614, 17483 }, { -48625, 17484 }, { -48632, 17485 },
+    { -48639, 17486 }, { -48646, 17487 }, { -48653, 17488 }, { -48660, 17489 },
+    { -48667, 17490 }, { -48674, 17512 }, { -48685, 17491 }, { -48692, 17492 },
+    { 23862, 17493 }, { -48712, 17494 }, { -48719, 17495 }, { 23863, 17496 },
+    { 23891, 17497 }, { 23917, 17498 }, { -48767, 17499 }, { -48774, 17500 },
+    { -48801, 17501 }, { -48808, 17502 }, { -48815, 17503 }, { 23920, 17540 },
+    { -48832, 17504 }, { -48839, 17505 }, { -48846, 17506 }, { 23896, 17507 },
+    { -48863, 17508 }, { -48870, 17519 }, { -48877, 17509 }, { -48884, 17510 },
+    { -48891, 17511 }, { 23902, 17513 }, { -48908, 17514 }, { 23923, 17515 },
+    { -48925, 17516 }, { -48932, 17517 }, { -48939, 17518 }, { -48946, 17520 },
+    { -48953, 17521 }, { -48960, 17522 }, { -48967, 17523 }, { -48984, 17524 },
+    { -48991, 17526 }, { -48998, 17525 }, { -49009, 17527 }, { -49020, 17528 },
+    { 23924, 17529 }, { -49052, 17530 }, { -49067, 17531 }, { 23922, 17532 },
+    { -49096, 17533 }, { 23893, 17534 }, { -49140, 17535 }, { 23916, 17536 },
+    { -49165, 17537 }, { -49172, 17538 }, { -49179, 17539 }, { -49186, 17541 },
+    { -49193, 17542 }, { -49200, 17543 }, { -49207, 17544 }, { -49214, 17545 },
+    { -49221, 17561 }, { -49256, 17546 }, { -49263, 17547 }, { -49278, 17548 },
+    { 23926, 17549 }, { 23890, 17550 }, { -49329, 17551 }, { -49376, 17552 },
+    { -49395, 17553 }, { -49406, 17554 }, { 23914, 17555 }, { 23936, 17556 },
+    { -49463, 17557 }, { 23891, 17558 }, { -49495, 17559 }, { 23875, 17560 },
+    { -49512, 17562 }, { 23876, 17563 }, { -49529, 17564 }, { 23882, 17565 },
+    { -49549, 17566 }, { -49576, 17567 }, { -49583, 17568 }, { 23928, 17569 },
+    { 23930, 17570 }, { -49624, 17571 }, { 23925, 17572 }, { -49641, 17573 },
+    { 23887, 17574 }, { -49661, 17575 }, { -49680, 17576 }, { -49687, 17577 },
+    { -49694, 17578 }, { -49701, 17579 }, { -49708, 17580 }, { -49715, 17581 },
+    { -49722, 17582 }, { 23927, 17583 }, { -49767, 17584 }, { -49774, 17585 },
+    { -49801, 17586 }, { -49832, 17587 }, { 23917, 17588 }, { -49877, 17589 },
+    { -49884, 17590 }, { -49927, 17591 }, { 23942, 17592 }, { -49947, 17593 },
+    { -49958, 17594 }, { -49965, 17595 }, { -49972, 17596 }, { -50035, 17597 },
+    { -50062, 17598 }, { 23866, 17395 }, { -50077, 17599 }, { -50200, 17600 },
+    { 23941, 17601 }, { -50217, 17602 }, { 23920, 17603 }, { -50246, 17604 },
+    { -50253, 17605 }, { 23946, 17606 }, { -50270, 17607 }, { -50277, 17608 },
+    { -50284, 17609 }, { -50291, 17610 }, { -50298, 17611 }, { -50305, 17612 },
+    { -50312, 17613 }, { -50319, 17614 }, { -50330, 17615 }, { 23917, 17616 },
+    { -50358, 17617 }, { 23894, 17618 }, { -50375, 17619 }, { -50386, 17620 },
+    { -50393, 17621 }, { -50560, 17622 }, { 23896, 17623 }, { 23925, 17624 },
+    { 23898, 17625 }, { -50703, 17626 }, { 23899, 17627 }, { -50723, 17628 },
+    { 23928, 17629 }, { 23951, 17630 }, { -50767, 17631 }, { 23932, 17632 },
+    { 23905, 17633 }, { -50884, 17634 }, { -50907, 17635 }, { -50918, 17636 },
+    { -50993, 17637 }, { -51000, 17638 }, { -51043, 17639 }, { -51066, 17640 },
+    { 23932, 17641 }, { 23949, 17642 }, { 23934, 17643 }, { 23919, 17644 },
+    { -51117, 17645 }, { -51124, 17646 }, { 23906, 17647 }, { 23919, 17648 },
+    { 23938, 17649 }, { -51167, 17650 }, { 23923, 17667 }, { -51188, 17651 },
+    { 23948, 17652 }, { -51228, 17653 }, { 23957, 17654 }, { -51249, 17655 },
+    { -51260, 17656 }, { -51267, 17657 }, { -51282, 17658 }, { 23963, 17659 },
+    { 23957, 17660 }, { -51323, 17661 }, { -51378, 17662 }, { 23948, 17663 },
+    { -51398, 17664 }, { 23968, 17668 }, { 23939, 17669 }, { 23960, 17674 },
+    { 23925, 17676 }, { 23975, 17677 }, { 23967, 17680 }, { 23968, 17681 },
+    { 23950, 17682 }, { 23919, 17683 }, { 23971, 17684 }, { 23922, 17687 },
+    { 23974, 17688 }, { 23952, 17689 }, { 23942, 17692 }, { 23982, 17698 },
+    { 23971, 17701 }, { 23987, 17706 }, { 23985, 17708 }, { 23961, 17712 },
+    { 23946, 17713 }, { 23963, 17717 }, { 23941, 17719 }, { 23984, 17723 },
+    { 23984, 17953 }, { 23986, 17727 }, { 23989, 17729 }, { 23966, 17731 },
+    { 23951, 17732 }, { 23948, 17733 }, { 23951, 17735 }, { 23962, 17740 },
+    { 23993, 17741 }, { 23964, 17749 }, { 23944, 17752 }, { 23963, 17755 },
+    { 23967, 17756 }, { 24004, 17765 }, { 23980, 17776 }, { 24000, 17783 },
+    { 23966, 17784 }, { 24002, 17787 }, { 23984, 17785 }, { 23953, 17788 },
+    { 23986, 17789 }, { 24001, 17794 }, { 24001, 17798 }, { 23971, 17800 },
+    { 23998, 17801 }, { 23994, 17802 }, { 23992, 17804 }, { 24018, 17805 },
+    { 24024, 17806 }, { 23983, 17807 }, { 24023, 17806 }, { 24008, 17808 },
+    { 24016, 17805 }, { 23993, 18044 }, { 24003, 17813 }, { 24023, 17815 },
+    { 24027, 17807 }, { 24023, 17827 }, { 24014, 17833 }, { 23988, 17840 },
+    { 24024, 17841 }, { 24006, 17850 }, { 23913, 17500 }, { 23894, 17500 },
+    { 24010, 17851 }, { 24031, 17853 }, { 23989, 17858 }, { 24038, 17864 },
+    { 23991, 17865 }, { 23987, 17804 }, { 24039, 17868 }, { 24024, 17869 },
+    { 24026, 17870 }, { 24027, 17872 }, { 24020, 17877 }, { 24016, 17881 },
+    { 24005, 17882 }, { 24052, 17883 }, { 24048, 17884 }, { 24005, 17885 },
+    { 23996, 17886 }, { 24008, 17887 }, { 24050, 17888 }, { 24049, 17889 },
+    { 24013, 17890 }, { 24034, 17892 }, { 24031, 17893 }, { 24010, 17891 },
+    { 23899, 17523 }, { 24061, 17894 }, { 24047, 17891 }, { 24053, 17897 },
+    { 23967, 17804 }, { 24054, 17898 }, { 24021, 17901 }, { 24054, 17900 },
+    { 24020, 17902 }, { 24058, 17903 }, { 24070, 17904 }, { 24013, 17905 },
+    { 24067, 17906 }, { 24045, 17907 }, { 24019, 17908 }, { 24052, 17907 },
+    { 24048, 17910 }, { 24025, 17911 }, { 24047, 17912 }, { 24043, 17913 },
+    { 24056, 17917 }, { 24032, 17917 }, { 24086, 17918 }, { 24063, 17923 },
+    { 24070, 17919 }, { 24087, 17924 }, { 24031, 17925 }, { 24060, 17926 },
+    { 24061, 17927 }, { 24061, 17928 }, { 24064, 17930 }, { 24087, 17931 },
+    { 24025, 17913 }, { 24066, 17932 }, { 24070, 17933 }, { 24023, 17912 },
+    { 24083, 17934 }, { 24044, 17935 }, { 24090, 17938 }, { 24076, 17940 },
+    { 24091, 17943 }, { 24055, 17941 }, { 24099, 17942 }, { 24057, 17944 },
+    { 24082, 17945 }, { 24107, 17948 }, { 24055, 17949 }, { 24110, 17950 },
+    { 24073, 17950 }, { 24111, 17951 }, { 24103, 17954 }, { 24103, 17956 },
+    { 24097, 17960 }, { 24056, 17963 }, { 24099, 17964 }, { 24093, 17961 },
+    { 24111, 17962 }, { 24091, 17965 }, { 24073, 17967 }, { 24076, 17968 },
+    { 24125, 17970 }, { 24096, 17971 }, { 24120, 17972 }, { 24110, 17976 },
+    { 24085, 17961 }, { 24124, 17978 }, { 24125, 17979 }, { 24099, 17980 },
+    { 24129, 17981 }, { 24128, 17982 }, { 24116, 17984 }, { 24080, 17986 },
+    { 24139, 17986 }, { 24139, 17987 }, { 24093, 17990 }, { 24097, 17993 },
+    { 24138, 17991 }, { 24082, 17994 }, { 24132, 17996 }, { 24129, 17997 },
+    { 24090, 17998 }, { 24136, 18001 }, { 24103, 17999 }, { 24139, 18000 },
+    { 24136, 18004 }, { 24136, 18005 }, { 24142, 18006 }, { 24096, 18007 },
+    { 24134, 18008 }, { 24116, 18009 }, { 24148, 18010 }, { 24061, 17931 },
+    { 24136, 18011 }, { 24137, 18012 }, { 24112, 18014 }, { 24099, 18018 },
+    { 24142, 18020 }, { 24132, 18024 }, { 24155, 18025 }, { 24156, 18026 },
+    { 24103, 18027 }, { 24132, 18029 }, { 24137, 18028 }, { 24161, 18031 },
+    { 24156, 18262 }, { 24164, 18034 }, { 24125, 18035 }, { 24126, 18036 },
+    { 24111, 18037 }, { 24112, 18038 }, { 24122, 18039 }, { 24119, 18042 },
+    { 24162, 18043 }, { 24128, 18045 }, { 24143, 18046 }, { 24120, 18051 },
+    { 24180, 18056 }, { 24153, 18063 }, { 24146, 18065 }, { 24126, 18067 },
+    { 24149, 18072 }, { 24165, 18078 }, { 24155, 18082 }, { 24190, 18089 },
+    { 24157, 18100 }, { 24144, 18107 }, { 24140, 18109 }, { 24141, 18116 },
+    { 24156, 18119 }, { 24166, 18120 }, { 24170, 18123 }, { 24177, 18124 },
+    { 24177, 18125 }, { 24176, 18107 }, { 24167, 18126 }, { 24154, 18127 },
+    { 24155, 18128 }, { 24190, 18142 }, { 24158, 18143 }, { 24173, 18445 },
+    { 24186, 18475 }, { 24159, 18248 }, { 24197, 18251 }, { 24163, 18252 },
+    { 24157, 18254 }, { 24196, 18255 }, { 24153, 18256 }, { 24191, 18266 },
+    { 24202, 18269 }, { 24188, 18276 }, { 24206, 18280 }, { 24163, 18281 },
+    { 24188, 18284 }, { 24220, 18283 }, { 24180, 18286 }, { 24169, 18290 },
+    { 24188, 18296 }, { 24211, 18307 }, { 24202, 18310 }, { 24212, 18311 },
+    { 24168, 18312 }, { 24222, 18315 }, { 24172, 18316 }, { 24178, 18323 },
+    { 24218, 18324 }, { 24223, 18334 }, { 24184, 18335 }, { 24201, 18342 },
+    { 24201, 18346 }, { 24230, 18357 }, { 24223, 18358 }, { 24238, 18591 },
+    { 24191, 18369 }, { 24229, 18370 }, { 24235, 18373 }, { 24223, 18377 },
+    { 24231, 18378 }, { 24232, 18379 }, { 24228, 18615 }, { 24191, 18397 },
+    { 24194, 18401 }, { 24218, 18402 }, { 24235, 18433 }, { 24244, 18434 },
+    { 24224, 18439 }, { 24236, 18440 }, { 24233, 18442 }, { 24223, 18447 },
+    { 24220, 18451 }, { 24232, 18453 }, { 24243, 18457 }, { 24257, 18466 },
+    { 24230, 18468 }, { 24213, 18469 }, { 24238, 18473 }, { 24252, 18486 },
+    { 24263, 18719 }, { 24212, 18495 }, { 24253, 18513 }, { 24207, 18517 },
+    { 24241, 18518 }, { 24219, 18521 }, { 24263, 18524 }, { 24224, 18522 },
+    { 24219, 18527 }, { 24241, 18528 }, { 24242, 18530 }, { 24243, 18531 },
+    { 24235, 18534 }, { 24239, 18537 }, { 24240, 18545 }, { 24260, 18547 },
+    { 24248, 18559 }, { 24252, 18560 }, { 24277, 18561 }, { 24268, 18562 },
+    { 24283, 18564 }, { 24264, 18569 }, { 24254, 18619 }, { 24255, 18620 },
+    { 24248, 18627 }, { 24271, 18631 }, { 24261, 18635 }, { 24280, 18636 },
+    { 24237, 18637 }, { 24281, 18639 }, { 24245, 18640 }, { 24251, 18646 },
+    { 24272, 18653 }, { 24263, 18654 }, { 24234, 18660 }, { 24297, 18662 },
+    { 24287, 18666 }, { 24238, 18673 }, { 24301, 18675 }, { 24271, 18680 },
+    { 24259, 18684 }, { 24273, 18686 }, { 24242, 18687 }, { 24305, 18689 },
+    { 24305, 18688 }, { 24299, 18695 }, { 24295, 18702 }, { 24278, 18704 },
+    { 24260, 18707 }, { 24300, 18705 }, { 24250, 18717 }, { 24286, 18723 },
+    { 24277, 18725 }, { 24265, 18747 }, { 24312, 18750 }, { 24278, 18761 },
+    { 24261, 18764 }, { 24313, 18765 }, { 24302, 18773 }, { 24272, 19006 },
+    { 24297, 18793 }, { 24309, 18798 }, { 24319, 18800 }, { 24298, 18809 },
+    { 24267, 18810 }, { 24325, 18822 }, { 24299, 18823 }, { 24277, 18825 },
+    { 24281, 18826 }, { 24320, 18835 }, { 24306, 18838 }, { 24313, 18849 },
+    { 24307, 18793 }, { 24314, 18856 }, { 24325, 18862 }, { 24327, 18871 },
+    { 24308, 18881 }, { 24281, 18889 }, { 24287, 19122 }, { 24292, 18894 },
+    { 24336, 18895 }, { 24344, 18897 }, { 24298, 18899 }, { 24318, 18908 },
+    { 24344, 18914 }, { 24301, 18918 }, { 24346, 18924 }, { 24300, 18937 },
+    { 24340, 18955 }, { 24335, 18958 }, { 24336, 18959 }, { 24298, 18961 },
+    { 24338, 18962 }, { 24316, 19197 }, { 24311, 18971 }, { 24351, 18973 },
+    { 24340, 18976 }, { 24349, 18978 }, { 24314, 18979 }, { 24346, 18987 },
+    { 24314, 18988 }, { 24363, 18989 }, { 24354, 18990 }, { 24328, 18988 },
+    { 24315, 18991 }, { 24345, 18992 }, { 24345, 18993 }, { 24370, 19001 },
+    { 24358, 19002 }, { 24338, 19004 }, { 24355, 19007 }, { 24330, 19008 },
+    { 24328, 19005 }, { 24345, 19009 }, { 24363, 19020 }, { 24323, 19269 },
+    { 24379, 19270 }, { 24341, 19049 }, { 24318, 19050 }, { 24364, 19051 },
+    { 24367, 19052 }, { 24370, 19056 }, { 24362, 19065 }, { 24347, 19066 },
+    { 24356, 19067 }, { 24341, 19070 }, { 24342, 19071 }, { 24328, 19073 },
+    { 24356, 19074 }, { 24367, 19075 }, { 24354, 19082 }, { 24363, 19083 },
+    { 24343, 19092 }, { 24390, 19097 }, { 24391, 19105 }, { 24346, 19114 },
+    { 24393, 19116 }, { 24389, 19120 }, { 24358, 19121 }, { 24380, 19352 },
+    { 24349, 19125 }, { 24373, 19128 }, { 24350, 19130 }, { 24359, 19132 },
+    { 24374, 19136 }, { 24399, 19148 }, { 24359, 19383 }, { 24399, 19157 },
+    { 24369, 19171 }, { 24372, 19189 }, { 24382, 19190 }, { 24410, 19195 },
+    { 24363, 19201 }, { 24401, 19204 }, { 24416, 19437 }, { 24412, 19208 },
+    { 24399, 19211 }, { 24375, 19212 }, { 24390, 19213 }, { 24402, 19214 },
+    { 24366, 19220 }, { 24416, 19227 }, { 24386, 19235 }, { 24393, 19239 },
+    { 24401, 19243 }, { 24417, 19247 }, { 24372, 19250 }, { 24396, 19252 },
+    { 24419, 19258 }, { 24378, 19264 }, { 24378, 19265 }, { 24380, 19266 },
+    { 24429, 19268 }, { 24405, 19273 }, { 24421, 19278 }, { 24405, 19515 },
+    { 24433, 19289 }, { 24389, 19292 }, { 24391, 19290 }, { 24383, 19291 },
+    { 24381, 19294 }, { 24382, 19295 }, { 24398, 19298 }, { 24404, 19304 },
+    { 24434, 19312 }, { 24396, 19313 }, { 24387, 19314 }, { 24399, 19317 },
+    { 24403, 19320 }, { 24404, 19321 }, { 24419, 19323 }, { 24394, 19328 },
+    { 24410, 19338 }, { 24409, 19340 }, { 24424, 19341 }, { 24457, 19351 },
+    { 24409, 19368 }, { 24441, 19375 }, { 24437, 19321 }, { 24418, 19376 },
+    { 24451, 19378 }, { 24452, 19379 }, { 24420, 19382 }, { 24426, 19390 },
+    { 24413, 19393 }, { 24444, 19398 }, { 24438, 19399 }, { 24458, 19401 },
+    { 24408, 19402 }, { 24466, 19403 }, { 24442, 19405 }, { 24445, 19406 },
+    { 24425, 19407 }, { 24445, 19408 }, { 24471, 19410 }, { 24448, 19411 },
+    { 24431, 19415 }, { 24422, 19418 }, { 24440, 19419 }, { 24476, 19420 },
+    { 24453, 19424 }, { 24479, 19422 }, { 24476, 19427 }, { 24464, 19432 },
+    { 24434, 19433 }, { 24435, 19463 }, { 24465, 19467 }, { 24441, 19471 },
+    { 24432, 19472 }, { 24445, 19477 }, { 24493, 19478 }, { 24460, 19486 },
+    { 24477, 19495 }, { 24449, 19499 }, { 24486, 19502 }, { 24476, 19505 },
+    { 24499, 19506 }, { 24454, 19507 }, { 24455, 19508 }, { 24472, 19509 },
+    { 24446, 19511 }, { 24476, 19519 }, { 24444, 19534 }, { 24495, 19541 },
+    { 24505, 19546 }, { 24469, 19780 }, { 24479, 19781 }, { 24499, 19554 },
+    { 24496, 19560 }, { 24482, 19563 }, { 24445, 19420 }, { 24480, 19564 },
+    { 24508, 19567 }, { 24462, 19568 }, { 24485, 19571 }, { 24493, 19573 },
+    { 24492, 19574 }, { 24458, 19577 }, { 24459, 19578 }, { 24510, 19581 },
+    { 24523, 19584 }, { 24463, 19586 }, { 24514, 19593 }, { 24487, 19595 },
+    { 24515, 19596 }, { 24508, 19600 }, { 24498, 19604 }, { 24518, 19608 },
+    { 24498, 19609 }, { 24480, 19612 }, { 24516, 19613 }, { 24483, 19625 },
+    { 24485, 19629 }, { 24505, 19869 }, { 24536, 19637 }, { 24534, 19639 },
+    { 24491, 19640 }, { 24533, 19640 }, { 24510, 19641 }, { 24505, 19642 },
+    { 24495, 19645 }, { 24498, 19646 }, { 24486, 19651 }, { 24540, 19652 },
+    { 24531, 19654 }, { 24517, 19885 }, { 24541, 19665 }, { 24542, 19672 },
+    { 24514, 19673 }, { 24502, 19905 }, { 24553, 19679 }, { 24530, 19695 },
+    { 24554, 19696 }, { 24545, 19698 }, { 24544, 19703 }, { 24531, 19715 },
+    { 24559, 19947 }, { 24503, 19954 }, { 24506, 19725 }, { 24514, 19729 },
+    { 24552, 19730 }, { 24552, 19732 }, { 24518, 19733 }, { 24541, 19738 },
+    { 24552, 19759 }, { 24557, 19764 }, { 24528, 19769 }, { 24562, 19770 },
+    { 24548, 19771 }, { 24510, 19782 }, { 24546, 20013 }, { 24538, 20016 },
+    { 24516, 19786 }, { 24570, 19791 }, { 24548, 19796 }, { 24549, 19800 },
+    { 24529, 19804 }, { 24574, 19806 }, { 24572, 19812 }, { 24534, 19813 },
+    { 24553, 19816 }, { 24579, 19821 }, { 24549, 19827 }, { 24587, 19830 },
+    { 24575, 19833 }, { 24576, 19836 }, { 24536, 19840 }, { 24542, 19843 },
+    { 24531, 19845 }, { 24589, 19853 }, { 24582, 19854 }, { 24582, 19858 },
+    { 24596, 19859 }, { 24586, 19866 }, { 24565, 19867 }, { 24592, 19868 },
+    { 24587, 19870 }, { 24590, 20102 }, { 24556, 19771 }, { 24602, 19874 },
+    { 24591, 19878 }, { 24567, 19879 }, { 24589, 19887 }, { 24573, 19895 },
+    { 24544, 19907 }, { 24598, 19916 }, { 24555, 19924 }, { 24600, 19946 },
+    { 24563, 19950 }, { 24598, 19951 }, { 24600, 19953 }, { 24614, 20188 },
+    { 24567, 19957 }, { 24568, 19958 }, { 24569, 19959 }, { 24569, 19972 },
+    { 24563, 19973 }, { 24560, 19977 }, { 24606, 19983 }, { 24611, 19985 },
+    { 24590, 19987 }, { 24589, 20001 }, { 24581, 20039 }, { 24603, 20044 },
+    { 24569, 20046 }, { 24574, 20047 }, { 24629, 20055 }, { 24610, 20055 },
+    { 24611, 20055 }, { 24610, 20055 }, { 24624, 20055 }, { 24612, 20055 },
+    { 24598, 20056 }, { 24706, 20297 }, { 24724, 20064 }, { 24687, 20300 },
+    { 24597, 20056 }, { 24610, 20056 }, { 24641, 20058 }, { 24689, 20073 },
+    { 24744, 20311 }, { 24608, 20056 }, { 24609, 20056 }, { 24618, 20056 },
+    { 24648, 20056 }, { 24650, 20058 }, { 24594, 20056 }, { 24695, 20080 },
+    { 24737, 20081 }, { 24631, 20056 }, { 24604, 20056 }, { 24634, 20056 },
+    { 24735, 20082 }, { 24715, 20059 }, { 24706, 20085 }, { 24603, 20056 },
+    { 24736, 20088 }, { 24674, 20058 }, { 24627, 20056 }, { 24613, 20056 },
+    { 24701, 20058 }, { 24690, 20059 }, { 24645, 20058 }, { 24704, 20058 },
+    { 24672, 20059 }, { 24668, 20059 }, { 24709, 20058 }, { 24619, 20056 },
+    { 24622, 20056 }, { 24656, 20056 }, { 24695, 20090 }, { 24722, 20091 },
+    { 24735, 20097 }, { 24648, 20058 }, { 24689, 20058 }, { 24720, 20100 },
+    { 24648, 20056 }, { 24663, 20056 }, { 24655, 20056 }, { 24653, 20056 },
+    { 24621, 20056 }, { 24641, 20057 }, { 24700, 20104 }, { 24754, 20106 },
+    { 24674, 20057 }, { 24702, 20115 }, { 24643, 20056 }, { 24666, 20057 },
+    { 24617, 20056 }, { 24703, 20118 }, { 24660, 20059 }, { 24717, 20120 },
+    { 24616, 20056 }, { 24623, 20056 }, { 24712, 20122 }, { 24678, 20058 },
+    { 24643, 20057 }, { 24715, 20124 }, { 24749, 20125 }, { 24700, 20058 },
+    { 24680, 20057 }, { 24638, 20057 }, { 24650, 20057 }, { 24677, 20057 },
+    { 24671, 20057 }, { 24681, 20059 }, { 24631, 20057 }, { 24713, 20129 },
+    { 24709, 20132 }, { 24669, 20057 }, { 24718, 20060 }, { 24741, 20133 },
+    { 24722, 20138 }, { 24749, 20370 }, { 24712, 20144 }, { 24706, 20059 },
+    { 24709, 20059 }, { 24715, 20060 }, { 24709, 20145 }, { 24710, 20146 },
+    { 24753, 20380 }, { 24717, 20151 }, { 24736, 20154 }, { 24757, 20162 },
+    { 24749, 20172 }, { 24731, 20403 }, { 24680, 20057 }, { 24677, 20057 },
+    { 24664, 20057 }, { 24688, 20057 }, { 24649, 20057 }, { 24666, 20060 },
+    { 24674, 20057 }, { 24766, 20176 }, { 24684, 20060 }, { 24653, 20057 },
+    { 24679, 20057 }, { 24746, 20177 }, { 24724, 20060 }, { 24702, 20060 },
+    { 24757, 20409 }, { 24651, 20057 }, { 24748, 20183 }, { 24776, 20185 },
+    { 24781, 20194 }, { 24719, 20060 }, { 24721, 20196 }, { 24782, 20215 },
+    { 24709, 20060 }, { 24723, 20219 }, { 24738, 20230 }, { 24751, 20248 },
+    { 24780, 20249 }, { 24711, 20060 }, { 24788, 20250 }, { 24727, 20253 },
+    { 24758, 20256 }, { 24757, 20257 }, { 24758, 20258 }, { 24793, 20260 },
+    { 24733, 20263 }, { 24734, 20282 }, { 24735, 20284 }, { 24757, 20287 },
+    { 24767, 20288 }, { 24782, 20290 }, { 24799, 20305 }, { 24743, 20322 },
+    { 24700, 20060 }, { 24735, 20060 }, { 24792, 20329 }, { 24791, 20331 },
+    { 24770, 20335 }, { 24753, 20337 }, { 24800, 20338 }, { 24757, 20340 },
+    { 24798, 20341 }, { 24799, 20350 }, { 24752, 20353 }, { 24778, 20357 },
+    { 24757, 20359 }, { 24765, 20365 }, { 24764, 20367 }, { 24784, 20372 },
+    { 24816, 20604 }, { 24782, 20384 }, { 24806, 20385 }, { 24807, 20387 },
+    { 24789, 20389 }, { 24806, 20396 }, { 24791, 20397 }, { 24769, 20398 },
+    { 24784, 20401 }, { 24811, 20406 }, { 24817, 20407 }, { 24820, 20410 },
+    { 24812, 20415 }, { 24809, 20416 }, { 24767, 20421 }, { 24773, 20425 },
+    { 24817, 20430 }, { 24774, 20434 }, { 24778, 20438 }, { 24813, 20444 },
+    { 24825, 20450 }, { 24791, 20452 }, { 24831, 20455 }, { 24784, 20458 },
+    { 24786, 20459 }, { 24843, 20466 }, { 24824, 20470 }, { 24811, 20472 },
+    { 24829, 20477 }, { 24789, 20478 }, { 24790, 20483 }, { 24815, 20450 },
+    { 24815, 20484 }, { 24824, 20489 }, { 24807, 20493 }, { 24852, 20494 },
+    { 24840, 20498 }, { 24794, 20499 }, { 24844, 20500 }, { 24809, 20501 },
+    { 24845, 20504 }, { 24852, 20505 }, { 24819, 20745 }, { 24848, 20515 },
+    { 24812, 20746 }, { 24830, 20524 }, { 24863, 20525 }, { 24810, 20528 },
+    { 24825, 20530 }, { 24854, 20531 }, { 24855, 20532 }, { 24856, 20533 },
+    { 24846, 20536 }, { 24830, 20537 }, { 24840, 20538 }, { 24815, 20421 },
+    { 24825, 20551 }, { 24826, 20552 }, { 24830, 20556 }, { 24863, 20559 },
+    { 24864, 20560 }, { 24865, 20562 }, { 24836, 20564 }, { 24866, 20570 },
+    { 24837, 20574 }, { 24819, 20578 }, { 24876, 20583 }, { 24872, 20584 },
+    { 24832, 20588 }, { 24878, 20823 }, { 24856, 20590 }, { 24864, 20592 },
+    { 24859, 20593 }, { 24880, 20594 }, { 24839, 20596 }, { 24851, 20597 },
+    { 24861, 20598 }, { 24878, 20600 }, { 24844, 20603 }, { 24872, 20611 },
+    { 24877, 20612 }, { 24872, 20613 }, { 24889, 20615 }, { 24849, 20618 },
+    { 24853, 20621 }, { 24900, 20625 }, { 24862, 20640 }, { 24872, 20641 },
+    { 24857, 20643 }, { 24871, 20644 }, { 24858, 20648 }, { 24859, 20649 },
+    { 24896, 20651 }, { 24886, 20654 }, { 24878, 20655 }, { 24894, 20660 },
+    { 24892, 20664 }, { 24851, 20666 }, { 24879, 20667 }, { 24864, 20670 },
+    { 24860, 20698 }, { 24866, 20700 }, { 24868, 20702 }, { 24896, 20704 },
+    { 24906, 20711 }, { 24920, 20717 }, { 24885, 20724 }, { 24916, 20729 },
+    { 24918, 20737 }, { 24901, 20741 }, { 24876, 20738 }, { 24893, 20757 },
+    { 24916, 20759 }, { 24870, 20767 }, { 24918, 20773 }, { 24881, 20775 },
+    { 24915, 20776 }, { 24922, 20777 }, { 24889, 20779 }, { 24884, 20784 },
+    { 24879, 20789 }, { 24876, 20790 }, { 24892, 20799 }, { 24893, 20800 },
+    { 24894, 20801 }, { 24893, 20802 }, { 24941, 20806 }, { 24941, 20809 },
+    { 24918, 20812 }, { 24904, 20813 }, { 24889, 20814 }, { 24892, 20820 },
+    { 24921, 20830 }, { 24914, 20831 }, { 24938, 20834 }, { 24902, 20835 },
+    { 24894, 20845 }, { 24920, 20848 }, { 24892, 20853 }, { 24893, 20854 },
+    { 24933, 20865 }, { 24908, 20866 }, { 24926, 21099 }, { 24909, 20869 },
+    { 24911, 20870 }, { 24903, 20884 }, { 24935, 20885 }, { 24940, 20893 },
+    { 24956, 20900 }, { 24935, 20903 }, { 24948, 20905 }, { 24940, 20919 },
+    { 24936, 20929 }, { 24930, 20932 }, { 24968, 20936 }, { 24969, 20938 },
+    { 24927, 20939 }, { 24963, 20941 }, { 24924, 20942 }, { 24920, 20943 },
+    { 24973, 20945 }, { 24972, 20946 }, { 24905, 20777 }, { 24962, 20947 },
+    { 24963, 20948 }, { 24978, 20950 }, { 24919, 20951 }, { 24932, 20953 },
+    { 24933, 20954 }, { 24933, 20955 }, { 24936, 20956 }, { 24960, 20957 },
+    { 24961, 20958 }, { 24928, 20959 }, { 24953, 20960 }, { 24945, 20961 },
+    { 24946, 20962 }, { 24954, 20972 }, { 24982, 20975 }, { 24989, 20976 },
+    { 24956, 20981 }, { 24987, 20982 }, { 24968, 20983 }, { 24975, 20986 },
+    { 24980, 20990 }, { 24990, 20991 }, { 25001, 20994 }, { 24953, 20995 },
+    { 24996, 21007 }, { 24965, 21015 }, { 24998, 21016 }, { 24947, 21019 },
+    { 24976, 21022 }, { 24999, 21027 }, { 24998, 21262 }, { 24959, 21044 },
+    { 24982, 21049 }, { 25003, 21055 }, { 24973, 21056 }, { 25010, 21066 },
+    { 24977, 21067 }, { 24987, 21068 }, { 25016, 21079 }, { 24995, 21314 },
+    { 24987, 21088 }, { 24991, 21089 }, { 24992, 21090 }, { 24977, 21106 },
+    { 24983, 21114 }, { 24993, 21116 }, { 25010, 21115 }, { 25011, 21118 },
+    { 25012, 21119 }, { 25017, 21123 }, { 24969, 21126 }, { 24995, 21136 },
+    { 24991, 21139 }, { 25000, 21142 }, { 25018, 21144 }, { 24984, 21146 },
+    { 24990, 21149 }, { 24998, 21150 }, { 25008, 21151 }, { 24994, 21153 },
+    { 24993, 21154 }, { 25028, 21155 }, { 25033, 21157 }, { 25026, 21160 },
+    { 24985, 21163 }, { 25032, 21164 }, { 25045, 21168 }, { 25006, 21171 },
+    { 25016, 21173 }, { 25033, 21172 }, { 25034, 21175 }, { 25035, 21176 },
+    { 25019, 21184 }, { 25005, 21185 }, { 25021, 21186 }, { 25025, 21189 },
+    { 25047, 21196 }, { 25011, 21197 }, { 25019, 21199 }, { 25029, 21200 },
+    { 25030, 21202 }, { 25056, 21203 }, { 25023, 21207 }, { 25029, 21225 },
+    { 25031, 21226 }, { 25032, 21231 }, { 25052, 21233 }, { 25065, 21238 },
+    { 25057, 21240 }, { 25064, 21241 }, { 25060, 21242 }, { 25018, 21244 },
+    { 25033, 21478 }, { 25057, 21246 }, { 25047, 21248 }, { 25070, 21252 },
+    { 25040, 21256 }, { 25027, 21259 }, { 25065, 21265 }, { 25078, 21275 },
+    { 25041, 21280 }, { 25051, 21281 }, { 25043, 21283 }, { 25053, 21284 },
+    { 25073, 21291 }, { 25074, 21292 }, { 25076, 21295 }, { 25034, 21297 },
+    { 25042, 21299 }, { 25083, 21300 }, { 25086, 21301 }, { 25086, 21302 },
+    { 25053, 21304 }, { 25063, 21305 }, { 25055, 21306 }, { 25065, 21307 },
+    { 25057, 21317 }, { 25067, 21318 }, { 25048, 21320 }, { 25042, 21324 },
+    { 25089, 21347 }, { 25091, 21351 }, { 25091, 21352 }, { 25092, 21355 },
+    { 25093, 21356 }, { 25069, 21358 }, { 25062, 21359 }, { 25089, 21364 },
+    { 25105, 21366 }, { 25108, 21367 }, { 25061, 21603 }, { 25088, 21377 },
+    { 25089, 21378 }, { 25101, 21380 }, { 25112, 21381 }, { 25113, 21383 },
+    { 25084, 21617 }, { 25077, 21387 }, { 25087, 21391 }, { 25060, 21393 },
+    { 25065, 21396 }, { 25111, 21402 }, { 25108, 21405 }, { 25084, 21406 },
+    { 25111, 21427 }, { 25112, 21432 }, { 25092, 21435 }, { 25112, 21436 },
+    { 25112, 21438 }, { 25120, 21446 }, { 25131, 21680 }, { 25120, 21452 },
+    { 25112, 21467 }, { 25134, 21704 }, { 25123, 21474 }, { 25118, 21479 },
+    { 25121, 21483 }, { 25080, 21491 }, { 25077, 21492 }, { 25084, 21503 },
+    { 25125, 21504 }, { 25126, 21507 }, { 25132, 21510 }, { 25112, 21517 },
+    { 25136, 21538 }, { 25143, 21542 }, { 25132, 21560 }, { 25109, 21809 },
+    { 25119, 21578 }, { 25097, 21581 }, { 25118, 21588 }, { 25119, 21592 },
+    { 25097, 21597 }, { 25140, 21598 }, { 25144, 21604 }, { 25148, 21611 },
+    { 25125, 21614 }, { 25105, 21620 }, { 25097, 21624 }, { 25115, 21627 },
+    { 25150, 21637 }, { 25105, 21642 }, { 25127, 21643 }, { 25080, 21704 },
+    { 25132, 21655 }, { 25124, 21657 }, { 25160, 21660 }, { 25145, 21661 },
+    { 25120, 21666 }, { 25112, 21668 }, { 25155, 21670 }, { 25119, 21672 },
+    { 25157, 21668 }, { 25158, 21673 }, { 25151, 21674 }, { 25154, 21676 },
+    { 25148, 21678 }, { 25176, 21679 }, { 25173, 21683 }, { 25132, 21691 },
+    { 25168, 21697 }, { 25147, 21698 }, { 25171, 21699 }, { 25174, 21702 },
+    { 25185, 21715 }, { 25152, 21720 }, { 25175, 21731 }, { 25154, 21738 },
+    { 25156, 21744 }, { 25160, 21745 }, { 25130, 21757 }, { 25187, 21759 },
+    { 25155, 21762 }, { 25194, 21782 }, { 25132, 21816 }, { 25196, 21818 },
+    { 25143, 21820 }, { 25170, 21824 }, { 25149, 21825 }, { 25150, 22056 },
+    { 25168, 21831 }, { 25152, 21833 }, { 25202, 21834 }, { 25160, 21837 },
+    { 25173, 21840 }, { 25166, 21841 }, { 25160, 21842 }, { 25206, 21850 },
+    { 25203, 21851 }, { 25148, 21863 }, { 25211, 21864 }, { 25212, 21865 },
+    { 25201, 21871 }, { 25158, 21876 }, { 25188, 21878 }, { 25165, 21879 },
+    { 25170, 21881 }, { 25215, 21886 }, { 25176, 21889 }, { 25214, 21896 },
+    { 25161, 21898 }, { 25175, 21901 }, { 25217, 21913 }, { 25209, 21915 },
+    { 25179, 21926 }, { 25190, 21927 }, { 25189, 21929 }, { 25179, 21931 },
+    { 25200, 21938 }, { 25178, 21944 }, { 25233, 21947 }, { 25233, 21949 },
+    { 25224, 21913 }, { 25186, 21950 }, { 25224, 21953 }, { 25190, 21955 },
+    { 25191, 21956 }, { 25227, 21961 }, { 25228, 21962 }, { 25224, 21964 },
+    { 25211, 21966 }, { 25212, 21967 }, { 25213, 21968 }, { 25205, 21970 },
+    { 25191, 21973 }, { 25238, 21989 }, { 25222, 21991 }, { 25232, 21995 },
+    { 25213, 21999 }, { 25247, 22004 }, { 25238, 22010 }, { 25227, 22012 },
+    { 25200, 22015 }, { 25219, 22033 }, { 25193, 22034 }, { 25257, 22271 },
+    { 25211, 22044 }, { 25209, 22048 }, { 25231, 22062 }, { 25248, 22294 },
+    { 25203, 22079 }, { 25249, 22080 }, { 25250, 22082 }, { 25254, 22083 },
+    { 25253, 22085 }, { 25220, 22088 }, { 25253, 22093 }, { 25257, 22098 },
+    { 25258, 22099 }, { 25268, 22105 }, { 25210, 22109 }, { 25236, 22124 },
+    { 25240, 22130 }, { 25242, 22131 }, { 25264, 22133 }, { 25190, 21927 },
+    { 25277, 22369 }, { 25220, 22138 }, { 25272, 22373 }, { 25267, 22143 },
+    { 25227, 22145 }, { 25252, 22150 }, { 25236, 22151 }, { 25237, 22154 },
+    { 25238, 22157 }, { 25230, 22160 }, { 25253, 22166 }, { 25265, 22167 },
+    { 25252, 22170 }, { 25250, 22401 }, { 25260, 22172 }, { 25245, 22177 },
+    { 25282, 22178 }, { 25283, 22179 }, { 25295, 22412 }, { 25251, 22184 },
+    { 25284, 22190 }, { 25289, 22201 }, { 25286, 22443 }, { 25267, 22444 },
+    { 25289, 22447 }, { 25286, 22221 }, { 25260, 22222 }, { 25288, 22226 },
+    { 25256, 22228 }, { 25307, 22235 }, { 25295, 22268 }, { 25251, 22272 },
+    { 25286, 22278 }, { 25253, 22284 }, { 25254, 22286 }, { 25306, 22290 },
+    { 25256, 22292 }, { 25293, 22315 }, { 25294, 22321 }, { 25277, 22325 },
+    { 25296, 22329 }, { 25253, 22447 }, { 25285, 22337 }, { 25278, 22341 },
+    { 25258, 22343 }, { 25313, 22346 }, { 25306, 22348 }, { 25294, 22353 },
+    { 25274, 22354 }, { 25275, 22359 }, { 25269, 22362 }, { 25277, 22371 },
+    { 25295, 22633 }, { 25307, 22405 }, { 25308, 22414 }, { 25309, 22435 },
+    { 25320, 22448 }, { 25276, 22449 }, { 25288, 22453 }, { 25273, 22455 },
+    { 25281, 22460 }, { 25281, 22463 }, { 25319, 22464 }, { 25288, 22465 },
+    { 25300, 22466 }, { 25302, 22474 }, { 25309, 22478 }, { 25332, 22481 },
+    { 25331, 22487 }, { 25299, 22489 }, { 25300, 22490 }, { 25327, 22499 },
+    { 25348, 22508 }, { 25291, 22510 }, { 25315, 22513 }, { 25352, 22528 },
+    { 25340, 22531 }, { 25354, 22532 }, { 25292, 22533 }, { 25342, 22766 },
+    { 25357, 22767 }, { 25295, 22539 }, { 25359, 22543 }, { 25319, 22549 },
+    { 25298, 22551 }, { 25328, 22792 }, { 25326, 22564 }, { 25310, 22567 },
+    { 25363, 22569 }, { 25349, 22571 }, { 25355, 22584 }, { 25318, 22585 },
+    { 25332, 22590 }, { 25352, 22591 }, { 25360, 22593 }, { 25349, 22595 },
+    { 25350, 22597 }, { 25357, 22599 }, { 25342, 22603 }, { 25315, 22604 },
+    { 25346, 22606 }, { 25367, 22608 }, { 25348, 22617 }, { 25346, 22622 },
+    { 25327, 22626 }, { 25370, 22636 }, { 25356, 22638 }, { 25321, 22641 },
+    { 25347, 22651 }, { 25347, 22653 }, { 25377, 22658 }, { 25354, 22659 },
+    { 25384, 22660 }, { 25385, 22662 }, { 25357, 22664 }, { 25380, 22665 },
+    { 25337, 22667 }, { 25354, 22668 }, { 25361, 22676 }, { 25349, 22677 },
+    { 25349, 22678 }, { 25381, 22679 }, { 25382, 22682 }, { 25382, 22683 },
+    { 25353, 22684 }, { 25385, 22686 }, { 25340, 22688 }, { 25395, 22690 },
+    { 25392, 22695 }, { 25389, 22696 }, { 25393, 22699 }, { 25537, 22701 },
+    { 25309, 22702 }, { 25539, 22703 }, { 25540, 22704 }, { 25307, 22705 },
+    { 25311, 22706 }, { 25543, 22707 }, { 25544, 22708 }, { 25315, 22709 },
+    { 25316, 22710 }, { 25314, 22711 }, { 25319, 22712 }, { 25549, 22713 },
+    { 25319, 22714 }, { 25318, 22715 }, { 25321, 22716 }, { 25320, 22717 },
+    { 25554, 22718 }, { 25555, 22719 }, { 25556, 22720 }, { 25557, 22721 },
+    { 25558, 22722 }, { 25328, 22723 }, { 25330, 22724 }, { 25330, 22725 },
+    { 25332, 22726 }, { 25563, 22727 }, { 25331, 22728 }, { 25565, 22729 },
+    { 25566, 22730 }, { 25567, 22731 }, { 25568, 22732 }, { 25336, 22733 },
+    { 25570, 22734 }, { 25571, 22735 }, { 25572, 22736 }, { 25573, 22737 },
+    { 25574, 22738 }, { 25575, 22739 }, { 25576, 22740 }, { 25577, 22741 },
+    { 25578, 22742 }, { 25347, 22743 }, { 25580, 22744 }, { 25350, 22745 },
+    { 25350, 22746 }, { 25352, 22747 }, { 25352, 22748 }, { 25585, 22749 },
+    { 25356, 22750 }, { 25357, 22773 }, { 25359, 22796 }, { 25360, 22751 },
+    { 25362, 22756 }, { 25362, 22752 }, { 25362, 22754 }, { 25364, 22753 },
+    { 25363, 22760 }, { 25366, 22755 }, { 25598, 22757 }, { 25599, 22758 },
+    { 25600, 22759 }, { 25371, 22761 }, { 25372, 22762 }, { 25371, 22763 },
+    { 25375, 22764 }, { 25605, 22765 }, { 25606, 22768 }, { 25378, 22769 },
+    { 25608, 22770 }, { 25609, 22771 }, { 25610, 22772 }, { 25380, 22774 },
+    { 25382, 22775 }, { 25357, 22773 }, { 25383, 22776 }, { 25382, 22777 },
+    { 25384, 22778 }, { 25616, 22779 }, { 25617, 22780 }, { 25618, 22781 },
+    { 25619, 22782 }, { 25620, 22783 }, { 25621, 22784 }, { 25391, 22785 },
+    { 25623, 22786 }, { 25624, 22787 }, { 25625, 22788 }, { 25626, 22789 },
+    { 25627, 22790 }, { 25628, 22791 }, { 25629, 22794 }, { 25630, 22793 },
+    { 25631, 22795 }, { 25632, 22797 }, { 25633, 22798 }, { 25634, 22799 },
+    { 25635, 22800 }, { 25636, 22801 }, { 25637, 22802 }, { 25638, 22803 },
+    { 25639, 22804 }, { 25640, 22805 }, { 25641, 22807 }, { 25642, 22806 },
+    { 25643, 22808 }, { 25644, 22809 }, { 25645, 22810 }, { 25646, 22827 },
+    { 25647, 22811 }, { 25648, 22824 }, { 25649, 22812 }, { 25650, 22813 },
+    { 25651, 22814 }, { 25652, 22815 }, { 25422, 22816 }, { 25655, 22817 },
+    { 25656, 22818 }, { 25657, 22819 }, { 25658, 22820 }, { 25659, 22821 },
+    { 25660, 22822 }, { 25661, 22823 }, { 25662, 22883 }, { 25663, 22825 },
+    { 25664, 22826 }, { 25665, 22828 }, { 25666, 22829 }, { 25437, 22830 },
+    { 25668, 22831 }, { 25669, 22832 }, { 25670, 22833 }, { 25671, 22834 },
+    { 25672, 22835 }, { 25673, 22836 }, { 25674, 22837 }, { 25675, 22838 },
+    { 25676, 22839 }, { 25677, 22840 }, { 25423, 22816 }, { 25444, 22841 },
+    { 25679, 22842 }, { 25680, 22843 }, { 25452, 22844 }, { 25453, 22845 },
+    { 25452, 22846 }, { 25685, 22847 }, { 25686, 22856 }, { 25687, 22848 },
+    { 25688, 22849 }, { 25689, 22850 }, { 25690, 22851 }, { 25691, 22852 },
+    { 25692, 22853 }, { 25681, 22843 }, { 25693, 22854 }, { 25694, 22855 },
+    { 25695, 22857 }, { 25696, 22858 }, { 25698, 22859 }, { 25699, 22860 },
+    { 25700, 22861 }, { 25701, 22862 }, { 25697, 22858 }, { 25702, 22863 },
+    { 25703, 22864 }, { 25704, 22865 }, { 25705, 22866 }, { 25706, 22867 },
+    { 25707, 22868 }, { 25708, 22869 }, { 25709, 22870 }, { 25710, 22871 },
+    { 25711, 22872 }, { 25482, 22873 }, { 25713, 22874 }, { 25714, 22875 },
+    { 25715, 22876 }, { 25716, 22877 }, { 25717, 22878 }, { 25718, 22879 },
+    { 25719, 22880 }, { 25720, 22881 }, { 25721, 22882 }, { 25722, 22884 },
+    { 25723, 22885 }, { 25724, 22886 }, { 25725, 22887 }, { 25726, 22888 },
+    { 25727, 22889 }, { 25728, 22890 }, { 25729, 22891 }, { 25730, 22892 },
+    { 25731, 22893 }, { 25732, 22894 }, { 25733, 22895 }, { 25734, 22896 },
+    { 25735, 22897 }, { 25506, 22898 }, { 25507, 22899 }, { 25738, 22900 },
+    { 25739, 22901 }, { 25740, 22902 }, { 25741, 22903 }, { 25742, 22904 },
+    { 25743, 22905 }, { 25744, 22906 }, { 25513, 22907 }, { 25745, 22906 },
+    { 25515, 22908 }, { 25518, 22909 }, { 25516, 22910 }, { 25521, 22911 },
+    { 25518, 22912 }, { 25752, 22913 }, { 25753, 22914 }, { 25523, 22915 },
+    { 25521, 22916 }, { 25526, 22917 }, { 25527, 22925 }, { 25758, 22918 },
+    { 25759, 22919 }, { 25760, 22920 }, { 25761, 22921 }, { 25762, 22922 },
+    { 25533, 22923 }, { 25534, 22924 }, { 25765, 22926 }, { 25536, 22927 },
+    { 25768, 22928 }, { 25539, 22929 }, { 25538, 22930 }, { 25540, 22931 },
+    { 25541, 22932 }, { 25540, 22933 }, { 25774, 22934 }, { 25543, 22935 },
+    { 25776, 22936 }, { 25547, 22937 }, { 25549, 22938 }, { 25779, 22939 },
+    { 25547, 22940 }, { 25781, 22941 }, { 25551, 22942 }, { 25783, 22943 },
+    { 25784, 22944 }, { 25785, 22945 }, { 25556, 22946 }, { 25787, 22947 },
+    { 25556, 22948 }, { 25557, 22949 }, { 25556, 22950 }, { 25561, 22951 },
+    { 25561, 22952 }, { 25793, 22953 }, { 25560, 22954 }, { 25795, 22955 },
+    { 25567, 22956 }, { 25797, 22957 }, { 25798, 22958 }, { 25799, 22959 },
+    { 25800, 22960 }, { 25801, 22961 }, { 25571, 22962 }, { 25803, 22963 },
+    { 25804, 22964 }, { 25575, 22965 }, { 25806, 22966 }, { 25807, 22967 },
+    { 25808, 22968 }, { 25809, 22969 }, { 25579, 22970 }, { 25577, 22971 },
+    { 25812, 22972 }, { 25583, 22973 }, { 25814, 22974 }, { 25815, 22975 },
+    { 25816, 22976 }, { 25817, 22977 }, { 25818, 22978 }, { 25819, 22979 },
+    { 25820, 22980 }, { 25821, 22981 }, { 25822, 22982 }, { 25823, 22983 },
+    { 25824, 22984 }, { 25825, 22985 }, { 25595, 22986 }, { 25827, 22987 },
+    { 25828, 22988 }, { 25829, 22989 }, { 25830, 22990 }, { 25831, 22991 },
+    { 25832, 22992 }, { 25833, 22993 }, { 25834, 22994 }, { 25835, 22995 },
+    { 25836, 22996 }, { 25837, 22997 }, { 25838, 22998 }, { 25839, 22999 },
+    { 25840, 23000 }, { 25841, 23001 }, { 25842, 23002 }, { 25613, 23003 },
+    { 25844, 23004 }, { 25845, 23005 }, { 25846, 23006 }, { 25847, 23007 },
+    { 25615, 23008 }, { 25849, 23009 }, { 25850, 23010 }, { 25851, 23011 },
+    { 25852, 23012 }, { 25853, 23013 }, { 25854, 23014 }, { 25624, 23015 },
+    { 25856, 23016 }, { 25627, 23017 }, { 25858, 23018 }, { 25626, 23019 },
+    { 25627, 23020 }, { 25627, 23021 }, { 25862, 23022 }, { 25630, 23023 },
+    { 25864, 23024 }, { 25634, 23025 }, { 25636, 23026 }, { 25868, 23027 },
+    { 25638, 23028 }, { 25870, 23029 }, { 25871, 23030 }, { 25639, 23031 },
+    { 25873, 23032 }, { 25874, 23033 }, { 25875, 23034 }, { 25876, 23035 },
+    { 25877, 23036 }, { 25878, 23037 }, { 25649, 23038 }, { 25880, 23039 },
+    { 25881, 23040 }, { 25882, 23041 }, { 25883, 23042 }, { 25884, 23043 },
+    { 25885, 23044 }, { 25886, 23045 }, { 25887, 23046 }, { 25888, 23047 },
+    { 25889, 23048 }, { 25890, 23060 }, { 25891, 23049 }, { 25892, 23050 },
+    { 25663, 23051 }, { 25894, 23052 }, { 25665, 23053 }, { 25896, 23054 },
+    { 25664, 23055 }, { 25667, 23056 }, { 25668, 23057 }, { 25900, 23058 },
+    { 25901, 23059 }, { 25902, 23061 }, { 25903, 23062 }, { 25673, 23063 },
+    { 25905, 23064 }, { 25906, 23065 }, { 25907, 23066 }, { 25678, 23067 },
+    { 25679, 23068 }, { 25681, 23069 }, { 25677, 23070 }, { 25680, 23071 },
+    { 25679, 23072 }, { 25914, 23073 }, { 25681, 23074 }, { 25686, 23075 },
+    { 25686, 23076 }, { 25918, 23077 }, { 25919, 23078 }, { 25920, 23079 },
+    { 25921, 23080 }, { 25922, 23081 }, { 25693, 23082 }, { 25691, 23083 },
+    { 25695, 23084 }, { 25696, 23085 }, { 25696, 23086 }, { 25698, 23087 },
+    { 25699, 23088 }, { 25930, 23091 }, { 25701, 23089 }, { 25702, 23090 },
+    { 25933, 23092 }, { 25934, 23093 }, { 25935, 23094 }, { 25702, 23095 },
+    { 25707, 23096 }, { 25938, 23097 }, { 25709, 23098 }, { 25710, 23099 },
+    { 25941, 23100 }, { 25942, 23101 }, { 25713, 23102 }, { 25713, 23103 },
+    { 25945, 23104 }, { 25715, 23105 }, { 25718, 23106 }, { 25715, 23107 },
+    { 25949, 23108 }, { 25716, 23109 }, { 25951, 23110 }, { 25952, 23111 },
+    { 25721, 23112 }, { 25954, 23113 }, { 25955, 23114 }, { 25956, 23115 },
+    { 25957, 23116 }, { 25958, 23117 }, { 25959, 23118 }, { 25728, 23119 },
+    { 25731, 23120 }, { 25730, 23121 }, { 25963, 23122 }, { 25964, 23123 },
+    { 25734, 23124 }, { 25966, 23125 }, { 25967, 23126 }, { 25736, 23127 },
+    { 25969, 23128 }, { 25970, 23129 }, { 25737, 23130 }, { 25972, 23131 },
+    { 25740, 23132 }, { 25974, 23133 }, { 25975, 23134 }, { 25976, 23135 },
+    { 25747, 23136 }, { 25978, 23137 }, { 25979, 23138 }, { 25747, 23139 },
+    { 25751, 23140 }, { 25749, 23141 }, { 25752, 23142 }, { 25984, 23143 },
+    { 25755, 23144 }, { 25756, 23145 }, { 25987, 23146 }, { 25756, 23147 },
+    { 25989, 23148 }, { 25990, 23149 }, { 25991, 23150 }, { 25761, 23151 },
+    { 25993, 23152 }, { 25763, 23153 }, { 25764, 23154 }, { 25766, 23155 },
+    { 25997, 23156 }, { 25998, 23157 }, { 25765, 23158 }, { 26000, 23159 },
+    { 25768, 23160 }, { 26002, 23161 }, { 25771, 23162 }, { 26004, 23163 },
+    { 26005, 23164 }, { 25776, 23165 }, { 26007, 23166 }, { 25775, 23167 },
+    { 25779, 23168 }, { 25780, 23169 }, { 26012, 23170 }, { 25783, 23171 },
+    { 26014, 23172 }, { 25785, 23173 }, { 25787, 23174 }, { 26017, 23175 },
+    { 26018, 23176 }, { 26019, 23177 }, { 26020, 23186 }, { 26021, 23178 },
+    { 25791, 23179 }, { 26023, 23180 }, { 26024, 23181 }, { 26025, 23182 },
+    { 25796, 23183 }, { 26027, 23184 }, { 26028, 23185 }, { 26029, 23187 },
+    { 26030, 23188 }, { 26031, 23189 }, { 25802, 23190 }, { 26033, 23191 },
+    { 26034, 23192 }, { 26035, 23193 }, { 26036, 23194 }, { 25807, 23195 },
+    { 26038, 23196 }, { 26039, 23197 }, { 26040, 23198 }, { 25810, 23199 },
+    { 25809, 23200 }, { 26043, 23201 }, { 26044, 23202 }, { 25815, 23203 },
+    { 25816, 23204 }, { 25814, 23205 }, { 25816, 23206 }, { 25816, 23207 },
+    { 25816, 23238 }, { 26051, 23208 }, { 26052, 23209 }, { 25823, 23210 },
+    { 25820, 23211 }, { 25822, 23212 }, { 26056, 23213 }, { 26057, 23214 },
+    { 26058, 23215 }, { 25828, 23216 }, { 26060, 23217 }, { 25829, 23218 },
+    { 26062, 23219 }, { 25834, 23220 }, { 25834, 23221 }, { 25831, 23222 },
+    { 26066, 23223 }, { 25834, 23224 }, { 26068, 23225 }, { 26069, 23226 },
+    { 26070, 23227 }, { 25837, 23228 }, { 25841, 23229 }, { 25842, 23230 },
+    { 26074, 23231 }, { 25841, 23232 }, { 26076, 23233 }, { 26077, 23234 },
+    { 26078, 23235 }, { 26079, 23236 }, { 26080, 23237 }, { 26081, 23239 },
+    { 26082, 23240 }, { 26083, 23241 }, { 25850, 23242 }, { 25854, 23243 },
+    { 26086, 23244 }, { 25854, 23245 }, { 25855, 23246 }, { 26089, 23247 },
+    { 25859, 23248 }, { 26091, 23249 }, { 25862, 23250 }, { 25863, 23251 },
+    { 26094, 23252 }, { 25866, 23253 }, { 25866, 23254 }, { 26097, 23255 },
+    { 26098, 23256 }, { 25869, 23257 }, { 25869, 23258 }, { 25869, 23259 },
+    { 26102, 23260 }, { 25869, 23261 }, { 25870, 23262 }, { 26105, 23263 },
+    { 26106, 23264 }, { 26107, 23265 }, { 25878, 23266 }, { 25879, 23267 },
+    { 26110, 23268 }, { 25878, 23269 }, { 26113, 23270 }, { 26114, 23271 },
+    { 26115, 23272 }, { 26116, 23273 }, { 26117, 23274 }, { 26118, 23275 },
+    { 26119, 23276 }, { 25890, 23277 }, { 25892, 23278 }, { 26122, 23279 },
+    { 25893, 23280 }, { 26124, 23281 }, { 26125, 23282 }, { 26126, 23283 },
+    { 25897, 23284 }, { 26128, 23285 }, { 26129, 23286 }, { 26130, 23287 },
+    { 26131, 23288 }, { 26132, 23289 }, { 26133, 23290 }, { 26134, 23291 },
+    { 26135, 23292 }, { 25903, 23293 }, { 25907, 23294 }, { 26138, 23295 },
+    { 26139, 23296 }, { 26140, 23326 }, { 26141, 23297 }, { 25912, 23298 },
+    { 26143, 23299 }, { 26144, 23300 }, { 26145, 23301 }, { 26146, 23302 },
+    { 26147, 23303 }, { 25916, 23304 }, { 26149, 23305 }, { 26150, 23306 },
+    { 26151, 23307 }, { 26152, 23308 }, { 26153, 23309 }, { 26154, 23310 },
+    { 25922, 23311 }, { 25927, 23312 }, { 26157, 23313 }, { 26158, 23314 },
+    { 26159, 23315 }, { 26160, 23316 }, { 26161, 23317 }, { 26162, 23318 },
+    { 25934, 23319 }, { 25935, 23320 }, { 25935, 23321 }, { 25937, 23322 },
+    { 26168, 23323 }, { 25937, 23324 }, { 26170, 23325 }, { 26171, 23327 },
+    { 25938, 23328 }, { 25942, 23329 }, { 26174, 23330 }, { 26175, 23331 },
+    { 25942, 23332 }, { 25947, 23333 }, { 26178, 23334 }, { 25947, 23335 },
+    { 26180, 23336 }, { 25951, 23337 }, { 25948, 23338 }, { 26183, 23339 },
+    { 26184, 23340 }, { 26185, 23341 }, { 26186, 23342 }, { 25957, 23343 },
+    { 25958, 23344 }, { 26189, 23345 }, { 26190, 23346 }, { 25961, 23347 },
+    { 25963, 23348 }, { 25963, 23349 }, { 25960, 23350 }, { 26195, 23351 },
+    { 25963, 23352 }, { 26197, 23353 }, { 26198, 23354 }, { 26203, 23355 },
+    { 26204, 23356 }, { 26207, 23357 }, { 26211, 23359 }, { 26208, 23358 },
+    { 26213, 23360 }, { 26199, 23354 }, { 26214, 23364 }, { 26216, 23365 },
+    { 26217, 23369 }, { 26219, 23370 }, { 26220, 23371 }, { 26224, 23374 },
+    { 26225, 23377 }, { 26212, 23359 }, { 26215, 23364 }, { 26226, 23378 },
+    { 26209, 23358 }, { 26218, 23369 }, { 26221, 23372 }, { 26227, 23379 },
+    { 26222, 23372 }, { 26228, 23383 }, { 26232, 23387 }, { 26229, 23386 },
+    { 26205, 23356 }, { 26210, 23358 }, { 26200, 23354 }, { 26234, 23395 },
+    { 26237, 23396 }, { 26235, 23395 }, { 26233, 23387 }, { 26236, 23395 },
+    { 26240, 23397 }, { 26242, 23404 }, { 26201, 23354 }, { 26243, 23405 },
+    { 26246, 23406 }, { 26247, 23407 }, { 26206, 23356 }, { 26248, 23408 },
+    { 26223, 23372 }, { 26249, 23414 }, { 26238, 23396 }, { 26202, 23354 },
+    { 26230, 23386 }, { 26252, 23420 }, { 26250, 23416 }, { 26253, 23421 },
+    { 26239, 23396 }, { 26251, 23416 }, { 26254, 23409 }, { 26255, 23412 },
+    { 26256, 23415 }, { 26257, 23424 }, { 26258, 23428 }, { 26259, 23429 },
+    { 26260, 23430 }, { 26231, 23386 }, { 26261, 23431 }, { 26262, 23432 },
+    { 26263, 23434 }, { 26264, 23437 }, { 26265, 23454 }, { 26266, 23455 },
+    { 26267, 23456 }, { 26269, 23457 }, { 26271, 23458 }, { 26244, 23405 },
+    { 26272, 23460 }, { 26273, 23463 }, { 26274, 23464 }, { 26275, 23469 },
+    { 26276, 23366 }, { 26277, 23373 }, { 26278, 23385 }, { 26279, 23388 },
+    { 26280, 23390 }, { 26281, 23391 }, { 26282, 23394 }, { 26283, 23401 },
+    { 26284, 23402 }, { 26286, 23423 }, { 26270, 23457 }, { 26287, 23427 },
+    { 26241, 23397 }, { 26289, 23381 }, { 26245, 23405 }, { 26268, 23456 },
+    { 26285, 23402 }, { 26290, 23389 }, { 26291, 23392 }, { 26292, 23393 },
+    { 26293, 23418 }, { 26294, 23433 }, { 26295, 23443 }, { 26296, 23444 },
+    { 26298, 23438 }, { 26299, 23445 }, { 26300, 23459 }, { 26301, 23462 },
+    { 26302, 23466 }, { 26303, 23467 }, { 26304, 23473 }, { 26305, 23476 },
+    { 26306, 23481 }, { 26288, 23427 }, { 26297, 23444 }, { 26307, 23496 },
+    { 26308, 23497 }, { 26309, 23361 }, { 26078, 23362 }, { 26077, 23363 },
+    { 26312, 23367 }, { 26313, 23368 }, { 26084, 23375 }, { 26084, 23376 },
+    { 26087, 23380 }, { 26086, 23382 }, { 26085, 23384 }, { 26089, 23398 },
+    { 26089, 23399 }, { 26090, 23400 }, { 26089, 23403 }, { 26323, 23410 },
+    { 26324, 23411 }, { 26325, 23413 }, { 26326, 23417 }, { 26093, 23419 },
+    { 26328, 23422 }, { 26329, 23425 }, { 26100, 23426 }, { 26102, 23435 },
+    { 26332, 23436 }, { 26103, 23439 }, { 26100, 23440 }, { 26335, 23441 },
+    { 26104, 23442 }, { 26104, 23446 }, { 26105, 23447 }, { 26339, 23448 },
+    { 26340, 23449 }, { 26111, 23450 }, { 26342, 23451 }, { 26113, 23452 },
+    { 26344, 23453 }, { 26115, 23461 }, { 26346, 23465 }, { 26347, 23468 },
+    { 26348, 23470 }, { 26118, 23471 }, { 26350, 23472 }, { 26122, 23474 },
+    { 26352, 23475 }, { 26353, 23477 }, { 26354, 23478 }, { 26125, 23479 },
+    { 26126, 23480 }, { 26126, 23482 }, { 26358, 23483 }, { 26129, 23484 },
+    { 26360, 23485 }, { 26361, 23486 }, { 26362, 23487 }, { 26133, 23488 },
+    { 26133, 23489 }, { 26365, 23490 }, { 26366, 23491 }, { 26367, 23492 },
+    { 26368, 23493 }, { 26369, 23494 }, { 26370, 23495 }, { 26139, 23498 },
+    { 26140, 23499 }, { 26373, 23500 }, { 26374, 23501 }, { 26143, 23502 },
+    { 26376, 23503 }, { 26144, 23504 }, { 26145, 23505 }, { 26379, 23506 },
+    { 26147, 23507 }, { 26152, 23508 }, { 26382, 23509 }, { 26153, 23510 },
+    { 26384, 23511 }, { 26385, 23512 }, { 26386, 23513 }, { 26387, 23514 },
+    { 26159, 23515 }, { 26389, 23516 }, { 26158, 23517 }, { 26391, 23518 },
+    { 26160, 23519 }, { 26163, 23520 }, { 26394, 23521 }, { 26164, 23522 },
+    { 26396, 23523 }, { 26397, 23524 }, { 26398, 23525 }, { 26399, 23526 },
+    { 26400, 23567 }, { 26401, 23527 }, { 26402, 23528 }, { 26403, 23529 },
+    { 26404, 23530 }, { 26175, 23531 }, { 26172, 23532 }, { 26173, 23543 },
+    { 26408, 23533 }, { 26409, 23534 }, { 26181, 23535 }, { 26181, 23536 },
+    { 26412, 23537 }, { 26413, 23538 }, { 26414, 23539 }, { 26416, 23540 },
+    { 26186, 23541 }, { 26187, 23542 }, { 26419, 23544 }, { 26190, 23545 },
+    { 26191, 23546 }, { 26422, 23547 }, { 26194, 23548 }, { 26192, 23549 },
+    { 26195, 23550 }, { 26195, 23551 }, { 26427, 23552 }, { 26195, 23553 },
+    { 26429, 23554 }, { 26430, 23555 }, { 26431, 23556 }, { 26199, 23557 },
+    { 26203, 23558 }, { 26434, 23559 }, { 26435, 23560 }, { 26436, 23561 },
+    { 26437, 23562 }, { 26438, 23563 }, { 26209, 23564 }, { 26440, 23565 },
+    { 26441, 23566 }, { 26442, 23568 }, { 26443, 23569 }, { 26444, 23570 },
+    { 26445, 23571 }, { 26446, 23572 }, { 26447, 23573 }, { 26218, 23574 },
+    { 26449, 23575 }, { 26450, 23576 }, { 26220, 23577 }, { 26219, 23578 },
+    { 26222, 23579 }, { 26220, 23580 }, { 26455, 23581 }, { 26456, 23582 },
+    { 26457, 23583 }, { 26458, 23584 }, { 26226, 23585 }, { 26460, 23586 },
+    { 26461, 23587 }, { 26462, 23588 }, { 26232, 23589 }, { 26230, 23590 },
+    { 26465, 23591 }, { 26232, 23592 }, { 26467, 23593 }, { 26238, 23594 },
+    { 26469, 23595 }, { 26470, 23596 }, { 26471, 23597 }, { 26472, 23598 },
+    { 26473, 23599 }, { 26474, 23600 }, { 26245, 23601 }, { 26476, 23602 },
+    { 26477, 23603 }, { 26478, 23604 }, { 26245, 23605 }, { 26250, 23606 },
+    { 26481, 23607 }, { 26248, 23608 }, { 26249, 23609 }, { 26253, 23610 },
+    { 26485, 23611 }, { 26486, 23612 }, { 26487, 23613 }, { 26488, 23614 },
+    { 26259, 23615 }, { 26490, 23616 }, { 26491, 23617 }, { 26492, 23618 },
+    { 26261, 23619 }, { 26494, 23620 }, { 26265, 23621 }, { 26496, 23622 },
+    { 26497, 23623 }, { 26498, 23624 }, { 26499, 23625 }, { 26500, 23626 },
+    { 26501, 23627 }, { 26502, 23628 }, { 26503, 23629 }, { 26272, 23674 },
+    { 26271, 23630 }, { 26275, 23631 }, { 26276, 23632 }, { 26278, 23633 },
+    { 26509, 23634 }, { 26510, 23635 }, { 26511, 23636 }, { 26282, 23637 },
+    { 26281, 23638 }, { 26282, 23639 }, { 26284, 23640 }, { 26282, 23641 },
+    { 26283, 23642 }, { 26289, 23643 }, { 26289, 23644 }, { 26286, 23645 },
+    { 26291, 23646 }, { 26522, 23647 }, { 26289, 23648 }, { 26524, 23649 },
+    { 26525, 23650 }, { 26526, 23651 }, { 26293, 23652 }, { 26528, 23653 },
+    { 26299, 23654 }, { 26530, 23655 }, { 26531, 23656 }, { 26532, 23657 },
+    { 26533, 23658 }, { 26304, 23659 }, { 26304, 23660 }, { 26536, 23661 },
+    { 26304, 23662 }, { 26308, 23663 }, { 26306, 23664 }, { 26540, 23665 },
+    { 26307, 23666 }, { 26308, 23667 }, { 26543, 23668 }, { 26544, 23669 },
+    { 26545, 23670 }, { 26546, 23671 }, { 26547, 23672 }, { 26548, 23673 },
+    { 26550, 23675 }, { 26551, 23676 }, { 26552, 23677 }, { 26553, 23678 },
+    { 26554, 23679 }, { 26555, 23680 }, { 26556, 23681 }, { 26557, 23682 },
+    { 26558, 23683 }, { 26559, 23684 }, { 26560, 23685 }, { 26549, 23673 },
+    { 26561, 23686 }, { 26562, 23687 }, { 26563, 23688 }, { 26564, 23689 },
+    { 26332, 23690 }, { 26566, 23691 }, { 26567, 23692 }, { 26337, 23693 },
+    { 26569, 23694 }, { 26570, 23695 }, { 26341, 23696 }, { 26572, 23697 },
+    { 26339, 23698 }, { 26344, 23699 }, { 26346, 23700 }, { 26345, 23701 },
+    { 26346, 23702 }, { 26344, 23703 }, { 26349, 23704 }, { 26349, 23705 },
+    { 26351, 23706 }, { 26582, 23707 }, { 26350, 23708 }, { 26354, 23709 },
+    { 26355, 23710 }, { 26352, 23711 }, { 26587, 23712 }, { 26588, 23713 },
+    { 26355, 23714 }, { 26590, 23715 }, { 26591, 23716 }, { 26592, 23717 },
+    { 26593, 23718 }, { 26594, 23719 }, { 26365, 23720 }, { 26366, 23721 },
+    { 26597, 23722 }, { 26598, 23723 }, { 26599, 23724 }, { 26371, 23725 },
+    { 26601, 23726 }, { 26372, 23727 }, { 26370, 23728 }, { 26604, 23729 },
+    { 26605, 23730 }, { 26606, 23731 }, { 26607, 23732 }, { 26608, 23733 },
+    { 26609, 23734 }, { 26610, 23735 }, { 26611, 23736 }, { 26382, 23737 },
+    { 26383, 23738 }, { 26385, 23739 }, { 26615, 23740 }, { 26616, 23741 },
+    { 26383, 23742 }, { 26388, 23743 }, { 26389, 23744 }, { 26620, 23745 },
+    { 26621, 23746 }, { 26622, 23747 }, { 26623, 23748 }, { 26624, 23749 },
+    { 26625, 23750 }, { 26626, 23751 }, { 26393, 23752 }, { 26628, 23753 },
+    { 26629, 23754 }, { 26630, 23755 }, { 26631, 23756 }, { 26632, 23757 },
+    { 26633, 23758 }, { 26401, 23759 }, { 26403, 23760 }, { 26636, 23761 },
+    { 26405, 23762 }, { 26409, 23763 }, { 26639, 23764 }, { 26640, 23765 },
+    { 26407, 23766 }, { 26642, 23767 }, { 26643, 23768 }, { 26644, 23769 },
+    { 26414, 23770 }, { 26646, 23771 }, { 26415, 23772 }, { 26416, 23773 },
+    { 26420, 23774 }, { 26421, 23775 }, { 26651, 23776 }, { 26652, 23777 },
+    { 26653, 23778 }, { 26654, 23779 }, { 26655, 23780 }, { 26656, 23781 },
+    { 26424, 23782 }, { 26658, 23783 }, { 26430, 23784 }, { 26430, 23785 },
+    { 26661, 23786 }, { 26662, 23787 }, { 26663, 23788 }, { 26664, 23789 },
+    { 26665, 23790 }, { 26666, 23791 }, { 26667, 23792 }, { 26668, 23793 },
+    { 26669, 23794 }, { 26670, 23795 }, { 26671, 23796 }, { 26442, 23797 },
+    { 26673, 23798 }, { 26674, 23799 }, { 26675, 23800 }, { 26447, 23801 },
+    { 26677, 23802 }, { 26678, 23803 }, { 26447, 23804 }, { 26451, 23805 },
+    { 26448, 23806 }, { 26453, 23807 }, { 26455, 23808 }, { 26452, 23809 },
+    { 26452, 23810 }, { 26453, 23811 }, { 26688, 23812 }, { 26456, 23813 },
+    { 26461, 23814 }, { 26692, 23815 }, { 26463, 23816 }, { 26463, 23817 },
+    { 26466, 23818 }, { 26467, 23819 }, { 26698, 23820 }, { 26699, 23821 },
+    { 26467, 23822 }, { 26701, 23823 }, { 26468, 23824 }, { 26472, 23825 },
+    { 26474, 23826 }, { 26705, 23827 }, { 26476, 23828 }, { 26707, 23829 },
+    { 26708, 23859 }, { 26476, 23830 }, { 26478, 23831 }, { 26711, 23832 },
+    { 26479, 23833 }, { 26483, 23834 }, { 26484, 23835 }, { 26715, 23836 },
+    { 26716, 23837 }, { 26486, 23838 }, { 26718, 23839 }, { 26488, 23840 },
+    { 26720, 23841 }, { 26488, 23842 }, { 26722, 23843 }, { 26723, 23844 },
+    { 26724, 23845 }, { 26725, 23846 }, { 26726, 23847 }, { 26494, 23848 },
+    { 26495, 23849 }, { 26729, 23850 }, { 26730, 23851 }, { 26500, 23852 },
+    { 26732, 23853 }, { 26733, 23854 }, { 26734, 23855 }, { 26735, 23856 },
+    { 26736, 23857 }, { 26508, 23858 }, { 26506, 23860 }, { 26508, 23861 },
+    { 26508, 23862 }, { 26741, 23863 }, { 26512, 23864 }, { 26514, 23865 },
+    { 26516, 23868 }, { 26517, 23866 }, { 26514, 23867 }, { 26517, 23869 },
+    { 26517, 23870 }, { 26516, 23871 }, { 26521, 23872 }, { 26519, 23873 },
+    { 26753, 23874 }, { 26525, 23875 }, { 26521, 23876 }, { 26523, 23877 },
+    { 26757, 23878 }, { 26528, 23879 }, { 26759, 23880 }, { 26530, 23881 },
+    { 26761, 23882 }, { 26762, 23883 }, { 26533, 23884 }, { 26531, 23885 },
+    { 26531, 23886 }, { 26532, 23887 }, { 26535, 23888 }, { 26768, 23889 },
+    { 26769, 23890 }, { 26770, 23891 }, { 26542, 23892 }, { 26772, 23893 },
+    { 26773, 23894 }, { 26774, 23895 }, { 26775, 23896 }, { 26776, 23897 },
+    { 26547, 23898 }, { 26778, 23899 }, { 26547, 23900 }, { 26780, 23901 },
+    { 26781, 23902 }, { 26551, 23903 }, { 26549, 23904 }, { 26553, 23905 },
+    { 26785, 23906 }, { 26786, 23907 }, { 26557, 23908 }, { 26558, 23909 },
+    { 26558, 23910 }, { 26560, 23911 }, { 26791, 23912 }, { 26561, 23913 },
+    { 26560, 23914 }, { 26794, 23915 }, { 26562, 23916 }, { 26796, 23917 },
+    { 26567, 23918 }, { 26568, 23928 }, { 26799, 23919 }, { 26568, 23920 },
+    { 26571, 23921 }, { 26569, 23971 }, { 26573, 23922 }, { 26572, 23923 },
+    { 26805, 23924 }, { 26806, 23925 }, { 26807, 23926 }, { 26575, 23927 },
+    { 26578, 23929 }, { 26810, 23930 }, { 26579, 23931 }, { 26812, 23932 },
+    { 26583, 23933 }, { 26582, 23934 }, { 26815, 23935 }, { 26816, 23936 },
+    { 26817, 23937 }, { 26818, 23938 }, { 26819, 23939 }, { 26588, 23940 },
+    { 26588, 23941 }, { 26592, 23942 }, { 26823, 23943 }, { 26592, 23944 },
+    { 26825, 23945 }, { 26826, 23946 }, { 26597, 23947 }, { 26598, 23948 },
+    { 26599, 23949 }, { 26600, 23950 }, { 26831, 23951 }, { 26600, 23952 },
+    { 26833, 23953 }, { 26604, 23954 }, { 26605, 23955 }, { 26603, 23956 },
+    { 26837, 23957 }, { 26838, 23958 }, { 26839, 23959 }, { 26840, 23960 },
+    { 26841, 23961 }, { 26613, 23962 }, { 26843, 23963 }, { 26844, 23964 },
+    { 26611, 23965 }, { 26615, 23966 }, { 26617, 23967 }, { 26848, 23968 },
+    { 26620, 23969 }, { 26850, 23970 }, { 26851, 23972 }, { 26852, 23973 },
+    { 26853, 23974 }, { 26621, 23975 }, { 26625, 23976 }, { 26626, 23977 },
+    { 26857, 23978 }, { 26858, 23979 }, { 26859, 23980 }, { 26860, 23981 },
+    { 26861, 23982 }, { 26630, 23983 }, { 26631, 23984 }, { 26864, 23985 },
+    { 26865, 23986 }, { 26866, 23987 }, { 26637, 23988 }, { 26634, 23989 },
+    { 26869, 23990 }, { 26870, 23991 }, { 26641, 23992 }, { 26872, 23993 },
+    { 26644, 23994 }, { 26644, 23995 }, { 26644, 23996 }, { 26644, 24013 },
+    { 26878, 23997 }, { 26879, 23998 }, { 26880, 23999 }, { 26649, 24000 },
+    { 26882, 24001 }, { 26883, 24002 }, { 26884, 24003 }, { 26655, 24004 },
+    { 26886, 24005 }, { 26888, 24006 }, { 26657, 24007 }, { 26890, 24008 },
+    { 26658, 24009 }, { 26662, 24010 }, { 26893, 24011 }, { 26664, 24012 },
+    { 26896, 24014 }, { 26897, 24015 }, { 26668, 24016 }, { 26666, 24017 },
+    { 26667, 24018 }, { 26902, 24019 }, { 26903, 24020 }, { 26904, 24021 },
+    { 26671, 24022 }, { 26906, 24023 }, { 26907, 24024 }, { 26908, 24025 },
+    { 26676, 24026 }, { 26678, 24027 }, { 26678, 24028 }, { 26912, 24029 },
+    { 26913, 24030 }, { 26914, 24031 }, { 26682, 24032 }, { 26686, 24033 },
+    { 26917, 24034 }, { 26688, 24035 }, { 26689, 24036 }, { 26920, 24037 },
+    { 26921, 24038 }, { 26690, 24039 }, { 26923, 24040 }, { 26924, 24041 },
+    { 26925, 24042 }, { 26926, 24043 }, { 26695, 24044 }, { 26697, 24045 },
+    { 26699, 24046 }, { 26700, 24047 }, { 26701, 24048 }, { 26932, 24049 },
+    { 26933, 24050 }, { 26934, 24051 }, { 26935, 24052 }, { 26936, 24053 },
+    { 26937, 24054 }, { 26938, 24055 }, { 26939, 24056 }, { 26940, 24057 },
+    { 26707, 24058 }, { 26942, 24059 }, { 26709, 24060 }, { 26944, 24061 },
+    { 26945, 24062 }, { 26946, 24063 }, { 26717, 24064 }, { 26718, 24065 },
+    { 26720, 24066 }, { 26950, 24067 }, { 26951, 24068 }, { 26721, 24069 },
+    { 26720, 24070 }, { 26722, 24071 }, { 26955, 24072 }, { 26723, 24073 },
+    { 26957, 24074 }, { 26958, 24075 }, { 26729, 24076 }, { 26960, 24077 },
+    { 26961, 24078 }, { 26962, 24079 }, { 26731, 24080 }, { 26964, 24081 },
+    { 26735, 24082 }, { 26966, 24083 }, { 26736, 24084 }, { 26737, 24085 },
+    { 26969, 24086 }, { 26739, 24087 }, { 26741, 24088 }, { 26742, 24089 },
+    { 26973, 24090 }, { 26974, 24091 }, { 26975, 24092 }, { 26976, 24093 },
+    { 26745, 24094 }, { 26746, 24095 }, { 26979, 24096 }, { 26980, 24097 },
+    { 26751, 24098 }, { 26982, 24099 }, { 26751, 24100 }, { 26752, 24101 },
+    { 26756, 24102 }, { -15, 24103 }, { 26801, 24104 }, { -66, 24105 },
+    { -83, 24106 }, { 26840, 24107 }, { 26838, 24108 }, { -133, 24109 },
+    { -143, 24110 }, { 26845, 24111 }, { 26854, 24112 }, { 26848, 24113 },
+    { 26807, 24114 }, { -222, 24115 }, { 26820, 24116 }, { 26832, 24117 },
+    { 26836, 24118 }, { 26805, 24119 }, { -386, 24120 }, { -417, 24121 },
+    { -427, 24122 }, { -458, 24123 }, { -475, 24124 }, { 26836, 24125 },
+    { 26862, 24126 }, { 26866, 24127 }, { 26813, 24128 }, { -593, 24129 },
+    { 26867, 24130 }, { -620, 24131 }, { -637, 24132 }, { -675, 24133 },
+    { -685, 24134 }, { 26869, 24135 }, { -771, 24136 }, { -795, 24137 },
+    { -805, 24138 }, { -871, 24139 }, { -951, 24140 }, { -1007, 24141 },
+    { -1017, 24142 }, { -1027, 24143 }, { -1037, 24144 }, { 26832, 24145 },
+    { -1079, 24146 }, { 26875, 24147 }, { 26815, 24148 }, { 26855, 24149 },
+    { 26837, 24150 }, { -1213, 24151 }, { 26852, 24152 }, { 26842, 24153 },
+    { 26873, 24177 }, { 26842, 24153 }, { 26874, 24154 }, { 26883, 24155 },
+    { 26868, 24156 }, { 26858, 24157 }, { 26867, 24158 }, { 26887, 24159 },
+    { 26843, 24160 }, { 26881, 24161 }, { -1415, 24162 }, { -1432, 24163 },
+    { -1449, 24164 }, { 26884, 24165 }, { 26846, 24166 }, { 26835, 24167 },
+    { 26838, 24168 }, { -1749, 24169 }, { -1763, 24170 }, { 26836, 24171 },
+    { -1825, 24172 }, { -1890, 24173 }, { -1900, 24174 }, { 26882, 24175 },
+    { 26859, 24176 }, { 26861, 24178 }, { 26847, 24179 }, { 26897, 24180 },
+    { -2066, 24181 }, { -2076, 24182 }, { -2086, 24183 }, { -2096, 24184 },
+    { -2106, 24185 }, { -2116, 24186 }, { 26891, 24187 }, { -2139, 24188 },
+    { -2149, 24189 }, { -2159, 24190 }, { -2169, 24191 }, { -2179, 24192 },
+    { -2189, 24193 }, { -2199, 24194 }, { -2209, 24195 }, { -2233, 24196 },
+    { -2243, 24197 }, { -2253, 24198 }, { -2263, 24199 }, { -2273, 24200 },
+    { -2290, 24201 }, { -2300, 24202 }, { -2310, 24203 }, { -2320, 24204 },
+    { -2330, 24205 }, { -2340, 24206 }, { -2350, 24207 }, { -2367, 24208 },
+    { -2377, 24209 }, { -2387, 24210 }, { -2397, 24211 }, { -2407, 24212 },
+    { -2417, 24213 }, { -2448, 24214 }, { -2458, 24215 }, { -2468, 24216 },
+    { -2478, 24217 }, { 26873, 24218 }, { 26874, 24242 }, { -2541, 24219 },
+    { -2551, 24220 }, { -2561, 24221 }, { -2571, 24222 }, { -2581, 24223 },
+    { -2598, 24224 }, { -2608, 24225 }, { -2618, 24226 }, { -2628, 24227 },
+    { -2638, 24228 }, { -2648, 24229 }, { -2658, 24230 }, { 26899, 24231 },
+    { -2702, 24232 }, { -2712, 24233 }, { -2722, 24234 }, { -2732, 24235 },
+    { -2742, 24236 }, { -2752, 24237 }, { -2776, 24238 }, { -2786, 24239 },
+    { -2796, 24240 }, { -2806, 24241 }, { 26878, 24243 }, { -2836, 24244 },
+    { -2853, 24245 }, { -2863, 24257 }, { 26844, 24246 }, { 26859, 24247 },
+    { 26900, 24248 }, { -2933, 24249 }, { -2943, 24250 }, { -2953, 24251 },
+    { -2963, 24252 }, { -2980, 24253 }, { -2990, 24254 }, { -3007, 24255 },
+    { -3017, 24256 }, { -3027, 24258 }, { -3058, 24259 }, { -3075, 24260 },
+    { -3085, 24261 }, { -3095, 24266 }, { -3105, 24262 }, { -3115, 24263 },
+    { -3125, 24264 }, { -3142, 24265 }, { -3159, 24267 }, { -3169, 24268 },
+    { -3179, 24269 }, { -3203, 24270 }, { -3213, 24271 }, { -3223, 24272 },
+    { -3240, 24273 }, { -3257, 24274 }, { -3267, 24275 }, { -3277, 24276 },
+    { 26904, 24277 }, { -3300, 24278 }, { -3310, 24279 }, { -3334, 24280 },
+    { -3344, 24281 }, { -3354, 24282 }, { -3364, 24283 }, { -3374, 24284 },
+    { -3384, 24285 }, { -3394, 24286 }, { -3404, 24287 }, { -3414, 24288 },
+    { -3431, 24289 }, { -3462, 24290 }, { -3479, 24291 }, { -3510, 24292 },
+    { -3520, 24293 }, { -3530, 24294 }, { -3540, 24295 }, { -3550, 24296 },
+    { -3560, 24297 }, { -3577, 24298 }, { -3594, 24299 }, { -3611, 24300 },
+    { 26861, 24301 }, { 26862, 24302 }, { -3653, 24303 }, { -3663, 24304 },
+    { -3673, 24305 }, { -3697, 24306 }, { -3707, 24307 }, { -3717, 24308 },
+    { -3727, 24309 }, { -3737, 24311 }, { 26899, 24310 }, { 26868, 24312 },
+    { 26909, 24313 }, { 26863, 24314 }, { 26858, 24315 }, { 26869, 24316 },
+    { -4031, 24317 }, { -4066, 24318 }, { 26917, 24319 }, { 26879, 24320 },
+    { 26885, 24321 }, { 26886, 24322 }, { -4305, 24323 }, { -4365, 24324 },
+    { -4393, 24325 }, { -4403, 24326 }, { -4427, 24327 }, { 26865, 24328 },
+    { 26910, 24329 }, { -4466, 24330 }, { 26911, 24331 }, { 26905, 24331 },
+    { -4505, 24332 }, { 26900, 24333 }, { 26876, 24334 }, { 26869, 24335 },
+    { 26896, 24336 }, { 26915, 24337 }, { -5475, 24338 }, { 26893, 24339 },
+    { -5505, 24340 }, { 26918, 24341 }, { 26873, 24342 }, { -5604, 24343 },
+    { 26927, 24344 }, { -5719, 24345 }, { 26915, 24346 }, { -5787, 24347 },
+    { -5797, 24348 }, { -5814, 24349 }, { 26933, 24350 }, { -5865, 24351 },
+    { 26893, 24352 }, { 26910, 24353 }, { 26913, 24354 }, { 26914, 24355 },
+    { 26894, 24356 }, { -6119, 24357 }, { 26914, 24358 }, { -6191, 24359 },
+    { 26886, 24360 }, { -6302, 24361 }, { -6312, 24362 }, { -6364, 24363 },
+    { -6395, 24364 }, { -6479, 24365 }, { 26937, 24366 }, { -6516, 24367 },
+    { -6625, 24368 }, { 26938, 24369 }, { -6670, 24370 }, { -6701, 24371 },
+    { -6711, 24372 }, { -6721, 24373 }, { 26948, 24374 }, { 26925, 24375 },
+    { -6905, 24376 }, { 26892, 24377 }, { -7154, 24378 }, { -7164, 24379 },
+    { -7202, 24380 }, { -7212, 24381 }, { -7229, 24382 }, { -7260, 24383 },
+    { -7291, 24384 }, { -7308, 24385 }, { -7318, 24386 }, { -7405, 24387 },
+    { -7426, 24388 }, { -7440, 24389 }, { 26927, 24390 }, { -7573, 24391 },
+    { -7602, 24392 }, { -7665, 24393 }, { -7794, 24394 }, { -7825, 24395 },
+    { -7835, 24396 }, { -7859, 24397 }, { -7869, 24398 }, { -7879, 24399 },
+    { -7918, 24400 }, { -7928, 24401 }, { -7945, 24402 }, { -7955, 24403 },
+    { -7987, 24404 }, { -8011, 24405 }, { -8070, 24406 }, { 26938, 24407 },
+    { -8177, 24408 }, { -8191, 24409 }, { -8201, 24410 }, { -8211, 24411 },
+    { 26892, 24412 }, { -8289, 24413 }, { -8636, 24414 }, { -8646, 24415 },
+    { -8722, 24416 }, { -8761, 24417 }, { -8792, 24418 }, { 26898, 24419 },
+    { -8815, 24420 }, { 26947, 24421 }, { -8853, 24422 }, { 26923, 24423 },
+    { 26918, 24424 }, { 26913, 24425 }, { -9050, 24426 }, { 26904, 24427 },
+    { -9117, 24428 }, { 26950, 24429 }, { 26947, 24430 }, { 26900, 24429 },
+    { -9247, 24431 }, { 26941, 24432 }, { -9310, 24433 }, { -9320, 24434 },
+    { 26909, 24435 }, { -9343, 24436 }, { -9388, 24437 }, { -9440, 24438 },
+    { -9457, 24439 }, { -9467, 24440 }, { -9477, 24441 }, { 26919, 24442 },
+    { -9598, 24443 }, { -9634, 24444 }, { -9791, 24445 }, { -9815, 24446 },
+    { -9895, 24447 }, { -9919, 24448 }, { -9929, 24449 }, { -9988, 24450 },
+    { -10012, 24451 }, { -10141, 24452 }, { -10151, 24453 }, { -10189, 24454 },
+    { -10206, 24455 }, { 26963, 24456 }, { -10289, 24457 }, { 26963, 24458 },
+    { -10397, 24459 }, { 26958, 24460 }, { 26948, 24461 }, { 26942, 24462 },
+    { -10527, 24463 }, { -10607, 24464 }, { -10659, 24465 }, { -10720, 24466 },
+    { 26968, 24467 }, { -10882, 24468 }, { -10977, 24469 }, { -11008, 24470 },
+    { 26967, 24471 }, { 26968, 24472 }, { 26918, 24473 }, { 26967, 24474 },
+    { 26952, 24475 }, { 26960, 24476 }, { -11236, 24477 }, { 26958, 24478 },
+    { 26974, 24479 }, { 26937, 24480 }, { -11549, 24481 }, { -11559, 24482 },
+    { -11576, 24483 }, { -11586, 24484 }, { -11610, 24485 }, { 26946, 24486 },
+    { 26936, 24487 }, { 26923, 24488 }, { 26977, 24489 }, { 26957, 24490 },
+    { 26958, 24491 }, { 26973, 24492 }, { -11833, 24493 }, { 26954, 24494 },
+    { 26945, 24495 }, { -11873, 24496 }, { -11883, 24497 }, { -11893, 24498 },
+    { 26962, 24499 }, { 26944, 24500 }, { -11997, 24501 }, { 26957, 24502 },
+    { 26958, 24503 }, { -12033, 24504 }, { -12043, 24505 }, { 26934, 24506 },
+    { 26987, 24507 }, { -12275, 24508 }, { 26995, 24509 }, { 26940, 24510 },
+    { 26944, 24511 }, { -12394, 24512 }, { 27000, 24513 }, { -12498, 24514 },
+    { -12508, 24515 }, { 26950, 24516 }, { -12548, 24517 }, { -12558, 24518 },
+    { -12575, 24519 }, { -12585, 24520 }, { -12595, 24521 }, { -12647, 24522 },
+    { 26951, 24523 }, { 26988, 24524 }, { 26978, 24525 }, { -12864, 24526 },
+    { -12930, 24527 }, { 26957, 24528 }, { -13021, 24529 }, { -13031, 24530 },
+    { 26985, 24531 }, { -13068, 24532 }, { -13096, 24533 }, { 27001, 24534 },
+    { -13145, 24535 }, { 27000, 24536 }, { -13266, 24537 }, { -13311, 24538 },
+    { -13342, 24539 }, { 26952, 24540 }, { -13655, 24541 }, { -13665, 24542 },
+    { 26977, 24543 }, { 26996, 24544 }, { 27001, 24545 }, { 26993, 24546 },
+    { -13858, 24547 }, { 27009, 24548 }, { 27010, 24549 }, { -13908, 24550 },
+    { 27011, 24551 }, { -13966, 24552 }, { -14018, 24553 }, { -14077, 24554 },
+    { 26969, 24555 }, { -14150, 24556 }, { 26996, 24557 }, { 26997, 24558 },
+    { 26963, 24559 }, { -14300, 24560 }, { -14349, 24561 }, { 26960, 24562 },
+    { -14372, 24563 }, { 26989, 24564 }, { -14428, 24565 }, { 26962, 24566 },
+    { -14539, 24567 }, { -14623, 24568 }, { 27008, 24569 }, { -14646, 24570 },
+    { 26992, 24571 }, { 27008, 24571 }, { 27009, 24572 }, { 27018, 24573 },
+    { -14765, 24574 }, { 26972, 24575 }, { -14904, 24576 }, { 26992, 24577 },
+    { 26975, 24578 }, { -14954, 24579 }, { -14978, 24580 }, { -14988, 24581 },
+    { -14998, 24582 }, { -15008, 24583 }, { 27011, 24584 }, { -15129, 24585 },
+    { -15146, 24586 }, { -15156, 24587 }, { 27019, 24588 }, { -15350, 24589 },
+    { -15402, 24590 }, { -15412, 24591 }, { -15429, 24592 }, { -15439, 24593 },
+    { 26977, 24594 }, { -15518, 24595 }, { -15546, 24596 }, { -15584, 24597 },
+    { -15594, 24598 }, { 27027, 24599 }, { -15624, 24600 }, { -15634, 24601 },
+    { -15651, 24602 }, { 27032, 24603 }, { 26974, 24604 }, { -15687, 24605 },
+    { -15704, 24606 }, { 27002, 24607 }, { 27033, 24608 }, { 27028, 24609 },
+    { 27034, 24610 }, { 27009, 24611 }, { 27025, 24612 }, { -15827, 24613 },
+    { -15844, 24614 }, { 27016, 24615 }, { 27016, 24616 }, { 26998, 24617 },
+    { -16180, 24618 }, { -16211, 24619 }, { -16242, 24620 }, { 26991, 24621 },
+    { -16321, 24622 }, { 27022, 24623 }, { -16396, 24624 }, { 26993, 24625 },
+    { 27045, 24626 }, { 27028, 24627 }, { -16634, 24628 }, { 26997, 24629 },
+    { -16657, 24630 }, { -16667, 24631 }, { -16677, 24632 }, { 27046, 24633 },
+    { 27006, 24634 }, { 27026, 24635 }, { -16947, 24636 }, { 27049, 24637 },
+    { -17013, 24638 }, { -17023, 24639 }, { -17087, 24640 }, { -17136, 24641 },
+    { -17160, 24642 }, { -17170, 24643 }, { -17198, 24644 }, { -17220, 24645 },
+    { 27021, 24646 }, { 27010, 24647 }, { -17285, 24648 }, { 27051, 24649 },
+    { 27052, 24650 }, { -17349, 24651 }, { 27033, 24652 }, { -17397, 24653 },
+    { 27054, 24654 }, { 27047, 24655 }, { -17500, 24656 }, { 27005, 24657 },
+    { 27007, 24658 }, { -17611, 24659 }, { -17621, 24660 }, { 27030, 24661 },
+    { 27041, 24662 }, { 27026, 24663 }, { -17878, 24664 }, { 27051, 24665 },
+    { 27050, 24666 }, { -17967, 24667 }, { -17977, 24668 }, { -17987, 24669 },
+    { 27013, 24670 }, { 27058, 24671 }, { -18068, 24672 }, { 27040, 24673 },
+    { 26940, 24443 }, { -18151, 24674 }, { -18161, 24675 }, { -18171, 24676 },
+    { -18195, 24677 }, { -18268, 24678 }, { -18320, 24679 }, { -18330, 24680 },
+    { 27038, 24681 }, { 27019, 24682 }, { -18509, 24683 }, { 27069, 24684 },
+    { -18539, 24685 }, { -18577, 24686 }, { -18664, 24687 }, { 27070, 24688 },
+    { -18743, 24689 }, { -18760, 24690 }, { -18791, 24691 }, { -18801, 24692 },
+    { -18818, 24693 }, { -18828, 24694 }, { -18866, 24695 }, { -19016, 24696 },
+    { 27051, 24697 }, { 27021, 24698 }, { -19108, 24699 }, { -19118, 24700 },
+    { -19128, 24701 }, { -19194, 24702 }, { 27019, 24703 }, { -19238, 24704 },
+    { -19248, 24705 }, { -19286, 24706 }, { -19324, 24707 }, { -19355, 24708 },
+    { 27030, 24709 }, { -19406, 24710 }, { -19451, 24711 }, { -19461, 24712 },
+    { -19485, 24713 }, { -19523, 24714 }, { -19568, 24715 }, { 27049, 24716 },
+    { 27025, 24717 }, { -19646, 24718 }, { -19677, 24719 }, { -19701, 24720 },
+    { -19718, 24721 }, { -19777, 24722 }, { -19787, 24723 }, { 27026, 24724 },
+    { 27024, 24725 }, { 27040, 24725 }, { 27047, 24726 }, { 27028, 24727 },
+    { -19925, 24728 }, { 27066, 24729 }, { -19976, 24730 }, { -19986, 24731 },
+    { 27055, 24732 }, { 27036, 24733 }, { -20085, 24734 }, { -20144, 24735 },
+    { 27091, 24736 }, { 27077, 24737 }, { -20379, 24738 }, { 27082, 24739 },
+    { -20599, 24740 }, { 27035, 24741 }, { 27089, 24742 }, { -20663, 24743 },
+    { -20681, 24744 }, { -20695, 24745 }, { -20705, 24746 }, { 27082, 24747 },
+    { 27082, 24748 }, { -20866, 24749 }, { -20911, 24750 }, { 27091, 24751 },
+    { 27041, 24752 }, { 27055, 24753 }, { 27075, 24754 }, { -21359, 24755 },
+    { 27063, 24756 }, { -21393, 24757 }, { -21452, 24758 }, { -21462, 24765 },
+    { -21472, 24786 }, { -21482, 24794 }, { -21492, 24803 }, { -21502, 24759 },
+    { -21512, 24760 }, { -21522, 24784 }, { -21532, 24798 }, { -21542, 24761 },
+    { -21552, 24763 }, { -21562, 24776 }, { -21572, 24785 }, { -21582, 24762 },
+    { -21592, 24773 }, { -21602, 24764 }, { -21612, 24766 }, { -21622, 24774 },
+    { -21632, 24767 }, { -21642, 24768 }, { -21652, 24777 }, { -21662, 24769 },
+    { -21672, 24770 }, { -21682, 24778 }, { -21692, 24780 }, { -21702, 24800 },
+    { -21712, 24771 }, { -21722, 24772 }, { -21732, 24775 }, { -21742, 24779 },
+    { -21752, 24781 }, { -21762, 24783 }, { -21772, 24804 }, { -21782, 24817 },
+    { -21792, 24782 }, { -21802, 24790 }, { -21812, 24787 }, { -21822, 24789 },
+    { -21832, 24791 }, { -21842, 24788 }, { -21852, 24802 }, { -21862, 24808 },
+    { -21872, 24792 }, { -21882, 24844 }, { -21892, 24793 }, { -21902, 24795 },
+    { -21912, 24827 }, { -21922, 24846 }, { -21932, 24796 }, { -21942, 24797 },
+    { -21952, 24799 }, { -21962, 24801 }, { -21972, 24806 }, { -21982, 24809 },
+    { -21992, 24805 }, { -22002, 24807 }, { -22012, 24810 }, { -22022, 24811 },
+    { -22032, 24812 }, { -22042, 24813 }, { -22052, 24814 }, { -22062, 24815 },
+    { -22072, 24816 }, { -22082, 24818 }, { -22092, 24819 }, { -22102, 24820 },
+    { -22112, 24821 }, { -22122, 24822 }, { -22132, 24823 }, { -22142, 24824 },
+    { -22152, 24847 }, { -22162, 24825 }, { -22172, 24842 }, { -22182, 24826 },
+    { -22192, 24828 }, { -22202, 24829 }, { -22212, 24830 }, { -22222, 24831 },
+    { -22232, 24832 }, { -22242, 24833 }, { -22252, 24834 }, { -22262, 24835 },
+    { -22272, 24836 }, { -22282, 24837 }, { -22292, 24838 }, { -22302, 24839 },
+    { -22312, 24840 }, { -22322, 24848 }, { -22332, 24841 }, { -22342, 24843 },
+    { -22352, 24865 }, { -22362, 24845 }, { -22372, 24849 }, { -22382, 24850 },
+    { -22392, 24851 }, { -22402, 24852 }, { -22412, 24853 }, { -22422, 24854 },
+    { -22432, 24855 }, { -22442, 24866 }, { -22452, 24856 }, { -22462, 24857 },
+    { -22472, 24858 }, { -22482, 24859 }, { -22492, 24860 }, { -22502, 24861 },
+    { -22512, 24862 }, { -22522, 24863 }, { -22532, 24864 }, { -22542, 24867 },
+    { -22552, 24868 }, { -22583, 24869 }, { 27073, 24870 }, { 27082, 24871 },
+    { -22687, 24872 }, { -22771, 24873 }, { 27100, 24874 }, { 27053, 24875 },
+    { 27052, 24876 }, { 27061, 24877 }, { 27102, 24878 }, { 27109, 24879 },
+    { 27056, 24880 }, { 27068, 24881 }, { 27101, 24882 }, { -23056, 24883 },
+    { -23081, 24884 }, { -23191, 24885 }, { -23215, 24886 }, { 27086, 24887 },
+    { -23252, 24888 }, { -23285, 24889 }, { 27056, 24890 }, { 27059, 24891 },
+    { -23384, 24892 }, { 27090, 24893 }, { 27058, 24894 }, { -23489, 24895 },
+    { 27093, 24896 }, { 27096, 24897 }, { 27097, 24898 }, { -23583, 24899 },
+    { -23593, 24900 }, { 27066, 24901 }, { -23679, 24902 }, { 27116, 24903 },
+    { -23776, 24904 }, { 27120, 24905 }, { -23813, 24906 }, { -23837, 24907 },
+    { -23868, 24908 }, { 27097, 24909 }, { -23947, 24910 }, { 27068, 24911 },
+    { -24103, 24912 }, { -24158, 24913 }, { -24238, 24914 }, { 27113, 24915 },
+    { 27124, 24916 }, { 27102, 24917 }, { -24452, 24918 }, { 27096, 24919 },
+    { -24493, 24920 }, { -24503, 24921 }, { -24520, 24922 }, { 27084, 24923 },
+    { 27088, 24924 }, { -24741, 24925 }, { -24765, 24926 }, { -24775, 24927 },
+    { -24792, 24928 }, { -24890, 24929 }, { -25049, 24930 }, { 27109, 24931 },
+    { 27093, 24932 }, { -25185, 24933 }, { -25202, 24934 }, { 27120, 24935 },
+    { -25256, 24936 }, { 27134, 24937 }, { 27135, 24938 }, { -25386, 24939 },
+    { 27126, 24940 }, { 27084, 24941 }, { -25521, 24942 }, { 27135, 24943 },
+    { -25588, 24944 }, { -25616, 24945 }, { -25686, 24946 }, { -25696, 24947 },
+    { 27083, 24948 }, { -25737, 24949 }, { 27110, 24950 }, { -25810, 24951 },
+    { 27083, 24952 }, { 27126, 24953 }, { -25881, 24954 }, { 27092, 24955 },
+    { -25919, 24956 }, { -25957, 24957 }, { -25967, 24958 }, { -26005, 24959 },
+    { -26015, 24960 }, { -26046, 24961 }, { -26084, 24962 }, { -26115, 24963 },
+    { -26146, 24964 }, { 27133, 24965 }, { 27087, 24966 }, { 27088, 24967 },
+    { -26272, 24968 }, { -26296, 24969 }, { 27087, 24970 }, { 27146, 24971 },
+    { -26401, 24972 }, { -26432, 24973 }, { -26449, 24974 }, { 27132, 24971 },
+    { -26487, 24975 }, { 27125, 24976 }, { 27126, 24977 }, { -26559, 24978 },
+    { 27095, 24979 }, { 27127, 24980 }, { -26644, 24981 }, { 27094, 24982 },
+    { 27131, 24983 }, { 27151, 24984 }, { 27139, 24985 }, { -26745, 24986 },
+    { 27128, 24987 }, { -26821, 24988 }, { -26849, 24989 }, { -26870, 24990 },
+    { 27159, 24991 }, { 27156, 24992 }, { -26969, 24993 }, { -26990, 24994 },
+    { -27000, 24995 }, { -27010, 24996 }, { -27020, 24997 }, { 27119, 24998 },
+    { -27065, 24999 }, { -27075, 25000 }, { -27189, 25001 }, { -27199, 25002 },
+    { -27234, 25003 }, { -27262, 25004 }, { -27272, 25005 }, { -27289, 25006 },
+    { 27103, 25007 }, { -27358, 25008 }, { -27389, 25009 }, { 27145, 25010 },
+    { 27134, 25011 }, { 27145, 25012 }, { 27144, 25013 }, { -27534, 25014 },
+    { -27544, 25015 }, { -27561, 25016 }, { -27571, 25017 }, { 27131, 25018 },
+    { -27601, 25019 }, { -27611, 25020 }, { -27621, 25021 }, { 27163, 25022 },
+    { 27135, 25023 }, { -27737, 25024 }, { 27113, 25025 }, { -27760, 25026 },
+    { 27161, 25027 }, { -27804, 25028 }, { -27828, 25029 }, { -27859, 25030 },
+    { -27971, 25031 }, { -27981, 25032 }, { -28002, 25033 }, { 27172, 25034 },
+    { -28058, 25035 }, { -28068, 25036 }, { -28085, 25037 }, { 27176, 25038 },
+    { 27116, 25039 }, { -28175, 25040 }, { 27148, 25041 }, { 27149, 25042 },
+    { 27133, 25043 }, { -28280, 25044 }, { -28479, 25045 }, { -28504, 25046 },
+    { -28521, 25047 }, { 27146, 25048 }, { -28631, 25049 }, { -28684, 25050 },
+    { -28760, 25051 }, { 27157, 25052 }, { -28892, 25053 }, { 27176, 25054 },
+    { -28922, 25055 }, { -29093, 25056 }, { -29110, 25057 }, { -29169, 25058 },
+    { -29214, 25059 }, { -29251, 25060 }, { -29261, 25061 }, { -29271, 25062 },
+    { 27125, 25063 }, { 27126, 25064 }, { 27166, 25065 }, { 27164, 25066 },
+    { 27156, 25067 }, { -29541, 25068 }, { -29551, 25069 }, { -29561, 25070 },
+    { 27172, 25071 }, { 27171, 25072 }, { 27172, 25073 }, { 27171, 25074 },
+    { 27138, 25075 }, { 27176, 25076 }, { 27135, 25077 }, { 27160, 25078 },
+    { 27191, 25079 }, { 27136, 25080 }, { -29938, 25081 }, { 27182, 25082 },
+    { -30050, 25083 }, { -30092, 25084 }, { -30102, 25085 }, { 27194, 25086 },
+    { -30203, 25087 }, { 27195, 25088 }, { -30240, 25089 }, { -30250, 25090 },
+    { -30383, 25091 }, { -30393, 25092 }, { 27163, 25093 }, { 27150, 25094 },
+    { -30538, 25095 }, { 27205, 25096 }, { 27148, 25097 }, { 27194, 25098 },
+    { -30868, 25099 }, { 27181, 25100 }, { 27182, 25101 }, { -30936, 25102 },
+    { -30953, 25103 }, { -30963, 25104 }, { -30973, 25105 }, { -30990, 25106 },
+    { -31000, 25107 }, { -31010, 25119 }, { -31020, 25108 }, { -31030, 25109 },
+    { -31047, 25110 }, { -31057, 25111 }, { -31074, 25112 }, { -31084, 25113 },
+    { -31094, 25114 }, { -31104, 25115 }, { -31114, 25116 }, { -31124, 25117 },
+    { -31134, 25118 }, { -31144, 25120 }, { -31154, 25121 }, { -31164, 25122 },
+    { -31285, 25123 }, { 27210, 25124 }, { -31328, 25125 }, { -31366, 25126 },
+    { 27152, 25127 }, { -31389, 25128 }, { -31413, 25129 }, { 27176, 25130 },
+    { -31460, 25131 }, { 27184, 25132 }, { 27163, 25133 }, { 27154, 25134 },
+    { 27168, 25135 }, { 27195, 25136 }, { 27195, 25137 }, { 27171, 25138 },
+    { 27220, 25139 }, { 27160, 25140 }, { -31935, 25141 }, { 27211, 25142 },
+    { 27208, 25143 }, { 27176, 25144 }, { 27218, 25145 }, { -32211, 25146 },
+    { -32221, 25147 }, { 27199, 25148 }, { -32356, 25149 }, { -32440, 25150 },
+    { -32454, 25151 }, { -32464, 25152 }, { -32576, 25153 }, { 27212, 25154 },
+    { 27213, 25155 }, { -32705, 25156 }, { -32722, 25157 }, { -32732, 25158 },
+    { 27170, 25159 }, { -32810, 25160 }, { 27216, 25161 }, { 27184, 25162 },
+    { -32949, 25163 }, { -32974, 25164 }, { -32991, 25165 }, { -33015, 25166 },
+    { -33045, 25167 }, { -33055, 25168 }, { -33072, 25169 }, { -33082, 25170 },
+    { 27192, 25171 }, { 27171, 25172 }, { 27176, 25173 }, { -33238, 25174 },
+    { -33248, 25175 }, { 27197, 25176 }, { 27221, 25177 }, { 27222, 25178 },
+    { -33368, 25179 }, { -33385, 25180 }, { -33395, 25181 }, { -33486, 25182 },
+    { -33496, 25183 }, { -33506, 25184 }, { -33530, 25185 }, { 27231, 25186 },
+    { -33595, 25187 }, { -33616, 25188 }, { -33626, 25189 }, { -33643, 25190 },
+    { -33653, 25191 }, { -33684, 25192 }, { 27226, 25193 }, { 27214, 25194 },
+    { -33983, 25195 }, { 27183, 25196 }, { 27186, 25197 }, { -34061, 25198 },
+    { -34071, 25199 }, { 27222, 25200 }, { -34101, 25201 }, { -34118, 25202 },
+    { -34128, 25203 }, { 27189, 25204 }, { -34179, 25205 }, { 27206, 25206 },
+    { 27207, 25207 }, { 27190, 25208 }, { 27192, 25209 }, { -34434, 25210 },
+    { -34444, 25211 }, { -34461, 25212 }, { -34471, 25213 }, { -34540, 25214 },
+    { -34550, 25215 }, { 27203, 25216 }, { -34594, 25217 }, { 27190, 25218 },
+    { 27245, 25219 }, { -34649, 25220 }, { -34659, 25221 }, { -34676, 25222 },
+    { -34686, 25223 }, { -34700, 25224 }, { -34710, 25225 }, { -34797, 25226 },
+    { -34807, 25227 }, { -34824, 25228 }, { -34895, 25229 }, { -35135, 25230 },
+    { 27239, 25231 }, { -35187, 25232 }, { -35211, 25233 }, { -35221, 25234 },
+    { 27197, 25235 }, { -35258, 25236 }, { -35268, 25237 }, { 27242, 25238 },
+    { 27201, 25239 }, { 27248, 25239 }, { 27222, 25240 }, { 27198, 25241 },
+    { 27203, 25242 }, { 27254, 25243 }, { 27236, 25244 }, { 27237, 25245 },
+    { -35556, 25246 }, { 27265, 25247 }, { 27208, 25248 }, { 27260, 25248 },
+    { -35679, 25249 }, { 27264, 25250 }, { 27213, 25251 }, { 27138, 25021 },
+    { 27262, 25252 }, { 27214, 25253 }, { -36008, 25254 }, { -36090, 25255 },
+    { 27267, 25256 }, { -36143, 25257 }, { 27244, 25258 }, { 27220, 25259 },
+    { 27260, 25260 }, { -36311, 25261 }, { 27215, 25262 }, { -36471, 25263 },
+    { -36481, 25264 }, { 27269, 25265 }, { 27219, 25266 }, { -36570, 25267 },
+    { 27225, 25268 }, { 27265, 25269 }, { 27266, 25270 }, { -36878, 25271 },
+    { -36938, 25272 }, { 27226, 25273 }, { -37061, 25274 }, { 27272, 25275 },
+    { -37341, 25276 }, { 27272, 25277 }, { -37856, 25278 }, { -37880, 25279 },
+    { -37904, 25280 }, { -38000, 25281 }, { -38031, 25282 }, { 27245, 25283 },
+    { 27282, 25284 }, { -38159, 25285 }, { -38215, 25286 }, { 27233, 25287 },
+    { -38296, 25288 }, { -38339, 25289 }, { -38363, 25290 }, { -38444, 25291 },
+    { -38498, 25292 }, { 27232, 25293 }, { 27227, 25294 }, { 27286, 25295 },
+    { 27287, 25296 }, { -38701, 25297 }, { 27279, 25298 }, { 27235, 25299 },
+    { 27289, 25299 }, { 27237, 25300 }, { 27238, 25301 }, { 27249, 25302 },
+    { 27270, 25303 }, { 27279, 25304 }, { 27279, 25305 }, { 27245, 25306 },
+    { 27239, 25307 }, { -38948, 25308 }, { 27247, 25309 }, { 27304, 25310 },
+    { 27300, 25311 }, { -39125, 25312 }, { 27282, 25313 }, { -39279, 25314 },
+    { 27292, 25315 }, { -39428, 25316 }, { -39500, 25317 }, { 27294, 25318 },
+    { 27307, 25319 }, { 27285, 25320 }, { 27286, 25321 }, { 27261, 25322 },
+    { -39897, 25323 }, { -40131, 25324 }, { -40148, 25325 }, { 27257, 25326 },
+    { -40239, 25327 }, { -40249, 25328 }, { -40270, 25329 }, { -40328, 25330 },
+    { -40345, 25331 }, { 27299, 25332 }, { -40402, 25333 }, { 27284, 25334 },
+    { -40439, 25335 }, { -40449, 25336 }, { 27310, 25337 }, { 27291, 25338 },
+    { 27290, 25339 }, { -40676, 25340 }, { -40686, 25341 }, { 27316, 25342 },
+    { 27305, 25343 }, { 27300, 25344 }, { 27285, 25345 }, { -40905, 25346 },
+    { 27274, 25347 }, { 27295, 25348 }, { -41089, 25349 }, { 27293, 25350 },
+    { -41141, 25351 }, { 27312, 25352 }, { 27305, 25353 }, { -41261, 25354 },
+    { 27318, 25355 }, { 27281, 25356 }, { 27298, 25357 }, { 27326, 25358 },
+    { 27322, 25359 }, { -41514, 25360 }, { -41559, 25361 }, { -41583, 25362 },
+    { 27295, 25363 }, { 27307, 25364 }, { -41700, 25365 }, { 27325, 25366 },
+    { -41734, 25367 }, { 27301, 25368 }, { 27305, 25369 }, { -41821, 25370 },
+    { -41838, 25371 }, { -41848, 25372 }, { -41858, 25373 }, { -41879, 25374 },
+    { 27280, 25375 }, { 27293, 25376 }, { 27281, 25377 }, { -42355, 25378 },
+    { 27323, 25379 }, { -42507, 25380 }, { -42676, 25381 }, { 27308, 25382 },
+    { 27323, 25383 }, { 27339, 25384 }, { 27340, 25385 }, { -42993, 25386 },
+    { 27295, 25387 }, { -43129, 25388 }, { 27333, 25389 }, { 27294, 25390 },
+    { 27296, 25391 }, { -43578, 25392 }, { -43595, 25393 }, { -43605, 25394 },
+    { -43626, 25395 }, { -43650, 25396 }, { 27295, 25397 }, { -43825, 25398 },
+    { -43835, 25399 }, { 27345, 25400 }, { 27324, 25401 }, { 27292, 25402 },
+    { -44289, 25403 }, { 27296, 25404 }, { -44320, 25405 }, { -44373, 25406 },
+    { -44383, 25407 }, { -44400, 25408 }, { 27349, 25409 }, { 27330, 25410 },
+    { 27298, 25411 }, { -44533, 25412 }, { -44557, 25413 }, { -44585, 25414 },
+    { -44621, 25415 }, { -44670, 25416 }, { 27348, 25417 }, { 27349, 25418 },
+    { -44713, 25419 }, { -44749, 25420 }, { -44791, 25421 }, { 27304, 25422 },
+    { 27361, 25423 }, { -44842, 25424 }, { -44881, 25425 }, { 27362, 25426 },
+    { -45021, 25427 }, { 27307, 25428 }, { 27308, 25428 }, { 27322, 25429 },
+    { 27308, 25430 }, { 27351, 25431 }, { -45241, 25432 }, { -45251, 25433 },
+    { -45298, 25434 }, { 27323, 25435 }, { -45374, 25436 }, { -45624, 25437 },
+    { -45648, 25438 }, { 27361, 25439 }, { -45741, 25440 }, { 27216, 25213 },
+    { -45758, 25441 }, { 27330, 25442 }, { -45809, 25443 }, { 27309, 25444 },
+    { 27357, 25445 }, { -46052, 25446 }, { 27347, 25447 }, { 27354, 25447 },
+    { -46158, 25448 }, { -46189, 25449 }, { 27361, 25450 }, { 27220, 25225 },
+    { 27370, 25451 }, { 27377, 25452 }, { -46394, 25453 }, { -46404, 25454 },
+    { -46442, 25455 }, { 27372, 25456 }, { -46528, 25457 }, { -46727, 25458 },
+    { -46765, 25459 }, { 27341, 25460 }, { 27322, 25461 }, { 27374, 25462 },
+    { -47602, 25463 }, { -47809, 25464 }, { -47830, 25465 }, { 27376, 25466 },
+    { 27369, 25467 }, { -47956, 25468 }, { 27381, 25469 }, { 27382, 25470 },
+    { -48180, 25471 }, { -48215, 25472 }, { 27324, 25473 }, { -48318, 25474 },
+    { -48339, 25475 }, { -48353, 25476 }, { -48451, 25477 }, { 27380, 25478 },
+    { 27357, 25479 }, { 27383, 25480 }, { 27376, 25481 }, { 27377, 25482 },
+    { -48747, 25483 }, { -48757, 25484 }, { -48781, 25485 }, { -48791, 25486 },
+    { -48822, 25487 }, { -48853, 25488 }, { -48898, 25489 }, { -48915, 25490 },
+    { -48974, 25491 }, { 27386, 25492 }, { -49074, 25493 }, { 27376, 25494 },
+    { -49151, 25495 }, { -49293, 25496 }, { -49303, 25497 }, { 27381, 25498 },
+    { 27367, 25499 }, { 27339, 25500 }, { -49502, 25501 }, { -49519, 25502 },
+    { 27344, 25503 }, { 27386, 25504 }, { 27350, 25505 }, { -49631, 25506 },
+    { 27390, 25507 }, { -49757, 25508 }, { -49859, 25509 }, { 27396, 25510 },
+    { -50207, 25511 }, { -50224, 25512 }, { -50260, 25513 }, { 27352, 25514 },
+    { -50365, 25515 }, { 27349, 25516 }, { -50680, 25517 }, { 27383, 25518 },
+    { 27384, 25519 }, { -50730, 25520 }, { 27395, 25521 }, { 27350, 25522 },
+    { 27401, 25523 }, { -51073, 25524 }, { -51083, 25525 }, { -51093, 25526 },
+    { -51103, 25527 }, { 27386, 25528 }, { 27359, 25529 }, { -51157, 25530 },
+    { -51174, 25531 }, { 27397, 25532 }, { -51239, 25533 }, { 27404, 25534 },
+    { 27375, 25535 }, { 27355, 25536 }, { 27399, 25538 }, { 27378, 25541 },
+    { 27383, 25542 }, { 27402, 25545 }, { 27420, 25546 }, { 27366, 25547 },
+    { 27422, 25548 }, { 27373, 25550 }, { 27384, 25551 }, { 27371, 25552 },
+    { 27395, 25553 }, { 27404, 25559 }, { 27428, 25560 }, { 27421, 25561 },
+    { 27424, 25562 }, { 27421, 25564 }, { 27376, 25569 }, { 27432, 25579 },
+    { 27394, 25581 }, { 27418, 25582 }, { 27413, 25583 }, { 27385, 25584 },
+    { 27406, 25586 }, { 27414, 25587 }, { 27416, 25589 }, { 27430, 25588 },
+    { 27431, 25590 }, { 27396, 25591 }, { 27393, 25592 }, { 27387, 25593 },
+    { 27397, 25594 }, { 27400, 25595 }, { 27401, 25596 }, { 27438, 25597 },
+    { 27417, 25601 }, { 27422, 25602 }, { 27389, 25603 }, { 27436, 25604 },
+    { 27447, 25607 }, { 27443, 25611 }, { 27443, 25612 }, { 27451, 25613 },
+    { 27416, 25614 }, { 27443, 25615 }, { 27437, 25622 }, { 27434, 25653 },
+    { 27435, 25654 }, { 27453, 25667 }, { 27459, 25678 }, { 27411, 25682 },
+    { 27447, 25683 }, { 27406, 25684 }, { 27458, 25712 }, { 27462, 25736 },
+    { 27463, 25737 }, { 27425, 25746 }, { 27411, 25747 }, { 27463, 25748 },
+    { 27438, 25749 }, { 27450, 25750 }, { 27461, 25751 }, { 27437, 25754 },
+    { 27455, 25612 }, { 27418, 25755 }, { 27458, 25756 }, { 27459, 25757 },
+    { 27461, 25763 }, { 27477, 25764 }, { 27478, 25766 }, { 27460, 25767 },
+    { 27459, 25769 }, { 27440, 25770 }, { 27426, 25771 }, { 27488, 25772 },
+    { 27450, 25773 }, { 27474, 25775 }, { 27475, 25777 }, { 27433, 25778 },
+    { 27481, 25780 }, { 27470, 25782 }, { 27433, 25786 }, { 27440, 25788 },
+    { 27498, 25789 }, { 27457, 25790 }, { 27473, 25791 }, { 27481, 25792 },
+    { 27461, 25794 }, { 27497, 25796 }, { 27488, 25802 }, { 27452, 25805 },
+    { 27489, 25796 }, { 27489, 25810 }, { 27455, 25811 }, { 27481, 25813 },
+    { 27496, 25826 }, { 27452, 25843 }, { 27451, 25848 }, { 27457, 25855 },
+    { 27460, 25857 }, { 27475, 25859 }, { 27498, 25860 }, { 27513, 25861 },
+    { 27471, 25863 }, { 27495, 25865 }, { 27476, 25867 }, { 27504, 25866 },
+    { 27499, 25869 }, { 27476, 25872 }, { 27496, 25879 }, { 27521, 26112 },
+    { 27463, 25893 }, { 27483, 25895 }, { 27491, 25897 }, { 27506, 25898 },
+    { 27493, 25899 }, { 27516, 25904 }, { 27500, 25908 }, { 27501, 25909 },
+    { 27523, 25910 }, { 27483, 25911 }, { 27475, 25912 }, { 27498, 25913 },
+    { 27475, 25915 }, { 27507, 25916 }, { 27490, 25917 }, { 27500, 25923 },
+    { 27497, 25924 }, { 27524, 25925 }, { 27490, 25926 }, { 27483, 25927 },
+    { 27519, 25928 }, { 27498, 25929 }, { 27541, 25931 }, { 27533, 25932 },
+    { 27516, 25936 }, { 27490, 25937 }, { 27530, 25939 }, { 27531, 25940 },
+    { 27535, 25943 }, { 27537, 25944 }, { 27518, 25946 }, { 27546, 25947 },
+    { 27518, 25948 }, { 27558, 25950 }, { 27501, 25953 }, { 27502, 25960 },
+    { 27545, 25961 }, { 27517, 25962 }, { 27544, 25965 }, { 27553, 25968 },
+    { 27555, 25971 }, { 27555, 25973 }, { 27518, 25977 }, { 27529, 25980 },
+    { 27553, 25981 }, { 27556, 25982 }, { 27518, 25983 }, { 27536, 25985 },
+    { 27537, 25986 }, { 27536, 25988 }, { 27556, 25992 }, { 27554, 25994 },
+    { 27555, 25995 }, { 27529, 25996 }, { 27564, 25999 }, { 27541, 26001 },
+    { 27566, 26003 }, { 27569, 26006 }, { 27544, 26008 }, { 27554, 26009 },
+    { 27543, 26010 }, { 27561, 26011 }, { 27538, 26013 }, { 27587, 26015 },
+    { 27583, 26016 }, { 27543, 26022 }, { 27586, 26026 }, { 27543, 26032 },
+    { 27546, 26037 }, { 27587, 26041 }, { 27566, 26042 }, { 27541, 26045 },
+    { 27548, 26046 }, { 27596, 26047 }, { 27563, 26048 }, { 27561, 26049 },
+    { 27571, 26050 }, { 27563, 26053 }, { 27571, 26054 }, { 27597, 26055 },
+    { 27554, 26059 }, { 27603, 26061 }, { 27591, 26063 }, { 27563, 26064 },
+    { 27558, 26065 }, { 27564, 26067 }, { 27605, 26071 }, { 27593, 26072 },
+    { 27552, 26073 }, { 27598, 26075 }, { 27600, 26084 }, { 27597, 26085 },
+    { 27605, 26087 }, { 27606, 26088 }, { 27611, 26090 }, { 27567, 26092 },
+    { 27612, 26093 }, { 27617, 26095 }, { 27604, 26096 }, { 27612, 26099 },
+    { 27580, 26100 }, { 27626, 26101 }, { 27597, 26103 }, { 27628, 26104 },
+    { 27592, 26108 }, { 27625, 26109 }, { 27620, 26111 }, { 27592, 26120 },
+    { 27623, 26121 }, { 27635, 26123 }, { 27636, 26127 }, { 27627, 26136 },
+    { 27600, 26137 }, { 27620, 26142 }, { 27581, 26148 }, { 27629, 26155 },
+    { 27631, 26156 }, { 27631, 26163 }, { 27625, 26164 }, { 27591, 26165 },
+    { 27613, 26166 }, { 27632, 26167 }, { 27641, 26169 }, { 27618, 26172 },
+    { 27650, 26173 }, { 27632, 26176 }, { 27621, 26177 }, { 27601, 26179 },
+    { 27622, 26181 }, { 27641, 26182 }, { 27614, 26187 }, { 27647, 26188 },
+    { 27604, 26191 }, { 27652, 26192 }, { 27630, 26193 }, { 27621, 26194 },
+    { 27662, 26196 }, { 27618, 26310 }, { 27614, 26311 }, { 27633, 26314 },
+    { 27654, 26315 }, { 27656, 26316 }, { 27648, 26317 }, { 27656, 26318 },
+    { 27626, 26319 }, { 27615, 26320 }, { 27637, 26321 }, { 27640, 26322 },
+    { 27640, 26327 }, { 27643, 26330 }, { 27626, 26331 }, { 27629, 26333 },
+    { 27615, 26334 }, { 27656, 26336 }, { 27637, 26337 }, { 27638, 26338 },
+    { 27630, 26341 }, { 27666, 26343 }, { 27647, 26345 }, { 27622, 26349 },
+    { 27676, 26351 }, { 27670, 26355 }, { 27640, 26356 }, { 27637, 26357 },
+    { 27642, 26359 }, { 27671, 26363 }, { 27633, 26364 }, { 27632, 26371 },
+    { 27657, 26372 }, { 27689, 26375 }, { 27690, 26377 }, { 27685, 26378 },
+    { 27665, 26380 }, { 27682, 26381 }, { 27673, 26383 }, { 27694, 26388 },
+    { 27656, 26390 }, { 27677, 26392 }, { 27703, 26393 }, { 27693, 26395 },
+    { 27647, 26405 }, { 27644, 26406 }, { 27645, 26407 }, { 27663, 26410 },
+    { 27657, 26411 }, { 27674, 26415 }, { 27660, 26417 }, { 27661, 26418 },
+    { 27693, 26420 }, { 27679, 26421 }, { 27683, 26423 }, { 27695, 26424 },
+    { 27664, 26425 }, { 27702, 26426 }, { 27680, 26428 }, { 27715, 26432 },
+    { 27690, 26433 }, { 27685, 26439 }, { 27723, 26448 }, { 27677, 26451 },
+    { 27686, 26452 }, { 27695, 26453 }, { 27728, 26454 }, { 27711, 26459 },
+    { 27690, 26695 }, { 27717, 26463 }, { 27717, 26464 }, { 27670, 26466 },
+    { 27728, 26468 }, { 27672, 26475 }, { 27717, 26479 }, { 27736, 26480 },
+    { 27687, 26482 }, { 27688, 26483 }, { 27720, 26484 }, { 27702, 26489 },
+    { 27735, 26493 }, { 27702, 26495 }, { 27704, 26504 }, { 27731, 26505 },
+    { 27719, 26506 }, { 27732, 26507 }, { 27705, 26508 }, { 27713, 26512 },
+    { 27719, 26513 }, { 27720, 26514 }, { 27729, 26515 }, { 27718, 26516 },
+    { 27740, 26517 }, { 27728, 26518 }, { 27748, 26519 }, { 27745, 26520 },
+    { 27734, 26521 }, { 27728, 26523 }, { 27743, 26527 }, { 27761, 26529 },
+    { 27738, 26534 }, { 27751, 26535 }, { 27752, 26537 }, { 27745, 26538 },
+    { 27733, 26539 }, { 27712, 26541 }, { 27713, 26542 }, { 27748, 26565 },
+    { 27751, 26568 }, { 27767, 26571 }, { 27738, 26573 }, { 27748, 26574 },
+    { 27749, 26575 }, { 27723, 26576 }, { 27719, 26577 }, { 27727, 26578 },
+    { 27720, 26579 }, { 27779, 26580 }, { 27762, 26581 }, { 27724, 26583 },
+    { 27765, 26584 }, { 27722, 26585 }, { 27772, 26586 }, { 27730, 26589 },
+    { 27769, 26595 }, { 27770, 26596 }, { 27781, 26600 }, { 27783, 26602 },
+    { 27745, 26603 }, { 27790, 26612 }, { 27788, 26613 }, { 27773, 26614 },
+    { 27774, 26617 }, { 27778, 26618 }, { 27779, 26619 }, { 27785, 26627 },
+    { 27751, 26634 }, { 27753, 26635 }, { 27766, 26637 }, { 27784, 26638 },
+    { 27739, 26641 }, { 27803, 26645 }, { 27793, 26647 }, { 27794, 26648 },
+    { 27798, 26649 }, { 27793, 26650 }, { 27768, 26887 }, { 27757, 26657 },
+    { 27791, 26659 }, { 27753, 26660 }, { 27772, 26899 }, { 27796, 26672 },
+    { 27793, 26676 }, { 27804, 26679 }, { 27802, 26680 }, { 27785, 26681 },
+    { 27781, 26682 }, { 27764, 26683 }, { 27799, 26684 }, { 27808, 26685 },
+    { 27767, 26686 }, { 27768, 26687 }, { 27773, 26689 }, { 27779, 26690 },
+    { 27826, 26691 }, { 27764, 26693 }, { 27772, 26694 }, { 27829, 26696 },
+    { 27780, 26697 }, { 27768, 26700 }, { 27798, 26702 }, { 27831, 26703 },
+    { 27817, 26704 }, { 27786, 26706 }, { 27823, 26709 }, { 27786, 26710 },
+    { 27787, 26712 }, { 27822, 26713 }, { 27823, 26714 }, { 27785, 26717 },
+    { 27787, 26719 }, { 27840, 26721 }, { 27844, 26727 }, { 27830, 26728 },
+    { 27844, 26731 }, { 27789, 26737 }, { 27838, 26738 }, { 27786, 26739 },
+    { 27812, 26740 }, { 27802, 26742 }, { 27794, 26743 }, { 27809, 26744 },
+    { 27797, 26745 }, { 27798, 26746 }, { 27856, 26747 }, { 27815, 26748 },
+    { 27828, 26749 }, { 27797, 26750 }, { 27856, 26751 }, { 27834, 26752 },
+    { 27815, 26754 }, { 27855, 26755 }, { 27802, 26756 }, { 27814, 26758 },
+    { 27843, 26760 }, { 27809, 26763 }, { 27837, 26764 }, { 27834, 26765 },
+    { 27835, 26766 }, { 27813, 26767 }, { 27856, 26771 }, { 27857, 26777 },
+    { 27838, 26779 }, { 27793, 26744 }, { 27874, 26782 }, { 27837, 26783 },
+    { 27816, 26784 }, { 27816, 26787 }, { 27870, 26788 }, { 27858, 26789 },
+    { 27860, 26790 }, { 27826, 26792 }, { 27841, 26793 }, { 27873, 26795 },
+    { 27836, 26797 }, { 27869, 26798 }, { 27886, 26800 }, { 27840, 26801 },
+    { 27829, 26802 }, { 27859, 26803 }, { 27890, 26804 }, { 27875, 26808 },
+    { 27842, 26809 }, { 27893, 26811 }, { 27840, 26813 }, { 27851, 26814 },
+    { 27883, 26820 }, { 27870, 26821 }, { 27879, 26822 }, { 27855, 26824 },
+    { 27854, 26827 }, { 27897, 26828 }, { 27876, 26829 }, { 27877, 26830 },
+    { 27859, 26832 }, { 27872, 26834 }, { 27858, 26835 }, { 27858, 26836 },
+    { 27893, 26842 }, { 27899, 26845 }, { 27850, 26846 }, { 27902, 26847 },
+    { 27907, 26849 }, { 27864, 26854 }, { 27889, 26855 }, { 27915, 26856 },
+    { 27886, 26862 }, { 27887, 26863 }, { 27864, 26867 }, { 27887, 26868 },
+    { 27868, 26871 }, { 27907, 26873 }, { 27873, 26874 }, { 27891, 26875 },
+    { 27918, 26876 }, { 27878, 26877 }, { 27895, 26881 }, { 27879, 26885 },
+    { 27907, 26889 }, { 27901, 26891 }, { 27924, 26892 }, { 27872, 26894 },
+    { 27922, 26895 }, { 27918, 26898 }, { 27924, 26900 }, { 27918, 26901 },
+    { 27926, 26905 }, { 27921, 26909 }, { 27905, 26910 }, { 27928, 26911 },
+    { 27890, 26915 }, { 27926, 26916 }, { 27881, 26918 }, { 27882, 26919 },
+    { 27887, 26922 }, { 27905, 26927 }, { 27937, 26928 }, { 27917, 26929 },
+    { 27933, 26930 }, { 27904, 26931 }, { 27940, 26941 }, { 27922, 26943 },
+    { 27948, 26947 }, { 27919, 26948 }, { 27939, 26949 }, { 27945, 26952 },
+    { 27925, 26953 }, { 27928, 26954 }, { 27903, 26956 }, { 27911, 26959 },
+    { 27903, 26963 }, { 27929, 26965 }, { 27941, 26967 }, { 27942, 26968 },
+    { 27949, 26970 }, { 27963, 26971 }, { 27914, 26972 }, { 27931, 26977 },
+    { 27938, 26978 }, { 27954, 26981 }, { 27945, 26983 }, { 27973, 26984 },
+    { 27938, 26985 }, { 28104, 26986 }, { 28105, 26987 }, { 28106, 26988 },
+    { 28107, 26989 }, { 28108, 26990 }, { 28109, 26991 }, { 27878, 26992 },
+    { 28111, 26993 }, { 28112, 26994 }, { 28113, 26995 }, { 28114, 26996 },
+    { 28115, 26997 }, { 28116, 26998 }, { 28117, 26999 }, { 28118, 27000 },
+    { 28119, 27001 }, { 28120, 27002 }, { 28121, 27003 }, { 28122, 27004 },
+    { 28123, 27005 }, { 28124, 27006 }, { 28125, 27007 }, { 28126, 27008 },
+    { 28127, 27009 }, { 28128, 27010 }, { 28129, 27011 }, { 28130, 27012 },
+    { 28131, 27013 }, { 28132, 27014 }, { 28133, 27015 }, { 28134, 27016 },
+    { 28135, 27017 }, { 28136, 27018 }, { 28137, 27019 }, { 28138, 27020 },
+    { 28139, 27021 }, { 28140, 27022 }, { 28141, 27023 }, { 28142, 27024 },
+    { 28143, 27025 }, { 28144, 27026 }, { 28145, 27048 }, { 28146, 27027 },
+    { 28147, 27028 }, { 28148, 27029 }, { 28149, 27030 }, { 27920, 27031 },
+    { 27921, 27032 }, { 28152, 27033 }, { 28153, 27034 }, { 28154, 27035 },
+    { 28155, 27036 }, { 28156, 27037 }, { 28157, 27038 }, { 27925, 27039 },
+    { 27926, 27040 }, { 28160, 27041 }, { 28161, 27042 }, { 28162, 27043 },
+    { 28163, 27044 }, { 27934, 27045 }, { 28165, 27046 }, { 28166, 27047 },
+    { 28167, 27049 }, { 28168, 27050 }, { 28169, 27051 }, { 28170, 27052 },
+    { 27938, 27053 }, { 28172, 27054 }, { 27943, 27055 }, { 27944, 27056 },
+    { 28175, 27057 }, { 28176, 27058 }, { 28177, 27059 }, { 28178, 27060 },
+    { 28179, 27061 }, { 27949, 27062 }, { 28181, 27063 }, { 28182, 27064 },
+    { 28183, 27065 }, { 28184, 27066 }, { 28185, 27067 }, { 28186, 27068 },
+    { 28187, 27069 }, { 27958, 27070 }, { 28189, 27071 }, { 27960, 27072 },
+    { 28191, 27073 }, { 28192, 27076 }, { 27961, 27074 }, { 28194, 27075 },
+    { 28195, 27077 }, { 28196, 27078 }, { 28197, 27079 }, { 28198, 27080 },
+    { 28199, 27081 }, { 28200, 27082 }, { 28201, 27083 }, { 28202, 27084 },
+    { 28203, 27085 }, { 28204, 27086 }, { 28205, 27087 }, { 28206, 27088 },
+    { 28207, 27089 }, { 28208, 27090 }, { 28209, 27091 }, { 28210, 27092 },
+    { 28211, 27093 }, { 28212, 27094 }, { 27982, 27095 }, { 28214, 27096 },
+    { 28215, 27097 }, { 28216, 27098 }, { 28217, 27099 }, { 28218, 27100 },
+    { 28219, 27101 }, { 28220, 27102 }, { 28221, 27103 }, { 27991, 27104 },
+    { 28223, 27105 }, { 28224, 27106 }, { 28225, 27107 }, { 28226, 27108 },
+    { 28227, 27109 }, { 28228, 27110 }, { 28229, 27111 }, { 28230, 27112 },
+    { 28231, 27113 }, { 28232, 27114 }, { 28233, 27115 }, { 28234, 27116 },
+    { 28005, 27117 }, { 28236, 27118 }, { 28237, 27119 }, { 28238, 27120 },
+    { 28239, 27121 }, { 28240, 27122 }, { 28241, 27123 }, { 28242, 27124 },
+    { 28243, 27125 }, { 28244, 27126 }, { 28245, 27127 }, { 28246, 27128 },
+    { 28247, 27129 }, { 28018, 27130 }, { 28019, 27131 }, { 28250, 27132 },
+    { 28251, 27133 }, { 28252, 27134 }, { 28253, 27135 }, { 28254, 27136 },
+    { 28255, 27137 }, { 28256, 27138 }, { 28257, 27139 }, { 28258, 27140 },
+    { 28259, 27141 }, { 28260, 27142 }, { 28261, 27143 }, { 28262, 27144 },
+    { 28263, 27145 }, { 28264, 27146 }, { 28265, 27147 }, { 28266, 27148 },
+    { 28267, 27149 }, { 28268, 27150 }, { 28269, 27151 }, { 28270, 27152 },
+    { 28271, 27153 }, { 28272, 27154 }, { 28273, 27155 }, { 28044, 27156 },
+    { 28045, 27157 }, { 28276, 27158 }, { 28277, 27159 }, { 28278, 27160 },
+    { 28279, 27161 }, { 28047, 27162 }, { 28281, 27163 }, { 28282, 27164 },
+    { 28283, 27165 }, { 28284, 27166 }, { 28285, 27167 }, { 28286, 27168 },
+    { 28287, 27169 }, { 28288, 27170 }, { 28289, 27171 }, { 28290, 27172 },
+    { 28060, 27173 }, { 28292, 27174 }, { 28293, 27175 }, { 28294, 27176 },
+    { 28062, 27177 }, { 28296, 27178 }, { 28297, 27179 }, { 28298, 27180 },
+    { 28299, 27181 }, { 28300, 27182 }, { 28301, 27183 }, { 28302, 27184 },
+    { 28303, 27185 }, { 28304, 27186 }, { 28305, 27187 }, { 28306, 27188 },
+    { 28307, 27189 }, { 28308, 27190 }, { 28309, 27191 }, { 28081, 27192 },
+    { 28311, 27193 }, { 28312, 27194 }, { 28313, 27195 }, { 28314, 27196 },
+    { 28315, 27197 }, { 28316, 27198 }, { 28317, 27199 }, { 28318, 27200 },
+    { 28319, 27201 }, { 28320, 27202 }, { 28321, 27203 }, { 28092, 27204 },
+    { 28323, 27205 }, { 28324, 27206 }, { 28325, 27207 }, { 28326, 27208 },
+    { 28327, 27209 }, { 28328, 27210 }, { 28329, 27211 }, { 28330, 27212 },
+    { 28331, 27213 }, { 28332, 27214 }, { 28333, 27215 }, { 28104, 27216 },
+    { 28335, 27217 }, { 28336, 27218 }, { 28337, 27219 }, { 28338, 27220 },
+    { 28339, 27221 }, { 28340, 27222 }, { 28341, 27223 }, { 28112, 27224 },
+    { 28343, 27225 }, { 28344, 27226 }, { 28345, 27227 }, { 28346, 27228 },
+    { 28347, 27229 }, { 28348, 27230 }, { 28349, 27231 }, { 28350, 27232 },
+    { 28351, 27233 }, { 28352, 27234 }, { 28353, 27235 }, { 28354, 27236 },
+    { 28355, 27237 }, { 28356, 27238 }, { 28357, 27239 }, { 28358, 27240 },
+    { 28359, 27241 }, { 28360, 27242 }, { 28361, 27243 }, { 28362, 27244 },
+    { 28363, 27245 }, { 28364, 27246 }, { 28365, 27247 }, { 28366, 27248 },
+    { 28134, 27249 }, { 28368, 27250 }, { 28369, 27251 }, { 28370, 27252 },
+    { 28371, 27253 }, { 28372, 27254 }, { 28373, 27255 }, { 28374, 27256 },
+    { 28375, 27257 }, { 28376, 27258 }, { 28377, 27259 }, { 28378, 27260 },
+    { 28149, 27261 }, { 28380, 27262 }, { 28381, 27263 }, { 28153, 27264 },
+    { 28383, 27265 }, { 28384, 27266 }, { 28385, 27267 }, { 28386, 27268 },
+    { 28387, 27269 }, { 28388, 27270 }, { 28389, 27271 }, { 28390, 27272 },
+    { 28391, 27273 }, { 28392, 27274 }, { 28393, 27275 }, { 28394, 27276 },
+    { 28395, 27277 }, { 28396, 27278 }, { 28397, 27279 }, { 28398, 27280 },
+    { 28399, 27281 }, { 28400, 27282 }, { 28401, 27283 }, { 28402, 27284 },
+    { 28403, 27285 }, { 28404, 27286 }, { 28405, 27287 }, { 28406, 27288 },
+    { 28407, 27289 }, { 28408, 27290 }, { 28409, 27291 }, { 28410, 27292 },
+    { 28411, 27293 }, { 28412, 27294 }, { 28413, 27295 }, { 28414, 27296 },
+    { 28182, 27297 }, { 28186, 27298 }, { 28417, 27299 }, { 28418, 27300 },
+    { 28419, 27301 }, { 28420, 27302 }, { 28421, 27303 }, { 28422, 27304 },
+    { 28423, 27305 }, { 28424, 27306 }, { 28425, 27307 }, { 28197, 27308 },
+    { 28196, 27309 }, { 28428, 27310 }, { 28200, 27311 }, { 28430, 27312 },
+    { 28201, 27313 }, { 28432, 27314 }, { 28433, 27315 }, { 28434, 27316 },
+    { 28435, 27317 }, { 28436, 27318 }, { 28437, 27319 }, { 28438, 27320 },
+    { 28439, 27321 }, { 28440, 27322 }, { 28441, 27323 }, { 28442, 27324 },
+    { 28443, 27325 }, { 28444, 27326 }, { 28215, 27327 }, { 28446, 27328 },
+    { 28447, 27329 }, { 28448, 27330 }, { 28449, 27331 }, { 28450, 27332 },
+    { 28451, 27333 }, { 28223, 27334 }, { 28453, 27335 }, { 28454, 27336 },
+    { 28455, 27337 }, { 28456, 27338 }, { 28228, 27339 }, { 28458, 27340 },
+    { 28225, 27341 }, { 28460, 27342 }, { 28461, 27343 }, { 28462, 27344 },
+    { 28463, 27345 }, { 28464, 27346 }, { 28465, 27347 }, { 28466, 27348 },
+    { 28467, 27349 }, { 28468, 27350 }, { 28469, 27351 }, { 28470, 27352 },
+    { 28471, 27353 }, { 28472, 27354 }, { 28473, 27355 }, { 28474, 27356 },
+    { 28475, 27357 }, { 28476, 27358 }, { 28477, 27359 }, { 28478, 27360 },
+    { 28479, 27361 }, { 28480, 27362 }, { 28481, 27363 }, { 28482, 27364 },
+    { 28483, 27365 }, { 28484, 27366 }, { 28485, 27367 }, { 28486, 27368 },
+    { 28487, 27369 }, { 28488, 27370 }, { 28489, 27371 }, { 28490, 27372 },
+    { 28491, 27373 }, { 28492, 27374 }, { 28493, 27375 }, { 28264, 27376 },
+    { 28495, 27377 }, { 28496, 27378 }, { 28497, 27379 }, { 28498, 27380 },
+    { 28499, 27381 }, { 28500, 27382 }, { 28501, 27383 }, { 28272, 27384 },
+    { 28503, 27385 }, { 28504, 27386 }, { 28505, 27387 }, { 28506, 27388 },
+    { 28277, 27389 }, { 28278, 27390 }, { 28509, 27391 }, { 28510, 27392 },
+    { 28511, 27393 }, { 28512, 27394 }, { 28513, 27395 }, { 28514, 27396 },
+    { 28515, 27397 }, { 28516, 27398 }, { 28517, 27399 }, { 28518, 27400 },
+    { 28519, 27401 }, { 28520, 27402 }, { 28521, 27403 }, { 28522, 27404 },
+    { 28523, 27405 }, { 28524, 27406 }, { 28525, 27407 }, { 28526, 27408 },
+    { 28527, 27409 }, { 28528, 27410 }, { 28529, 27411 }, { 28530, 27412 },
+    { 28531, 27413 }, { 28532, 27414 }, { 28533, 27415 }, { 28534, 27416 },
+    { 28301, 27417 }, { 28536, 27418 }, { 28537, 27419 }, { 28538, 27420 },
+    { 28539, 27421 }, { 28540, 27422 }, { 28541, 27423 }, { 28542, 27445 },
+    { 28543, 27424 }, { 28544, 27425 }, { 28545, 27426 }, { 28546, 27427 },
+    { 28547, 27428 }, { 28548, 27429 }, { 28549, 27430 }, { 28550, 27431 },
+    { 28551, 27432 }, { 28552, 27433 }, { 28553, 27434 }, { 28554, 27435 },
+    { 28555, 27436 }, { 28556, 27437 }, { 28557, 27438 }, { 28558, 27439 },
+    { 28559, 27440 }, { 28560, 27441 }, { 28561, 27442 }, { 28562, 27443 },
+    { 28563, 27444 }, { 28564, 27446 }, { 28565, 27447 }, { 28566, 27448 },
+    { 28567, 27449 }, { 28568, 27450 }, { 28569, 27451 }, { 28570, 27452 },
+    { 28571, 27453 }, { 28572, 27454 }, { 28573, 27455 }, { 28574, 27456 },
+    { 28575, 27457 }, { 28576, 27458 }, { 28577, 27459 }, { 28578, 27460 },
+    { 28579, 27461 }, { 28580, 27462 }, { 28581, 27463 }, { 28582, 27464 },
+    { 28583, 27465 }, { 28584, 27466 }, { 28585, 27467 }, { 28586, 27468 },
+    { 28587, 27469 }, { 28588, 27470 }, { 28589, 27471 }, { 28590, 27472 },
+    { 28591, 27473 }, { 28592, 27474 }, { 28593, 27475 }, { 28594, 27476 },
+    { 28595, 27477 }, { 28596, 27478 }, { 28597, 27479 }, { 28598, 27480 },
+    { 28599, 27481 }, { 28600, 27482 }, { 28601, 27483 }, { 28602, 27484 },
+    { 28603, 27485 }, { 28604, 27486 }, { 28605, 27487 }, { 28606, 27488 },
+    { 28607, 27489 }, { 28608, 27490 }, { 28609, 27491 }, { 28610, 27492 },
+    { 28611, 27493 }, { 28612, 27494 }, { 28613, 27495 }, { 28614, 27496 },
+    { 28615, 27497 }, { 28616, 27498 }, { 28617, 27499 }, { 28618, 27500 },
+    { 28619, 27501 }, { 28620, 27502 }, { 28621, 27503 }, { 28622, 27504 },
+    { 28623, 27505 }, { 28624, 27506 }, { 28625, 27507 }, { 28626, 27508 },
+    { 28627, 27509 }, { 28628, 27510 }, { 28629, 27511 }, { 28630, 27512 },
+    { 28631, 27513 }, { 28402, 27514 }, { 28633, 27515 }, { 28401, 27516 },
+    { 28635, 27517 }, { 28636, 27518 }, { 28637, 27519 }, { 28638, 27520 },
+    { 28639, 27521 }, { 28640, 27522 }, { 28641, 27523 }, { 28642, 27524 },
+    { 28643, 27525 }, { 28644, 27526 }, { 28645, 27527 }, { 28646, 27528 },
+    { 28647, 27529 }, { 28648, 27530 }, { 28649, 27531 }, { 28650, 27532 },
+    { 28651, 27533 }, { 28652, 27534 }, { 28653, 27535 }, { 28420, 27536 },
+    { 28655, 27537 }, { 28656, 27538 }, { 28657, 27539 }, { 28658, 27540 },
+    { 28659, 27541 }, { 28660, 27542 }, { 28661, 27543 }, { 28662, 27544 },
+    { -25, 27545 }, { -93, 27546 }, { -120, 27547 }, { -153, 27548 },
+    { -166, 27549 }, { -193, 27550 }, { 28525, 27551 }, { -246, 27552 },
+    { -298, 27553 }, { -325, 27554 }, { -366, 27555 }, { -506, 27556 },
+    { -526, 27557 }, { -553, 27558 }, { -573, 27559 }, { -603, 27560 },
+    { -744, 27561 }, { -1066, 27562 }, { -1121, 27563 }, { -1163, 27564 },
+    { -1183, 27565 }, { -1196, 27566 }, { -1238, 27567 }, { -1251, 27568 },
+    { -1264, 27569 }, { -1277, 27570 }, { -1290, 27571 }, { -1303, 27572 },
+    { -1316, 27573 }, { -1329, 27574 }, { -1342, 27575 }, { -1355, 27576 },
+    { -1368, 27577 }, { -1381, 27578 }, { -1540, 27579 }, { -1592, 27580 },
+    { -1651, 27581 }, { -1672, 27582 }, { -1784, 27583 }, { -1924, 27584 },
+    { -1941, 27585 }, { -1954, 27586 }, { -1967, 27587 }, { -1987, 27588 },
+    { -2028, 27589 }, { -2126, 27590 }, { 28530, 27591 }, { 28531, 27592 },
+    { -2668, 27593 }, { -2816, 27594 }, { -2894, 27595 }, { -2907, 27596 },
+    { -2920, 27597 }, { -3287, 27598 }, { 28521, 27599 }, { 28524, 27600 },
+    { -3783, 27601 }, { -3824, 27602 }, { -3879, 27603 }, { -3899, 27604 },
+    { 28525, 27605 }, { -3967, 27606 }, { -4122, 27607 }, { -4205, 27608 },
+    { -4264, 27609 }, { -4277, 27610 }, { -4437, 27611 }, { 28507, 27612 },
+    { -4476, 27613 }, { 28527, 27614 }, { 28506, 27615 }, { -4657, 27616 },
+    { -5177, 27617 }, { -5407, 27618 }, { -5448, 27619 }, { -5485, 27620 },
+    { 28519, 27621 }, { -5531, 27622 }, { -5628, 27623 }, { -5774, 27624 },
+    { -5831, 27625 }, { -5910, 27626 }, { -6005, 27627 }, { -6060, 27628 },
+    { 28508, 27629 }, { -6092, 27630 }, { 28531, 27631 }, { -6201, 27632 },
+    { -6214, 27633 }, { 28513, 27634 }, { -6639, 27635 }, { -6781, 27636 },
+    { -6871, 27637 }, { -6915, 27638 }, { -7483, 27639 }, { -8087, 27640 },
+    { -8236, 27641 }, { -8802, 27642 }, { -8832, 27643 }, { -8922, 27644 },
+    { -8985, 27645 }, { -8998, 27646 }, { -9060, 27647 }, { -9169, 27648 },
+    { -9182, 27649 }, { -9202, 27650 }, { -9286, 27651 }, { -9330, 27652 },
+    { -9557, 27653 }, { 28523, 27654 }, { -10272, 27655 }, { -10384, 27656 },
+    { -10414, 27657 }, { -10431, 27658 }, { -10500, 27659 }, { -10786, 27660 },
+    { -11029, 27661 }, { -11042, 27662 }, { 28520, 27663 }, { -11085, 27664 },
+    { -11154, 27665 }, { -11202, 27666 }, { -11281, 27667 }, { -11378, 27668 },
+    { -11522, 27669 }, { -11662, 27670 }, { -11682, 27671 }, { -11709, 27672 },
+    { -11729, 27673 }, { -11742, 27674 }, { -11804, 27675 }, { 28531, 27676 },
+    { -11843, 27677 }, { -11860, 27678 }, { -11964, 27679 }, { -11977, 27680 },
+    { -12007, 27681 }, { -12020, 27682 }, { -12123, 27683 }, { -12255, 27684 },
+    { -12355, 27685 }, { -12368, 27686 }, { -12381, 27687 }, { -12425, 27688 },
+    { 28523, 27689 }, { 28523, 27690 }, { -12749, 27691 }, { -12802, 27692 },
+    { -12947, 27693 }, { -13048, 27694 }, { -13125, 27695 }, { -13176, 27696 },
+    { -13503, 27697 }, { -13723, 27698 }, { -13776, 27699 }, { -13811, 27700 },
+    { -13845, 27701 }, { -13882, 27702 }, { -13895, 27703 }, { -13918, 27704 },
+    { -14108, 27705 }, { -14181, 27706 }, { -14194, 27707 }, { -14244, 27708 },
+    { -14359, 27709 }, { -14389, 27710 }, { -14478, 27711 }, { -14633, 27712 },
+    { -14656, 27713 }, { -14669, 27714 }, { 28518, 27715 }, { 28523, 27716 },
+    { -14814, 27717 }, { -14914, 27718 }, { -14927, 27719 }, { -15053, 27720 },
+    { 28521, 27721 }, { -15463, 27722 }, { -15611, 27723 }, { -15661, 27724 },
+    { -15674, 27725 }, { -15714, 27726 }, { -15748, 27727 }, { -15775, 27728 },
+    { -15788, 27729 }, { -15801, 27730 }, { -15814, 27731 }, { 28507, 27732 },
+    { -15930, 27733 }, { -15943, 27734 }, { -16252, 27735 }, { 28494, 27736 },
+    { -16514, 27737 }, { -16564, 27738 }, { -16591, 27739 }, { -16644, 27740 },
+    { -16694, 27741 }, { -16753, 27742 }, { -16888, 27743 }, { -16989, 27744 },
+    { -17252, 27745 }, { -17272, 27746 }, { -17309, 27747 }, { -17322, 27748 },
+    { -17377, 27749 }, { -17449, 27750 }, { 28499, 27751 }, { -17539, 27752 },
+    { -17577, 27753 }, { -17645, 27754 }, { -17666, 27755 }, { -17836, 27756 },
+    { -17934, 27757 }, { -17954, 27758 }, { -17997, 27759 }, { -18025, 27760 },
+    { -18082, 27761 }, { -18354, 27762 }, { 28503, 27763 }, { -18519, 27764 },
+    { -18688, 27765 }, { -19054, 27766 }, { -19095, 27767 }, { -19211, 27768 },
+    { -19386, 27769 }, { -19592, 27770 }, { -19605, 27771 }, { -19822, 27772 },
+    { -19835, 27773 }, { -19848, 27774 }, { 28499, 27775 }, { -19912, 27776 },
+    { -19935, 27777 }, { -20017, 27778 }, { -20030, 27779 }, { -20228, 27780 },
+    { -20297, 27781 }, { -20564, 27782 }, { 28498, 27783 }, { -20636, 27784 },
+    { -20815, 27785 }, { -20828, 27786 }, { -20932, 27787 }, { -20952, 27788 },
+    { -21056, 27789 }, { -21314, 27790 }, { -21376, 27791 }, { -22593, 27792 },
+    { -22656, 27793 }, { -22781, 27794 }, { -22798, 27795 }, { -22811, 27796 },
+    { -22838, 27797 }, { -22881, 27798 }, { -22905, 27799 }, { -22918, 27800 },
+    { -22974, 27801 }, { -23025, 27802 }, { -23232, 27803 }, { -23295, 27804 },
+    { -23357, 27805 }, { -23402, 27806 }, { -23451, 27807 }, { 28536, 27808 },
+    { -23529, 27809 }, { -23542, 27810 }, { -23617, 27811 }, { -23756, 27812 },
+    { -23800, 27813 }, { -23885, 27814 }, { -23964, 27815 }, { -24399, 27816 },
+    { -24412, 27817 }, { -24425, 27818 }, { -24476, 27819 }, { 28500, 27820 },
+    { -24721, 27821 }, { -25121, 27822 }, { 28505, 27823 }, { -25212, 27824 },
+    { -25266, 27825 }, { -25359, 27826 }, { -25437, 27827 }, { -25465, 27828 },
+    { -25538, 27829 }, { -25717, 27830 }, { -25797, 27831 }, { -25820, 27832 },
+    { -25847, 27833 }, { -25891, 27834 }, { -26191, 27835 }, { -26239, 27836 },
+    { -26252, 27837 }, { -26320, 27838 }, { -26333, 27839 }, { -26346, 27840 },
+    { -26501, 27841 }, { -26546, 27842 }, { -26597, 27843 }, { -26631, 27844 },
+    { -26679, 27845 }, { -26692, 27846 }, { -26705, 27847 }, { -26718, 27848 },
+    { -26755, 27849 }, { -26929, 27850 }, { -26942, 27851 }, { -27044, 27852 },
+    { -27310, 27853 }, { -27420, 27854 }, { -27461, 27855 }, { 28552, 27856 },
+    { 28518, 27857 }, { -27581, 27858 }, { -27631, 27859 }, { -27651, 27860 },
+    { -27678, 27861 }, { -27747, 27862 }, { -27777, 27863 }, { -28016, 27864 },
+    { -28109, 27865 }, { -28122, 27866 }, { 28509, 27867 }, { 28527, 27868 },
+    { -28253, 27869 }, { 28510, 27870 }, { -28826, 27871 }, { 28555, 27872 },
+    { -29281, 27873 }, { -29294, 27874 }, { -29378, 27875 }, { -29459, 27876 },
+    { -29472, 27877 }, { -29571, 27878 }, { -29605, 27879 }, { -29618, 27880 },
+    { -29695, 27881 }, { -29708, 27882 }, { -29725, 27883 }, { -29781, 27884 },
+    { -29882, 27885 }, { 28556, 27886 }, { -29925, 27887 }, { -30019, 27888 },
+    { -30182, 27889 }, { -30227, 27890 }, { -30452, 27891 }, { -30511, 27892 },
+    { 28515, 27893 }, { -30705, 27894 }, { -30841, 27895 }, { -30899, 27896 },
+    { -30919, 27897 }, { 28515, 27898 }, { -31376, 27899 }, { 28555, 27900 },
+    { -31484, 27901 }, { -31501, 27902 }, { -31627, 27903 }, { -31689, 27904 },
+    { -31702, 27905 }, { -31729, 27906 }, { -31756, 27907 }, { -31797, 27908 },
+    { -31852, 27909 }, { -31973, 27910 }, { -32061, 27911 }, { -32074, 27912 },
+    { -32198, 27913 }, { -32321, 27914 }, { -32679, 27915 }, { -32692, 27916 },
+    { -32783, 27917 }, { -32883, 27918 }, { -32918, 27919 }, { -33096, 27920 },
+    { -33124, 27921 }, { -33187, 27922 }, { -33303, 27923 }, { -33342, 27924 },
+    { -33355, 27925 }, { -33582, 27926 }, { -33929, 27927 }, { -33942, 27928 },
+    { -34000, 27929 }, { -34041, 27930 }, { -34081, 27931 }, { -34145, 27932 },
+    { -34214, 27933 }, { -34227, 27934 }, { 28556, 27935 }, { -34393, 27936 },
+    { -34481, 27937 }, { -34574, 27938 }, { -34611, 27939 }, { -34624, 27940 },
+    { -34720, 27941 }, { -35170, 27942 }, { 28518, 27943 }, { -35313, 27944 },
+    { -35330, 27945 }, { -35343, 27946 }, { -35370, 27947 }, { 28562, 27948 },
+    { 28520, 27949 }, { -35503, 27950 }, { -35516, 27951 }, { -35536, 27952 },
+    { -35584, 27953 }, { -35626, 27954 }, { -35639, 27955 }, { -35707, 27956 },
+    { -35759, 27957 }, { -35794, 27958 }, { -35811, 27959 }, { -36130, 27960 },
+    { -36176, 27961 }, { -36250, 27962 }, { -36298, 27963 }, { -36419, 27964 },
+    { -36498, 27965 }, { -36532, 27966 }, { -36641, 27967 }, { -36654, 27968 },
+    { -36865, 27969 }, { -36978, 27970 }, { -37303, 27971 }, { -37718, 27972 },
+    { -38077, 27973 }, { -38094, 27974 }, { -38239, 27975 }, { 28541, 27976 },
+    { -38637, 27977 }, { -38657, 27978 }, { -38688, 27979 }, { -38739, 27980 },
+    { -38759, 27981 }, { -38772, 27982 }, { -38785, 27983 }, { -38798, 27984 },
+    { -38811, 27985 }, { -38838, 27986 }, { -38851, 27987 }, { -38864, 27988 },
+    { -38884, 27989 }, { -38904, 27990 }, { -38917, 27991 }, { -39027, 27992 },
+    { -39099, 27993 }, { -39112, 27994 }, { -39149, 27995 }, { -39317, 27996 },
+    { -39557, 27997 }, { -39570, 27998 }, { -39704, 27999 }, { -39717, 28000 },
+    { -39751, 28001 }, { -40193, 28002 }, { -40355, 28003 }, { -40426, 28004 },
+    { -40508, 28005 }, { -40521, 28006 }, { -40635, 28007 }, { -40735, 28008 },
+    { -40808, 28009 }, { -40852, 28010 }, { -40873, 28011 }, { -40975, 28012 },
+    { -41022, 28013 }, { -41110, 28014 }, { -41228, 28015 }, { -41241, 28016 },
+    { -41361, 28017 }, { -41374, 28018 }, { -41387, 28019 }, { -41400, 28020 },
+    { -41413, 28021 }, { -41604, 28022 }, { -41617, 28023 }, { -41721, 28024 },
+    { -41780, 28025 }, { -41793, 28026 }, { -41987, 28027 }, { -42241, 28028 },
+    { -42297, 28029 }, { -42426, 28030 }, { -42733, 28031 }, { -42800, 28032 },
+    { -42932, 28033 }, { -42945, 28034 }, { -43043, 28035 }, { -43407, 28036 },
+    { -43441, 28037 }, { -43561, 28038 }, { -43712, 28039 }, { -43900, 28040 },
+    { -43986, 28041 }, { -44213, 28042 }, { -44307, 28043 }, { -44439, 28044 },
+    { -44467, 28045 }, { -44512, 28046 }, { -44680, 28047 }, { -44693, 28048 },
+    { -44801, 28049 }, { -44814, 28050 }, { -44938, 28051 }, { -45122, 28052 },
+    { -45135, 28053 }, { -45148, 28054 }, { -45161, 28055 }, { -45174, 28056 },
+    { -45315, 28057 }, { -45693, 28058 }, { -45768, 28059 }, { -45970, 28060 },
+    { -46018, 28061 }, { -46083, 28062 }, { -46096, 28063 }, { -46206, 28064 },
+    { -46233, 28065 }, { -46253, 28066 }, { -46466, 28067 }, { -46864, 28068 },
+    { -47305, 28069 }, { -47557, 28070 }, { -47904, 28071 }, { -47939, 28072 },
+    { 28522, 28073 }, { -47998, 28074 }, { 28572, 28075 }, { -48521, 28076 },
+    { -48541, 28077 }, { -48572, 28078 }, { -48699, 28079 }, { -48734, 28080 },
+    { -49027, 28081 }, { -49103, 28082 }, { -49413, 28083 }, { -49438, 28084 },
+    { -49482, 28085 }, { -49536, 28086 }, { -49590, 28087 }, { -49611, 28088 },
+    { -49648, 28089 }, { -49934, 28090 }, { -50337, 28091 }, { -50663, 28092 },
+    { -50690, 28093 }, { -50710, 28094 }, { 28539, 28095 }, { -50858, 28096 },
+    { -50871, 28097 }, { -51131, 28098 }, { -51144, 28099 }, { -51195, 28100 },
+    { -51289, 28101 }, { -51310, 28102 }, { -51385, 28103 }, { 28541, 28110 },
+    { 28572, 28150 }, { 28573, 28151 }, { 28575, 28158 }, { 28537, 28159 },
+    { 28581, 28164 }, { 28548, 28171 }, { 28583, 28173 }, { 28548, 28174 },
+    { 28576, 28180 }, { 28550, 28188 }, { 28587, 28190 }, { 28548, 28193 },
+    { 28548, 28213 }, { 28552, 28222 }, { 28561, 28235 }, { 28564, 28248 },
+    { 28575, 28249 }, { 28538, 28274 }, { 28563, 28275 }, { 28562, 28280 },
+    { 28551, 28291 }, { 28569, 28295 }, { 28599, 28310 }, { 28554, 28322 },
+    { 28592, 28334 }, { 28592, 28342 }, { 28566, 28367 }, { 28555, 28379 },
+    { 28590, 28382 }, { 28609, 28415 }, { 28555, 28416 }, { 28598, 28426 },
+    { 28613, 28427 }, { 28602, 28429 }, { 28611, 28431 }, { 28559, 28445 },
+    { 28608, 28452 }, { 28609, 28457 }, { 28590, 28459 }, { 28566, 28494 },
+    { 28573, 28502 }, { 28618, 28507 }, { 28575, 28508 }, { 28573, 28535 },
+    { 28577, 28632 }, { 28571, 28634 }, { 28589, 28654 }, { 28759, 28663 },
+    { 28760, 28664 }, { 28761, 28665 }, { 28762, 28666 }, { 28763, 28667 },
+    { 28764, 28668 }, { 28765, 28669 }, { 28766, 28670 }, { 28537, 28671 },
+    { 28768, 28672 }, { 28539, 28673 }, { 28770, 28674 }, { 28771, 28675 },
+    { 28542, 28676 }, { 28773, 28677 }, { 28774, 28678 }, { 28775, 28679 },
+    { 28776, 28680 }, { 28547, 28681 }, { 28548, 28682 }, { 28779, 28683 },
+    { 28546, 28684 }, { 28781, 28685 }, { 28552, 28686 }, { 28783, 28687 },
+    { 28784, 28688 }, { 28785, 28689 }, { 28786, 28690 }, { 28553, 28691 },
+    { 28558, 28692 }, { 28789, 28693 }, { 28790, 28694 }, { 28791, 28695 },
+    { 28792, 28696 }, { 28563, 28697 }, { 28794, 28698 }, { 28795, 28699 },
+    { 28562, 28700 }, { 28567, 28701 }, { 28798, 28702 }, { 28799, 28703 },
+    { 28800, 28704 }, { 28801, 28705 }, { 28802, 28706 }, { 28803, 28707 },
+    { 28804, 28708 }, { 28805, 28709 }, { 28576, 28710 }, { -206, 28711 },
+    { -2488, 28712 }, { -2504, 28713 }, { -3621, 28714 }, { -3637, 28715 },
+    { -3923, 28716 }, { -4450, 28717 }, { -4489, 28718 }, { 28633, 28719 },
+    { -5515, 28720 }, { 28634, 28721 }, { -6129, 28722 }, { -6493, 28723 },
+    { 28663, 28724 }, { -11062, 28725 }, { -11817, 28726 }, { -12518, 28727 },
+    { -12657, 28728 }, { 28632, 28729 }, { 28633, 28730 }, { -15229, 28731 },
+    { 28676, 28732 }, { -16331, 28733 }, { 28621, 28734 }, { -18388, 28735 },
+    { -19896, 28736 }, { -20609, 28737 }, { -23513, 28738 }, { 28667, 28739 },
+    { 28628, 28740 }, { -27474, 28741 }, { -27511, 28742 }, { -28214, 28743 },
+    { -28230, 28744 }, { 28630, 28745 }, { -28902, 28746 }, { -29895, 28747 },
+    { 28663, 28748 }, { 28661, 28749 }, { -31444, 28750 }, { -34298, 28751 },
+    { -35238, 28752 }, { -35456, 28753 }, { -35476, 28754 }, { -38520, 28755 },
+    { -47974, 28756 }, { -48243, 28757 }, { 28654, 28758 }, { 28675, 28767 },
+    { 28676, 28769 }, { 28687, 28772 }, { 28694, 28777 }, { 28695, 28778 },
+    { 28684, 28780 }, { 28694, 28782 }, { 28667, 28787 }, { 28678, 28788 },
+    { 28650, 28793 }, { 28688, 28796 }, { 28654, 28797 }, { 28651, 28806 },
+    { 28833, 28807 }, { 28834, 28808 }, { 28835, 28809 }, { 28836, 28810 },
+    { 28837, 28811 }, { 28838, 28812 }, { 28839, 28813 }, { 28840, 28814 },
+    { 28841, 28815 }, { 28842, 28816 }, { 28843, 28817 }, { 28844, 28818 },
+    { 28845, 28819 }, { -4634, 28820 }, { -6073, 28821 }, { -9608, 28822 },
+    { -14689, 28823 }, { -14708, 28824 }, { -15879, 28825 }, { -17469, 28826 },
+    { -24544, 28827 }, { -25145, 28828 }, { -28538, 28829 }, { -30583, 28830 },
+    { -31309, 28831 }, { -50740, 28832 },
 };
-#define SIMP_TO_TRAD_MAX_LEN (6)
@@ -50,6 +50,22 @@ public:
         return get<IBusText> ()->text;
     }
 
+    /* a new text with its own string and attributes, the string of a
+     * StaticText is the buffer of the editor, which is reused */
+    IBusText *copy (void) const
+    {
+        IBusText *text = get<IBusText> ();
+        IBusText *dup = ibus_text_new_from_string (text->text);
+        IBusAttribute *attr;
+
+        for (guint i = 0; text->attrs &&
+                          (attr = ibus_attr_list_get (text->attrs, i)) != NULL; i++) {
+            ibus_text_append_attribute (dup, attr->type, attr->value,
+                                        attr->start_index, attr->end_index);
+        }
+        return dup;
+    }
+
     operator IBusText * (void) const
     {
         return get<IBusText> ();
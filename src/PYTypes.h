@@ -125,11 +125,13 @@ namespace PY {
 #define PINYIN_FUZZY_UANG_UAN       PINYIN_FUZZY_ANG_AN
 #define PINYIN_FUZZY_ALL            (0x1ffffe00)
 
+/* The strings are kept in the struct, so pinyin_table has no pointer to
+ * relocate and stays in read-only pages shared by all processes */
 struct Pinyin {
-    const gchar *text;
-    const wchar_t *bopomofo;
-    const gchar *sheng;
-    const gchar *yun;
+    const gchar text[7];
+    const wchar_t bopomofo[4];
+    const gchar sheng[3];
+    const gchar yun[5];         /* in utf8, v is written as ü */
     struct {
         guint8 sheng;
         guint8 yun;
@@ -138,6 +140,20 @@ struct Pinyin {
     const guint flags;
 };
 
+/* a state of the syllable DFA generated with pinyin_table */
+struct PinyinTrieNode {
+    guint32 children;       /* bit i is set if there is a child of 'a' + i */
+    guint16 first_child;
+    gint16 pinyin;          /* index in pinyin_table, -1 if none */
+};
+
+/* a state of the bopomofo DFA generated with pinyin_table */
+struct BopomofoTrieNode {
+    guint64 children;       /* bit i is set if there is a child of U+3105 + i */
+    guint16 first_child;
+    gint16 pinyin;          /* index in pinyin_table, -1 if none */
+};
+
 #define MAX_UTF8_LEN 6
 #define MAX_PHRASE_LEN 16
 
@@ -0,0 +1,146 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+#include "PYUserBigram.h"
+#include <algorithm>
+#include "PYBigram.h"
+
+namespace PY {
+
+UserBigram::UserBigram (guint max_pairs)
+    : m_size (0),
+      m_max_pairs (max_pairs),
+      m_time (0),
+      m_evictions (0)
+{
+    /* keep the load under 3/4 */
+    guint n = 1;
+    while (n * 3 < max_pairs * 4 + 1)
+        n <<= 1;
+    Slot empty = { 0, 0, 0 };
+    m_slots.assign (n, empty);
+}
+
+static inline guint64
+pair_key (const gchar *prev, const gchar *next)
+{
+    guint64 key = Bigram::hash (prev, next);
+    return key != 0 ? key : 1;
+}
+
+/* the slot of key, or the empty slot it would be put in */
+inline guint
+UserBigram::probe (guint64 key) const
+{
+    guint mask = m_slots.size () - 1;
+    guint i = key & mask;
+    while (m_slots[i].key != 0 && m_slots[i].key != key)
+        i = (i + 1) & mask;
+    return i;
+}
+
+inline void
+UserBigram::insert (const Slot & slot)
+{
+    Slot & s = m_slots[probe (slot.key)];
+    if (s.key == 0)
+        m_size ++;
+    s = slot;
+}
+
+void
+UserBigram::learn (const gchar *prev, const gchar *next)
+{
+    guint64 key = pair_key (prev, next);
+    Slot *slot = &m_slots[probe (key)];
+    if (slot->key == 0 && m_size >= m_max_pairs) {
+        evict ();
+        slot = &m_slots[probe (key)];
+    }
+    if (slot->key == 0) {
+        slot->key = key;
+        slot->freq = 0;
+        m_size ++;
+    }
+    slot->freq ++;
+    slot->time = ++m_time;
+}
+
+void
+UserBigram::restore (const gchar *prev, const gchar *next, guint freq)
+{
+    guint64 key = pair_key (prev, next);
+    Slot *slot = &m_slots[probe (key)];
+    if (slot->key == 0 && m_size >= m_max_pairs) {
+        evict ();
+        slot = &m_slots[probe (key)];
+    }
+    if (slot->key == 0) {
+        slot->key = key;
+        slot->freq = 0;
+        slot->time = 0;
+        m_size ++;
+    }
+    slot->freq = MAX (slot->freq, freq);
+}
+
+guint
+UserBigram::freq (const gchar *prev, const gchar *next) const
+{
+    /* empty slots have freq 0 */
+    return m_slots[probe (pair_key (prev, next))].freq;
+}
+
+bool
+UserBigram::evictFirst (const Slot & a, const Slot & b)
+{
+    if (a.freq != b.freq)
+        return a.freq < b.freq;
+    return a.time < b.time;
+}
+
+/* drops a quarter of the pairs, so it runs once for max_pairs / 4 new
+ * pairs, and freq is halved every 4 runs. Linear probing can not just
+ * empty a slot, so the table is filled again with the rest. */
+void
+UserBigram::evict (void)
+{
+    gboolean age = (++m_evictions % 4) == 0;
+    std::vector<Slot> slots;
+    slots.reserve (m_size);
+    for (guint i = 0; i < m_slots.size (); i++) {
+        if (m_slots[i].key == 0)
+            continue;
+        slots.push_back (m_slots[i]);
+        if (age)
+            slots.back ().freq = (slots.back ().freq + 1) / 2;
+    }
+
+    guint drop = MAX (slots.size () / 4, 1);
+    std::nth_element (slots.begin (), slots.begin () + drop, slots.end (), evictFirst);
+
+    Slot empty = { 0, 0, 0 };
+    std::fill (m_slots.begin (), m_slots.end (), empty);
+    m_size = 0;
+    for (guint i = drop; i < slots.size (); i++)
+        insert (slots[i]);
+}
+
+};
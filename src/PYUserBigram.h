@@ -0,0 +1,67 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+#ifndef __PY_USER_BIGRAM_H_
+#define __PY_USER_BIGRAM_H_
+
+#include <glib.h>
+#include <vector>
+
+namespace PY {
+
+/* Bounded table of the phrase pairs committed by the user, keyed by
+ * Bigram::hash. When it is full, the quarter with the lowest (freq, last
+ * use) is dropped, and freq of all pairs decays as it goes on. */
+class UserBigram {
+public:
+    UserBigram (guint max_pairs);
+
+    /* counts one more next after prev */
+    void learn (const gchar *prev, const gchar *next);
+    /* restores a saved pair, it keeps the greater freq */
+    void restore (const gchar *prev, const gchar *next, guint freq);
+    /* returns 0 if next was not committed after prev */
+    guint freq (const gchar *prev, const gchar *next) const;
+
+    guint size (void) const { return m_size; }
+
+private:
+    struct Slot {
+        guint64 key;        /* 0 is an empty slot */
+        guint32 freq;
+        guint32 time;       /* of the last use */
+    };
+
+    guint probe (guint64 key) const;
+    void insert (const Slot & slot);
+    void evict (void);
+    static bool evictFirst (const Slot & a, const Slot & b);
+
+private:
+    std::vector<Slot> m_slots;  /* open addressing, a power of two */
+    guint m_size;
+    guint m_max_pairs;
+    guint32 m_time;
+    guint m_evictions;
+};
+
+};
+
+#endif
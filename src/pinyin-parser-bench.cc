@@ -0,0 +1,416 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/* Compares the parsers of PinyinParser, with the syllable DFA and the
+ * bopomofo trie, with the parsers using binary searches they replaced,
+ * and checks they find the same syllables.
+ *
+ * usage: pinyin-parser-bench [n_strings] */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+#include <algorithm>
+#include <vector>
+#include "PYPinyinParser.h"
+#include "PYBopomofo.h"
+
+namespace PY {
+#include "PYPinyinParserTable.h"
+};
+
+using namespace PY;
+
+static gboolean
+check_flags (const Pinyin *pinyin, guint option)
+{
+    if (pinyin == NULL)
+        return FALSE;
+
+    if (pinyin->flags != 0) {
+        guint flags;
+        flags = pinyin->flags & option;
+        if (flags == 0)
+            return FALSE;
+        if ((flags != pinyin->flags) && ((pinyin->flags & PINYIN_CORRECT_ALL) != 0))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+static int
+py_cmp (const void *p1, const void *p2)
+{
+    const gchar *str = (const gchar *) p1;
+    const Pinyin *py = (const Pinyin *) p2;
+
+    return std::strcmp (str, py->text);
+}
+
+/* the longest syllable by binary searches for each length from 6 to 1 */
+static const Pinyin *
+bsearch_pinyin (const gchar *p, const gchar *end, guint option)
+{
+    gchar buf[8];
+    const Pinyin *result;
+    gint len = MIN (6, end - p);
+
+    std::strncpy (buf, p, len);
+    for (; len > 0; len --) {
+        buf[len] = 0;
+        result = (const Pinyin *) std::bsearch (buf, pinyin_table, G_N_ELEMENTS (pinyin_table),
+                                                sizeof (Pinyin), py_cmp);
+        if (check_flags (result, option))
+            return result;
+    }
+    return NULL;
+}
+
+/* the syllable of exact len chars */
+static const Pinyin *
+bsearch_pinyin (const gchar *p, const gchar *end, gint len, guint option)
+{
+    gchar buf[8];
+
+    if (len > 6 || len > end - p)
+        return NULL;
+    std::strncpy (buf, p, len);
+    buf[len] = 0;
+    const Pinyin *result = (const Pinyin *) std::bsearch (buf, pinyin_table, G_N_ELEMENTS (pinyin_table),
+                                                          sizeof (Pinyin), py_cmp);
+    return check_flags (result, option) ? result : NULL;
+}
+
+static int
+sp_cmp (const void *p1, const void *p2)
+{
+    const guint16 *pys = (const guint16 *) p1;
+    const guint16 *e = (const guint16 *) p2;
+
+    int retval = pys[0] - e[0];
+    if (retval != 0)
+        return retval;
+    return pys[1] - e[1];
+}
+
+/* parse as it was, with binary searches of pinyin_table */
+static guint
+bsearch_parse (const String &pinyin, guint option, PinyinArray &result)
+{
+    const gchar *p = pinyin;
+    const gchar *end = p + pinyin.size ();
+    const Pinyin *py;
+    const Pinyin *prev_py = NULL;
+    gchar prev_c = 0;
+
+    result.clear ();
+    while (p < end && result.size () < MAX_PHRASE_LEN) {
+        if (*p == '\'') {
+            prev_c = '\'';
+            p++;
+            continue;
+        }
+        py = bsearch_pinyin (p, end, option);
+        if (prev_c == 'r' || prev_c == 'n' || prev_c == 'g' || prev_c == 'e') {
+            switch (*p) {
+            case 'i': case 'u': case 'v': case 'a': case 'e': case 'o': case 'r':
+                {
+                    const Pinyin *new_py1 = bsearch_pinyin (prev_py->text,
+                                                            prev_py->text + prev_py->len,
+                                                            prev_py->len - 1, option);
+                    if (new_py1 != NULL) {
+                        const Pinyin *new_py2 = bsearch_pinyin (p - 1, end, option);
+                        if (new_py2 != NULL && new_py2->len > 1 &&
+                            (py == NULL || new_py2->len > py->len + 1)) {
+                            PinyinSegment & segment = result[result.size () - 1];
+                            segment.pinyin = new_py1;
+                            segment.len = new_py1->len;
+                            py = new_py2;
+                            p --;
+                            break;
+                        }
+                    }
+                    if (py == NULL)
+                        break;
+
+                    const guint16 pys[] = {
+                        (guint16) (prev_py - pinyin_table),
+                        (guint16) (py - pinyin_table)
+                    };
+                    const guint16 *pp = (const guint16 *) std::bsearch (pys, special_table,
+                                                                        G_N_ELEMENTS (special_table),
+                                                                        sizeof (special_table[0]), sp_cmp);
+                    if (pp != NULL) {
+                        PinyinSegment & segment = result[result.size () - 1];
+                        segment.pinyin = &pinyin_table[pp[2]];
+                        segment.len = segment.pinyin->len;
+                        py = &pinyin_table[pp[3]];
+                        p --;
+                    }
+                }
+                break;
+            default:
+                break;
+            }
+        }
+
+        if (py == NULL)
+            break;
+
+        result.append (py, p - (const gchar *) pinyin, py->len);
+        p += py->len;
+        prev_c = py->text[py->len - 1];
+        prev_py = py;
+    }
+
+    if (p == (const gchar *) pinyin)
+        return 0;
+    return p - (const gchar *) pinyin;
+}
+
+/* the segments of a and b are the same syllables of the same chars */
+static gboolean
+same_parse (const PinyinArray &a, const PinyinArray &b)
+{
+    if (a.size () != b.size ())
+        return FALSE;
+    for (guint k = 0; k < a.size (); k++) {
+        if (std::strcmp (a[k].pinyin->text, b[k].pinyin->text) != 0 ||
+            a[k].begin != b[k].begin || a[k].len != b[k].len)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+static bool
+bopomofo_less (const Pinyin *a, const Pinyin *b)
+{
+    return std::wcscmp (a->bopomofo, b->bopomofo) < 0;
+}
+
+static int
+bopomofo_cmp (const void *p1, const void *p2)
+{
+    const wchar_t *s1 = (wchar_t *) p1;
+    const Pinyin *s2 = *(const Pinyin **) p2;
+
+    return std::wcscmp (s1, s2->bopomofo);
+}
+
+/* parseBopomofo as it was, with binary searches of the sorted bopomofo of
+ * pinyin_table for each length from MAX_BOPOMOFO_LEN to 1 */
+static guint
+bsearch_parse_bopomofo (const std::wstring &bopomofo,
+                        guint               option,
+                        PinyinArray        &result)
+{
+    static std::vector<const Pinyin *> table;
+    const wchar_t *begin = bopomofo.c_str ();
+    const wchar_t *end = begin + bopomofo.length ();
+    const wchar_t *p = begin;
+    wchar_t buf[MAX_BOPOMOFO_LEN + 1];
+
+    if (table.empty ()) {
+        for (guint i = 0; i < G_N_ELEMENTS (pinyin_table); i++) {
+            if (pinyin_table[i].bopomofo[0] != 0)
+                table.push_back (&pinyin_table[i]);
+        }
+        std::sort (table.begin (), table.end (), bopomofo_less);
+    }
+
+    result.clear ();
+    while (p < end && result.size () < MAX_PHRASE_LEN) {
+        const Pinyin **py = NULL;
+        guint i, j;
+        for (i = MAX_BOPOMOFO_LEN; i > 0; i--) {
+            if (p + i > end)
+                continue;
+            for (j = 0; j < i; j++) {
+                if (j == i - 1 && PinyinParser::isBopomofoToneChar (p[j]))
+                    break;
+                buf[j] = p[j];
+            }
+            buf[j] = 0;
+            py = (const Pinyin **) std::bsearch (buf, &table[0], table.size (),
+                                                 sizeof (table[0]), bopomofo_cmp);
+            if (py != NULL && check_flags (*py, option))
+                break;
+        }
+        if (i == 0)
+            break;
+        result.append (*py, p - begin, i);
+        p += i;
+    }
+    return p - begin;
+}
+
+/* the same numbers on every run */
+static guint
+random_int (guint n)
+{
+    static guint32 seed = 1;
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) % n;
+}
+
+/* random syllables, with a few typos and separators */
+static void
+make_strings (guint n, std::vector<String> & strings)
+{
+    for (guint i = 0; i < n; i++) {
+        String str;
+        guint syllables = 1 + random_int (7);
+        for (guint j = 0; j < syllables; j++) {
+            str << pinyin_table[random_int (G_N_ELEMENTS (pinyin_table))].text;
+            if (random_int (20) == 0)
+                str << (gchar) (random_int (2) == 0 ? '\'' : 'a' + random_int (26));
+        }
+        strings.push_back (str);
+    }
+}
+
+/* random bopomofo syllables, with tones and a few stray symbols */
+static void
+make_bopomofo_strings (guint n, std::vector<std::wstring> & strings)
+{
+    static const wchar_t tones[] = {
+        bopomofo_char[BOPOMOFO_TONE_2], bopomofo_char[BOPOMOFO_TONE_3],
+        bopomofo_char[BOPOMOFO_TONE_4], bopomofo_char[BOPOMOFO_TONE_5],
+    };
+
+    for (guint i = 0; i < n; i++) {
+        std::wstring str;
+        guint syllables = 1 + random_int (7);
+        while (syllables > 0) {
+            const Pinyin & py = pinyin_table[random_int (G_N_ELEMENTS (pinyin_table))];
+            if (py.bopomofo[0] == 0)
+                continue;
+            str += py.bopomofo;
+            if (random_int (3) == 0)
+                str += tones[random_int (4)];
+            if (random_int (20) == 0)
+                str += bopomofo_char[1 + random_int (BOPOMOFO_TONE_2 - 1)];
+            syllables--;
+        }
+        strings.push_back (str);
+    }
+}
+
+int
+main (int argc, char **argv)
+{
+    static const guint options[] = {
+        0,
+        PINYIN_INCOMPLETE_PINYIN | PINYIN_CORRECT_ALL,
+        PINYIN_INCOMPLETE_PINYIN | PINYIN_CORRECT_ALL | PINYIN_FUZZY_ALL,
+    };
+    guint n = argc > 1 ? std::atoi (argv[1]) : 100000;
+    std::vector<String> strings;
+    std::vector<std::wstring> bopomofo_strings;
+    gint retval = 0;
+
+    make_strings (n, strings);
+    make_bopomofo_strings (n, bopomofo_strings);
+
+    for (guint k = 0; k < G_N_ELEMENTS (options); k++) {
+        guint option = options[k];
+        guint mismatches = 0;
+        gsize calls = 0;
+        gdouble elapsed[2];
+        PinyinArray results[2] = { PinyinArray (MAX_PHRASE_LEN), PinyinArray (MAX_PHRASE_LEN) };
+
+        /* every suffix of every string, as the parser may start anywhere */
+        std::vector<String> suffixes;
+        for (guint i = 0; i < strings.size (); i++) {
+            for (const gchar *p = strings[i]; *p != '\0'; p++)
+                suffixes.push_back (p);
+        }
+
+        for (guint m = 0; m < 2; m++) {
+            GTimer *timer = g_timer_new ();
+            for (guint i = 0; i < suffixes.size (); i++) {
+                if (m == 0)
+                    bsearch_parse (suffixes[i], option, results[0]);
+                else
+                    PinyinParser::parse (suffixes[i], suffixes[i].size (), option,
+                                         results[1], MAX_PHRASE_LEN);
+            }
+            elapsed[m] = g_timer_elapsed (timer, NULL);
+            g_timer_destroy (timer);
+        }
+
+        for (guint i = 0; i < suffixes.size (); i++, calls++) {
+            /* the parser has its own copy of pinyin_table */
+            guint a = bsearch_parse (suffixes[i], option, results[0]);
+            guint b = PinyinParser::parse (suffixes[i], suffixes[i].size (), option,
+                                           results[1], MAX_PHRASE_LEN);
+            if ((a != b || !same_parse (results[0], results[1])) && mismatches++ < 10)
+                std::fprintf (stderr, "mismatch at \"%s\"\n", suffixes[i].c_str ());
+        }
+
+        std::printf ("option 0x%08x: bsearch %.2f us, dfa %.2f us per parse, "
+                     "%u mismatches\n",
+                     option, elapsed[0] * 1e6 / calls, elapsed[1] * 1e6 / calls, mismatches);
+        if (mismatches > 0)
+            retval = 1;
+
+        /* bopomofo, every suffix of every string */
+        mismatches = 0;
+        calls = 0;
+        for (guint m = 0; m < 2; m++) {
+            GTimer *timer = g_timer_new ();
+            for (guint i = 0; i < bopomofo_strings.size (); i++) {
+                const std::wstring & str = bopomofo_strings[i];
+                for (guint j = 0; j < str.length (); j++) {
+                    std::wstring suffix = str.substr (j);
+                    if (m == 0)
+                        bsearch_parse_bopomofo (suffix, option, results[0]);
+                    else
+                        PinyinParser::parseBopomofo (suffix, suffix.length (), option,
+                                                     results[1], MAX_PHRASE_LEN);
+                }
+            }
+            elapsed[m] = g_timer_elapsed (timer, NULL);
+            g_timer_destroy (timer);
+        }
+
+        for (guint i = 0; i < bopomofo_strings.size (); i++) {
+            const std::wstring & str = bopomofo_strings[i];
+            for (guint j = 0; j < str.length (); j++, calls++) {
+                std::wstring suffix = str.substr (j);
+                guint a = bsearch_parse_bopomofo (suffix, option, results[0]);
+                guint b = PinyinParser::parseBopomofo (suffix, suffix.length (), option,
+                                                       results[1], MAX_PHRASE_LEN);
+                if ((a != b || !same_parse (results[0], results[1])) && mismatches++ < 10)
+                    std::fprintf (stderr, "bopomofo mismatch at %u of string %u\n", j, i);
+            }
+        }
+
+        std::printf ("option 0x%08x: bopomofo bsearch %.2f us, trie %.2f us per parse, "
+                     "%u mismatches\n",
+                     option, elapsed[0] * 1e6 / calls, elapsed[1] * 1e6 / calls, mismatches);
+        if (mismatches > 0)
+            retval = 1;
+    }
+
+    return retval;
+}
@@ -0,0 +1,213 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/* Edits random texts the way FullPinyinEditor does, and checks that
+ * PinyinParser::reparse after every edit gives the same segments as a
+ * parse of the whole text, and that the lattice of the text has them.
+ *
+ * usage: pinyin-parser-test [n_sessions] */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "PYPinyinParser.h"
+
+namespace PY {
+#include "PYPinyinParserTable.h"
+};
+
+using namespace PY;
+
+#define MAX_TEXT_LEN    (64)
+
+/* the same numbers on every run */
+static guint
+random_int (guint n)
+{
+    static guint32 seed = 1;
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) % n;
+}
+
+/* mostly chars of real syllables, so resplits happen often */
+static gchar
+random_char (void)
+{
+    switch (random_int (8)) {
+    case 0:
+        return '\'';
+    case 1:
+        return 'a' + random_int (26);
+    default:
+        {
+            const Pinyin & py = pinyin_table[random_int (G_N_ELEMENTS (pinyin_table))];
+            return py.text[random_int (py.len)];
+        }
+    }
+}
+
+static gboolean
+same (const PinyinArray & a, const PinyinArray & b)
+{
+    if (a.size () != b.size ())
+        return FALSE;
+    for (guint i = 0; i < a.size (); i++) {
+        if (a[i].pinyin != b[i].pinyin ||
+            a[i].begin != b[i].begin ||
+            a[i].len != b[i].len)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/* the segments of pinyin are in lattice, and the other segments are
+ * complete syllables of the text */
+static gboolean
+check_lattice (const String & text, const PinyinArray & pinyin, const PinyinLattice & lattice)
+{
+    if (pinyin.empty ())
+        return lattice.empty ();
+
+    guint k = 0;
+    for (guint pos = 0; pos < lattice.length (); pos++) {
+        gboolean found = k == pinyin.size () || pinyin[k].begin != pos;
+        for (const PinyinSegment *segment = lattice.begin (pos);
+             segment < lattice.end (pos); segment++) {
+            if (k < pinyin.size () && *segment == pinyin[k]) {
+                found = TRUE;
+                continue;
+            }
+            if (segment->pinyin->flags != 0 ||
+                segment->len != segment->pinyin->len ||
+                std::strncmp (segment->pinyin->text, (const gchar *) text + pos, segment->len) != 0)
+                return FALSE;
+        }
+        if (!found)
+            return FALSE;
+        if (k < pinyin.size () && pinyin[k].begin == pos)
+            k ++;
+    }
+    return k == pinyin.size ();
+}
+
+static void
+dump (const gchar *name, const PinyinArray & pinyin)
+{
+    std::fprintf (stderr, "  %s:", name);
+    for (guint i = 0; i < pinyin.size (); i++)
+        std::fprintf (stderr, " %s@%u", pinyin[i].pinyin->text, pinyin[i].begin);
+    std::fprintf (stderr, "\n");
+}
+
+int
+main (int argc, char **argv)
+{
+    static const guint options[] = {
+        0,
+        PINYIN_INCOMPLETE_PINYIN | PINYIN_CORRECT_ALL,
+        PINYIN_INCOMPLETE_PINYIN | PINYIN_CORRECT_ALL | PINYIN_FUZZY_ALL,
+    };
+    guint n = argc > 1 ? std::atoi (argv[1]) : 20000;
+    guint edits = 0;
+    guint mismatches = 0;
+
+    for (guint k = 0; k < G_N_ELEMENTS (options); k++) {
+        guint option = options[k];
+
+        for (guint i = 0; i < n; i++) {
+            String text;
+            guint cursor = 0;
+            PinyinArray pinyin (MAX_PHRASE_LEN);
+            PinyinArray expected (MAX_PHRASE_LEN);
+            guint pinyin_len = 0;
+
+            for (guint j = 0; j < 40; j++) {
+                /* the begin of the change, as FullPinyinEditor passes it */
+                guint edit_pos;
+
+                switch (random_int (10)) {
+                case 0:
+                    if (cursor == 0)
+                        continue;
+                    text.erase (--cursor, 1);
+                    edit_pos = cursor;
+                    break;
+                case 1:
+                    if (cursor == 0)
+                        continue;
+                    edit_pos = --cursor;
+                    break;
+                case 2:
+                    if (cursor == text.size ())
+                        continue;
+                    edit_pos = cursor++;
+                    break;
+                case 3:
+                    if (cursor == text.size ())
+                        continue;
+                    edit_pos = cursor;
+                    cursor = text.size ();
+                    break;
+                case 4:
+                    /* only the text after cursor changes, nothing is parsed */
+                    if (cursor < text.size ())
+                        text.erase (cursor, 1);
+                    continue;
+                default:
+                    if (text.size () >= MAX_TEXT_LEN)
+                        continue;
+                    text.insert (cursor, random_char ());
+                    edit_pos = cursor++;
+                    break;
+                }
+
+                pinyin_len = PinyinParser::reparse (text, cursor, option, pinyin,
+                                                    MAX_PHRASE_LEN, MIN (edit_pos, pinyin_len));
+                guint expected_len = PinyinParser::parse (text, cursor, option, expected,
+                                                          MAX_PHRASE_LEN);
+                edits ++;
+
+                PinyinLattice lattice;
+                PinyinParser::parseLattice (text, expected, option, lattice, 2);
+                if (!check_lattice (text, expected, lattice)) {
+                    if (mismatches++ < 10)
+                        std::fprintf (stderr, "bad lattice of \"%.*s\", option 0x%08x\n",
+                                      cursor, (const gchar *) text, option);
+                }
+
+                if (pinyin_len != expected_len || !same (pinyin, expected)) {
+                    if (mismatches++ < 10) {
+                        std::fprintf (stderr, "mismatch on \"%.*s\", option 0x%08x, edit at %u\n",
+                                      cursor, (const gchar *) text, option, edit_pos);
+                        dump ("reparse", pinyin);
+                        dump ("parse", expected);
+                    }
+                    /* go on from the right state */
+                    pinyin = expected;
+                    pinyin_len = expected_len;
+                }
+            }
+        }
+    }
+
+    std::printf ("%u edits, %u mismatches\n", edits, mismatches);
+    return mismatches > 0 ? 1 : 0;
+}
@@ -0,0 +1,179 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/* Measures the throughput of SimpTradConverter::simpToTrad on the lines
+ * of a utf8 file, or on random hanzi phrases as candidates are, one by
+ * one and by pages of the lookup table. With glibc it counts the heap
+ * allocations too.
+ *
+ * usage: simp-trad-bench [file] */
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "PYSimpTradConverter.h"
+#include "PYString.h"
+
+using namespace PY;
+
+#define PAGE_SIZE   (10)
+
+static gsize n_allocs = 0;
+
+#ifdef __GLIBC__
+extern "C" {
+extern void *__libc_malloc (size_t size);
+extern void *__libc_calloc (size_t n, size_t size);
+extern void *__libc_realloc (void *ptr, size_t size);
+
+void *
+malloc (size_t size)
+{
+    n_allocs ++;
+    return __libc_malloc (size);
+}
+
+void *
+calloc (size_t n, size_t size)
+{
+    n_allocs ++;
+    return __libc_calloc (n, size);
+}
+
+void *
+realloc (void *ptr, size_t size)
+{
+    n_allocs ++;
+    return __libc_realloc (ptr, size);
+}
+};
+#endif
+
+/* the same numbers on every run */
+static guint
+random_int (guint n)
+{
+    static guint32 seed = 1;
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) % n;
+}
+
+/* phrases of 1 to 6 hanzi, most of them in the common range */
+static void
+make_phrases (guint n, std::vector<String> & phrases)
+{
+    for (guint i = 0; i < n; i++) {
+        String phrase;
+        guint len = 1 + random_int (6);
+        for (guint j = 0; j < len; j++) {
+            gunichar ch = 0x4e00 + random_int (j % 2 == 0 ? 0x1000 : 0x51a6);
+            phrase.appendUnichar (ch);
+        }
+        phrases.push_back (phrase);
+    }
+}
+
+static gboolean
+read_lines (const gchar *filename, std::vector<String> & lines)
+{
+    gchar *contents;
+    if (!g_file_get_contents (filename, &contents, NULL, NULL))
+        return FALSE;
+
+    for (gchar *line = std::strtok (contents, "\n");
+         line != NULL;
+         line = std::strtok (NULL, "\n")) {
+        if (g_utf8_validate (line, -1, NULL))
+            lines.push_back (line);
+    }
+    g_free (contents);
+    return TRUE;
+}
+
+/* converts all phrases once, one by one or by pages */
+static void
+convert (const PhraseArray     &phrases,
+         gboolean               by_page,
+         String                &out,
+         std::vector<guint>    &offsets)
+{
+    if (!by_page) {
+        for (guint i = 0; i < phrases.size (); i++) {
+            out.truncate (0);
+            SimpTradConverter::simpToTrad (phrases[i].phrase, out);
+        }
+        return;
+    }
+
+    for (guint i = 0; i < phrases.size (); i += PAGE_SIZE) {
+        out.truncate (0);
+        SimpTradConverter::simpToTrad (phrases, i, MIN (i + PAGE_SIZE, phrases.size ()),
+                                       out, offsets);
+    }
+}
+
+int
+main (int argc, char **argv)
+{
+    std::vector<String> lines;
+    gsize size = 0;
+
+    if (argc > 1) {
+        if (!read_lines (argv[1], lines)) {
+            std::fprintf (stderr, "can not read %s\n", argv[1]);
+            return 1;
+        }
+    }
+    else {
+        make_phrases (200000, lines);
+    }
+
+    PhraseArray phrases (lines.size ());
+    for (guint i = 0; i < lines.size (); i++) {
+        phrases[i].reset ();
+        g_strlcpy (phrases[i].phrase, lines[i], sizeof (phrases[i].phrase));
+        size += std::strlen (phrases[i].phrase);
+    }
+
+    for (gint by_page = 0; by_page < 2; by_page++) {
+        String out;
+        std::vector<guint> offsets;
+
+        /* the first run grows the buffers */
+        convert (phrases, by_page, out, offsets);
+
+        GTimer *timer = g_timer_new ();
+        gsize allocs = n_allocs;
+        for (guint k = 0; k < 5; k++)
+            convert (phrases, by_page, out, offsets);
+        gdouble elapsed = g_timer_elapsed (timer, NULL);
+        allocs = n_allocs - allocs;
+        g_timer_destroy (timer);
+
+        std::printf ("%s: %u phrases, %lu bytes: %.1f MB/s, %.2f us and %.2f allocations per phrase\n",
+                     by_page ? "by page" : "one by one",
+                     (guint) phrases.size (), (gulong) size,
+                     size * 5 / elapsed / 1e6,
+                     elapsed * 1e6 / (phrases.size () * 5),
+                     (gdouble) allocs / (phrases.size () * 5));
+    }
+    return 0;
+}
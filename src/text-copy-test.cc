@@ -0,0 +1,93 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-pinyin - The Chinese PinYin engine for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/* Builds the preedit and the auxiliary text from the same buffer, the
+ * way editors do, and checks that the copies Engine keeps until the end
+ * of a frame stay as they were when the buffer is reused.
+ *
+ * usage: text-copy-test */
+
+#include <cstdio>
+#include <cstring>
+#include "PYString.h"
+#include "PYText.h"
+#include "PYPointer.h"
+
+using namespace PY;
+
+static gboolean
+check (IBusText *text, const gchar *str, guint type, guint value, guint start, guint end)
+{
+    IBusAttribute *attr;
+
+    if (std::strcmp (text->text, str) != 0) {
+        std::fprintf (stderr, "text is \"%s\", not \"%s\"\n", text->text, str);
+        return FALSE;
+    }
+    if (text->attrs == NULL || (attr = ibus_attr_list_get (text->attrs, 0)) == NULL) {
+        std::fprintf (stderr, "no attribute on \"%s\"\n", str);
+        return FALSE;
+    }
+    if (attr->type != type || attr->value != value ||
+        attr->start_index != start || attr->end_index != end ||
+        ibus_attr_list_get (text->attrs, 1) != NULL) {
+        std::fprintf (stderr, "wrong attributes on \"%s\"\n", str);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+int
+main (void)
+{
+    String buffer (64);
+    Pointer<IBusText> preedit;
+    Pointer<IBusText> aux;
+    gboolean ok = TRUE;
+
+    ibus_init ();
+
+    buffer << "ni hao";
+    {
+        StaticText text (buffer);
+        text.appendAttribute (IBUS_ATTR_TYPE_UNDERLINE, IBUS_ATTR_UNDERLINE_SINGLE, 0, -1);
+        preedit = text.copy ();
+    }
+
+    /* the editor reuses its buffer for the auxiliary text */
+    buffer.clear ();
+    buffer << "ni'hao|";
+    {
+        StaticText text (buffer);
+        text.appendAttribute (IBUS_ATTR_TYPE_FOREGROUND, 0x004466, 0, 2);
+        aux = text.copy ();
+    }
+
+    /* and for the next key, before the frame is sent */
+    buffer.clear ();
+    buffer << "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx";
+
+    ok = check (preedit, "ni hao", IBUS_ATTR_TYPE_UNDERLINE, IBUS_ATTR_UNDERLINE_SINGLE, 0, -1) && ok;
+    ok = check (aux, "ni'hao|", IBUS_ATTR_TYPE_FOREGROUND, 0x004466, 0, 2) && ok;
+
+    std::printf ("%s\n", ok ? "ok" : "failed");
+    return ok ? 0 : 1;
+}